@@ -55,6 +55,7 @@ enum AppSampleEnum {
 	APP_SAMPLE_BLOB_VACATION,
 	APP_SAMPLE_VOXEL_RAYTRACER,
 	APP_SAMPLE_SDF_2D,
+	APP_SAMPLE_COMPUTE_BLUR,
 #endif
 
 	APP_SAMPLE_COUNT,
@@ -165,6 +166,16 @@ static AppSample app_samples[APP_SAMPLE_COUNT] = {
 			.vertices_count = 4,
 		},
 	},
+	[APP_SAMPLE_COMPUTE_BLUR] = {
+		.shader_name = "compute-blur",
+		.shader_type = APP_SHADER_TYPE_COMPUTE,
+		.compute = {
+			.shader_cs = HCC_SHADER_compute_blur_cs,
+			.dispatch_group_size_x = 1,
+			.dispatch_group_size_y = 1,
+			.dispatch_group_size_z = 1,
+		},
+	},
 #endif
 };
 
@@ -295,6 +295,19 @@ int main(int argc, char** argv) {
 				bc->ar = ar;
 				break;
 			};
+			case APP_SAMPLE_COMPUTE_BLUR: {
+				ComputeBlurBC* bc = bundled_constants_ptr;
+				if (init_sample) {
+					bc->logo_texture = logo_texture_id;
+					bc->output = backbuffer_texture_id;
+				}
+				app_samples[sample_enum].compute.dispatch_group_size_x = (window_width + 7) / 8;
+				app_samples[sample_enum].compute.dispatch_group_size_y = (window_height + 7) / 8;
+				bc->time_ = time_ * 0.25f;
+				bc->screen_width = window_width;
+				bc->screen_height = window_height;
+				break;
+			};
 #endif
 		}
 
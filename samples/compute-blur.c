@@ -0,0 +1,71 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <hmaths_types.h>
+#include <hcc_shader.h>
+
+#define COMPUTE_BLUR_RADIUS 1
+#define COMPUTE_BLUR_TAPS (COMPUTE_BLUR_RADIUS * 2 + 1)
+#define COMPUTE_BLUR_TEXEL_STEP 4
+
+typedef struct ComputeBlurBC ComputeBlurBC;
+struct ComputeBlurBC {
+	HccRoTexture2D(FMT_8_8_8_8_UNORM) logo_texture;
+	HccWoTexture2D(FMT_8_8_8_8_UNORM) output;
+	float                             time_;
+	uint32_t                          screen_width;
+	uint32_t                          screen_height;
+};
+
+#ifdef __HCC__
+#include <hmaths.h>
+
+//
+// maps a screen coordinate onto the logo, keeping far enough inside of it that the taps do not need clamping.
+// the early return leaves behind a basic block that cannot be reached once this is inlined, the loops below still get unrolled.
+uint32_t compute_blur_logo_coord(uint32_t screen_coord, uint32_t screen_size) {
+	uint32_t border = COMPUTE_BLUR_RADIUS * COMPUTE_BLUR_TEXEL_STEP;
+	if (screen_size <= 1) {
+		return border;
+	}
+
+	return border + screen_coord * (1023 - border * 2) / (screen_size - 1);
+}
+
+//
+// box blurs the logo on the left of a line that sweeps across the screen and leaves the right as it is.
+// the blur loops have a constant trip count, so with -O2 and above hcc unrolls them, the inner loops first and then the outer.
+HCC_COMPUTE(8, 8, 1)
+void compute_blur_cs(HccComputeSV const* const sv, ComputeBlurBC const* const bc) {
+	if (sv->dispatch_idx.x >= bc->screen_width || sv->dispatch_idx.y >= bc->screen_height) {
+		return;
+	}
+
+	uint32_t logo_x = compute_blur_logo_coord(sv->dispatch_idx.x, bc->screen_width);
+	uint32_t logo_y = compute_blur_logo_coord(sv->dispatch_idx.y, bc->screen_height);
+	float r = 0.f;
+	float g = 0.f;
+	float b = 0.f;
+	for (int32_t y = -COMPUTE_BLUR_RADIUS; y <= COMPUTE_BLUR_RADIUS; y += 1) {
+		for (int32_t x = -COMPUTE_BLUR_RADIUS; x <= COMPUTE_BLUR_RADIUS; x += 1) {
+			uint32_t tap_x = (uint32_t)((int32_t)logo_x + x * COMPUTE_BLUR_TEXEL_STEP);
+			uint32_t tap_y = (uint32_t)((int32_t)logo_y + y * COMPUTE_BLUR_TEXEL_STEP);
+			f32x4 texel = load_textureG(bc->logo_texture, u32x2(tap_x, tap_y));
+			r += texel.x;
+			g += texel.y;
+			b += texel.z;
+		}
+	}
+
+	f32x4 color;
+	float split = (bc->time_ - (float)(int32_t)bc->time_) * (float)bc->screen_width;
+	if ((float)sv->dispatch_idx.x < split) {
+		float scale = 1.f / (float)(COMPUTE_BLUR_TAPS * COMPUTE_BLUR_TAPS);
+		color = f32x4(r * scale, g * scale, b * scale, 1.f);
+	} else {
+		color = load_textureG(bc->logo_texture, u32x2(logo_x, logo_y));
+	}
+
+	store_textureG(bc->output, u32x2(sv->dispatch_idx.x, sv->dispatch_idx.y), color);
+}
+
+#endif // __HCC__
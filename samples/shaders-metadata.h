@@ -16,6 +16,7 @@ enum HccShader {
 	HCC_SHADER_voxel_raytracer_cs,
 	HCC_SHADER_sdf2d_vs,
 	HCC_SHADER_sdf2d_ps,
+	HCC_SHADER_compute_blur_cs,
 	HCC_SHADER_COUNT,
 };
 
@@ -29,6 +30,7 @@ enum HccResourceStruct {
 	HCC_RESOURCE_STRUCT_VoxelRaytracerBC,
 	HCC_RESOURCE_STRUCT_SDFShape,
 	HCC_RESOURCE_STRUCT_SDF2dBC,
+	HCC_RESOURCE_STRUCT_ComputeBlurBC,
 };
 
 const char* hcc_shader_names[] = {
@@ -44,6 +46,7 @@ const char* hcc_shader_names[] = {
 	"voxel_raytracer_cs",
 	"sdf2d_vs",
 	"sdf2d_ps",
+	"compute_blur_cs",
 };
 
 HccShaderInfo hcc_shader_infos[] = {
@@ -143,6 +146,14 @@ HccShaderInfo hcc_shader_infos[] = {
 		/* .dispatch_group_size_y = */  0,
 		/* .dispatch_group_size_z = */  0,
 	},
+	{
+		/* .name = */                   "compute_blur_cs",
+		/* .stage = */                  HCC_SHADER_STAGE_COMPUTE,
+		/* .bundled_constants_size = */ 20,
+		/* .dispatch_group_size_x = */  8,
+		/* .dispatch_group_size_y = */  8,
+		/* .dispatch_group_size_z = */  1,
+	},
 };
 
 HccResourceInfo TriangleBC_resources[] = {
@@ -262,6 +273,21 @@ HccResourceInfo SDF2dBC_resources[] = {
 	},
 };
 
+HccResourceInfo ComputeBlurBC_resources[] = {
+	{
+		/* .name = */        "logo_texture",
+		/* .offset = */      0,
+		/* .access_mode = */ HCC_RESOURCE_ACCESS_MODE_READ_ONLY,
+		/* .type = */        HCC_RESOURCE_TYPE_TEXTURE_2D,
+	},
+	{
+		/* .name = */        "output",
+		/* .offset = */      4,
+		/* .access_mode = */ HCC_RESOURCE_ACCESS_MODE_WRITE_ONLY,
+		/* .type = */        HCC_RESOURCE_TYPE_TEXTURE_2D,
+	},
+};
+
 HccResourceStructInfo hcc_resource_structs[] = {
 	{0},
 	{
@@ -313,13 +339,20 @@ HccResourceStructInfo hcc_resource_structs[] = {
 		/* .size = */            16,
 		/* .align = */           4,
 	},
+	{
+		/* .name = */            "ComputeBlurBC",
+		/* .resources = */       ComputeBlurBC_resources,
+		/* .resources_count = */ 2,
+		/* .size = */            20,
+		/* .align = */           4,
+	},
 };
 
 HccMetadata hcc_metadata = {
 	/* .shaders = */                    hcc_shader_infos,
 	/* .resource_structs = */           hcc_resource_structs,
-	/* .shaders_count = */              12,
-	/* .resource_structs_count = */     7,
+	/* .shaders_count = */              13,
+	/* .resource_structs_count = */     8,
 	/* .bundled_constants_size_max = */ 48,
 	/* .resource_descriptors_max = */   1024,
 };
@@ -7,4 +7,5 @@
 #include "blob-vacation.c"
 #include "voxel-raytracer.c"
 #include "sdf-2d.c"
+#include "compute-blur.c"
 #endif
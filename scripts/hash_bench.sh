@@ -0,0 +1,7 @@
+#!/bin/sh
+mkdir -p build
+clang -O2 -D_GNU_SOURCE -std=gnu11 -Ilibhmaths -Ilibhccintrinsics -Iinterop -o build/hash_bench tools/hash_bench.c -lm -ldl -pthread
+if test $? -ne 0; then
+	exit
+fi
+./build/hash_bench "$@"
@@ -1,6 +1,6 @@
 #!/bin/sh
 mkdir -p build
-clang -o build/intrinsics_gen tools/intrinsics_gen.c
+clang -D_GNU_SOURCE -std=gnu11 -Ilibhmaths -Ilibhccintrinsics -Iinterop -o build/intrinsics_gen tools/intrinsics_gen.c -lm -ldl -pthread
 if test $? -ne 0; then
 	exit
 fi
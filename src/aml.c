@@ -225,7 +225,7 @@ HccAMLFunction* hcc_aml_function_alctor_alloc(HccCU* cu, uint32_t max_instrs_cou
 	HccAMLBasicBlockParam* basic_block_params = hcc_stack_push_many_thread_safe(function_alctor->basic_block_params_pool, basic_block_params_cap);
 	HccAMLBasicBlockParamSrc* basic_block_param_srcs = hcc_stack_push_many_thread_safe(function_alctor->basic_block_param_srcs_pool, basic_block_param_srcs_cap);
 
-	HccAMLFunction* function = hcc_stack_push(function_alctor->functions_pool);
+	HccAMLFunction* function = hcc_stack_push_thread_safe(function_alctor->functions_pool);
 	function->identifier_location = NULL;
 	function->identifier_string_id.idx_plus_one = 0;
 	function->params_count = 0;
@@ -252,6 +252,25 @@ HccAMLFunction* hcc_aml_function_alctor_alloc(HccCU* cu, uint32_t max_instrs_cou
 	return function;
 }
 
+HccAMLFunction* hcc_aml_function_alctor_alloc_for_counts(HccCU* cu, uint32_t words_count, uint32_t values_count, uint32_t basic_blocks_count, uint32_t basic_block_params_count, uint32_t basic_block_param_srcs_count) {
+	//
+	// ask the allocator for enough instructions that every array of the function fits in its capacity
+	uint32_t max_instrs_count = 1 << HCC_AML_FUNCTION_ALLOCATOR_INTSR_MIN_LOG2;
+	max_instrs_count = HCC_MAX(max_instrs_count, (uint32_t)ceilf((float)words_count / HCC_AML_INSTR_AVERAGE_WORDS));
+	max_instrs_count = HCC_MAX(max_instrs_count, (uint32_t)ceilf((float)values_count / HCC_AML_INSTR_AVERAGE_VALUES));
+	max_instrs_count = HCC_MAX(max_instrs_count, (uint32_t)ceilf((float)basic_blocks_count / HCC_AML_INSTR_AVERAGE_BASIC_BLOCKS));
+	max_instrs_count = HCC_MAX(max_instrs_count, (uint32_t)ceilf((float)basic_block_params_count / HCC_AML_INSTR_AVERAGE_BASIC_BLOCK_PARAMS));
+	max_instrs_count = HCC_MAX(max_instrs_count, (uint32_t)ceilf((float)basic_block_param_srcs_count / HCC_AML_INSTR_AVERAGE_BASIC_BLOCK_PARAM_SRCS));
+
+	HccAMLFunction* function = hcc_aml_function_alctor_alloc(cu, max_instrs_count);
+	function->words_count = words_count;
+	function->values_count = values_count;
+	function->basic_blocks_count = basic_blocks_count;
+	function->basic_block_params_count = basic_block_params_count;
+	function->basic_block_param_srcs_count = basic_block_param_srcs_count;
+	return function;
+}
+
 void hcc_aml_function_alctor_dealloc(HccCU* cu, HccAMLFunction* function) {
 	uint32_t instr_count_log2 = hcc_aml_function_alctor_instr_count_round_up_log2(cu, (uint32_t)ceilf((float)function->words_cap / HCC_AML_INSTR_AVERAGE_WORDS));
 	HCC_ASSERT(instr_count_log2 < HCC_AML_FUNCTION_ALLOCATOR_INTSR_MAX_LOG2, "how could the deallocated function be larger than the maximum allocation?");
@@ -599,6 +618,7 @@ bool hcc_aml_op_code_has_return_value[HCC_AML_OP_COUNT] = {
 	[HCC_AML_OP_ATOMIC_BIT_OR] = true,
 	[HCC_AML_OP_ATOMIC_BIT_XOR] = true,
 	[HCC_AML_OP_LOAD_TEXTURE] = true,
+	[HCC_AML_OP_FETCH_TEXTURE] = true,
 	[HCC_AML_OP_SAMPLE_TEXTURE] = true,
 	[HCC_AML_OP_SAMPLE_MIP_BIAS_TEXTURE] = true,
 	[HCC_AML_OP_SAMPLE_MIP_GRADIENT_TEXTURE] = true,
@@ -715,15 +735,23 @@ HccAMLBasicBlockParamSrc* hcc_aml_function_basic_block_param_srcs(HccAMLFunction
 void hcc_aml_init(HccCU* cu, HccCUSetup* setup) {
 	hcc_aml_function_alctor_init(cu, &setup->aml.function_alctor);
 	cu->aml.functions = hcc_stack_init(HccAtomic(HccAMLFunction*), HCC_ALLOC_TAG_AML_FUNCTIONS, setup->functions_grow_count, setup->functions_reserve_cap);
-	cu->aml.locations = hcc_stack_init(HccLocation*, HCC_ALLOC_TAG_AML_LOCATIONS, setup->ast.expr_locations_grow_count, setup->ast.expr_locations_reserve_cap);
+	cu->aml.locations = hcc_stack_init(HccLocationId, HCC_ALLOC_TAG_AML_LOCATIONS, setup->ast.expr_locations_grow_count, setup->ast.expr_locations_reserve_cap);
 	cu->aml.call_graph_nodes = hcc_stack_init(HccAMLCallNode, HCC_ALLOC_TAG_AML_CALL_GRAPH_NODES, setup->functions_grow_count, setup->functions_reserve_cap);
 	cu->aml.function_call_node_lists = hcc_stack_init(HccAMLCallNode*, 	HCC_ALLOC_TAG_AML_FUNCTION_CALL_NODE_LISTS, setup->functions_grow_count, setup->functions_reserve_cap);
 	cu->aml.optimize_functions[0] = hcc_stack_init(HccDecl, HCC_ALLOC_TAG_AML_OPIMIZE_FUNCTIONS, setup->functions_grow_count, setup->functions_reserve_cap);
 	cu->aml.optimize_functions[1] = hcc_stack_init(HccDecl, HCC_ALLOC_TAG_AML_OPIMIZE_FUNCTIONS, setup->functions_grow_count, setup->functions_reserve_cap);
+	cu->aml.inline_functions = hcc_stack_init(HccAMLFunction*, HCC_ALLOC_TAG_AML_INLINE_FUNCTIONS, setup->functions_grow_count, setup->functions_reserve_cap);
 }
 
 void hcc_aml_deinit(HccCU* cu) {
 	hcc_aml_function_alctor_deinit(cu);
+	hcc_stack_deinit(cu->aml.functions);
+	hcc_stack_deinit(cu->aml.locations);
+	hcc_stack_deinit(cu->aml.call_graph_nodes);
+	hcc_stack_deinit(cu->aml.function_call_node_lists);
+	hcc_stack_deinit(cu->aml.optimize_functions[0]);
+	hcc_stack_deinit(cu->aml.optimize_functions[1]);
+	hcc_stack_deinit(cu->aml.inline_functions);
 }
 
 void hcc_aml_print_operand(HccCU* cu, const HccAMLFunction* function, HccAMLOperand operand, HccIIO* iio, bool is_definition) {
@@ -879,7 +907,7 @@ void hcc_aml_print(HccCU* cu, HccIIO* iio) {
 				for (uint32_t param_idx = bb->params_start_idx; param_idx < bb->params_start_idx + bb->params_count; param_idx += 1) {
 					hcc_aml_print_operand(cu, function, HCC_AML_OPERAND(BASIC_BLOCK_PARAM, param_idx), iio, true);
 
-					if (param_idx + 1 < bb->params_count) {
+					if (param_idx + 1 < bb->params_start_idx + bb->params_count) {
 						hcc_iio_write_fmt(iio, ", ");
 					}
 				}
@@ -915,7 +943,7 @@ void hcc_aml_print(HccCU* cu, HccIIO* iio) {
 }
 
 HccLocation* hcc_aml_instr_location(HccCU* cu, HccAMLInstr* instr) {
-	return *hcc_stack_get(cu->aml.locations, HCC_AML_INSTR_LOCATION_IDX(instr));
+	return hcc_location_table_get(cu, *hcc_stack_get(cu->aml.locations, HCC_AML_INSTR_LOCATION_IDX(instr)));
 }
 
 HccStack(HccDecl) hcc_aml_optimize_functions(HccCU* cu) {
@@ -927,6 +955,30 @@ void hcc_aml_next_optimize_functions_array(HccCU* cu) {
 	hcc_stack_clear(cu->aml.optimize_functions[cu->aml.optimize_functions_idx]);
 }
 
+void hcc_aml_inline_functions_take_refs(HccCU* cu) {
+	uint32_t functions_count = hcc_stack_count(cu->aml.functions);
+	hcc_stack_clear(cu->aml.inline_functions);
+	HCC_ZERO_ELMT_MANY(hcc_stack_push_many(cu->aml.inline_functions, functions_count), functions_count);
+
+	//
+	// the functions of the last phase replace themselves while their callers are inlining them,
+	// so hold on to the version that every caller should copy from.
+	HccStack(HccDecl) optimize_functions = hcc_aml_optimize_functions(cu);
+	for (uint32_t idx = 0; idx < hcc_stack_count(optimize_functions); idx += 1) {
+		HccDecl function_decl = optimize_functions[idx];
+		cu->aml.inline_functions[HCC_DECL_AUX(function_decl)] = hcc_aml_function_take_ref(cu, function_decl);
+	}
+}
+
+void hcc_aml_inline_functions_return_refs(HccCU* cu) {
+	for (uint32_t idx = 0; idx < hcc_stack_count(cu->aml.inline_functions); idx += 1) {
+		if (cu->aml.inline_functions[idx]) {
+			hcc_aml_function_return_ref(cu, cu->aml.inline_functions[idx]);
+		}
+	}
+	hcc_stack_clear(cu->aml.inline_functions);
+}
+
 HccAMLOperand hcc_aml_basic_block_next(const HccAMLFunction* function, HccAMLOperand basic_block_operand) {
 	HCC_DEBUG_ASSERT(HCC_AML_OPERAND_IS_BASIC_BLOCK(basic_block_operand), "expected a basic block");
 
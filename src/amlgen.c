@@ -34,8 +34,8 @@ HccAMLOperand hcc_amlgen_value_add(HccWorker* w, HccDataType data_type) {
 }
 
 HccAMLOperand hcc_amlgen_basic_block_add(HccWorker* w, HccLocation* location) {
-	HccLocation** dst_location = hcc_stack_push_thread_safe(w->cu->aml.locations);
-	*dst_location = location;
+	HccLocationId* dst_location = hcc_stack_push_thread_safe(w->cu->aml.locations);
+	*dst_location = hcc_location_table_id(w->cu, location);
 	w->amlgen.last_op = HCC_AML_OP_BASIC_BLOCK;
 	w->amlgen.last_location = location;
 	w->amlgen.is_inside_basic_block = true;
@@ -60,8 +60,8 @@ HccAMLOperand* hcc_amlgen_instr_add(HccWorker* w, HccLocation* location, HccAMLO
 		hcc_amlgen_basic_block_add(w, location);
 	}
 
-	HccLocation** dst_location = hcc_stack_push_thread_safe(w->cu->aml.locations);
-	*dst_location = location;
+	HccLocationId* dst_location = hcc_stack_push_thread_safe(w->cu->aml.locations);
+	*dst_location = hcc_location_table_id(w->cu, location);
 	w->amlgen.last_op = op;
 	w->amlgen.last_location = location;
 	uint32_t location_idx = dst_location - w->cu->aml.locations;
@@ -147,6 +147,24 @@ HccAMLOperand hcc_amlgen_generate_instrs(HccWorker* w, HccASTExpr* expr, bool wa
 			HccAMLOperand variable_operand = hcc_amlgen_instr_add_2(w, expr->location, HCC_AML_OP_PTR_STATIC_ALLOC, hcc_amlgen_value_add(w, ptr_data_type), variable_data_type);
 
 			HccASTExpr* initializer_expr = expr->curly_initializer.first_expr;
+			if (HCC_DATA_TYPE_IS_VECTOR(variable_data_type)) {
+				//
+				// the first designated initializer zeros the whole variable.
+				// a vector constructor like (f32x4){ x, y, z, w } sets every component after it,
+				// so skip the zeroing as that store ends up in every copy of an inlined or unrolled body.
+				uint32_t set_columns_mask = 0;
+				for (HccASTExpr* next_expr = initializer_expr->next_stmt; next_expr; next_expr = next_expr->next_stmt) {
+					if (next_expr->designated_initializer.elmts_count == 1 && !next_expr->designated_initializer.is_swizzle) {
+						set_columns_mask |= 1 << *hcc_stack_get(cu->ast.designated_initializer_elmt_indices, next_expr->designated_initializer.elmt_indices_start_idx);
+					}
+				}
+
+				uint32_t columns_mask = (1 << HCC_AML_INTRINSIC_DATA_TYPE_COLUMNS(HCC_DATA_TYPE_AUX(variable_data_type))) - 1;
+				if (initializer_expr->designated_initializer.elmts_count == 0 && (set_columns_mask & columns_mask) == columns_mask) {
+					initializer_expr = initializer_expr->next_stmt;
+				}
+			}
+
 			while (initializer_expr) {
 				HCC_DEBUG_ASSERT(initializer_expr->type == HCC_AST_EXPR_TYPE_DESIGNATED_INITIALIZER, "internal error: expected a designated initializer");
 				uint64_t* elmt_indices = hcc_stack_get(cu->ast.designated_initializer_elmt_indices, initializer_expr->designated_initializer.elmt_indices_start_idx);
@@ -1619,8 +1637,5 @@ void hcc_amlgen_generate(HccWorker* w) {
 			hcc_amlgen_instr_add(w, w->amlgen.last_location, HCC_AML_OP_UNREACHABLE, 0);
 		}
 	}
-
-	HccStack(HccDecl) optimize_functions = hcc_aml_optimize_functions(w->cu);
-	*hcc_stack_push_thread_safe(optimize_functions) = function_decl;
 }
 
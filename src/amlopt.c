@@ -14,6 +14,8 @@ HccAMLOptFn hcc_aml_opts_phase_2_level_0[] = {
 };
 
 HccAMLOptFn hcc_aml_opts_phase_0_level_1[] = {
+	hcc_amlopt_promote_static_allocs,
+	hcc_amlopt_eliminate_dead_code,
 	hcc_amlopt_make_call_graph,
 };
 
@@ -23,9 +25,17 @@ HccAMLOptFn hcc_aml_opts_phase_1_level_1[] = {
 
 HccAMLOptFn hcc_aml_opts_phase_2_level_1[] = {
 	hcc_amlopt_check_for_unsupported_features,
+	hcc_amlopt_inline,
+	hcc_amlopt_promote_static_allocs,
+	hcc_amlopt_constant_fold,
+	hcc_amlopt_value_numbering,
+	hcc_amlopt_hoist_loop_invariants,
+	hcc_amlopt_eliminate_dead_code,
 };
 
 HccAMLOptFn hcc_aml_opts_phase_0_level_2[] = {
+	hcc_amlopt_promote_static_allocs,
+	hcc_amlopt_eliminate_dead_code,
 	hcc_amlopt_make_call_graph,
 };
 
@@ -35,9 +45,20 @@ HccAMLOptFn hcc_aml_opts_phase_1_level_2[] = {
 
 HccAMLOptFn hcc_aml_opts_phase_2_level_2[] = {
 	hcc_amlopt_check_for_unsupported_features,
+	hcc_amlopt_inline,
+	hcc_amlopt_promote_static_allocs,
+	hcc_amlopt_constant_fold,
+	hcc_amlopt_value_numbering,
+	hcc_amlopt_hoist_loop_invariants,
+	hcc_amlopt_unroll_loops,
+	hcc_amlopt_constant_fold,
+	hcc_amlopt_value_numbering,
+	hcc_amlopt_eliminate_dead_code,
 };
 
 HccAMLOptFn hcc_aml_opts_phase_0_level_3[] = {
+	hcc_amlopt_promote_static_allocs,
+	hcc_amlopt_eliminate_dead_code,
 	hcc_amlopt_make_call_graph,
 };
 
@@ -47,9 +68,20 @@ HccAMLOptFn hcc_aml_opts_phase_1_level_3[] = {
 
 HccAMLOptFn hcc_aml_opts_phase_2_level_3[] = {
 	hcc_amlopt_check_for_unsupported_features,
+	hcc_amlopt_inline,
+	hcc_amlopt_promote_static_allocs,
+	hcc_amlopt_constant_fold,
+	hcc_amlopt_value_numbering,
+	hcc_amlopt_hoist_loop_invariants,
+	hcc_amlopt_unroll_loops,
+	hcc_amlopt_constant_fold,
+	hcc_amlopt_value_numbering,
+	hcc_amlopt_eliminate_dead_code,
 };
 
 HccAMLOptFn hcc_aml_opts_phase_0_level_s[] = {
+	hcc_amlopt_promote_static_allocs,
+	hcc_amlopt_eliminate_dead_code,
 	hcc_amlopt_make_call_graph,
 };
 
@@ -59,6 +91,12 @@ HccAMLOptFn hcc_aml_opts_phase_1_level_s[] = {
 
 HccAMLOptFn hcc_aml_opts_phase_2_level_s[] = {
 	hcc_amlopt_check_for_unsupported_features,
+	hcc_amlopt_inline,
+	hcc_amlopt_promote_static_allocs,
+	hcc_amlopt_constant_fold,
+	hcc_amlopt_value_numbering,
+	hcc_amlopt_hoist_loop_invariants,
+	hcc_amlopt_eliminate_dead_code,
 };
 
 HccAMLOptFn hcc_aml_opts_phase_0_level_g[] = {
@@ -127,9 +165,61 @@ uint32_t hcc_aml_opts_count[HCC_AML_OPT_PHASE_COUNT][HCC_OPT_LEVEL_COUNT] = {
 	},
 };
 
+HccAMLOptFn hcc_aml_opt_pass_fns[HCC_AML_OPT_PASS_COUNT] = {
+	[HCC_AML_OPT_PASS_MAKE_CALL_GRAPH] = hcc_amlopt_make_call_graph,
+	[HCC_AML_OPT_PASS_CHECK_FOR_RECURSION] = hcc_amlopt_check_for_recursion_and_make_ordered_function_list,
+	[HCC_AML_OPT_PASS_CHECK_FOR_UNSUPPORTED_FEATURES] = hcc_amlopt_check_for_unsupported_features,
+	[HCC_AML_OPT_PASS_INLINE] = hcc_amlopt_inline,
+	[HCC_AML_OPT_PASS_PROMOTE_STATIC_ALLOCS] = hcc_amlopt_promote_static_allocs,
+	[HCC_AML_OPT_PASS_CONSTANT_FOLD] = hcc_amlopt_constant_fold,
+	[HCC_AML_OPT_PASS_VALUE_NUMBERING] = hcc_amlopt_value_numbering,
+	[HCC_AML_OPT_PASS_HOIST_LOOP_INVARIANTS] = hcc_amlopt_hoist_loop_invariants,
+	[HCC_AML_OPT_PASS_UNROLL_LOOPS] = hcc_amlopt_unroll_loops,
+	[HCC_AML_OPT_PASS_ELIMINATE_DEAD_CODE] = hcc_amlopt_eliminate_dead_code,
+};
+
+//
+// callees with at most this many instructions get inlined, functions marked inline always are
+uint32_t hcc_amlopt_inline_instrs_limits[HCC_OPT_LEVEL_COUNT] = {
+	[HCC_OPT_LEVEL_0] = 0,
+	[HCC_OPT_LEVEL_1] = 16,
+	[HCC_OPT_LEVEL_2] = 64,
+	[HCC_OPT_LEVEL_3] = 256,
+	[HCC_OPT_LEVEL_S] = 8,
+	[HCC_OPT_LEVEL_G] = 0,
+};
+
+//
+// unrolling trades size for speed, so it is left off at -Os
+HccAMLOptUnrollLimits hcc_amlopt_unroll_limits[HCC_OPT_LEVEL_COUNT] = {
+	[HCC_OPT_LEVEL_0] = { 0 },
+	[HCC_OPT_LEVEL_1] = { 0 },
+	[HCC_OPT_LEVEL_2] = { .full_trip_count_max = 8, .partial_copies_max = 2, .instrs_max = 256 },
+	[HCC_OPT_LEVEL_3] = { .full_trip_count_max = 32, .partial_copies_max = 4, .instrs_max = 1024 },
+	[HCC_OPT_LEVEL_S] = { 0 },
+	[HCC_OPT_LEVEL_G] = { 0 },
+};
+
 void hcc_amlopt_init(HccWorker* w, HccCompilerSetup* setup) {
-	HCC_UNUSED(w);
-	HCC_UNUSED(setup);
+	w->amlopt.value_replacements = hcc_stack_init(HccAMLOperand, HCC_ALLOC_TAG_AMLOPT_VALUE_REPLACEMENTS, setup->amlopt.value_replacements_grow_count, setup->amlopt.value_replacements_reserve_cap);
+	w->amlopt.basic_blocks = hcc_stack_init(HccAMLOptBasicBlock, HCC_ALLOC_TAG_AMLOPT_BASIC_BLOCKS, setup->amlopt.basic_blocks_grow_count, setup->amlopt.basic_blocks_reserve_cap);
+	w->amlopt.values = hcc_stack_init(HccAMLOptValue, HCC_ALLOC_TAG_AMLOPT_VALUES, setup->amlopt.values_grow_count, setup->amlopt.values_reserve_cap);
+	w->amlopt.basic_block_preds = hcc_stack_init(uint32_t, HCC_ALLOC_TAG_AMLOPT_BASIC_BLOCK_PREDS, setup->amlopt.basic_block_edges_grow_count, setup->amlopt.basic_block_edges_reserve_cap);
+	w->amlopt.basic_block_order = hcc_stack_init(uint32_t, HCC_ALLOC_TAG_AMLOPT_BASIC_BLOCK_ORDER, setup->amlopt.basic_blocks_grow_count, setup->amlopt.basic_blocks_reserve_cap);
+	w->amlopt.basic_block_work = hcc_stack_init(uint32_t, HCC_ALLOC_TAG_AMLOPT_BASIC_BLOCK_WORK, setup->amlopt.basic_block_edges_grow_count, setup->amlopt.basic_block_edges_reserve_cap);
+	w->amlopt.dominance_frontiers = hcc_stack_init(uint32_t, HCC_ALLOC_TAG_AMLOPT_DOMINANCE_FRONTIERS, setup->amlopt.basic_block_edges_grow_count, setup->amlopt.basic_block_edges_reserve_cap);
+	w->amlopt.allocs = hcc_stack_init(HccAMLOptAlloc, HCC_ALLOC_TAG_AMLOPT_ALLOCS, setup->amlopt.allocs_grow_count, setup->amlopt.allocs_reserve_cap);
+	w->amlopt.alloc_params = hcc_stack_init(HccAMLOptAllocParam, HCC_ALLOC_TAG_AMLOPT_ALLOC_PARAMS, setup->amlopt.basic_block_edges_grow_count, setup->amlopt.basic_block_edges_reserve_cap);
+	w->amlopt.alloc_def_basic_blocks = hcc_stack_init(uint32_t, HCC_ALLOC_TAG_AMLOPT_ALLOC_DEF_BASIC_BLOCKS, setup->amlopt.basic_block_edges_grow_count, setup->amlopt.basic_block_edges_reserve_cap);
+	w->amlopt.alloc_values = hcc_stack_init(HccAMLOperand, HCC_ALLOC_TAG_AMLOPT_ALLOC_VALUES, setup->amlopt.alloc_values_grow_count, setup->amlopt.alloc_values_reserve_cap);
+	w->amlopt.inline_sites = hcc_stack_init(HccAMLOptInlineSite, HCC_ALLOC_TAG_AMLOPT_INLINE_SITES, setup->amlopt.inline_sites_grow_count, setup->amlopt.inline_sites_reserve_cap);
+	w->amlopt.inline_callee_marks = hcc_stack_init(uint32_t, HCC_ALLOC_TAG_AMLOPT_INLINE_CALLEE_MARKS, setup->amlopt.basic_blocks_grow_count, setup->amlopt.basic_blocks_reserve_cap);
+	w->amlopt.dominator_children = hcc_stack_init(uint32_t, HCC_ALLOC_TAG_AMLOPT_DOMINATOR_CHILDREN, setup->amlopt.basic_blocks_grow_count, setup->amlopt.basic_blocks_reserve_cap);
+	w->amlopt.value_numbers = hcc_stack_init(HccAMLOptValueNumber, HCC_ALLOC_TAG_AMLOPT_VALUE_NUMBERS, setup->amlopt.value_numbers_grow_count, setup->amlopt.value_numbers_reserve_cap);
+	w->amlopt.value_number_buckets = hcc_stack_init(uint32_t, HCC_ALLOC_TAG_AMLOPT_VALUE_NUMBER_BUCKETS, setup->amlopt.value_numbers_grow_count, setup->amlopt.value_numbers_reserve_cap);
+	w->amlopt.loop_hoists = hcc_stack_init(uint32_t, HCC_ALLOC_TAG_AMLOPT_LOOP_HOISTS, setup->amlopt.values_grow_count, setup->amlopt.values_reserve_cap);
+	w->amlopt.unroll_loops = hcc_stack_init(HccAMLOptUnrollLoop, HCC_ALLOC_TAG_AMLOPT_UNROLL_LOOPS, setup->amlopt.basic_blocks_grow_count, setup->amlopt.basic_blocks_reserve_cap);
+	w->amlopt.unroll_iter_params = hcc_stack_init(HccAMLOperand, HCC_ALLOC_TAG_AMLOPT_UNROLL_ITER_PARAMS, setup->amlopt.value_replacements_grow_count, setup->amlopt.value_replacements_reserve_cap);
 }
 
 void hcc_amlopt_deinit(HccWorker* w) {
@@ -441,40 +531,4141 @@ CONTINUE:
 		aml_word_idx += HCC_AML_INSTR_WORDS_COUNT(aml_instr);
 	}
 
-	HccStack(HccDecl) optimize_functions = hcc_aml_optimize_functions(cu);
-	*hcc_stack_push_thread_safe(optimize_functions) = function_decl;
-
 	return aml_function;
 }
 
-void hcc_amlopt_optimize(HccWorker* w) {
-	HccCU* cu = w->cu;
-	HccDecl function_decl = (HccDecl)(uintptr_t)w->job.arg;
-	HccAMLFunction* aml_function = hcc_aml_function_take_ref(cu, function_decl);
-	HccAtomic(HccAMLFunction*)* dst_aml_function = hcc_stack_get(cu->aml.functions, HCC_DECL_AUX(function_decl));
+HccAMLFunction* hcc_amlopt_function_alloc(HccCU* cu, const HccAMLFunction* aml_function, uint32_t words_count, uint32_t values_count, uint32_t basic_blocks_count, uint32_t basic_block_params_count, uint32_t basic_block_param_srcs_count) {
+	HccAMLFunction* new_aml_function = hcc_aml_function_alctor_alloc_for_counts(cu, words_count, values_count, basic_blocks_count, basic_block_params_count, basic_block_param_srcs_count);
+	new_aml_function->identifier_location = aml_function->identifier_location;
+	new_aml_function->identifier_string_id = aml_function->identifier_string_id;
+	new_aml_function->function_data_type = aml_function->function_data_type;
+	new_aml_function->return_data_type = aml_function->return_data_type;
+	new_aml_function->shader_stage = aml_function->shader_stage;
+	new_aml_function->opt_level = aml_function->opt_level;
+	new_aml_function->params_count = aml_function->params_count;
+	new_aml_function->compute_dispatch_group_size_x = aml_function->compute_dispatch_group_size_x;
+	new_aml_function->compute_dispatch_group_size_y = aml_function->compute_dispatch_group_size_y;
+	new_aml_function->compute_dispatch_group_size_z = aml_function->compute_dispatch_group_size_z;
+	new_aml_function->found_texture_sample_location = aml_function->found_texture_sample_location;
+	return new_aml_function;
+}
 
-	HccAMLOptFn* opts = hcc_aml_opts[cu->aml.opt_phase][aml_function->opt_level];
-	uint32_t opts_count = hcc_aml_opts_count[cu->aml.opt_phase][aml_function->opt_level];
+HccAMLOptBasicBlock* hcc_amlopt_basic_blocks_init(HccWorker* w, const HccAMLFunction* aml_function) {
+	hcc_stack_clear(w->amlopt.basic_blocks);
+	HccAMLOptBasicBlock* basic_blocks = hcc_stack_push_many(w->amlopt.basic_blocks, aml_function->basic_blocks_count);
+	for (uint32_t basic_block_idx = 0; basic_block_idx < aml_function->basic_blocks_count; basic_block_idx += 1) {
+		HccAMLOptBasicBlock* basic_block = &basic_blocks[basic_block_idx];
+		HCC_ZERO_ELMT(basic_block);
+		basic_block->new_idx = UINT32_MAX;
+		basic_block->merge_word_idx = UINT32_MAX;
+		basic_block->terminator_word_idx = UINT32_MAX;
+		basic_block->branch_target_idx = UINT32_MAX;
+		basic_block->idom_idx = UINT32_MAX;
+		basic_block->order_idx = UINT32_MAX;
+	}
 
-	for (uint32_t opt_idx = 0; opt_idx < opts_count; opt_idx += 1) {
-		HccAMLOptFn optimize_fn = opts[opt_idx];
-		HccAMLFunction* new_aml_function = (HccAMLFunction*)optimize_fn(w, function_decl, aml_function);
+	//
+	// find the merge and terminator of every basic block.
+	// anything after the first terminator of a basic block can never run.
+	uint32_t basic_block_idx = 0;
+	for (uint32_t aml_word_idx = 0; aml_word_idx < aml_function->words_count; ) {
+		HccAMLInstr* aml_instr = &aml_function->words[aml_word_idx];
+		HccAMLOp aml_op = HCC_AML_INSTR_OP(aml_instr);
+		HccAMLOperand* aml_operands = HCC_AML_INSTR_OPERANDS(aml_instr);
+		if (aml_op == HCC_AML_OP_BASIC_BLOCK) {
+			basic_block_idx = HCC_AML_OPERAND_AUX(aml_operands[0]);
+		}
 
-		if (aml_function != new_aml_function) {
-			//
-			// optimization made a new function, so lets:
-			// - store the new function in the array of functions
-			// - return the old function reference and potentially deallocate it.
-			new_aml_function->ref_count = 1;
-			atomic_store(dst_aml_function, new_aml_function);
+		HccAMLOptBasicBlock* basic_block = &basic_blocks[basic_block_idx];
+		if (basic_block->terminator_word_idx == UINT32_MAX) {
+			switch (aml_op) {
+				case HCC_AML_OP_LOOP_MERGE:
+					basic_block->is_loop_header = true;
+					hcc_fallthrough;
+				case HCC_AML_OP_SELECTION_MERGE:
+					basic_block->merge_word_idx = aml_word_idx;
+					break;
+				case HCC_AML_OP_BRANCH:
+				case HCC_AML_OP_BRANCH_CONDITIONAL:
+				case HCC_AML_OP_SWITCH:
+				case HCC_AML_OP_RETURN:
+				case HCC_AML_OP_UNREACHABLE:
+					basic_block->terminator_word_idx = aml_word_idx;
+					break;
+			}
+		}
 
-			aml_function->can_free = true;
-			hcc_aml_function_return_ref(cu, aml_function);
+		aml_word_idx += HCC_AML_INSTR_WORDS_COUNT(aml_instr);
+	}
+
+	return basic_blocks;
+}
+
+uint32_t hcc_amlopt_basic_block_successors_count(const HccAMLFunction* aml_function, const HccAMLOptBasicBlock* basic_block) {
+	if (basic_block->terminator_word_idx == UINT32_MAX) {
+		return 0;
+	}
+
+	HccAMLInstr* aml_instr = &aml_function->words[basic_block->terminator_word_idx];
+	switch (HCC_AML_INSTR_OP(aml_instr)) {
+		case HCC_AML_OP_BRANCH: return 1;
+		case HCC_AML_OP_BRANCH_CONDITIONAL: return 2;
+		case HCC_AML_OP_SWITCH: return 1 + (HCC_AML_INSTR_OPERANDS_COUNT(aml_instr) - 2) / 2;
+		default: return 0;
+	}
+}
+
+uint32_t hcc_amlopt_basic_block_successor(const HccAMLFunction* aml_function, const HccAMLOptBasicBlock* basic_block, uint32_t successor_idx) {
+	HccAMLInstr* aml_instr = &aml_function->words[basic_block->terminator_word_idx];
+	HccAMLOperand* aml_operands = HCC_AML_INSTR_OPERANDS(aml_instr);
+	switch (HCC_AML_INSTR_OP(aml_instr)) {
+		case HCC_AML_OP_BRANCH: return HCC_AML_OPERAND_AUX(aml_operands[0]);
+		case HCC_AML_OP_BRANCH_CONDITIONAL: return HCC_AML_OPERAND_AUX(aml_operands[1 + successor_idx]);
+		case HCC_AML_OP_SWITCH: return HCC_AML_OPERAND_AUX(aml_operands[successor_idx == 0 ? 1 : 1 + (successor_idx * 2)]);
+		default: HCC_UNREACHABLE("basic block terminator does not have successors");
+	}
+}
+
+void hcc_amlopt_dominators(HccWorker* w, const HccAMLFunction* aml_function) {
+	HccAMLOptBasicBlock* basic_blocks = w->amlopt.basic_blocks;
+	HccStack(uint32_t) order = w->amlopt.basic_block_order;
+	HccStack(uint32_t) work = w->amlopt.basic_block_work;
+	HccStack(uint32_t) preds = w->amlopt.basic_block_preds;
+
+	//
+	// depth first search from the entry basic block for the reverse postorder of the basic blocks it can reach.
+	// the work stack holds pairs of a basic block and the next of its successors to visit.
+	hcc_stack_clear(order);
+	hcc_stack_clear(work);
+	*hcc_stack_push(work) = 0;
+	*hcc_stack_push(work) = 0;
+	basic_blocks[0].order_idx = 0;
+	while (hcc_stack_count(work)) {
+		uint32_t work_count = hcc_stack_count(work);
+		uint32_t basic_block_idx = work[work_count - 2];
+		uint32_t successor_idx = work[work_count - 1];
+		HccAMLOptBasicBlock* basic_block = &basic_blocks[basic_block_idx];
+		if (successor_idx == hcc_amlopt_basic_block_successors_count(aml_function, basic_block)) {
+			*hcc_stack_push(order) = basic_block_idx;
+			hcc_stack_pop_many(work, 2);
+			continue;
 		}
 
-		aml_function = new_aml_function;
+		work[work_count - 1] += 1;
+		uint32_t successor_basic_block_idx = hcc_amlopt_basic_block_successor(aml_function, basic_block, successor_idx);
+		if (basic_blocks[successor_basic_block_idx].order_idx == UINT32_MAX) {
+			basic_blocks[successor_basic_block_idx].order_idx = 0; // mark as visited, the real index is given below
+			*hcc_stack_push(work) = successor_basic_block_idx;
+			*hcc_stack_push(work) = 0;
+		}
 	}
 
-	hcc_aml_function_return_ref(cu, aml_function);
+	uint32_t order_count = hcc_stack_count(order);
+	for (uint32_t order_idx = 0; order_idx < order_count / 2; order_idx += 1) {
+		uint32_t tmp = order[order_idx];
+		order[order_idx] = order[order_count - order_idx - 1];
+		order[order_count - order_idx - 1] = tmp;
+	}
+	for (uint32_t order_idx = 0; order_idx < order_count; order_idx += 1) {
+		basic_blocks[order[order_idx]].order_idx = order_idx;
+	}
+
+	//
+	// gather the predecessors that can be reached from the entry basic block.
+	// count them with duplicates first and then skip the duplicates when storing them,
+	// a basic block's duplicate edges come from the same terminator so they are always next to each other.
+	hcc_stack_clear(preds);
+	for (uint32_t order_idx = 0; order_idx < order_count; order_idx += 1) {
+		HccAMLOptBasicBlock* basic_block = &basic_blocks[order[order_idx]];
+		uint32_t successors_count = hcc_amlopt_basic_block_successors_count(aml_function, basic_block);
+		for (uint32_t successor_idx = 0; successor_idx < successors_count; successor_idx += 1) {
+			basic_blocks[hcc_amlopt_basic_block_successor(aml_function, basic_block, successor_idx)].preds_count += 1;
+		}
+	}
+
+	uint32_t preds_count = 0;
+	for (uint32_t basic_block_idx = 0; basic_block_idx < aml_function->basic_blocks_count; basic_block_idx += 1) {
+		HccAMLOptBasicBlock* basic_block = &basic_blocks[basic_block_idx];
+		basic_block->preds_start_idx = preds_count;
+		preds_count += basic_block->preds_count;
+		basic_block->preds_count = 0;
+	}
+	hcc_stack_push_many(preds, preds_count);
+
+	for (uint32_t order_idx = 0; order_idx < order_count; order_idx += 1) {
+		uint32_t basic_block_idx = order[order_idx];
+		HccAMLOptBasicBlock* basic_block = &basic_blocks[basic_block_idx];
+		uint32_t successors_count = hcc_amlopt_basic_block_successors_count(aml_function, basic_block);
+		for (uint32_t successor_idx = 0; successor_idx < successors_count; successor_idx += 1) {
+			HccAMLOptBasicBlock* successor_basic_block = &basic_blocks[hcc_amlopt_basic_block_successor(aml_function, basic_block, successor_idx)];
+			if (successor_basic_block->preds_count && preds[successor_basic_block->preds_start_idx + successor_basic_block->preds_count - 1] == basic_block_idx) {
+				continue;
+			}
+
+			preds[successor_basic_block->preds_start_idx + successor_basic_block->preds_count] = basic_block_idx;
+			successor_basic_block->preds_count += 1;
+		}
+	}
+
+	//
+	// "A Simple, Fast Dominance Algorithm" by Keith D. Cooper, Timothy J. Harvey and Ken Kennedy.
+	// walk the basic blocks in reverse postorder, narrowing down each immediate dominator until nothing changes.
+	basic_blocks[0].idom_idx = 0;
+	bool is_changed = true;
+	while (is_changed) {
+		is_changed = false;
+		for (uint32_t order_idx = 1; order_idx < order_count; order_idx += 1) {
+			HccAMLOptBasicBlock* basic_block = &basic_blocks[order[order_idx]];
+			uint32_t idom_idx = UINT32_MAX;
+			for (uint32_t pred_idx = basic_block->preds_start_idx; pred_idx < basic_block->preds_start_idx + basic_block->preds_count; pred_idx += 1) {
+				uint32_t pred_basic_block_idx = preds[pred_idx];
+				if (basic_blocks[pred_basic_block_idx].idom_idx == UINT32_MAX) {
+					continue;
+				}
+
+				idom_idx = idom_idx == UINT32_MAX ? pred_basic_block_idx : hcc_amlopt_dominators_intersect(basic_blocks, pred_basic_block_idx, idom_idx);
+			}
+
+			if (basic_block->idom_idx != idom_idx) {
+				basic_block->idom_idx = idom_idx;
+				is_changed = true;
+			}
+		}
+	}
+}
+
+uint32_t hcc_amlopt_dominators_intersect(HccAMLOptBasicBlock* basic_blocks, uint32_t a_basic_block_idx, uint32_t b_basic_block_idx) {
+	while (a_basic_block_idx != b_basic_block_idx) {
+		while (basic_blocks[a_basic_block_idx].order_idx > basic_blocks[b_basic_block_idx].order_idx) {
+			a_basic_block_idx = basic_blocks[a_basic_block_idx].idom_idx;
+		}
+		while (basic_blocks[b_basic_block_idx].order_idx > basic_blocks[a_basic_block_idx].order_idx) {
+			b_basic_block_idx = basic_blocks[b_basic_block_idx].idom_idx;
+		}
+	}
+
+	return a_basic_block_idx;
+}
+
+void hcc_amlopt_dominance_frontiers(HccWorker* w) {
+	HccAMLOptBasicBlock* basic_blocks = w->amlopt.basic_blocks;
+	HccStack(uint32_t) order = w->amlopt.basic_block_order;
+	HccStack(uint32_t) preds = w->amlopt.basic_block_preds;
+	HccStack(uint32_t) frontiers = w->amlopt.dominance_frontiers;
+	uint32_t order_count = hcc_stack_count(order);
+
+	//
+	// a join basic block is in the dominance frontier of every basic block on the way up the
+	// dominator tree from each of its predecessors to its immediate dominator.
+	// the first pass counts them and the second pass stores them, skipping duplicates.
+	hcc_stack_clear(frontiers);
+	for (uint32_t pass_idx = 0; pass_idx < 2; pass_idx += 1) {
+		if (pass_idx == 1) {
+			uint32_t frontiers_count = 0;
+			for (uint32_t order_idx = 0; order_idx < order_count; order_idx += 1) {
+				HccAMLOptBasicBlock* basic_block = &basic_blocks[order[order_idx]];
+				basic_block->frontier_start_idx = frontiers_count;
+				frontiers_count += basic_block->frontier_count;
+				basic_block->frontier_count = 0;
+			}
+			hcc_stack_push_many(frontiers, frontiers_count);
+		}
+
+		for (uint32_t order_idx = 0; order_idx < order_count; order_idx += 1) {
+			uint32_t basic_block_idx = order[order_idx];
+			HccAMLOptBasicBlock* basic_block = &basic_blocks[basic_block_idx];
+			if (basic_block->preds_count < 2) {
+				continue;
+			}
+
+			for (uint32_t pred_idx = basic_block->preds_start_idx; pred_idx < basic_block->preds_start_idx + basic_block->preds_count; pred_idx += 1) {
+				uint32_t runner_basic_block_idx = preds[pred_idx];
+				while (runner_basic_block_idx != basic_block->idom_idx) {
+					HccAMLOptBasicBlock* runner_basic_block = &basic_blocks[runner_basic_block_idx];
+					if (pass_idx == 0) {
+						runner_basic_block->frontier_count += 1;
+					} else if (runner_basic_block->frontier_count == 0 || frontiers[runner_basic_block->frontier_start_idx + runner_basic_block->frontier_count - 1] != basic_block_idx) {
+						frontiers[runner_basic_block->frontier_start_idx + runner_basic_block->frontier_count] = basic_block_idx;
+						runner_basic_block->frontier_count += 1;
+					}
+
+					runner_basic_block_idx = runner_basic_block->idom_idx;
+				}
+			}
+		}
+	}
+}
+
+void hcc_amlopt_dominator_tree(HccWorker* w) {
+	HccAMLOptBasicBlock* basic_blocks = w->amlopt.basic_blocks;
+	HccStack(uint32_t) order = w->amlopt.basic_block_order;
+	HccStack(uint32_t) children = w->amlopt.dominator_children;
+	uint32_t order_count = hcc_stack_count(order);
+
+	//
+	// count the children of every basic block, then store them in reverse postorder.
+	// the entry basic block is its own immediate dominator so it gets skipped.
+	for (uint32_t order_idx = 1; order_idx < order_count; order_idx += 1) {
+		basic_blocks[basic_blocks[order[order_idx]].idom_idx].dominator_children_count += 1;
+	}
+
+	uint32_t children_count = 0;
+	for (uint32_t order_idx = 0; order_idx < order_count; order_idx += 1) {
+		HccAMLOptBasicBlock* basic_block = &basic_blocks[order[order_idx]];
+		basic_block->dominator_children_start_idx = children_count;
+		children_count += basic_block->dominator_children_count;
+		basic_block->dominator_children_count = 0;
+	}
+
+	hcc_stack_clear(children);
+	hcc_stack_push_many(children, children_count);
+	for (uint32_t order_idx = 1; order_idx < order_count; order_idx += 1) {
+		HccAMLOptBasicBlock* idom_basic_block = &basic_blocks[basic_blocks[order[order_idx]].idom_idx];
+		children[idom_basic_block->dominator_children_start_idx + idom_basic_block->dominator_children_count] = order[order_idx];
+		idom_basic_block->dominator_children_count += 1;
+	}
+}
+
+uint32_t hcc_amlopt_loops_init(HccWorker* w, const HccAMLFunction* aml_function) {
+	HccAMLOptBasicBlock* basic_blocks = w->amlopt.basic_blocks;
+	HccStack(uint32_t) order = w->amlopt.basic_block_order;
+	HccStack(uint32_t) preds = w->amlopt.basic_block_preds;
+	HccStack(uint32_t) work = w->amlopt.basic_block_work;
+	uint32_t order_count = hcc_stack_count(order);
+	for (uint32_t basic_block_idx = 0; basic_block_idx < aml_function->basic_blocks_count; basic_block_idx += 1) {
+		HccAMLOptBasicBlock* basic_block = &basic_blocks[basic_block_idx];
+		basic_block->loop_header_idx = UINT32_MAX;
+		basic_block->loop_parent_idx = UINT32_MAX;
+		basic_block->loop_preheader_idx = UINT32_MAX;
+	}
+
+	//
+	// a loop is every basic block that its header dominates and can reach without going through the loop's merge.
+	// the headers are visited in reverse postorder so an outer loop claims its basic blocks before the loops inside of it take theirs back.
+	uint32_t loops_count = 0;
+	for (uint32_t order_idx = 0; order_idx < order_count; order_idx += 1) {
+		uint32_t header_basic_block_idx = order[order_idx];
+		HccAMLOptBasicBlock* header_basic_block = &basic_blocks[header_basic_block_idx];
+		if (!header_basic_block->is_loop_header) {
+			continue;
+		}
+
+		uint32_t merge_basic_block_idx = HCC_AML_OPERAND_AUX(HCC_AML_INSTR_OPERANDS(&aml_function->words[header_basic_block->merge_word_idx])[0]);
+		header_basic_block->loop_parent_idx = header_basic_block->loop_header_idx;
+		header_basic_block->loop_header_idx = header_basic_block_idx;
+		hcc_stack_clear(work);
+		*hcc_stack_push(work) = header_basic_block_idx;
+		while (hcc_stack_count(work)) {
+			HccAMLOptBasicBlock* basic_block = &basic_blocks[*hcc_stack_get_last(work)];
+			hcc_stack_pop(work);
+
+			uint32_t successors_count = hcc_amlopt_basic_block_successors_count(aml_function, basic_block);
+			for (uint32_t successor_idx = 0; successor_idx < successors_count; successor_idx += 1) {
+				uint32_t successor_basic_block_idx = hcc_amlopt_basic_block_successor(aml_function, basic_block, successor_idx);
+				HccAMLOptBasicBlock* successor_basic_block = &basic_blocks[successor_basic_block_idx];
+				if (
+					successor_basic_block_idx == merge_basic_block_idx ||
+					successor_basic_block->loop_header_idx == header_basic_block_idx ||
+					hcc_amlopt_dominators_intersect(basic_blocks, header_basic_block_idx, successor_basic_block_idx) != header_basic_block_idx
+				) {
+					continue;
+				}
+
+				successor_basic_block->loop_header_idx = header_basic_block_idx;
+				*hcc_stack_push(work) = successor_basic_block_idx;
+			}
+		}
+
+		//
+		// instructions can only be moved out of the loop when exactly one basic block enters it and does nothing but branch to the header
+		uint32_t preheader_basic_block_idx = UINT32_MAX;
+		for (uint32_t pred_idx = header_basic_block->preds_start_idx; pred_idx < header_basic_block->preds_start_idx + header_basic_block->preds_count; pred_idx += 1) {
+			uint32_t pred_basic_block_idx = preds[pred_idx];
+			if (basic_blocks[pred_basic_block_idx].loop_header_idx == header_basic_block_idx) {
+				continue;
+			}
+
+			if (preheader_basic_block_idx != UINT32_MAX) {
+				preheader_basic_block_idx = UINT32_MAX;
+				break;
+			}
+			preheader_basic_block_idx = pred_basic_block_idx;
+		}
+		if (
+			preheader_basic_block_idx != UINT32_MAX &&
+			HCC_AML_INSTR_OP(&aml_function->words[basic_blocks[preheader_basic_block_idx].terminator_word_idx]) == HCC_AML_OP_BRANCH
+		) {
+			header_basic_block->loop_preheader_idx = preheader_basic_block_idx;
+		}
+
+		loops_count += 1;
+	}
+
+	return loops_count;
+}
+
+HccAMLOptValue* hcc_amlopt_values_init(HccWorker* w, const HccAMLFunction* aml_function) {
+	HccAMLOptBasicBlock* basic_blocks = w->amlopt.basic_blocks;
+	uint32_t values_count = aml_function->values_count;
+	hcc_stack_clear(w->amlopt.values);
+	HccAMLOptValue* values = hcc_stack_push_many(w->amlopt.values, values_count + aml_function->basic_block_params_count);
+	for (uint32_t idx = 0; idx < values_count + aml_function->basic_block_params_count; idx += 1) {
+		HccAMLOptValue* value = &values[idx];
+		HCC_ZERO_ELMT(value);
+		value->def_word_idx = UINT32_MAX;
+		value->def_basic_block_idx = UINT32_MAX;
+		value->new_idx = UINT32_MAX;
+	}
+
+	//
+	// find where every value is defined
+	uint32_t basic_block_idx = 0;
+	for (uint32_t aml_word_idx = 0; aml_word_idx < aml_function->words_count; ) {
+		HccAMLInstr* aml_instr = &aml_function->words[aml_word_idx];
+		HccAMLOp aml_op = HCC_AML_INSTR_OP(aml_instr);
+		HccAMLOperand* aml_operands = HCC_AML_INSTR_OPERANDS(aml_instr);
+		HccAMLOptBasicBlock* basic_block = &basic_blocks[basic_block_idx];
+
+		if (aml_op == HCC_AML_OP_BASIC_BLOCK) {
+			basic_block_idx = HCC_AML_OPERAND_AUX(aml_operands[0]);
+			HccAMLBasicBlock* aml_basic_block = &aml_function->basic_blocks[basic_block_idx];
+			for (uint32_t param_idx = aml_basic_block->params_start_idx; param_idx < aml_basic_block->params_start_idx + aml_basic_block->params_count; param_idx += 1) {
+				values[values_count + param_idx].def_word_idx = aml_word_idx;
+				values[values_count + param_idx].def_basic_block_idx = basic_block_idx;
+			}
+		} else if (aml_word_idx <= basic_block->terminator_word_idx) {
+			if (hcc_aml_op_code_has_return_value[aml_op] && HCC_AML_OPERAND_IS_VALUE(aml_operands[0])) {
+				values[HCC_AML_OPERAND_AUX(aml_operands[0])].def_word_idx = aml_word_idx;
+				values[HCC_AML_OPERAND_AUX(aml_operands[0])].def_basic_block_idx = basic_block_idx;
+			}
+		}
+
+		aml_word_idx += HCC_AML_INSTR_WORDS_COUNT(aml_instr);
+	}
+
+	return values;
+}
+
+HccDataType hcc_amlopt_constant_fold_scalar_data_type(HccCU* cu, HccDataType data_type, uint32_t* columns_out) {
+	if (!data_type) {
+		return 0;
+	}
+
+	data_type = HCC_DATA_TYPE_STRIP_QUALIFIERS(hcc_data_type_lower_ast_to_aml(cu, data_type));
+	if (!HCC_DATA_TYPE_IS_AML_INTRINSIC(data_type)) {
+		return 0;
+	}
+
+	HccAMLIntrinsicDataType intrinsic_data_type = HCC_DATA_TYPE_AUX(data_type);
+	if (HCC_AML_INTRINSIC_DATA_TYPE_IS_MATRIX(intrinsic_data_type)) {
+		return 0;
+	}
+
+	//
+	// half floats have no host representation in HccBasic, so leave them for the backend
+	HccAMLIntrinsicDataType scalar_intrinsic_data_type = HCC_AML_INTRINSIC_DATA_TYPE_SCALAR(intrinsic_data_type);
+	if (scalar_intrinsic_data_type == HCC_AML_INTRINSIC_DATA_TYPE_F16 || scalar_intrinsic_data_type >= HCC_AML_INTRINSIC_DATA_TYPE_SCALAR_COUNT) {
+		return 0;
+	}
+
+	*columns_out = HCC_AML_INTRINSIC_DATA_TYPE_COLUMNS(intrinsic_data_type);
+	return HCC_DATA_TYPE(AML_INTRINSIC, scalar_intrinsic_data_type);
+}
+
+HccConstantId hcc_amlopt_constant_fold_component(HccCU* cu, HccAMLOperand operand, HccDataType scalar_data_type, uint32_t columns, uint32_t idx) {
+	HccConstantId constant_id = HccConstantId(HCC_AML_OPERAND_AUX(operand));
+	if (columns == 1) {
+		return constant_id;
+	}
+
+	HccConstant constant = hcc_constant_table_get(cu, constant_id);
+	if (constant.size == 0) {
+		return hcc_constant_table_deduplicate_zero(cu, scalar_data_type);
+	}
+
+	return ((HccConstantId*)constant.data)[idx];
+}
+
+HccAMLOperand hcc_amlopt_constant_fold_result(HccCU* cu, HccDataType data_type, uint32_t columns, HccConstantId* component_constant_ids) {
+	if (columns == 1) {
+		return HCC_AML_OPERAND(CONSTANT, component_constant_ids[0].idx_plus_one);
+	}
+
+	data_type = HCC_DATA_TYPE_STRIP_QUALIFIERS(hcc_data_type_lower_ast_to_aml(cu, data_type));
+	HccConstantId constant_id = hcc_constant_table_deduplicate_composite(cu, data_type, component_constant_ids, columns);
+	return HCC_AML_OPERAND(CONSTANT, constant_id.idx_plus_one);
+}
+
+bool hcc_amlopt_constant_fold_is_splat(HccCU* cu, HccAMLOperand operand, HccDataType scalar_data_type, uint32_t columns, int64_t value) {
+	if (!HCC_AML_OPERAND_IS_CONSTANT(operand)) {
+		return false;
+	}
+
+	//
+	// compare the bits so that -0.0 is not mistaken for 0.0
+	HccBasic expected = hcc_basic_from_sint(cu, scalar_data_type, value);
+	for (uint32_t idx = 0; idx < columns; idx += 1) {
+		HccConstant constant = hcc_constant_table_get(cu, hcc_amlopt_constant_fold_component(cu, operand, scalar_data_type, columns, idx));
+		if (memcmp(constant.data, &expected, constant.size) != 0) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+double hcc_amlopt_constant_fold_float(HccCU* cu, HccDataType scalar_data_type, HccBasic basic) {
+	return HCC_DATA_TYPE_AUX(scalar_data_type) == HCC_AML_INTRINSIC_DATA_TYPE_F32 ? (double)basic.f32 : basic.f64;
+}
+
+uint64_t hcc_amlopt_constant_fold_int(HccDataType scalar_data_type, HccBasic basic) {
+	switch (HCC_DATA_TYPE_AUX(scalar_data_type)) {
+		case HCC_AML_INTRINSIC_DATA_TYPE_BOOL: return (int64_t)basic.s32;
+		case HCC_AML_INTRINSIC_DATA_TYPE_S8: return (int64_t)basic.s8;
+		case HCC_AML_INTRINSIC_DATA_TYPE_S16: return (int64_t)basic.s16;
+		case HCC_AML_INTRINSIC_DATA_TYPE_S32: return (int64_t)basic.s32;
+		case HCC_AML_INTRINSIC_DATA_TYPE_S64: return basic.s64;
+		case HCC_AML_INTRINSIC_DATA_TYPE_U8: return basic.u8;
+		case HCC_AML_INTRINSIC_DATA_TYPE_U16: return basic.u16;
+		case HCC_AML_INTRINSIC_DATA_TYPE_U32: return basic.u32;
+		case HCC_AML_INTRINSIC_DATA_TYPE_U64: return basic.u64;
+	}
+	return 0;
+}
+
+bool hcc_amlopt_constant_fold_math(HccAMLOp op, double* args, double* result_out) {
+	double x = args[0];
+	double result;
+	switch (op) {
+		case HCC_AML_OP_FLOOR: result = floor(x); break;
+		case HCC_AML_OP_CEIL: result = ceil(x); break;
+		case HCC_AML_OP_TRUNC: result = trunc(x); break;
+		case HCC_AML_OP_FRACT: result = x - floor(x); break;
+		case HCC_AML_OP_SIN: result = sin(x); break;
+		case HCC_AML_OP_COS: result = cos(x); break;
+		case HCC_AML_OP_TAN: result = tan(x); break;
+		case HCC_AML_OP_ASIN: result = asin(x); break;
+		case HCC_AML_OP_ACOS: result = acos(x); break;
+		case HCC_AML_OP_ATAN: result = atan(x); break;
+		case HCC_AML_OP_SINH: result = sinh(x); break;
+		case HCC_AML_OP_COSH: result = cosh(x); break;
+		case HCC_AML_OP_TANH: result = tanh(x); break;
+		case HCC_AML_OP_ASINH: result = asinh(x); break;
+		case HCC_AML_OP_ACOSH: result = acosh(x); break;
+		case HCC_AML_OP_ATANH: result = atanh(x); break;
+		case HCC_AML_OP_ATAN2: result = atan2(x, args[1]); break;
+		case HCC_AML_OP_POW: result = pow(x, args[1]); break;
+		case HCC_AML_OP_EXP: result = exp(x); break;
+		case HCC_AML_OP_LOG: result = log(x); break;
+		case HCC_AML_OP_EXP2: result = exp2(x); break;
+		case HCC_AML_OP_LOG2: result = log2(x); break;
+		case HCC_AML_OP_SQRT: result = sqrt(x); break;
+		case HCC_AML_OP_RSQRT: result = 1.0 / sqrt(x); break;
+		case HCC_AML_OP_LERP: result = x + (args[1] - x) * args[2]; break;
+		default: return false;
+	}
+
+	//
+	// the result of these operations are undefined outside of their domain (eg. sqrt(-1.0))
+	// so we leave those for the GPU to decide
+	if (!isfinite(result)) {
+		return false;
+	}
+
+	*result_out = result;
+	return true;
+}
+
+HccAMLOperand hcc_amlopt_constant_fold_instr(HccWorker* w, const HccAMLFunction* aml_function, HccAMLOp aml_op, HccAMLOperand* aml_operands, uint32_t aml_operands_count) {
+	HccCU* cu = w->cu;
+	HccConstantId component_constant_ids[4];
+
+	switch (aml_op) {
+		case HCC_AML_OP_ADD:
+		case HCC_AML_OP_SUBTRACT:
+		case HCC_AML_OP_MULTIPLY:
+		case HCC_AML_OP_DIVIDE:
+		case HCC_AML_OP_MODULO:
+		case HCC_AML_OP_BIT_AND:
+		case HCC_AML_OP_BIT_OR:
+		case HCC_AML_OP_BIT_XOR:
+		case HCC_AML_OP_BIT_SHIFT_LEFT:
+		case HCC_AML_OP_BIT_SHIFT_RIGHT:
+		{
+			HccDataType return_data_type = hcc_aml_operand_data_type(cu, aml_function, aml_operands[0]);
+			uint32_t columns;
+			HccDataType scalar_data_type = hcc_amlopt_constant_fold_scalar_data_type(cu, return_data_type, &columns);
+			uint32_t left_columns;
+			uint32_t right_columns;
+			if (
+				!scalar_data_type ||
+				hcc_amlopt_constant_fold_scalar_data_type(cu, hcc_aml_operand_data_type(cu, aml_function, aml_operands[1]), &left_columns) != scalar_data_type ||
+				hcc_amlopt_constant_fold_scalar_data_type(cu, hcc_aml_operand_data_type(cu, aml_function, aml_operands[2]), &right_columns) != scalar_data_type ||
+				left_columns != columns || right_columns != columns
+			) {
+				return 0;
+			}
+
+			HccAMLOperand left = aml_operands[1];
+			HccAMLOperand right = aml_operands[2];
+			HccBasicTypeClass type_class = hcc_basic_type_class(cu, scalar_data_type);
+			if (HCC_AML_OPERAND_IS_CONSTANT(left) && HCC_AML_OPERAND_IS_CONSTANT(right)) {
+				HccASTBinaryOp binary_op;
+				switch (aml_op) {
+					case HCC_AML_OP_ADD: binary_op = HCC_AST_BINARY_OP_ADD; break;
+					case HCC_AML_OP_SUBTRACT: binary_op = HCC_AST_BINARY_OP_SUBTRACT; break;
+					case HCC_AML_OP_MULTIPLY: binary_op = HCC_AST_BINARY_OP_MULTIPLY; break;
+					case HCC_AML_OP_DIVIDE: binary_op = HCC_AST_BINARY_OP_DIVIDE; break;
+					case HCC_AML_OP_MODULO: binary_op = HCC_AST_BINARY_OP_MODULO; break;
+					case HCC_AML_OP_BIT_AND: binary_op = HCC_AST_BINARY_OP_BIT_AND; break;
+					case HCC_AML_OP_BIT_OR: binary_op = HCC_AST_BINARY_OP_BIT_OR; break;
+					case HCC_AML_OP_BIT_XOR: binary_op = HCC_AST_BINARY_OP_BIT_XOR; break;
+					case HCC_AML_OP_BIT_SHIFT_LEFT: binary_op = HCC_AST_BINARY_OP_BIT_SHIFT_LEFT; break;
+					case HCC_AML_OP_BIT_SHIFT_RIGHT: binary_op = HCC_AST_BINARY_OP_BIT_SHIFT_RIGHT; break;
+				}
+
+				if (type_class == HCC_BASIC_TYPE_CLASS_FLOAT && aml_op == HCC_AML_OP_MODULO) {
+					return 0;
+				}
+
+				for (uint32_t idx = 0; idx < columns; idx += 1) {
+					HccConstantId left_constant_id = hcc_amlopt_constant_fold_component(cu, left, scalar_data_type, columns, idx);
+					HccConstantId right_constant_id = hcc_amlopt_constant_fold_component(cu, right, scalar_data_type, columns, idx);
+
+					//
+					// leave anything that is undefined behaviour on the GPU alone
+					if (type_class != HCC_BASIC_TYPE_CLASS_FLOAT) {
+						HccConstant left_constant = hcc_constant_table_get(cu, left_constant_id);
+						HccConstant right_constant = hcc_constant_table_get(cu, right_constant_id);
+						uint32_t bits_count = right_constant.size * 8;
+						switch (aml_op) {
+							case HCC_AML_OP_DIVIDE:
+							case HCC_AML_OP_MODULO: {
+								if (right_constant.is_zero) {
+									return 0;
+								}
+
+								int64_t left_value;
+								int64_t right_value;
+								if (
+									type_class == HCC_BASIC_TYPE_CLASS_SINT &&
+									hcc_constant_as_sint(cu, left_constant, &left_value) &&
+									hcc_constant_as_sint(cu, right_constant, &right_value) &&
+									right_value == -1 && left_value == (INT64_MIN >> (64 - bits_count))
+								) {
+									return 0;
+								}
+								break;
+							};
+							case HCC_AML_OP_BIT_SHIFT_LEFT:
+							case HCC_AML_OP_BIT_SHIFT_RIGHT: {
+								uint64_t shift;
+								if (!hcc_constant_as_uint(cu, right_constant, &shift) || shift >= bits_count) {
+									return 0;
+								}
+								break;
+							};
+						}
+					}
+
+					HccBasic left_basic = hcc_constant_table_get_basic(cu, left_constant_id);
+					HccBasic right_basic = hcc_constant_table_get_basic(cu, right_constant_id);
+					HccBasic basic = hcc_basic_eval_binary(cu, binary_op, scalar_data_type, left_basic, right_basic);
+					component_constant_ids[idx] = hcc_constant_table_deduplicate_basic(cu, scalar_data_type, &basic);
+				}
+
+				return hcc_amlopt_constant_fold_result(cu, return_data_type, columns, component_constant_ids);
+			}
+
+			//
+			// algebraic identities, floats only get the ones that hold for every input including NaN, inf and -0.0
+			bool is_int = type_class == HCC_BASIC_TYPE_CLASS_SINT || type_class == HCC_BASIC_TYPE_CLASS_UINT;
+			bool is_float = type_class == HCC_BASIC_TYPE_CLASS_FLOAT;
+			switch (aml_op) {
+				case HCC_AML_OP_ADD:
+					if (is_int && hcc_amlopt_constant_fold_is_splat(cu, right, scalar_data_type, columns, 0)) return left;
+					if (is_int && hcc_amlopt_constant_fold_is_splat(cu, left, scalar_data_type, columns, 0)) return right;
+					break;
+				case HCC_AML_OP_SUBTRACT:
+					if ((is_int || is_float) && hcc_amlopt_constant_fold_is_splat(cu, right, scalar_data_type, columns, 0)) return left;
+					break;
+				case HCC_AML_OP_MULTIPLY:
+					if ((is_int || is_float) && hcc_amlopt_constant_fold_is_splat(cu, right, scalar_data_type, columns, 1)) return left;
+					if ((is_int || is_float) && hcc_amlopt_constant_fold_is_splat(cu, left, scalar_data_type, columns, 1)) return right;
+					if (is_int && hcc_amlopt_constant_fold_is_splat(cu, right, scalar_data_type, columns, 0)) return right;
+					if (is_int && hcc_amlopt_constant_fold_is_splat(cu, left, scalar_data_type, columns, 0)) return left;
+					break;
+				case HCC_AML_OP_DIVIDE:
+					if ((is_int || is_float) && hcc_amlopt_constant_fold_is_splat(cu, right, scalar_data_type, columns, 1)) return left;
+					break;
+				case HCC_AML_OP_MODULO:
+					if (is_int && hcc_amlopt_constant_fold_is_splat(cu, right, scalar_data_type, columns, 1)) {
+						return HCC_AML_OPERAND(CONSTANT, hcc_constant_table_deduplicate_zero(cu, return_data_type).idx_plus_one);
+					}
+					break;
+				case HCC_AML_OP_BIT_AND:
+					if (is_int && left == right) return left;
+					if (is_int && hcc_amlopt_constant_fold_is_splat(cu, right, scalar_data_type, columns, 0)) return right;
+					if (is_int && hcc_amlopt_constant_fold_is_splat(cu, left, scalar_data_type, columns, 0)) return left;
+					if (is_int && hcc_amlopt_constant_fold_is_splat(cu, right, scalar_data_type, columns, -1)) return left;
+					if (is_int && hcc_amlopt_constant_fold_is_splat(cu, left, scalar_data_type, columns, -1)) return right;
+					break;
+				case HCC_AML_OP_BIT_OR:
+					if (is_int && left == right) return left;
+					if (is_int && hcc_amlopt_constant_fold_is_splat(cu, right, scalar_data_type, columns, 0)) return left;
+					if (is_int && hcc_amlopt_constant_fold_is_splat(cu, left, scalar_data_type, columns, 0)) return right;
+					if (is_int && hcc_amlopt_constant_fold_is_splat(cu, right, scalar_data_type, columns, -1)) return right;
+					if (is_int && hcc_amlopt_constant_fold_is_splat(cu, left, scalar_data_type, columns, -1)) return left;
+					break;
+				case HCC_AML_OP_BIT_XOR:
+					if (is_int && hcc_amlopt_constant_fold_is_splat(cu, right, scalar_data_type, columns, 0)) return left;
+					if (is_int && hcc_amlopt_constant_fold_is_splat(cu, left, scalar_data_type, columns, 0)) return right;
+					break;
+				case HCC_AML_OP_BIT_SHIFT_LEFT:
+				case HCC_AML_OP_BIT_SHIFT_RIGHT:
+					if (is_int && hcc_amlopt_constant_fold_is_splat(cu, right, scalar_data_type, columns, 0)) return left;
+					break;
+			}
+			return 0;
+		};
+		case HCC_AML_OP_EQUAL:
+		case HCC_AML_OP_NOT_EQUAL:
+		case HCC_AML_OP_LESS_THAN:
+		case HCC_AML_OP_LESS_THAN_OR_EQUAL:
+		case HCC_AML_OP_GREATER_THAN:
+		case HCC_AML_OP_GREATER_THAN_OR_EQUAL:
+		{
+			if (!HCC_AML_OPERAND_IS_CONSTANT(aml_operands[1]) || !HCC_AML_OPERAND_IS_CONSTANT(aml_operands[2])) {
+				return 0;
+			}
+
+			HccDataType return_data_type = hcc_aml_operand_data_type(cu, aml_function, aml_operands[0]);
+			uint32_t columns;
+			uint32_t left_columns;
+			uint32_t right_columns;
+			HccDataType return_scalar_data_type = hcc_amlopt_constant_fold_scalar_data_type(cu, return_data_type, &columns);
+			HccDataType scalar_data_type = hcc_amlopt_constant_fold_scalar_data_type(cu, hcc_aml_operand_data_type(cu, aml_function, aml_operands[1]), &left_columns);
+			if (
+				!return_scalar_data_type || !scalar_data_type ||
+				hcc_amlopt_constant_fold_scalar_data_type(cu, hcc_aml_operand_data_type(cu, aml_function, aml_operands[2]), &right_columns) != scalar_data_type ||
+				left_columns != columns || right_columns != columns
+			) {
+				return 0;
+			}
+
+			HccConstantId true_constant_id = hcc_constant_table_deduplicate_one(cu, return_scalar_data_type);
+			HccConstantId false_constant_id = hcc_constant_table_deduplicate_zero(cu, return_scalar_data_type);
+			bool is_float = hcc_basic_type_class(cu, scalar_data_type) == HCC_BASIC_TYPE_CLASS_FLOAT;
+			for (uint32_t idx = 0; idx < columns; idx += 1) {
+				HccBasic left_basic = hcc_constant_table_get_basic(cu, hcc_amlopt_constant_fold_component(cu, aml_operands[1], scalar_data_type, columns, idx));
+				HccBasic right_basic = hcc_constant_table_get_basic(cu, hcc_amlopt_constant_fold_component(cu, aml_operands[2], scalar_data_type, columns, idx));
+
+				bool result;
+				if (is_float) {
+					//
+					// the backends use unordered comparisons, so a NaN operand makes every comparison true
+					double left_value = hcc_amlopt_constant_fold_float(cu, scalar_data_type, left_basic);
+					double right_value = hcc_amlopt_constant_fold_float(cu, scalar_data_type, right_basic);
+					result = isnan(left_value) || isnan(right_value);
+					switch (aml_op) {
+						case HCC_AML_OP_EQUAL: result |= left_value == right_value; break;
+						case HCC_AML_OP_NOT_EQUAL: result |= left_value != right_value; break;
+						case HCC_AML_OP_LESS_THAN: result |= left_value < right_value; break;
+						case HCC_AML_OP_LESS_THAN_OR_EQUAL: result |= left_value <= right_value; break;
+						case HCC_AML_OP_GREATER_THAN: result |= left_value > right_value; break;
+						case HCC_AML_OP_GREATER_THAN_OR_EQUAL: result |= left_value >= right_value; break;
+					}
+				} else {
+					HccASTBinaryOp binary_op;
+					switch (aml_op) {
+						case HCC_AML_OP_EQUAL: binary_op = HCC_AST_BINARY_OP_EQUAL; break;
+						case HCC_AML_OP_NOT_EQUAL: binary_op = HCC_AST_BINARY_OP_NOT_EQUAL; break;
+						case HCC_AML_OP_LESS_THAN: binary_op = HCC_AST_BINARY_OP_LESS_THAN; break;
+						case HCC_AML_OP_LESS_THAN_OR_EQUAL: binary_op = HCC_AST_BINARY_OP_LESS_THAN_OR_EQUAL; break;
+						case HCC_AML_OP_GREATER_THAN: binary_op = HCC_AST_BINARY_OP_GREATER_THAN; break;
+						case HCC_AML_OP_GREATER_THAN_OR_EQUAL: binary_op = HCC_AST_BINARY_OP_GREATER_THAN_OR_EQUAL; break;
+					}
+					HccBasic basic = hcc_basic_eval_binary(cu, binary_op, scalar_data_type, left_basic, right_basic);
+					result = hcc_basic_as_bool(cu, scalar_data_type, basic);
+				}
+
+				component_constant_ids[idx] = result ? true_constant_id : false_constant_id;
+			}
+
+			return hcc_amlopt_constant_fold_result(cu, return_data_type, columns, component_constant_ids);
+		};
+		case HCC_AML_OP_NEGATE: {
+			if (!HCC_AML_OPERAND_IS_CONSTANT(aml_operands[1])) {
+				return 0;
+			}
+
+			HccDataType return_data_type = hcc_aml_operand_data_type(cu, aml_function, aml_operands[0]);
+			uint32_t columns;
+			uint32_t src_columns;
+			HccDataType scalar_data_type = hcc_amlopt_constant_fold_scalar_data_type(cu, return_data_type, &columns);
+			if (
+				!scalar_data_type || hcc_basic_type_class(cu, scalar_data_type) == HCC_BASIC_TYPE_CLASS_BOOL ||
+				hcc_amlopt_constant_fold_scalar_data_type(cu, hcc_aml_operand_data_type(cu, aml_function, aml_operands[1]), &src_columns) != scalar_data_type ||
+				src_columns != columns
+			) {
+				return 0;
+			}
+
+			for (uint32_t idx = 0; idx < columns; idx += 1) {
+				HccBasic basic = hcc_constant_table_get_basic(cu, hcc_amlopt_constant_fold_component(cu, aml_operands[1], scalar_data_type, columns, idx));
+				basic = hcc_basic_eval_unary(cu, HCC_AST_UNARY_OP_NEGATE, scalar_data_type, basic);
+				component_constant_ids[idx] = hcc_constant_table_deduplicate_basic(cu, scalar_data_type, &basic);
+			}
+
+			return hcc_amlopt_constant_fold_result(cu, return_data_type, columns, component_constant_ids);
+		};
+		case HCC_AML_OP_CONVERT: {
+			if (!HCC_AML_OPERAND_IS_CONSTANT(aml_operands[1])) {
+				return 0;
+			}
+
+			HccDataType return_data_type = hcc_aml_operand_data_type(cu, aml_function, aml_operands[0]);
+			uint32_t columns;
+			uint32_t src_columns;
+			HccDataType dst_scalar_data_type = hcc_amlopt_constant_fold_scalar_data_type(cu, return_data_type, &columns);
+			HccDataType src_scalar_data_type = hcc_amlopt_constant_fold_scalar_data_type(cu, hcc_aml_operand_data_type(cu, aml_function, aml_operands[1]), &src_columns);
+			if (!dst_scalar_data_type || !src_scalar_data_type || src_columns != columns) {
+				return 0;
+			}
+
+			HccBasicTypeClass dst_type_class = hcc_basic_type_class(cu, dst_scalar_data_type);
+			HccBasicTypeClass src_type_class = hcc_basic_type_class(cu, src_scalar_data_type);
+			for (uint32_t idx = 0; idx < columns; idx += 1) {
+				HccBasic src_basic = hcc_constant_table_get_basic(cu, hcc_amlopt_constant_fold_component(cu, aml_operands[1], src_scalar_data_type, columns, idx));
+
+				HccBasic basic;
+				switch (src_type_class) {
+					case HCC_BASIC_TYPE_CLASS_BOOL:
+					case HCC_BASIC_TYPE_CLASS_SINT:
+						basic = hcc_basic_from_sint(cu, dst_scalar_data_type, (int64_t)hcc_amlopt_constant_fold_int(src_scalar_data_type, src_basic));
+						break;
+					case HCC_BASIC_TYPE_CLASS_UINT:
+						basic = hcc_basic_from_uint(cu, dst_scalar_data_type, hcc_amlopt_constant_fold_int(src_scalar_data_type, src_basic));
+						break;
+					case HCC_BASIC_TYPE_CLASS_FLOAT: {
+						double value = hcc_amlopt_constant_fold_float(cu, src_scalar_data_type, src_basic);
+						if (dst_type_class == HCC_BASIC_TYPE_CLASS_SINT || dst_type_class == HCC_BASIC_TYPE_CLASS_UINT) {
+							//
+							// float to integer conversions that do not fit are undefined on the GPU
+							uint64_t size;
+							uint64_t align;
+							hcc_data_type_size_align(cu, dst_scalar_data_type, &size, &align);
+							double max = ldexp(1.0, (int)size * 8 - (dst_type_class == HCC_BASIC_TYPE_CLASS_SINT));
+							double min = dst_type_class == HCC_BASIC_TYPE_CLASS_SINT ? -max : 0.0;
+							if (isnan(value) || value <= min - 1.0 || value >= max) {
+								return 0;
+							}
+						}
+						basic = hcc_basic_from_float(cu, dst_scalar_data_type, value);
+						break;
+					};
+				}
+
+				component_constant_ids[idx] = hcc_constant_table_deduplicate_basic(cu, dst_scalar_data_type, &basic);
+			}
+
+			return hcc_amlopt_constant_fold_result(cu, return_data_type, columns, component_constant_ids);
+		};
+		case HCC_AML_OP_SELECT: {
+			if (aml_operands[2] == aml_operands[3]) {
+				return aml_operands[2];
+			}
+
+			if (!HCC_AML_OPERAND_IS_CONSTANT(aml_operands[1])) {
+				return 0;
+			}
+
+			uint32_t columns;
+			HccDataType cond_scalar_data_type = hcc_amlopt_constant_fold_scalar_data_type(cu, hcc_aml_operand_data_type(cu, aml_function, aml_operands[1]), &columns);
+			if (!cond_scalar_data_type || columns != 1) {
+				return 0;
+			}
+
+			HccBasic cond = hcc_constant_table_get_basic(cu, HccConstantId(HCC_AML_OPERAND_AUX(aml_operands[1])));
+			return hcc_basic_as_bool(cu, cond_scalar_data_type, cond) ? aml_operands[2] : aml_operands[3];
+		};
+		case HCC_AML_OP_ISINF:
+		case HCC_AML_OP_ISNAN:
+		{
+			if (!HCC_AML_OPERAND_IS_CONSTANT(aml_operands[1])) {
+				return 0;
+			}
+
+			HccDataType return_data_type = hcc_aml_operand_data_type(cu, aml_function, aml_operands[0]);
+			uint32_t columns;
+			uint32_t src_columns;
+			HccDataType return_scalar_data_type = hcc_amlopt_constant_fold_scalar_data_type(cu, return_data_type, &columns);
+			HccDataType scalar_data_type = hcc_amlopt_constant_fold_scalar_data_type(cu, hcc_aml_operand_data_type(cu, aml_function, aml_operands[1]), &src_columns);
+			if (!return_scalar_data_type || !scalar_data_type || src_columns != columns || hcc_basic_type_class(cu, scalar_data_type) != HCC_BASIC_TYPE_CLASS_FLOAT) {
+				return 0;
+			}
+
+			for (uint32_t idx = 0; idx < columns; idx += 1) {
+				HccBasic basic = hcc_constant_table_get_basic(cu, hcc_amlopt_constant_fold_component(cu, aml_operands[1], scalar_data_type, columns, idx));
+				double value = hcc_amlopt_constant_fold_float(cu, scalar_data_type, basic);
+				bool result = aml_op == HCC_AML_OP_ISINF ? isinf(value) : isnan(value);
+				component_constant_ids[idx] = result ? hcc_constant_table_deduplicate_one(cu, return_scalar_data_type) : hcc_constant_table_deduplicate_zero(cu, return_scalar_data_type);
+			}
+
+			return hcc_amlopt_constant_fold_result(cu, return_data_type, columns, component_constant_ids);
+		};
+		case HCC_AML_OP_FLOOR:
+		case HCC_AML_OP_CEIL:
+		case HCC_AML_OP_TRUNC:
+		case HCC_AML_OP_FRACT:
+		case HCC_AML_OP_SIN:
+		case HCC_AML_OP_COS:
+		case HCC_AML_OP_TAN:
+		case HCC_AML_OP_ASIN:
+		case HCC_AML_OP_ACOS:
+		case HCC_AML_OP_ATAN:
+		case HCC_AML_OP_SINH:
+		case HCC_AML_OP_COSH:
+		case HCC_AML_OP_TANH:
+		case HCC_AML_OP_ASINH:
+		case HCC_AML_OP_ACOSH:
+		case HCC_AML_OP_ATANH:
+		case HCC_AML_OP_ATAN2:
+		case HCC_AML_OP_POW:
+		case HCC_AML_OP_EXP:
+		case HCC_AML_OP_LOG:
+		case HCC_AML_OP_EXP2:
+		case HCC_AML_OP_LOG2:
+		case HCC_AML_OP_SQRT:
+		case HCC_AML_OP_RSQRT:
+		case HCC_AML_OP_LERP:
+		{
+			uint32_t args_count = aml_operands_count - 1;
+			uint32_t expected_args_count = aml_op == HCC_AML_OP_LERP ? 3 : aml_op == HCC_AML_OP_ATAN2 || aml_op == HCC_AML_OP_POW ? 2 : 1;
+			if (args_count != expected_args_count) {
+				return 0;
+			}
+
+			HccDataType return_data_type = hcc_aml_operand_data_type(cu, aml_function, aml_operands[0]);
+			uint32_t columns;
+			HccDataType scalar_data_type = hcc_amlopt_constant_fold_scalar_data_type(cu, return_data_type, &columns);
+			if (!scalar_data_type || hcc_basic_type_class(cu, scalar_data_type) != HCC_BASIC_TYPE_CLASS_FLOAT) {
+				return 0;
+			}
+
+			for (uint32_t arg_idx = 0; arg_idx < args_count; arg_idx += 1) {
+				uint32_t arg_columns;
+				HccAMLOperand arg = aml_operands[1 + arg_idx];
+				if (
+					!HCC_AML_OPERAND_IS_CONSTANT(arg) ||
+					hcc_amlopt_constant_fold_scalar_data_type(cu, hcc_aml_operand_data_type(cu, aml_function, arg), &arg_columns) != scalar_data_type ||
+					arg_columns != columns
+				) {
+					return 0;
+				}
+			}
+
+			for (uint32_t idx = 0; idx < columns; idx += 1) {
+				double args[3];
+				for (uint32_t arg_idx = 0; arg_idx < args_count; arg_idx += 1) {
+					HccBasic basic = hcc_constant_table_get_basic(cu, hcc_amlopt_constant_fold_component(cu, aml_operands[1 + arg_idx], scalar_data_type, columns, idx));
+					args[arg_idx] = hcc_amlopt_constant_fold_float(cu, scalar_data_type, basic);
+				}
+
+				double result;
+				if (!hcc_amlopt_constant_fold_math(aml_op, args, &result)) {
+					return 0;
+				}
+
+				HccBasic basic = hcc_basic_from_float(cu, scalar_data_type, result);
+				component_constant_ids[idx] = hcc_constant_table_deduplicate_basic(cu, scalar_data_type, &basic);
+			}
+
+			return hcc_amlopt_constant_fold_result(cu, return_data_type, columns, component_constant_ids);
+		};
+	}
+
+	return 0;
+}
+
+HccAMLOperand hcc_amlopt_constant_fold_operand(HccStack(HccAMLOperand) value_replacements, HccAMLOperand operand) {
+	if (HCC_AML_OPERAND_IS_VALUE(operand) && value_replacements[HCC_AML_OPERAND_AUX(operand)]) {
+		return value_replacements[HCC_AML_OPERAND_AUX(operand)];
+	}
+	return operand;
+}
+
+const HccAMLFunction* hcc_amlopt_constant_fold(HccWorker* w, HccDecl function_decl, const HccAMLFunction* aml_function) {
+	HCC_UNUSED(function_decl);
+	HccCU* cu = w->cu;
+	HccStack(HccAMLOperand) value_replacements = w->amlopt.value_replacements;
+	hcc_stack_clear(value_replacements);
+	HccAMLOperand* replacements = hcc_stack_push_many(value_replacements, aml_function->values_count);
+	HCC_ZERO_ELMT_MANY(replacements, aml_function->values_count);
+
+	//
+	// walk the instructions in order, so the operands of an instruction have been folded before the instruction is.
+	// every result value that folds into a constant or into one of its operands gets a replacement.
+	uint32_t folded_words_count = 0;
+	for (uint32_t aml_word_idx = 0; aml_word_idx < aml_function->words_count; ) {
+		HccAMLInstr* aml_instr = &aml_function->words[aml_word_idx];
+		HccAMLOp aml_op = HCC_AML_INSTR_OP(aml_instr);
+		HccAMLOperand* aml_operands = HCC_AML_INSTR_OPERANDS(aml_instr);
+		uint32_t aml_operands_count = HCC_AML_INSTR_OPERANDS_COUNT(aml_instr);
+		aml_word_idx += HCC_AML_INSTR_WORDS_COUNT(aml_instr);
+
+		HccAMLOperand operands[5];
+		if (aml_operands_count > HCC_ARRAY_COUNT(operands) || !hcc_aml_op_code_has_return_value[aml_op] || !HCC_AML_OPERAND_IS_VALUE(aml_operands[0])) {
+			continue;
+		}
+
+		operands[0] = aml_operands[0];
+		for (uint32_t operand_idx = 1; operand_idx < aml_operands_count; operand_idx += 1) {
+			operands[operand_idx] = hcc_amlopt_constant_fold_operand(value_replacements, aml_operands[operand_idx]);
+		}
+
+		HccAMLOperand replacement = hcc_amlopt_constant_fold_instr(w, aml_function, aml_op, operands, aml_operands_count);
+		if (replacement) {
+			value_replacements[HCC_AML_OPERAND_AUX(aml_operands[0])] = replacement;
+			folded_words_count += HCC_AML_INSTR_WORDS_COUNT(aml_instr);
+		}
+	}
+
+	if (folded_words_count == 0) {
+		return aml_function;
+	}
+
+	return hcc_amlopt_replace_values(w, aml_function, folded_words_count);
+}
+
+HccAMLFunction* hcc_amlopt_replace_values(HccWorker* w, const HccAMLFunction* aml_function, uint32_t removed_words_count) {
+	HccCU* cu = w->cu;
+	HccStack(HccAMLOperand) value_replacements = w->amlopt.value_replacements;
+	HccAMLFunction* new_aml_function = hcc_amlopt_function_alloc(cu, aml_function, aml_function->words_count - removed_words_count, aml_function->values_count, aml_function->basic_blocks_count, aml_function->basic_block_params_count, aml_function->basic_block_param_srcs_count);
+	HCC_COPY_ELMT_MANY(new_aml_function->values, aml_function->values, aml_function->values_count);
+	HCC_COPY_ELMT_MANY(new_aml_function->basic_blocks, aml_function->basic_blocks, aml_function->basic_blocks_count);
+	HCC_COPY_ELMT_MANY(new_aml_function->basic_block_params, aml_function->basic_block_params, aml_function->basic_block_params_count);
+	for (uint32_t idx = 0; idx < aml_function->basic_block_param_srcs_count; idx += 1) {
+		HccAMLBasicBlockParamSrc src = aml_function->basic_block_param_srcs[idx];
+		src.operand = hcc_amlopt_constant_fold_operand(value_replacements, src.operand);
+		new_aml_function->basic_block_param_srcs[idx] = src;
+	}
+
+	//
+	// copy over the instructions that did not get replaced, rewrite their operands and
+	// move the basic block word indices to where their instructions have ended up.
+	uint32_t new_word_idx = 0;
+	HccAMLBasicBlock* basic_block = NULL;
+	for (uint32_t aml_word_idx = 0; aml_word_idx < aml_function->words_count; ) {
+		HccAMLInstr* aml_instr = &aml_function->words[aml_word_idx];
+		HccAMLOp aml_op = HCC_AML_INSTR_OP(aml_instr);
+		HccAMLOperand* aml_operands = HCC_AML_INSTR_OPERANDS(aml_instr);
+		uint32_t aml_operands_count = HCC_AML_INSTR_OPERANDS_COUNT(aml_instr);
+		uint32_t words_count = HCC_AML_INSTR_WORDS_COUNT(aml_instr);
+
+		if (hcc_aml_op_code_has_return_value[aml_op] && HCC_AML_OPERAND_IS_VALUE(aml_operands[0]) && value_replacements[HCC_AML_OPERAND_AUX(aml_operands[0])]) {
+			aml_word_idx += words_count;
+			continue;
+		}
+
+		if (aml_op == HCC_AML_OP_BASIC_BLOCK) {
+			basic_block = &new_aml_function->basic_blocks[HCC_AML_OPERAND_AUX(aml_operands[0])];
+			basic_block->word_idx = new_word_idx;
+		}
+		if (basic_block && basic_block->terminating_instr_word_idx == aml_word_idx) {
+			basic_block->terminating_instr_word_idx = new_word_idx;
+		}
+
+		HccAMLInstr* new_aml_instr = &new_aml_function->words[new_word_idx];
+		HCC_COPY_ELMT_MANY(new_aml_instr, aml_instr, words_count);
+		HccAMLOperand* new_aml_operands = HCC_AML_INSTR_OPERANDS(new_aml_instr);
+		for (uint32_t operand_idx = 0; operand_idx < aml_operands_count; operand_idx += 1) {
+			if (aml_op == HCC_AML_OP_SHUFFLE && operand_idx >= 3) {
+				break;
+			}
+			new_aml_operands[operand_idx] = hcc_amlopt_constant_fold_operand(value_replacements, new_aml_operands[operand_idx]);
+		}
+
+		aml_word_idx += words_count;
+		new_word_idx += words_count;
+	}
+	HCC_DEBUG_ASSERT(new_word_idx == new_aml_function->words_count, "internal error: expected to copy '%u' words but copied '%u'", new_aml_function->words_count, new_word_idx);
+
+	return new_aml_function;
+}
+
+HccAMLOptValueNumberKind hcc_amlopt_value_numbering_kind(HccCU* cu, const HccAMLFunction* aml_function, HccAMLInstr* aml_instr) {
+	HccAMLOp aml_op = HCC_AML_INSTR_OP(aml_instr);
+	HccAMLOperand* aml_operands = HCC_AML_INSTR_OPERANDS(aml_instr);
+	switch (aml_op) {
+		case HCC_AML_OP_PTR_STORE:
+		case HCC_AML_OP_CALL:
+		case HCC_AML_OP_MEMORY_BARRIER_RESOURCE:
+		case HCC_AML_OP_MEMORY_BARRIER_DISPATCH_GROUP:
+		case HCC_AML_OP_MEMORY_BARRIER_ALL:
+		case HCC_AML_OP_CONTROL_BARRIER_RESOURCE:
+		case HCC_AML_OP_CONTROL_BARRIER_DISPATCH_GROUP:
+		case HCC_AML_OP_CONTROL_BARRIER_ALL:
+		case HCC_AML_OP_ATOMIC_LOAD:
+		case HCC_AML_OP_ATOMIC_STORE:
+		case HCC_AML_OP_ATOMIC_EXCHANGE:
+		case HCC_AML_OP_ATOMIC_COMPARE_EXCHANGE:
+		case HCC_AML_OP_ATOMIC_ADD:
+		case HCC_AML_OP_ATOMIC_SUB:
+		case HCC_AML_OP_ATOMIC_MIN:
+		case HCC_AML_OP_ATOMIC_MAX:
+		case HCC_AML_OP_ATOMIC_BIT_AND:
+		case HCC_AML_OP_ATOMIC_BIT_OR:
+		case HCC_AML_OP_ATOMIC_BIT_XOR:
+		case HCC_AML_OP_STORE_TEXTURE:
+		case HCC_AML_OP_STORE_BYTE_BUFFER:
+			return HCC_AMLOPT_VALUE_NUMBER_KIND_CLOBBER;
+
+		case HCC_AML_OP_PTR_LOAD: {
+			//
+			// nothing can write through a pointer to const data, so loading it always gives the same value
+			HccDataType ptr_data_type = hcc_aml_operand_data_type(cu, aml_function, aml_operands[1]);
+			return HCC_DATA_TYPE_IS_CONST(hcc_data_type_strip_pointer(cu, ptr_data_type))
+				? HCC_AMLOPT_VALUE_NUMBER_KIND_PURE
+				: HCC_AMLOPT_VALUE_NUMBER_KIND_MEMORY;
+		};
+
+		//
+		// the implicit mip level samples depend on the neighbouring threads, so they are kept to the same basic block too
+		case HCC_AML_OP_LOAD_TEXTURE:
+		case HCC_AML_OP_FETCH_TEXTURE:
+		case HCC_AML_OP_SAMPLE_TEXTURE:
+		case HCC_AML_OP_SAMPLE_MIP_BIAS_TEXTURE:
+		case HCC_AML_OP_SAMPLE_MIP_GRADIENT_TEXTURE:
+		case HCC_AML_OP_SAMPLE_MIP_LEVEL_TEXTURE:
+		case HCC_AML_OP_GATHER_RED_TEXTURE:
+		case HCC_AML_OP_GATHER_GREEN_TEXTURE:
+		case HCC_AML_OP_GATHER_BLUE_TEXTURE:
+		case HCC_AML_OP_GATHER_ALPHA_TEXTURE:
+		case HCC_AML_OP_LOAD_BYTE_BUFFER:
+			return HCC_AMLOPT_VALUE_NUMBER_KIND_MEMORY;
+
+		//
+		// these depend on which threads are active rather than only on their operands
+		case HCC_AML_OP_PTR_STATIC_ALLOC:
+		case HCC_AML_OP_BASIC_BLOCK:
+		case HCC_AML_OP_DDX:
+		case HCC_AML_OP_DDY:
+		case HCC_AML_OP_FWIDTH:
+		case HCC_AML_OP_DDX_FINE:
+		case HCC_AML_OP_DDY_FINE:
+		case HCC_AML_OP_FWIDTH_FINE:
+		case HCC_AML_OP_DDX_COARSE:
+		case HCC_AML_OP_DDY_COARSE:
+		case HCC_AML_OP_FWIDTH_COARSE:
+		case HCC_AML_OP_QUAD_SWAP_X:
+		case HCC_AML_OP_QUAD_SWAP_Y:
+		case HCC_AML_OP_QUAD_SWAP_DIAGONAL:
+		case HCC_AML_OP_QUAD_READ_THREAD:
+		case HCC_AML_OP_QUAD_ANY:
+		case HCC_AML_OP_QUAD_ALL:
+		case HCC_AML_OP_WAVE_THREAD_IS_FIRST:
+		case HCC_AML_OP_WAVE_THREAD_IDX:
+		case HCC_AML_OP_WAVE_ACTIVE_ANY:
+		case HCC_AML_OP_WAVE_ACTIVE_ALL:
+		case HCC_AML_OP_WAVE_READ_THREAD:
+		case HCC_AML_OP_WAVE_ACTIVE_ALL_EQUAL:
+		case HCC_AML_OP_WAVE_ACTIVE_MIN:
+		case HCC_AML_OP_WAVE_ACTIVE_MAX:
+		case HCC_AML_OP_WAVE_ACTIVE_SUM:
+		case HCC_AML_OP_WAVE_ACTIVE_PREFIX_SUM:
+		case HCC_AML_OP_WAVE_ACTIVE_PRODUCT:
+		case HCC_AML_OP_WAVE_ACTIVE_PREFIX_PRODUCT:
+		case HCC_AML_OP_WAVE_ACTIVE_COUNT_BITS:
+		case HCC_AML_OP_WAVE_ACTIVE_PREFIX_COUNT_BITS:
+		case HCC_AML_OP_WAVE_ACTIVE_BIT_AND:
+		case HCC_AML_OP_WAVE_ACTIVE_BIT_OR:
+		case HCC_AML_OP_WAVE_ACTIVE_BIT_XOR:
+			return HCC_AMLOPT_VALUE_NUMBER_KIND_NONE;
+
+		default:
+			return hcc_aml_op_code_has_return_value[aml_op] && HCC_AML_OPERAND_IS_VALUE(aml_operands[0])
+				? HCC_AMLOPT_VALUE_NUMBER_KIND_PURE
+				: HCC_AMLOPT_VALUE_NUMBER_KIND_NONE;
+	}
+}
+
+bool hcc_amlopt_value_numbering_is_commutative(HccAMLOp op) {
+	switch (op) {
+		case HCC_AML_OP_ADD:
+		case HCC_AML_OP_MULTIPLY:
+		case HCC_AML_OP_BIT_AND:
+		case HCC_AML_OP_BIT_OR:
+		case HCC_AML_OP_BIT_XOR:
+		case HCC_AML_OP_EQUAL:
+		case HCC_AML_OP_NOT_EQUAL:
+		case HCC_AML_OP_MIN:
+		case HCC_AML_OP_MAX:
+		case HCC_AML_OP_DOT:
+			return true;
+		default:
+			return false;
+	}
+}
+
+HccHash32 hcc_amlopt_value_numbering_hash(HccWorker* w, const HccAMLFunction* aml_function, HccAMLInstr* aml_instr, uint32_t memory_epoch) {
+	HccAMLOp aml_op = HCC_AML_INSTR_OP(aml_instr);
+	HccAMLOperand* aml_operands = HCC_AML_INSTR_OPERANDS(aml_instr);
+	uint32_t aml_operands_count = HCC_AML_INSTR_OPERANDS_COUNT(aml_instr);
+	HccDataType data_type = aml_function->values[HCC_AML_OPERAND_AUX(aml_operands[0])].data_type;
+
+	HccHash32 hash = HCC_HASH_WY_32_INIT;
+	hash = hcc_hash_wy_32(&aml_instr[0], sizeof(aml_instr[0]), hash);
+	hash = hcc_hash_wy_32(&data_type, sizeof(data_type), hash);
+	hash = hcc_hash_wy_32(&memory_epoch, sizeof(memory_epoch), hash);
+	if (hcc_amlopt_value_numbering_is_commutative(aml_op)) {
+		//
+		// both orders of the operands need the same hash
+		HccAMLOperand a = hcc_amlopt_constant_fold_operand(w->amlopt.value_replacements, aml_operands[1]);
+		HccAMLOperand b = hcc_amlopt_constant_fold_operand(w->amlopt.value_replacements, aml_operands[2]);
+		HccAMLOperand sorted[2] = { HCC_MIN(a, b), HCC_MAX(a, b) };
+		return hcc_hash_wy_32(sorted, sizeof(sorted), hash);
+	}
+
+	for (uint32_t operand_idx = 1; operand_idx < aml_operands_count; operand_idx += 1) {
+		HccAMLOperand operand = aml_op == HCC_AML_OP_SHUFFLE && operand_idx >= 3
+			? aml_operands[operand_idx]
+			: hcc_amlopt_constant_fold_operand(w->amlopt.value_replacements, aml_operands[operand_idx]);
+		hash = hcc_hash_wy_32(&operand, sizeof(operand), hash);
+	}
+
+	return hash;
+}
+
+bool hcc_amlopt_value_numbering_is_match(HccWorker* w, const HccAMLFunction* aml_function, HccAMLInstr* a_aml_instr, HccAMLInstr* b_aml_instr) {
+	HccStack(HccAMLOperand) value_replacements = w->amlopt.value_replacements;
+	HccAMLOp aml_op = HCC_AML_INSTR_OP(a_aml_instr);
+	HccAMLOperand* a_aml_operands = HCC_AML_INSTR_OPERANDS(a_aml_instr);
+	HccAMLOperand* b_aml_operands = HCC_AML_INSTR_OPERANDS(b_aml_instr);
+	uint32_t aml_operands_count = HCC_AML_INSTR_OPERANDS_COUNT(a_aml_instr);
+	if (
+		a_aml_instr[0] != b_aml_instr[0] ||
+		aml_function->values[HCC_AML_OPERAND_AUX(a_aml_operands[0])].data_type != aml_function->values[HCC_AML_OPERAND_AUX(b_aml_operands[0])].data_type
+	) {
+		return false;
+	}
+
+	if (hcc_amlopt_value_numbering_is_commutative(aml_op)) {
+		HccAMLOperand a0 = hcc_amlopt_constant_fold_operand(value_replacements, a_aml_operands[1]);
+		HccAMLOperand a1 = hcc_amlopt_constant_fold_operand(value_replacements, a_aml_operands[2]);
+		HccAMLOperand b0 = hcc_amlopt_constant_fold_operand(value_replacements, b_aml_operands[1]);
+		HccAMLOperand b1 = hcc_amlopt_constant_fold_operand(value_replacements, b_aml_operands[2]);
+		return (a0 == b0 && a1 == b1) || (a0 == b1 && a1 == b0);
+	}
+
+	for (uint32_t operand_idx = 1; operand_idx < aml_operands_count; operand_idx += 1) {
+		bool is_raw = aml_op == HCC_AML_OP_SHUFFLE && operand_idx >= 3;
+		HccAMLOperand a = is_raw ? a_aml_operands[operand_idx] : hcc_amlopt_constant_fold_operand(value_replacements, a_aml_operands[operand_idx]);
+		HccAMLOperand b = is_raw ? b_aml_operands[operand_idx] : hcc_amlopt_constant_fold_operand(value_replacements, b_aml_operands[operand_idx]);
+		if (a != b) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+uint32_t hcc_amlopt_value_numbering_basic_block(HccWorker* w, const HccAMLFunction* aml_function, uint32_t basic_block_idx, uint32_t* memory_epoch_in_out) {
+	HccCU* cu = w->cu;
+	HccStack(HccAMLOptValueNumber) value_numbers = w->amlopt.value_numbers;
+	HccStack(uint32_t) buckets = w->amlopt.value_number_buckets;
+	uint32_t buckets_mask = hcc_stack_count(buckets) - 1;
+	HccAMLOptBasicBlock* basic_block = &w->amlopt.basic_blocks[basic_block_idx];
+
+	//
+	// loads can only share their result with loads in the same basic block, a store on any path in between could change the memory.
+	// so every basic block starts a new memory epoch and so does every instruction that clobbers memory.
+	*memory_epoch_in_out += 1;
+	uint32_t removed_words_count = 0;
+	for (uint32_t aml_word_idx = aml_function->basic_blocks[basic_block_idx].word_idx; aml_word_idx <= basic_block->terminator_word_idx; ) {
+		HccAMLInstr* aml_instr = &aml_function->words[aml_word_idx];
+		HccAMLOperand* aml_operands = HCC_AML_INSTR_OPERANDS(aml_instr);
+		uint32_t word_idx = aml_word_idx;
+		aml_word_idx += HCC_AML_INSTR_WORDS_COUNT(aml_instr);
+
+		uint32_t memory_epoch;
+		switch (hcc_amlopt_value_numbering_kind(cu, aml_function, aml_instr)) {
+			case HCC_AMLOPT_VALUE_NUMBER_KIND_NONE:
+				continue;
+			case HCC_AMLOPT_VALUE_NUMBER_KIND_CLOBBER:
+				*memory_epoch_in_out += 1;
+				continue;
+			case HCC_AMLOPT_VALUE_NUMBER_KIND_PURE:
+				memory_epoch = 0;
+				break;
+			case HCC_AMLOPT_VALUE_NUMBER_KIND_MEMORY:
+				memory_epoch = *memory_epoch_in_out;
+				break;
+			default: HCC_UNREACHABLE();
+		}
+
+		HccHash32 hash = hcc_amlopt_value_numbering_hash(w, aml_function, aml_instr, memory_epoch);
+		uint32_t value_number_idx = buckets[hash & buckets_mask];
+		while (value_number_idx != UINT32_MAX) {
+			HccAMLOptValueNumber* value_number = &value_numbers[value_number_idx];
+			HccAMLInstr* other_aml_instr = &aml_function->words[value_number->word_idx];
+			if (value_number->hash == hash && value_number->memory_epoch == memory_epoch && hcc_amlopt_value_numbering_is_match(w, aml_function, aml_instr, other_aml_instr)) {
+				break;
+			}
+
+			value_number_idx = value_number->prev_idx;
+		}
+
+		if (value_number_idx != UINT32_MAX) {
+			w->amlopt.value_replacements[HCC_AML_OPERAND_AUX(aml_operands[0])] = HCC_AML_INSTR_OPERANDS(&aml_function->words[value_numbers[value_number_idx].word_idx])[0];
+			removed_words_count += HCC_AML_INSTR_WORDS_COUNT(aml_instr);
+			continue;
+		}
+
+		HccAMLOptValueNumber* value_number = hcc_stack_push(value_numbers);
+		value_number->hash = hash;
+		value_number->word_idx = word_idx;
+		value_number->memory_epoch = memory_epoch;
+		value_number->prev_idx = buckets[hash & buckets_mask];
+		buckets[hash & buckets_mask] = hcc_stack_count(value_numbers) - 1;
+	}
+
+	return removed_words_count;
+}
+
+const HccAMLFunction* hcc_amlopt_value_numbering(HccWorker* w, HccDecl function_decl, const HccAMLFunction* aml_function) {
+	HCC_UNUSED(function_decl);
+	HccAMLOptBasicBlock* basic_blocks = hcc_amlopt_basic_blocks_init(w, aml_function);
+	hcc_amlopt_dominators(w, aml_function);
+	hcc_amlopt_dominator_tree(w);
+
+	HccStack(HccAMLOperand) value_replacements = w->amlopt.value_replacements;
+	hcc_stack_clear(value_replacements);
+	HCC_ZERO_ELMT_MANY(hcc_stack_push_many(value_replacements, aml_function->values_count), aml_function->values_count);
+
+	//
+	// there can be no more entries than values, so this keeps the chains short
+	uint32_t buckets_count = 16;
+	while (buckets_count < aml_function->values_count) {
+		buckets_count *= 2;
+	}
+	HccStack(uint32_t) buckets = w->amlopt.value_number_buckets;
+	hcc_stack_clear(buckets);
+	HCC_ONE_ELMT_MANY(hcc_stack_push_many(buckets, buckets_count), buckets_count);
+	HccStack(HccAMLOptValueNumber) value_numbers = w->amlopt.value_numbers;
+	hcc_stack_clear(value_numbers);
+
+	//
+	// walk down the dominator tree so every instruction has seen the ones in the basic blocks that dominate it.
+	// the work stack holds a basic block, the next of its children to visit and where its value numbers start.
+	HccStack(uint32_t) work = w->amlopt.basic_block_work;
+	HccStack(uint32_t) children = w->amlopt.dominator_children;
+	uint32_t memory_epoch = 0;
+	uint32_t removed_words_count = hcc_amlopt_value_numbering_basic_block(w, aml_function, 0, &memory_epoch);
+	hcc_stack_clear(work);
+	*hcc_stack_push(work) = 0;
+	*hcc_stack_push(work) = 0;
+	*hcc_stack_push(work) = 0;
+	while (hcc_stack_count(work)) {
+		uint32_t work_count = hcc_stack_count(work);
+		HccAMLOptBasicBlock* basic_block = &basic_blocks[work[work_count - 3]];
+		uint32_t child_idx = work[work_count - 2];
+		uint32_t value_numbers_start_idx = work[work_count - 1];
+		if (child_idx == basic_block->dominator_children_count) {
+			while (hcc_stack_count(value_numbers) > value_numbers_start_idx) {
+				HccAMLOptValueNumber* value_number = hcc_stack_get_last(value_numbers);
+				buckets[value_number->hash & (buckets_count - 1)] = value_number->prev_idx;
+				hcc_stack_pop(value_numbers);
+			}
+			hcc_stack_pop_many(work, 3);
+			continue;
+		}
+
+		work[work_count - 2] += 1;
+		uint32_t child_basic_block_idx = children[basic_block->dominator_children_start_idx + child_idx];
+		*hcc_stack_push(work) = child_basic_block_idx;
+		*hcc_stack_push(work) = 0;
+		*hcc_stack_push(work) = hcc_stack_count(value_numbers);
+		removed_words_count += hcc_amlopt_value_numbering_basic_block(w, aml_function, child_basic_block_idx, &memory_epoch);
+	}
+
+	if (removed_words_count == 0) {
+		return aml_function;
+	}
+
+	return hcc_amlopt_replace_values(w, aml_function, removed_words_count);
+}
+
+bool hcc_amlopt_hoist_loop_invariants_is_param_ptr(HccWorker* w, const HccAMLFunction* aml_function, HccAMLOperand operand) {
+	//
+	// follow the pointer back through access chains with constant indices to one of the function parameters.
+	// these always point at something valid so the load can happen before the loop even if the loop never runs.
+	while (1) {
+		if (!HCC_AML_OPERAND_IS_VALUE(operand)) {
+			return false;
+		}
+
+		uint32_t value_idx = HCC_AML_OPERAND_AUX(operand);
+		if (value_idx < aml_function->params_count) {
+			return true;
+		}
+
+		uint32_t def_word_idx = w->amlopt.values[value_idx].def_word_idx;
+		if (def_word_idx == UINT32_MAX) {
+			return false;
+		}
+
+		HccAMLInstr* aml_instr = &aml_function->words[def_word_idx];
+		HccAMLOp aml_op = HCC_AML_INSTR_OP(aml_instr);
+		HccAMLOperand* aml_operands = HCC_AML_INSTR_OPERANDS(aml_instr);
+		uint32_t aml_operands_count = HCC_AML_INSTR_OPERANDS_COUNT(aml_instr);
+		if (aml_op != HCC_AML_OP_PTR_ACCESS_CHAIN && aml_op != HCC_AML_OP_PTR_ACCESS_CHAIN_IN_BOUNDS) {
+			return false;
+		}
+		for (uint32_t operand_idx = 2; operand_idx < aml_operands_count; operand_idx += 1) {
+			if (!HCC_AML_OPERAND_IS_CONSTANT(aml_operands[operand_idx])) {
+				return false;
+			}
+		}
+
+		operand = aml_operands[1];
+	}
+}
+
+bool hcc_amlopt_hoist_loop_invariants_is_candidate(HccWorker* w, const HccAMLFunction* aml_function, HccAMLInstr* aml_instr) {
+	//
+	// a static allocation is the same memory every time around the loop,
+	// moving it out means the copies of an unrolled loop body share it instead of each getting their own.
+	if (HCC_AML_INSTR_OP(aml_instr) == HCC_AML_OP_PTR_STATIC_ALLOC) {
+		return true;
+	}
+
+	if (hcc_amlopt_value_numbering_kind(w->cu, aml_function, aml_instr) != HCC_AMLOPT_VALUE_NUMBER_KIND_PURE) {
+		return false;
+	}
+
+	switch (HCC_AML_INSTR_OP(aml_instr)) {
+		//
+		// the loop may never get to these, so dividing by zero must not be made to happen before it
+		case HCC_AML_OP_DIVIDE:
+		case HCC_AML_OP_MODULO:
+			return false;
+		case HCC_AML_OP_PTR_LOAD:
+			return hcc_amlopt_hoist_loop_invariants_is_param_ptr(w, aml_function, HCC_AML_INSTR_OPERANDS(aml_instr)[1]);
+		default:
+			return true;
+	}
+}
+
+bool hcc_amlopt_hoist_loop_invariants_is_outside(HccWorker* w, const HccAMLFunction* aml_function, HccAMLOperand operand, uint32_t loop_header_idx) {
+	HccAMLOptValue* value = hcc_amlopt_eliminate_dead_code_value(w, aml_function, operand);
+	if (value == NULL || value->def_basic_block_idx == UINT32_MAX) {
+		return true;
+	}
+
+	HccAMLOptBasicBlock* basic_blocks = w->amlopt.basic_blocks;
+	for (uint32_t idx = basic_blocks[value->def_basic_block_idx].loop_header_idx; idx != UINT32_MAX; idx = basic_blocks[idx].loop_parent_idx) {
+		if (idx == loop_header_idx) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+const HccAMLFunction* hcc_amlopt_hoist_loop_invariants(HccWorker* w, HccDecl function_decl, const HccAMLFunction* aml_function) {
+	HCC_UNUSED(function_decl);
+	HccCU* cu = w->cu;
+	HccAMLOptBasicBlock* basic_blocks = hcc_amlopt_basic_blocks_init(w, aml_function);
+	hcc_amlopt_dominators(w, aml_function);
+	if (hcc_amlopt_loops_init(w, aml_function) == 0) {
+		return aml_function;
+	}
+	HccAMLOptValue* values = hcc_amlopt_values_init(w, aml_function);
+
+	//
+	// walk the basic blocks in reverse postorder so the operands of an instruction have been looked at before it is.
+	// an instruction moves out one loop at a time for as long as none of its operands are defined in that loop,
+	// and ends up at the end of the preheader of the outermost loop it got out of.
+	// the first pass picks the instructions and the second pass puts them in the list of their preheader in the same order.
+	HccStack(uint32_t) order = w->amlopt.basic_block_order;
+	HccStack(uint32_t) hoists = w->amlopt.loop_hoists;
+	uint32_t order_count = hcc_stack_count(order);
+	uint32_t hoists_count = 0;
+	for (uint32_t pass_idx = 0; pass_idx < 2; pass_idx += 1) {
+		if (pass_idx == 1) {
+			if (hoists_count == 0) {
+				return aml_function;
+			}
+
+			hoists_count = 0;
+			for (uint32_t basic_block_idx = 0; basic_block_idx < aml_function->basic_blocks_count; basic_block_idx += 1) {
+				HccAMLOptBasicBlock* basic_block = &basic_blocks[basic_block_idx];
+				basic_block->hoists_start_idx = hoists_count;
+				hoists_count += basic_block->hoists_count;
+				basic_block->hoists_count = 0;
+			}
+			hcc_stack_clear(hoists);
+			hcc_stack_push_many(hoists, hoists_count);
+		}
+
+		for (uint32_t order_idx = 0; order_idx < order_count; order_idx += 1) {
+			uint32_t basic_block_idx = order[order_idx];
+			HccAMLOptBasicBlock* basic_block = &basic_blocks[basic_block_idx];
+			if (basic_block->loop_header_idx == UINT32_MAX || basic_block->terminator_word_idx == UINT32_MAX) {
+				continue;
+			}
+
+			for (uint32_t aml_word_idx = aml_function->basic_blocks[basic_block_idx].word_idx; aml_word_idx < basic_block->terminator_word_idx; ) {
+				HccAMLInstr* aml_instr = &aml_function->words[aml_word_idx];
+				HccAMLOp aml_op = HCC_AML_INSTR_OP(aml_instr);
+				HccAMLOperand* aml_operands = HCC_AML_INSTR_OPERANDS(aml_instr);
+				uint32_t aml_operands_count = HCC_AML_INSTR_OPERANDS_COUNT(aml_instr);
+				uint32_t word_idx = aml_word_idx;
+				aml_word_idx += HCC_AML_INSTR_WORDS_COUNT(aml_instr);
+
+				if (pass_idx == 1) {
+					if (hcc_aml_op_code_has_return_value[aml_op] && HCC_AML_OPERAND_IS_VALUE(aml_operands[0]) && values[HCC_AML_OPERAND_AUX(aml_operands[0])].is_hoisted) {
+						HccAMLOptBasicBlock* preheader_basic_block = &basic_blocks[values[HCC_AML_OPERAND_AUX(aml_operands[0])].def_basic_block_idx];
+						hoists[preheader_basic_block->hoists_start_idx + preheader_basic_block->hoists_count] = word_idx;
+						preheader_basic_block->hoists_count += 1;
+					}
+					continue;
+				}
+
+				if (!hcc_amlopt_hoist_loop_invariants_is_candidate(w, aml_function, aml_instr)) {
+					continue;
+				}
+
+				uint32_t preheader_basic_block_idx = UINT32_MAX;
+				for (uint32_t loop_header_idx = basic_block->loop_header_idx; loop_header_idx != UINT32_MAX; loop_header_idx = basic_blocks[loop_header_idx].loop_parent_idx) {
+					if (basic_blocks[loop_header_idx].loop_preheader_idx == UINT32_MAX) {
+						break;
+					}
+
+					bool is_invariant = true;
+					for (uint32_t operand_idx = 1; operand_idx < aml_operands_count; operand_idx += 1) {
+						if (aml_op == HCC_AML_OP_SHUFFLE && operand_idx >= 3) {
+							break;
+						}
+						if (!hcc_amlopt_hoist_loop_invariants_is_outside(w, aml_function, aml_operands[operand_idx], loop_header_idx)) {
+							is_invariant = false;
+							break;
+						}
+					}
+					if (!is_invariant) {
+						break;
+					}
+
+					preheader_basic_block_idx = basic_blocks[loop_header_idx].loop_preheader_idx;
+				}
+
+				if (preheader_basic_block_idx == UINT32_MAX) {
+					continue;
+				}
+
+				HccAMLOptValue* value = &values[HCC_AML_OPERAND_AUX(aml_operands[0])];
+				value->def_basic_block_idx = preheader_basic_block_idx;
+				value->is_hoisted = true;
+				basic_blocks[preheader_basic_block_idx].hoists_count += 1;
+				hoists_count += 1;
+			}
+		}
+	}
+
+	//
+	// the hoisted instructions go before the merge of the preheader if it has one, otherwise before its branch to the header
+	HccAMLFunction* new_aml_function = hcc_amlopt_function_alloc(cu, aml_function, aml_function->words_count, aml_function->values_count, aml_function->basic_blocks_count, aml_function->basic_block_params_count, aml_function->basic_block_param_srcs_count);
+	HCC_COPY_ELMT_MANY(new_aml_function->values, aml_function->values, aml_function->values_count);
+	HCC_COPY_ELMT_MANY(new_aml_function->basic_blocks, aml_function->basic_blocks, aml_function->basic_blocks_count);
+	HCC_COPY_ELMT_MANY(new_aml_function->basic_block_params, aml_function->basic_block_params, aml_function->basic_block_params_count);
+	HCC_COPY_ELMT_MANY(new_aml_function->basic_block_param_srcs, aml_function->basic_block_param_srcs, aml_function->basic_block_param_srcs_count);
+
+	uint32_t new_word_idx = 0;
+	uint32_t basic_block_idx = 0;
+	for (uint32_t aml_word_idx = 0; aml_word_idx < aml_function->words_count; ) {
+		HccAMLInstr* aml_instr = &aml_function->words[aml_word_idx];
+		HccAMLOp aml_op = HCC_AML_INSTR_OP(aml_instr);
+		HccAMLOperand* aml_operands = HCC_AML_INSTR_OPERANDS(aml_instr);
+		uint32_t words_count = HCC_AML_INSTR_WORDS_COUNT(aml_instr);
+		if (aml_op == HCC_AML_OP_BASIC_BLOCK) {
+			basic_block_idx = HCC_AML_OPERAND_AUX(aml_operands[0]);
+			new_aml_function->basic_blocks[basic_block_idx].word_idx = new_word_idx;
+		}
+
+		HccAMLOptBasicBlock* basic_block = &basic_blocks[basic_block_idx];
+		if (basic_block->hoists_count && aml_word_idx == (basic_block->merge_word_idx != UINT32_MAX ? basic_block->merge_word_idx : basic_block->terminator_word_idx)) {
+			for (uint32_t hoist_idx = basic_block->hoists_start_idx; hoist_idx < basic_block->hoists_start_idx + basic_block->hoists_count; hoist_idx += 1) {
+				HccAMLInstr* hoisted_aml_instr = &aml_function->words[hoists[hoist_idx]];
+				uint32_t hoisted_words_count = HCC_AML_INSTR_WORDS_COUNT(hoisted_aml_instr);
+				HCC_COPY_ELMT_MANY(&new_aml_function->words[new_word_idx], hoisted_aml_instr, hoisted_words_count);
+				new_word_idx += hoisted_words_count;
+			}
+		}
+		if (aml_word_idx == aml_function->basic_blocks[basic_block_idx].terminating_instr_word_idx) {
+			new_aml_function->basic_blocks[basic_block_idx].terminating_instr_word_idx = new_word_idx;
+		}
+
+		if (!(hcc_aml_op_code_has_return_value[aml_op] && HCC_AML_OPERAND_IS_VALUE(aml_operands[0]) && values[HCC_AML_OPERAND_AUX(aml_operands[0])].is_hoisted)) {
+			HCC_COPY_ELMT_MANY(&new_aml_function->words[new_word_idx], aml_instr, words_count);
+			new_word_idx += words_count;
+		}
+
+		aml_word_idx += words_count;
+	}
+	HCC_DEBUG_ASSERT(new_word_idx == new_aml_function->words_count, "internal error: expected to copy '%u' words but copied '%u'", new_aml_function->words_count, new_word_idx);
+
+	return new_aml_function;
+}
+
+bool hcc_amlopt_unroll_loops_is_true(HccWorker* w, const HccAMLFunction* aml_function, HccAMLOperand condition, bool* is_true_out) {
+	HccCU* cu = w->cu;
+	if (!HCC_AML_OPERAND_IS_CONSTANT(condition)) {
+		return false;
+	}
+
+	uint32_t columns;
+	HccDataType scalar_data_type = hcc_amlopt_constant_fold_scalar_data_type(cu, hcc_aml_operand_data_type(cu, aml_function, condition), &columns);
+	if (!scalar_data_type || columns != 1) {
+		return false;
+	}
+	HccAMLIntrinsicDataType intrinsic_data_type = HCC_DATA_TYPE_AUX(scalar_data_type);
+	if (intrinsic_data_type != HCC_AML_INTRINSIC_DATA_TYPE_BOOL && !HCC_AML_INTRINSIC_DATA_TYPE_IS_INT(intrinsic_data_type)) {
+		return false;
+	}
+
+	*is_true_out = HCC_AML_OPERAND_AUX(condition) != hcc_constant_table_deduplicate_zero(cu, scalar_data_type).idx_plus_one;
+	return true;
+}
+
+bool hcc_amlopt_unroll_loops_trip_count(HccWorker* w, const HccAMLFunction* aml_function, HccAMLOptUnrollLoop* loop) {
+	HccAMLOptBasicBlock* basic_blocks = w->amlopt.basic_blocks;
+	HccAMLBasicBlock* header_aml_basic_block = &aml_function->basic_blocks[loop->header_basic_block_idx];
+	HccAMLInstr* branch_aml_instr = &aml_function->words[basic_blocks[loop->cond_basic_block_idx].terminator_word_idx];
+	HccAMLInstr* cmp_aml_instr = &aml_function->words[w->amlopt.values[HCC_AML_OPERAND_AUX(HCC_AML_INSTR_OPERANDS(branch_aml_instr)[0])].def_word_idx];
+	HccAMLOperand* cmp_aml_operands = HCC_AML_INSTR_OPERANDS(cmp_aml_instr);
+	if (HCC_AML_INSTR_OPERANDS_COUNT(cmp_aml_instr) != 3) {
+		return false;
+	}
+
+	//
+	// the comparison has to be between a constant and a header parameter, the induction variable.
+	// it starts at a constant and each time around the loop a constant is added to or subtracted from it.
+	uint32_t iv_operand_idx = UINT32_MAX;
+	for (uint32_t operand_idx = 1; operand_idx < 3; operand_idx += 1) {
+		HccAMLOperand operand = cmp_aml_operands[operand_idx];
+		if (
+			HCC_AML_OPERAND_TYPE(operand) == HCC_AML_OPERAND_BASIC_BLOCK_PARAM &&
+			HCC_AML_OPERAND_AUX(operand) >= header_aml_basic_block->params_start_idx &&
+			HCC_AML_OPERAND_AUX(operand) < header_aml_basic_block->params_start_idx + header_aml_basic_block->params_count &&
+			HCC_AML_OPERAND_IS_CONSTANT(cmp_aml_operands[3 - operand_idx])
+		) {
+			iv_operand_idx = operand_idx;
+		}
+	}
+	if (iv_operand_idx == UINT32_MAX) {
+		return false;
+	}
+
+	HccAMLOperand iv_param_operand = cmp_aml_operands[iv_operand_idx];
+	HccAMLBasicBlockParam* iv_param = &aml_function->basic_block_params[HCC_AML_OPERAND_AUX(iv_param_operand)];
+	HccAMLOperand init_operand = 0;
+	HccAMLOperand next_operand = 0;
+	for (uint32_t src_idx = iv_param->srcs_start_idx; src_idx < iv_param->srcs_start_idx + iv_param->srcs_count; src_idx += 1) {
+		HccAMLBasicBlockParamSrc* src = &aml_function->basic_block_param_srcs[src_idx];
+		if (HCC_AML_OPERAND_AUX(src->basic_block_operand) == loop->preheader_basic_block_idx) {
+			init_operand = src->operand;
+		} else {
+			next_operand = src->operand;
+		}
+	}
+	if (!HCC_AML_OPERAND_IS_CONSTANT(init_operand) || !HCC_AML_OPERAND_IS_VALUE(next_operand)) {
+		return false;
+	}
+
+	HccAMLOptValue* next_value = &w->amlopt.values[HCC_AML_OPERAND_AUX(next_operand)];
+	if (next_value->def_word_idx == UINT32_MAX || basic_blocks[next_value->def_basic_block_idx].loop_header_idx != loop->header_basic_block_idx) {
+		return false;
+	}
+	HccAMLInstr* step_aml_instr = &aml_function->words[next_value->def_word_idx];
+	HccAMLOp step_aml_op = HCC_AML_INSTR_OP(step_aml_instr);
+	HccAMLOperand* step_aml_operands = HCC_AML_INSTR_OPERANDS(step_aml_instr);
+	if (
+		(step_aml_op != HCC_AML_OP_ADD && step_aml_op != HCC_AML_OP_SUBTRACT) ||
+		step_aml_operands[1] != iv_param_operand ||
+		!HCC_AML_OPERAND_IS_CONSTANT(step_aml_operands[2])
+	) {
+		return false;
+	}
+
+	//
+	// run the loop with the constant folder until the condition takes the branch to the merge
+	bool is_exit_on_true = HCC_AML_OPERAND_AUX(HCC_AML_INSTR_OPERANDS(branch_aml_instr)[1]) == loop->merge_basic_block_idx;
+	HccAMLOperand iv_operand = init_operand;
+	for (uint32_t trip_count = 0; trip_count <= HCC_AMLOPT_UNROLL_TRIP_COUNT_MAX; trip_count += 1) {
+		HccAMLOperand operands[3] = { cmp_aml_operands[0], cmp_aml_operands[1], cmp_aml_operands[2] };
+		operands[iv_operand_idx] = iv_operand;
+		bool is_true;
+		if (!hcc_amlopt_unroll_loops_is_true(w, aml_function, hcc_amlopt_constant_fold_instr(w, aml_function, HCC_AML_INSTR_OP(cmp_aml_instr), operands, 3), &is_true)) {
+			return false;
+		}
+
+		if (is_true == is_exit_on_true) {
+			loop->trip_count = trip_count;
+			return true;
+		}
+
+		operands[0] = step_aml_operands[0];
+		operands[1] = iv_operand;
+		operands[2] = step_aml_operands[2];
+		iv_operand = hcc_amlopt_constant_fold_instr(w, aml_function, step_aml_op, operands, 3);
+		if (!HCC_AML_OPERAND_IS_CONSTANT(iv_operand)) {
+			return false;
+		}
+	}
+
+	return false;
+}
+
+bool hcc_amlopt_unroll_loops_analyze(HccWorker* w, const HccAMLFunction* aml_function, uint32_t header_basic_block_idx, HccAMLOptUnrollLoop* loop) {
+	HccAMLOptBasicBlock* basic_blocks = w->amlopt.basic_blocks;
+	HccAMLOptValue* values = w->amlopt.values;
+	HccAMLOptBasicBlock* header_basic_block = &basic_blocks[header_basic_block_idx];
+	HccAMLBasicBlock* header_aml_basic_block = &aml_function->basic_blocks[header_basic_block_idx];
+	HCC_ZERO_ELMT(loop);
+	loop->header_basic_block_idx = header_basic_block_idx;
+	loop->preheader_basic_block_idx = header_basic_block->loop_preheader_idx;
+	if (loop->preheader_basic_block_idx == UINT32_MAX || header_basic_block->preds_count != 2) {
+		return false;
+	}
+
+	//
+	// the header must only have the loop merge and a branch to the condition basic block,
+	// which in turn only has the comparison and the branch to either the body or the merge.
+	HccAMLOperand* merge_aml_operands = HCC_AML_INSTR_OPERANDS(&aml_function->words[header_basic_block->merge_word_idx]);
+	loop->merge_basic_block_idx = HCC_AML_OPERAND_AUX(merge_aml_operands[0]);
+	loop->continue_basic_block_idx = HCC_AML_OPERAND_AUX(merge_aml_operands[1]);
+	HccAMLInstr* header_branch_aml_instr = &aml_function->words[header_basic_block->terminator_word_idx];
+	if (
+		header_aml_basic_block->word_idx + HCC_AML_INSTR_WORDS_COUNT(&aml_function->words[header_aml_basic_block->word_idx]) != header_basic_block->merge_word_idx ||
+		header_basic_block->merge_word_idx + HCC_AML_INSTR_WORDS_COUNT(&aml_function->words[header_basic_block->merge_word_idx]) != header_basic_block->terminator_word_idx ||
+		HCC_AML_INSTR_OP(header_branch_aml_instr) != HCC_AML_OP_BRANCH
+	) {
+		return false;
+	}
+
+	loop->cond_basic_block_idx = HCC_AML_OPERAND_AUX(HCC_AML_INSTR_OPERANDS(header_branch_aml_instr)[0]);
+	HccAMLOptBasicBlock* cond_basic_block = &basic_blocks[loop->cond_basic_block_idx];
+	HccAMLBasicBlock* cond_aml_basic_block = &aml_function->basic_blocks[loop->cond_basic_block_idx];
+	if (
+		loop->cond_basic_block_idx == header_basic_block_idx ||
+		cond_basic_block->loop_header_idx != header_basic_block_idx ||
+		cond_basic_block->preds_count != 1 ||
+		cond_basic_block->merge_word_idx != UINT32_MAX ||
+		cond_aml_basic_block->params_count
+	) {
+		return false;
+	}
+
+	uint32_t cmp_word_idx = cond_aml_basic_block->word_idx + HCC_AML_INSTR_WORDS_COUNT(&aml_function->words[cond_aml_basic_block->word_idx]);
+	HccAMLInstr* cmp_aml_instr = &aml_function->words[cmp_word_idx];
+	HccAMLInstr* cond_branch_aml_instr = &aml_function->words[cond_basic_block->terminator_word_idx];
+	HccAMLOperand* cond_branch_aml_operands = HCC_AML_INSTR_OPERANDS(cond_branch_aml_instr);
+	if (
+		cmp_word_idx == cond_basic_block->terminator_word_idx ||
+		cmp_word_idx + HCC_AML_INSTR_WORDS_COUNT(cmp_aml_instr) != cond_basic_block->terminator_word_idx ||
+		HCC_AML_INSTR_OP(cond_branch_aml_instr) != HCC_AML_OP_BRANCH_CONDITIONAL ||
+		!hcc_aml_op_code_has_return_value[HCC_AML_INSTR_OP(cmp_aml_instr)] ||
+		cond_branch_aml_operands[0] != HCC_AML_INSTR_OPERANDS(cmp_aml_instr)[0]
+	) {
+		return false;
+	}
+
+	if (HCC_AML_OPERAND_AUX(cond_branch_aml_operands[1]) == loop->merge_basic_block_idx) {
+		loop->entry_basic_block_idx = HCC_AML_OPERAND_AUX(cond_branch_aml_operands[2]);
+	} else if (HCC_AML_OPERAND_AUX(cond_branch_aml_operands[2]) == loop->merge_basic_block_idx) {
+		loop->entry_basic_block_idx = HCC_AML_OPERAND_AUX(cond_branch_aml_operands[1]);
+	} else {
+		return false;
+	}
+
+	HccAMLOptBasicBlock* continue_basic_block = &basic_blocks[loop->continue_basic_block_idx];
+	if (
+		basic_blocks[loop->merge_basic_block_idx].preds_count != 1 ||
+		basic_blocks[loop->entry_basic_block_idx].loop_header_idx != header_basic_block_idx ||
+		basic_blocks[loop->entry_basic_block_idx].preds_count != 1 ||
+		aml_function->basic_blocks[loop->entry_basic_block_idx].params_count ||
+		continue_basic_block->loop_header_idx != header_basic_block_idx ||
+		continue_basic_block->terminator_word_idx == UINT32_MAX ||
+		HCC_AML_INSTR_OP(&aml_function->words[continue_basic_block->terminator_word_idx]) != HCC_AML_OP_BRANCH
+	) {
+		return false;
+	}
+
+	//
+	// every header parameter comes from the preheader and the continue basic block
+	for (uint32_t param_idx = header_aml_basic_block->params_start_idx; param_idx < header_aml_basic_block->params_start_idx + header_aml_basic_block->params_count; param_idx += 1) {
+		HccAMLBasicBlockParam* param = &aml_function->basic_block_params[param_idx];
+		if (param->srcs_count != 2) {
+			return false;
+		}
+
+		uint32_t a = HCC_AML_OPERAND_AUX(aml_function->basic_block_param_srcs[param->srcs_start_idx].basic_block_operand);
+		uint32_t b = HCC_AML_OPERAND_AUX(aml_function->basic_block_param_srcs[param->srcs_start_idx + 1].basic_block_operand);
+		if (!((a == loop->preheader_basic_block_idx && b == loop->continue_basic_block_idx) || (a == loop->continue_basic_block_idx && b == loop->preheader_basic_block_idx))) {
+			return false;
+		}
+	}
+
+	//
+	// the rest of the basic blocks in the loop make up the body. they can only branch to each other
+	// and back to the header from the continue basic block, and there can be no loops inside of it.
+	uint32_t body_instrs_count = 0;
+	for (uint32_t basic_block_idx = 0; basic_block_idx < aml_function->basic_blocks_count; basic_block_idx += 1) {
+		HccAMLOptBasicBlock* basic_block = &basic_blocks[basic_block_idx];
+		HccAMLBasicBlock* aml_basic_block = &aml_function->basic_blocks[basic_block_idx];
+		if (basic_block_idx != header_basic_block_idx && basic_block->is_loop_header && basic_block->loop_parent_idx == header_basic_block_idx) {
+			return false;
+		}
+		if (basic_block->loop_header_idx != header_basic_block_idx || basic_block_idx == header_basic_block_idx || basic_block_idx == loop->cond_basic_block_idx) {
+			continue;
+		}
+		if (basic_block->terminator_word_idx == UINT32_MAX) {
+			return false;
+		}
+
+		uint32_t successors_count = hcc_amlopt_basic_block_successors_count(aml_function, basic_block);
+		for (uint32_t successor_idx = 0; successor_idx < successors_count; successor_idx += 1) {
+			uint32_t successor_basic_block_idx = hcc_amlopt_basic_block_successor(aml_function, basic_block, successor_idx);
+			if (successor_basic_block_idx == header_basic_block_idx ? basic_block_idx != loop->continue_basic_block_idx : (basic_blocks[successor_basic_block_idx].loop_header_idx != header_basic_block_idx || successor_basic_block_idx == loop->cond_basic_block_idx)) {
+				return false;
+			}
+		}
+
+		basic_block->unroll_local_idx = loop->body_basic_blocks_count;
+		basic_block->unroll_local_params_start_idx = loop->body_basic_block_params_count;
+		loop->body_basic_blocks_count += 1;
+		loop->body_basic_block_params_count += aml_basic_block->params_count;
+		for (uint32_t param_idx = aml_basic_block->params_start_idx; param_idx < aml_basic_block->params_start_idx + aml_basic_block->params_count; param_idx += 1) {
+			loop->body_basic_block_param_srcs_count += aml_function->basic_block_params[param_idx].srcs_count;
+		}
+
+		//
+		// anything after the terminator can never run so it is left behind
+		uint32_t end_word_idx = basic_block->terminator_word_idx + HCC_AML_INSTR_WORDS_COUNT(&aml_function->words[basic_block->terminator_word_idx]);
+		loop->body_words_count += end_word_idx - aml_basic_block->word_idx;
+		for (uint32_t aml_word_idx = aml_basic_block->word_idx; aml_word_idx < end_word_idx; ) {
+			HccAMLInstr* aml_instr = &aml_function->words[aml_word_idx];
+			HccAMLOp aml_op = HCC_AML_INSTR_OP(aml_instr);
+			HccAMLOperand* aml_operands = HCC_AML_INSTR_OPERANDS(aml_instr);
+			switch (aml_op) {
+				case HCC_AML_OP_BASIC_BLOCK:
+				case HCC_AML_OP_SELECTION_MERGE:
+				case HCC_AML_OP_LOOP_MERGE:
+				case HCC_AML_OP_BRANCH:
+					break;
+				default:
+					body_instrs_count += 1;
+					break;
+			}
+			if (hcc_aml_op_code_has_return_value[aml_op] && HCC_AML_OPERAND_IS_VALUE(aml_operands[0])) {
+				values[HCC_AML_OPERAND_AUX(aml_operands[0])].new_idx = loop->body_values_count;
+				loop->body_values_count += 1;
+			}
+
+			aml_word_idx += HCC_AML_INSTR_WORDS_COUNT(aml_instr);
+		}
+	}
+
+	//
+	// the condition is dropped when the loop is fully unrolled, so nothing else can be using its result
+	HccAMLOperand cmp_operand = cond_branch_aml_operands[0];
+	uint32_t cmp_uses_count = 0;
+	for (uint32_t aml_word_idx = 0; aml_word_idx < aml_function->words_count; ) {
+		HccAMLInstr* aml_instr = &aml_function->words[aml_word_idx];
+		HccAMLOperand* aml_operands = HCC_AML_INSTR_OPERANDS(aml_instr);
+		uint32_t aml_operands_count = HCC_AML_INSTR_OPERANDS_COUNT(aml_instr);
+		for (uint32_t operand_idx = hcc_aml_op_code_has_return_value[HCC_AML_INSTR_OP(aml_instr)]; operand_idx < aml_operands_count; operand_idx += 1) {
+			if (HCC_AML_INSTR_OP(aml_instr) == HCC_AML_OP_SHUFFLE && operand_idx >= 3) {
+				break;
+			}
+			cmp_uses_count += aml_operands[operand_idx] == cmp_operand;
+		}
+		aml_word_idx += HCC_AML_INSTR_WORDS_COUNT(aml_instr);
+	}
+	for (uint32_t src_idx = 0; src_idx < aml_function->basic_block_param_srcs_count; src_idx += 1) {
+		cmp_uses_count += aml_function->basic_block_param_srcs[src_idx].operand == cmp_operand;
+	}
+	if (cmp_uses_count != 1 || !hcc_amlopt_unroll_loops_trip_count(w, aml_function, loop)) {
+		return false;
+	}
+
+	//
+	// fully unroll small loops, otherwise copy the body as many times as fits and divides the trip count
+	HccAMLOptUnrollLimits* limits = &hcc_amlopt_unroll_limits[aml_function->opt_level];
+	if (loop->trip_count <= limits->full_trip_count_max && loop->trip_count * body_instrs_count <= limits->instrs_max) {
+		loop->is_full = true;
+		loop->copies_count = loop->trip_count;
+		return true;
+	}
+
+	for (uint32_t copies_count = limits->partial_copies_max; copies_count >= 2; copies_count -= 1) {
+		if (loop->trip_count % copies_count == 0 && copies_count * body_instrs_count <= limits->instrs_max) {
+			loop->copies_count = copies_count;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+HccAMLOperand hcc_amlopt_unroll_loops_operand(HccWorker* w, const HccAMLFunction* aml_function, HccAMLOptUnrollLoop* loop, uint32_t copy_idx, HccAMLOperand operand) {
+	HccAMLOptBasicBlock* basic_blocks = w->amlopt.basic_blocks;
+	HccAMLOptUnrollLoop* loops = w->amlopt.unroll_loops;
+	HccAMLOperand* iter_params = w->amlopt.unroll_iter_params;
+	switch (HCC_AML_OPERAND_TYPE(operand)) {
+		case HCC_AML_OPERAND_VALUE: {
+			//
+			// the first copy of the body keeps the original values
+			HccAMLOptValue* value = &w->amlopt.values[HCC_AML_OPERAND_AUX(operand)];
+			if (copy_idx == 0 || value->def_basic_block_idx == UINT32_MAX) {
+				return operand;
+			}
+
+			HccAMLOptBasicBlock* def_basic_block = &basic_blocks[value->def_basic_block_idx];
+			if (def_basic_block->unroll_loop_idx == UINT32_MAX || &loops[def_basic_block->unroll_loop_idx] != loop || def_basic_block->unroll_local_idx == UINT32_MAX) {
+				return operand;
+			}
+
+			return HCC_AML_OPERAND(VALUE, loop->new_values_start_idx + (copy_idx - 1) * loop->body_values_count + value->new_idx);
+		};
+		case HCC_AML_OPERAND_BASIC_BLOCK_PARAM: {
+			uint32_t basic_block_idx = w->amlopt.values[aml_function->values_count + HCC_AML_OPERAND_AUX(operand)].def_basic_block_idx;
+			HccAMLOptBasicBlock* basic_block = &basic_blocks[basic_block_idx];
+			uint32_t param_idx = HCC_AML_OPERAND_AUX(operand) - aml_function->basic_blocks[basic_block_idx].params_start_idx;
+			if (basic_block->unroll_loop_idx == UINT32_MAX) {
+				return HCC_AML_OPERAND(BASIC_BLOCK_PARAM, basic_block->new_params_start_idx + param_idx);
+			}
+
+			//
+			// the header parameters become whatever they would have been going into the copy,
+			// or coming out of the last one when they are used after a loop that has been fully unrolled.
+			HccAMLOptUnrollLoop* param_loop = &loops[basic_block->unroll_loop_idx];
+			if (basic_block_idx == param_loop->header_basic_block_idx) {
+				uint32_t header_params_count = aml_function->basic_blocks[basic_block_idx].params_count;
+				if (param_loop == loop) {
+					return iter_params[param_loop->iter_params_start_idx + copy_idx * header_params_count + param_idx];
+				}
+				if (param_loop->is_full) {
+					return iter_params[param_loop->iter_params_start_idx + param_loop->copies_count * header_params_count + param_idx];
+				}
+				return HCC_AML_OPERAND(BASIC_BLOCK_PARAM, basic_block->new_params_start_idx + param_idx);
+			}
+
+			return HCC_AML_OPERAND(BASIC_BLOCK_PARAM, param_loop->new_basic_block_params_start_idx + copy_idx * param_loop->body_basic_block_params_count + basic_block->unroll_local_params_start_idx + param_idx);
+		};
+		case HCC_AML_OPERAND_BASIC_BLOCK: {
+			uint32_t basic_block_idx = HCC_AML_OPERAND_AUX(operand);
+			HccAMLOptBasicBlock* basic_block = &basic_blocks[basic_block_idx];
+			if (basic_block->unroll_loop_idx == UINT32_MAX) {
+				return HCC_AML_OPERAND(BASIC_BLOCK, basic_block->new_idx);
+			}
+
+			HccAMLOptUnrollLoop* target_loop = &loops[basic_block->unroll_loop_idx];
+			uint32_t entry_local_idx = basic_blocks[target_loop->entry_basic_block_idx].unroll_local_idx;
+			if (basic_block_idx == target_loop->header_basic_block_idx) {
+				//
+				// the back edge of each copy goes on to the next copy, after the last copy it goes back to the header
+				// or straight on to the merge when the loop has been fully unrolled
+				uint32_t next_copy_idx = target_loop == loop ? copy_idx + 1 : 0;
+				if ((target_loop == loop || target_loop->is_full) && next_copy_idx < target_loop->copies_count) {
+					return HCC_AML_OPERAND(BASIC_BLOCK, target_loop->new_basic_blocks_start_idx + next_copy_idx * target_loop->body_basic_blocks_count + entry_local_idx);
+				}
+				if (target_loop->is_full) {
+					return hcc_amlopt_unroll_loops_operand(w, aml_function, NULL, 0, HCC_AML_OPERAND(BASIC_BLOCK, target_loop->merge_basic_block_idx));
+				}
+				return HCC_AML_OPERAND(BASIC_BLOCK, basic_block->new_idx);
+			}
+
+			if (basic_block_idx == target_loop->cond_basic_block_idx) {
+				//
+				// once a fully unrolled loop has lost its condition, only the merge's parameters refer to it.
+				// their values now come in from the end of the last copy, or the preheader if there are no copies.
+				if (!target_loop->is_full) {
+					return HCC_AML_OPERAND(BASIC_BLOCK, basic_block->new_idx);
+				}
+				if (target_loop->copies_count == 0) {
+					return hcc_amlopt_unroll_loops_operand(w, aml_function, NULL, 0, HCC_AML_OPERAND(BASIC_BLOCK, target_loop->preheader_basic_block_idx));
+				}
+				return HCC_AML_OPERAND(BASIC_BLOCK, target_loop->new_basic_blocks_start_idx + (target_loop->copies_count - 1) * target_loop->body_basic_blocks_count + basic_blocks[target_loop->continue_basic_block_idx].unroll_local_idx);
+			}
+
+			return HCC_AML_OPERAND(BASIC_BLOCK, target_loop->new_basic_blocks_start_idx + copy_idx * target_loop->body_basic_blocks_count + basic_block->unroll_local_idx);
+		};
+		default:
+			return operand;
+	}
+}
+
+void hcc_amlopt_unroll_loops_basic_block(HccWorker* w, const HccAMLFunction* aml_function, HccAMLFunction* new_aml_function, uint32_t basic_block_idx, HccAMLOptUnrollLoop* loop, uint32_t copy_idx) {
+	HccAMLOptBasicBlock* basic_block = &w->amlopt.basic_blocks[basic_block_idx];
+	HccAMLBasicBlock* aml_basic_block = &aml_function->basic_blocks[basic_block_idx];
+	bool is_body = basic_block->unroll_loop_idx != UINT32_MAX && basic_block->unroll_local_idx != UINT32_MAX;
+	uint32_t new_params_start_idx = is_body
+		? loop->new_basic_block_params_start_idx + copy_idx * loop->body_basic_block_params_count + basic_block->unroll_local_params_start_idx
+		: basic_block->new_params_start_idx;
+
+	for (uint32_t param_idx = 0; param_idx < aml_basic_block->params_count; param_idx += 1) {
+		HccAMLBasicBlockParam* param = &aml_function->basic_block_params[aml_basic_block->params_start_idx + param_idx];
+		HccAMLBasicBlockParam* new_param = &new_aml_function->basic_block_params[new_params_start_idx + param_idx];
+		*new_param = *param;
+		new_param->srcs_start_idx = new_aml_function->basic_block_param_srcs_count;
+		for (uint32_t src_idx = param->srcs_start_idx; src_idx < param->srcs_start_idx + param->srcs_count; src_idx += 1) {
+			HccAMLBasicBlockParamSrc* src = &aml_function->basic_block_param_srcs[src_idx];
+			HccAMLBasicBlockParamSrc* new_src = &new_aml_function->basic_block_param_srcs[new_aml_function->basic_block_param_srcs_count];
+			new_src->basic_block_operand = hcc_amlopt_unroll_loops_operand(w, aml_function, loop, copy_idx, src->basic_block_operand);
+			new_src->operand = hcc_amlopt_unroll_loops_operand(w, aml_function, loop, copy_idx, src->operand);
+			new_aml_function->basic_block_param_srcs_count += 1;
+		}
+	}
+
+	HccAMLOperand new_basic_block_operand = hcc_amlopt_unroll_loops_operand(w, aml_function, loop, copy_idx, HCC_AML_OPERAND(BASIC_BLOCK, basic_block_idx));
+	hcc_amlopt_inline_basic_block_add(new_aml_function, HCC_AML_OPERAND_AUX(new_basic_block_operand), new_params_start_idx, aml_basic_block->params_count, HCC_AML_INSTR_LOCATION_IDX(&aml_function->words[aml_basic_block->word_idx]));
+
+	//
+	// the basic blocks in an unrolled loop stop at their terminator, the rest are copied as they are
+	uint32_t end_word_idx;
+	if (basic_block->unroll_loop_idx != UINT32_MAX) {
+		end_word_idx = basic_block->terminator_word_idx + HCC_AML_INSTR_WORDS_COUNT(&aml_function->words[basic_block->terminator_word_idx]);
+	} else if (basic_block_idx + 1 < aml_function->basic_blocks_count) {
+		end_word_idx = aml_function->basic_blocks[basic_block_idx + 1].word_idx;
+	} else {
+		end_word_idx = aml_function->words_count;
+	}
+
+	uint32_t aml_word_idx = aml_basic_block->word_idx + HCC_AML_INSTR_WORDS_COUNT(&aml_function->words[aml_basic_block->word_idx]);
+	while (aml_word_idx < end_word_idx) {
+		HccAMLInstr* aml_instr = &aml_function->words[aml_word_idx];
+		HccAMLOp aml_op = HCC_AML_INSTR_OP(aml_instr);
+		HccAMLOperand* aml_operands = HCC_AML_INSTR_OPERANDS(aml_instr);
+		uint32_t aml_operands_count = HCC_AML_INSTR_OPERANDS_COUNT(aml_instr);
+		uint32_t new_word_idx = new_aml_function->words_count;
+		HccAMLOperand* new_aml_operands = hcc_aml_function_instr_add(new_aml_function, HCC_AML_INSTR_LOCATION_IDX(aml_instr), aml_op, aml_operands_count);
+		for (uint32_t operand_idx = 0; operand_idx < aml_operands_count; operand_idx += 1) {
+			new_aml_operands[operand_idx] = aml_op == HCC_AML_OP_SHUFFLE && operand_idx >= 3
+				? aml_operands[operand_idx]
+				: hcc_amlopt_unroll_loops_operand(w, aml_function, loop, copy_idx, aml_operands[operand_idx]);
+		}
+		if (hcc_aml_op_code_has_return_value[aml_op] && HCC_AML_OPERAND_IS_VALUE(aml_operands[0])) {
+			new_aml_function->values[HCC_AML_OPERAND_AUX(new_aml_operands[0])] = aml_function->values[HCC_AML_OPERAND_AUX(aml_operands[0])];
+		}
+		if (aml_word_idx == aml_basic_block->terminating_instr_word_idx || aml_word_idx == basic_block->terminator_word_idx) {
+			new_aml_function->basic_blocks[new_aml_function->basic_blocks_count - 1].terminating_instr_word_idx = new_word_idx;
+		}
+
+		aml_word_idx += HCC_AML_INSTR_WORDS_COUNT(aml_instr);
+	}
+}
+
+bool hcc_amlopt_unroll_loops_is_in_loop(HccWorker* w, const HccAMLFunction* aml_function, uint32_t header_basic_block_idx, HccAMLOperand operand) {
+	HccAMLOptBasicBlock* basic_blocks = w->amlopt.basic_blocks;
+	HccAMLOptValue* values = w->amlopt.values;
+	uint32_t basic_block_idx;
+	switch (HCC_AML_OPERAND_TYPE(operand)) {
+		case HCC_AML_OPERAND_VALUE: basic_block_idx = values[HCC_AML_OPERAND_AUX(operand)].def_basic_block_idx; break;
+		case HCC_AML_OPERAND_BASIC_BLOCK_PARAM: basic_block_idx = values[aml_function->values_count + HCC_AML_OPERAND_AUX(operand)].def_basic_block_idx; break;
+		case HCC_AML_OPERAND_BASIC_BLOCK: basic_block_idx = HCC_AML_OPERAND_AUX(operand); break;
+		default: return false;
+	}
+
+	return basic_block_idx != UINT32_MAX && basic_blocks[basic_block_idx].loop_header_idx == header_basic_block_idx;
+}
+
+bool hcc_amlopt_unroll_loops_is_used_unreachably(HccWorker* w, const HccAMLFunction* aml_function, uint32_t header_basic_block_idx) {
+	HccAMLOptBasicBlock* basic_blocks = w->amlopt.basic_blocks;
+	for (uint32_t basic_block_idx = 0; basic_block_idx < aml_function->basic_blocks_count; basic_block_idx += 1) {
+		if (basic_blocks[basic_block_idx].order_idx != UINT32_MAX) {
+			continue;
+		}
+
+		HccAMLBasicBlock* aml_basic_block = &aml_function->basic_blocks[basic_block_idx];
+		for (uint32_t param_idx = aml_basic_block->params_start_idx; param_idx < aml_basic_block->params_start_idx + aml_basic_block->params_count; param_idx += 1) {
+			HccAMLBasicBlockParam* param = &aml_function->basic_block_params[param_idx];
+			for (uint32_t src_idx = param->srcs_start_idx; src_idx < param->srcs_start_idx + param->srcs_count; src_idx += 1) {
+				HccAMLBasicBlockParamSrc* src = &aml_function->basic_block_param_srcs[src_idx];
+				if (
+					hcc_amlopt_unroll_loops_is_in_loop(w, aml_function, header_basic_block_idx, src->operand) ||
+					hcc_amlopt_unroll_loops_is_in_loop(w, aml_function, header_basic_block_idx, src->basic_block_operand)
+				) {
+					return true;
+				}
+			}
+		}
+
+		uint32_t end_word_idx = basic_block_idx + 1 < aml_function->basic_blocks_count ? aml_function->basic_blocks[basic_block_idx + 1].word_idx : aml_function->words_count;
+		for (uint32_t aml_word_idx = aml_basic_block->word_idx; aml_word_idx < end_word_idx; ) {
+			HccAMLInstr* aml_instr = &aml_function->words[aml_word_idx];
+			HccAMLOperand* aml_operands = HCC_AML_INSTR_OPERANDS(aml_instr);
+			uint32_t aml_operands_count = HCC_AML_INSTR_OPERANDS_COUNT(aml_instr);
+			for (uint32_t operand_idx = hcc_aml_op_code_has_return_value[HCC_AML_INSTR_OP(aml_instr)]; operand_idx < aml_operands_count; operand_idx += 1) {
+				if (HCC_AML_INSTR_OP(aml_instr) == HCC_AML_OP_SHUFFLE && operand_idx >= 3) {
+					break;
+				}
+				if (hcc_amlopt_unroll_loops_is_in_loop(w, aml_function, header_basic_block_idx, aml_operands[operand_idx])) {
+					return true;
+				}
+			}
+			aml_word_idx += HCC_AML_INSTR_WORDS_COUNT(aml_instr);
+		}
+	}
+
+	return false;
+}
+
+HccAMLFunction* hcc_amlopt_unroll_loops_once(HccWorker* w, const HccAMLFunction* aml_function, bool* has_unrolled_inner_loop_out) {
+	HccCU* cu = w->cu;
+
+	HccAMLOptBasicBlock* basic_blocks = hcc_amlopt_basic_blocks_init(w, aml_function);
+	hcc_amlopt_dominators(w, aml_function);
+	if (hcc_amlopt_loops_init(w, aml_function) == 0) {
+		return NULL;
+	}
+	hcc_amlopt_values_init(w, aml_function);
+	for (uint32_t basic_block_idx = 0; basic_block_idx < aml_function->basic_blocks_count; basic_block_idx += 1) {
+		basic_blocks[basic_block_idx].unroll_loop_idx = UINT32_MAX;
+		basic_blocks[basic_block_idx].unroll_local_idx = UINT32_MAX;
+	}
+
+	//
+	// pick out the innermost loops that can be unrolled. they are found in reverse postorder,
+	// so a loop comes after any loop whose header parameters it can see.
+	HccStack(uint32_t) order = w->amlopt.basic_block_order;
+	HccStack(HccAMLOptUnrollLoop) loops = w->amlopt.unroll_loops;
+	hcc_stack_clear(loops);
+	uint32_t words_count = aml_function->words_count;
+	uint32_t basic_block_params_count = aml_function->basic_block_params_count;
+	uint32_t basic_block_param_srcs_count = aml_function->basic_block_param_srcs_count;
+	for (uint32_t order_idx = 0; order_idx < hcc_stack_count(order); order_idx += 1) {
+		uint32_t header_basic_block_idx = order[order_idx];
+		if (!basic_blocks[header_basic_block_idx].is_loop_header) {
+			continue;
+		}
+
+		//
+		// basic blocks that cannot be reached are copied over as they are, so a loop is left alone
+		// if any of them are using its values or branching into it. the inliner leaves one of these behind
+		// as the continue target of the loop it puts around a function with more than one return.
+		HccAMLOptUnrollLoop* loop = hcc_stack_push(loops);
+		if (
+			!hcc_amlopt_unroll_loops_analyze(w, aml_function, header_basic_block_idx, loop) ||
+			hcc_amlopt_unroll_loops_is_used_unreachably(w, aml_function, header_basic_block_idx)
+		) {
+			hcc_stack_pop(loops);
+			continue;
+		}
+
+		uint32_t extra_copies_count = loop->copies_count ? loop->copies_count - 1 : 0;
+		if (
+			words_count + extra_copies_count * loop->body_words_count > HCC_AMLOPT_UNROLL_FUNCTION_WORDS_CAP ||
+			basic_block_params_count + extra_copies_count * loop->body_basic_block_params_count > UINT16_MAX ||
+			basic_block_param_srcs_count + extra_copies_count * loop->body_basic_block_param_srcs_count > UINT16_MAX
+		) {
+			hcc_stack_pop(loops);
+			continue;
+		}
+
+		words_count += extra_copies_count * loop->body_words_count;
+		basic_block_params_count += extra_copies_count * loop->body_basic_block_params_count;
+		basic_block_param_srcs_count += extra_copies_count * loop->body_basic_block_param_srcs_count;
+		if (loop->is_full && basic_blocks[header_basic_block_idx].loop_parent_idx != UINT32_MAX) {
+			*has_unrolled_inner_loop_out = true;
+		}
+		for (uint32_t basic_block_idx = 0; basic_block_idx < aml_function->basic_blocks_count; basic_block_idx += 1) {
+			if (basic_blocks[basic_block_idx].loop_header_idx == header_basic_block_idx) {
+				basic_blocks[basic_block_idx].unroll_loop_idx = hcc_stack_count(loops) - 1;
+			}
+		}
+	}
+
+	if (hcc_stack_count(loops) == 0) {
+		return NULL;
+	}
+
+	//
+	// lay out the basic blocks in the order they will be written so the indices keep going up through the function.
+	// the copies of a loop body go where the loop's header was.
+	uint32_t new_words_count = 0;
+	uint32_t new_values_count = aml_function->values_count;
+	uint32_t new_basic_blocks_count = 0;
+	uint32_t new_basic_block_params_count = 0;
+	uint32_t new_basic_block_param_srcs_count = 0;
+	for (uint32_t basic_block_idx = 0; basic_block_idx < aml_function->basic_blocks_count; basic_block_idx += 1) {
+		HccAMLOptBasicBlock* basic_block = &basic_blocks[basic_block_idx];
+		HccAMLBasicBlock* aml_basic_block = &aml_function->basic_blocks[basic_block_idx];
+		if (basic_block->unroll_loop_idx == UINT32_MAX) {
+			basic_block->new_idx = new_basic_blocks_count;
+			basic_block->new_params_start_idx = new_basic_block_params_count;
+			new_basic_blocks_count += 1;
+			new_basic_block_params_count += aml_basic_block->params_count;
+			for (uint32_t param_idx = aml_basic_block->params_start_idx; param_idx < aml_basic_block->params_start_idx + aml_basic_block->params_count; param_idx += 1) {
+				new_basic_block_param_srcs_count += aml_function->basic_block_params[param_idx].srcs_count;
+			}
+			new_words_count += (basic_block_idx + 1 < aml_function->basic_blocks_count ? aml_function->basic_blocks[basic_block_idx + 1].word_idx : aml_function->words_count) - aml_basic_block->word_idx;
+			continue;
+		}
+
+		HccAMLOptUnrollLoop* loop = &loops[basic_block->unroll_loop_idx];
+		if (basic_block_idx != loop->header_basic_block_idx) {
+			continue;
+		}
+
+		if (!loop->is_full) {
+			HccAMLOptBasicBlock* cond_basic_block = &basic_blocks[loop->cond_basic_block_idx];
+			HccAMLBasicBlock* cond_aml_basic_block = &aml_function->basic_blocks[loop->cond_basic_block_idx];
+			basic_block->new_idx = new_basic_blocks_count;
+			basic_block->new_params_start_idx = new_basic_block_params_count;
+			cond_basic_block->new_idx = new_basic_blocks_count + 1;
+			cond_basic_block->new_params_start_idx = new_basic_block_params_count + aml_basic_block->params_count;
+			new_basic_blocks_count += 2;
+			new_basic_block_params_count += aml_basic_block->params_count;
+			new_basic_block_param_srcs_count += aml_basic_block->params_count * 2;
+			new_words_count += basic_block->terminator_word_idx + HCC_AML_INSTR_WORDS_COUNT(&aml_function->words[basic_block->terminator_word_idx]) - aml_basic_block->word_idx;
+			new_words_count += cond_basic_block->terminator_word_idx + HCC_AML_INSTR_WORDS_COUNT(&aml_function->words[cond_basic_block->terminator_word_idx]) - cond_aml_basic_block->word_idx;
+		}
+
+		loop->new_basic_blocks_start_idx = new_basic_blocks_count;
+		loop->new_basic_block_params_start_idx = new_basic_block_params_count;
+		loop->new_values_start_idx = new_values_count;
+		new_basic_blocks_count += loop->copies_count * loop->body_basic_blocks_count;
+		new_basic_block_params_count += loop->copies_count * loop->body_basic_block_params_count;
+		new_basic_block_param_srcs_count += loop->copies_count * loop->body_basic_block_param_srcs_count;
+		new_words_count += loop->copies_count * loop->body_words_count;
+		new_values_count += (loop->copies_count ? loop->copies_count - 1 : 0) * loop->body_values_count;
+	}
+
+	//
+	// work out what the header parameters are going into each copy of the body, and coming out of the last one.
+	// for a partial unroll the first copy gets the header parameters themselves.
+	HccStack(HccAMLOperand) iter_params = w->amlopt.unroll_iter_params;
+	hcc_stack_clear(iter_params);
+	for (uint32_t loop_idx = 0; loop_idx < hcc_stack_count(loops); loop_idx += 1) {
+		HccAMLOptUnrollLoop* loop = &loops[loop_idx];
+		HccAMLBasicBlock* header_aml_basic_block = &aml_function->basic_blocks[loop->header_basic_block_idx];
+		loop->iter_params_start_idx = hcc_stack_count(iter_params);
+		hcc_stack_push_many(iter_params, (loop->copies_count + 1) * header_aml_basic_block->params_count);
+		for (uint32_t copy_idx = 0; copy_idx <= loop->copies_count; copy_idx += 1) {
+			for (uint32_t param_idx = 0; param_idx < header_aml_basic_block->params_count; param_idx += 1) {
+				HccAMLBasicBlockParam* param = &aml_function->basic_block_params[header_aml_basic_block->params_start_idx + param_idx];
+				HccAMLOperand iter_param;
+				if (copy_idx == 0 && !loop->is_full) {
+					iter_param = HCC_AML_OPERAND(BASIC_BLOCK_PARAM, basic_blocks[loop->header_basic_block_idx].new_params_start_idx + param_idx);
+				} else {
+					for (uint32_t src_idx = param->srcs_start_idx; src_idx < param->srcs_start_idx + param->srcs_count; src_idx += 1) {
+						HccAMLBasicBlockParamSrc* src = &aml_function->basic_block_param_srcs[src_idx];
+						bool is_preheader = HCC_AML_OPERAND_AUX(src->basic_block_operand) == loop->preheader_basic_block_idx;
+						if (is_preheader == (copy_idx == 0)) {
+							iter_param = hcc_amlopt_unroll_loops_operand(w, aml_function, copy_idx == 0 ? NULL : loop, copy_idx == 0 ? 0 : copy_idx - 1, src->operand);
+						}
+					}
+				}
+				iter_params[loop->iter_params_start_idx + copy_idx * header_aml_basic_block->params_count + param_idx] = iter_param;
+			}
+		}
+	}
+
+	//
+	// the words, basic blocks and parameter sources get appended as we go, everything else is written in place
+	HccAMLFunction* new_aml_function = hcc_amlopt_function_alloc(cu, aml_function, new_words_count, new_values_count, new_basic_blocks_count, new_basic_block_params_count, new_basic_block_param_srcs_count);
+	new_aml_function->words_count = 0;
+	new_aml_function->basic_blocks_count = 0;
+	new_aml_function->basic_block_param_srcs_count = 0;
+	HCC_COPY_ELMT_MANY(new_aml_function->values, aml_function->values, aml_function->values_count);
+	for (uint32_t basic_block_idx = 0; basic_block_idx < aml_function->basic_blocks_count; basic_block_idx += 1) {
+		HccAMLOptBasicBlock* basic_block = &basic_blocks[basic_block_idx];
+		if (basic_block->unroll_loop_idx == UINT32_MAX) {
+			hcc_amlopt_unroll_loops_basic_block(w, aml_function, new_aml_function, basic_block_idx, NULL, 0);
+			continue;
+		}
+
+		HccAMLOptUnrollLoop* loop = &loops[basic_block->unroll_loop_idx];
+		if (basic_block_idx != loop->header_basic_block_idx) {
+			continue;
+		}
+
+		//
+		// the header's loop merge and back edge come from the last copy
+		if (!loop->is_full) {
+			hcc_amlopt_unroll_loops_basic_block(w, aml_function, new_aml_function, basic_block_idx, loop, loop->copies_count - 1);
+			hcc_amlopt_unroll_loops_basic_block(w, aml_function, new_aml_function, loop->cond_basic_block_idx, loop, 0);
+		}
+
+		for (uint32_t copy_idx = 0; copy_idx < loop->copies_count; copy_idx += 1) {
+			for (uint32_t body_basic_block_idx = 0; body_basic_block_idx < aml_function->basic_blocks_count; body_basic_block_idx += 1) {
+				HccAMLOptBasicBlock* body_basic_block = &basic_blocks[body_basic_block_idx];
+				if (body_basic_block->unroll_loop_idx == basic_block->unroll_loop_idx && body_basic_block->unroll_local_idx != UINT32_MAX) {
+					hcc_amlopt_unroll_loops_basic_block(w, aml_function, new_aml_function, body_basic_block_idx, loop, copy_idx);
+				}
+			}
+		}
+	}
+	HCC_DEBUG_ASSERT(new_aml_function->words_count == new_words_count, "internal error: expected to write '%u' words but wrote '%u'", new_words_count, new_aml_function->words_count);
+	HCC_DEBUG_ASSERT(new_aml_function->basic_blocks_count == new_basic_blocks_count, "internal error: expected to write '%u' basic blocks but wrote '%u'", new_basic_blocks_count, new_aml_function->basic_blocks_count);
+	HCC_DEBUG_ASSERT(new_aml_function->basic_block_param_srcs_count == new_basic_block_param_srcs_count, "internal error: expected to write '%u' basic block parameter sources but wrote '%u'", new_basic_block_param_srcs_count, new_aml_function->basic_block_param_srcs_count);
+
+	return new_aml_function;
+}
+
+const HccAMLFunction* hcc_amlopt_unroll_loops(HccWorker* w, HccDecl function_decl, const HccAMLFunction* aml_function) {
+	HCC_UNUSED(function_decl);
+	HccCU* cu = w->cu;
+	HccAMLOptUnrollLimits* limits = &hcc_amlopt_unroll_limits[aml_function->opt_level];
+	if (limits->full_trip_count_max == 0 && limits->partial_copies_max == 0) {
+		return aml_function;
+	}
+
+	//
+	// a loop with another loop inside of it is left alone, so once the inner loops have been fully unrolled
+	// go around again for the loops they were in. every time around removes a loop so this ends.
+	const HccAMLFunction* src_aml_function = aml_function;
+	bool has_unrolled_inner_loop = true;
+	while (has_unrolled_inner_loop) {
+		has_unrolled_inner_loop = false;
+		HccAMLFunction* new_aml_function = hcc_amlopt_unroll_loops_once(w, aml_function, &has_unrolled_inner_loop);
+		if (new_aml_function == NULL) {
+			break;
+		}
+
+		if (aml_function != src_aml_function) {
+			hcc_aml_function_alctor_dealloc(cu, (HccAMLFunction*)aml_function);
+		}
+		aml_function = new_aml_function;
+	}
+
+	return aml_function;
+}
+
+HccAMLOptValue* hcc_amlopt_eliminate_dead_code_value(HccWorker* w, const HccAMLFunction* aml_function, HccAMLOperand operand) {
+	switch (HCC_AML_OPERAND_TYPE(operand)) {
+		case HCC_AML_OPERAND_VALUE: return &w->amlopt.values[HCC_AML_OPERAND_AUX(operand)];
+		case HCC_AML_OPERAND_BASIC_BLOCK_PARAM: return &w->amlopt.values[aml_function->values_count + HCC_AML_OPERAND_AUX(operand)];
+		default: return NULL;
+	}
+}
+
+bool hcc_amlopt_eliminate_dead_code_is_pure(HccAMLOp op) {
+	if (!hcc_aml_op_code_has_return_value[op]) {
+		return false;
+	}
+
+	switch (op) {
+		case HCC_AML_OP_BASIC_BLOCK:
+		case HCC_AML_OP_CALL:
+		case HCC_AML_OP_ATOMIC_LOAD:
+		case HCC_AML_OP_ATOMIC_EXCHANGE:
+		case HCC_AML_OP_ATOMIC_COMPARE_EXCHANGE:
+		case HCC_AML_OP_ATOMIC_ADD:
+		case HCC_AML_OP_ATOMIC_SUB:
+		case HCC_AML_OP_ATOMIC_MIN:
+		case HCC_AML_OP_ATOMIC_MAX:
+		case HCC_AML_OP_ATOMIC_BIT_AND:
+		case HCC_AML_OP_ATOMIC_BIT_OR:
+		case HCC_AML_OP_ATOMIC_BIT_XOR:
+			return false;
+		default:
+			return true;
+	}
+}
+
+uint32_t hcc_amlopt_eliminate_dead_code_branch_target(HccWorker* w, const HccAMLFunction* aml_function, HccAMLOptBasicBlock* basic_block) {
+	HccCU* cu = w->cu;
+	if (basic_block->terminator_word_idx == UINT32_MAX || basic_block->is_loop_header) {
+		return UINT32_MAX;
+	}
+
+	HccAMLInstr* aml_instr = &aml_function->words[basic_block->terminator_word_idx];
+	HccAMLOperand* aml_operands = HCC_AML_INSTR_OPERANDS(aml_instr);
+	uint32_t aml_operands_count = HCC_AML_INSTR_OPERANDS_COUNT(aml_instr);
+	HccAMLOperand condition = hcc_amlopt_eliminate_dead_code_resolve(w, aml_function, aml_operands[0]);
+	switch (HCC_AML_INSTR_OP(aml_instr)) {
+		case HCC_AML_OP_BRANCH_CONDITIONAL: {
+			if (!HCC_AML_OPERAND_IS_CONSTANT(condition)) {
+				return UINT32_MAX;
+			}
+
+			//
+			// only integer conditions are folded, a float condition of -0.0 is false but is not the zero constant
+			uint32_t columns;
+			HccDataType data_type = hcc_aml_operand_data_type(cu, aml_function, condition);
+			HccDataType scalar_data_type = hcc_amlopt_constant_fold_scalar_data_type(cu, data_type, &columns);
+			if (!scalar_data_type || columns != 1) {
+				return UINT32_MAX;
+			}
+			HccAMLIntrinsicDataType intrinsic_data_type = HCC_DATA_TYPE_AUX(scalar_data_type);
+			if (intrinsic_data_type != HCC_AML_INTRINSIC_DATA_TYPE_BOOL && !HCC_AML_INTRINSIC_DATA_TYPE_IS_INT(intrinsic_data_type)) {
+				return UINT32_MAX;
+			}
+
+			//
+			// SPIR-V wants exactly one back edge into a loop header, so never remove one
+			HccAMLOptBasicBlock* basic_blocks = w->amlopt.basic_blocks;
+			if (basic_blocks[HCC_AML_OPERAND_AUX(aml_operands[1])].is_loop_header || basic_blocks[HCC_AML_OPERAND_AUX(aml_operands[2])].is_loop_header) {
+				return UINT32_MAX;
+			}
+
+			bool is_true = HCC_AML_OPERAND_AUX(condition) != hcc_constant_table_deduplicate_zero(cu, scalar_data_type).idx_plus_one;
+			return HCC_AML_OPERAND_AUX(aml_operands[is_true ? 1 : 2]);
+		};
+		case HCC_AML_OP_SWITCH: {
+			if (!HCC_AML_OPERAND_IS_CONSTANT(condition)) {
+				return UINT32_MAX;
+			}
+
+			HccDataType data_type = hcc_aml_operand_data_type(cu, aml_function, condition);
+			HccAMLOperand target_operand = aml_operands[1];
+			for (uint32_t operand_idx = 2; operand_idx < aml_operands_count; operand_idx += 2) {
+				if (hcc_aml_operand_data_type(cu, aml_function, aml_operands[operand_idx]) != data_type) {
+					return UINT32_MAX;
+				}
+				if (aml_operands[operand_idx] == condition) {
+					target_operand = aml_operands[operand_idx + 1];
+					break;
+				}
+			}
+
+			return HCC_AML_OPERAND_AUX(target_operand);
+		};
+		default:
+			return UINT32_MAX;
+	}
+}
+
+uint32_t hcc_amlopt_eliminate_dead_code_operands_count(HccAMLOptBasicBlock* basic_block, uint32_t aml_word_idx, HccAMLInstr* aml_instr) {
+	if (aml_word_idx == basic_block->terminator_word_idx && basic_block->branch_target_idx != UINT32_MAX) {
+		return 1;
+	}
+
+	//
+	// the arguments that follow the basic block operands of the branches are also stored in the basic block parameter sources.
+	// they are not read by anything else, so drop them instead of keeping their values alive.
+	switch (HCC_AML_INSTR_OP(aml_instr)) {
+		case HCC_AML_OP_BRANCH: return 1;
+		case HCC_AML_OP_BRANCH_CONDITIONAL: return 3;
+		default: return HCC_AML_INSTR_OPERANDS_COUNT(aml_instr);
+	}
+}
+
+void hcc_amlopt_eliminate_dead_code_read_operands_range(HccAMLOptBasicBlock* basic_block, uint32_t aml_word_idx, HccAMLInstr* aml_instr, uint32_t* start_out, uint32_t* end_out) {
+	if (aml_word_idx == basic_block->terminator_word_idx && basic_block->branch_target_idx != UINT32_MAX) {
+		*start_out = 0;
+		*end_out = 0;
+		return;
+	}
+
+	HccAMLOp aml_op = HCC_AML_INSTR_OP(aml_instr);
+	*start_out = hcc_aml_op_code_has_return_value[aml_op] ? 1 : 0;
+	*end_out = hcc_amlopt_eliminate_dead_code_operands_count(basic_block, aml_word_idx, aml_instr);
+	if (aml_op == HCC_AML_OP_SHUFFLE) {
+		*end_out = HCC_MIN(*end_out, 3); // the rest are raw indices
+	}
+}
+
+bool hcc_amlopt_eliminate_dead_code_is_edge(HccWorker* w, const HccAMLFunction* aml_function, uint32_t src_basic_block_idx, uint32_t dst_basic_block_idx) {
+	HccAMLOptBasicBlock* basic_block = &w->amlopt.basic_blocks[src_basic_block_idx];
+	if (basic_block->terminator_word_idx == UINT32_MAX) {
+		return false;
+	}
+	if (basic_block->branch_target_idx != UINT32_MAX) {
+		return basic_block->branch_target_idx == dst_basic_block_idx;
+	}
+
+	HccAMLInstr* aml_instr = &aml_function->words[basic_block->terminator_word_idx];
+	HccAMLOperand* aml_operands = HCC_AML_INSTR_OPERANDS(aml_instr);
+	uint32_t aml_operands_count = hcc_amlopt_eliminate_dead_code_operands_count(basic_block, basic_block->terminator_word_idx, aml_instr);
+	for (uint32_t operand_idx = 0; operand_idx < aml_operands_count; operand_idx += 1) {
+		if (aml_operands[operand_idx] == HCC_AML_OPERAND(BASIC_BLOCK, dst_basic_block_idx)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool hcc_amlopt_eliminate_dead_code_is_instr_reachable(HccAMLOptBasicBlock* basic_block, uint32_t aml_word_idx) {
+	return basic_block->is_live && aml_word_idx <= basic_block->terminator_word_idx;
+}
+
+uint32_t hcc_amlopt_eliminate_dead_code_jump_target(HccWorker* w, const HccAMLFunction* aml_function, HccAMLOptBasicBlock* basic_block) {
+	HCC_UNUSED(w);
+	if (basic_block->terminator_word_idx == UINT32_MAX) {
+		return UINT32_MAX;
+	}
+	if (basic_block->branch_target_idx != UINT32_MAX) {
+		return basic_block->branch_target_idx;
+	}
+
+	HccAMLInstr* aml_instr = &aml_function->words[basic_block->terminator_word_idx];
+	if (HCC_AML_INSTR_OP(aml_instr) != HCC_AML_OP_BRANCH) {
+		return UINT32_MAX;
+	}
+
+	return HCC_AML_OPERAND_AUX(HCC_AML_INSTR_OPERANDS(aml_instr)[0]);
+}
+
+bool hcc_amlopt_eliminate_dead_code_is_instr_live(HccWorker* w, const HccAMLFunction* aml_function, HccAMLOptBasicBlock* basic_block, uint32_t aml_word_idx) {
+	if (!hcc_amlopt_eliminate_dead_code_is_instr_reachable(basic_block, aml_word_idx)) {
+		return false;
+	}
+
+	//
+	// the selection merge goes away with the conditional branch it belongs to
+	if (aml_word_idx == basic_block->merge_word_idx && basic_block->branch_target_idx != UINT32_MAX) {
+		return false;
+	}
+
+	HccAMLInstr* aml_instr = &aml_function->words[aml_word_idx];
+	HccAMLOp aml_op = HCC_AML_INSTR_OP(aml_instr);
+	HccAMLOperand* aml_operands = HCC_AML_INSTR_OPERANDS(aml_instr);
+	if ((aml_op == HCC_AML_OP_BASIC_BLOCK && basic_block->is_merged_with_prev) || (aml_word_idx == basic_block->terminator_word_idx && basic_block->is_merged_with_next)) {
+		return false;
+	}
+	if (hcc_aml_op_code_has_return_value[aml_op] && HCC_AML_OPERAND_IS_VALUE(aml_operands[0]) && w->amlopt.values[HCC_AML_OPERAND_AUX(aml_operands[0])].is_removed) {
+		return false;
+	}
+	if (aml_op == HCC_AML_OP_PTR_STORE && HCC_AML_OPERAND_IS_VALUE(aml_operands[0]) && w->amlopt.values[HCC_AML_OPERAND_AUX(aml_operands[0])].is_dead_store_target) {
+		return false;
+	}
+
+	return true;
+}
+
+void hcc_amlopt_eliminate_dead_code_mark_live_basic_blocks(HccWorker* w, const HccAMLFunction* aml_function) {
+	HccAMLOptBasicBlock* basic_blocks = w->amlopt.basic_blocks;
+
+	//
+	// sweep forwards until nothing new is found, almost every edge goes forwards so this rarely takes more than a couple of sweeps.
+	// the merge and continue basic blocks of a live structured construct stay alive even if nothing branches to them as SPIR-V requires them to exist.
+	bool is_changed = true;
+	while (is_changed) {
+		is_changed = false;
+		for (uint32_t basic_block_idx = 0; basic_block_idx < aml_function->basic_blocks_count; basic_block_idx += 1) {
+			HccAMLOptBasicBlock* basic_block = &basic_blocks[basic_block_idx];
+			if (!basic_block->is_live || basic_block->terminator_word_idx == UINT32_MAX) {
+				continue;
+			}
+
+			if (basic_block->branch_target_idx != UINT32_MAX) {
+				is_changed |= !basic_blocks[basic_block->branch_target_idx].is_live;
+				basic_blocks[basic_block->branch_target_idx].is_live = true;
+				continue;
+			}
+
+			for (uint32_t idx = 0; idx < 2; idx += 1) {
+				uint32_t aml_word_idx = idx == 0 ? basic_block->merge_word_idx : basic_block->terminator_word_idx;
+				if (aml_word_idx == UINT32_MAX) {
+					continue;
+				}
+
+				HccAMLInstr* aml_instr = &aml_function->words[aml_word_idx];
+				HccAMLOperand* aml_operands = HCC_AML_INSTR_OPERANDS(aml_instr);
+				uint32_t aml_operands_count = hcc_amlopt_eliminate_dead_code_operands_count(basic_block, aml_word_idx, aml_instr);
+				for (uint32_t operand_idx = 0; operand_idx < aml_operands_count; operand_idx += 1) {
+					if (HCC_AML_OPERAND_IS_BASIC_BLOCK(aml_operands[operand_idx])) {
+						HccAMLOptBasicBlock* target_basic_block = &basic_blocks[HCC_AML_OPERAND_AUX(aml_operands[operand_idx])];
+						is_changed |= !target_basic_block->is_live;
+						target_basic_block->is_live = true;
+					}
+				}
+			}
+		}
+	}
+}
+
+void hcc_amlopt_eliminate_dead_code_merge_basic_blocks(HccWorker* w, const HccAMLFunction* aml_function) {
+	HccAMLOptBasicBlock* basic_blocks = w->amlopt.basic_blocks;
+	HccAMLOptValue* values = w->amlopt.values;
+	for (uint32_t basic_block_idx = 0; basic_block_idx < aml_function->basic_blocks_count; basic_block_idx += 1) {
+		basic_blocks[basic_block_idx].preds_count = 0;
+		basic_blocks[basic_block_idx].is_structured_target = false;
+	}
+
+	//
+	// count the live edges into every basic block.
+	// SPIR-V wants the merge and continue basic blocks of a structured construct to stay where they are, so they never get joined on to anything.
+	for (uint32_t basic_block_idx = 0; basic_block_idx < aml_function->basic_blocks_count; basic_block_idx += 1) {
+		HccAMLOptBasicBlock* basic_block = &basic_blocks[basic_block_idx];
+		if (!basic_block->is_live || basic_block->terminator_word_idx == UINT32_MAX) {
+			continue;
+		}
+
+		if (basic_block->merge_word_idx != UINT32_MAX && hcc_amlopt_eliminate_dead_code_is_instr_live(w, aml_function, basic_block, basic_block->merge_word_idx)) {
+			HccAMLInstr* aml_instr = &aml_function->words[basic_block->merge_word_idx];
+			HccAMLOperand* aml_operands = HCC_AML_INSTR_OPERANDS(aml_instr);
+			for (uint32_t operand_idx = 0; operand_idx < HCC_AML_INSTR_OPERANDS_COUNT(aml_instr); operand_idx += 1) {
+				if (HCC_AML_OPERAND_IS_BASIC_BLOCK(aml_operands[operand_idx])) {
+					basic_blocks[HCC_AML_OPERAND_AUX(aml_operands[operand_idx])].is_structured_target = true;
+				}
+			}
+		}
+
+		uint32_t jump_target_idx = hcc_amlopt_eliminate_dead_code_jump_target(w, aml_function, basic_block);
+		if (jump_target_idx != UINT32_MAX) {
+			basic_blocks[jump_target_idx].preds_count += 1;
+			continue;
+		}
+
+		HccAMLInstr* aml_instr = &aml_function->words[basic_block->terminator_word_idx];
+		HccAMLOperand* aml_operands = HCC_AML_INSTR_OPERANDS(aml_instr);
+		uint32_t aml_operands_count = hcc_amlopt_eliminate_dead_code_operands_count(basic_block, basic_block->terminator_word_idx, aml_instr);
+		for (uint32_t operand_idx = 0; operand_idx < aml_operands_count; operand_idx += 1) {
+			if (HCC_AML_OPERAND_IS_BASIC_BLOCK(aml_operands[operand_idx])) {
+				basic_blocks[HCC_AML_OPERAND_AUX(aml_operands[operand_idx])].preds_count += 1;
+			}
+		}
+	}
+
+	//
+	// join a basic block on to the end of the live basic block laid out before it when that one only branches to it
+	// and nothing else does. inlining and unrolling leave a lot of these behind that would otherwise just be a label and a branch.
+	// only do it when none of its basic block parameters are left, with a single predecessor they have mostly been replaced already.
+	uint32_t prev_basic_block_idx = UINT32_MAX;
+	for (uint32_t basic_block_idx = 0; basic_block_idx < aml_function->basic_blocks_count; basic_block_idx += 1) {
+		HccAMLOptBasicBlock* basic_block = &basic_blocks[basic_block_idx];
+		HccAMLBasicBlock* aml_basic_block = &aml_function->basic_blocks[basic_block_idx];
+		if (!basic_block->is_live) {
+			continue;
+		}
+
+		bool is_mergeable =
+			prev_basic_block_idx != UINT32_MAX &&
+			basic_block->preds_count == 1 &&
+			!basic_block->is_structured_target &&
+			!basic_block->is_loop_header &&
+			!basic_blocks[prev_basic_block_idx].is_loop_header &&
+			hcc_amlopt_eliminate_dead_code_jump_target(w, aml_function, &basic_blocks[prev_basic_block_idx]) == basic_block_idx;
+		for (uint32_t param_idx = aml_basic_block->params_start_idx; is_mergeable && param_idx < aml_basic_block->params_start_idx + aml_basic_block->params_count; param_idx += 1) {
+			is_mergeable = values[aml_function->values_count + param_idx].is_removed;
+		}
+
+		if (is_mergeable) {
+			basic_blocks[prev_basic_block_idx].is_merged_with_next = true;
+			basic_block->is_merged_with_prev = true;
+		}
+		prev_basic_block_idx = basic_block_idx;
+	}
+}
+
+HccAMLOperand hcc_amlopt_eliminate_dead_code_resolve(HccWorker* w, const HccAMLFunction* aml_function, HccAMLOperand operand) {
+	if (HCC_AML_OPERAND_IS_BASIC_BLOCK_PARAM(operand)) {
+		HccAMLOptValue* value = hcc_amlopt_eliminate_dead_code_value(w, aml_function, operand);
+		if (value->replacement) {
+			return value->replacement;
+		}
+	}
+
+	return operand;
+}
+
+void hcc_amlopt_eliminate_dead_code_remove_use(HccWorker* w, const HccAMLFunction* aml_function, HccAMLOperand operand) {
+	HccAMLOptValue* value = hcc_amlopt_eliminate_dead_code_value(w, aml_function, hcc_amlopt_eliminate_dead_code_resolve(w, aml_function, operand));
+	if (value) {
+		HCC_DEBUG_ASSERT(value->uses_count, "internal error: removing a use from a value that has none");
+		value->uses_count -= 1;
+	}
+}
+
+HccAMLOperand hcc_amlopt_eliminate_dead_code_operand(HccWorker* w, const HccAMLFunction* aml_function, HccAMLOperand operand) {
+	operand = hcc_amlopt_eliminate_dead_code_resolve(w, aml_function, operand);
+	switch (HCC_AML_OPERAND_TYPE(operand)) {
+		case HCC_AML_OPERAND_VALUE: {
+			HccAMLOptValue* value = hcc_amlopt_eliminate_dead_code_value(w, aml_function, operand);
+			HCC_DEBUG_ASSERT(value->new_idx != UINT32_MAX, "internal error: operand refers to a value that has been removed");
+			return HCC_AML_OPERAND(VALUE, value->new_idx);
+		};
+		case HCC_AML_OPERAND_BASIC_BLOCK_PARAM: {
+			HccAMLOptValue* value = hcc_amlopt_eliminate_dead_code_value(w, aml_function, operand);
+			HCC_DEBUG_ASSERT(value->new_idx != UINT32_MAX, "internal error: operand refers to a basic block parameter that has been removed");
+			return HCC_AML_OPERAND(BASIC_BLOCK_PARAM, value->new_idx);
+		};
+		case HCC_AML_OPERAND_BASIC_BLOCK: {
+			HccAMLOptBasicBlock* basic_block = &w->amlopt.basic_blocks[HCC_AML_OPERAND_AUX(operand)];
+			HCC_DEBUG_ASSERT(basic_block->new_idx != UINT32_MAX, "internal error: operand refers to a basic block that has been removed");
+			return HCC_AML_OPERAND(BASIC_BLOCK, basic_block->new_idx);
+		};
+		default:
+			return operand;
+	}
+}
+
+const HccAMLFunction* hcc_amlopt_eliminate_dead_code(HccWorker* w, HccDecl function_decl, const HccAMLFunction* aml_function) {
+	HCC_UNUSED(function_decl);
+	HccCU* cu = w->cu;
+	uint32_t values_count = aml_function->values_count;
+
+	HccAMLOptBasicBlock* basic_blocks = hcc_amlopt_basic_blocks_init(w, aml_function);
+	HccAMLOptValue* values = hcc_amlopt_values_init(w, aml_function);
+
+	uint32_t basic_block_idx;
+	for (basic_block_idx = 0; basic_block_idx < aml_function->basic_blocks_count; basic_block_idx += 1) {
+		basic_blocks[basic_block_idx].branch_target_idx = hcc_amlopt_eliminate_dead_code_branch_target(w, aml_function, &basic_blocks[basic_block_idx]);
+	}
+
+	//
+	// walk the control flow from the entry basic block to find the live basic blocks.
+	// a live structured construct can keep a basic block alive that nothing branches to, and that basic block
+	// may use values from a basic block that we thought was dead. so keep going until every used value is defined.
+	while (1) {
+		for (uint32_t basic_block_idx = 0; basic_block_idx < aml_function->basic_blocks_count; basic_block_idx += 1) {
+			basic_blocks[basic_block_idx].is_live = false;
+		}
+		basic_blocks[0].is_live = true;
+		while (1) {
+			hcc_amlopt_eliminate_dead_code_mark_live_basic_blocks(w, aml_function);
+
+			bool is_changed = false;
+			basic_block_idx = 0;
+			for (uint32_t aml_word_idx = 0; aml_word_idx < aml_function->words_count; ) {
+				HccAMLInstr* aml_instr = &aml_function->words[aml_word_idx];
+				HccAMLOperand* aml_operands = HCC_AML_INSTR_OPERANDS(aml_instr);
+				if (HCC_AML_INSTR_OP(aml_instr) == HCC_AML_OP_BASIC_BLOCK) {
+					basic_block_idx = HCC_AML_OPERAND_AUX(aml_operands[0]);
+				}
+
+				HccAMLOptBasicBlock* basic_block = &basic_blocks[basic_block_idx];
+				if (hcc_amlopt_eliminate_dead_code_is_instr_live(w, aml_function, basic_block, aml_word_idx)) {
+					uint32_t start_operand_idx;
+					uint32_t end_operand_idx;
+					hcc_amlopt_eliminate_dead_code_read_operands_range(basic_block, aml_word_idx, aml_instr, &start_operand_idx, &end_operand_idx);
+					for (uint32_t operand_idx = start_operand_idx; operand_idx < end_operand_idx; operand_idx += 1) {
+						HccAMLOptValue* value = hcc_amlopt_eliminate_dead_code_value(w, aml_function, hcc_amlopt_eliminate_dead_code_resolve(w, aml_function, aml_operands[operand_idx]));
+						if (value && value->def_basic_block_idx != UINT32_MAX && !basic_blocks[value->def_basic_block_idx].is_live) {
+							basic_blocks[value->def_basic_block_idx].is_live = true;
+							is_changed = true;
+						}
+					}
+				}
+
+				aml_word_idx += HCC_AML_INSTR_WORDS_COUNT(aml_instr);
+			}
+
+			for (uint32_t basic_block_idx = 0; basic_block_idx < aml_function->basic_blocks_count; basic_block_idx += 1) {
+				HccAMLBasicBlock* aml_basic_block = &aml_function->basic_blocks[basic_block_idx];
+				if (!basic_blocks[basic_block_idx].is_live) {
+					continue;
+				}
+
+				for (uint32_t param_idx = aml_basic_block->params_start_idx; param_idx < aml_basic_block->params_start_idx + aml_basic_block->params_count; param_idx += 1) {
+					HccAMLBasicBlockParam* param = &aml_function->basic_block_params[param_idx];
+					for (uint32_t src_idx = param->srcs_start_idx; src_idx < param->srcs_start_idx + param->srcs_count; src_idx += 1) {
+						HccAMLBasicBlockParamSrc* src = &aml_function->basic_block_param_srcs[src_idx];
+						uint32_t src_basic_block_idx = HCC_AML_OPERAND_AUX(src->basic_block_operand);
+						if (!basic_blocks[src_basic_block_idx].is_live || !hcc_amlopt_eliminate_dead_code_is_edge(w, aml_function, src_basic_block_idx, basic_block_idx)) {
+							continue;
+						}
+
+						HccAMLOptValue* value = hcc_amlopt_eliminate_dead_code_value(w, aml_function, hcc_amlopt_eliminate_dead_code_resolve(w, aml_function, src->operand));
+						if (value && value->def_basic_block_idx != UINT32_MAX && !basic_blocks[value->def_basic_block_idx].is_live) {
+							basic_blocks[value->def_basic_block_idx].is_live = true;
+							is_changed = true;
+						}
+					}
+				}
+			}
+
+			if (!is_changed) {
+				break;
+			}
+		}
+
+		//
+		// a basic block parameter that gets the same value from every basic block that still branches to it is just that value.
+		// only replace it with a constant or a value, that way a replacement never needs replacing itself.
+		// a branch on a replaced basic block parameter can become constant, so walk the control flow again until no more branches fold.
+		for (uint32_t basic_block_idx = 0; basic_block_idx < aml_function->basic_blocks_count; basic_block_idx += 1) {
+			HccAMLBasicBlock* aml_basic_block = &aml_function->basic_blocks[basic_block_idx];
+			if (!basic_blocks[basic_block_idx].is_live) {
+				continue;
+			}
+
+			for (uint32_t param_idx = aml_basic_block->params_start_idx; param_idx < aml_basic_block->params_start_idx + aml_basic_block->params_count; param_idx += 1) {
+				HccAMLBasicBlockParam* param = &aml_function->basic_block_params[param_idx];
+				if (values[values_count + param_idx].replacement) {
+					continue;
+				}
+
+				HccAMLOperand replacement = 0;
+				for (uint32_t src_idx = param->srcs_start_idx; src_idx < param->srcs_start_idx + param->srcs_count; src_idx += 1) {
+					HccAMLBasicBlockParamSrc* src = &aml_function->basic_block_param_srcs[src_idx];
+					uint32_t src_basic_block_idx = HCC_AML_OPERAND_AUX(src->basic_block_operand);
+					if (src->operand == HCC_AML_OPERAND(BASIC_BLOCK_PARAM, param_idx) || !basic_blocks[src_basic_block_idx].is_live || !hcc_amlopt_eliminate_dead_code_is_edge(w, aml_function, src_basic_block_idx, basic_block_idx)) {
+						continue;
+					}
+
+					HccAMLOperand operand = hcc_amlopt_eliminate_dead_code_resolve(w, aml_function, src->operand);
+					if ((replacement && replacement != operand) || HCC_AML_OPERAND_IS_BASIC_BLOCK_PARAM(operand)) {
+						replacement = 0;
+						break;
+					}
+					replacement = operand;
+				}
+
+				values[values_count + param_idx].replacement = replacement;
+			}
+		}
+
+		bool is_changed = false;
+		for (uint32_t basic_block_idx = 0; basic_block_idx < aml_function->basic_blocks_count; basic_block_idx += 1) {
+			uint32_t branch_target_idx = hcc_amlopt_eliminate_dead_code_branch_target(w, aml_function, &basic_blocks[basic_block_idx]);
+			if (basic_blocks[basic_block_idx].branch_target_idx != branch_target_idx) {
+				basic_blocks[basic_block_idx].branch_target_idx = branch_target_idx;
+				is_changed = true;
+			}
+		}
+
+		if (!is_changed) {
+			break;
+		}
+	}
+
+	//
+	// count the uses of every value and basic block parameter in the live code.
+	// a basic block parameter that only feeds back into itself through a loop does not count as a use.
+	basic_block_idx = 0;
+	for (uint32_t aml_word_idx = 0; aml_word_idx < aml_function->words_count; ) {
+		HccAMLInstr* aml_instr = &aml_function->words[aml_word_idx];
+		HccAMLOperand* aml_operands = HCC_AML_INSTR_OPERANDS(aml_instr);
+		if (HCC_AML_INSTR_OP(aml_instr) == HCC_AML_OP_BASIC_BLOCK) {
+			basic_block_idx = HCC_AML_OPERAND_AUX(aml_operands[0]);
+		}
+
+		HccAMLOptBasicBlock* basic_block = &basic_blocks[basic_block_idx];
+		if (hcc_amlopt_eliminate_dead_code_is_instr_live(w, aml_function, basic_block, aml_word_idx)) {
+			uint32_t start_operand_idx;
+			uint32_t end_operand_idx;
+			hcc_amlopt_eliminate_dead_code_read_operands_range(basic_block, aml_word_idx, aml_instr, &start_operand_idx, &end_operand_idx);
+			for (uint32_t operand_idx = start_operand_idx; operand_idx < end_operand_idx; operand_idx += 1) {
+				HccAMLOptValue* value = hcc_amlopt_eliminate_dead_code_value(w, aml_function, hcc_amlopt_eliminate_dead_code_resolve(w, aml_function, aml_operands[operand_idx]));
+				if (value) {
+					value->uses_count += 1;
+				}
+			}
+
+			if (HCC_AML_INSTR_OP(aml_instr) == HCC_AML_OP_PTR_STORE && HCC_AML_OPERAND_IS_VALUE(aml_operands[0])) {
+				values[HCC_AML_OPERAND_AUX(aml_operands[0])].store_uses_count += 1;
+			}
+		}
+
+		aml_word_idx += HCC_AML_INSTR_WORDS_COUNT(aml_instr);
+	}
+
+	for (uint32_t basic_block_idx = 0; basic_block_idx < aml_function->basic_blocks_count; basic_block_idx += 1) {
+		HccAMLBasicBlock* aml_basic_block = &aml_function->basic_blocks[basic_block_idx];
+		if (!basic_blocks[basic_block_idx].is_live) {
+			continue;
+		}
+
+		for (uint32_t param_idx = aml_basic_block->params_start_idx; param_idx < aml_basic_block->params_start_idx + aml_basic_block->params_count; param_idx += 1) {
+			HccAMLBasicBlockParam* param = &aml_function->basic_block_params[param_idx];
+			for (uint32_t src_idx = param->srcs_start_idx; src_idx < param->srcs_start_idx + param->srcs_count; src_idx += 1) {
+				HccAMLBasicBlockParamSrc* src = &aml_function->basic_block_param_srcs[src_idx];
+				uint32_t src_basic_block_idx = HCC_AML_OPERAND_AUX(src->basic_block_operand);
+				if (src->operand == HCC_AML_OPERAND(BASIC_BLOCK_PARAM, param_idx) || !basic_blocks[src_basic_block_idx].is_live || !hcc_amlopt_eliminate_dead_code_is_edge(w, aml_function, src_basic_block_idx, basic_block_idx)) {
+					continue;
+				}
+
+				HccAMLOptValue* value = hcc_amlopt_eliminate_dead_code_value(w, aml_function, hcc_amlopt_eliminate_dead_code_resolve(w, aml_function, src->operand));
+				if (value) {
+					value->uses_count += 1;
+				}
+			}
+		}
+	}
+
+	//
+	// dead stores: a static allocation that is never read, only stored to directly or through access chains into it.
+	// first find the write only pointers, an access chain that is only stored through counts as a store into its base pointer.
+	bool is_changed = true;
+	while (is_changed) {
+		is_changed = false;
+		basic_block_idx = 0;
+		for (uint32_t aml_word_idx = 0; aml_word_idx < aml_function->words_count; ) {
+			HccAMLInstr* aml_instr = &aml_function->words[aml_word_idx];
+			HccAMLOp aml_op = HCC_AML_INSTR_OP(aml_instr);
+			HccAMLOperand* aml_operands = HCC_AML_INSTR_OPERANDS(aml_instr);
+			if (aml_op == HCC_AML_OP_BASIC_BLOCK) {
+				basic_block_idx = HCC_AML_OPERAND_AUX(aml_operands[0]);
+			}
+
+			if (
+				(aml_op == HCC_AML_OP_PTR_ACCESS_CHAIN || aml_op == HCC_AML_OP_PTR_ACCESS_CHAIN_IN_BOUNDS) &&
+				HCC_AML_OPERAND_IS_VALUE(aml_operands[0]) && HCC_AML_OPERAND_IS_VALUE(aml_operands[1]) &&
+				hcc_amlopt_eliminate_dead_code_is_instr_live(w, aml_function, &basic_blocks[basic_block_idx], aml_word_idx)
+			) {
+				HccAMLOptValue* value = &values[HCC_AML_OPERAND_AUX(aml_operands[0])];
+				if (!value->is_write_only && value->uses_count == value->store_uses_count) {
+					value->is_write_only = true;
+					values[HCC_AML_OPERAND_AUX(aml_operands[1])].store_uses_count += 1;
+					is_changed = true;
+				}
+			}
+
+			aml_word_idx += HCC_AML_INSTR_WORDS_COUNT(aml_instr);
+		}
+	}
+
+	//
+	// then only the write only pointers that lead back to a write only static allocation are dead store targets.
+	// the base of an access chain is always defined before it, so one walk forwards is enough.
+	basic_block_idx = 0;
+	for (uint32_t aml_word_idx = 0; aml_word_idx < aml_function->words_count; ) {
+		HccAMLInstr* aml_instr = &aml_function->words[aml_word_idx];
+		HccAMLOp aml_op = HCC_AML_INSTR_OP(aml_instr);
+		HccAMLOperand* aml_operands = HCC_AML_INSTR_OPERANDS(aml_instr);
+		if (aml_op == HCC_AML_OP_BASIC_BLOCK) {
+			basic_block_idx = HCC_AML_OPERAND_AUX(aml_operands[0]);
+		}
+
+		if (hcc_amlopt_eliminate_dead_code_is_instr_live(w, aml_function, &basic_blocks[basic_block_idx], aml_word_idx)) {
+			switch (aml_op) {
+				case HCC_AML_OP_PTR_STATIC_ALLOC: {
+					HccAMLOptValue* value = &values[HCC_AML_OPERAND_AUX(aml_operands[0])];
+					value->is_dead_store_target = value->uses_count == value->store_uses_count;
+					break;
+				};
+				case HCC_AML_OP_PTR_ACCESS_CHAIN:
+				case HCC_AML_OP_PTR_ACCESS_CHAIN_IN_BOUNDS: {
+					HccAMLOptValue* value = &values[HCC_AML_OPERAND_AUX(aml_operands[0])];
+					value->is_dead_store_target = value->is_write_only && HCC_AML_OPERAND_IS_VALUE(aml_operands[1]) && values[HCC_AML_OPERAND_AUX(aml_operands[1])].is_dead_store_target;
+					break;
+				};
+				case HCC_AML_OP_PTR_STORE:
+					if (HCC_AML_OPERAND_IS_VALUE(aml_operands[0]) && values[HCC_AML_OPERAND_AUX(aml_operands[0])].is_dead_store_target) {
+						hcc_amlopt_eliminate_dead_code_remove_use(w, aml_function, aml_operands[0]);
+						hcc_amlopt_eliminate_dead_code_remove_use(w, aml_function, aml_operands[1]);
+					}
+					break;
+			}
+		}
+
+		aml_word_idx += HCC_AML_INSTR_WORDS_COUNT(aml_instr);
+	}
+
+	//
+	// remove the values and basic block parameters that have no uses left, which can leave the values they use with no uses.
+	// so keep going until nothing else can be removed.
+	is_changed = true;
+	while (is_changed) {
+		is_changed = false;
+		basic_block_idx = 0;
+		for (uint32_t aml_word_idx = 0; aml_word_idx < aml_function->words_count; ) {
+			HccAMLInstr* aml_instr = &aml_function->words[aml_word_idx];
+			HccAMLOp aml_op = HCC_AML_INSTR_OP(aml_instr);
+			HccAMLOperand* aml_operands = HCC_AML_INSTR_OPERANDS(aml_instr);
+			if (aml_op == HCC_AML_OP_BASIC_BLOCK) {
+				basic_block_idx = HCC_AML_OPERAND_AUX(aml_operands[0]);
+			}
+
+			HccAMLOptBasicBlock* basic_block = &basic_blocks[basic_block_idx];
+			if (aml_op == HCC_AML_OP_BASIC_BLOCK && basic_block->is_live) {
+				HccAMLBasicBlock* aml_basic_block = &aml_function->basic_blocks[basic_block_idx];
+				for (uint32_t param_idx = aml_basic_block->params_start_idx; param_idx < aml_basic_block->params_start_idx + aml_basic_block->params_count; param_idx += 1) {
+					HccAMLOptValue* value = &values[values_count + param_idx];
+					if (value->is_removed || value->uses_count) {
+						continue;
+					}
+
+					value->is_removed = true;
+					is_changed = true;
+					HccAMLBasicBlockParam* param = &aml_function->basic_block_params[param_idx];
+					for (uint32_t src_idx = param->srcs_start_idx; src_idx < param->srcs_start_idx + param->srcs_count; src_idx += 1) {
+						HccAMLBasicBlockParamSrc* src = &aml_function->basic_block_param_srcs[src_idx];
+						uint32_t src_basic_block_idx = HCC_AML_OPERAND_AUX(src->basic_block_operand);
+						if (src->operand != HCC_AML_OPERAND(BASIC_BLOCK_PARAM, param_idx) && basic_blocks[src_basic_block_idx].is_live && hcc_amlopt_eliminate_dead_code_is_edge(w, aml_function, src_basic_block_idx, basic_block_idx)) {
+							hcc_amlopt_eliminate_dead_code_remove_use(w, aml_function, src->operand);
+						}
+					}
+				}
+			} else if (
+				hcc_amlopt_eliminate_dead_code_is_pure(aml_op) && HCC_AML_OPERAND_IS_VALUE(aml_operands[0]) &&
+				values[HCC_AML_OPERAND_AUX(aml_operands[0])].uses_count == 0 &&
+				hcc_amlopt_eliminate_dead_code_is_instr_live(w, aml_function, basic_block, aml_word_idx)
+			) {
+				uint32_t start_operand_idx;
+				uint32_t end_operand_idx;
+				hcc_amlopt_eliminate_dead_code_read_operands_range(basic_block, aml_word_idx, aml_instr, &start_operand_idx, &end_operand_idx);
+				for (uint32_t operand_idx = start_operand_idx; operand_idx < end_operand_idx; operand_idx += 1) {
+					hcc_amlopt_eliminate_dead_code_remove_use(w, aml_function, aml_operands[operand_idx]);
+				}
+				values[HCC_AML_OPERAND_AUX(aml_operands[0])].is_removed = true;
+				is_changed = true;
+			}
+
+			aml_word_idx += HCC_AML_INSTR_WORDS_COUNT(aml_instr);
+		}
+	}
+
+	hcc_amlopt_eliminate_dead_code_merge_basic_blocks(w, aml_function);
+
+	//
+	// give everything that survived its new index. the parameters of the function are
+	// at fixed value indices that the backends depend on, so they always keep theirs.
+	// a basic block that has been joined on to the one before it takes its index.
+	uint32_t new_words_count = 0;
+	uint32_t new_values_count = aml_function->params_count * 2;
+	uint32_t new_basic_blocks_count = 0;
+	uint32_t new_basic_block_params_count = 0;
+	uint32_t new_basic_block_param_srcs_count = 0;
+	for (uint32_t value_idx = 0; value_idx < new_values_count; value_idx += 1) {
+		values[value_idx].new_idx = value_idx;
+	}
+
+	basic_block_idx = 0;
+	for (uint32_t aml_word_idx = 0; aml_word_idx < aml_function->words_count; ) {
+		HccAMLInstr* aml_instr = &aml_function->words[aml_word_idx];
+		HccAMLOp aml_op = HCC_AML_INSTR_OP(aml_instr);
+		HccAMLOperand* aml_operands = HCC_AML_INSTR_OPERANDS(aml_instr);
+		if (aml_op == HCC_AML_OP_BASIC_BLOCK) {
+			basic_block_idx = HCC_AML_OPERAND_AUX(aml_operands[0]);
+		}
+
+		HccAMLOptBasicBlock* basic_block = &basic_blocks[basic_block_idx];
+		if (aml_op == HCC_AML_OP_BASIC_BLOCK && basic_block->is_live && basic_block->is_merged_with_prev) {
+			basic_block->new_idx = new_basic_blocks_count - 1;
+		}
+		if (hcc_amlopt_eliminate_dead_code_is_instr_live(w, aml_function, basic_block, aml_word_idx)) {
+			new_words_count += 2 + hcc_amlopt_eliminate_dead_code_operands_count(basic_block, aml_word_idx, aml_instr);
+			if (aml_op == HCC_AML_OP_BASIC_BLOCK) {
+				basic_block->new_idx = new_basic_blocks_count;
+				new_basic_blocks_count += 1;
+
+				HccAMLBasicBlock* aml_basic_block = &aml_function->basic_blocks[basic_block_idx];
+				for (uint32_t param_idx = aml_basic_block->params_start_idx; param_idx < aml_basic_block->params_start_idx + aml_basic_block->params_count; param_idx += 1) {
+					HccAMLOptValue* value = &values[values_count + param_idx];
+					if (value->is_removed) {
+						continue;
+					}
+
+					value->new_idx = new_basic_block_params_count;
+					new_basic_block_params_count += 1;
+
+					HccAMLBasicBlockParam* param = &aml_function->basic_block_params[param_idx];
+					for (uint32_t src_idx = param->srcs_start_idx; src_idx < param->srcs_start_idx + param->srcs_count; src_idx += 1) {
+						uint32_t src_basic_block_idx = HCC_AML_OPERAND_AUX(aml_function->basic_block_param_srcs[src_idx].basic_block_operand);
+						if (basic_blocks[src_basic_block_idx].is_live && hcc_amlopt_eliminate_dead_code_is_edge(w, aml_function, src_basic_block_idx, basic_block_idx)) {
+							new_basic_block_param_srcs_count += 1;
+						}
+					}
+				}
+			} else if (hcc_aml_op_code_has_return_value[aml_op] && HCC_AML_OPERAND_IS_VALUE(aml_operands[0]) && HCC_AML_OPERAND_AUX(aml_operands[0]) >= aml_function->params_count * 2) {
+				values[HCC_AML_OPERAND_AUX(aml_operands[0])].new_idx = new_values_count;
+				new_values_count += 1;
+			}
+		}
+
+		aml_word_idx += HCC_AML_INSTR_WORDS_COUNT(aml_instr);
+	}
+
+	if (
+		new_words_count == aml_function->words_count &&
+		new_values_count == aml_function->values_count &&
+		new_basic_blocks_count == aml_function->basic_blocks_count &&
+		new_basic_block_params_count == aml_function->basic_block_params_count &&
+		new_basic_block_param_srcs_count == aml_function->basic_block_param_srcs_count
+	) {
+		return aml_function;
+	}
+
+	HccAMLFunction* new_aml_function = hcc_amlopt_function_alloc(cu, aml_function, new_words_count, new_values_count, new_basic_blocks_count, new_basic_block_params_count, new_basic_block_param_srcs_count);
+	for (uint32_t value_idx = 0; value_idx < values_count; value_idx += 1) {
+		if (values[value_idx].new_idx != UINT32_MAX) {
+			new_aml_function->values[values[value_idx].new_idx] = aml_function->values[value_idx];
+		}
+	}
+
+	//
+	// copy over the live basic blocks with their live parameters and the sources that still branch to them
+	uint32_t new_basic_block_param_srcs_idx = 0;
+	for (uint32_t basic_block_idx = 0; basic_block_idx < aml_function->basic_blocks_count; basic_block_idx += 1) {
+		HccAMLOptBasicBlock* basic_block = &basic_blocks[basic_block_idx];
+		if (basic_block->new_idx == UINT32_MAX || basic_block->is_merged_with_prev) {
+			continue;
+		}
+
+		HccAMLBasicBlock* aml_basic_block = &aml_function->basic_blocks[basic_block_idx];
+		HccAMLBasicBlock* new_aml_basic_block = &new_aml_function->basic_blocks[basic_block->new_idx];
+		new_aml_basic_block->word_idx = UINT32_MAX;
+		new_aml_basic_block->terminating_instr_word_idx = UINT32_MAX;
+		new_aml_basic_block->params_start_idx = UINT16_MAX;
+		new_aml_basic_block->params_count = 0;
+		for (uint32_t param_idx = aml_basic_block->params_start_idx; param_idx < aml_basic_block->params_start_idx + aml_basic_block->params_count; param_idx += 1) {
+			HccAMLOptValue* value = &values[values_count + param_idx];
+			if (value->new_idx == UINT32_MAX) {
+				continue;
+			}
+
+			if (new_aml_basic_block->params_count == 0) {
+				new_aml_basic_block->params_start_idx = value->new_idx;
+			}
+			new_aml_basic_block->params_count += 1;
+
+			HccAMLBasicBlockParam* param = &aml_function->basic_block_params[param_idx];
+			HccAMLBasicBlockParam* new_param = &new_aml_function->basic_block_params[value->new_idx];
+			new_param->data_type = param->data_type;
+			new_param->srcs_start_idx = new_basic_block_param_srcs_idx;
+			new_param->srcs_count = 0;
+			for (uint32_t src_idx = param->srcs_start_idx; src_idx < param->srcs_start_idx + param->srcs_count; src_idx += 1) {
+				HccAMLBasicBlockParamSrc* src = &aml_function->basic_block_param_srcs[src_idx];
+				uint32_t src_basic_block_idx = HCC_AML_OPERAND_AUX(src->basic_block_operand);
+				if (!basic_blocks[src_basic_block_idx].is_live || !hcc_amlopt_eliminate_dead_code_is_edge(w, aml_function, src_basic_block_idx, basic_block_idx)) {
+					continue;
+				}
+
+				HccAMLBasicBlockParamSrc* new_src = &new_aml_function->basic_block_param_srcs[new_basic_block_param_srcs_idx];
+				new_src->basic_block_operand = hcc_amlopt_eliminate_dead_code_operand(w, aml_function, src->basic_block_operand);
+				new_src->operand = hcc_amlopt_eliminate_dead_code_operand(w, aml_function, src->operand);
+				new_param->srcs_count += 1;
+				new_basic_block_param_srcs_idx += 1;
+			}
+		}
+
+		if (new_aml_basic_block->params_count == 0) {
+			new_aml_basic_block->params_start_idx = 0;
+		}
+	}
+
+	//
+	// copy over the live instructions with their operands moved to the new indices
+	uint32_t new_word_idx = 0;
+	basic_block_idx = 0;
+	for (uint32_t aml_word_idx = 0; aml_word_idx < aml_function->words_count; ) {
+		HccAMLInstr* aml_instr = &aml_function->words[aml_word_idx];
+		HccAMLOp aml_op = HCC_AML_INSTR_OP(aml_instr);
+		HccAMLOperand* aml_operands = HCC_AML_INSTR_OPERANDS(aml_instr);
+		uint32_t words_count = HCC_AML_INSTR_WORDS_COUNT(aml_instr);
+		if (aml_op == HCC_AML_OP_BASIC_BLOCK) {
+			basic_block_idx = HCC_AML_OPERAND_AUX(aml_operands[0]);
+		}
+
+		HccAMLOptBasicBlock* basic_block = &basic_blocks[basic_block_idx];
+		if (!hcc_amlopt_eliminate_dead_code_is_instr_live(w, aml_function, basic_block, aml_word_idx)) {
+			aml_word_idx += words_count;
+			continue;
+		}
+
+		HccAMLBasicBlock* new_aml_basic_block = &new_aml_function->basic_blocks[basic_block->new_idx];
+		if (aml_op == HCC_AML_OP_BASIC_BLOCK) {
+			new_aml_basic_block->word_idx = new_word_idx;
+		}
+		if (aml_word_idx == aml_function->basic_blocks[basic_block_idx].terminating_instr_word_idx) {
+			new_aml_basic_block->terminating_instr_word_idx = new_word_idx;
+		}
+
+		uint32_t new_operands_count = hcc_amlopt_eliminate_dead_code_operands_count(basic_block, aml_word_idx, aml_instr);
+		HccAMLInstr* new_aml_instr = &new_aml_function->words[new_word_idx];
+		HccAMLOperand* new_aml_operands = HCC_AML_INSTR_OPERANDS(new_aml_instr);
+		new_aml_instr[1] = aml_instr[1];
+		if (aml_word_idx == basic_block->terminator_word_idx && basic_block->branch_target_idx != UINT32_MAX) {
+			new_aml_instr[0] = HCC_AML_INSTR(HCC_AML_OP_BRANCH, new_operands_count);
+			new_aml_operands[0] = HCC_AML_OPERAND(BASIC_BLOCK, basic_blocks[basic_block->branch_target_idx].new_idx);
+		} else {
+			new_aml_instr[0] = HCC_AML_INSTR(aml_op, new_operands_count);
+			for (uint32_t operand_idx = 0; operand_idx < new_operands_count; operand_idx += 1) {
+				new_aml_operands[operand_idx] = aml_op == HCC_AML_OP_SHUFFLE && operand_idx >= 3
+					? aml_operands[operand_idx]
+					: hcc_amlopt_eliminate_dead_code_operand(w, aml_function, aml_operands[operand_idx]);
+			}
+		}
+
+		aml_word_idx += words_count;
+		new_word_idx += 2 + new_operands_count;
+	}
+	HCC_DEBUG_ASSERT(new_word_idx == new_aml_function->words_count, "internal error: expected to copy '%u' words but copied '%u'", new_aml_function->words_count, new_word_idx);
+
+	return new_aml_function;
+}
+
+uint32_t hcc_amlopt_promote_static_allocs_alloc_idx(HccWorker* w, HccAMLOperand operand) {
+	if (!HCC_AML_OPERAND_IS_VALUE(operand)) {
+		return UINT32_MAX;
+	}
+
+	return w->amlopt.values[HCC_AML_OPERAND_AUX(operand)].alloc_idx;
+}
+
+bool hcc_amlopt_promote_static_allocs_is_promoted_instr(HccWorker* w, HccAMLInstr* aml_instr) {
+	HccAMLOperand* aml_operands = HCC_AML_INSTR_OPERANDS(aml_instr);
+	switch (HCC_AML_INSTR_OP(aml_instr)) {
+		case HCC_AML_OP_PTR_STATIC_ALLOC: return hcc_amlopt_promote_static_allocs_alloc_idx(w, aml_operands[0]) != UINT32_MAX;
+		case HCC_AML_OP_PTR_LOAD: return hcc_amlopt_promote_static_allocs_alloc_idx(w, aml_operands[1]) != UINT32_MAX;
+		case HCC_AML_OP_PTR_STORE: return hcc_amlopt_promote_static_allocs_alloc_idx(w, aml_operands[0]) != UINT32_MAX;
+		default: return false;
+	}
+}
+
+HccAMLOperand hcc_amlopt_promote_static_allocs_undefined(HccWorker* w, uint32_t alloc_idx) {
+	//
+	// reading a local variable before it is written to is undefined in C, so just give zero
+	HccAMLOptAlloc* alloc = &w->amlopt.allocs[alloc_idx];
+	if (!alloc->undefined_operand) {
+		alloc->undefined_operand = HCC_AML_OPERAND(CONSTANT, hcc_constant_table_deduplicate_zero(w->cu, alloc->data_type).idx_plus_one);
+	}
+
+	return alloc->undefined_operand;
+}
+
+HccAMLOperand hcc_amlopt_promote_static_allocs_operand(HccWorker* w, const HccAMLFunction* aml_function, HccAMLOperand operand) {
+	switch (HCC_AML_OPERAND_TYPE(operand)) {
+		case HCC_AML_OPERAND_VALUE: {
+			HccAMLOptValue* value = &w->amlopt.values[HCC_AML_OPERAND_AUX(operand)];
+			return value->replacement ? value->replacement : operand;
+		};
+		case HCC_AML_OPERAND_BASIC_BLOCK_PARAM: {
+			HccAMLOptValue* value = &w->amlopt.values[aml_function->values_count + HCC_AML_OPERAND_AUX(operand)];
+			return HCC_AML_OPERAND(BASIC_BLOCK_PARAM, value->new_idx);
+		};
+		default:
+			return operand;
+	}
+}
+
+void hcc_amlopt_promote_static_allocs_find_defs(HccWorker* w, const HccAMLFunction* aml_function, bool is_counting) {
+	HccAMLOptBasicBlock* basic_blocks = w->amlopt.basic_blocks;
+	HccAMLOptAlloc* allocs = w->amlopt.allocs;
+	for (uint32_t alloc_idx = 0; alloc_idx < hcc_stack_count(allocs); alloc_idx += 1) {
+		allocs[alloc_idx].stored_basic_block_idx = UINT32_MAX;
+	}
+
+	//
+	// only the code that can be reached matters, the rest has its loads replaced with the undefined value
+	uint32_t basic_block_idx = 0;
+	for (uint32_t aml_word_idx = 0; aml_word_idx < aml_function->words_count; ) {
+		HccAMLInstr* aml_instr = &aml_function->words[aml_word_idx];
+		HccAMLOp aml_op = HCC_AML_INSTR_OP(aml_instr);
+		HccAMLOperand* aml_operands = HCC_AML_INSTR_OPERANDS(aml_instr);
+		if (aml_op == HCC_AML_OP_BASIC_BLOCK) {
+			basic_block_idx = HCC_AML_OPERAND_AUX(aml_operands[0]);
+		}
+
+		HccAMLOptBasicBlock* basic_block = &basic_blocks[basic_block_idx];
+		if (basic_block->order_idx != UINT32_MAX && aml_word_idx <= basic_block->terminator_word_idx) {
+			if (aml_op == HCC_AML_OP_PTR_LOAD && is_counting) {
+				uint32_t alloc_idx = hcc_amlopt_promote_static_allocs_alloc_idx(w, aml_operands[1]);
+				if (alloc_idx != UINT32_MAX && allocs[alloc_idx].stored_basic_block_idx != basic_block_idx) {
+					allocs[alloc_idx].is_live_in = true;
+				}
+			} else if (aml_op == HCC_AML_OP_PTR_STORE) {
+				uint32_t alloc_idx = hcc_amlopt_promote_static_allocs_alloc_idx(w, aml_operands[0]);
+				HccAMLOptAlloc* alloc = alloc_idx != UINT32_MAX ? &allocs[alloc_idx] : NULL;
+				if (alloc && alloc->stored_basic_block_idx != basic_block_idx) {
+					alloc->stored_basic_block_idx = basic_block_idx;
+					if (!is_counting) {
+						w->amlopt.alloc_def_basic_blocks[alloc->def_basic_blocks_start_idx + alloc->def_basic_blocks_count] = basic_block_idx;
+					}
+					alloc->def_basic_blocks_count += 1;
+				}
+			}
+		}
+
+		aml_word_idx += HCC_AML_INSTR_WORDS_COUNT(aml_instr);
+	}
+}
+
+const HccAMLFunction* hcc_amlopt_promote_static_allocs(HccWorker* w, HccDecl function_decl, const HccAMLFunction* aml_function) {
+	HCC_UNUSED(function_decl);
+	HccCU* cu = w->cu;
+	uint32_t values_count = aml_function->values_count;
+
+	hcc_stack_clear(w->amlopt.values);
+	HccAMLOptValue* values = hcc_stack_push_many(w->amlopt.values, values_count + aml_function->basic_block_params_count);
+	for (uint32_t idx = 0; idx < values_count + aml_function->basic_block_params_count; idx += 1) {
+		HccAMLOptValue* value = &values[idx];
+		HCC_ZERO_ELMT(value);
+		value->alloc_idx = UINT32_MAX;
+		value->new_idx = UINT32_MAX;
+	}
+
+	//
+	// find the static allocations that could live in values.
+	// the volatile ones have to stay in memory and SPIR-V does not allow pointers or resources to come out of a basic block parameter.
+	HccStack(HccAMLOptAlloc) allocs = w->amlopt.allocs;
+	hcc_stack_clear(allocs);
+	for (uint32_t aml_word_idx = 0; aml_word_idx < aml_function->words_count; ) {
+		HccAMLInstr* aml_instr = &aml_function->words[aml_word_idx];
+		HccAMLOperand* aml_operands = HCC_AML_INSTR_OPERANDS(aml_instr);
+		if (HCC_AML_INSTR_OP(aml_instr) == HCC_AML_OP_PTR_STATIC_ALLOC && HCC_AML_OPERAND_IS_VALUE(aml_operands[0])) {
+			HccDataType data_type = aml_operands[1];
+			HccDataType resolved_data_type = hcc_decl_resolve_and_strip_qualifiers(cu, data_type);
+			if (
+				!HCC_DATA_TYPE_IS_VOLATILE(data_type) &&
+				!HCC_DATA_TYPE_IS_POINTER(resolved_data_type) &&
+				!HCC_DATA_TYPE_IS_RESOURCE(resolved_data_type) &&
+				!HCC_DATA_TYPE_IS_RESOURCE_DESCRIPTOR(resolved_data_type)
+			) {
+				values[HCC_AML_OPERAND_AUX(aml_operands[0])].alloc_idx = hcc_stack_count(allocs);
+				HccAMLOptAlloc* alloc = hcc_stack_push(allocs);
+				HCC_ZERO_ELMT(alloc);
+				alloc->value_idx = HCC_AML_OPERAND_AUX(aml_operands[0]);
+				alloc->data_type = resolved_data_type;
+			}
+		}
+
+		aml_word_idx += HCC_AML_INSTR_WORDS_COUNT(aml_instr);
+	}
+
+	//
+	// an allocation escapes when its pointer is used for anything other than the address of a whole load or store.
+	for (uint32_t aml_word_idx = 0; aml_word_idx < aml_function->words_count; ) {
+		HccAMLInstr* aml_instr = &aml_function->words[aml_word_idx];
+		HccAMLOp aml_op = HCC_AML_INSTR_OP(aml_instr);
+		HccAMLOperand* aml_operands = HCC_AML_INSTR_OPERANDS(aml_instr);
+		uint32_t aml_operands_count = HCC_AML_INSTR_OPERANDS_COUNT(aml_instr);
+		if (aml_op == HCC_AML_OP_SHUFFLE) {
+			aml_operands_count = HCC_MIN(aml_operands_count, 3); // the rest are raw indices
+		}
+
+		for (uint32_t operand_idx = hcc_aml_op_code_has_return_value[aml_op] ? 1 : 0; operand_idx < aml_operands_count; operand_idx += 1) {
+			uint32_t alloc_idx = hcc_amlopt_promote_static_allocs_alloc_idx(w, aml_operands[operand_idx]);
+			if (alloc_idx == UINT32_MAX) {
+				continue;
+			}
+
+			bool is_address = (aml_op == HCC_AML_OP_PTR_LOAD && operand_idx == 1) || (aml_op == HCC_AML_OP_PTR_STORE && operand_idx == 0);
+			if (!is_address) {
+				allocs[alloc_idx].is_escaped = true;
+			}
+		}
+
+		aml_word_idx += HCC_AML_INSTR_WORDS_COUNT(aml_instr);
+	}
+	for (uint32_t src_idx = 0; src_idx < aml_function->basic_block_param_srcs_count; src_idx += 1) {
+		uint32_t alloc_idx = hcc_amlopt_promote_static_allocs_alloc_idx(w, aml_function->basic_block_param_srcs[src_idx].operand);
+		if (alloc_idx != UINT32_MAX) {
+			allocs[alloc_idx].is_escaped = true;
+		}
+	}
+
+	HccAMLOptBasicBlock* basic_blocks = hcc_amlopt_basic_blocks_init(w, aml_function);
+	hcc_amlopt_dominators(w, aml_function);
+	HccStack(uint32_t) order = w->amlopt.basic_block_order;
+	uint32_t order_count = hcc_stack_count(order);
+
+	//
+	// keep the allocations that do not escape. the current value of every allocation at the end of every reachable
+	// basic block is stored in one table, so only promote as many allocations as that table can fit.
+	uint32_t allocs_cap = hcc_stack_reserve_cap(w->amlopt.alloc_values) / order_count;
+	uint32_t allocs_count = 0;
+	for (uint32_t alloc_idx = 0; alloc_idx < hcc_stack_count(allocs); alloc_idx += 1) {
+		HccAMLOptAlloc* alloc = &allocs[alloc_idx];
+		if (alloc->is_escaped || allocs_count == allocs_cap) {
+			values[alloc->value_idx].alloc_idx = UINT32_MAX;
+			continue;
+		}
+
+		values[alloc->value_idx].alloc_idx = allocs_count;
+		allocs[allocs_count] = *alloc;
+		allocs_count += 1;
+	}
+	hcc_stack_resize(allocs, allocs_count);
+
+	//
+	// the entry basic block cannot have basic block parameters, so leave the function alone if anything branches back to it
+	if (allocs_count == 0 || basic_blocks[0].preds_count) {
+		return aml_function;
+	}
+
+	//
+	// find the basic blocks that store to each allocation, and the allocations that are loaded in a basic block before they are stored to there.
+	// the other allocations never carry a value from one basic block to another so they never need basic block parameters.
+	HccStack(uint32_t) def_basic_blocks = w->amlopt.alloc_def_basic_blocks;
+	hcc_stack_clear(def_basic_blocks);
+	hcc_amlopt_promote_static_allocs_find_defs(w, aml_function, true);
+	uint32_t def_basic_blocks_count = 0;
+	for (uint32_t alloc_idx = 0; alloc_idx < allocs_count; alloc_idx += 1) {
+		allocs[alloc_idx].def_basic_blocks_start_idx = def_basic_blocks_count;
+		def_basic_blocks_count += allocs[alloc_idx].def_basic_blocks_count;
+		allocs[alloc_idx].def_basic_blocks_count = 0;
+	}
+	hcc_stack_push_many(def_basic_blocks, def_basic_blocks_count);
+	hcc_amlopt_promote_static_allocs_find_defs(w, aml_function, false);
+
+	//
+	// place the basic block parameters on the iterated dominance frontier of the basic blocks that store to each allocation.
+	// "Efficiently Computing Static Single Assignment Form and the Control Dependence Graph" by Ron Cytron et al.
+	hcc_amlopt_dominance_frontiers(w);
+	HccStack(uint32_t) frontiers = w->amlopt.dominance_frontiers;
+	HccStack(uint32_t) work = w->amlopt.basic_block_work;
+	HccStack(HccAMLOptAllocParam) alloc_params = w->amlopt.alloc_params;
+	hcc_stack_clear(alloc_params);
+	for (uint32_t alloc_idx = 0; alloc_idx < allocs_count; alloc_idx += 1) {
+		HccAMLOptAlloc* alloc = &allocs[alloc_idx];
+		if (!alloc->is_live_in) {
+			continue;
+		}
+
+		uint32_t mark = alloc_idx + 1;
+		hcc_stack_clear(work);
+		for (uint32_t idx = alloc->def_basic_blocks_start_idx; idx < alloc->def_basic_blocks_start_idx + alloc->def_basic_blocks_count; idx += 1) {
+			basic_blocks[def_basic_blocks[idx]].alloc_work_mark = mark;
+			*hcc_stack_push(work) = def_basic_blocks[idx];
+		}
+
+		while (hcc_stack_count(work)) {
+			HccAMLOptBasicBlock* basic_block = &basic_blocks[*hcc_stack_get_last(work)];
+			hcc_stack_pop(work);
+			for (uint32_t frontier_idx = basic_block->frontier_start_idx; frontier_idx < basic_block->frontier_start_idx + basic_block->frontier_count; frontier_idx += 1) {
+				uint32_t frontier_basic_block_idx = frontiers[frontier_idx];
+				HccAMLOptBasicBlock* frontier_basic_block = &basic_blocks[frontier_basic_block_idx];
+				if (frontier_basic_block->alloc_param_mark == mark) {
+					continue;
+				}
+
+				frontier_basic_block->alloc_param_mark = mark;
+				frontier_basic_block->alloc_params_count += 1;
+				HccAMLOptAllocParam* alloc_param = hcc_stack_push(alloc_params);
+				alloc_param->basic_block_idx = frontier_basic_block_idx;
+				alloc_param->alloc_idx = alloc_idx;
+
+				if (frontier_basic_block->alloc_work_mark != mark) {
+					frontier_basic_block->alloc_work_mark = mark;
+					*hcc_stack_push(work) = frontier_basic_block_idx;
+				}
+			}
+		}
+	}
+
+	//
+	// group the new basic block parameters by their basic block after the ones they were placed in,
+	// and give every basic block parameter its new index. the new ones go after the existing ones in each basic block.
+	uint32_t unsorted_alloc_params_count = hcc_stack_count(alloc_params);
+	uint32_t new_basic_block_params_count = 0;
+	uint32_t new_basic_block_param_srcs_count = aml_function->basic_block_param_srcs_count;
+	uint32_t sorted_alloc_params_idx = unsorted_alloc_params_count;
+	for (uint32_t basic_block_idx = 0; basic_block_idx < aml_function->basic_blocks_count; basic_block_idx += 1) {
+		HccAMLOptBasicBlock* basic_block = &basic_blocks[basic_block_idx];
+		HccAMLBasicBlock* aml_basic_block = &aml_function->basic_blocks[basic_block_idx];
+		basic_block->new_params_start_idx = new_basic_block_params_count;
+		for (uint32_t param_idx = 0; param_idx < aml_basic_block->params_count; param_idx += 1) {
+			values[values_count + aml_basic_block->params_start_idx + param_idx].new_idx = new_basic_block_params_count + param_idx;
+		}
+		new_basic_block_params_count += aml_basic_block->params_count + basic_block->alloc_params_count;
+		new_basic_block_param_srcs_count += basic_block->alloc_params_count * basic_block->preds_count;
+
+		basic_block->alloc_params_start_idx = sorted_alloc_params_idx;
+		sorted_alloc_params_idx += basic_block->alloc_params_count;
+		basic_block->alloc_params_count = 0;
+	}
+
+	//
+	// the basic block parameters and their sources are indexed with 16 bits
+	if (new_basic_block_params_count > UINT16_MAX || new_basic_block_param_srcs_count > UINT16_MAX) {
+		return aml_function;
+	}
+
+	hcc_stack_push_many(alloc_params, unsorted_alloc_params_count);
+	for (uint32_t idx = 0; idx < unsorted_alloc_params_count; idx += 1) {
+		HccAMLOptBasicBlock* basic_block = &basic_blocks[alloc_params[idx].basic_block_idx];
+		alloc_params[basic_block->alloc_params_start_idx + basic_block->alloc_params_count] = alloc_params[idx];
+		basic_block->alloc_params_count += 1;
+	}
+
+	//
+	// walk the reachable basic blocks in reverse postorder so the immediate dominator of a basic block is always done before it.
+	// each basic block's row in the table starts with its new basic block parameters, then takes on the rest from its immediate dominator
+	// and ends up holding the value of every allocation at the end of the basic block. zero means nothing has been stored yet.
+	hcc_stack_clear(w->amlopt.alloc_values);
+	HccAMLOperand* alloc_values = hcc_stack_push_many(w->amlopt.alloc_values, order_count * allocs_count);
+	memset(alloc_values, 0, order_count * allocs_count * sizeof(HccAMLOperand));
+	for (uint32_t basic_block_idx = 0; basic_block_idx < aml_function->basic_blocks_count; basic_block_idx += 1) {
+		HccAMLOptBasicBlock* basic_block = &basic_blocks[basic_block_idx];
+		uint32_t new_param_idx = basic_block->new_params_start_idx + aml_function->basic_blocks[basic_block_idx].params_count;
+		for (uint32_t idx = basic_block->alloc_params_start_idx; idx < basic_block->alloc_params_start_idx + basic_block->alloc_params_count; idx += 1) {
+			alloc_values[basic_block->order_idx * allocs_count + alloc_params[idx].alloc_idx] = HCC_AML_OPERAND(BASIC_BLOCK_PARAM, new_param_idx);
+			new_param_idx += 1;
+		}
+	}
+
+	uint32_t removed_words_count = 0;
+	for (uint32_t order_idx = 0; order_idx < order_count; order_idx += 1) {
+		uint32_t basic_block_idx = order[order_idx];
+		HccAMLOptBasicBlock* basic_block = &basic_blocks[basic_block_idx];
+		HccAMLOperand* row = &alloc_values[order_idx * allocs_count];
+		if (order_idx) {
+			HccAMLOperand* idom_row = &alloc_values[basic_blocks[basic_block->idom_idx].order_idx * allocs_count];
+			for (uint32_t alloc_idx = 0; alloc_idx < allocs_count; alloc_idx += 1) {
+				if (!row[alloc_idx]) {
+					row[alloc_idx] = idom_row[alloc_idx];
+				}
+			}
+		}
+
+		for (uint32_t aml_word_idx = aml_function->basic_blocks[basic_block_idx].word_idx; aml_word_idx <= basic_block->terminator_word_idx; ) {
+			HccAMLInstr* aml_instr = &aml_function->words[aml_word_idx];
+			HccAMLOperand* aml_operands = HCC_AML_INSTR_OPERANDS(aml_instr);
+			switch (HCC_AML_INSTR_OP(aml_instr)) {
+				case HCC_AML_OP_PTR_LOAD: {
+					uint32_t alloc_idx = hcc_amlopt_promote_static_allocs_alloc_idx(w, aml_operands[1]);
+					if (alloc_idx != UINT32_MAX) {
+						if (!row[alloc_idx]) {
+							row[alloc_idx] = hcc_amlopt_promote_static_allocs_undefined(w, alloc_idx);
+						}
+						values[HCC_AML_OPERAND_AUX(aml_operands[0])].replacement = row[alloc_idx];
+					}
+					break;
+				};
+				case HCC_AML_OP_PTR_STORE: {
+					uint32_t alloc_idx = hcc_amlopt_promote_static_allocs_alloc_idx(w, aml_operands[0]);
+					if (alloc_idx != UINT32_MAX) {
+						row[alloc_idx] = hcc_amlopt_promote_static_allocs_operand(w, aml_function, aml_operands[1]);
+					}
+					break;
+				};
+			}
+
+			aml_word_idx += HCC_AML_INSTR_WORDS_COUNT(aml_instr);
+		}
+	}
+
+	//
+	// the loads that cannot be reached have nothing stored before them
+	for (uint32_t aml_word_idx = 0; aml_word_idx < aml_function->words_count; ) {
+		HccAMLInstr* aml_instr = &aml_function->words[aml_word_idx];
+		HccAMLOperand* aml_operands = HCC_AML_INSTR_OPERANDS(aml_instr);
+		if (hcc_amlopt_promote_static_allocs_is_promoted_instr(w, aml_instr)) {
+			removed_words_count += HCC_AML_INSTR_WORDS_COUNT(aml_instr);
+			if (HCC_AML_INSTR_OP(aml_instr) == HCC_AML_OP_PTR_LOAD && !values[HCC_AML_OPERAND_AUX(aml_operands[0])].replacement) {
+				values[HCC_AML_OPERAND_AUX(aml_operands[0])].replacement = hcc_amlopt_promote_static_allocs_undefined(w, hcc_amlopt_promote_static_allocs_alloc_idx(w, aml_operands[1]));
+			}
+		}
+
+		aml_word_idx += HCC_AML_INSTR_WORDS_COUNT(aml_instr);
+	}
+
+	//
+	// the values keep their indices, the allocations and loads that are now unused get removed by the dead code elimination that follows.
+	HccAMLFunction* new_aml_function = hcc_amlopt_function_alloc(cu, aml_function, aml_function->words_count - removed_words_count, values_count, aml_function->basic_blocks_count, new_basic_block_params_count, new_basic_block_param_srcs_count);
+	HCC_COPY_ELMT_MANY(new_aml_function->values, aml_function->values, values_count);
+
+	uint32_t new_basic_block_param_srcs_idx = aml_function->basic_block_param_srcs_count;
+	for (uint32_t src_idx = 0; src_idx < aml_function->basic_block_param_srcs_count; src_idx += 1) {
+		HccAMLBasicBlockParamSrc* src = &aml_function->basic_block_param_srcs[src_idx];
+		HccAMLBasicBlockParamSrc* new_src = &new_aml_function->basic_block_param_srcs[src_idx];
+		new_src->basic_block_operand = src->basic_block_operand;
+		new_src->operand = hcc_amlopt_promote_static_allocs_operand(w, aml_function, src->operand);
+	}
+
+	for (uint32_t basic_block_idx = 0; basic_block_idx < aml_function->basic_blocks_count; basic_block_idx += 1) {
+		HccAMLOptBasicBlock* basic_block = &basic_blocks[basic_block_idx];
+		HccAMLBasicBlock* aml_basic_block = &aml_function->basic_blocks[basic_block_idx];
+		HccAMLBasicBlock* new_aml_basic_block = &new_aml_function->basic_blocks[basic_block_idx];
+		new_aml_basic_block->word_idx = UINT32_MAX;
+		new_aml_basic_block->terminating_instr_word_idx = UINT32_MAX;
+		new_aml_basic_block->params_count = aml_basic_block->params_count + basic_block->alloc_params_count;
+		new_aml_basic_block->params_start_idx = new_aml_basic_block->params_count ? basic_block->new_params_start_idx : 0;
+
+		for (uint32_t param_idx = 0; param_idx < aml_basic_block->params_count; param_idx += 1) {
+			new_aml_function->basic_block_params[basic_block->new_params_start_idx + param_idx] = aml_function->basic_block_params[aml_basic_block->params_start_idx + param_idx];
+		}
+
+		//
+		// the new basic block parameters get the value of their allocation at the end of each predecessor
+		for (uint32_t idx = 0; idx < basic_block->alloc_params_count; idx += 1) {
+			uint32_t alloc_idx = alloc_params[basic_block->alloc_params_start_idx + idx].alloc_idx;
+			HccAMLBasicBlockParam* new_param = &new_aml_function->basic_block_params[basic_block->new_params_start_idx + aml_basic_block->params_count + idx];
+			new_param->data_type = allocs[alloc_idx].data_type;
+			new_param->srcs_start_idx = new_basic_block_param_srcs_idx;
+			new_param->srcs_count = basic_block->preds_count;
+			for (uint32_t pred_idx = basic_block->preds_start_idx; pred_idx < basic_block->preds_start_idx + basic_block->preds_count; pred_idx += 1) {
+				uint32_t pred_basic_block_idx = w->amlopt.basic_block_preds[pred_idx];
+				HccAMLOperand operand = alloc_values[basic_blocks[pred_basic_block_idx].order_idx * allocs_count + alloc_idx];
+				HccAMLBasicBlockParamSrc* new_src = &new_aml_function->basic_block_param_srcs[new_basic_block_param_srcs_idx];
+				new_src->basic_block_operand = HCC_AML_OPERAND(BASIC_BLOCK, pred_basic_block_idx);
+				new_src->operand = operand ? operand : hcc_amlopt_promote_static_allocs_undefined(w, alloc_idx);
+				new_basic_block_param_srcs_idx += 1;
+			}
+		}
+	}
+	HCC_DEBUG_ASSERT(new_basic_block_param_srcs_idx == new_aml_function->basic_block_param_srcs_count, "internal error: expected to add '%u' basic block parameter sources but added '%u'", new_aml_function->basic_block_param_srcs_count, new_basic_block_param_srcs_idx);
+
+	//
+	// copy over the instructions that do not touch the promoted allocations
+	uint32_t new_word_idx = 0;
+	uint32_t basic_block_idx = 0;
+	for (uint32_t aml_word_idx = 0; aml_word_idx < aml_function->words_count; ) {
+		HccAMLInstr* aml_instr = &aml_function->words[aml_word_idx];
+		HccAMLOp aml_op = HCC_AML_INSTR_OP(aml_instr);
+		HccAMLOperand* aml_operands = HCC_AML_INSTR_OPERANDS(aml_instr);
+		uint32_t aml_operands_count = HCC_AML_INSTR_OPERANDS_COUNT(aml_instr);
+		uint32_t words_count = HCC_AML_INSTR_WORDS_COUNT(aml_instr);
+		if (aml_op == HCC_AML_OP_BASIC_BLOCK) {
+			basic_block_idx = HCC_AML_OPERAND_AUX(aml_operands[0]);
+			new_aml_function->basic_blocks[basic_block_idx].word_idx = new_word_idx;
+		}
+
+		if (hcc_amlopt_promote_static_allocs_is_promoted_instr(w, aml_instr)) {
+			aml_word_idx += words_count;
+			continue;
+		}
+
+		if (aml_word_idx == aml_function->basic_blocks[basic_block_idx].terminating_instr_word_idx) {
+			new_aml_function->basic_blocks[basic_block_idx].terminating_instr_word_idx = new_word_idx;
+		}
+
+		HccAMLInstr* new_aml_instr = &new_aml_function->words[new_word_idx];
+		HccAMLOperand* new_aml_operands = HCC_AML_INSTR_OPERANDS(new_aml_instr);
+		new_aml_instr[0] = aml_instr[0];
+		new_aml_instr[1] = aml_instr[1];
+		for (uint32_t operand_idx = 0; operand_idx < aml_operands_count; operand_idx += 1) {
+			new_aml_operands[operand_idx] = aml_op == HCC_AML_OP_SHUFFLE && operand_idx >= 3
+				? aml_operands[operand_idx]
+				: hcc_amlopt_promote_static_allocs_operand(w, aml_function, aml_operands[operand_idx]);
+		}
+
+		aml_word_idx += words_count;
+		new_word_idx += words_count;
+	}
+	HCC_DEBUG_ASSERT(new_word_idx == new_aml_function->words_count, "internal error: expected to copy '%u' words but copied '%u'", new_aml_function->words_count, new_word_idx);
+
+	return new_aml_function;
+}
+
+//
+// the size of a callee for the inlining heuristic, anything that does not turn into real work on the GPU is left out
+uint32_t hcc_amlopt_inline_instrs_count(const HccAMLFunction* callee) {
+	uint32_t instrs_count = 0;
+	for (uint32_t aml_word_idx = 0; aml_word_idx < callee->words_count; ) {
+		HccAMLInstr* aml_instr = &callee->words[aml_word_idx];
+		switch (HCC_AML_INSTR_OP(aml_instr)) {
+			case HCC_AML_OP_BASIC_BLOCK:
+			case HCC_AML_OP_SELECTION_MERGE:
+			case HCC_AML_OP_LOOP_MERGE:
+			case HCC_AML_OP_BRANCH:
+				break;
+			default:
+				instrs_count += 1;
+				break;
+		}
+
+		aml_word_idx += HCC_AML_INSTR_WORDS_COUNT(aml_instr);
+	}
+
+	return instrs_count;
+}
+
+uint32_t hcc_amlopt_inline_returns_count(HccWorker* w, const HccAMLFunction* callee) {
+	//
+	// once inlined, a return inside of a loop would have to break out of more than one loop which structured control flow does not allow.
+	// so mark every basic block that can be reached from a loop header without going through the loop's merge basic block.
+	hcc_stack_clear(w->amlopt.inline_callee_marks);
+	uint32_t* marks = hcc_stack_push_many(w->amlopt.inline_callee_marks, callee->basic_blocks_count);
+	HCC_ZERO_ELMT_MANY(marks, callee->basic_blocks_count);
+	HccStack(uint32_t) work = w->amlopt.basic_block_work;
+	for (uint32_t basic_block_idx = 0; basic_block_idx < callee->basic_blocks_count; basic_block_idx += 1) {
+		HccAMLBasicBlock* aml_basic_block = &callee->basic_blocks[basic_block_idx];
+		if (aml_basic_block->terminating_instr_word_idx == UINT32_MAX) {
+			continue;
+		}
+
+		uint32_t merge_basic_block_idx = UINT32_MAX;
+		for (uint32_t aml_word_idx = aml_basic_block->word_idx; aml_word_idx < aml_basic_block->terminating_instr_word_idx; ) {
+			HccAMLInstr* aml_instr = &callee->words[aml_word_idx];
+			if (HCC_AML_INSTR_OP(aml_instr) == HCC_AML_OP_LOOP_MERGE) {
+				merge_basic_block_idx = HCC_AML_OPERAND_AUX(HCC_AML_INSTR_OPERANDS(aml_instr)[0]);
+			}
+
+			aml_word_idx += HCC_AML_INSTR_WORDS_COUNT(aml_instr);
+		}
+		if (merge_basic_block_idx == UINT32_MAX) {
+			continue;
+		}
+
+		uint32_t mark = basic_block_idx + 1;
+		marks[basic_block_idx] = mark;
+		hcc_stack_clear(work);
+		*hcc_stack_push(work) = basic_block_idx;
+		while (hcc_stack_count(work)) {
+			HccAMLOptBasicBlock basic_block = {0};
+			basic_block.terminator_word_idx = callee->basic_blocks[*hcc_stack_get_last(work)].terminating_instr_word_idx;
+			hcc_stack_pop(work);
+			uint32_t successors_count = hcc_amlopt_basic_block_successors_count(callee, &basic_block);
+			for (uint32_t successor_idx = 0; successor_idx < successors_count; successor_idx += 1) {
+				uint32_t successor_basic_block_idx = hcc_amlopt_basic_block_successor(callee, &basic_block, successor_idx);
+				if (successor_basic_block_idx != merge_basic_block_idx && marks[successor_basic_block_idx] != mark) {
+					marks[successor_basic_block_idx] = mark;
+					*hcc_stack_push(work) = successor_basic_block_idx;
+				}
+			}
+		}
+	}
+
+	uint32_t returns_count = 0;
+	uint32_t basic_block_idx = 0;
+	for (uint32_t aml_word_idx = 0; aml_word_idx < callee->words_count; ) {
+		HccAMLInstr* aml_instr = &callee->words[aml_word_idx];
+		switch (HCC_AML_INSTR_OP(aml_instr)) {
+			case HCC_AML_OP_BASIC_BLOCK:
+				basic_block_idx = HCC_AML_OPERAND_AUX(HCC_AML_INSTR_OPERANDS(aml_instr)[0]);
+				break;
+			case HCC_AML_OP_RETURN:
+				HCC_DEBUG_ASSERT(HCC_AML_INSTR_OPERANDS_COUNT(aml_instr) == 1, "internal error: expected a return to have a single operand so it is the same size as the branch that replaces it");
+				if (marks[basic_block_idx]) {
+					return 0;
+				}
+				returns_count += 1;
+				break;
+		}
+
+		aml_word_idx += HCC_AML_INSTR_WORDS_COUNT(aml_instr);
+	}
+
+	return returns_count;
+}
+
+HccAMLOperand hcc_amlopt_inline_caller_operand(HccWorker* w, HccAMLOperand operand) {
+	switch (HCC_AML_OPERAND_TYPE(operand)) {
+		case HCC_AML_OPERAND_VALUE: {
+			HccAMLOperand replacement = w->amlopt.value_replacements[HCC_AML_OPERAND_AUX(operand)];
+			return replacement ? replacement : operand;
+		};
+		case HCC_AML_OPERAND_BASIC_BLOCK:
+			return HCC_AML_OPERAND(BASIC_BLOCK, w->amlopt.basic_blocks[HCC_AML_OPERAND_AUX(operand)].new_idx);
+		default:
+			return operand;
+	}
+}
+
+HccAMLOperand hcc_amlopt_inline_callee_operand(HccWorker* w, const HccAMLFunction* aml_function, HccAMLOptInlineSite* site, HccAMLOperand operand) {
+	switch (HCC_AML_OPERAND_TYPE(operand)) {
+		case HCC_AML_OPERAND_VALUE: {
+			uint32_t value_idx = HCC_AML_OPERAND_AUX(operand);
+			if (value_idx < site->callee->params_count) {
+				HccAMLOperand* call_aml_operands = HCC_AML_INSTR_OPERANDS(&aml_function->words[site->word_idx]);
+				return hcc_amlopt_inline_caller_operand(w, call_aml_operands[2 + value_idx]);
+			}
+			return HCC_AML_OPERAND(VALUE, site->values_start_idx + value_idx - site->callee->params_count);
+		};
+		case HCC_AML_OPERAND_BASIC_BLOCK:
+			return HCC_AML_OPERAND(BASIC_BLOCK, site->basic_blocks_start_idx + HCC_AML_OPERAND_AUX(operand));
+		case HCC_AML_OPERAND_BASIC_BLOCK_PARAM:
+			return HCC_AML_OPERAND(BASIC_BLOCK_PARAM, site->basic_block_params_start_idx + HCC_AML_OPERAND_AUX(operand));
+		default:
+			return operand;
+	}
+}
+
+void hcc_amlopt_inline_basic_block_add(HccAMLFunction* new_aml_function, uint32_t basic_block_idx, uint32_t params_start_idx, uint32_t params_count, uint32_t location_idx) {
+	HCC_DEBUG_ASSERT(basic_block_idx == new_aml_function->basic_blocks_count, "internal error: expected basic blocks to be added in the order they were laid out");
+	new_aml_function->basic_blocks_count += 1;
+
+	HccAMLBasicBlock* new_aml_basic_block = &new_aml_function->basic_blocks[basic_block_idx];
+	new_aml_basic_block->word_idx = new_aml_function->words_count;
+	new_aml_basic_block->terminating_instr_word_idx = UINT32_MAX;
+	new_aml_basic_block->params_start_idx = params_start_idx;
+	new_aml_basic_block->params_count = params_count;
+
+	HccAMLOperand* new_aml_operands = hcc_aml_function_instr_add(new_aml_function, location_idx, HCC_AML_OP_BASIC_BLOCK, 1);
+	new_aml_operands[0] = HCC_AML_OPERAND(BASIC_BLOCK, basic_block_idx);
+}
+
+HccAMLFunction* hcc_amlopt_inline_calls(HccWorker* w, const HccAMLFunction* aml_function) {
+	HccCU* cu = w->cu;
+	uint32_t instrs_limit = hcc_amlopt_inline_instrs_limits[aml_function->opt_level];
+	HccAMLOptBasicBlock* basic_blocks = hcc_amlopt_basic_blocks_init(w, aml_function);
+
+	hcc_stack_clear(w->amlopt.value_replacements);
+	HCC_ZERO_ELMT_MANY(hcc_stack_push_many(w->amlopt.value_replacements, aml_function->values_count), aml_function->values_count);
+
+	//
+	// pick out the calls to inline. a call in a loop header is left alone as splitting the basic block
+	// would move the loop merge away from where the loop's back edge branches to.
+	HccStack(HccAMLOptInlineSite) sites = w->amlopt.inline_sites;
+	hcc_stack_clear(sites);
+	uint32_t words_count = aml_function->words_count;
+	uint32_t values_count = aml_function->values_count;
+	uint32_t basic_blocks_count = aml_function->basic_blocks_count;
+	uint32_t basic_block_params_count = aml_function->basic_block_params_count;
+	uint32_t basic_block_param_srcs_count = aml_function->basic_block_param_srcs_count;
+	uint32_t basic_block_idx = 0;
+	for (uint32_t aml_word_idx = 0; aml_word_idx < aml_function->words_count; ) {
+		HccAMLInstr* aml_instr = &aml_function->words[aml_word_idx];
+		HccAMLOp aml_op = HCC_AML_INSTR_OP(aml_instr);
+		HccAMLOperand* aml_operands = HCC_AML_INSTR_OPERANDS(aml_instr);
+		uint32_t aml_words_count = HCC_AML_INSTR_WORDS_COUNT(aml_instr);
+		if (aml_op == HCC_AML_OP_BASIC_BLOCK) {
+			basic_block_idx = HCC_AML_OPERAND_AUX(aml_operands[0]);
+		}
+
+		HccAMLOptBasicBlock* basic_block = &basic_blocks[basic_block_idx];
+		if (aml_op != HCC_AML_OP_CALL || basic_block->is_loop_header || aml_word_idx > basic_block->terminator_word_idx || !HCC_DECL_IS_FUNCTION(aml_operands[1])) {
+			aml_word_idx += aml_words_count;
+			continue;
+		}
+
+		HccDecl callee_decl = aml_operands[1];
+		const HccAMLFunction* callee = HCC_DECL_AUX(callee_decl) < hcc_stack_count(cu->aml.inline_functions) ? cu->aml.inline_functions[HCC_DECL_AUX(callee_decl)] : NULL;
+		if (callee == NULL || callee->shader_stage != HCC_SHADER_STAGE_NONE) {
+			aml_word_idx += aml_words_count;
+			continue;
+		}
+
+		//
+		// functions marked inline are always inlined, the rest only when they are small enough for the optimization level
+		if (!hcc_ast_function_is_inline(hcc_ast_function_get(cu, callee_decl)) && hcc_amlopt_inline_instrs_count(callee) > instrs_limit) {
+			aml_word_idx += aml_words_count;
+			continue;
+		}
+
+		uint32_t returns_count = hcc_amlopt_inline_returns_count(w, callee);
+		if (returns_count == 0) {
+			aml_word_idx += aml_words_count;
+			continue;
+		}
+
+		//
+		// when the callee returns from more than one place, it is put in a loop that runs once
+		// so every return can become a break out of it to the rest of the caller.
+		bool is_wrapped = returns_count > 1;
+		HccDataType return_data_type = aml_function->values[HCC_AML_OPERAND_AUX(aml_operands[0])].data_type;
+		bool has_return_param = is_wrapped && return_data_type != HCC_DATA_TYPE_AML_INTRINSIC_VOID;
+		uint32_t site_words_count = callee->words_count - aml_words_count + 3 + 3 + (is_wrapped ? 16 : 0);
+		uint32_t site_basic_block_params_count = callee->basic_block_params_count + has_return_param;
+		uint32_t site_basic_block_param_srcs_count = callee->basic_block_param_srcs_count + (has_return_param ? returns_count : 0);
+		if (
+			words_count + site_words_count > HCC_AMLOPT_INLINE_FUNCTION_WORDS_CAP ||
+			basic_block_params_count + site_basic_block_params_count > UINT16_MAX ||
+			basic_block_param_srcs_count + site_basic_block_param_srcs_count > UINT16_MAX
+		) {
+			aml_word_idx += aml_words_count;
+			continue;
+		}
+
+		HccAMLOptInlineSite* site = hcc_stack_push(sites);
+		site->word_idx = aml_word_idx;
+		site->callee = callee;
+		site->values_start_idx = values_count;
+		site->basic_block_params_start_idx = basic_block_params_count;
+		site->basic_block_param_srcs_start_idx = basic_block_param_srcs_count;
+		site->return_param_idx = has_return_param ? basic_block_params_count + callee->basic_block_params_count : UINT32_MAX;
+		site->returns_count = returns_count;
+		words_count += site_words_count;
+		values_count += callee->values_count - callee->params_count;
+		basic_blocks_count += callee->basic_blocks_count + 1 + (is_wrapped ? 2 : 0);
+		basic_block_params_count += site_basic_block_params_count;
+		basic_block_param_srcs_count += site_basic_block_param_srcs_count;
+
+		//
+		// the result of the call becomes what the callee returns
+		if (has_return_param) {
+			w->amlopt.value_replacements[HCC_AML_OPERAND_AUX(aml_operands[0])] = HCC_AML_OPERAND(BASIC_BLOCK_PARAM, site->return_param_idx);
+		} else if (!is_wrapped && return_data_type != HCC_DATA_TYPE_AML_INTRINSIC_VOID) {
+			for (uint32_t callee_word_idx = 0; callee_word_idx < callee->words_count; callee_word_idx += HCC_AML_INSTR_WORDS_COUNT(&callee->words[callee_word_idx])) {
+				HccAMLInstr* callee_instr = &callee->words[callee_word_idx];
+				if (HCC_AML_INSTR_OP(callee_instr) == HCC_AML_OP_RETURN) {
+					w->amlopt.value_replacements[HCC_AML_OPERAND_AUX(aml_operands[0])] = hcc_amlopt_inline_callee_operand(w, aml_function, site, HCC_AML_INSTR_OPERANDS(callee_instr)[0]);
+				}
+			}
+		}
+
+		aml_word_idx += aml_words_count;
+	}
+
+	if (hcc_stack_count(sites) == 0) {
+		return NULL;
+	}
+
+	//
+	// lay out the basic blocks in the order they will be written so the indices keep going up through the function.
+	// the callee's basic blocks go between the two halves of the basic block the call was in.
+	uint32_t new_basic_block_idx = 0;
+	uint32_t site_idx = 0;
+	for (uint32_t aml_word_idx = 0; aml_word_idx < aml_function->words_count; ) {
+		HccAMLInstr* aml_instr = &aml_function->words[aml_word_idx];
+		if (HCC_AML_INSTR_OP(aml_instr) == HCC_AML_OP_BASIC_BLOCK) {
+			basic_block_idx = HCC_AML_OPERAND_AUX(HCC_AML_INSTR_OPERANDS(aml_instr)[0]);
+			basic_blocks[basic_block_idx].new_idx = new_basic_block_idx;
+			basic_blocks[basic_block_idx].exit_new_idx = new_basic_block_idx;
+			new_basic_block_idx += 1;
+		} else if (site_idx < hcc_stack_count(sites) && sites[site_idx].word_idx == aml_word_idx) {
+			HccAMLOptInlineSite* site = &sites[site_idx];
+			bool is_wrapped = site->returns_count > 1;
+			site->header_basic_block_idx = is_wrapped ? new_basic_block_idx++ : UINT32_MAX;
+			site->basic_blocks_start_idx = new_basic_block_idx;
+			new_basic_block_idx += site->callee->basic_blocks_count;
+			site->continue_basic_block_idx = is_wrapped ? new_basic_block_idx++ : UINT32_MAX;
+			site->return_basic_block_idx = new_basic_block_idx++;
+			basic_blocks[basic_block_idx].exit_new_idx = site->return_basic_block_idx;
+			site_idx += 1;
+		}
+
+		aml_word_idx += HCC_AML_INSTR_WORDS_COUNT(aml_instr);
+	}
+	HCC_DEBUG_ASSERT(new_basic_block_idx == basic_blocks_count, "internal error: expected to lay out '%u' basic blocks but got '%u'", basic_blocks_count, new_basic_block_idx);
+
+	//
+	// the words and basic blocks get appended as we go, everything else is written in place
+	HccAMLFunction* new_aml_function = hcc_amlopt_function_alloc(cu, aml_function, words_count, values_count, basic_blocks_count, basic_block_params_count, basic_block_param_srcs_count);
+	new_aml_function->words_count = 0;
+	new_aml_function->basic_blocks_count = 0;
+
+	HCC_COPY_ELMT_MANY(new_aml_function->values, aml_function->values, aml_function->values_count);
+	HCC_COPY_ELMT_MANY(new_aml_function->basic_block_params, aml_function->basic_block_params, aml_function->basic_block_params_count);
+	for (uint32_t src_idx = 0; src_idx < aml_function->basic_block_param_srcs_count; src_idx += 1) {
+		HccAMLBasicBlockParamSrc* src = &aml_function->basic_block_param_srcs[src_idx];
+		HccAMLBasicBlockParamSrc* new_src = &new_aml_function->basic_block_param_srcs[src_idx];
+		new_src->basic_block_operand = HCC_AML_OPERAND(BASIC_BLOCK, basic_blocks[HCC_AML_OPERAND_AUX(src->basic_block_operand)].exit_new_idx);
+		new_src->operand = hcc_amlopt_inline_caller_operand(w, src->operand);
+	}
+
+	for (site_idx = 0; site_idx < hcc_stack_count(sites); site_idx += 1) {
+		HccAMLOptInlineSite* site = &sites[site_idx];
+		const HccAMLFunction* callee = site->callee;
+		HCC_COPY_ELMT_MANY(&new_aml_function->values[site->values_start_idx], &callee->values[callee->params_count], callee->values_count - callee->params_count);
+		for (uint32_t param_idx = 0; param_idx < callee->basic_block_params_count; param_idx += 1) {
+			HccAMLBasicBlockParam* new_param = &new_aml_function->basic_block_params[site->basic_block_params_start_idx + param_idx];
+			*new_param = callee->basic_block_params[param_idx];
+			new_param->srcs_start_idx += site->basic_block_param_srcs_start_idx;
+		}
+		for (uint32_t src_idx = 0; src_idx < callee->basic_block_param_srcs_count; src_idx += 1) {
+			HccAMLBasicBlockParamSrc* src = &callee->basic_block_param_srcs[src_idx];
+			HccAMLBasicBlockParamSrc* new_src = &new_aml_function->basic_block_param_srcs[site->basic_block_param_srcs_start_idx + src_idx];
+			new_src->basic_block_operand = hcc_amlopt_inline_callee_operand(w, aml_function, site, src->basic_block_operand);
+			new_src->operand = hcc_amlopt_inline_callee_operand(w, aml_function, site, src->operand);
+		}
+		if (site->return_param_idx != UINT32_MAX) {
+			HccAMLBasicBlockParam* new_param = &new_aml_function->basic_block_params[site->return_param_idx];
+			new_param->data_type = aml_function->values[HCC_AML_OPERAND_AUX(HCC_AML_INSTR_OPERANDS(&aml_function->words[site->word_idx])[0])].data_type;
+			new_param->srcs_start_idx = site->basic_block_param_srcs_start_idx + callee->basic_block_param_srcs_count;
+			new_param->srcs_count = site->returns_count;
+		}
+	}
+
+	site_idx = 0;
+	for (uint32_t aml_word_idx = 0; aml_word_idx < aml_function->words_count; ) {
+		HccAMLInstr* aml_instr = &aml_function->words[aml_word_idx];
+		HccAMLOp aml_op = HCC_AML_INSTR_OP(aml_instr);
+		HccAMLOperand* aml_operands = HCC_AML_INSTR_OPERANDS(aml_instr);
+		uint32_t aml_operands_count = HCC_AML_INSTR_OPERANDS_COUNT(aml_instr);
+		uint32_t location_idx = HCC_AML_INSTR_LOCATION_IDX(aml_instr);
+		if (aml_op == HCC_AML_OP_BASIC_BLOCK) {
+			basic_block_idx = HCC_AML_OPERAND_AUX(aml_operands[0]);
+			HccAMLBasicBlock* aml_basic_block = &aml_function->basic_blocks[basic_block_idx];
+			hcc_amlopt_inline_basic_block_add(new_aml_function, basic_blocks[basic_block_idx].new_idx, aml_basic_block->params_start_idx, aml_basic_block->params_count, location_idx);
+
+			//
+			// the allocations of the callees go to the entry basic block with the caller's own
+			if (basic_block_idx == 0) {
+				for (uint32_t idx = 0; idx < hcc_stack_count(sites); idx += 1) {
+					HccAMLOptInlineSite* site = &sites[idx];
+					const HccAMLFunction* callee = site->callee;
+					for (uint32_t callee_word_idx = 0; callee_word_idx < callee->words_count; callee_word_idx += HCC_AML_INSTR_WORDS_COUNT(&callee->words[callee_word_idx])) {
+						HccAMLInstr* callee_instr = &callee->words[callee_word_idx];
+						if (HCC_AML_INSTR_OP(callee_instr) == HCC_AML_OP_PTR_STATIC_ALLOC) {
+							HccAMLOperand* callee_operands = HCC_AML_INSTR_OPERANDS(callee_instr);
+							HccAMLOperand* new_aml_operands = hcc_aml_function_instr_add(new_aml_function, HCC_AML_INSTR_LOCATION_IDX(&aml_function->words[site->word_idx]), HCC_AML_OP_PTR_STATIC_ALLOC, 2);
+							new_aml_operands[0] = hcc_amlopt_inline_callee_operand(w, aml_function, site, callee_operands[0]);
+							new_aml_operands[1] = callee_operands[1];
+						}
+					}
+				}
+			}
+
+			aml_word_idx += HCC_AML_INSTR_WORDS_COUNT(aml_instr);
+			continue;
+		}
+
+		if (site_idx < hcc_stack_count(sites) && sites[site_idx].word_idx == aml_word_idx) {
+			//
+			// the callee's instructions take the location of the call, that way the function cache can still refer to them
+			HccAMLOptInlineSite* site = &sites[site_idx];
+			const HccAMLFunction* callee = site->callee;
+			HccAMLOperand* new_aml_operands = hcc_aml_function_instr_add(new_aml_function, location_idx, HCC_AML_OP_BRANCH, 1);
+			new_aml_operands[0] = HCC_AML_OPERAND(BASIC_BLOCK, site->header_basic_block_idx != UINT32_MAX ? site->header_basic_block_idx : site->basic_blocks_start_idx);
+
+			if (site->header_basic_block_idx != UINT32_MAX) {
+				hcc_amlopt_inline_basic_block_add(new_aml_function, site->header_basic_block_idx, 0, 0, location_idx);
+				new_aml_operands = hcc_aml_function_instr_add(new_aml_function, location_idx, HCC_AML_OP_LOOP_MERGE, 2);
+				new_aml_operands[0] = HCC_AML_OPERAND(BASIC_BLOCK, site->return_basic_block_idx);
+				new_aml_operands[1] = HCC_AML_OPERAND(BASIC_BLOCK, site->continue_basic_block_idx);
+				new_aml_operands = hcc_aml_function_instr_add(new_aml_function, location_idx, HCC_AML_OP_BRANCH, 1);
+				new_aml_operands[0] = HCC_AML_OPERAND(BASIC_BLOCK, site->basic_blocks_start_idx);
+			}
+
+			uint32_t return_src_idx = site->basic_block_param_srcs_start_idx + callee->basic_block_param_srcs_count;
+			uint32_t callee_basic_block_idx = 0;
+			for (uint32_t callee_word_idx = 0; callee_word_idx < callee->words_count; ) {
+				HccAMLInstr* callee_instr = &callee->words[callee_word_idx];
+				HccAMLOp callee_op = HCC_AML_INSTR_OP(callee_instr);
+				HccAMLOperand* callee_operands = HCC_AML_INSTR_OPERANDS(callee_instr);
+				uint32_t callee_operands_count = HCC_AML_INSTR_OPERANDS_COUNT(callee_instr);
+				switch (callee_op) {
+					case HCC_AML_OP_BASIC_BLOCK: {
+						callee_basic_block_idx = HCC_AML_OPERAND_AUX(callee_operands[0]);
+						HccAMLBasicBlock* callee_basic_block = &callee->basic_blocks[callee_basic_block_idx];
+						hcc_amlopt_inline_basic_block_add(new_aml_function, site->basic_blocks_start_idx + callee_basic_block_idx, site->basic_block_params_start_idx + callee_basic_block->params_start_idx, callee_basic_block->params_count, location_idx);
+						break;
+					};
+					case HCC_AML_OP_PTR_STATIC_ALLOC:
+						break;
+					case HCC_AML_OP_RETURN: {
+						new_aml_operands = hcc_aml_function_instr_add(new_aml_function, location_idx, HCC_AML_OP_BRANCH, 1);
+						new_aml_operands[0] = HCC_AML_OPERAND(BASIC_BLOCK, site->return_basic_block_idx);
+						if (site->return_param_idx != UINT32_MAX) {
+							HccAMLBasicBlockParamSrc* new_src = &new_aml_function->basic_block_param_srcs[return_src_idx];
+							new_src->basic_block_operand = HCC_AML_OPERAND(BASIC_BLOCK, site->basic_blocks_start_idx + callee_basic_block_idx);
+							new_src->operand = hcc_amlopt_inline_callee_operand(w, aml_function, site, callee_operands[0]);
+							return_src_idx += 1;
+						}
+						break;
+					};
+					default: {
+						uint32_t new_word_idx = new_aml_function->words_count;
+						new_aml_operands = hcc_aml_function_instr_add(new_aml_function, location_idx, callee_op, callee_operands_count);
+						for (uint32_t operand_idx = 0; operand_idx < callee_operands_count; operand_idx += 1) {
+							new_aml_operands[operand_idx] = callee_op == HCC_AML_OP_SHUFFLE && operand_idx >= 3
+								? callee_operands[operand_idx]
+								: hcc_amlopt_inline_callee_operand(w, aml_function, site, callee_operands[operand_idx]);
+						}
+						if (callee_word_idx == callee->basic_blocks[callee_basic_block_idx].terminating_instr_word_idx) {
+							new_aml_function->basic_blocks[new_aml_function->basic_blocks_count - 1].terminating_instr_word_idx = new_word_idx;
+						}
+						break;
+					};
+				}
+
+				callee_word_idx += HCC_AML_INSTR_WORDS_COUNT(callee_instr);
+			}
+
+			if (site->continue_basic_block_idx != UINT32_MAX) {
+				hcc_amlopt_inline_basic_block_add(new_aml_function, site->continue_basic_block_idx, 0, 0, location_idx);
+				new_aml_operands = hcc_aml_function_instr_add(new_aml_function, location_idx, HCC_AML_OP_BRANCH, 1);
+				new_aml_operands[0] = HCC_AML_OPERAND(BASIC_BLOCK, site->header_basic_block_idx);
+			}
+
+			bool has_return_param = site->return_param_idx != UINT32_MAX;
+			hcc_amlopt_inline_basic_block_add(new_aml_function, site->return_basic_block_idx, has_return_param ? site->return_param_idx : 0, has_return_param, location_idx);
+
+			site_idx += 1;
+			aml_word_idx += HCC_AML_INSTR_WORDS_COUNT(aml_instr);
+			continue;
+		}
+
+		uint32_t new_word_idx = new_aml_function->words_count;
+		HccAMLOperand* new_aml_operands = hcc_aml_function_instr_add(new_aml_function, location_idx, aml_op, aml_operands_count);
+		for (uint32_t operand_idx = 0; operand_idx < aml_operands_count; operand_idx += 1) {
+			new_aml_operands[operand_idx] = aml_op == HCC_AML_OP_SHUFFLE && operand_idx >= 3
+				? aml_operands[operand_idx]
+				: hcc_amlopt_inline_caller_operand(w, aml_operands[operand_idx]);
+		}
+		if (aml_word_idx == aml_function->basic_blocks[basic_block_idx].terminating_instr_word_idx) {
+			new_aml_function->basic_blocks[new_aml_function->basic_blocks_count - 1].terminating_instr_word_idx = new_word_idx;
+		}
+
+		aml_word_idx += HCC_AML_INSTR_WORDS_COUNT(aml_instr);
+	}
+	HCC_DEBUG_ASSERT(new_aml_function->words_count == words_count, "internal error: expected to write '%u' words but wrote '%u'", words_count, new_aml_function->words_count);
+	HCC_DEBUG_ASSERT(new_aml_function->basic_blocks_count == basic_blocks_count, "internal error: expected to write '%u' basic blocks but wrote '%u'", basic_blocks_count, new_aml_function->basic_blocks_count);
+
+	return new_aml_function;
+}
+
+const HccAMLFunction* hcc_amlopt_inline(HccWorker* w, HccDecl function_decl, const HccAMLFunction* aml_function) {
+	HCC_UNUSED(function_decl);
+	HccCU* cu = w->cu;
+
+	//
+	// the callees are copied as they were before they got their own calls inlined,
+	// so keep going over the new calls that come in with them. there is no recursion so this ends
+	// once it reaches the bottom of the call graph.
+	const HccAMLFunction* src_aml_function = aml_function;
+	for (uint32_t depth = 0; depth < HCC_FUNCTION_CALL_STACK_CAP; depth += 1) {
+		HccAMLFunction* new_aml_function = hcc_amlopt_inline_calls(w, aml_function);
+		if (new_aml_function == NULL) {
+			break;
+		}
+
+		if (aml_function != src_aml_function) {
+			hcc_aml_function_alctor_dealloc(cu, (HccAMLFunction*)aml_function);
+		}
+		aml_function = new_aml_function;
+	}
+
+	return aml_function;
+}
+
+HccAMLOptPass hcc_amlopt_pass(HccAMLOptFn optimize_fn) {
+	for (HccAMLOptPass pass = 0; pass < HCC_AML_OPT_PASS_COUNT; pass += 1) {
+		if (hcc_aml_opt_pass_fns[pass] == optimize_fn) {
+			return pass;
+		}
+	}
+
+	HCC_UNREACHABLE("optimization function is missing from hcc_aml_opt_pass_fns");
+}
+
+void hcc_amlopt_pass_stats_add(HccAMLOptPassStats* dst, const HccAMLOptPassStats* src) {
+	dst->duration = hcc_duration_add(dst->duration, src->duration);
+	dst->runs_count += src->runs_count;
+	dst->words_count_before += src->words_count_before;
+	dst->words_count_after += src->words_count_after;
+	dst->values_count_before += src->values_count_before;
+	dst->values_count_after += src->values_count_after;
+	dst->basic_blocks_count_before += src->basic_blocks_count_before;
+	dst->basic_blocks_count_after += src->basic_blocks_count_after;
+}
+
+void hcc_amlopt_optimize(HccWorker* w) {
+	HccCU* cu = w->cu;
+	HccDecl function_decl = (HccDecl)(uintptr_t)w->job.arg;
+	HccAMLFunction* aml_function = hcc_aml_function_take_ref(cu, function_decl);
+	HccAtomic(HccAMLFunction*)* dst_aml_function = hcc_stack_get(cu->aml.functions, HCC_DECL_AUX(function_decl));
+
+	HccAMLOptFn* opts = hcc_aml_opts[cu->aml.opt_phase][aml_function->opt_level];
+	uint32_t opts_count = hcc_aml_opts_count[cu->aml.opt_phase][aml_function->opt_level];
+
+	//
+	// collect the stats for this function locally so the task's copy is only locked once
+	HccAMLOptPassStats pass_stats[HCC_AML_OPT_PASS_COUNT];
+	HCC_ZERO_ARRAY(pass_stats);
+
+	for (uint32_t opt_idx = 0; opt_idx < opts_count; opt_idx += 1) {
+		HccAMLOptFn optimize_fn = opts[opt_idx];
+		HccAMLOptPassStats* stats = &pass_stats[hcc_amlopt_pass(optimize_fn)];
+		stats->runs_count += 1;
+		stats->words_count_before += aml_function->words_count;
+		stats->values_count_before += aml_function->values_count;
+		stats->basic_blocks_count_before += aml_function->basic_blocks_count;
+		HccTime start_time = hcc_time_now(HCC_TIME_MODE_MONOTONIC);
+
+		HccAMLFunction* new_aml_function = (HccAMLFunction*)optimize_fn(w, function_decl, aml_function);
+
+		stats->duration = hcc_duration_add(stats->duration, hcc_time_elapsed(start_time, HCC_TIME_MODE_MONOTONIC));
+		stats->words_count_after += new_aml_function->words_count;
+		stats->values_count_after += new_aml_function->values_count;
+		stats->basic_blocks_count_after += new_aml_function->basic_blocks_count;
+
+		if (aml_function != new_aml_function) {
+			//
+			// optimization made a new function, so lets:
+			// - store the new function in the array of functions
+			// - return the old function references (ours and the array of functions) and potentially deallocate it.
+			new_aml_function->ref_count = 2; // one for the array of functions and one for us
+			atomic_store(dst_aml_function, new_aml_function);
+
+			aml_function->can_free = true;
+			hcc_aml_function_return_ref(cu, aml_function);
+			hcc_aml_function_return_ref(cu, aml_function);
+		}
+
+		aml_function = new_aml_function;
+	}
+
+	hcc_aml_function_return_ref(cu, aml_function);
+
+	HccTask* t = hcc_worker_task(w);
+	hcc_spin_mutex_lock(&t->aml_opt_pass_stats_mutex);
+	for (HccAMLOptPass pass = 0; pass < HCC_AML_OPT_PASS_COUNT; pass += 1) {
+		if (pass_stats[pass].runs_count) {
+			hcc_amlopt_pass_stats_add(&t->aml_opt_pass_stats[pass], &pass_stats[pass]);
+		}
+	}
+	hcc_spin_mutex_unlock(&t->aml_opt_pass_stats_mutex);
 }
 
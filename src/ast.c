@@ -428,10 +428,14 @@ void hcc_ast_file_reset(HccASTFile* file) {
 	hcc_ata_token_bag_reset(&file->token_bag);
 }
 
-HccResult hcc_ast_file_push_token(HccASTFile* file, HccATAToken token, HccLocation* location) {
+HccResult hcc_ast_file_push_token(HccCU* cu, HccASTFile* file, HccATAToken token, HccLocation* location) {
 	HCC_SET_BAIL_JMP_LOC_GLOBAL();
 
-	hcc_ata_token_bag_push_token(&file->token_bag, token, location);
+	//
+	// the token bag only holds location ids, so copy the callers location into the location table
+	HccLocation* dst_location = hcc_location_table_alloc(cu);
+	*dst_location = *location;
+	hcc_ata_token_bag_push_token(&file->token_bag, token, hcc_location_table_id(cu, dst_location));
 
 	hcc_clear_bail_jmp_loc();
 	return HCC_RESULT_SUCCESS;
@@ -460,17 +464,24 @@ void hcc_ast_file_init(HccASTFile* file, HccCU* cu, HccASTFileSetup* setup, HccS
 	hcc_ata_token_bag_init(&file->token_bag, setup->tokens_grow_count, setup->tokens_reserve_cap, setup->values_grow_count, setup->values_reserve_cap);
 	hcc_ata_token_bag_init(&file->macro_token_bag, setup->tokens_grow_count, setup->tokens_reserve_cap, setup->values_grow_count, setup->values_reserve_cap);
 
-	file->global_declarations = hcc_hash_table_init(HccDeclEntry, HCC_ALLOC_TAG_AST_FILE_GLOBAL_DECLARATIONS, hcc_u32_key_cmp, hcc_u32_key_hash, cu->global_declarations_cap);
-	file->struct_declarations = hcc_hash_table_init(HccDeclEntry, HCC_ALLOC_TAG_AST_FILE_STRUCT_DECLARATIONS, hcc_u32_key_cmp, hcc_u32_key_hash, cu->compounds_cap);
-	file->union_declarations = hcc_hash_table_init(HccDeclEntry, HCC_ALLOC_TAG_AST_FILE_UNION_DECLARATIONS, hcc_u32_key_cmp, hcc_u32_key_hash, cu->compounds_cap);
-	file->enum_declarations = hcc_hash_table_init(HccDeclEntry, HCC_ALLOC_TAG_AST_FILE_ENUM_DECLARATIONS, hcc_u32_key_cmp, hcc_u32_key_hash, cu->enums_cap);
+	file->global_declarations = hcc_hash_table_init(HccDeclEntry, HCC_ALLOC_TAG_AST_FILE_GLOBAL_DECLARATIONS, hcc_u32_key_cmp, hcc_u32_key_hash, HCC_AST_FILE_GLOBAL_DECLARATIONS_INITIAL_CAP);
+	file->struct_declarations = hcc_hash_table_init(HccDeclEntry, HCC_ALLOC_TAG_AST_FILE_STRUCT_DECLARATIONS, hcc_u32_key_cmp, hcc_u32_key_hash, HCC_AST_FILE_COMPOUND_DECLARATIONS_INITIAL_CAP);
+	file->union_declarations = hcc_hash_table_init(HccDeclEntry, HCC_ALLOC_TAG_AST_FILE_UNION_DECLARATIONS, hcc_u32_key_cmp, hcc_u32_key_hash, HCC_AST_FILE_COMPOUND_DECLARATIONS_INITIAL_CAP);
+	file->enum_declarations = hcc_hash_table_init(HccDeclEntry, HCC_ALLOC_TAG_AST_FILE_ENUM_DECLARATIONS, hcc_u32_key_cmp, hcc_u32_key_hash, HCC_AST_FILE_ENUM_DECLARATIONS_INITIAL_CAP);
 }
 
 void hcc_ast_file_deinit(HccASTFile* file) {
 	hcc_stack_deinit(file->macros);
 	hcc_stack_deinit(file->macro_params);
+	hcc_stack_deinit(file->pragma_onced_files);
+	hcc_stack_deinit(file->unique_included_files);
+	hcc_stack_deinit(file->forward_declarations_to_link);
 	hcc_ata_token_bag_deinit(&file->token_bag);
 	hcc_ata_token_bag_deinit(&file->macro_token_bag);
+	hcc_hash_table_deinit(file->global_declarations);
+	hcc_hash_table_deinit(file->struct_declarations);
+	hcc_hash_table_deinit(file->union_declarations);
+	hcc_hash_table_deinit(file->enum_declarations);
 }
 
 bool hcc_ast_file_has_been_pragma_onced(HccASTFile* file, HccStringId path_string_id) {
@@ -515,6 +526,19 @@ void hcc_ast_init(HccCU* cu, HccCUSetup* setup) {
 	cu->ast.global_variables = hcc_stack_init(HccASTVariable, HCC_ALLOC_TAG_AST_GLOBAL_VARIBALES, setup->ast.global_variables_grow_count, setup->ast.global_variables_reserve_cap);
 	cu->ast.forward_declarations = hcc_stack_init(HccASTForwardDecl, HCC_ALLOC_TAG_AST_FORWARD_DECLARTIONS, setup->ast.forward_declarations_grow_count, setup->ast.forward_declarations_reserve_cap);
 	cu->ast.designated_initializer_elmt_indices = hcc_stack_init(uint64_t, HCC_ALLOC_TAG_AST_DESIGNATED_INITIALIZER_ELMT_INDICES, setup->ast.designated_initializer_elmt_indices_grow_count, setup->ast.designated_initializer_elmt_indices_reserve_cap);
+	cu->ast.link_deferred_files = hcc_stack_init(HccASTFile*, HCC_ALLOC_TAG_AST_LINK_DEFERRED_FILES, setup->ast.files_cap, setup->ast.files_cap);
+	hcc_spin_mutex_init(&cu->ast.link_deferred_files_mutex);
+
+	HccASTFileSetup* file_setup = &setup->ast.file_setup;
+	cu->ast.pchs_hash_table = hcc_hash_table_init(HccPCHEntry, HCC_ALLOC_TAG_AST_PCHS_HASH_TABLE, hcc_u64_key_cmp, hcc_u64_key_hash, setup->ast.pchs_cap);
+	cu->ast.pchs = hcc_stack_init(HccPCH, HCC_ALLOC_TAG_AST_PCHS, setup->ast.pchs_cap, setup->ast.pchs_cap);
+	hcc_ata_token_bag_init(&cu->ast.pch_token_bag, file_setup->tokens_grow_count, file_setup->tokens_reserve_cap, file_setup->values_grow_count, file_setup->values_reserve_cap);
+	hcc_ata_token_bag_init(&cu->ast.pch_macro_token_bag, file_setup->tokens_grow_count, file_setup->tokens_reserve_cap, file_setup->values_grow_count, file_setup->values_reserve_cap);
+	cu->ast.pch_macros = hcc_stack_init(HccPPMacro, HCC_ALLOC_TAG_AST_PCH_MACROS, file_setup->macros_grow_count, file_setup->macros_reserve_cap);
+	cu->ast.pch_macro_params = hcc_stack_init(HccStringId, HCC_ALLOC_TAG_AST_PCH_MACRO_PARAMS, file_setup->macro_params_grow_count, file_setup->macro_params_reserve_cap);
+	cu->ast.pch_files = hcc_stack_init(HccStringId, HCC_ALLOC_TAG_AST_PCH_FILES, setup->ast.pch_files_grow_count, setup->ast.pch_files_reserve_cap);
+	hcc_spin_mutex_init(&cu->ast.pchs_mutex);
+	cu->ast.binary_code_files = hcc_stack_init(HccCodeFile, HCC_ALLOC_TAG_AST_BINARY_CODE_FILES, setup->ast.binary_code_files_cap, setup->ast.binary_code_files_cap);
 
 	//
 	// preallocate all the intrinsic functions
@@ -534,6 +558,20 @@ void hcc_ast_deinit(HccCU* cu) {
 	hcc_stack_deinit(cu->ast.functions);
 	hcc_stack_deinit(cu->ast.exprs);
 	hcc_stack_deinit(cu->ast.global_variables);
+	hcc_stack_deinit(cu->ast.forward_declarations);
+	hcc_stack_deinit(cu->ast.designated_initializer_elmt_indices);
+	hcc_stack_deinit(cu->ast.link_deferred_files);
+	hcc_hash_table_deinit(cu->ast.pchs_hash_table);
+	hcc_stack_deinit(cu->ast.pchs);
+	hcc_ata_token_bag_deinit(&cu->ast.pch_token_bag);
+	hcc_ata_token_bag_deinit(&cu->ast.pch_macro_token_bag);
+	hcc_stack_deinit(cu->ast.pch_macros);
+	hcc_stack_deinit(cu->ast.pch_macro_params);
+	hcc_stack_deinit(cu->ast.pch_files);
+	for (uint32_t idx = 0; idx < hcc_stack_count(cu->ast.binary_code_files); idx += 1) {
+		hcc_code_file_deinit(&cu->ast.binary_code_files[idx]);
+	}
+	hcc_stack_deinit(cu->ast.binary_code_files);
 }
 
 void hcc_ast_add_file(HccCU* cu, HccString file_path, HccASTFile** out) {
@@ -544,7 +582,7 @@ void hcc_ast_add_file(HccCU* cu, HccString file_path, HccASTFile** out) {
 	*out = ast_file;
 	hcc_ast_file_init(*out, cu, &cu->ast.file_setup, file_path);
 
-	*hcc_stack_push(cu->ast.files) = ast_file;
+	*hcc_stack_push_thread_safe(cu->ast.files) = ast_file;
 }
 
 HccASTFile* hcc_ast_find_file(HccCU* cu, HccString file_path) {
@@ -895,6 +933,11 @@ void hcc_ast_print(HccCU* cu, HccIIO* iio) {
 			continue;
 		}
 		HccASTFile* file = &entry->file;
+		if (hcc_stack_count(file->token_bag.tokens) == 0) {
+			//
+			// files loaded from an AST binary have no tokens
+			continue;
+		}
 		hcc_ast_print_section_header("Tokens", file->path.data, iio);
 
 		HccATAIter* iter = hcc_ata_iter_start(file);
@@ -905,7 +948,7 @@ void hcc_ast_print(HccCU* cu, HccIIO* iio) {
 		HccCodeFile* code_file = NULL;
 		const char* file_path_preview;
 		while (token != HCC_ATA_TOKEN_EOF) {
-			HccLocation* location = hcc_ata_iter_location(iter);
+			HccLocation* location = hcc_ata_iter_location(cu, iter);
 			while (location->parent_location) {
 				location = location->parent_location;
 			}
@@ -1227,3 +1270,1283 @@ CONSTANT: {}
 	hcc_iio_write_fmt(iio, "\n");
 }
 
+
+// ===========================================
+//
+//
+// AST Binary
+//
+//
+// ===========================================
+
+uint32_t hcc_ast_binary_section_elmt_sizes[HCC_AST_BINARY_SECTION_COUNT] = {
+	[HCC_AST_BINARY_SECTION_STRINGS] =                             sizeof(HccASTBinaryString),
+	[HCC_AST_BINARY_SECTION_STRING_DATA] =                         sizeof(char),
+	[HCC_AST_BINARY_SECTION_CODE_FILES] =                          sizeof(HccASTBinaryCodeFile),
+	[HCC_AST_BINARY_SECTION_LOCATIONS] =                           sizeof(HccASTBinaryLocation),
+	[HCC_AST_BINARY_SECTION_FILES] =                               sizeof(HccASTBinaryFile),
+	[HCC_AST_BINARY_SECTION_FILE_DEPENDENCIES] =                   sizeof(uint32_t),
+	[HCC_AST_BINARY_SECTION_FILE_DECLS] =                          sizeof(HccASTBinaryFileDecl),
+	[HCC_AST_BINARY_SECTION_CONSTANTS] =                           sizeof(HccASTBinaryConstant),
+	[HCC_AST_BINARY_SECTION_CONSTANT_DATA] =                       sizeof(uint8_t),
+	[HCC_AST_BINARY_SECTION_ARRAYS] =                              sizeof(HccArrayDataType),
+	[HCC_AST_BINARY_SECTION_COMPOUNDS] =                           sizeof(HccCompoundDataType),
+	[HCC_AST_BINARY_SECTION_COMPOUND_FIELDS] =                     sizeof(HccCompoundField),
+	[HCC_AST_BINARY_SECTION_TYPEDEFS] =                            sizeof(HccTypedef),
+	[HCC_AST_BINARY_SECTION_ENUMS] =                               sizeof(HccEnumDataType),
+	[HCC_AST_BINARY_SECTION_ENUM_VALUES] =                         sizeof(HccEnumValue),
+	[HCC_AST_BINARY_SECTION_POINTERS] =                            sizeof(HccPointerDataType),
+	[HCC_AST_BINARY_SECTION_FUNCTION_DATA_TYPES] =                 sizeof(HccFunctionDataType),
+	[HCC_AST_BINARY_SECTION_FUNCTION_DATA_TYPE_PARAMS] =           sizeof(HccDataType),
+	[HCC_AST_BINARY_SECTION_BUFFERS] =                             sizeof(HccBufferDataType),
+	[HCC_AST_BINARY_SECTION_FUNCTION_PARAMS_AND_VARIABLES] =       sizeof(HccASTVariable),
+	[HCC_AST_BINARY_SECTION_FUNCTIONS] =                           sizeof(HccASTFunction),
+	[HCC_AST_BINARY_SECTION_FUNCTION_IDXS] =                       sizeof(uint32_t),
+	[HCC_AST_BINARY_SECTION_EXPRS] =                               sizeof(HccASTExpr),
+	[HCC_AST_BINARY_SECTION_GLOBAL_VARIABLES] =                    sizeof(HccASTVariable),
+	[HCC_AST_BINARY_SECTION_FORWARD_DECLARATIONS] =                sizeof(HccASTForwardDecl),
+	[HCC_AST_BINARY_SECTION_DESIGNATED_INITIALIZER_ELMT_INDICES] = sizeof(uint64_t),
+	[HCC_AST_BINARY_SECTION_SHADER_FUNCTION_DECLS] =               sizeof(HccDecl),
+	[HCC_AST_BINARY_SECTION_RESOURCE_STRUCTS] =                    sizeof(HccDataType),
+	[HCC_AST_BINARY_SECTION_AML_FUNCTIONS] =                       sizeof(HccASTBinaryAMLFunction),
+	[HCC_AST_BINARY_SECTION_AML_FUNCTION_IDXS] =                   sizeof(uint32_t),
+	[HCC_AST_BINARY_SECTION_AML_WORDS] =                           sizeof(HccAMLWord),
+	[HCC_AST_BINARY_SECTION_AML_VALUES] =                          sizeof(HccAMLValue),
+	[HCC_AST_BINARY_SECTION_AML_BASIC_BLOCKS] =                    sizeof(HccAMLBasicBlock),
+	[HCC_AST_BINARY_SECTION_AML_BASIC_BLOCK_PARAMS] =              sizeof(HccAMLBasicBlockParam),
+	[HCC_AST_BINARY_SECTION_AML_BASIC_BLOCK_PARAM_SRCS] =          sizeof(HccAMLBasicBlockParamSrc),
+	[HCC_AST_BINARY_SECTION_AML_LOCATIONS] =                       sizeof(uint32_t),
+	[HCC_AST_BINARY_SECTION_AML_CALL_GRAPH_NODES] =                sizeof(HccAMLCallNode),
+	[HCC_AST_BINARY_SECTION_AML_FUNCTION_CALL_NODE_LISTS] =        sizeof(uint32_t),
+	[HCC_AST_BINARY_SECTION_AML_OPTIMIZE_FUNCTIONS] =              sizeof(HccDecl),
+};
+
+HccHash64 hcc_ast_binary_layout_hash(void) {
+	//
+	// the records are the in memory structures, so a binary from a build with a different layout must not be loaded
+	uint32_t values[] = {
+		HCC_AST_BINARY_VERSION,
+		sizeof(HccASTBinaryHeader),
+		HCC_STRING_ID_USER_START,
+		HCC_FUNCTION_IDX_USER_START,
+		HCC_COMPOUND_DATA_TYPE_IDX_USER_START,
+		HCC_AML_OP_COUNT,
+	};
+
+	HccHash64 hash = HCC_HASH_WY_64_INIT;
+	hash = hcc_hash_wy_64(values, sizeof(values), hash);
+	hash = hcc_hash_wy_64(hcc_ast_binary_section_elmt_sizes, sizeof(hcc_ast_binary_section_elmt_sizes), hash);
+	return hash;
+}
+
+uintptr_t hcc_ast_binary_ptr_idx_plus_one(void* ptr, void* base, uintptr_t count, uintptr_t elmt_size) {
+	//
+	// pointers that are outside of the array, like ones left pointing at worker scratch memory
+	// for an empty list, have no meaning to the reader so they are stored as NULL.
+	if (ptr < base || ptr > HCC_PTR_ADD(base, count * elmt_size)) {
+		return 0;
+	}
+
+	return (HCC_PTR_DIFF(ptr, base) / elmt_size) + 1;
+}
+
+#define HCC_AST_BINARY_SWIZZLE(ptr, stack) ((void*)hcc_ast_binary_ptr_idx_plus_one(ptr, stack, hcc_stack_count(stack), sizeof(*(stack))))
+#define HCC_AST_BINARY_UNSWIZZLE(ptr, base) ((uintptr_t)(ptr) ? &(base)[(uintptr_t)(ptr) - 1] : NULL)
+
+void* hcc_ast_binary_write_section_begin(HccASTBinaryWriter* w, HccASTBinarySection section) {
+	uintptr_t offset = hcc_stack_count(w->out);
+	uintptr_t aligned_offset = HCC_INT_ROUND_UP_ALIGN(offset, 8);
+	hcc_stack_push_many(w->out, aligned_offset - offset);
+
+	w->header->sections[section].offset = aligned_offset;
+	w->header->sections[section].count = 0;
+	return &w->out[aligned_offset];
+}
+
+void* hcc_ast_binary_write_section_push(HccASTBinaryWriter* w, HccASTBinarySection section, uintptr_t count) {
+	w->header->sections[section].count += count;
+	return hcc_stack_push_many(w->out, count * hcc_ast_binary_section_elmt_sizes[section]);
+}
+
+void* hcc_ast_binary_write_section(HccASTBinaryWriter* w, HccASTBinarySection section, void* elmts, uintptr_t count) {
+	void* dst = hcc_ast_binary_write_section_begin(w, section);
+	hcc_ast_binary_write_section_push(w, section, count);
+	memcpy(dst, elmts, count * hcc_ast_binary_section_elmt_sizes[section]);
+	return dst;
+}
+
+uint32_t hcc_ast_binary_write_string(HccASTBinaryWriter* w, HccStringId string_id) {
+	if (string_id.idx_plus_one >= hcc_stack_count(w->string_idx_plus_ones)) {
+		hcc_stack_resize(w->string_idx_plus_ones, string_id.idx_plus_one + 1);
+	}
+
+	uint32_t* string_idx_plus_one = &w->string_idx_plus_ones[string_id.idx_plus_one];
+	if (*string_idx_plus_one) {
+		return *string_idx_plus_one - 1;
+	}
+
+	HccString string = hcc_string_table_get(string_id);
+	HccASTBinaryString* dst = hcc_stack_push(w->strings);
+	dst->data_offset = hcc_stack_count(w->string_data);
+	dst->size = string.size;
+	char* dst_data = hcc_stack_push_many(w->string_data, string.size + 1);
+	memcpy(dst_data, string.data, string.size);
+	dst_data[string.size] = '\0';
+
+	*string_idx_plus_one = hcc_stack_count(w->strings);
+	return *string_idx_plus_one - 1;
+}
+
+uint32_t hcc_ast_binary_write_path_string(HccASTBinaryWriter* w, HccString path) {
+	HccStringId path_string_id;
+	hcc_string_table_deduplicate(path.data, path.size, &path_string_id);
+	return hcc_ast_binary_write_string(w, path_string_id);
+}
+
+HccStringId hcc_ast_binary_write_string_id(HccASTBinaryWriter* w, HccStringId string_id) {
+	if (string_id.idx_plus_one < HCC_STRING_ID_USER_START) {
+		return string_id;
+	}
+
+	return HccStringId(HCC_STRING_ID_USER_START + hcc_ast_binary_write_string(w, string_id));
+}
+
+uint32_t hcc_ast_binary_write_code_file(HccASTBinaryWriter* w, HccCodeFile* code_file) {
+	uint64_t key = (uintptr_t)code_file;
+	HccHashTableInsert insert = hcc_hash_table_find_insert_idx(w->ptr_to_idx_hash_table, &key);
+	HccASTBinaryPtrEntry* entry = &w->ptr_to_idx_hash_table[insert.idx];
+	if (!insert.is_new) {
+		return entry->idx;
+	}
+
+	//
+	// only code files from the code file cache or ones loaded from an AST binary can be found again by the reader,
+	// the concatenation buffers are worker scratch memory.
+	entry->idx = UINT32_MAX;
+	HccStack(HccCodeFile) binary_code_files = w->cu->ast.binary_code_files;
+	bool is_binary_code_file = code_file >= binary_code_files && code_file < &binary_code_files[hcc_stack_count(binary_code_files)];
+	if (is_binary_code_file || hcc_code_file_find(code_file->path_string) == code_file) {
+		HccASTBinaryCodeFile* dst = hcc_stack_push(w->code_files);
+		dst->path_string_idx = hcc_ast_binary_write_path_string(w, code_file->path_string);
+		dst->code_size = code_file->code.size;
+		dst->code_hash = code_file->code_hash;
+		entry->idx = hcc_stack_count(w->code_files) - 1;
+	}
+
+	return entry->idx;
+}
+
+void* hcc_ast_binary_write_location(HccASTBinaryWriter* w, HccLocation* location) {
+	while (location) {
+		uint64_t key = (uintptr_t)location;
+		uintptr_t found_idx = hcc_hash_table_find_idx(w->ptr_to_idx_hash_table, &key);
+		if (found_idx != UINTPTR_MAX) {
+			return (void*)(uintptr_t)(w->ptr_to_idx_hash_table[found_idx].idx + 1);
+		}
+
+		uint32_t code_file_idx = hcc_ast_binary_write_code_file(w, location->code_file);
+		if (code_file_idx != UINT32_MAX) {
+			//
+			// the parent chain is written first so the parent always comes before its children
+			uintptr_t parent_location_idx_plus_one = (uintptr_t)hcc_ast_binary_write_location(w, location->parent_location);
+
+			HccASTBinaryLocation* dst = hcc_stack_push(w->locations);
+			dst->code_file_idx = code_file_idx;
+			dst->parent_location_idx_plus_one = parent_location_idx_plus_one;
+			dst->code_start_idx = location->code_start_idx;
+			dst->code_end_idx = location->code_end_idx;
+			dst->line_start = location->line_start;
+			dst->line_end = location->line_end;
+			dst->column_start = location->column_start;
+			dst->column_end = location->column_end;
+			dst->display_path_string_idx_plus_one = location->display_path.data ? hcc_ast_binary_write_path_string(w, location->display_path) + 1 : 0;
+			dst->display_line = location->display_line;
+
+			//
+			// the parent locations are not counted when sizing the table, so once it is half full
+			// the rest of the locations are written out again each time they are used.
+			// the other half is always left for the code files & files.
+			if (hcc_hash_table_count(w->ptr_to_idx_hash_table) < hcc_hash_table_cap(w->ptr_to_idx_hash_table) / 2) {
+				HccHashTableInsert insert = hcc_hash_table_find_insert_idx(w->ptr_to_idx_hash_table, &key);
+				w->ptr_to_idx_hash_table[insert.idx].idx = hcc_stack_count(w->locations) - 1;
+			}
+			return (void*)(uintptr_t)hcc_stack_count(w->locations);
+		}
+
+		//
+		// a location in a concatenation buffer gets stored as the location of the macro expansion it came from
+		location = location->parent_location;
+	}
+
+	return NULL;
+}
+
+void* hcc_ast_binary_write_ast_file(HccASTBinaryWriter* w, HccASTFile* ast_file) {
+	uint64_t key = (uintptr_t)ast_file;
+	uintptr_t found_idx = hcc_hash_table_find_idx(w->ptr_to_idx_hash_table, &key);
+	return found_idx == UINTPTR_MAX ? NULL : (void*)(uintptr_t)(w->ptr_to_idx_hash_table[found_idx].idx + 1);
+}
+
+void hcc_ast_binary_write_variables(HccASTBinaryWriter* w, HccASTBinarySection section, HccStack(HccASTVariable) variables) {
+	HccASTVariable* dst = hcc_ast_binary_write_section(w, section, variables, hcc_stack_count(variables));
+	for (uint32_t idx = 0; idx < hcc_stack_count(variables); idx += 1) {
+		HccASTVariable* variable = &dst[idx];
+		variable->ast_file = hcc_ast_binary_write_ast_file(w, variable->ast_file);
+		variable->identifier_location = hcc_ast_binary_write_location(w, variable->identifier_location);
+		variable->identifier_string_id = hcc_ast_binary_write_string_id(w, variable->identifier_string_id);
+	}
+}
+
+void hcc_ast_binary_write_file_decls(HccASTBinaryWriter* w, uint32_t file_idx, HccASTBinaryDeclKind kind, HccHashTable(HccDeclEntry) declarations, HccStringId string_id) {
+	uintptr_t found_idx = hcc_hash_table_find_idx(declarations, &string_id);
+	if (found_idx == UINTPTR_MAX) {
+		return;
+	}
+
+	HccDeclEntry* entry = &declarations[found_idx];
+	HccASTBinaryFileDecl* dst = hcc_ast_binary_write_section_push(w, HCC_AST_BINARY_SECTION_FILE_DECLS, 1);
+	dst->file_idx = file_idx;
+	dst->string_id = hcc_ast_binary_write_string_id(w, entry->string_id);
+	dst->decl = entry->decl;
+	dst->location_idx_plus_one = (uintptr_t)hcc_ast_binary_write_location(w, entry->location);
+	dst->kind = kind;
+}
+
+void hcc_ast_binary_write_expr(HccASTBinaryWriter* w, HccASTExpr* expr) {
+	HccStack(HccASTExpr) exprs = w->cu->ast.exprs;
+	switch (expr->type) {
+		case HCC_AST_EXPR_TYPE_CURLY_INITIALIZER:
+			expr->curly_initializer.first_expr = HCC_AST_BINARY_SWIZZLE(expr->curly_initializer.first_expr, exprs);
+			break;
+		case HCC_AST_EXPR_TYPE_DESIGNATED_INITIALIZER:
+			expr->designated_initializer.value_expr = HCC_AST_BINARY_SWIZZLE(expr->designated_initializer.value_expr, exprs);
+			break;
+		case HCC_AST_EXPR_TYPE_CAST:
+			expr->cast_.expr = HCC_AST_BINARY_SWIZZLE(expr->cast_.expr, exprs);
+			break;
+		case HCC_AST_EXPR_TYPE_UNARY_OP:
+			expr->unary.expr = HCC_AST_BINARY_SWIZZLE(expr->unary.expr, exprs);
+			break;
+		case HCC_AST_EXPR_TYPE_BINARY_OP:
+			expr->binary.left_expr = HCC_AST_BINARY_SWIZZLE(expr->binary.left_expr, exprs);
+			if (expr->binary.op != HCC_AST_BINARY_OP_FIELD_ACCESS && expr->binary.op != HCC_AST_BINARY_OP_FIELD_ACCESS_INDIRECT) {
+				expr->binary.right_expr = HCC_AST_BINARY_SWIZZLE(expr->binary.right_expr, exprs);
+			}
+			break;
+		case HCC_AST_EXPR_TYPE_STMT_IF:
+			expr->if_.cond_expr = HCC_AST_BINARY_SWIZZLE(expr->if_.cond_expr, exprs);
+			expr->if_.true_stmt = HCC_AST_BINARY_SWIZZLE(expr->if_.true_stmt, exprs);
+			expr->if_.false_stmt = HCC_AST_BINARY_SWIZZLE(expr->if_.false_stmt, exprs);
+			break;
+		case HCC_AST_EXPR_TYPE_STMT_SWITCH:
+			expr->switch_.cond_expr = HCC_AST_BINARY_SWIZZLE(expr->switch_.cond_expr, exprs);
+			expr->switch_.block_expr = HCC_AST_BINARY_SWIZZLE(expr->switch_.block_expr, exprs);
+			break;
+		case HCC_AST_EXPR_TYPE_STMT_WHILE:
+			expr->while_.cond_expr = HCC_AST_BINARY_SWIZZLE(expr->while_.cond_expr, exprs);
+			expr->while_.loop_stmt = HCC_AST_BINARY_SWIZZLE(expr->while_.loop_stmt, exprs);
+			break;
+		case HCC_AST_EXPR_TYPE_STMT_FOR:
+			expr->for_.init_stmt = HCC_AST_BINARY_SWIZZLE(expr->for_.init_stmt, exprs);
+			expr->for_.cond_expr = HCC_AST_BINARY_SWIZZLE(expr->for_.cond_expr, exprs);
+			expr->for_.inc_stmt = HCC_AST_BINARY_SWIZZLE(expr->for_.inc_stmt, exprs);
+			expr->for_.loop_stmt = HCC_AST_BINARY_SWIZZLE(expr->for_.loop_stmt, exprs);
+			break;
+		case HCC_AST_EXPR_TYPE_STMT_CASE:
+			expr->case_.next_case_stmt = HCC_AST_BINARY_SWIZZLE(expr->case_.next_case_stmt, exprs);
+			break;
+		case HCC_AST_EXPR_TYPE_STMT_RETURN:
+			expr->return_.expr = HCC_AST_BINARY_SWIZZLE(expr->return_.expr, exprs);
+			break;
+		case HCC_AST_EXPR_TYPE_STMT_BLOCK:
+			expr->stmt_block.first_stmt = HCC_AST_BINARY_SWIZZLE(expr->stmt_block.first_stmt, exprs);
+			expr->stmt_block.last_stmt = HCC_AST_BINARY_SWIZZLE(expr->stmt_block.last_stmt, exprs);
+			break;
+		case HCC_AST_EXPR_TYPE_STMT_GENERIC_CASE:
+			expr->generic_case.next_case_stmt = HCC_AST_BINARY_SWIZZLE(expr->generic_case.next_case_stmt, exprs);
+			expr->generic_case.expr = HCC_AST_BINARY_SWIZZLE(expr->generic_case.expr, exprs);
+			break;
+	}
+
+	expr->location = hcc_ast_binary_write_location(w, expr->location);
+	expr->next_stmt = HCC_AST_BINARY_SWIZZLE(expr->next_stmt, exprs);
+}
+
+void hcc_ast_binary_write_aml(HccASTBinaryWriter* w) {
+	HccCU* cu = w->cu;
+	uint32_t functions_count = hcc_stack_count(cu->aml.functions);
+
+	hcc_ast_binary_write_section_begin(w, HCC_AST_BINARY_SECTION_AML_FUNCTIONS);
+	uint32_t words_start_idx = 0;
+	uint32_t values_start_idx = 0;
+	uint32_t basic_blocks_start_idx = 0;
+	uint32_t basic_block_params_start_idx = 0;
+	uint32_t basic_block_param_srcs_start_idx = 0;
+	for (uint32_t idx = 0; idx < functions_count; idx += 1) {
+		HccAMLFunction* function = atomic_load(&cu->aml.functions[idx]);
+		if (function == NULL) {
+			continue;
+		}
+
+		HccASTBinaryAMLFunction* dst = hcc_ast_binary_write_section_push(w, HCC_AST_BINARY_SECTION_AML_FUNCTIONS, 1);
+		dst->identifier_location_idx_plus_one = (uintptr_t)hcc_ast_binary_write_location(w, function->identifier_location);
+		dst->found_texture_sample_location_idx_plus_one = (uintptr_t)hcc_ast_binary_write_location(w, function->found_texture_sample_location);
+		dst->identifier_string_id = hcc_ast_binary_write_string_id(w, function->identifier_string_id);
+		dst->function_data_type = function->function_data_type;
+		dst->return_data_type = function->return_data_type;
+		dst->compute_dispatch_group_size_x = function->compute_dispatch_group_size_x;
+		dst->compute_dispatch_group_size_y = function->compute_dispatch_group_size_y;
+		dst->compute_dispatch_group_size_z = function->compute_dispatch_group_size_z;
+		dst->words_start_idx = words_start_idx;
+		dst->words_count = function->words_count;
+		dst->values_start_idx = values_start_idx;
+		dst->values_count = function->values_count;
+		dst->basic_blocks_start_idx = basic_blocks_start_idx;
+		dst->basic_blocks_count = function->basic_blocks_count;
+		dst->basic_block_params_start_idx = basic_block_params_start_idx;
+		dst->basic_block_params_count = function->basic_block_params_count;
+		dst->basic_block_param_srcs_start_idx = basic_block_param_srcs_start_idx;
+		dst->basic_block_param_srcs_count = function->basic_block_param_srcs_count;
+		dst->shader_stage = function->shader_stage;
+		dst->opt_level = function->opt_level;
+		dst->params_count = function->params_count;
+
+		words_start_idx += function->words_count;
+		values_start_idx += function->values_count;
+		basic_blocks_start_idx += function->basic_blocks_count;
+		basic_block_params_start_idx += function->basic_block_params_count;
+		basic_block_param_srcs_start_idx += function->basic_block_param_srcs_count;
+	}
+
+	hcc_ast_binary_write_section_begin(w, HCC_AST_BINARY_SECTION_AML_FUNCTION_IDXS);
+	for (uint32_t idx = 0; idx < functions_count; idx += 1) {
+		if (atomic_load(&cu->aml.functions[idx])) {
+			*(uint32_t*)hcc_ast_binary_write_section_push(w, HCC_AST_BINARY_SECTION_AML_FUNCTION_IDXS, 1) = idx;
+		}
+	}
+
+	//
+	// the arrays of every function are written back to back in the same order as the functions
+	for (HccASTBinarySection section = HCC_AST_BINARY_SECTION_AML_WORDS; section <= HCC_AST_BINARY_SECTION_AML_BASIC_BLOCK_PARAM_SRCS; section += 1) {
+		hcc_ast_binary_write_section_begin(w, section);
+		for (uint32_t idx = 0; idx < functions_count; idx += 1) {
+			HccAMLFunction* function = atomic_load(&cu->aml.functions[idx]);
+			if (function == NULL) {
+				continue;
+			}
+
+			void* elmts;
+			uint32_t count;
+			switch (section) {
+				case HCC_AST_BINARY_SECTION_AML_WORDS: elmts = function->words; count = function->words_count; break;
+				case HCC_AST_BINARY_SECTION_AML_VALUES: elmts = function->values; count = function->values_count; break;
+				case HCC_AST_BINARY_SECTION_AML_BASIC_BLOCKS: elmts = function->basic_blocks; count = function->basic_blocks_count; break;
+				case HCC_AST_BINARY_SECTION_AML_BASIC_BLOCK_PARAMS: elmts = function->basic_block_params; count = function->basic_block_params_count; break;
+				case HCC_AST_BINARY_SECTION_AML_BASIC_BLOCK_PARAM_SRCS: elmts = function->basic_block_param_srcs; count = function->basic_block_param_srcs_count; break;
+				default: HCC_UNREACHABLE();
+			}
+			memcpy(hcc_ast_binary_write_section_push(w, section, count), elmts, count * hcc_ast_binary_section_elmt_sizes[section]);
+		}
+	}
+
+	hcc_ast_binary_write_section_begin(w, HCC_AST_BINARY_SECTION_AML_LOCATIONS);
+	for (uint32_t idx = 0; idx < hcc_stack_count(cu->aml.locations); idx += 1) {
+		uint32_t location_idx_plus_one = (uintptr_t)hcc_ast_binary_write_location(w, hcc_location_table_get(cu, cu->aml.locations[idx]));
+		*(uint32_t*)hcc_ast_binary_write_section_push(w, HCC_AST_BINARY_SECTION_AML_LOCATIONS, 1) = location_idx_plus_one;
+	}
+
+	hcc_ast_binary_write_section(w, HCC_AST_BINARY_SECTION_AML_CALL_GRAPH_NODES, cu->aml.call_graph_nodes, hcc_stack_count(cu->aml.call_graph_nodes));
+
+	hcc_ast_binary_write_section_begin(w, HCC_AST_BINARY_SECTION_AML_FUNCTION_CALL_NODE_LISTS);
+	for (uint32_t idx = 0; idx < hcc_stack_count(cu->aml.function_call_node_lists); idx += 1) {
+		*(uint32_t*)hcc_ast_binary_write_section_push(w, HCC_AST_BINARY_SECTION_AML_FUNCTION_CALL_NODE_LISTS, 1) = (uintptr_t)HCC_AST_BINARY_SWIZZLE(cu->aml.function_call_node_lists[idx], cu->aml.call_graph_nodes);
+	}
+
+	HccStack(HccDecl) optimize_functions = hcc_aml_optimize_functions(cu);
+	hcc_ast_binary_write_section(w, HCC_AST_BINARY_SECTION_AML_OPTIMIZE_FUNCTIONS, optimize_functions, hcc_stack_count(optimize_functions));
+}
+
+HccStack(uint8_t) hcc_ast_binary_write(HccCU* cu, HccHash64 inputs_hash, bool include_aml) {
+	HccASTBinaryWriter writer = {0};
+	HccASTBinaryWriter* w = &writer;
+	w->cu = cu;
+
+	//
+	// the strings, code files & locations are found while writing the other sections,
+	// so they are gathered on the side and written at the end.
+	uint32_t strings_cap = hcc_stack_count(_hcc_gs.string_table.id_to_entry_map);
+	uint32_t string_data_cap = hcc_stack_header(_hcc_gs.string_table.data)->reserve_cap + strings_cap;
+	uint32_t code_files_cap = hcc_hash_table_cap(_hcc_gs.path_to_code_file_map) + hcc_stack_count(cu->ast.binary_code_files);
+	uint32_t locations_cap = hcc_stack_header(cu->location_table.locations)->reserve_cap;
+	uint32_t files_count = hcc_stack_count(cu->ast.files);
+
+	w->string_idx_plus_ones = hcc_stack_init(uint32_t, HCC_ALLOC_TAG_AST_BINARY, HCC_MIN(strings_cap, 16384), strings_cap);
+	w->strings = hcc_stack_init(HccASTBinaryString, HCC_ALLOC_TAG_AST_BINARY, HCC_MIN(strings_cap, 1024), strings_cap);
+	w->string_data = hcc_stack_init(char, HCC_ALLOC_TAG_AST_BINARY, HCC_MIN(string_data_cap, 65536), string_data_cap);
+	w->code_files = hcc_stack_init(HccASTBinaryCodeFile, HCC_ALLOC_TAG_AST_BINARY, HCC_MIN(code_files_cap, 1024), code_files_cap);
+	w->locations = hcc_stack_init(HccASTBinaryLocation, HCC_ALLOC_TAG_AST_BINARY, HCC_MIN(locations_cap, 1024), locations_cap);
+
+	//
+	// work out the largest the binary can be so it can be written straight into a single stack
+	uintptr_t file_dependencies_count = 0;
+	for (uint32_t file_idx = 0; file_idx < files_count; file_idx += 1) {
+		HccASTFile* file = cu->ast.files[file_idx];
+		file_dependencies_count += hcc_stack_count(file->unique_included_files);
+	}
+
+	uintptr_t aml_counts[HCC_AST_BINARY_SECTION_COUNT] = {0};
+	if (include_aml) {
+		for (uint32_t idx = 0; idx < hcc_stack_count(cu->aml.functions); idx += 1) {
+			HccAMLFunction* function = atomic_load(&cu->aml.functions[idx]);
+			if (function) {
+				aml_counts[HCC_AST_BINARY_SECTION_AML_FUNCTIONS] += 1;
+				aml_counts[HCC_AST_BINARY_SECTION_AML_WORDS] += function->words_count;
+				aml_counts[HCC_AST_BINARY_SECTION_AML_VALUES] += function->values_count;
+				aml_counts[HCC_AST_BINARY_SECTION_AML_BASIC_BLOCKS] += function->basic_blocks_count;
+				aml_counts[HCC_AST_BINARY_SECTION_AML_BASIC_BLOCK_PARAMS] += function->basic_block_params_count;
+				aml_counts[HCC_AST_BINARY_SECTION_AML_BASIC_BLOCK_PARAM_SRCS] += function->basic_block_param_srcs_count;
+			}
+		}
+		aml_counts[HCC_AST_BINARY_SECTION_AML_FUNCTION_IDXS] = aml_counts[HCC_AST_BINARY_SECTION_AML_FUNCTIONS];
+		aml_counts[HCC_AST_BINARY_SECTION_AML_LOCATIONS] = hcc_stack_count(cu->aml.locations);
+		aml_counts[HCC_AST_BINARY_SECTION_AML_CALL_GRAPH_NODES] = hcc_stack_count(cu->aml.call_graph_nodes);
+		aml_counts[HCC_AST_BINARY_SECTION_AML_FUNCTION_CALL_NODE_LISTS] = hcc_stack_count(cu->aml.function_call_node_lists);
+		aml_counts[HCC_AST_BINARY_SECTION_AML_OPTIMIZE_FUNCTIONS] = hcc_stack_count(hcc_aml_optimize_functions(cu));
+	}
+
+	uintptr_t max_counts[HCC_AST_BINARY_SECTION_COUNT] = {
+		[HCC_AST_BINARY_SECTION_STRINGS] =                             strings_cap,
+		[HCC_AST_BINARY_SECTION_STRING_DATA] =                         string_data_cap,
+		[HCC_AST_BINARY_SECTION_CODE_FILES] =                          code_files_cap,
+		[HCC_AST_BINARY_SECTION_LOCATIONS] =                           locations_cap,
+		[HCC_AST_BINARY_SECTION_FILES] =                               files_count,
+		[HCC_AST_BINARY_SECTION_FILE_DEPENDENCIES] =                   file_dependencies_count,
+		[HCC_AST_BINARY_SECTION_FILE_DECLS] =                          hcc_stack_count(cu->ast.forward_declarations) * 3,
+		[HCC_AST_BINARY_SECTION_CONSTANTS] =                           hcc_hash_table_count(cu->constant_table.entries_hash_table),
+		[HCC_AST_BINARY_SECTION_CONSTANT_DATA] =                       hcc_stack_count(cu->constant_table.data),
+		[HCC_AST_BINARY_SECTION_ARRAYS] =                              hcc_stack_count(cu->dtt.arrays),
+		[HCC_AST_BINARY_SECTION_COMPOUNDS] =                           hcc_stack_count(cu->dtt.compounds),
+		[HCC_AST_BINARY_SECTION_COMPOUND_FIELDS] =                     hcc_stack_count(cu->dtt.compound_fields),
+		[HCC_AST_BINARY_SECTION_TYPEDEFS] =                            hcc_stack_count(cu->dtt.typedefs),
+		[HCC_AST_BINARY_SECTION_ENUMS] =                               hcc_stack_count(cu->dtt.enums),
+		[HCC_AST_BINARY_SECTION_ENUM_VALUES] =                         hcc_stack_count(cu->dtt.enum_values),
+		[HCC_AST_BINARY_SECTION_POINTERS] =                            hcc_stack_count(cu->dtt.pointers),
+		[HCC_AST_BINARY_SECTION_FUNCTION_DATA_TYPES] =                 hcc_stack_count(cu->dtt.functions),
+		[HCC_AST_BINARY_SECTION_FUNCTION_DATA_TYPE_PARAMS] =           hcc_stack_count(cu->dtt.function_params),
+		[HCC_AST_BINARY_SECTION_BUFFERS] =                             hcc_stack_count(cu->dtt.buffers),
+		[HCC_AST_BINARY_SECTION_FUNCTION_PARAMS_AND_VARIABLES] =       hcc_stack_count(cu->ast.function_params_and_variables),
+		[HCC_AST_BINARY_SECTION_FUNCTIONS] =                           hcc_stack_count(cu->ast.functions),
+		[HCC_AST_BINARY_SECTION_FUNCTION_IDXS] =                       hcc_stack_count(cu->ast.functions),
+		[HCC_AST_BINARY_SECTION_EXPRS] =                               hcc_stack_count(cu->ast.exprs),
+		[HCC_AST_BINARY_SECTION_GLOBAL_VARIABLES] =                    hcc_stack_count(cu->ast.global_variables),
+		[HCC_AST_BINARY_SECTION_FORWARD_DECLARATIONS] =                hcc_stack_count(cu->ast.forward_declarations),
+		[HCC_AST_BINARY_SECTION_DESIGNATED_INITIALIZER_ELMT_INDICES] = hcc_stack_count(cu->ast.designated_initializer_elmt_indices),
+		[HCC_AST_BINARY_SECTION_SHADER_FUNCTION_DECLS] =               hcc_stack_count(cu->shader_function_decls),
+		[HCC_AST_BINARY_SECTION_RESOURCE_STRUCTS] =                    hcc_stack_count(cu->resource_structs),
+	};
+	uintptr_t max_size = sizeof(HccASTBinaryHeader);
+	for (HccASTBinarySection section = 0; section < HCC_AST_BINARY_SECTION_COUNT; section += 1) {
+		max_counts[section] += aml_counts[section];
+		max_size += 8 + max_counts[section] * hcc_ast_binary_section_elmt_sizes[section];
+	}
+
+	//
+	// the pointer table is sized by the number of location pointers rather than the capacity of the locations,
+	// so it stays small enough to not be faulting in new pages for every insert. see hcc_ast_binary_write_location.
+	uintptr_t location_ptrs_count =
+		max_counts[HCC_AST_BINARY_SECTION_FILE_DECLS] +
+		max_counts[HCC_AST_BINARY_SECTION_COMPOUNDS] +
+		max_counts[HCC_AST_BINARY_SECTION_COMPOUND_FIELDS] +
+		max_counts[HCC_AST_BINARY_SECTION_TYPEDEFS] +
+		max_counts[HCC_AST_BINARY_SECTION_ENUMS] +
+		max_counts[HCC_AST_BINARY_SECTION_ENUM_VALUES] +
+		max_counts[HCC_AST_BINARY_SECTION_FUNCTION_PARAMS_AND_VARIABLES] +
+		max_counts[HCC_AST_BINARY_SECTION_FUNCTIONS] * 2 +
+		max_counts[HCC_AST_BINARY_SECTION_EXPRS] +
+		max_counts[HCC_AST_BINARY_SECTION_GLOBAL_VARIABLES] +
+		max_counts[HCC_AST_BINARY_SECTION_FORWARD_DECLARATIONS] +
+		max_counts[HCC_AST_BINARY_SECTION_AML_FUNCTIONS] * 2 +
+		max_counts[HCC_AST_BINARY_SECTION_AML_LOCATIONS];
+	uintptr_t ptrs_cap = 1024;
+	while (ptrs_cap < (location_ptrs_count + code_files_cap + files_count) * 2) {
+		ptrs_cap <<= 1;
+	}
+	w->ptr_to_idx_hash_table = hcc_hash_table_init(HccASTBinaryPtrEntry, HCC_ALLOC_TAG_AST_BINARY, hcc_u64_key_cmp, hcc_u64_key_hash, ptrs_cap);
+
+	w->out = hcc_stack_init(uint8_t, HCC_ALLOC_TAG_AST_BINARY, 65536, HCC_MAX(max_size, 65536));
+	w->header = (HccASTBinaryHeader*)hcc_stack_push_many(w->out, sizeof(HccASTBinaryHeader));
+	w->header->magic = HCC_AST_BINARY_MAGIC;
+	w->header->version = HCC_AST_BINARY_VERSION;
+	w->header->layout_hash = hcc_ast_binary_layout_hash();
+	w->header->inputs_hash = inputs_hash;
+	w->header->constants_cap = hcc_hash_table_initial_cap(cu->constant_table.entries_hash_table);
+	w->header->flags = include_aml ? HCC_AST_BINARY_FLAGS_HAS_AML : HCC_AST_BINARY_FLAGS_NONE;
+	w->header->supported_scalar_data_types_mask = cu->supported_scalar_data_types_mask;
+
+	//
+	// files
+	for (uint32_t file_idx = 0; file_idx < files_count; file_idx += 1) {
+		uint64_t key = (uintptr_t)cu->ast.files[file_idx];
+		HccHashTableInsert insert = hcc_hash_table_find_insert_idx(w->ptr_to_idx_hash_table, &key);
+		w->ptr_to_idx_hash_table[insert.idx].idx = file_idx;
+	}
+
+	hcc_ast_binary_write_section_begin(w, HCC_AST_BINARY_SECTION_FILES);
+	uint32_t dependencies_start_idx = 0;
+	for (uint32_t file_idx = 0; file_idx < files_count; file_idx += 1) {
+		HccASTFile* file = cu->ast.files[file_idx];
+		HccASTBinaryFile* dst = hcc_ast_binary_write_section_push(w, HCC_AST_BINARY_SECTION_FILES, 1);
+		dst->path_string_idx = hcc_ast_binary_write_path_string(w, file->path);
+		dst->dependencies_start_idx = dependencies_start_idx;
+		dst->dependencies_count = hcc_stack_count(file->unique_included_files);
+		dependencies_start_idx += dst->dependencies_count;
+
+		//
+		// the code file of every file that went into the AST is stored, so the reader can tell when one has changed
+		HccCodeFile* code_file = hcc_code_file_find(file->path);
+		if (code_file) {
+			hcc_ast_binary_write_code_file(w, code_file);
+		}
+	}
+
+	hcc_ast_binary_write_section_begin(w, HCC_AST_BINARY_SECTION_FILE_DEPENDENCIES);
+	for (uint32_t file_idx = 0; file_idx < files_count; file_idx += 1) {
+		HccASTFile* file = cu->ast.files[file_idx];
+		for (uint32_t idx = 0; idx < hcc_stack_count(file->unique_included_files); idx += 1) {
+			HccStringId path_string_id = file->unique_included_files[idx];
+			uint32_t* dst = hcc_ast_binary_write_section_push(w, HCC_AST_BINARY_SECTION_FILE_DEPENDENCIES, 1);
+			*dst = hcc_ast_binary_write_string(w, path_string_id);
+
+			HccCodeFile* code_file = hcc_code_file_find(hcc_string_table_get(path_string_id));
+			if (code_file) {
+				hcc_ast_binary_write_code_file(w, code_file);
+			}
+		}
+	}
+
+	//
+	// the file declaration tables are too sparse to walk, so the declarations are found through the forward declarations
+	hcc_ast_binary_write_section_begin(w, HCC_AST_BINARY_SECTION_FILE_DECLS);
+	for (uint32_t idx = 0; idx < hcc_stack_count(cu->ast.forward_declarations); idx += 1) {
+		HccASTForwardDecl* forward_decl = &cu->ast.forward_declarations[idx];
+		uint32_t file_idx_plus_one = (uintptr_t)hcc_ast_binary_write_ast_file(w, forward_decl->ast_file);
+		if (file_idx_plus_one == 0) {
+			continue;
+		}
+
+		HccASTFile* file = forward_decl->ast_file;
+		hcc_ast_binary_write_file_decls(w, file_idx_plus_one - 1, HCC_AST_BINARY_DECL_KIND_GLOBAL, file->global_declarations, forward_decl->identifier_string_id);
+		hcc_ast_binary_write_file_decls(w, file_idx_plus_one - 1, HCC_AST_BINARY_DECL_KIND_STRUCT, file->struct_declarations, forward_decl->identifier_string_id);
+		hcc_ast_binary_write_file_decls(w, file_idx_plus_one - 1, HCC_AST_BINARY_DECL_KIND_UNION, file->union_declarations, forward_decl->identifier_string_id);
+	}
+
+	//
+	// constants, a HccConstantId is the slot in the hash table so the slot gets stored with it
+	hcc_ast_binary_write_section_begin(w, HCC_AST_BINARY_SECTION_CONSTANTS);
+	HccHashTable(HccConstantEntry) constants = cu->constant_table.entries_hash_table;
+	for (uint32_t idx = 0; idx < hcc_hash_table_cap(constants); idx += 1) {
+		HccConstantEntry* entry = &constants[idx];
+		HccDataType data_type = atomic_load(&entry->data_type);
+		if (data_type == 0) {
+			continue;
+		}
+
+		HccASTBinaryConstant* dst = hcc_ast_binary_write_section_push(w, HCC_AST_BINARY_SECTION_CONSTANTS, 1);
+		dst->slot_idx = idx;
+		dst->data_offset = entry->size ? HCC_PTR_DIFF(entry->data, cu->constant_table.data) : 0;
+		dst->size = entry->size;
+		dst->is_zero = entry->is_zero;
+		dst->data_type = data_type;
+	}
+	hcc_ast_binary_write_section(w, HCC_AST_BINARY_SECTION_CONSTANT_DATA, cu->constant_table.data, hcc_stack_count(cu->constant_table.data));
+
+	//
+	// data types
+	hcc_ast_binary_write_section(w, HCC_AST_BINARY_SECTION_ARRAYS, cu->dtt.arrays, hcc_stack_count(cu->dtt.arrays));
+
+	HccCompoundDataType* compounds = hcc_ast_binary_write_section(w, HCC_AST_BINARY_SECTION_COMPOUNDS, cu->dtt.compounds, hcc_stack_count(cu->dtt.compounds));
+	for (uint32_t idx = 0; idx < hcc_stack_count(cu->dtt.compounds); idx += 1) {
+		HccCompoundDataType* d = &compounds[idx];
+		d->identifier_location = hcc_ast_binary_write_location(w, d->identifier_location);
+		d->identifier_string_id = hcc_ast_binary_write_string_id(w, d->identifier_string_id);
+		d->fields = HCC_AST_BINARY_SWIZZLE(d->fields, cu->dtt.compound_fields);
+		d->storage_fields = HCC_AST_BINARY_SWIZZLE(d->storage_fields, cu->dtt.compound_fields);
+	}
+
+	HccCompoundField* compound_fields = hcc_ast_binary_write_section(w, HCC_AST_BINARY_SECTION_COMPOUND_FIELDS, cu->dtt.compound_fields, hcc_stack_count(cu->dtt.compound_fields));
+	for (uint32_t idx = 0; idx < hcc_stack_count(cu->dtt.compound_fields); idx += 1) {
+		HccCompoundField* field = &compound_fields[idx];
+		field->identifier_location = hcc_ast_binary_write_location(w, field->identifier_location);
+		field->identifier_string_id = hcc_ast_binary_write_string_id(w, field->identifier_string_id);
+	}
+
+	HccTypedef* typedefs = hcc_ast_binary_write_section(w, HCC_AST_BINARY_SECTION_TYPEDEFS, cu->dtt.typedefs, hcc_stack_count(cu->dtt.typedefs));
+	for (uint32_t idx = 0; idx < hcc_stack_count(cu->dtt.typedefs); idx += 1) {
+		HccTypedef* typedef_ = &typedefs[idx];
+		typedef_->identifier_location = hcc_ast_binary_write_location(w, typedef_->identifier_location);
+		typedef_->identifier_string_id = hcc_ast_binary_write_string_id(w, typedef_->identifier_string_id);
+	}
+
+	HccEnumDataType* enums = hcc_ast_binary_write_section(w, HCC_AST_BINARY_SECTION_ENUMS, cu->dtt.enums, hcc_stack_count(cu->dtt.enums));
+	for (uint32_t idx = 0; idx < hcc_stack_count(cu->dtt.enums); idx += 1) {
+		HccEnumDataType* d = &enums[idx];
+		d->identifier_location = hcc_ast_binary_write_location(w, d->identifier_location);
+		d->identifier_string_id = hcc_ast_binary_write_string_id(w, d->identifier_string_id);
+		d->values = HCC_AST_BINARY_SWIZZLE(d->values, cu->dtt.enum_values);
+	}
+
+	HccEnumValue* enum_values = hcc_ast_binary_write_section(w, HCC_AST_BINARY_SECTION_ENUM_VALUES, cu->dtt.enum_values, hcc_stack_count(cu->dtt.enum_values));
+	for (uint32_t idx = 0; idx < hcc_stack_count(cu->dtt.enum_values); idx += 1) {
+		HccEnumValue* value = &enum_values[idx];
+		value->identifier_location = hcc_ast_binary_write_location(w, value->identifier_location);
+		value->identifier_string_id = hcc_ast_binary_write_string_id(w, value->identifier_string_id);
+	}
+
+	hcc_ast_binary_write_section(w, HCC_AST_BINARY_SECTION_POINTERS, cu->dtt.pointers, hcc_stack_count(cu->dtt.pointers));
+
+	HccFunctionDataType* function_data_types = hcc_ast_binary_write_section(w, HCC_AST_BINARY_SECTION_FUNCTION_DATA_TYPES, cu->dtt.functions, hcc_stack_count(cu->dtt.functions));
+	for (uint32_t idx = 0; idx < hcc_stack_count(cu->dtt.functions); idx += 1) {
+		HccFunctionDataType* d = &function_data_types[idx];
+		d->params = HCC_AST_BINARY_SWIZZLE(d->params, cu->dtt.function_params);
+	}
+
+	hcc_ast_binary_write_section(w, HCC_AST_BINARY_SECTION_FUNCTION_DATA_TYPE_PARAMS, cu->dtt.function_params, hcc_stack_count(cu->dtt.function_params));
+	hcc_ast_binary_write_section(w, HCC_AST_BINARY_SECTION_BUFFERS, cu->dtt.buffers, hcc_stack_count(cu->dtt.buffers));
+
+
+	//
+	// AST
+	hcc_ast_binary_write_variables(w, HCC_AST_BINARY_SECTION_FUNCTION_PARAMS_AND_VARIABLES, cu->ast.function_params_and_variables);
+
+	//
+	// most of the preallocated intrinsic functions are never declared, so only the ones that have been are written
+	hcc_ast_binary_write_section_begin(w, HCC_AST_BINARY_SECTION_FUNCTIONS);
+	for (uint32_t idx = 0; idx < hcc_stack_count(cu->ast.functions); idx += 1) {
+		if (cu->ast.functions[idx].identifier_string_id.idx_plus_one == 0) {
+			continue;
+		}
+
+		HccASTFunction* function = hcc_ast_binary_write_section_push(w, HCC_AST_BINARY_SECTION_FUNCTIONS, 1);
+		*function = cu->ast.functions[idx];
+		function->identifier_location = hcc_ast_binary_write_location(w, function->identifier_location);
+		function->return_data_type_location = hcc_ast_binary_write_location(w, function->return_data_type_location);
+		function->params_and_variables = HCC_AST_BINARY_SWIZZLE(function->params_and_variables, cu->ast.function_params_and_variables);
+		function->identifier_string_id = hcc_ast_binary_write_string_id(w, function->identifier_string_id);
+		function->block_expr = HCC_AST_BINARY_SWIZZLE(function->block_expr, cu->ast.exprs);
+	}
+
+	hcc_ast_binary_write_section_begin(w, HCC_AST_BINARY_SECTION_FUNCTION_IDXS);
+	for (uint32_t idx = 0; idx < hcc_stack_count(cu->ast.functions); idx += 1) {
+		if (cu->ast.functions[idx].identifier_string_id.idx_plus_one) {
+			*(uint32_t*)hcc_ast_binary_write_section_push(w, HCC_AST_BINARY_SECTION_FUNCTION_IDXS, 1) = idx;
+		}
+	}
+
+	HccASTExpr* exprs = hcc_ast_binary_write_section(w, HCC_AST_BINARY_SECTION_EXPRS, cu->ast.exprs, hcc_stack_count(cu->ast.exprs));
+	for (uint32_t idx = 0; idx < hcc_stack_count(cu->ast.exprs); idx += 1) {
+		hcc_ast_binary_write_expr(w, &exprs[idx]);
+	}
+
+	hcc_ast_binary_write_variables(w, HCC_AST_BINARY_SECTION_GLOBAL_VARIABLES, cu->ast.global_variables);
+
+	HccASTForwardDecl* forward_decls = hcc_ast_binary_write_section(w, HCC_AST_BINARY_SECTION_FORWARD_DECLARATIONS, cu->ast.forward_declarations, hcc_stack_count(cu->ast.forward_declarations));
+	for (uint32_t idx = 0; idx < hcc_stack_count(cu->ast.forward_declarations); idx += 1) {
+		HccASTForwardDecl* forward_decl = &forward_decls[idx];
+		forward_decl->ast_file = hcc_ast_binary_write_ast_file(w, forward_decl->ast_file);
+		forward_decl->identifier_location = hcc_ast_binary_write_location(w, forward_decl->identifier_location);
+		forward_decl->identifier_string_id = hcc_ast_binary_write_string_id(w, forward_decl->identifier_string_id);
+
+		//
+		// this is zero for the struct, union & variable forward declarations
+		forward_decl->function.params = HCC_AST_BINARY_SWIZZLE(forward_decl->function.params, cu->ast.function_params_and_variables);
+	}
+
+	hcc_ast_binary_write_section(w, HCC_AST_BINARY_SECTION_DESIGNATED_INITIALIZER_ELMT_INDICES, cu->ast.designated_initializer_elmt_indices, hcc_stack_count(cu->ast.designated_initializer_elmt_indices));
+	hcc_ast_binary_write_section(w, HCC_AST_BINARY_SECTION_SHADER_FUNCTION_DECLS, cu->shader_function_decls, hcc_stack_count(cu->shader_function_decls));
+	hcc_ast_binary_write_section(w, HCC_AST_BINARY_SECTION_RESOURCE_STRUCTS, cu->resource_structs, hcc_stack_count(cu->resource_structs));
+
+	if (include_aml) {
+		hcc_ast_binary_write_aml(w);
+	}
+
+	//
+	// now everything has been found, write the strings, code files & locations
+	hcc_ast_binary_write_section(w, HCC_AST_BINARY_SECTION_LOCATIONS, w->locations, hcc_stack_count(w->locations));
+	hcc_ast_binary_write_section(w, HCC_AST_BINARY_SECTION_CODE_FILES, w->code_files, hcc_stack_count(w->code_files));
+	hcc_ast_binary_write_section(w, HCC_AST_BINARY_SECTION_STRINGS, w->strings, hcc_stack_count(w->strings));
+	hcc_ast_binary_write_section(w, HCC_AST_BINARY_SECTION_STRING_DATA, w->string_data, hcc_stack_count(w->string_data));
+
+	w->header->size = hcc_stack_count(w->out);
+	w->header->content_hash = hcc_hash_wy_64(&w->out[sizeof(HccASTBinaryHeader)], w->header->size - sizeof(HccASTBinaryHeader), HCC_HASH_WY_64_INIT);
+
+	hcc_stack_deinit(w->string_idx_plus_ones);
+	hcc_hash_table_deinit(w->ptr_to_idx_hash_table);
+	hcc_stack_deinit(w->strings);
+	hcc_stack_deinit(w->string_data);
+	hcc_stack_deinit(w->code_files);
+	hcc_stack_deinit(w->locations);
+	return w->out;
+}
+
+void* hcc_ast_binary_read_section(HccASTBinaryReader* r, HccASTBinarySection section, uint32_t* count_out) {
+	if (count_out) {
+		*count_out = r->header->sections[section].count;
+	}
+	return &r->data[r->header->sections[section].offset];
+}
+
+HccString hcc_ast_binary_read_string(HccASTBinaryReader* r, uint32_t string_idx) {
+	HccASTBinaryString* strings = hcc_ast_binary_read_section(r, HCC_AST_BINARY_SECTION_STRINGS, NULL);
+	char* string_data = hcc_ast_binary_read_section(r, HCC_AST_BINARY_SECTION_STRING_DATA, NULL);
+	return hcc_string(&string_data[strings[string_idx].data_offset], strings[string_idx].size);
+}
+
+HccString hcc_ast_binary_read_persistent_string(HccASTBinaryReader* r, uint32_t string_idx) {
+	//
+	// paths are kept around for the lifetime of the compiler just like the ones from hcc_path_canonicalize
+	HccString* persistent_string = &r->persistent_strings[string_idx];
+	if (persistent_string->data == NULL) {
+		HccString string = hcc_ast_binary_read_string(r, string_idx);
+		char* data = HCC_ARENA_ALCTOR_ALLOC_ARRAY_THREAD_SAFE(char, &_hcc_gs.arena_alctor, (string.size + 1));
+		memcpy(data, string.data, string.size);
+		data[string.size] = '\0';
+		*persistent_string = hcc_string(data, string.size);
+	}
+
+	return *persistent_string;
+}
+
+HccStringId hcc_ast_binary_read_string_id(HccASTBinaryReader* r, HccStringId string_id) {
+	if (string_id.idx_plus_one < HCC_STRING_ID_USER_START) {
+		return string_id;
+	}
+
+	return r->string_ids[string_id.idx_plus_one - HCC_STRING_ID_USER_START];
+}
+
+HccLocation* hcc_ast_binary_read_location(HccASTBinaryReader* r, void* location_idx_plus_one) {
+	return HCC_AST_BINARY_UNSWIZZLE(location_idx_plus_one, r->locations);
+}
+
+void hcc_ast_binary_read_variables(HccASTBinaryReader* r, HccASTBinarySection section, HccStack(HccASTVariable) variables) {
+	uint32_t count;
+	HccASTVariable* src = hcc_ast_binary_read_section(r, section, &count);
+	HccASTVariable* dst = hcc_stack_push_many(variables, count);
+	HCC_COPY_ELMT_MANY(dst, src, count);
+	for (uint32_t idx = 0; idx < count; idx += 1) {
+		HccASTVariable* variable = &dst[idx];
+		variable->ast_file = variable->ast_file ? r->files[(uintptr_t)variable->ast_file - 1] : NULL;
+		variable->identifier_location = hcc_ast_binary_read_location(r, variable->identifier_location);
+		variable->identifier_string_id = hcc_ast_binary_read_string_id(r, variable->identifier_string_id);
+	}
+}
+
+void hcc_ast_binary_read_dedup_entry(HccHashTable(HccDataTypeDedupEntry) dedup_hash_table, uint64_t key, uint32_t idx) {
+	HccHashTableInsert insert = hcc_hash_table_find_insert_idx(dedup_hash_table, &key);
+	atomic_store(&dedup_hash_table[insert.idx].id, idx + 1);
+}
+
+void hcc_ast_binary_read_expr(HccASTBinaryReader* r, HccASTExpr* expr) {
+	HccStack(HccASTExpr) exprs = r->cu->ast.exprs;
+	switch (expr->type) {
+		case HCC_AST_EXPR_TYPE_CURLY_INITIALIZER:
+			expr->curly_initializer.first_expr = HCC_AST_BINARY_UNSWIZZLE(expr->curly_initializer.first_expr, exprs);
+			break;
+		case HCC_AST_EXPR_TYPE_DESIGNATED_INITIALIZER:
+			expr->designated_initializer.value_expr = HCC_AST_BINARY_UNSWIZZLE(expr->designated_initializer.value_expr, exprs);
+			break;
+		case HCC_AST_EXPR_TYPE_CAST:
+			expr->cast_.expr = HCC_AST_BINARY_UNSWIZZLE(expr->cast_.expr, exprs);
+			break;
+		case HCC_AST_EXPR_TYPE_UNARY_OP:
+			expr->unary.expr = HCC_AST_BINARY_UNSWIZZLE(expr->unary.expr, exprs);
+			break;
+		case HCC_AST_EXPR_TYPE_BINARY_OP:
+			expr->binary.left_expr = HCC_AST_BINARY_UNSWIZZLE(expr->binary.left_expr, exprs);
+			if (expr->binary.op != HCC_AST_BINARY_OP_FIELD_ACCESS && expr->binary.op != HCC_AST_BINARY_OP_FIELD_ACCESS_INDIRECT) {
+				expr->binary.right_expr = HCC_AST_BINARY_UNSWIZZLE(expr->binary.right_expr, exprs);
+			}
+			break;
+		case HCC_AST_EXPR_TYPE_STMT_IF:
+			expr->if_.cond_expr = HCC_AST_BINARY_UNSWIZZLE(expr->if_.cond_expr, exprs);
+			expr->if_.true_stmt = HCC_AST_BINARY_UNSWIZZLE(expr->if_.true_stmt, exprs);
+			expr->if_.false_stmt = HCC_AST_BINARY_UNSWIZZLE(expr->if_.false_stmt, exprs);
+			break;
+		case HCC_AST_EXPR_TYPE_STMT_SWITCH:
+			expr->switch_.cond_expr = HCC_AST_BINARY_UNSWIZZLE(expr->switch_.cond_expr, exprs);
+			expr->switch_.block_expr = HCC_AST_BINARY_UNSWIZZLE(expr->switch_.block_expr, exprs);
+			break;
+		case HCC_AST_EXPR_TYPE_STMT_WHILE:
+			expr->while_.cond_expr = HCC_AST_BINARY_UNSWIZZLE(expr->while_.cond_expr, exprs);
+			expr->while_.loop_stmt = HCC_AST_BINARY_UNSWIZZLE(expr->while_.loop_stmt, exprs);
+			break;
+		case HCC_AST_EXPR_TYPE_STMT_FOR:
+			expr->for_.init_stmt = HCC_AST_BINARY_UNSWIZZLE(expr->for_.init_stmt, exprs);
+			expr->for_.cond_expr = HCC_AST_BINARY_UNSWIZZLE(expr->for_.cond_expr, exprs);
+			expr->for_.inc_stmt = HCC_AST_BINARY_UNSWIZZLE(expr->for_.inc_stmt, exprs);
+			expr->for_.loop_stmt = HCC_AST_BINARY_UNSWIZZLE(expr->for_.loop_stmt, exprs);
+			break;
+		case HCC_AST_EXPR_TYPE_STMT_CASE:
+			expr->case_.next_case_stmt = HCC_AST_BINARY_UNSWIZZLE(expr->case_.next_case_stmt, exprs);
+			break;
+		case HCC_AST_EXPR_TYPE_STMT_RETURN:
+			expr->return_.expr = HCC_AST_BINARY_UNSWIZZLE(expr->return_.expr, exprs);
+			break;
+		case HCC_AST_EXPR_TYPE_STMT_BLOCK:
+			expr->stmt_block.first_stmt = HCC_AST_BINARY_UNSWIZZLE(expr->stmt_block.first_stmt, exprs);
+			expr->stmt_block.last_stmt = HCC_AST_BINARY_UNSWIZZLE(expr->stmt_block.last_stmt, exprs);
+			break;
+		case HCC_AST_EXPR_TYPE_STMT_GENERIC_CASE:
+			expr->generic_case.next_case_stmt = HCC_AST_BINARY_UNSWIZZLE(expr->generic_case.next_case_stmt, exprs);
+			expr->generic_case.expr = HCC_AST_BINARY_UNSWIZZLE(expr->generic_case.expr, exprs);
+			break;
+	}
+
+	expr->location = hcc_ast_binary_read_location(r, expr->location);
+	expr->next_stmt = HCC_AST_BINARY_UNSWIZZLE(expr->next_stmt, exprs);
+}
+
+bool hcc_ast_binary_is_intact(uint8_t* data, uintptr_t size) {
+	HccASTBinaryHeader* header = (HccASTBinaryHeader*)data;
+	return
+		size >= sizeof(HccASTBinaryHeader) &&
+		header->magic == HCC_AST_BINARY_MAGIC &&
+		header->version == HCC_AST_BINARY_VERSION &&
+		header->layout_hash == hcc_ast_binary_layout_hash() &&
+		header->size == size &&
+		header->content_hash == hcc_hash_wy_64(&data[sizeof(HccASTBinaryHeader)], size - sizeof(HccASTBinaryHeader), HCC_HASH_WY_64_INIT);
+}
+
+bool hcc_ast_binary_read_validate(HccASTBinaryReader* r, uintptr_t size, bool include_aml) {
+	HccCU* cu = r->cu;
+	HccASTBinaryHeader* header = r->header;
+	if (
+		!hcc_ast_binary_is_intact(r->data, size) ||
+		header->constants_cap != hcc_hash_table_initial_cap(cu->constant_table.entries_hash_table)
+	) {
+		return false;
+	}
+
+	for (HccASTBinarySection section = 0; section < HCC_AST_BINARY_SECTION_COUNT; section += 1) {
+		HccASTBinarySectionHeader* section_header = &header->sections[section];
+		if (
+			section_header->offset % 8 ||
+			section_header->offset > size ||
+			section_header->count > (size - section_header->offset) / hcc_ast_binary_section_elmt_sizes[section]
+		) {
+			return false;
+		}
+	}
+
+	if (header->sections[HCC_AST_BINARY_SECTION_FUNCTIONS].count != header->sections[HCC_AST_BINARY_SECTION_FUNCTION_IDXS].count) {
+		return false;
+	}
+
+	//
+	// an AST binary with AML is the state after AMLOPT, so it cannot be used to start at AMLGEN and the other way around.
+	// the AML has already been checked for intrinsic types the target does not support, so the reader has to support at least those.
+	if (!!(header->flags & HCC_AST_BINARY_FLAGS_HAS_AML) != include_aml) {
+		return false;
+	}
+	if (include_aml) {
+		if (
+			header->supported_scalar_data_types_mask & ~cu->supported_scalar_data_types_mask ||
+			header->sections[HCC_AST_BINARY_SECTION_AML_FUNCTIONS].count != header->sections[HCC_AST_BINARY_SECTION_AML_FUNCTION_IDXS].count ||
+			header->sections[HCC_AST_BINARY_SECTION_AML_OPTIMIZE_FUNCTIONS].count == 0
+		) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool hcc_ast_binary_read_code_files(HccASTBinaryReader* r) {
+	HccCU* cu = r->cu;
+	uint32_t code_files_count;
+	HccASTBinaryCodeFile* code_files = hcc_ast_binary_read_section(r, HCC_AST_BINARY_SECTION_CODE_FILES, &code_files_count);
+	for (uint32_t idx = 0; idx < code_files_count; idx += 1) {
+		HccASTBinaryCodeFile* src = &code_files[idx];
+		HccString path = hcc_ast_binary_read_string(r, src->path_string_idx);
+
+		//
+		// the code file cache has already been revalidated against the disk for this compile.
+		// otherwise the file is read in to check it has not changed and so messages can print its code.
+		HccCodeFile* code_file = hcc_code_file_find(path);
+		if (!code_file || !(atomic_load(&code_file->flags) & HCC_CODE_FILE_FLAGS_COMPLETED_MUTATOR_PASS)) {
+			if (hcc_stack_count(cu->ast.binary_code_files) == hcc_stack_cap(cu->ast.binary_code_files)) {
+				return false;
+			}
+
+			code_file = hcc_stack_push(cu->ast.binary_code_files);
+			if (!HCC_IS_SUCCESS(hcc_code_file_init(code_file, hcc_ast_binary_read_persistent_string(r, src->path_string_idx), false))) {
+				return false;
+			}
+
+			HccString code = code_file->code;
+			for (uint32_t code_idx = 0; code_idx < code.size; code_idx += 1) {
+				if (code.data[code_idx] == '\n') {
+					*hcc_stack_push(code_file->line_code_start_indices) = code_idx + 1;
+				}
+			}
+		}
+
+		if (code_file->code.size != src->code_size || code_file->code_hash != src->code_hash) {
+			return false;
+		}
+
+		*hcc_stack_push(r->code_files) = code_file;
+	}
+
+	return true;
+}
+
+void hcc_ast_binary_read_aml(HccASTBinaryReader* r) {
+	HccCU* cu = r->cu;
+	uint32_t locations_count;
+	uint32_t* locations = hcc_ast_binary_read_section(r, HCC_AST_BINARY_SECTION_AML_LOCATIONS, &locations_count);
+	HccLocationId* dst_locations = hcc_stack_push_many(cu->aml.locations, locations_count);
+	for (uint32_t idx = 0; idx < locations_count; idx += 1) {
+		dst_locations[idx] = hcc_location_table_id(cu, hcc_ast_binary_read_location(r, (void*)(uintptr_t)locations[idx]));
+	}
+
+	uint32_t count;
+	void* src_elmts = hcc_ast_binary_read_section(r, HCC_AST_BINARY_SECTION_AML_CALL_GRAPH_NODES, &count);
+	HCC_COPY_ELMT_MANY(hcc_stack_push_many(cu->aml.call_graph_nodes, count), (HccAMLCallNode*)src_elmts, count);
+
+	//
+	// the functions are sized by the call node lists as there is one for every function the AML was made with
+	uint32_t* call_node_lists = hcc_ast_binary_read_section(r, HCC_AST_BINARY_SECTION_AML_FUNCTION_CALL_NODE_LISTS, &count);
+	hcc_stack_resize(cu->aml.functions, count);
+	hcc_stack_resize(cu->aml.function_call_node_lists, count);
+	for (uint32_t idx = 0; idx < count; idx += 1) {
+		atomic_store(&cu->aml.functions[idx], NULL);
+		cu->aml.function_call_node_lists[idx] = HCC_AST_BINARY_UNSWIZZLE(call_node_lists[idx], cu->aml.call_graph_nodes);
+	}
+
+	HccASTBinaryAMLFunction* functions = hcc_ast_binary_read_section(r, HCC_AST_BINARY_SECTION_AML_FUNCTIONS, &count);
+	uint32_t* function_idxs = hcc_ast_binary_read_section(r, HCC_AST_BINARY_SECTION_AML_FUNCTION_IDXS, NULL);
+	HccAMLWord* words = hcc_ast_binary_read_section(r, HCC_AST_BINARY_SECTION_AML_WORDS, NULL);
+	HccAMLValue* values = hcc_ast_binary_read_section(r, HCC_AST_BINARY_SECTION_AML_VALUES, NULL);
+	HccAMLBasicBlock* basic_blocks = hcc_ast_binary_read_section(r, HCC_AST_BINARY_SECTION_AML_BASIC_BLOCKS, NULL);
+	HccAMLBasicBlockParam* basic_block_params = hcc_ast_binary_read_section(r, HCC_AST_BINARY_SECTION_AML_BASIC_BLOCK_PARAMS, NULL);
+	HccAMLBasicBlockParamSrc* basic_block_param_srcs = hcc_ast_binary_read_section(r, HCC_AST_BINARY_SECTION_AML_BASIC_BLOCK_PARAM_SRCS, NULL);
+	for (uint32_t idx = 0; idx < count; idx += 1) {
+		HccASTBinaryAMLFunction* src = &functions[idx];
+
+		HccAMLFunction* function = hcc_aml_function_alctor_alloc_for_counts(cu, src->words_count, src->values_count, src->basic_blocks_count, src->basic_block_params_count, src->basic_block_param_srcs_count);
+		function->identifier_location = hcc_ast_binary_read_location(r, (void*)(uintptr_t)src->identifier_location_idx_plus_one);
+		function->found_texture_sample_location = hcc_ast_binary_read_location(r, (void*)(uintptr_t)src->found_texture_sample_location_idx_plus_one);
+		function->identifier_string_id = hcc_ast_binary_read_string_id(r, src->identifier_string_id);
+		function->function_data_type = src->function_data_type;
+		function->return_data_type = src->return_data_type;
+		function->shader_stage = src->shader_stage;
+		function->opt_level = src->opt_level;
+		function->params_count = src->params_count;
+		function->compute_dispatch_group_size_x = src->compute_dispatch_group_size_x;
+		function->compute_dispatch_group_size_y = src->compute_dispatch_group_size_y;
+		function->compute_dispatch_group_size_z = src->compute_dispatch_group_size_z;
+		HCC_COPY_ELMT_MANY(function->words, &words[src->words_start_idx], src->words_count);
+		HCC_COPY_ELMT_MANY(function->values, &values[src->values_start_idx], src->values_count);
+		HCC_COPY_ELMT_MANY(function->basic_blocks, &basic_blocks[src->basic_blocks_start_idx], src->basic_blocks_count);
+		HCC_COPY_ELMT_MANY(function->basic_block_params, &basic_block_params[src->basic_block_params_start_idx], src->basic_block_params_count);
+		HCC_COPY_ELMT_MANY(function->basic_block_param_srcs, &basic_block_param_srcs[src->basic_block_param_srcs_start_idx], src->basic_block_param_srcs_count);
+		atomic_store(&cu->aml.functions[function_idxs[idx]], function);
+	}
+
+	//
+	// the functions of the last optimization phase are what BACKENDGEN gives out and the order BACKENDLINK outputs them in
+	src_elmts = hcc_ast_binary_read_section(r, HCC_AST_BINARY_SECTION_AML_OPTIMIZE_FUNCTIONS, &count);
+	HCC_COPY_ELMT_MANY(hcc_stack_push_many(hcc_aml_optimize_functions(cu), count), (HccDecl*)src_elmts, count);
+	cu->aml.opt_phase = HCC_AML_OPT_PHASE_COUNT - 1;
+}
+
+bool hcc_ast_binary_read(HccCU* cu, HccHash64 inputs_hash, uint8_t* data, uintptr_t size, bool include_aml) {
+	HccASTBinaryReader reader = {0};
+	HccASTBinaryReader* r = &reader;
+	r->cu = cu;
+	r->data = data;
+	r->header = (HccASTBinaryHeader*)data;
+	if (!hcc_ast_binary_read_validate(r, size, include_aml) || r->header->inputs_hash != inputs_hash) {
+		return false;
+	}
+
+	uint32_t strings_count = r->header->sections[HCC_AST_BINARY_SECTION_STRINGS].count;
+	uint32_t code_files_count = r->header->sections[HCC_AST_BINARY_SECTION_CODE_FILES].count;
+	uint32_t files_count = r->header->sections[HCC_AST_BINARY_SECTION_FILES].count;
+	r->string_ids = hcc_stack_init(HccStringId, HCC_ALLOC_TAG_AST_BINARY, HCC_MAX(strings_count, 1), HCC_MAX(strings_count, 1));
+	r->persistent_strings = hcc_stack_init(HccString, HCC_ALLOC_TAG_AST_BINARY, HCC_MAX(strings_count, 1), HCC_MAX(strings_count, 1));
+	r->code_files = hcc_stack_init(HccCodeFile*, HCC_ALLOC_TAG_AST_BINARY, HCC_MAX(code_files_count, 1), HCC_MAX(code_files_count, 1));
+	r->files = hcc_stack_init(HccASTFile*, HCC_ALLOC_TAG_AST_BINARY, HCC_MAX(files_count, 1), HCC_MAX(files_count, 1));
+	hcc_stack_resize(r->persistent_strings, strings_count);
+
+	//
+	// everything that can fail is checked before anything is added to the compilation unit,
+	// so the caller can fall back to running the front end on the same compilation unit.
+	//
+	// the constant data starts with the constants that hcc_cu_init has already added
+	uint32_t constant_data_size;
+	uint8_t* constant_data = hcc_ast_binary_read_section(r, HCC_AST_BINARY_SECTION_CONSTANT_DATA, &constant_data_size);
+	uint32_t existing_constant_data_size = hcc_stack_count(cu->constant_table.data);
+	bool is_success =
+		existing_constant_data_size <= constant_data_size &&
+		memcmp(constant_data, cu->constant_table.data, existing_constant_data_size) == 0 &&
+		hcc_ast_binary_read_code_files(r);
+	if (!is_success) {
+		for (uint32_t idx = 0; idx < hcc_stack_count(cu->ast.binary_code_files); idx += 1) {
+			hcc_code_file_deinit(&cu->ast.binary_code_files[idx]);
+		}
+		hcc_stack_clear(cu->ast.binary_code_files);
+		goto END;
+	}
+
+	//
+	// strings
+	for (uint32_t idx = 0; idx < strings_count; idx += 1) {
+		HccString string = hcc_ast_binary_read_string(r, idx);
+		hcc_string_table_deduplicate(string.data, string.size, hcc_stack_push(r->string_ids));
+	}
+
+	//
+	// locations
+	uint32_t locations_count;
+	HccASTBinaryLocation* locations = hcc_ast_binary_read_section(r, HCC_AST_BINARY_SECTION_LOCATIONS, &locations_count);
+	r->locations = hcc_stack_push_many(cu->location_table.locations, locations_count);
+	for (uint32_t idx = 0; idx < locations_count; idx += 1) {
+		HccASTBinaryLocation* src = &locations[idx];
+		HccLocation* dst = &r->locations[idx];
+		dst->code_file = r->code_files[src->code_file_idx];
+		dst->parent_location = hcc_ast_binary_read_location(r, (void*)(uintptr_t)src->parent_location_idx_plus_one);
+		dst->macro = NULL;
+		dst->code_start_idx = src->code_start_idx;
+		dst->code_end_idx = src->code_end_idx;
+		dst->line_start = src->line_start;
+		dst->line_end = src->line_end;
+		dst->column_start = src->column_start;
+		dst->column_end = src->column_end;
+		dst->display_path = src->display_path_string_idx_plus_one ? hcc_ast_binary_read_persistent_string(r, src->display_path_string_idx_plus_one - 1) : hcc_string(NULL, 0);
+		dst->display_line = src->display_line;
+	}
+
+	//
+	// files
+	HccASTBinaryFile* files = hcc_ast_binary_read_section(r, HCC_AST_BINARY_SECTION_FILES, NULL);
+	uint32_t* file_dependencies = hcc_ast_binary_read_section(r, HCC_AST_BINARY_SECTION_FILE_DEPENDENCIES, NULL);
+	for (uint32_t file_idx = 0; file_idx < files_count; file_idx += 1) {
+		HccASTBinaryFile* src = &files[file_idx];
+		HccASTFile* file;
+		hcc_ast_add_file(cu, hcc_ast_binary_read_persistent_string(r, src->path_string_idx), &file);
+		*hcc_stack_push(r->files) = file;
+
+		for (uint32_t idx = 0; idx < src->dependencies_count; idx += 1) {
+			*hcc_stack_push(file->unique_included_files) = r->string_ids[file_dependencies[src->dependencies_start_idx + idx]];
+		}
+	}
+
+	uint32_t file_decls_count;
+	HccASTBinaryFileDecl* file_decls = hcc_ast_binary_read_section(r, HCC_AST_BINARY_SECTION_FILE_DECLS, &file_decls_count);
+	for (uint32_t idx = 0; idx < file_decls_count; idx += 1) {
+		HccASTBinaryFileDecl* src = &file_decls[idx];
+		HccASTFile* file = r->files[src->file_idx];
+		HccHashTable(HccDeclEntry) declarations;
+		switch (src->kind) {
+			case HCC_AST_BINARY_DECL_KIND_GLOBAL: declarations = file->global_declarations; break;
+			case HCC_AST_BINARY_DECL_KIND_STRUCT: declarations = file->struct_declarations; break;
+			case HCC_AST_BINARY_DECL_KIND_UNION: declarations = file->union_declarations; break;
+			default: HCC_ABORT("unhandled AST binary declaration kind '%u'", src->kind);
+		}
+
+		HccStringId string_id = hcc_ast_binary_read_string_id(r, src->string_id);
+		HccHashTableInsert insert = hcc_hash_table_find_insert_idx(declarations, &string_id);
+		HccDeclEntry* entry = &declarations[insert.idx];
+		entry->decl = src->decl;
+		entry->location = hcc_ast_binary_read_location(r, (void*)(uintptr_t)src->location_idx_plus_one);
+	}
+
+	//
+	// constants, these go back in the same slots as a HccConstantId is the slot index
+	memcpy(hcc_stack_push_many(cu->constant_table.data, constant_data_size - existing_constant_data_size), &constant_data[existing_constant_data_size], constant_data_size - existing_constant_data_size);
+	uint8_t* dst_constant_data = cu->constant_table.data;
+
+	uint32_t constants_count;
+	HccASTBinaryConstant* constants = hcc_ast_binary_read_section(r, HCC_AST_BINARY_SECTION_CONSTANTS, &constants_count);
+	HccHashTableHeader* constants_header = hcc_hash_table_header(cu->constant_table.entries_hash_table);
+	for (uint32_t idx = 0; idx < constants_count; idx += 1) {
+		HccASTBinaryConstant* src = &constants[idx];
+		if (atomic_load(&constants_header->hashes[src->slot_idx]) != HCC_HASH_TABLE_HASH_EMPTY) {
+			//
+			// constants that were added when the compilation unit was initialized, they are the same as the prefix check above passed
+			HCC_DEBUG_ASSERT(cu->constant_table.entries_hash_table[src->slot_idx].data_type == src->data_type, "AST binary constant slot '%u' does not match the one made by hcc_cu_init", src->slot_idx);
+			continue;
+		}
+
+		HccConstantEntry entry = {0};
+		entry.data = src->size ? &dst_constant_data[src->data_offset] : NULL;
+		entry.size = src->size;
+		entry.is_zero = src->is_zero;
+		entry.data_type = src->data_type;
+		hcc_hash_table_insert_at_idx(cu->constant_table.entries_hash_table, src->slot_idx, &entry);
+	}
+
+	//
+	// data types
+	uint32_t count;
+	void* src_elmts;
+
+	src_elmts = hcc_ast_binary_read_section(r, HCC_AST_BINARY_SECTION_ARRAYS, &count);
+	HCC_COPY_ELMT_MANY(hcc_stack_push_many(cu->dtt.arrays, count), src_elmts, count);
+
+	src_elmts = hcc_ast_binary_read_section(r, HCC_AST_BINARY_SECTION_COMPOUND_FIELDS, &count);
+	HccCompoundField* compound_fields = hcc_stack_push_many(cu->dtt.compound_fields, count);
+	HCC_COPY_ELMT_MANY(compound_fields, src_elmts, count);
+	for (uint32_t idx = 0; idx < count; idx += 1) {
+		HccCompoundField* field = &compound_fields[idx];
+		field->identifier_location = hcc_ast_binary_read_location(r, field->identifier_location);
+		field->identifier_string_id = hcc_ast_binary_read_string_id(r, field->identifier_string_id);
+	}
+
+	//
+	// the intrinsic compound data types are preallocated by hcc_data_type_table_init but the binary has them too
+	src_elmts = hcc_ast_binary_read_section(r, HCC_AST_BINARY_SECTION_COMPOUNDS, &count);
+	hcc_stack_clear(cu->dtt.compounds);
+	HccCompoundDataType* compounds = hcc_stack_push_many(cu->dtt.compounds, count);
+	HCC_COPY_ELMT_MANY(compounds, src_elmts, count);
+	for (uint32_t idx = 0; idx < count; idx += 1) {
+		HccCompoundDataType* d = &compounds[idx];
+		d->identifier_location = hcc_ast_binary_read_location(r, d->identifier_location);
+		d->identifier_string_id = hcc_ast_binary_read_string_id(r, d->identifier_string_id);
+		d->fields = HCC_AST_BINARY_UNSWIZZLE(d->fields, cu->dtt.compound_fields);
+		d->storage_fields = HCC_AST_BINARY_UNSWIZZLE(d->storage_fields, cu->dtt.compound_fields);
+	}
+
+	src_elmts = hcc_ast_binary_read_section(r, HCC_AST_BINARY_SECTION_TYPEDEFS, &count);
+	HccTypedef* typedefs = hcc_stack_push_many(cu->dtt.typedefs, count);
+	HCC_COPY_ELMT_MANY(typedefs, src_elmts, count);
+	for (uint32_t idx = 0; idx < count; idx += 1) {
+		HccTypedef* typedef_ = &typedefs[idx];
+		typedef_->identifier_location = hcc_ast_binary_read_location(r, typedef_->identifier_location);
+		typedef_->identifier_string_id = hcc_ast_binary_read_string_id(r, typedef_->identifier_string_id);
+	}
+
+	src_elmts = hcc_ast_binary_read_section(r, HCC_AST_BINARY_SECTION_ENUM_VALUES, &count);
+	HccEnumValue* enum_values = hcc_stack_push_many(cu->dtt.enum_values, count);
+	HCC_COPY_ELMT_MANY(enum_values, src_elmts, count);
+	for (uint32_t idx = 0; idx < count; idx += 1) {
+		HccEnumValue* value = &enum_values[idx];
+		value->identifier_location = hcc_ast_binary_read_location(r, value->identifier_location);
+		value->identifier_string_id = hcc_ast_binary_read_string_id(r, value->identifier_string_id);
+	}
+
+	src_elmts = hcc_ast_binary_read_section(r, HCC_AST_BINARY_SECTION_ENUMS, &count);
+	HccEnumDataType* enums = hcc_stack_push_many(cu->dtt.enums, count);
+	HCC_COPY_ELMT_MANY(enums, src_elmts, count);
+	for (uint32_t idx = 0; idx < count; idx += 1) {
+		HccEnumDataType* d = &enums[idx];
+		d->identifier_location = hcc_ast_binary_read_location(r, d->identifier_location);
+		d->identifier_string_id = hcc_ast_binary_read_string_id(r, d->identifier_string_id);
+		d->values = HCC_AST_BINARY_UNSWIZZLE(d->values, cu->dtt.enum_values);
+	}
+
+	src_elmts = hcc_ast_binary_read_section(r, HCC_AST_BINARY_SECTION_POINTERS, &count);
+	HCC_COPY_ELMT_MANY(hcc_stack_push_many(cu->dtt.pointers, count), src_elmts, count);
+
+	src_elmts = hcc_ast_binary_read_section(r, HCC_AST_BINARY_SECTION_FUNCTION_DATA_TYPE_PARAMS, &count);
+	HCC_COPY_ELMT_MANY(hcc_stack_push_many(cu->dtt.function_params, count), src_elmts, count);
+
+	src_elmts = hcc_ast_binary_read_section(r, HCC_AST_BINARY_SECTION_FUNCTION_DATA_TYPES, &count);
+	HccFunctionDataType* function_data_types = hcc_stack_push_many(cu->dtt.functions, count);
+	HCC_COPY_ELMT_MANY(function_data_types, src_elmts, count);
+	for (uint32_t idx = 0; idx < count; idx += 1) {
+		HccFunctionDataType* d = &function_data_types[idx];
+		d->params = HCC_AST_BINARY_UNSWIZZLE(d->params, cu->dtt.function_params);
+	}
+
+	src_elmts = hcc_ast_binary_read_section(r, HCC_AST_BINARY_SECTION_BUFFERS, &count);
+	HCC_COPY_ELMT_MANY(hcc_stack_push_many(cu->dtt.buffers, count), src_elmts, count);
+
+	//
+	// the deduplication tables are rebuilt from the data types with the same keys as the *_deduplicate functions
+	for (uint32_t idx = 0; idx < hcc_stack_count(cu->dtt.arrays); idx += 1) {
+		HccArrayDataType* d = &cu->dtt.arrays[idx];
+		uint64_t key = (uint64_t)d->element_data_type | ((uint64_t)d->element_count_constant_id.idx_plus_one << 32);
+		hcc_ast_binary_read_dedup_entry(cu->dtt.arrays_dedup_hash_table, key, idx);
+	}
+
+	for (uint32_t idx = 0; idx < hcc_stack_count(cu->dtt.pointers); idx += 1) {
+		hcc_ast_binary_read_dedup_entry(cu->dtt.pointers_dedup_hash_table, cu->dtt.pointers[idx].element_data_type, idx);
+	}
+
+	for (uint32_t idx = 0; idx < hcc_stack_count(cu->dtt.functions); idx += 1) {
+		HccFunctionDataType* d = &cu->dtt.functions[idx];
+		uint64_t key = HCC_HASH_WY_64_INIT;
+		key = hcc_hash_wy_64(&d->return_data_type, sizeof(HccDataType), key);
+		for (uint32_t param_idx = 0; param_idx < d->params_count; param_idx += 1) {
+			key = hcc_hash_wy_64(&d->params[param_idx], sizeof(HccDataType), key);
+		}
+		hcc_ast_binary_read_dedup_entry(cu->dtt.functions_dedup_hash_table, key, idx);
+	}
+
+	for (uint32_t idx = 0; idx < hcc_stack_count(cu->dtt.buffers); idx += 1) {
+		hcc_ast_binary_read_dedup_entry(cu->dtt.buffers_dedup_hash_table, cu->dtt.buffers[idx].element_data_type, idx);
+	}
+
+	//
+	// AST
+	hcc_ast_binary_read_variables(r, HCC_AST_BINARY_SECTION_FUNCTION_PARAMS_AND_VARIABLES, cu->ast.function_params_and_variables);
+	hcc_ast_binary_read_variables(r, HCC_AST_BINARY_SECTION_GLOBAL_VARIABLES, cu->ast.global_variables);
+
+	src_elmts = hcc_ast_binary_read_section(r, HCC_AST_BINARY_SECTION_EXPRS, &count);
+	HccASTExpr* exprs = hcc_stack_push_many(cu->ast.exprs, count);
+	HCC_COPY_ELMT_MANY(exprs, src_elmts, count);
+	for (uint32_t idx = 0; idx < count; idx += 1) {
+		hcc_ast_binary_read_expr(r, &exprs[idx]);
+	}
+
+	//
+	// the intrinsic functions are preallocated by hcc_ast_init and the user functions follow on after them
+	HccASTFunction* src_functions = hcc_ast_binary_read_section(r, HCC_AST_BINARY_SECTION_FUNCTIONS, &count);
+	uint32_t* function_idxs = hcc_ast_binary_read_section(r, HCC_AST_BINARY_SECTION_FUNCTION_IDXS, NULL);
+	if (count) {
+		hcc_stack_resize(cu->ast.functions, HCC_MAX(function_idxs[count - 1] + 1, HCC_FUNCTION_IDX_USER_START));
+	}
+	for (uint32_t idx = 0; idx < count; idx += 1) {
+		HccASTFunction* function = &cu->ast.functions[function_idxs[idx]];
+		*function = src_functions[idx];
+		function->identifier_location = hcc_ast_binary_read_location(r, function->identifier_location);
+		function->return_data_type_location = hcc_ast_binary_read_location(r, function->return_data_type_location);
+		function->params_and_variables = HCC_AST_BINARY_UNSWIZZLE(function->params_and_variables, cu->ast.function_params_and_variables);
+		function->identifier_string_id = hcc_ast_binary_read_string_id(r, function->identifier_string_id);
+		function->block_expr = HCC_AST_BINARY_UNSWIZZLE(function->block_expr, cu->ast.exprs);
+	}
+
+	src_elmts = hcc_ast_binary_read_section(r, HCC_AST_BINARY_SECTION_FORWARD_DECLARATIONS, &count);
+	HccASTForwardDecl* forward_decls = hcc_stack_push_many(cu->ast.forward_declarations, count);
+	HCC_COPY_ELMT_MANY(forward_decls, src_elmts, count);
+	for (uint32_t idx = 0; idx < count; idx += 1) {
+		HccASTForwardDecl* forward_decl = &forward_decls[idx];
+		forward_decl->ast_file = forward_decl->ast_file ? r->files[(uintptr_t)forward_decl->ast_file - 1] : NULL;
+		forward_decl->identifier_location = hcc_ast_binary_read_location(r, forward_decl->identifier_location);
+		forward_decl->identifier_string_id = hcc_ast_binary_read_string_id(r, forward_decl->identifier_string_id);
+		forward_decl->function.params = HCC_AST_BINARY_UNSWIZZLE(forward_decl->function.params, cu->ast.function_params_and_variables);
+	}
+
+	src_elmts = hcc_ast_binary_read_section(r, HCC_AST_BINARY_SECTION_DESIGNATED_INITIALIZER_ELMT_INDICES, &count);
+	HCC_COPY_ELMT_MANY(hcc_stack_push_many(cu->ast.designated_initializer_elmt_indices, count), (uint64_t*)src_elmts, count);
+
+	src_elmts = hcc_ast_binary_read_section(r, HCC_AST_BINARY_SECTION_SHADER_FUNCTION_DECLS, &count);
+	HCC_COPY_ELMT_MANY(hcc_stack_push_many(cu->shader_function_decls, count), (HccDecl*)src_elmts, count);
+
+	src_elmts = hcc_ast_binary_read_section(r, HCC_AST_BINARY_SECTION_RESOURCE_STRUCTS, &count);
+	HCC_COPY_ELMT_MANY(hcc_stack_push_many(cu->resource_structs, count), (HccDataType*)src_elmts, count);
+
+	if (include_aml) {
+		hcc_ast_binary_read_aml(r);
+	}
+
+END: {}
+	hcc_stack_deinit(r->string_ids);
+	hcc_stack_deinit(r->persistent_strings);
+	hcc_stack_deinit(r->code_files);
+	hcc_stack_deinit(r->files);
+	return is_success;
+}
@@ -59,7 +59,7 @@ void hcc_astgen_reset(HccWorker* w) {
 void hcc_astgen_error_1(HccWorker* w, HccErrorCode error_code, ...) {
 	va_list va_args;
 	va_start(va_args, error_code);
-	HccLocation* location = hcc_ata_iter_location(w->astgen.token_iter);
+	HccLocation* location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 	hcc_error_pushv(hcc_worker_task(w), error_code, location, NULL, va_args);
 	va_end(va_args);
 }
@@ -74,7 +74,7 @@ void hcc_astgen_error_1_manual(HccWorker* w, HccErrorCode error_code, HccLocatio
 void hcc_astgen_error_2(HccWorker* w, HccErrorCode error_code, HccLocation* other_location, ...) {
 	va_list va_args;
 	va_start(va_args, other_location);
-	HccLocation* location = hcc_ata_iter_location(w->astgen.token_iter);
+	HccLocation* location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 	hcc_error_pushv(hcc_worker_task(w), error_code, location, other_location, va_args);
 	va_end(va_args);
 }
@@ -89,7 +89,7 @@ void hcc_astgen_error_2_manual(HccWorker* w, HccErrorCode error_code, HccLocatio
 void hcc_astgen_warn_1(HccWorker* w, HccWarnCode warn_code, ...) {
 	va_list va_args;
 	va_start(va_args, warn_code);
-	HccLocation* location = hcc_ata_iter_location(w->astgen.token_iter);
+	HccLocation* location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 	hcc_warn_pushv(hcc_worker_task(w), warn_code, location, NULL, va_args);
 	va_end(va_args);
 }
@@ -104,7 +104,7 @@ void hcc_astgen_warn_1_manual(HccWorker* w, HccWarnCode warn_code, HccLocation*
 void hcc_astgen_warn_2(HccWorker* w, HccWarnCode warn_code, HccLocation* other_location, ...) {
 	va_list va_args;
 	va_start(va_args, other_location);
-	HccLocation* location = hcc_ata_iter_location(w->astgen.token_iter);
+	HccLocation* location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 	hcc_warn_pushv(hcc_worker_task(w), warn_code, location, other_location, va_args);
 	va_end(va_args);
 }
@@ -119,7 +119,7 @@ void hcc_astgen_warn_2_manual(HccWorker* w, HccWarnCode warn_code, HccLocation*
 _Noreturn void hcc_astgen_bail_error_1(HccWorker* w, HccErrorCode error_code, ...) {
 	va_list va_args;
 	va_start(va_args, error_code);
-	HccLocation* location = hcc_ata_iter_location(w->astgen.token_iter);
+	HccLocation* location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 	hcc_error_pushv(hcc_worker_task(w), error_code, location, NULL, va_args);
 	va_end(va_args);
 
@@ -138,7 +138,7 @@ _Noreturn void hcc_astgen_bail_error_1_manual(HccWorker* w, HccErrorCode error_c
 _Noreturn void hcc_astgen_bail_error_1_merge_apply(HccWorker* w, HccErrorCode error_code, HccLocation* location, ...) {
 	va_list va_args;
 	va_start(va_args, location);
-	HccLocation* other_location = hcc_ata_iter_location(w->astgen.token_iter);
+	HccLocation* other_location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 	hcc_location_merge_apply(location, other_location);
 	hcc_error_pushv(hcc_worker_task(w), error_code, location, NULL, va_args);
 	va_end(va_args);
@@ -149,7 +149,7 @@ _Noreturn void hcc_astgen_bail_error_1_merge_apply(HccWorker* w, HccErrorCode er
 _Noreturn void hcc_astgen_bail_error_2(HccWorker* w, HccErrorCode error_code, HccLocation* other_location, ...) {
 	va_list va_args;
 	va_start(va_args, other_location);
-	HccLocation* location = hcc_ata_iter_location(w->astgen.token_iter);
+	HccLocation* location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 	hcc_error_pushv(hcc_worker_task(w), error_code, location, other_location, va_args);
 	va_end(va_args);
 
@@ -333,16 +333,16 @@ HccHash64 hcc_astgen_hash_compound_data_type_field(HccCU* cu, HccDataType data_t
 	}
 
 	if (!HCC_DATA_TYPE_IS_COMPOUND(data_type)) {
-		return hcc_hash_fnv_64(&data_type, sizeof(data_type), hash);
+		return hcc_hash_wy_64(&data_type, sizeof(data_type), hash);
 	}
 
 	//
 	// hash all of the compound fields data types but recursively scope in to nested compound data types.
 	// this solves the problem where anonymous compound data types would give back a different hash
 	HccCompoundDataType* cdt = hcc_compound_data_type_get(cu, data_type);
-	hash = hcc_hash_fnv_64(&cdt->size, sizeof(cdt->size), hash);
-	hash = hcc_hash_fnv_64(&cdt->align, sizeof(cdt->align), hash);
-	hash = hcc_hash_fnv_64(&cdt->fields_count, sizeof(cdt->fields_count), hash);
+	hash = hcc_hash_wy_64(&cdt->size, sizeof(cdt->size), hash);
+	hash = hcc_hash_wy_64(&cdt->align, sizeof(cdt->align), hash);
+	hash = hcc_hash_wy_64(&cdt->fields_count, sizeof(cdt->fields_count), hash);
 	for (uint32_t field_idx = 0; field_idx < cdt->fields_count; field_idx += 1) {
 		HccCompoundField* field = &cdt->fields[field_idx];
 		hash = hcc_astgen_hash_compound_data_type_field(cu, field->data_type, hash);
@@ -948,7 +948,7 @@ HccATAToken hcc_astgen_ensure_static_assert(HccWorker* w) {
 	if (hcc_ata_iter_next(w->astgen.token_iter) != HCC_ATA_TOKEN_PARENTHESIS_OPEN) {
 		hcc_astgen_bail_error_1(w, HCC_ERROR_CODE_EXPECTED_PARENTHESIS_OPEN_STATIC_ASSERT);
 	}
-	HccLocation* cond_location_before = hcc_ata_iter_location(w->astgen.token_iter);
+	HccLocation* cond_location_before = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 	hcc_ata_iter_next(w->astgen.token_iter);
 
 	HccASTExpr* cond_expr = hcc_astgen_generate_expr_no_comma_operator(w, 0);
@@ -981,7 +981,7 @@ HccATAToken hcc_astgen_ensure_static_assert(HccWorker* w) {
 	if (token != HCC_ATA_TOKEN_PARENTHESIS_CLOSE) {
 		hcc_astgen_bail_error_1(w, HCC_ERROR_CODE_EXPECTED_PARENTHESIS_CLOSE_STATIC_ASSERT);
 	}
-	HccLocation* cond_location_after = hcc_ata_iter_location(w->astgen.token_iter);
+	HccLocation* cond_location_after = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 	HccString cond_string = hcc_string(
 		&cond_location_before->code_file->code.data[cond_location_before->code_start_idx + 1],
 		cond_location_after->code_end_idx - cond_location_before->code_start_idx - 2
@@ -1066,7 +1066,7 @@ HccATAToken hcc_astgen_curly_initializer_start(HccWorker* w, HccDataType data_ty
 	gen->first_initializer_expr = NULL;
 	gen->prev_initializer_expr = NULL;
 	gen->nested_elmts_start_idx = hcc_stack_count(gen->nested_elmts);
-	HccASTExpr* initializer_expr = hcc_astgen_curly_initializer_generate_designated_initializer(w, hcc_ata_iter_location(w->astgen.token_iter));
+	HccASTExpr* initializer_expr = hcc_astgen_curly_initializer_generate_designated_initializer(w, hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter));
 	initializer_expr->designated_initializer.value_expr = NULL;
 
 	return hcc_astgen_curly_initializer_open(w);
@@ -1548,7 +1548,7 @@ HccDataType hcc_astgen_generate_enum_data_type(HccWorker* w) {
 	} else {
 MAKE_NEW: {}
 		HCC_ZERO_ELMT(&enum_data_type);
-		enum_data_type.identifier_location = hcc_ata_iter_location(w->astgen.token_iter);
+		enum_data_type.identifier_location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 		enum_data_type.identifier_string_id = identifier_string_id;
 		is_new = true;
 	}
@@ -1595,9 +1595,9 @@ MAKE_NEW: {}
 		}
 
 		HccStringId value_identifier_string_id = hcc_ata_iter_next_value(w->astgen.token_iter).string_id;
-		enum_value->identifier_location = hcc_ata_iter_location(w->astgen.token_iter);
+		enum_value->identifier_location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 		enum_value->identifier_string_id = value_identifier_string_id;
-		enum_data_type.value_identifiers_hash = hcc_hash_fnv_64(&value_identifier_string_id, sizeof(value_identifier_string_id), enum_data_type.value_identifiers_hash);
+		enum_data_type.value_identifiers_hash = hcc_hash_wy_64(&value_identifier_string_id, sizeof(value_identifier_string_id), enum_data_type.value_identifiers_hash);
 
 		token = hcc_ata_iter_next(w->astgen.token_iter);
 		bool has_explicit_value = token == HCC_ATA_TOKEN_EQUAL;
@@ -1623,7 +1623,7 @@ MAKE_NEW: {}
 		HccBasic v = hcc_basic_from_sint(w->cu, HCC_DATA_TYPE_AST_BASIC_SINT, next_value);
 
 		HccConstantId value_constant_id = hcc_constant_table_deduplicate_basic(w->cu, HCC_DATA_TYPE_AST_BASIC_SINT, &v);
-		enum_data_type.values_hash = hcc_hash_fnv_64(&value_constant_id, sizeof(value_constant_id), enum_data_type.values_hash);
+		enum_data_type.values_hash = hcc_hash_wy_64(&value_constant_id, sizeof(value_constant_id), enum_data_type.values_hash);
 
 		enum_value->constant_id = value_constant_id;
 		next_value += 1;
@@ -1721,7 +1721,7 @@ MAKE_NEW: {}
 }
 
 HccDataType hcc_astgen_generate_compound_data_type(HccWorker* w) {
-	HccLocation* compound_data_type_location = hcc_ata_iter_location(w->astgen.token_iter);
+	HccLocation* compound_data_type_location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 	HccATAToken token = hcc_ata_iter_peek(w->astgen.token_iter);
 	bool is_union = false;
 	switch (token) {
@@ -1741,7 +1741,7 @@ HccDataType hcc_astgen_generate_compound_data_type(HccWorker* w) {
 	HccDeclEntry* table_entry = NULL; // will be NULL when is anonymous
 	HccCU* cu = w->cu;
 	if (token == HCC_ATA_TOKEN_IDENT) {
-		compound_data_type_location = hcc_ata_iter_location(w->astgen.token_iter);
+		compound_data_type_location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 		identifier_string_id = hcc_ata_iter_next_value(w->astgen.token_iter).string_id;
 		token = hcc_ata_iter_next(w->astgen.token_iter);
 
@@ -2009,10 +2009,10 @@ HccDataType hcc_astgen_generate_compound_data_type(HccWorker* w) {
 			compound_field->identifier_string_id.idx_plus_one = 0;
 		} else {
 			HccStringId field_identifier_string_id = hcc_ata_iter_next_value(w->astgen.token_iter).string_id;
-			compound_field->identifier_location = hcc_ata_iter_location(w->astgen.token_iter);
+			compound_field->identifier_location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 			compound_field->identifier_string_id = field_identifier_string_id;
 
-			compound_data_type.field_identifiers_hash = hcc_hash_fnv_64(&field_identifier_string_id, sizeof(field_identifier_string_id), compound_data_type.field_identifiers_hash);
+			compound_data_type.field_identifiers_hash = hcc_hash_wy_64(&field_identifier_string_id, sizeof(field_identifier_string_id), compound_data_type.field_identifiers_hash);
 
 			token = hcc_ata_iter_next(w->astgen.token_iter);
 			compound_field->data_type = hcc_astgen_generate_array_data_type_if_exists(w, compound_field->data_type, false);
@@ -2404,7 +2404,7 @@ HccATAToken hcc_astgen_generate_type_specifiers_post_qualifiers(HccWorker* w, Hc
 }
 
 HccDataType hcc_astgen_generate_data_type(HccWorker* w, HccErrorCode error_code, bool want_concrete_type) {
-	HccLocation* location = hcc_ata_iter_location(w->astgen.token_iter);
+	HccLocation* location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 	HccASTGenTypeSpecifier type_specifiers = 0;
 	HccATAToken token = hcc_astgen_generate_type_specifiers(w, location, &type_specifiers);
 
@@ -2828,7 +2828,7 @@ HccDataType hcc_astgen_generate_pointer_data_type_if_exists(HccWorker* w, HccDat
 	hcc_ata_iter_next(w->astgen.token_iter);
 
 	if (w->astgen.allow_pointer) {
-		w->astgen.prev_pointer_data_type_location = hcc_ata_iter_location(w->astgen.token_iter);
+		w->astgen.prev_pointer_data_type_location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 	} else {
 		hcc_astgen_bail_error_1(w, HCC_ERROR_CODE_POINTERS_NOT_SUPPORTED);
 	}
@@ -2839,7 +2839,7 @@ HccDataType hcc_astgen_generate_pointer_data_type_if_exists(HccWorker* w, HccDat
 
 	HccDataType resolved_element_data_type = hcc_decl_resolve_and_strip_qualifiers(w->cu, element_data_type);
 	HccDataType data_type = hcc_pointer_data_type_deduplicate(w->cu, element_data_type);
-	HccLocation* location = hcc_ata_iter_location(w->astgen.token_iter);
+	HccLocation* location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 	HccASTGenTypeSpecifier type_specifiers = 0;
 	token = hcc_astgen_generate_type_specifiers(w, location, &type_specifiers);
 	if (type_specifiers & HCC_ASTGEN_TYPE_SPECIFIER_CONST) {
@@ -2924,7 +2924,7 @@ HccDataType hcc_astgen_generate_typedef_with_data_type(HccWorker* w, HccDataType
 	if (token != HCC_ATA_TOKEN_IDENT) {
 		hcc_astgen_bail_error_1(w, HCC_ERROR_CODE_EXPECTED_IDENTIFIER_TYPEDEF, hcc_ata_token_strings[token]);
 	}
-	HccLocation* identifier_location = hcc_ata_iter_location(w->astgen.token_iter);
+	HccLocation* identifier_location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 	HccStringId identifier_string_id = hcc_ata_iter_next_value(w->astgen.token_iter).string_id;
 	hcc_ata_iter_next(w->astgen.token_iter);
 	aliased_data_type = hcc_astgen_generate_array_data_type_if_exists(w, aliased_data_type, false);
@@ -3014,7 +3014,7 @@ void hcc_astgen_generate_implicit_cast(HccWorker* w, HccDataType dst_data_type,
 	HccASTExpr* cast_expr = hcc_astgen_alloc_expr(w, HCC_AST_EXPR_TYPE_CAST);
 	cast_expr->cast_.expr = expr;
 	cast_expr->data_type = dst_data_type;
-	cast_expr->location = hcc_ata_iter_location(w->astgen.token_iter);
+	cast_expr->location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 	*expr_mut = cast_expr;
 }
 
@@ -3147,7 +3147,7 @@ HccASTExpr* hcc_astgen_generate_unary_expr(HccWorker* w) {
 			HccASTExpr* expr = hcc_astgen_alloc_expr(w, HCC_AST_EXPR_TYPE_CONSTANT);
 			expr->constant.id = constant_id;
 			expr->data_type = data_type;
-			expr->location = hcc_ata_iter_location(w->astgen.token_iter);
+			expr->location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 			hcc_ata_iter_next(w->astgen.token_iter);
 			return expr;
 		};
@@ -3161,14 +3161,14 @@ HccASTExpr* hcc_astgen_generate_unary_expr(HccWorker* w) {
 			HccASTExpr* expr = hcc_astgen_alloc_expr(w, HCC_AST_EXPR_TYPE_CONSTANT);
 			expr->constant.id = hcc_constant_table_deduplicate_bytes(w->cu, data_type, (uint8_t*)string.data, string.size);
 			expr->data_type = data_type;
-			expr->location = hcc_ata_iter_location(w->astgen.token_iter);
+			expr->location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 			hcc_ata_iter_next(w->astgen.token_iter);
 
 			return expr;
 		};
 		case HCC_ATA_TOKEN_IDENT: {
 			HccATAValue identifier_value = hcc_ata_iter_next_value(w->astgen.token_iter);
-			HccLocation* location = hcc_ata_iter_location(w->astgen.token_iter);
+			HccLocation* location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 			hcc_ata_iter_next(w->astgen.token_iter);
 
 			HccDecl existing_variable_decl = hcc_astgen_variable_stack_find(w, identifier_value.string_id);
@@ -3246,7 +3246,7 @@ HccASTExpr* hcc_astgen_generate_unary_expr(HccWorker* w) {
 UNARY:
 		{
 			HccATAToken operator_token = token;
-			HccLocation* location = hcc_ata_iter_location(w->astgen.token_iter);
+			HccLocation* location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 			hcc_ata_iter_next(w->astgen.token_iter);
 			uint8_t precedence = hcc_ast_unary_op_precedence[unary_op];
 
@@ -3257,7 +3257,7 @@ UNARY:
 			return hcc_astgen_generate_unary_op(w, inner_expr, unary_op, operator_token, location);
 		};
 		case HCC_ATA_TOKEN_PARENTHESIS_OPEN: {
-			HccLocation* location = hcc_ata_iter_location(w->astgen.token_iter);
+			HccLocation* location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 			hcc_ata_iter_next(w->astgen.token_iter);
 			HccASTExpr* expr = hcc_astgen_generate_expr(w, 0);
 			HccATAToken token = hcc_ata_iter_peek(w->astgen.token_iter);
@@ -3308,7 +3308,7 @@ UNARY:
 			HccDataType resolved_assign_data_type = hcc_decl_resolve_and_keep_qualifiers(w->cu, assign_data_type);
 			w->astgen.assign_data_type = HCC_DATA_TYPE_AST_BASIC_VOID;
 			HccASTGenCurlyInitializer* gen = &w->astgen.curly_initializer;
-			HccLocation* location = hcc_ata_iter_location(w->astgen.token_iter);
+			HccLocation* location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 			hcc_astgen_data_type_ensure_valid_variable(w, assign_data_type, HCC_ERROR_CODE_INVALID_DATA_TYPE_FOR_VARIABLE);
 
 			bool old_is_last_elmt_a_bitfield = gen->is_last_elmt_a_bitfield;
@@ -3339,7 +3339,7 @@ UNARY:
 
 				gen->is_last_elmt_a_bitfield = false;
 				gen->is_last_elmt_a_swizzle = false;
-				location = hcc_ata_iter_location(w->astgen.token_iter);
+				location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 				bool found_designator = token == HCC_ATA_TOKEN_FULL_STOP || token == HCC_ATA_TOKEN_SQUARE_OPEN;
 				if (found_designator) {
 					token = hcc_astgen_curly_initializer_next_elmt_with_designator(w);
@@ -3592,7 +3592,7 @@ CURLY_INITIALIZER_FINISH: {}
 			HccASTExpr* default_stmt = NULL;
 			while (1) {
 				HccASTExpr* case_stmt = hcc_astgen_alloc_expr(w, HCC_AST_EXPR_TYPE_STMT_GENERIC_CASE);
-				case_stmt->location = hcc_ata_iter_location(w->astgen.token_iter);
+				case_stmt->location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 
 				token = hcc_ata_iter_peek(w->astgen.token_iter);
 				if (token == HCC_ATA_TOKEN_KEYWORD_DEFAULT) {
@@ -3680,7 +3680,7 @@ CURLY_INITIALIZER_FINISH: {}
 		case HCC_ATA_TOKEN_KEYWORD_STRUCT:
 		case HCC_ATA_TOKEN_KEYWORD_UNION:
 		default: {
-			HccLocation* location = hcc_ata_iter_location(w->astgen.token_iter);
+			HccLocation* location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 			HccDataType data_type = hcc_astgen_generate_data_type(w, HCC_ERROR_CODE_EXPECTED_EXPR, true);
 			data_type = hcc_astgen_generate_array_data_type_if_exists(w, data_type, false);
 			HccASTExpr* expr = hcc_astgen_alloc_expr(w, HCC_AST_EXPR_TYPE_DATA_TYPE);
@@ -3856,7 +3856,7 @@ void hcc_astgen_generate_binary_op(HccWorker* w, HccASTBinaryOp* binary_op_out,
 
 HccASTExpr* hcc_astgen_generate_call_expr(HccWorker* w, HccASTExpr* function_expr) {
 	HCC_DEBUG_ASSERT(function_expr->type == HCC_AST_EXPR_TYPE_FUNCTION, "TODO: function pointer support");
-	HccLocation* location = hcc_ata_iter_location(w->astgen.token_iter);
+	HccLocation* location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 	HccDecl function_decl = function_expr->function.decl;
 	HccDataType return_data_type = hcc_decl_return_data_type(w->cu, function_decl);
 	HccASTVariable* params_array = hcc_decl_function_params(w->cu, function_decl);
@@ -3974,7 +3974,7 @@ HccASTExpr* hcc_astgen_generate_array_subscript_expr(HccWorker* w, HccASTExpr* a
 	expr->binary.left_expr = array_expr;
 	expr->binary.right_expr = index_expr;
 	expr->data_type = element_data_type | (resolved_data_type & HCC_DATA_TYPE_QUALIFIERS_MASK);
-	expr->location = hcc_ata_iter_location(w->astgen.token_iter);
+	expr->location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 	return expr;
 }
 
@@ -3991,7 +3991,7 @@ HccASTExpr* hcc_astgen_generate_field_access_expr(HccWorker* w, HccASTExpr* left
 		data_type = hcc_data_type_strip_pointer(w->cu, left_expr->data_type);
 	}
 
-	HccLocation* location = hcc_ata_iter_location(w->astgen.token_iter);
+	HccLocation* location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 
 	HccStringId identifier_string_id = hcc_ata_iter_next_value(w->astgen.token_iter).string_id;
 	HccDataType qualifier_mask = data_type & HCC_DATA_TYPE_QUALIFIERS_MASK;
@@ -4065,7 +4065,7 @@ HccASTExpr* hcc_astgen_generate_ternary_expr(HccWorker* w, HccASTExpr* cond_expr
 	if (token != HCC_ATA_TOKEN_COLON) {
 		hcc_astgen_bail_error_1(w, HCC_ERROR_CODE_MISSING_COLON_TERNARY_OP);
 	}
-	HccLocation* location = hcc_ata_iter_location(w->astgen.token_iter);
+	HccLocation* location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 	token = hcc_ata_iter_next(w->astgen.token_iter);
 
 	HccASTExpr* false_expr = hcc_astgen_generate_expr_no_comma_operator(w, 0);
@@ -4112,7 +4112,7 @@ HccASTExpr* hcc_astgen_generate_ternary_expr(HccWorker* w, HccASTExpr* cond_expr
 }
 
 HccASTExpr* hcc_astgen_generate_expr_(HccWorker* w, uint32_t min_precedence, bool no_comma_operator) {
-	HccLocation* callee_location = hcc_ata_iter_location(w->astgen.token_iter);
+	HccLocation* callee_location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 	HccASTExpr* left_expr = hcc_astgen_generate_unary_expr(w);
 	if (left_expr->type == HCC_AST_EXPR_TYPE_DATA_TYPE) {
 		goto RETURN;
@@ -4122,7 +4122,7 @@ HccASTExpr* hcc_astgen_generate_expr_(HccWorker* w, uint32_t min_precedence, boo
 		HccASTBinaryOp binary_op;
 		uint32_t precedence;
 		bool is_assign;
-		HccLocation* location = hcc_ata_iter_location(w->astgen.token_iter);
+		HccLocation* location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 		HccATAToken operator_token = hcc_ata_iter_peek(w->astgen.token_iter);
 		if (no_comma_operator && operator_token == HCC_ATA_TOKEN_COMMA) {
 			goto RETURN;
@@ -4131,12 +4131,12 @@ HccASTExpr* hcc_astgen_generate_expr_(HccWorker* w, uint32_t min_precedence, boo
 		switch (operator_token) {
 			case HCC_ATA_TOKEN_INCREMENT:
 				hcc_astgen_data_type_ensure_readable(w, left_expr);
-				left_expr = hcc_astgen_generate_unary_op(w, left_expr, HCC_AST_UNARY_OP_POST_INCREMENT, operator_token, hcc_ata_iter_location(w->astgen.token_iter));
+				left_expr = hcc_astgen_generate_unary_op(w, left_expr, HCC_AST_UNARY_OP_POST_INCREMENT, operator_token, hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter));
 				hcc_ata_iter_next(w->astgen.token_iter);
 				continue;
 			case HCC_ATA_TOKEN_DECREMENT:
 				hcc_astgen_data_type_ensure_readable(w, left_expr);
-				left_expr = hcc_astgen_generate_unary_op(w, left_expr, HCC_AST_UNARY_OP_POST_DECREMENT, operator_token, hcc_ata_iter_location(w->astgen.token_iter));
+				left_expr = hcc_astgen_generate_unary_op(w, left_expr, HCC_AST_UNARY_OP_POST_DECREMENT, operator_token, hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter));
 				hcc_ata_iter_next(w->astgen.token_iter);
 				continue;
 		}
@@ -4301,7 +4301,7 @@ HccDecl hcc_astgen_generate_variable_decl(HccWorker* w, bool is_global, HccDataT
 	HccATAToken token = hcc_ata_iter_peek(w->astgen.token_iter);
 	HCC_DEBUG_ASSERT(token == HCC_ATA_TOKEN_IDENT, "internal error: expected '%s' at the start of generating a variable", hcc_ata_token_strings[HCC_ATA_TOKEN_IDENT]);
 	HccStringId identifier_string_id = hcc_ata_iter_next_value(w->astgen.token_iter).string_id;
-	HccLocation* identifier_location = hcc_ata_iter_location(w->astgen.token_iter);
+	HccLocation* identifier_location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 
 	token = hcc_ata_iter_next(w->astgen.token_iter);
 	if (w->astgen.specifier_flags & HCC_ASTGEN_SPECIFIER_FLAGS_ALL_NON_VARIABLE_SPECIFIERS) {
@@ -4602,7 +4602,7 @@ HccASTExpr* hcc_astgen_generate_variable_decl_stmt(HccWorker* w, HccDataType dat
 
 	HccDataType element_data_type = hcc_data_type_strip_all_pointers(w->cu, data_type);
 	while (1) {
-		HccLocation* location = hcc_ata_iter_location(w->astgen.token_iter);
+		HccLocation* location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 		HccDecl decl = hcc_astgen_generate_variable_decl(w, false, element_data_type, &data_type, &init_expr);
 		if (init_expr) {
 			HccASTExpr* left_expr = hcc_astgen_alloc_expr(w, HCC_AST_EXPR_TYPE_LOCAL_VARIABLE);
@@ -4625,7 +4625,7 @@ HccASTExpr* hcc_astgen_generate_variable_decl_stmt(HccWorker* w, HccDataType dat
 				expr->binary.is_swizzle = false;
 				expr->binary.left_expr = prev_expr;
 				expr->binary.right_expr = stmt;
-				expr->location = hcc_ata_iter_location(w->astgen.token_iter);
+				expr->location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 				prev_expr = expr;
 			} else {
 				prev_expr = stmt;
@@ -4654,7 +4654,7 @@ HccASTExpr* hcc_astgen_generate_stmt(HccWorker* w) {
 			HccASTExpr* prev_stmt_block = w->astgen.stmt_block;
 
 			stmt_block->is_stmt = true;
-			stmt_block->location = hcc_ata_iter_location(w->astgen.token_iter);
+			stmt_block->location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 
 			w->astgen.stmt_block = stmt_block;
 
@@ -4690,14 +4690,14 @@ HccASTExpr* hcc_astgen_generate_stmt(HccWorker* w) {
 			HccLocation* location;
 			if (token == HCC_ATA_TOKEN_SEMICOLON) {
 				expr = NULL;
-				location = hcc_ata_iter_location(w->astgen.token_iter);
+				location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 				token = hcc_ata_iter_next(w->astgen.token_iter);
 				if (w->astgen.function->return_data_type != HCC_DATA_TYPE_AST_BASIC_VOID) {
 					HccString return_data_type_name = hcc_data_type_string(w->cu, w->astgen.function->return_data_type);
 					hcc_astgen_bail_error_2(w, HCC_ERROR_CODE_MISSING_RETURN_EXPR, w->astgen.function->identifier_location, (int)return_data_type_name.size, return_data_type_name.data);
 				}
 			} else {
-				location = hcc_ata_iter_location(w->astgen.token_iter);
+				location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 				expr = hcc_astgen_generate_expr(w, 0);
 				hcc_astgen_data_type_ensure_readable(w, expr);
 				hcc_astgen_data_type_ensure_compatible_assignment(w, w->astgen.function->return_data_type_location, w->astgen.function->return_data_type, &expr);
@@ -4713,7 +4713,7 @@ HccASTExpr* hcc_astgen_generate_stmt(HccWorker* w) {
 		};
 		case HCC_ATA_TOKEN_KEYWORD_IF: {
 			HccASTExpr* stmt = hcc_astgen_alloc_expr(w, HCC_AST_EXPR_TYPE_STMT_IF);
-			HccLocation* location = hcc_ata_iter_location(w->astgen.token_iter);
+			HccLocation* location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 
 			w->astgen.function->max_instrs_count += 3; // HCC_AML_OP_BRANCH_CONDITIONAL, true_block_end: HCC_AML_OP_BRANCH, false_block_end: HCC_AML_OP_BRANCH
 
@@ -4740,7 +4740,7 @@ HccASTExpr* hcc_astgen_generate_stmt(HccWorker* w) {
 		};
 		case HCC_ATA_TOKEN_KEYWORD_SWITCH: {
 			HccASTExpr* stmt = hcc_astgen_alloc_expr(w, HCC_AST_EXPR_TYPE_STMT_SWITCH);
-			HccLocation* location = hcc_ata_iter_location(w->astgen.token_iter);
+			HccLocation* location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 			token = hcc_ata_iter_next(w->astgen.token_iter);
 			w->astgen.function->max_instrs_count += 1; // HCC_AML_OP_SWITCH
 
@@ -4794,7 +4794,7 @@ HccASTExpr* hcc_astgen_generate_stmt(HccWorker* w) {
 		};
 		case HCC_ATA_TOKEN_KEYWORD_DO: {
 			HccASTExpr* stmt = hcc_astgen_alloc_expr(w, HCC_AST_EXPR_TYPE_STMT_WHILE);
-			HccLocation* location = hcc_ata_iter_location(w->astgen.token_iter);
+			HccLocation* location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 
 			w->astgen.function->max_instrs_count += 2; // HCC_AML_OP_BRANCH_CONDITIONAL + HCC_AML_OP_BRANCH
 
@@ -4823,7 +4823,7 @@ HccASTExpr* hcc_astgen_generate_stmt(HccWorker* w) {
 		};
 		case HCC_ATA_TOKEN_KEYWORD_WHILE: {
 			HccASTExpr* stmt = hcc_astgen_alloc_expr(w, HCC_AST_EXPR_TYPE_STMT_WHILE);
-			HccLocation* location = hcc_ata_iter_location(w->astgen.token_iter);
+			HccLocation* location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 
 			w->astgen.function->max_instrs_count += 2; // HCC_AML_OP_BRANCH_CONDITIONAL + HCC_AML_OP_BRANCH
 
@@ -4848,7 +4848,7 @@ HccASTExpr* hcc_astgen_generate_stmt(HccWorker* w) {
 			w->astgen.function->max_instrs_count += 2; // HCC_AML_OP_BRANCH_CONDITIONAL + HCC_AML_OP_BRANCH
 
 			HccASTExpr* stmt = hcc_astgen_alloc_expr(w, HCC_AST_EXPR_TYPE_STMT_FOR);
-			HccLocation* location = hcc_ata_iter_location(w->astgen.token_iter);
+			HccLocation* location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 
 			token = hcc_ata_iter_next(w->astgen.token_iter);
 
@@ -4970,7 +4970,7 @@ HccASTExpr* hcc_astgen_generate_stmt(HccWorker* w) {
 			w->astgen.function->max_instrs_count += 1; // HCC_AML_OP_BRANCH
 
 			HccASTExpr* stmt = hcc_astgen_alloc_expr(w, HCC_AST_EXPR_TYPE_STMT_DEFAULT);
-			stmt->location = hcc_ata_iter_location(w->astgen.token_iter);
+			stmt->location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 			stmt->is_stmt = true;
 
 			token = hcc_ata_iter_next(w->astgen.token_iter);
@@ -4988,7 +4988,7 @@ HccASTExpr* hcc_astgen_generate_stmt(HccWorker* w) {
 			}
 			HccASTExpr* stmt = hcc_astgen_alloc_expr(w, HCC_AST_EXPR_TYPE_STMT_BREAK);
 			stmt->is_stmt = true;
-			stmt->location = hcc_ata_iter_location(w->astgen.token_iter);
+			stmt->location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 			hcc_ata_iter_next(w->astgen.token_iter);
 			hcc_astgen_ensure_semicolon(w);
 			return stmt;
@@ -4999,7 +4999,7 @@ HccASTExpr* hcc_astgen_generate_stmt(HccWorker* w) {
 			}
 			HccASTExpr* stmt = hcc_astgen_alloc_expr(w, HCC_AST_EXPR_TYPE_STMT_CONTINUE);
 			stmt->is_stmt = true;
-			stmt->location = hcc_ata_iter_location(w->astgen.token_iter);
+			stmt->location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 			hcc_ata_iter_next(w->astgen.token_iter);
 			hcc_astgen_ensure_semicolon(w);
 			w->astgen.function->max_instrs_count += 1; // HCC_AML_OP_BRANCH
@@ -5043,8 +5043,8 @@ void hcc_astgen_generate_function(HccWorker* w, HccDataType return_data_type, Hc
 	HccATAToken token = hcc_ata_iter_peek(w->astgen.token_iter);
 	HCC_DEBUG_ASSERT(token == HCC_ATA_TOKEN_IDENT, "internal error: expected '%s' at the start of generating a function", hcc_ata_token_strings[HCC_ATA_TOKEN_IDENT]);
 	HccStringId identifier_string_id = hcc_ata_iter_next_value(w->astgen.token_iter).string_id;
-	HccLocation* identifier_location = hcc_ata_iter_location(w->astgen.token_iter);
-	HccLocation* params_location = hcc_ata_iter_location(w->astgen.token_iter);
+	HccLocation* identifier_location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
+	HccLocation* params_location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 
 	bool found_static = false;
 	bool found_extern = false;
@@ -5088,6 +5088,7 @@ void hcc_astgen_generate_function(HccWorker* w, HccDataType return_data_type, Hc
 	w->astgen.function = &function;
 	function.identifier_location = identifier_location;
 	function.shader_stage = shader_stage;
+	function.opt_level = hcc_options_get_u32(cu->options, HCC_OPTION_KEY_OPT_LEVEL);
 	function.flags = flags;
 	function.linkage = found_static ? HCC_AST_LINKAGE_INTERNAL : HCC_AST_LINKAGE_EXTERNAL;
 
@@ -5146,7 +5147,7 @@ void hcc_astgen_generate_function(HccWorker* w, HccDataType return_data_type, Hc
 				hcc_astgen_bail_error_1(w, HCC_ERROR_CODE_EXPECTED_IDENTIFIER_FUNCTION_PARAM);
 			}
 			HccStringId param_identifier_string_id = hcc_ata_iter_next_value(w->astgen.token_iter).string_id;
-			HccLocation* param_identifier_location = hcc_ata_iter_location(w->astgen.token_iter);
+			HccLocation* param_identifier_location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 
 			HccDecl existing_variable_decl = hcc_astgen_variable_stack_find(w, param_identifier_string_id);
 			if (existing_variable_decl) {
@@ -5546,7 +5547,7 @@ void hcc_astgen_generate(HccWorker* w) {
 				w->astgen.allow_pointer = true;
 				HccDataType data_type = hcc_astgen_generate_data_type(w, HCC_ERROR_CODE_UNEXPECTED_TOKEN, true);
 				w->astgen.allow_pointer = false;
-				HccLocation* data_type_location = hcc_ata_iter_location(w->astgen.token_iter);
+				HccLocation* data_type_location = hcc_ata_iter_worker_location(w->cu, w, w->astgen.token_iter);
 				token = hcc_astgen_generate_specifiers(w);
 				bool ensure_semi_colon = true;
 				if (token == HCC_ATA_TOKEN_IDENT) {
@@ -34,10 +34,18 @@ void hcc_astlink_link_file(HccWorker* w) {
 	HccASTFile* ast_file = w->job.arg;
 	HccCU* cu = w->cu;
 
+	//
+	// other files can still be in ASTGEN and publishing their definitions to the compilation unit.
+	// so only report a declaration as undefined when every file has finished ASTGEN.
+	bool is_final_link = atomic_load(&cu->ast.astgen_files_left_count) == 0;
+
+LINK_AGAIN: {}
 	//
 	// loop over all of the forward declared global variables and functions for this HccASTFile
 	// and add the resolved definition to the HccASTFile.global_declarations hash table.
+	// any declaration that cannot be resolved yet is kept at the front of the array for the next link.
 	uint32_t decls_to_link_count = hcc_stack_count(ast_file->forward_declarations_to_link);
+	uint32_t unresolved_decls_count = 0;
 	for (uint32_t decls_to_link_idx = 0; decls_to_link_idx < decls_to_link_count; decls_to_link_idx += 1) {
 		HccDecl decl = ast_file->forward_declarations_to_link[decls_to_link_idx];
 		HccASTForwardDecl* forward_decl = hcc_ast_forward_decl_get(cu, decl);
@@ -68,15 +76,20 @@ void hcc_astlink_link_file(HccWorker* w) {
 			// try and find the definition for the forward declaration in the compiliation unit
 			//
 
-			//
-			// cast away the HccAtomic as this hash table is read-only during the phase of the compiler.
-			HccDeclEntryAtomicLink** link_ptr = (HccDeclEntryAtomicLink**)&cu->global_declarations[found_idx].link;
+			HccAtomic(HccDeclEntryAtomicLink*)* link_ptr = &cu->global_declarations[found_idx].link;
 			while (1) {
-				HccDeclEntryAtomicLink* link = *link_ptr;
+				HccDeclEntryAtomicLink* link = atomic_load(link_ptr);
 				if (link == NULL) {
 					break;
 				}
 
+				//
+				// wait if another thread in ASTGEN is setting up the atomic link
+				while (link == HCC_DECL_ENTRY_ATOMIC_LINK_SENTINAL) {
+					HCC_CPU_RELAX();
+					link = atomic_load(link_ptr);
+				}
+
 				if (HCC_DECL_TYPE(decl) == HCC_DECL_TYPE(link->decl)) {
 					switch (HCC_DECL_TYPE(decl)) {
 						case HCC_DECL_FUNCTION: {
@@ -133,11 +146,17 @@ void hcc_astlink_link_file(HccWorker* w) {
 					}
 				}
 
-				link_ptr = (HccDeclEntryAtomicLink**)&link->next;
+				link_ptr = &link->next;
 			}
 		}
 
 LINK_DECL_END:
+		if (found_decl == 0 && !is_final_link) {
+			ast_file->forward_declarations_to_link[unresolved_decls_count] = decl;
+			unresolved_decls_count += 1;
+			goto NEXT_FORWARD_DECL;
+		}
+
 		if (found_decl == 0) {
 			//
 			// FUTURE: if we target a proper OS in future, we would skip this error if we have legacy kind of linking.
@@ -152,5 +171,22 @@ LINK_DECL_END:
 
 NEXT_FORWARD_DECL: {}
 	}
+	hcc_stack_resize(ast_file->forward_declarations_to_link, unresolved_decls_count);
+
+	if (unresolved_decls_count) {
+		//
+		// check again under the lock, the last file could have finished ASTGEN while we were linking.
+		// otherwise the deferred file is given back out as a job when the last file finishes ASTGEN.
+		hcc_spin_mutex_lock(&cu->ast.link_deferred_files_mutex);
+		is_final_link = atomic_load(&cu->ast.astgen_files_left_count) == 0;
+		if (!is_final_link) {
+			*hcc_stack_push(cu->ast.link_deferred_files) = ast_file;
+		}
+		hcc_spin_mutex_unlock(&cu->ast.link_deferred_files_mutex);
+
+		if (is_final_link) {
+			goto LINK_AGAIN;
+		}
+	}
 }
 
@@ -375,6 +375,7 @@ HccATAIter* hcc_ata_iter_start(HccASTFile* file) {
 	iter->tokens = file->token_bag.tokens;
 	iter->locations = file->token_bag.locations;
 	iter->values = file->token_bag.values;
+	HCC_ZERO_ELMT(&iter->location_decode_cache);
 	iter->token_idx = 0;
 	iter->value_idx = 0;
 	iter->tokens_count = hcc_stack_count(file->token_bag.tokens);
@@ -414,8 +415,23 @@ HccATAToken hcc_ata_iter_peek_ahead(HccATAIter* iter, uint32_t by) {
 	return iter->tokens[iter->token_idx + by];
 }
 
-HccLocation* hcc_ata_iter_location(HccATAIter* iter) {
-	return HCC_PP_TOKEN_STRIP_PREEXPANDED_MACRO_ARG(iter->locations[iter->token_idx]);
+HccLocation* hcc_ata_iter_location(HccCU* cu, HccATAIter* iter) {
+	return hcc_ata_iter_worker_location(cu, NULL, iter);
+}
+
+HccLocation* hcc_ata_iter_worker_location(HccCU* cu, HccWorker* w, HccATAIter* iter) {
+	HccLocationId location_id = HCC_PP_TOKEN_STRIP_PREEXPANDED_MACRO_ARG(iter->locations[iter->token_idx]);
+	if (location_id == HCC_LOCATION_ID_NULL || (location_id & HCC_LOCATION_ID_FULL_BIT)) {
+		return hcc_location_table_get(cu, location_id);
+	}
+
+	//
+	// swap the offset for the full location we just decoded,
+	// so asking for the same token again returns the same location.
+	HccLocation* location = w ? hcc_worker_alloc_location(w) : hcc_location_table_alloc(cu);
+	hcc_location_table_decode(cu, location_id, location, &iter->location_decode_cache);
+	iter->locations[iter->token_idx] = hcc_location_table_id(cu, location) | (iter->locations[iter->token_idx] & HCC_LOCATION_ID_PP_BIT);
+	return location;
 }
 
 HccATAValue hcc_ata_iter_next_value(HccATAIter* iter) {
@@ -452,7 +468,7 @@ uint32_t hcc_ata_token_cursor_tokens_count(HccATATokenCursor* cursor) {
 
 void hcc_ata_token_bag_init(HccATATokenBag* bag, uint32_t tokens_grow_count, uint32_t tokens_reserve_cap, uint32_t values_grow_count, uint32_t values_reserve_cap) {
 	bag->tokens = hcc_stack_init(HccATAToken, HCC_ALLOC_TAG_ATA_TOKEN_BAG_TOKENS, tokens_grow_count, tokens_reserve_cap);
-	bag->locations = hcc_stack_init(HccLocation*, HCC_ALLOC_TAG_ATA_TOKEN_BAG_LOCATIONS, tokens_grow_count, tokens_reserve_cap);
+	bag->locations = hcc_stack_init(HccLocationId, HCC_ALLOC_TAG_ATA_TOKEN_BAG_LOCATIONS, tokens_grow_count, tokens_reserve_cap);
 	bag->values = hcc_stack_init(HccATAValue, HCC_ALLOC_TAG_ATA_TOKEN_BAG_VALUES, values_grow_count, values_reserve_cap);
 }
 
@@ -468,9 +484,9 @@ void hcc_ata_token_bag_reset(HccATATokenBag* bag) {
 	hcc_stack_clear(bag->values);
 }
 
-void hcc_ata_token_bag_push_token(HccATATokenBag* bag, HccATAToken token, HccLocation* location) {
+void hcc_ata_token_bag_push_token(HccATATokenBag* bag, HccATAToken token, HccLocationId location_id) {
 	*hcc_stack_push(bag->tokens) = token;
-	*hcc_stack_push(bag->locations) = location;
+	*hcc_stack_push(bag->locations) = location_id;
 }
 
 void hcc_ata_token_bag_push_value(HccATATokenBag* bag, HccATAValue value) {
@@ -491,6 +507,24 @@ bool hcc_ata_token_bag_pop_token(HccATATokenBag* bag) {
 	return true;
 }
 
+void hcc_ata_token_bag_push_range(HccATATokenBag* dst_bag, HccATATokenBag* src_bag, uint32_t tokens_start_idx, uint32_t tokens_count, uint32_t values_start_idx, uint32_t values_count) {
+	if (tokens_count) {
+		HCC_COPY_ELMT_MANY(hcc_stack_push_many(dst_bag->tokens, tokens_count), hcc_stack_get(src_bag->tokens, tokens_start_idx), tokens_count);
+		HCC_COPY_ELMT_MANY(hcc_stack_push_many(dst_bag->locations, tokens_count), hcc_stack_get(src_bag->locations, tokens_start_idx), tokens_count);
+	}
+	if (values_count) {
+		HCC_COPY_ELMT_MANY(hcc_stack_push_many(dst_bag->values, values_count), hcc_stack_get(src_bag->values, values_start_idx), values_count);
+	}
+}
+
+uint32_t hcc_ata_tokens_values_count(HccATAToken* tokens, uint32_t tokens_count) {
+	uint32_t values_count = 0;
+	for (uint32_t idx = 0; idx < tokens_count; idx += 1) {
+		values_count += hcc_ata_token_num_values(tokens[idx]);
+	}
+	return values_count;
+}
+
 uint32_t hcc_ata_token_bag_stringify_single(HccATATokenBag* bag, HccATATokenCursor* cursor, HccPPMacro* macro, char* outbuf, uint32_t outbufsize) {
 	uint32_t outbufidx = 0;
 	HccATAToken token = *hcc_stack_get(bag->tokens, cursor->token_idx);
@@ -39,6 +39,7 @@ void hcc_ppgen_reset(HccWorker* w) {
 	HccOptions* options = hcc_worker_cu(w)->options;
 	HccTargetArch target_arch = hcc_options_get_u32(options, HCC_OPTION_KEY_TARGET_ARCH);
 	HccTargetOS target_os = hcc_options_get_u32(options, HCC_OPTION_KEY_TARGET_OS);
+	w->atagen.ppgen.macro_set_hash = 0;
 	for (HccPPPredefinedMacro m = 0; m < HCC_PP_PREDEFINED_MACRO_COUNT; m += 1) {
 		if (m == HCC_PP_PREDEFINED_MACRO___HCC_LINUX__ && target_os != HCC_TARGET_OS_LINUX) {
 			continue;
@@ -54,9 +55,33 @@ void hcc_ppgen_reset(HccWorker* w) {
 		HccHashTableInsert insert = hcc_hash_table_find_insert_idx(w->atagen.ppgen.macro_declarations, &identifier_string_id);
 		HCC_DEBUG_ASSERT(insert.is_new, "internal error: predefined macro has already been initialized");
 		w->atagen.ppgen.macro_declarations[insert.idx].macro_idx = UINT32_MAX;
+		w->atagen.ppgen.macro_set_hash += hcc_ppgen_macro_hash(w, identifier_string_id, UINT32_MAX);
 	}
 }
 
+HccHash64 hcc_ppgen_macro_hash(HccWorker* w, HccStringId identifier_string_id, uint32_t macro_idx) {
+	HccHash64 hash = hcc_hash_wy_64(&identifier_string_id, sizeof(identifier_string_id), HCC_HASH_WY_64_INIT);
+	if (macro_idx == UINT32_MAX) {
+		//
+		// predefined macros only have a name
+		return hash;
+	}
+
+	HccASTFile* ast_file = w->atagen.ast_file;
+	HccPPMacro* macro = hcc_stack_get(ast_file->macros, macro_idx);
+	uint32_t tokens_count = hcc_ata_token_cursor_tokens_count(&macro->token_cursor);
+	HccATAToken* tokens = hcc_stack_get_or_null(ast_file->macro_token_bag.tokens, macro->token_cursor.tokens_start_idx);
+	HccATAValue* values = hcc_stack_get_or_null(ast_file->macro_token_bag.values, macro->token_cursor.token_value_idx);
+	uint32_t values_count = hcc_ata_tokens_values_count(tokens, tokens_count);
+
+	uint32_t kind = macro->is_function | (macro->has_va_args << 1);
+	hash = hcc_hash_wy_64(&kind, sizeof(kind), hash);
+	hash = hcc_hash_wy_64(macro->params, macro->params_count * sizeof(HccStringId), hash);
+	hash = hcc_hash_wy_64(tokens, tokens_count * sizeof(HccATAToken), hash);
+	hash = hcc_hash_wy_64(values, values_count * sizeof(HccATAValue), hash);
+	return hash;
+}
+
 HccPPIfSpan* hcc_ppgen_if_span_get(HccWorker* w, uint32_t pp_if_span_id) {
 	HCC_DEBUG_ASSERT(
 		w->atagen.we_are_mutator_of_code_file || (atomic_load(&w->atagen.location.code_file->flags) & HCC_CODE_FILE_FLAGS_COMPLETED_MUTATOR_PASS),
@@ -517,6 +542,7 @@ void hcc_ppgen_parse_define(HccWorker* w) {
 	macro->params_count = params_count;
 	macro->is_function = is_function;
 	macro->has_va_args = has_va_args;
+	w->atagen.ppgen.macro_set_hash += hcc_ppgen_macro_hash(w, identifier_string_id, entry->macro_idx);
 }
 
 void hcc_ppgen_parse_undef(HccWorker* w) {
@@ -534,7 +560,13 @@ void hcc_ppgen_parse_undef(HccWorker* w) {
 
 	//
 	// remove the macro from the hash table. we do not need to error if the macro is not defined.
-	hcc_hash_table_remove(w->atagen.ppgen.macro_declarations, &identifier_string_id);
+	uintptr_t decl_idx = hcc_hash_table_find_idx(w->atagen.ppgen.macro_declarations, &identifier_string_id);
+	if (decl_idx != UINTPTR_MAX) {
+		uint32_t macro_idx = w->atagen.ppgen.macro_declarations[decl_idx].macro_idx;
+		w->atagen.ppgen.macro_set_hash -= hcc_ppgen_macro_hash(w, identifier_string_id, macro_idx);
+		hcc_atagen_pch_invalidate_records(w, macro_idx);
+		hcc_hash_table_remove(w->atagen.ppgen.macro_declarations, &identifier_string_id);
+	}
 
 	hcc_ppgen_ensure_end_of_directive(w, HCC_ERROR_CODE_TOO_MANY_UNDEF_OPERANDS, HCC_PP_DIRECTIVE_UNDEF);
 }
@@ -635,7 +667,7 @@ void hcc_ppgen_parse_include(HccWorker* w) {
 		}
 
 		if (idx == count) {
-			w->atagen.location = *HCC_PP_TOKEN_STRIP_PREEXPANDED_MACRO_ARG(*hcc_stack_get(token_bag->locations, tokens_start_idx));
+			hcc_location_table_decode(w->cu, HCC_PP_TOKEN_STRIP_PREEXPANDED_MACRO_ARG(*hcc_stack_get(token_bag->locations, tokens_start_idx)), &w->atagen.location, NULL);
 			hcc_atagen_bail_error_1(w, HCC_ERROR_CODE_INCLUDE_PATH_DOES_NOT_EXIST);
 		}
 	}
@@ -652,20 +684,38 @@ void hcc_ppgen_parse_include(HccWorker* w) {
 	}
 	bool we_are_mutator_of_code_file = result.code == HCC_SUCCESS_IS_NEW;
 
-	hcc_string_table_deduplicate(path_string.data, path_string.size, &path_string_id);
-	hcc_ast_file_found_included_file(w->atagen.ast_file, path_string_id);
-	if (!hcc_ast_file_has_been_pragma_onced(w->atagen.ast_file, path_string_id)) {
-		hcc_atagen_paused_file_push(w);
-		hcc_atagen_location_setup_new_file(w, code_file);
-		w->atagen.we_are_mutator_of_code_file = we_are_mutator_of_code_file;
-	}
-
 	//
 	// remove the added token for when we evaluated the include operand
 	// using the call to hcc_atagen_run.
 	hcc_stack_resize(token_bag->tokens, tokens_start_idx);
 	hcc_stack_resize(token_bag->values, token_values_start_idx);
 	hcc_stack_resize(token_bag->locations, token_location_indices_start_idx);
+
+	hcc_string_table_deduplicate(path_string.data, path_string.size, &path_string_id);
+	hcc_atagen_found_included_file(w, path_string_id);
+	if (hcc_ast_file_has_been_pragma_onced(w->atagen.ast_file, path_string_id)) {
+		return;
+	}
+
+	//
+	// system headers generate the same tokens for every file that includes them with the same macros defined,
+	// so splice in the result from the first time instead of preprocessing them again.
+	// the mutator of the code file still has to go through it to build the line & #if span information.
+	bool is_system_header = token == HCC_ATA_TOKEN_INCLUDE_PATH_SYSTEM;
+	HccHash64 pch_key = 0;
+	if (is_system_header) {
+		pch_key = hcc_atagen_pch_key(w, path_string_id);
+		if (!we_are_mutator_of_code_file && hcc_atagen_pch_splice(w, pch_key)) {
+			return;
+		}
+	}
+
+	hcc_atagen_paused_file_push(w);
+	hcc_atagen_location_setup_new_file(w, code_file);
+	w->atagen.we_are_mutator_of_code_file = we_are_mutator_of_code_file;
+	if (is_system_header) {
+		hcc_atagen_pch_record_begin(w, pch_key, path_string_id);
+	}
 }
 
 bool hcc_ppgen_parse_if(HccWorker* w) {
@@ -852,6 +902,10 @@ void hcc_ppgen_parse_warning(HccWorker* w) {
 	location->display_line = hcc_atagen_display_line(w);
 
 	hcc_warn_push(hcc_worker_task(w), HCC_WARN_CODE_PP_WARNING, location, NULL, (int)message.size, message.data);
+
+	//
+	// the warning would not be reported again if the header was spliced in from a PCH
+	hcc_atagen_pch_invalidate_records(w, UINT32_MAX);
 }
 
 void hcc_ppgen_parse_pragma(HccWorker* w) {
@@ -901,7 +955,7 @@ void hcc_ppgen_parse_pragma(HccWorker* w) {
 			HccCodeFile* code_file = w->atagen.location.code_file;
 			HccStringId path_string_id;
 			hcc_string_table_deduplicate(code_file->path_string.data, code_file->path_string.size, &path_string_id);
-			hcc_ast_file_set_pragma_onced(w->atagen.ast_file, path_string_id);
+			hcc_atagen_set_pragma_onced(w, path_string_id);
 			expected_tokens_count = tokens_start_idx + 1;
 			break;
 		};
@@ -1266,6 +1320,7 @@ void hcc_ppgen_copy_expand_predefined_macro(HccWorker* w, HccPPPredefinedMacro p
 			hcc_atagen_token_value_add(w, token_value);
 
 			w->atagen.__counter__ += 1;
+			hcc_atagen_pch_invalidate_records(w, UINT32_MAX);
 			break;
 		};
 		case HCC_PP_PREDEFINED_MACRO___HCC__:
@@ -1359,9 +1414,9 @@ void hcc_ppgen_copy_expand_range(HccWorker* w, HccPPExpand* expand, HccATATokenB
 			}
 		}
 
-		HccLocation* token_location = *hcc_stack_get(src_bag->locations, expand->cursor.token_idx);
-		bool is_preexpanded_macro_arg = HCC_PP_TOKEN_IS_PREEXPANDED_MACRO_ARG(token_location);
-		token_location = HCC_PP_TOKEN_STRIP_PREEXPANDED_MACRO_ARG(token_location);
+		HccLocationId token_location_id = *hcc_stack_get(src_bag->locations, expand->cursor.token_idx);
+		bool is_preexpanded_macro_arg = HCC_PP_TOKEN_IS_PREEXPANDED_MACRO_ARG(token_location_id);
+		token_location_id = HCC_PP_TOKEN_STRIP_PREEXPANDED_MACRO_ARG(token_location_id);
 
 		HccLocation* location = hcc_worker_alloc_location(w);
 		{
@@ -1372,7 +1427,6 @@ void hcc_ppgen_copy_expand_range(HccWorker* w, HccPPExpand* expand, HccATATokenB
 				//     - copying a macro and are not on any of the preexpanded macro argument tokens
 				//
 				HccLocation* parent_location;
-				HccLocation* child_location;
 				HccPPMacro* macro;
 				if ((flags & HCC_PP_EXPAND_FLAGS_IS_ARGS)) {
 					// for expanded macro argument tokens:
@@ -1380,32 +1434,31 @@ void hcc_ppgen_copy_expand_range(HccWorker* w, HccPPExpand* expand, HccATATokenB
 					// the parent is the original argument token location at the callsite
 					bool is_same = parent_location == grandparent_location;
 					parent_location = hcc_worker_alloc_location(w);
-					*parent_location = *token_location;
+					hcc_location_table_decode(w->cu, token_location_id, parent_location, NULL);
 					if (!is_same && grandparent_location) {
 						hcc_ppgen_attach_to_most_parent(w, parent_location, grandparent_location);
 					}
-					if (!token_location->macro) {
+					if (!parent_location->macro) {
 						parent_location->macro = expand->macro;
 					}
-					child_location = parent_or_child_location;
+					*location = *parent_or_child_location;
 					macro = expand_macro;
 				} else {
 					// for expanded macro tokens:
 					// the child is the original macro token location
 					// the parent is the whole macro span at the callsite
 					parent_location = parent_or_child_location;
-					child_location = token_location;
+					hcc_location_table_decode(w->cu, token_location_id, location, NULL);
 					macro = expand_macro;
 				}
 
-				*location = *child_location;
-				location->parent_location = HCC_PP_TOKEN_STRIP_PREEXPANDED_MACRO_ARG(parent_location);
+				location->parent_location = parent_location;
 				location->macro = macro;
 			} else {
 				//
 				// we are on a argument that has been preexpanded before
 				// so there is no need to setup any parent location or macro links
-				*location = *token_location;
+				hcc_location_table_decode(w->cu, token_location_id, location, NULL);
 			}
 		}
 
@@ -1449,7 +1502,7 @@ void hcc_ppgen_copy_expand_range(HccWorker* w, HccPPExpand* expand, HccATATokenB
 			HccATAToken bracket = token - HCC_ATA_TOKEN_BRACKET_START;
 			if (bracket < HCC_ATA_TOKEN_BRACKET_COUNT) {
 				if (bracket % 2 == 0) {
-					hcc_atagen_bracket_open(w, token, location);
+					hcc_atagen_bracket_open(w, token, hcc_location_table_id(w->cu, location));
 				} else {
 					hcc_atagen_bracket_close(w, token, location);
 				}
@@ -1467,10 +1520,11 @@ void hcc_ppgen_copy_expand_range(HccWorker* w, HccPPExpand* expand, HccATATokenB
 		} else {
 			*hcc_stack_push(dst_bag->tokens) = token;
 
+			HccLocationId location_id = hcc_location_table_id(w->cu, location);
 			if (flags & (HCC_PP_EXPAND_FLAGS_IS_ARGS | HCC_PP_EXPAND_FLAGS_DEST_IS_ARGS)) {
-				location = HCC_PP_TOKEN_SET_PREEXPANDED_MACRO_ARG(location);
+				location_id = HCC_PP_TOKEN_SET_PREEXPANDED_MACRO_ARG(location_id);
 			}
-			*hcc_stack_push(dst_bag->locations) = location;
+			*hcc_stack_push(dst_bag->locations) = location_id;
 
 			expand->cursor.token_idx += 1;
 
@@ -1493,7 +1547,7 @@ void hcc_ppgen_copy_expand_macro(HccWorker* w, HccPPMacro* macro, HccLocation* m
 
 	if (macro->is_function) {
 		args_start_idx = hcc_ppgen_process_macro_args(w, macro, arg_expand, args_src_bag, parent_location);
-		HccLocation* final_location = HCC_PP_TOKEN_STRIP_PREEXPANDED_MACRO_ARG(*hcc_stack_get(args_src_bag->locations, arg_expand->cursor.tokens_end_idx - 1));
+		HccLocation* final_location = hcc_location_table_get(w->cu, HCC_PP_TOKEN_STRIP_PREEXPANDED_MACRO_ARG(*hcc_stack_get(args_src_bag->locations, arg_expand->cursor.tokens_end_idx - 1)));
 		hcc_location_merge_apply(macro_callsite_location, final_location);
 	}
 
@@ -1510,7 +1564,7 @@ void hcc_ppgen_copy_expand_macro(HccWorker* w, HccPPMacro* macro, HccLocation* m
 			HccATAToken token = *hcc_stack_get(src_bag->tokens, cursor.token_idx);
 			switch (token) {
 				case HCC_ATA_TOKEN_MACRO_PARAM: {
-					HccLocation* location = HCC_PP_TOKEN_STRIP_PREEXPANDED_MACRO_ARG(*hcc_stack_get(src_bag->locations, cursor.token_idx));
+					HccLocation* location = hcc_location_table_get(w->cu, HCC_PP_TOKEN_STRIP_PREEXPANDED_MACRO_ARG(*hcc_stack_get(src_bag->locations, cursor.token_idx)));
 					uint32_t param_idx = hcc_stack_get(src_bag->values, cursor.token_value_idx)->macro_param_idx;
 
 					HccPPExpand* param_arg_expand = hcc_ppgen_expand_push_macro_arg(w, param_idx, args_start_idx, NULL);
@@ -1544,11 +1598,11 @@ void hcc_ppgen_copy_expand_macro(HccWorker* w, HccPPMacro* macro, HccLocation* m
 						//
 						// push on the location
 						HccLocation* dst_location = hcc_worker_alloc_location(w);
-						*dst_location = *HCC_PP_TOKEN_STRIP_PREEXPANDED_MACRO_ARG(*hcc_stack_get(src_bag->locations, cursor.token_idx));
-						dst_location->parent_location = HCC_PP_TOKEN_STRIP_PREEXPANDED_MACRO_ARG(callsite_location);
+						hcc_location_table_decode(w->cu, HCC_PP_TOKEN_STRIP_PREEXPANDED_MACRO_ARG(*hcc_stack_get(src_bag->locations, cursor.token_idx)), dst_location, NULL);
+						dst_location->parent_location = callsite_location;
 						dst_location->macro = macro;
 
-						*hcc_stack_push(alt_dst_bag->locations) = HCC_PP_TOKEN_SET_PREEXPANDED_MACRO_ARG(dst_location);
+						*hcc_stack_push(alt_dst_bag->locations) = HCC_PP_TOKEN_SET_PREEXPANDED_MACRO_ARG(hcc_location_table_id(w->cu, dst_location));
 						*hcc_stack_push(alt_dst_bag->tokens) = HCC_ATA_TOKEN_STRING;
 						hcc_stack_push(alt_dst_bag->values)->string_id = string_id;
 					}
@@ -1564,7 +1618,7 @@ void hcc_ppgen_copy_expand_macro(HccWorker* w, HccPPMacro* macro, HccLocation* m
 
 					hcc_stack_clear(w->atagen.ppgen.stringify_buffer);
 
-					HccLocation* before = HCC_PP_TOKEN_STRIP_PREEXPANDED_MACRO_ARG(*hcc_stack_get(src_bag->locations, cursor.token_idx));
+					HccLocationId before_location_id = HCC_PP_TOKEN_STRIP_PREEXPANDED_MACRO_ARG(*hcc_stack_get(src_bag->locations, cursor.token_idx));
 					uint32_t stringify_buffer_size = 0;
 					HccATAToken before_token = hcc_ata_token_bag_stringify_single_or_macro_param(w, src_bag, &cursor, args_start_idx, args_src_bag, false, w->atagen.ppgen.stringify_buffer, hcc_stack_cap(w->atagen.ppgen.stringify_buffer), &stringify_buffer_size);
 					if (*hcc_stack_get(src_bag->tokens, cursor.token_idx) == HCC_ATA_TOKEN_MACRO_WHITESPACE) {
@@ -1573,8 +1627,8 @@ void hcc_ppgen_copy_expand_macro(HccWorker* w, HccPPMacro* macro, HccLocation* m
 
 					uint32_t concat_to_do_count = 1;
 					HccLocation* dst_location = hcc_worker_alloc_location(w);
-					*dst_location = *before;
-					dst_location->parent_location = HCC_PP_TOKEN_STRIP_PREEXPANDED_MACRO_ARG(parent_location);
+					hcc_location_table_decode(w->cu, before_location_id, dst_location, NULL);
+					dst_location->parent_location = parent_location;
 					dst_location->macro = macro;
 					while (concat_to_do_count) {
 						HccATAToken token = *hcc_stack_get(src_bag->tokens, cursor.token_idx);
@@ -1583,9 +1637,10 @@ void hcc_ppgen_copy_expand_macro(HccWorker* w, HccPPMacro* macro, HccLocation* m
 							concat_to_do_count += 1;
 						}
 
-						HccLocation* after = HCC_PP_TOKEN_STRIP_PREEXPANDED_MACRO_ARG(*hcc_stack_get(src_bag->locations, cursor.token_idx));
+						HccLocation after;
+						hcc_location_table_decode(w->cu, HCC_PP_TOKEN_STRIP_PREEXPANDED_MACRO_ARG(*hcc_stack_get(src_bag->locations, cursor.token_idx)), &after, NULL);
 						HccATAToken after_token = hcc_ata_token_bag_stringify_single_or_macro_param(w, src_bag, &cursor, args_start_idx, args_src_bag, true, w->atagen.ppgen.stringify_buffer + stringify_buffer_size, hcc_stack_cap(w->atagen.ppgen.stringify_buffer) - stringify_buffer_size, &stringify_buffer_size);
-						hcc_location_merge_apply(dst_location, after);
+						hcc_location_merge_apply(dst_location, &after);
 
 						if (before_token != HCC_ATA_TOKEN_COUNT && after_token != HCC_ATA_TOKEN_COUNT) {
 							if (!hcc_ata_token_concat_is_okay(before_token, after_token)) {
@@ -1613,8 +1668,9 @@ void hcc_ppgen_copy_expand_macro(HccWorker* w, HccPPMacro* macro, HccLocation* m
 					// hcc_atagen_run puts the locations in the token bag but we don't care about them.
 					// what we really want is the location that spans the concatination operands and links back to their parents.
 					// so just link to it as a stable pointer.
+					HccLocationId dst_location_id = hcc_location_table_id(w->cu, dst_location);
 					for (uint32_t idx = token_location_start_idx; idx < hcc_stack_count(alt_dst_bag->locations); idx += 1) {
-						*hcc_stack_get(alt_dst_bag->locations, idx) = dst_location;
+						*hcc_stack_get(alt_dst_bag->locations, idx) = dst_location_id;
 					}
 					continue;
 				};
@@ -1698,7 +1754,6 @@ uint32_t hcc_ppgen_process_macro_args(HccWorker* w, HccPPMacro* macro, HccPPExpa
 	bool reached_va_args = macro->has_va_args && macro->params_count == 1;
 	while (expand->cursor.token_idx < hcc_stack_count(src_bag->tokens)) {
 		HccATAToken token = *hcc_stack_get(src_bag->tokens, expand->cursor.token_idx);
-		HccLocation* location = *hcc_stack_get(src_bag->locations, expand->cursor.token_idx);
 
 		switch (token) {
 			case HCC_ATA_TOKEN_COMMA:
@@ -1707,7 +1762,7 @@ uint32_t hcc_ppgen_process_macro_args(HccWorker* w, HccPPMacro* macro, HccPPExpa
 					// we found a ',' outside of nested_parenthesis,
 					// so lets finalize the current argument and start the next one.
 					expand->cursor.token_idx += 1;
-					hcc_ppgen_finalize_macro_arg(arg, expand, src_bag);
+					hcc_ppgen_finalize_macro_arg(w, arg, expand, src_bag);
 
 					//
 					// start the next argument
@@ -1743,7 +1798,7 @@ uint32_t hcc_ppgen_process_macro_args(HccWorker* w, HccPPMacro* macro, HccPPExpa
 		expand->cursor.token_value_idx += hcc_ata_token_num_values(token);
 	}
 BREAK: {}
-	hcc_ppgen_finalize_macro_arg(arg, expand, src_bag);
+	hcc_ppgen_finalize_macro_arg(w, arg, expand, src_bag);
 
 	uint32_t args_count = hcc_stack_count(w->atagen.ppgen.macro_args_stack) - args_start_idx;
 	if (args_count == 1 && arg->cursor.tokens_start_idx == arg->cursor.tokens_end_idx) {
@@ -1770,9 +1825,9 @@ HccPPMacroArg* hcc_ppgen_push_macro_arg(HccWorker* w, HccPPExpand* expand, HccAT
 	arg->cursor.token_idx = expand->cursor.token_idx;
 	arg->cursor.token_value_idx = expand->cursor.token_value_idx;
 	arg->callsite_location = hcc_worker_alloc_location(w);
-	HccLocation* src_location = HCC_PP_TOKEN_STRIP_PREEXPANDED_MACRO_ARG(*hcc_stack_get(src_bag->locations, expand->cursor.token_idx));
-	*arg->callsite_location = *src_location;
-	bool is_same = parent_location == src_location;
+	HccLocationId src_location_id = HCC_PP_TOKEN_STRIP_PREEXPANDED_MACRO_ARG(*hcc_stack_get(src_bag->locations, expand->cursor.token_idx));
+	hcc_location_table_decode(w->cu, src_location_id, arg->callsite_location, NULL);
+	bool is_same = (src_location_id & HCC_LOCATION_ID_FULL_BIT) && parent_location == hcc_location_table_get(w->cu, src_location_id);
 	if (!is_same && parent_location) {
 		hcc_ppgen_attach_to_most_parent(w, arg->callsite_location, parent_location);
 	}
@@ -1780,10 +1835,11 @@ HccPPMacroArg* hcc_ppgen_push_macro_arg(HccWorker* w, HccPPExpand* expand, HccAT
 	return arg;
 }
 
-void hcc_ppgen_finalize_macro_arg(HccPPMacroArg* arg, HccPPExpand* expand, HccATATokenBag* src_bag) {
+void hcc_ppgen_finalize_macro_arg(HccWorker* w, HccPPMacroArg* arg, HccPPExpand* expand, HccATATokenBag* src_bag) {
 	arg->cursor.tokens_end_idx = expand->cursor.token_idx - 1;
-	HccLocation* location = HCC_PP_TOKEN_STRIP_PREEXPANDED_MACRO_ARG(*hcc_stack_get(src_bag->locations, expand->cursor.token_idx - 2));
-	hcc_location_merge_apply(arg->callsite_location, location);
+	HccLocation location;
+	hcc_location_table_decode(w->cu, HCC_PP_TOKEN_STRIP_PREEXPANDED_MACRO_ARG(*hcc_stack_get(src_bag->locations, expand->cursor.token_idx - 2)), &location, NULL);
+	hcc_location_merge_apply(arg->callsite_location, &location);
 	if (*hcc_stack_get(src_bag->tokens, arg->cursor.tokens_start_idx) == HCC_ATA_TOKEN_MACRO_WHITESPACE) {
 		arg->cursor.tokens_start_idx += 1;
 		arg->cursor.token_idx += 1;
@@ -1835,18 +1891,27 @@ void hcc_atagen_init(HccWorker* w, HccATAGenSetup* setup) {
 	hcc_ppgen_init(w, &setup->ppgen);
 	w->atagen.paused_file_stack = hcc_stack_init(HccATAPausedFile, HCC_ALLOC_TAG_ATAGEN_PAUSED_FILE_STACK, setup->paused_file_stack_grow_count, setup->paused_file_stack_reserve_cap);
 	w->atagen.open_bracket_stack = hcc_stack_init(HccATAOpenBracket, HCC_ALLOC_TAG_ATAGEN_OPEN_BRACKET_STACK, setup->open_bracket_stack_grow_count, setup->open_bracket_stack_reserve_cap);
+	w->atagen.pch_record_stack = hcc_stack_init(HccATAPCHRecord, HCC_ALLOC_TAG_ATAGEN_PCH_RECORD_STACK, setup->paused_file_stack_grow_count, setup->paused_file_stack_reserve_cap);
+	w->atagen.pch_included_files = hcc_stack_init(HccStringId, HCC_ALLOC_TAG_ATAGEN_PCH_INCLUDED_FILES, setup->pch_files_grow_count, setup->pch_files_reserve_cap);
+	w->atagen.pch_pragma_onced_files = hcc_stack_init(HccStringId, HCC_ALLOC_TAG_ATAGEN_PCH_PRAGMA_ONCED_FILES, setup->pch_files_grow_count, setup->pch_files_reserve_cap);
 }
 
 void hcc_atagen_deinit(HccWorker* w) {
 	hcc_ppgen_deinit(w);
 	hcc_stack_deinit(w->atagen.paused_file_stack);
 	hcc_stack_deinit(w->atagen.open_bracket_stack);
+	hcc_stack_deinit(w->atagen.pch_record_stack);
+	hcc_stack_deinit(w->atagen.pch_included_files);
+	hcc_stack_deinit(w->atagen.pch_pragma_onced_files);
 }
 
 void hcc_atagen_reset(HccWorker* w) {
 	hcc_ppgen_reset(w);
 	hcc_stack_clear(w->atagen.paused_file_stack);
 	hcc_stack_clear(w->atagen.open_bracket_stack);
+	hcc_stack_clear(w->atagen.pch_record_stack);
+	hcc_stack_clear(w->atagen.pch_included_files);
+	hcc_stack_clear(w->atagen.pch_pragma_onced_files);
 }
 
 void hcc_atagen_generate(HccWorker* w) {
@@ -1875,6 +1940,126 @@ HccLocation* hcc_atagen_make_location(HccWorker* w) {
 	return l;
 }
 
+HccLocationId hcc_atagen_make_location_id(HccWorker* w) {
+	HccLocation* location = &w->atagen.location;
+	HccCodeFile* code_file = location->code_file;
+	uint32_t code_size = location->code_end_idx - location->code_start_idx;
+
+	//
+	// a token that sits on a single line of a real code file can be stored as an offset into the location table.
+	// everything else about the location is found again from the code when it is decoded.
+	// so if the cursor does not match what the decode will give back, then we store the full location.
+	// the line start indices are only safe to read once we have pushed them ourselves or the mutator is done with them.
+	// tokens for the preprocessor get copied into new locations every time they are expanded, so those are kept as full locations.
+	if (
+		w->atagen.run_mode != HCC_ATAGEN_RUN_MODE_CODE ||
+		!(w->atagen.we_are_mutator_of_code_file || (atomic_load(&code_file->flags) & HCC_CODE_FILE_FLAGS_COMPLETED_MUTATOR_PASS)) ||
+		location->parent_location || location->macro ||
+		code_file == &w->atagen.ppgen.concat_buffer_code_file ||
+		location->line_end != location->line_start + 1 ||
+		location->column_end - location->column_start != code_size ||
+		location->column_start != location->code_start_idx - *hcc_stack_get(code_file->line_code_start_indices, location->line_start) + 1 ||
+		hcc_atagen_token_code_size(code_file->code, location->code_start_idx) != code_size
+	) {
+		return hcc_location_table_id(w->cu, hcc_atagen_make_location(w));
+	}
+
+	HccLocationTable* table = &w->cu->location_table;
+	HccLocationSpan* span = w->atagen.location_span_idx == UINT32_MAX ? NULL : &table->spans[w->atagen.location_span_idx];
+	if (
+		span == NULL ||
+		span->code_file != code_file ||
+		span->display_path.data != location->display_path.data ||
+		span->custom_line_dst != w->atagen.custom_line_dst ||
+		span->custom_line_src != w->atagen.custom_line_src
+	) {
+		w->atagen.location_span_idx = hcc_location_table_add_span(w->cu, code_file, location->display_path, w->atagen.custom_line_dst, w->atagen.custom_line_src);
+		if (w->atagen.location_span_idx == UINT32_MAX) {
+			return hcc_location_table_id(w->cu, hcc_atagen_make_location(w));
+		}
+		span = &table->spans[w->atagen.location_span_idx];
+	}
+
+	return span->offset_start + location->code_start_idx;
+}
+
+uint32_t hcc_atagen_token_code_size(HccString code, uint32_t code_idx) {
+	if (code_idx >= code.size) {
+		return 0;
+	}
+
+	char byte = code.data[code_idx];
+	uint32_t idx = code_idx + 1;
+	if (byte == '\n') {
+		return 0;
+	}
+
+	if (byte == ' ' || byte == '\t') {
+		while (idx < code.size && (code.data[idx] == ' ' || code.data[idx] == '\t')) {
+			idx += 1;
+		}
+		return idx - code_idx;
+	}
+
+	if (byte == '_' || hcc_ascii_is_alpha(byte)) {
+		while (idx < code.size && (code.data[idx] == '_' || hcc_ascii_is_alpha(code.data[idx]) || hcc_ascii_is_digit(code.data[idx]))) {
+			idx += 1;
+		}
+		return idx - code_idx;
+	}
+
+	if (hcc_ascii_is_digit(byte) || (byte == '.' && idx < code.size && hcc_ascii_is_digit(code.data[idx]))) {
+		while (idx < code.size) {
+			char b = code.data[idx];
+			if ((b == '+' || b == '-') && (code.data[idx - 1] == 'e' || code.data[idx - 1] == 'E' || code.data[idx - 1] == 'p' || code.data[idx - 1] == 'P')) {
+				idx += 1;
+			} else if (b == '_' || b == '.' || hcc_ascii_is_alpha(b) || hcc_ascii_is_digit(b)) {
+				idx += 1;
+			} else {
+				break;
+			}
+		}
+		return idx - code_idx;
+	}
+
+	if (byte == '"' || byte == '\'') {
+		while (idx < code.size && code.data[idx] != '\n') {
+			char b = code.data[idx];
+			idx += 1;
+			if (b == '\\' && idx < code.size) {
+				idx += 1;
+			} else if (b == byte) {
+				break;
+			}
+		}
+		return idx - code_idx;
+	}
+
+	char next_byte = idx < code.size ? code.data[idx] : '\0';
+	char next_next_byte = idx + 1 < code.size ? code.data[idx + 1] : '\0';
+	switch (byte) {
+		case '.': return next_byte == '.' && next_next_byte == '.' ? 3 : 1;
+		case '<':
+		case '>':
+			if (next_byte == byte) return next_next_byte == '=' ? 3 : 2;
+			return next_byte == '=' ? 2 : 1;
+		case '-': return next_byte == '>' || next_byte == '-' || next_byte == '=' ? 2 : 1;
+		case '+':
+		case '&':
+		case '|':
+			return next_byte == byte || next_byte == '=' ? 2 : 1;
+		case '#': return next_byte == '#' ? 2 : 1;
+		case '=':
+		case '!':
+		case '*':
+		case '/':
+		case '%':
+		case '^':
+			return next_byte == '=' ? 2 : 1;
+		default: return 1;
+	}
+}
+
 void hcc_atagen_advance_column(HccWorker* w, uint32_t by) {
 	w->atagen.location.column_end += by;
 	w->atagen.location.code_end_idx += by;
@@ -1898,7 +2083,7 @@ uint32_t hcc_atagen_display_line(HccWorker* w) {
 }
 
 void hcc_atagen_token_add(HccWorker* w, HccATAToken token) {
-	hcc_ata_token_bag_push_token(w->atagen.dst_token_bag, token, hcc_atagen_make_location(w));
+	hcc_ata_token_bag_push_token(w->atagen.dst_token_bag, token, hcc_atagen_make_location_id(w));
 }
 
 void hcc_atagen_token_value_add(HccWorker* w, HccATAValue value) {
@@ -1975,6 +2160,7 @@ void hcc_atagen_paused_file_push(HccWorker* w) {
 	paused_file->location = w->atagen.location;
 	paused_file->if_stack_count = hcc_stack_count(w->atagen.ppgen.if_stack);
 	paused_file->pp_if_span_id = w->atagen.pp_if_span_id;
+	paused_file->location_span_idx = w->atagen.location_span_idx;
 }
 
 void hcc_atagen_paused_file_pop(HccWorker* w) {
@@ -1989,11 +2175,19 @@ void hcc_atagen_paused_file_pop(HccWorker* w) {
 		hcc_atagen_bail_error_1(w, HCC_ERROR_CODE_PP_IF_UNTERMINATED, hcc_pp_directive_strings[pp_if->directive]);
 	}
 
+	if (
+		hcc_stack_count(w->atagen.pch_record_stack) &&
+		hcc_stack_get_last(w->atagen.pch_record_stack)->paused_files_count == hcc_stack_count(w->atagen.paused_file_stack)
+	) {
+		hcc_atagen_pch_record_end(w);
+	}
+
 	w->atagen.we_are_mutator_of_code_file = paused_file->we_are_mutator_of_code_file;
 	w->atagen.location = paused_file->location;
 	w->atagen.code = paused_file->location.code_file->code.data;
 	w->atagen.code_size = paused_file->location.code_file->code.size;
 	w->atagen.pp_if_span_id = paused_file->pp_if_span_id;
+	w->atagen.location_span_idx = paused_file->location_span_idx;
 	hcc_stack_pop(w->atagen.paused_file_stack);
 }
 
@@ -2012,6 +2206,302 @@ void hcc_atagen_location_setup_new_file(HccWorker* w, HccCodeFile* code_file) {
 	w->atagen.code = code_file->code.data;
 	w->atagen.code_size = code_file->code.size;
 	w->atagen.pp_if_span_id = 0;
+	w->atagen.location_span_idx = UINT32_MAX;
+}
+
+void hcc_atagen_found_included_file(HccWorker* w, HccStringId path_string_id) {
+	hcc_ast_file_found_included_file(w->atagen.ast_file, path_string_id);
+	if (hcc_stack_count(w->atagen.pch_record_stack)) {
+		*hcc_stack_push(w->atagen.pch_included_files) = path_string_id;
+	}
+}
+
+void hcc_atagen_set_pragma_onced(HccWorker* w, HccStringId path_string_id) {
+	hcc_ast_file_set_pragma_onced(w->atagen.ast_file, path_string_id);
+	if (hcc_stack_count(w->atagen.pch_record_stack)) {
+		*hcc_stack_push(w->atagen.pch_pragma_onced_files) = path_string_id;
+	}
+}
+
+HccHash64 hcc_atagen_pch_key(HccWorker* w, HccStringId path_string_id) {
+	//
+	// a pragma onced file will not be included again, so they change the tokens a header generates just like macros.
+	// they are summed up so the order they are found in does not matter.
+	HccASTFile* ast_file = w->atagen.ast_file;
+	HccHash64 pragma_onced_files_hash = 0;
+	for (uint32_t idx = 0; idx < hcc_stack_count(ast_file->pragma_onced_files); idx += 1) {
+		pragma_onced_files_hash += hcc_hash_wy_64(&ast_file->pragma_onced_files[idx], sizeof(HccStringId), HCC_HASH_WY_64_INIT);
+	}
+
+	HccHash64 key = hcc_hash_wy_64(&path_string_id, sizeof(path_string_id), HCC_HASH_WY_64_INIT);
+	key = hcc_hash_wy_64(&w->atagen.ppgen.macro_set_hash, sizeof(HccHash64), key);
+	key = hcc_hash_wy_64(&pragma_onced_files_hash, sizeof(HccHash64), key);
+	return key;
+}
+
+bool hcc_atagen_pch_splice(HccWorker* w, HccHash64 key) {
+	HccAST* ast = &w->cu->ast;
+	uintptr_t entry_idx = hcc_hash_table_find_idx(ast->pchs_hash_table, &key);
+	if (entry_idx == UINTPTR_MAX) {
+		return false;
+	}
+
+	uint32_t pch_idx_plus_one = atomic_load(&ast->pchs_hash_table[entry_idx].pch_idx_plus_one);
+	if (pch_idx_plus_one == 0) {
+		//
+		// another worker is still storing this PCH
+		return false;
+	}
+
+	HccPCH* pch = hcc_stack_get(ast->pchs, pch_idx_plus_one - 1);
+	HccASTFile* ast_file = w->atagen.ast_file;
+	uint32_t tokens_start_idx = hcc_stack_count(ast_file->token_bag.tokens);
+	hcc_ata_token_bag_push_range(&ast_file->token_bag, &ast->pch_token_bag, pch->tokens_start_idx, pch->tokens_count, pch->values_start_idx, pch->values_count);
+
+	//
+	// tokens that were expanded from a macro defined outside of the header have a location chain
+	// that goes back to the file that stored the PCH, so re-parent them on to the file that is including it now.
+	// the macros have to be the same for the key to match, so the macro with the same name is used in its place
+	// when it was defined somewhere else.
+	// only the full locations can have a chain, the ones that come straight from the header are left as they are.
+	HccLocation* last_src_location = NULL;
+	HccLocationId last_dst_location_id = HCC_LOCATION_ID_NULL;
+	for (uint32_t idx = 0; idx < pch->tokens_count; idx += 1) {
+		HccLocationId* location_id = hcc_stack_get(ast_file->token_bag.locations, tokens_start_idx + idx);
+		if (!(*location_id & HCC_LOCATION_ID_FULL_BIT)) {
+			continue;
+		}
+
+		HccLocationId pp_bit = *location_id & HCC_LOCATION_ID_PP_BIT;
+		HccLocation* location = hcc_location_table_get(w->cu, *location_id & ~HCC_LOCATION_ID_PP_BIT);
+		if (location != last_src_location) {
+			HccLocation* reparented_location = hcc_atagen_pch_reparent_location(w, pch, location);
+			last_src_location = location;
+			last_dst_location_id = reparented_location == location ? HCC_LOCATION_ID_NULL : hcc_location_table_id(w->cu, reparented_location);
+		}
+
+		if (last_dst_location_id != HCC_LOCATION_ID_NULL) {
+			*location_id = last_dst_location_id | pp_bit;
+		}
+	}
+
+	for (uint32_t idx = 0; idx < pch->macros_count; idx += 1) {
+		HccPPMacro* src_macro = hcc_stack_get(ast->pch_macros, pch->macros_start_idx + idx);
+		uint32_t tokens_count = hcc_ata_token_cursor_tokens_count(&src_macro->token_cursor);
+		uint32_t values_count = hcc_ata_tokens_values_count(hcc_stack_get_or_null(ast->pch_macro_token_bag.tokens, src_macro->token_cursor.tokens_start_idx), tokens_count);
+
+		uint32_t macro_idx = hcc_stack_count(ast_file->macros);
+		HccPPMacro* macro = hcc_stack_push(ast_file->macros);
+		*macro = *src_macro;
+		macro->token_cursor.tokens_start_idx = hcc_stack_count(ast_file->macro_token_bag.tokens);
+		macro->token_cursor.tokens_end_idx = macro->token_cursor.tokens_start_idx + tokens_count;
+		macro->token_cursor.token_idx = macro->token_cursor.tokens_start_idx;
+		macro->token_cursor.token_value_idx = hcc_stack_count(ast_file->macro_token_bag.values);
+		hcc_ata_token_bag_push_range(&ast_file->macro_token_bag, &ast->pch_macro_token_bag, src_macro->token_cursor.tokens_start_idx, tokens_count, src_macro->token_cursor.token_value_idx, values_count);
+		if (src_macro->params_count) {
+			macro->params = hcc_stack_push_many(ast_file->macro_params, src_macro->params_count);
+			HCC_COPY_ELMT_MANY(macro->params, src_macro->params, src_macro->params_count);
+		}
+
+		HccHashTableInsert insert = hcc_hash_table_find_insert_idx(w->atagen.ppgen.macro_declarations, &macro->identifier_string_id);
+		w->atagen.ppgen.macro_declarations[insert.idx].macro_idx = macro_idx;
+	}
+	w->atagen.ppgen.macro_set_hash = pch->end_macro_set_hash;
+
+	for (uint32_t idx = 0; idx < pch->included_files_count; idx += 1) {
+		hcc_atagen_found_included_file(w, *hcc_stack_get(ast->pch_files, pch->included_files_start_idx + idx));
+	}
+	for (uint32_t idx = 0; idx < pch->pragma_onced_files_count; idx += 1) {
+		hcc_atagen_set_pragma_onced(w, *hcc_stack_get(ast->pch_files, pch->pragma_onced_files_start_idx + idx));
+	}
+
+	return true;
+}
+
+bool hcc_atagen_pch_has_code_file(HccWorker* w, HccPCH* pch, HccCodeFile* code_file) {
+	HccAST* ast = &w->cu->ast;
+	if (hcc_string_eq(code_file->path_string, hcc_string_table_get(pch->path_string_id))) {
+		return true;
+	}
+
+	for (uint32_t idx = 0; idx < pch->included_files_count; idx += 1) {
+		HccStringId path_string_id = *hcc_stack_get(ast->pch_files, pch->included_files_start_idx + idx);
+		if (hcc_string_eq(code_file->path_string, hcc_string_table_get(path_string_id))) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+HccLocation* hcc_atagen_pch_reparent_location(HccWorker* w, HccPCH* pch, HccLocation* location) {
+	if (location == NULL) {
+		return NULL;
+	}
+
+	//
+	// returns the location as it is when nothing in its chain comes from outside of the header
+	HccLocation* parent_location = hcc_atagen_pch_reparent_location(w, pch, location->parent_location);
+	HccPPMacro* macro = location->macro;
+	if (macro && location->code_file && !hcc_atagen_pch_has_code_file(w, pch, location->code_file)) {
+		uintptr_t decl_idx = hcc_hash_table_find_idx(w->atagen.ppgen.macro_declarations, &macro->identifier_string_id);
+		HccPPMacro* includer_macro = decl_idx == UINTPTR_MAX ? NULL : hcc_stack_get(w->atagen.ast_file->macros, w->atagen.ppgen.macro_declarations[decl_idx].macro_idx);
+		if (includer_macro && includer_macro->location != macro->location) {
+			//
+			// the location is inside of the macro's definition in the other file,
+			// so point it at the definition of the includer's macro instead.
+			HccLocation* reparented_location = hcc_worker_alloc_location(w);
+			*reparented_location = *includer_macro->location;
+			reparented_location->parent_location = parent_location;
+			reparented_location->macro = includer_macro;
+			return reparented_location;
+		}
+	}
+
+	if (parent_location == location->parent_location) {
+		return location;
+	}
+
+	HccLocation* reparented_location = hcc_worker_alloc_location(w);
+	*reparented_location = *location;
+	reparented_location->parent_location = parent_location;
+	return reparented_location;
+}
+
+void hcc_atagen_pch_record_begin(HccWorker* w, HccHash64 key, HccStringId path_string_id) {
+	HccASTFile* ast_file = w->atagen.ast_file;
+	HccATAPCHRecord* record = hcc_stack_push(w->atagen.pch_record_stack);
+	record->key = key;
+	record->path_string_id = path_string_id;
+	record->paused_files_count = hcc_stack_count(w->atagen.paused_file_stack);
+	record->tokens_start_idx = hcc_stack_count(ast_file->token_bag.tokens);
+	record->values_start_idx = hcc_stack_count(ast_file->token_bag.values);
+	record->macros_start_idx = hcc_stack_count(ast_file->macros);
+	record->included_files_start_idx = hcc_stack_count(w->atagen.pch_included_files);
+	record->pragma_onced_files_start_idx = hcc_stack_count(w->atagen.pch_pragma_onced_files);
+	record->open_brackets_count = hcc_stack_count(w->atagen.open_bracket_stack);
+	record->is_invalid = false;
+}
+
+void hcc_atagen_pch_record_end(HccWorker* w) {
+	HccATAPCHRecord* record = hcc_stack_get_last(w->atagen.pch_record_stack);
+	HccASTFile* ast_file = w->atagen.ast_file;
+	HccAST* ast = &w->cu->ast;
+	if (record->is_invalid || record->open_brackets_count != hcc_stack_count(w->atagen.open_bracket_stack)) {
+		goto END;
+	}
+
+	uint32_t tokens_count = hcc_stack_count(ast_file->token_bag.tokens) - record->tokens_start_idx;
+	uint32_t values_count = hcc_stack_count(ast_file->token_bag.values) - record->values_start_idx;
+	uint32_t included_files_count = hcc_stack_count(w->atagen.pch_included_files) - record->included_files_start_idx;
+	uint32_t pragma_onced_files_count = hcc_stack_count(w->atagen.pch_pragma_onced_files) - record->pragma_onced_files_start_idx;
+
+	//
+	// only keep the macros that are still defined at the end of the header
+	uint32_t macros_count = 0;
+	uint32_t macro_tokens_count = 0;
+	uint32_t macro_values_count = 0;
+	uint32_t macro_params_count = 0;
+	for (uint32_t macro_idx = record->macros_start_idx; macro_idx < hcc_stack_count(ast_file->macros); macro_idx += 1) {
+		HccPPMacro* macro = hcc_stack_get(ast_file->macros, macro_idx);
+		uintptr_t decl_idx = hcc_hash_table_find_idx(w->atagen.ppgen.macro_declarations, &macro->identifier_string_id);
+		if (decl_idx != UINTPTR_MAX && w->atagen.ppgen.macro_declarations[decl_idx].macro_idx == macro_idx) {
+			uint32_t tokens_count = hcc_ata_token_cursor_tokens_count(&macro->token_cursor);
+			macros_count += 1;
+			macro_tokens_count += tokens_count;
+			macro_values_count += hcc_ata_tokens_values_count(hcc_stack_get_or_null(ast_file->macro_token_bag.tokens, macro->token_cursor.tokens_start_idx), tokens_count);
+			macro_params_count += macro->params_count;
+		}
+	}
+
+	hcc_spin_mutex_lock(&ast->pchs_mutex);
+
+	//
+	// stop storing PCHs when we have run out of space, the headers just get preprocessed as normal
+	bool has_space =
+		hcc_stack_count(ast->pchs) < hcc_stack_reserve_cap(ast->pchs) &&
+		hcc_stack_count(ast->pch_token_bag.tokens) + tokens_count <= hcc_stack_reserve_cap(ast->pch_token_bag.tokens) &&
+		hcc_stack_count(ast->pch_token_bag.values) + values_count <= hcc_stack_reserve_cap(ast->pch_token_bag.values) &&
+		hcc_stack_count(ast->pch_macro_token_bag.tokens) + macro_tokens_count <= hcc_stack_reserve_cap(ast->pch_macro_token_bag.tokens) &&
+		hcc_stack_count(ast->pch_macro_token_bag.values) + macro_values_count <= hcc_stack_reserve_cap(ast->pch_macro_token_bag.values) &&
+		hcc_stack_count(ast->pch_macros) + macros_count <= hcc_stack_reserve_cap(ast->pch_macros) &&
+		hcc_stack_count(ast->pch_macro_params) + macro_params_count <= hcc_stack_reserve_cap(ast->pch_macro_params) &&
+		hcc_stack_count(ast->pch_files) + included_files_count + pragma_onced_files_count <= hcc_stack_reserve_cap(ast->pch_files);
+
+	HccHashTableInsert insert = { .is_new = false };
+	if (has_space) {
+		insert = hcc_hash_table_find_insert_idx(ast->pchs_hash_table, &record->key);
+	}
+
+	if (insert.is_new) {
+		uint32_t pch_idx = hcc_stack_count(ast->pchs);
+		HccPCH* pch = hcc_stack_push(ast->pchs);
+		pch->end_macro_set_hash = w->atagen.ppgen.macro_set_hash;
+		pch->path_string_id = record->path_string_id;
+		pch->tokens_start_idx = hcc_stack_count(ast->pch_token_bag.tokens);
+		pch->tokens_count = tokens_count;
+		pch->values_start_idx = hcc_stack_count(ast->pch_token_bag.values);
+		pch->values_count = values_count;
+		hcc_ata_token_bag_push_range(&ast->pch_token_bag, &ast_file->token_bag, record->tokens_start_idx, tokens_count, record->values_start_idx, values_count);
+
+		pch->macros_start_idx = hcc_stack_count(ast->pch_macros);
+		pch->macros_count = macros_count;
+		for (uint32_t macro_idx = record->macros_start_idx; macro_idx < hcc_stack_count(ast_file->macros); macro_idx += 1) {
+			HccPPMacro* src_macro = hcc_stack_get(ast_file->macros, macro_idx);
+			uintptr_t decl_idx = hcc_hash_table_find_idx(w->atagen.ppgen.macro_declarations, &src_macro->identifier_string_id);
+			if (decl_idx == UINTPTR_MAX || w->atagen.ppgen.macro_declarations[decl_idx].macro_idx != macro_idx) {
+				continue;
+			}
+
+			uint32_t tokens_count = hcc_ata_token_cursor_tokens_count(&src_macro->token_cursor);
+			uint32_t values_count = hcc_ata_tokens_values_count(hcc_stack_get_or_null(ast_file->macro_token_bag.tokens, src_macro->token_cursor.tokens_start_idx), tokens_count);
+			HccPPMacro* macro = hcc_stack_push(ast->pch_macros);
+			*macro = *src_macro;
+			macro->token_cursor.tokens_start_idx = hcc_stack_count(ast->pch_macro_token_bag.tokens);
+			macro->token_cursor.tokens_end_idx = macro->token_cursor.tokens_start_idx + tokens_count;
+			macro->token_cursor.token_idx = macro->token_cursor.tokens_start_idx;
+			macro->token_cursor.token_value_idx = hcc_stack_count(ast->pch_macro_token_bag.values);
+			hcc_ata_token_bag_push_range(&ast->pch_macro_token_bag, &ast_file->macro_token_bag, src_macro->token_cursor.tokens_start_idx, tokens_count, src_macro->token_cursor.token_value_idx, values_count);
+			if (src_macro->params_count) {
+				macro->params = hcc_stack_push_many(ast->pch_macro_params, src_macro->params_count);
+				HCC_COPY_ELMT_MANY(macro->params, src_macro->params, src_macro->params_count);
+			}
+		}
+
+		pch->included_files_start_idx = hcc_stack_count(ast->pch_files);
+		pch->included_files_count = included_files_count;
+		if (included_files_count) {
+			HCC_COPY_ELMT_MANY(hcc_stack_push_many(ast->pch_files, included_files_count), hcc_stack_get(w->atagen.pch_included_files, record->included_files_start_idx), included_files_count);
+		}
+
+		pch->pragma_onced_files_start_idx = hcc_stack_count(ast->pch_files);
+		pch->pragma_onced_files_count = pragma_onced_files_count;
+		if (pragma_onced_files_count) {
+			HCC_COPY_ELMT_MANY(hcc_stack_push_many(ast->pch_files, pragma_onced_files_count), hcc_stack_get(w->atagen.pch_pragma_onced_files, record->pragma_onced_files_start_idx), pragma_onced_files_count);
+		}
+
+		atomic_store(&ast->pchs_hash_table[insert.idx].pch_idx_plus_one, pch_idx + 1);
+	}
+
+	hcc_spin_mutex_unlock(&ast->pchs_mutex);
+
+END: {}
+	hcc_stack_pop(w->atagen.pch_record_stack);
+	if (hcc_stack_count(w->atagen.pch_record_stack) == 0) {
+		hcc_stack_clear(w->atagen.pch_included_files);
+		hcc_stack_clear(w->atagen.pch_pragma_onced_files);
+	}
+}
+
+void hcc_atagen_pch_invalidate_records(HccWorker* w, uint32_t macro_idx) {
+	//
+	// a record is invalid when the header touches a macro that was defined before it started, UINT32_MAX invalidates all of them
+	for (uint32_t idx = 0; idx < hcc_stack_count(w->atagen.pch_record_stack); idx += 1) {
+		HccATAPCHRecord* record = hcc_stack_get(w->atagen.pch_record_stack, idx);
+		if (macro_idx == UINT32_MAX || macro_idx < record->macros_start_idx) {
+			record->is_invalid = true;
+		}
+	}
 }
 
 bool hcc_atagen_is_last_token_string(HccATATokenBag* bag) {
@@ -2551,13 +3041,13 @@ void hcc_atagen_consume_hash_for_define_replacement_list(HccWorker* w) {
 		}
 
 		HccATAToken temp_token = *hcc_stack_get_last(w->atagen.ast_file->macro_token_bag.tokens);
-		HccLocation* temp_token_location = *hcc_stack_get_last(w->atagen.ast_file->macro_token_bag.locations);
+		HccLocationId temp_token_location_id = *hcc_stack_get_last(w->atagen.ast_file->macro_token_bag.locations);
 		bool has_left_whitespace = false;
 		if (temp_token == HCC_ATA_TOKEN_MACRO_WHITESPACE) {
 			hcc_stack_pop(w->atagen.ast_file->macro_token_bag.tokens);
 			hcc_stack_pop(w->atagen.ast_file->macro_token_bag.locations);
 			temp_token = *hcc_stack_get_last(w->atagen.ast_file->macro_token_bag.tokens);
-			temp_token_location = *hcc_stack_get_last(w->atagen.ast_file->macro_token_bag.locations);
+			temp_token_location_id = *hcc_stack_get_last(w->atagen.ast_file->macro_token_bag.locations);
 			has_left_whitespace = true;
 		}
 
@@ -2575,7 +3065,7 @@ void hcc_atagen_consume_hash_for_define_replacement_list(HccWorker* w) {
 
 		// push temp_token
 		*hcc_stack_push(w->atagen.ast_file->macro_token_bag.tokens) = temp_token;
-		*hcc_stack_push(w->atagen.ast_file->macro_token_bag.locations) = temp_token_location;
+		*hcc_stack_push(w->atagen.ast_file->macro_token_bag.locations) = temp_token_location_id;
 	} else {
 		if (w->atagen.macro_is_function) {
 			hcc_atagen_advance_column(w, 1); // skip the '#'
@@ -2629,11 +3119,11 @@ bool hcc_atagen_is_first_non_whitespace_on_line(HccWorker* w) {
 	return true;
 }
 
-void hcc_atagen_bracket_open(HccWorker* w, HccATAToken token, HccLocation* location) {
+void hcc_atagen_bracket_open(HccWorker* w, HccATAToken token, HccLocationId location_id) {
 	HccATAOpenBracket* ob = hcc_stack_push(w->atagen.open_bracket_stack);
 	HccATAToken close_token = token + 1; // the close token is defined right away after the open in the HccATAToken enum
 	ob->close_token = close_token;
-	ob->open_token_location = location;
+	ob->open_token_location_id = location_id;
 }
 
 void hcc_atagen_bracket_close(HccWorker* w, HccATAToken token, HccLocation* location) {
@@ -2645,7 +3135,7 @@ void hcc_atagen_bracket_close(HccWorker* w, HccATAToken token, HccLocation* loca
 	hcc_stack_pop(w->atagen.open_bracket_stack);
 	if (ob->close_token != token) {
 		hcc_atagen_advance_column(w, 1);
-		hcc_atagen_bail_error_2(w, HCC_ERROR_CODE_INVALID_CLOSE_BRACKET_PAIR, location, ob->open_token_location, hcc_ata_token_strings[ob->close_token], hcc_ata_token_strings[token]);
+		hcc_atagen_bail_error_2(w, HCC_ERROR_CODE_INVALID_CLOSE_BRACKET_PAIR, location, hcc_location_table_get(w->cu, ob->open_token_location_id), hcc_ata_token_strings[ob->close_token], hcc_ata_token_strings[token]);
 	}
 }
 
@@ -2917,8 +3407,7 @@ OPEN_BRACKET: {}
 				if (run_mode == HCC_ATAGEN_RUN_MODE_CODE) {
 					hcc_atagen_advance_column(w, token_size);
 					hcc_atagen_token_add(w, token);
-					HccLocation* location = *hcc_stack_get_last(w->atagen.dst_token_bag->locations);
-					hcc_atagen_bracket_open(w, token, location);
+					hcc_atagen_bracket_open(w, token, *hcc_stack_get_last(w->atagen.dst_token_bag->locations));
 					continue;
 				}
 				break;
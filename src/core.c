@@ -10,6 +10,7 @@
 #include <errno.h>
 #include <string.h>
 #include <math.h>
+#include <inttypes.h>
 
 #ifdef HCC_OS_LINUX
 #include <sys/mman.h>
@@ -21,6 +22,8 @@
 #include <sys/sysinfo.h>
 #include <linux/futex.h>
 #include <linux/limits.h>
+#include <sys/socket.h>
+#include <sys/un.h>
 #include <fcntl.h>
 #include <pthread.h>
 #include <unistd.h>
@@ -188,7 +191,7 @@ void hcc_get_last_system_error_string(char* buf_out, uint32_t buf_out_size) {
 		strncpy(buf_out, buf, buf_out_size);
 
 		uint32_t size = strlen(buf);
-		if (size < buf_out_size) {
+		if (size >= buf_out_size) {
 			goto ERROR_2;
 		}
 	}
@@ -400,6 +403,29 @@ bool hcc_file_open_write(const char* path, HccIIO* out) {
 	return true;
 }
 
+bool hcc_file_stat(const char* path, HccFileStat* out) {
+#ifdef HCC_OS_LINUX
+	struct stat s;
+	if (stat(path, &s) != 0) {
+		return false;
+	}
+	out->size = s.st_size;
+	out->modified_time = (HccTime) { .secs = s.st_mtim.tv_sec, .nanosecs = s.st_mtim.tv_nsec };
+	return true;
+#elif defined(HCC_OS_WINDOWS)
+	WIN32_FILE_ATTRIBUTE_DATA attr;
+	if (!GetFileAttributesExA(path, GetFileExInfoStandard, &attr)) {
+		return false;
+	}
+	uint64_t wintime = ((uint64_t)attr.ftLastWriteTime.dwHighDateTime << 32) | attr.ftLastWriteTime.dwLowDateTime;
+	out->size = ((uint64_t)attr.nFileSizeHigh << 32) | attr.nFileSizeLow;
+	out->modified_time = (HccTime) { .secs = wintime / 10000000ll, .nanosecs = wintime % 10000000ll * 100 };
+	return true;
+#else
+#error "unimplemented for this platform"
+#endif
+}
+
 bool hcc_path_is_relative(const char* path) {
 	return !hcc_path_is_absolute(path);
 }
@@ -494,6 +520,159 @@ int hcc_execute_shell_command(const char* shell_command) {
 	return system(shell_command);
 }
 
+bool hcc_executable_is_in_path(const char* file_name) {
+#ifdef HCC_OS_LINUX
+	const char* path_list = getenv("PATH");
+	while (path_list && *path_list) {
+		const char* end = strchr(path_list, ':');
+		uint32_t dir_size = end ? (uint32_t)(end - path_list) : (uint32_t)strlen(path_list);
+		char path[PATH_MAX];
+		if (snprintf(path, sizeof(path), "%.*s/%s", (int)dir_size, path_list, file_name) < (int)sizeof(path) && access(path, X_OK) == 0) {
+			return true;
+		}
+		path_list = end ? end + 1 : NULL;
+	}
+	return false;
+#elif defined(HCC_OS_WINDOWS)
+	char path[MAX_PATH];
+	return SearchPathA(NULL, file_name, NULL, sizeof(path), path, NULL) != 0;
+#else
+#error "unimplemented for this platform"
+#endif
+}
+
+bool hcc_local_socket_listen(const char* path, HccLocalSocket* out) {
+#ifdef HCC_OS_LINUX
+	struct sockaddr_un addr = { .sun_family = AF_UNIX };
+	if (strlen(path) >= sizeof(addr.sun_path)) {
+		return false;
+	}
+	strcpy(addr.sun_path, path);
+
+	int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	if (fd < 0) {
+		return false;
+	}
+
+	//
+	// remove the socket file left behind by a server that did not shut down cleanly
+	unlink(path);
+	if (bind(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0 || listen(fd, 64) != 0) {
+		close(fd);
+		return false;
+	}
+
+	*out = fd;
+	return true;
+#else
+	HCC_UNUSED(path);
+	HCC_UNUSED(out);
+	return false;
+#endif
+}
+
+bool hcc_local_socket_accept(HccLocalSocket listener, HccLocalSocket* out) {
+#ifdef HCC_OS_LINUX
+	int fd;
+	do {
+		fd = accept4(listener, NULL, NULL, SOCK_CLOEXEC);
+	} while (fd < 0 && errno == EINTR);
+	if (fd < 0) {
+		return false;
+	}
+
+	*out = fd;
+	return true;
+#else
+	HCC_UNUSED(listener);
+	HCC_UNUSED(out);
+	return false;
+#endif
+}
+
+bool hcc_local_socket_connect(const char* path, HccLocalSocket* out) {
+#ifdef HCC_OS_LINUX
+	struct sockaddr_un addr = { .sun_family = AF_UNIX };
+	if (strlen(path) >= sizeof(addr.sun_path)) {
+		return false;
+	}
+	strcpy(addr.sun_path, path);
+
+	int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	if (fd < 0) {
+		return false;
+	}
+
+	if (connect(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0) {
+		close(fd);
+		return false;
+	}
+
+	*out = fd;
+	return true;
+#else
+	HCC_UNUSED(path);
+	HCC_UNUSED(out);
+	return false;
+#endif
+}
+
+bool hcc_local_socket_send(HccLocalSocket s, const void* data, uintptr_t size) {
+#ifdef HCC_OS_LINUX
+	const uint8_t* bytes = data;
+	while (size) {
+		//
+		// MSG_NOSIGNAL so a client that goes away does not take the server down with a SIGPIPE
+		ssize_t sent_size = send(s, bytes, size, MSG_NOSIGNAL);
+		if (sent_size < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			return false;
+		}
+		bytes += sent_size;
+		size -= sent_size;
+	}
+	return true;
+#else
+	HCC_UNUSED(s);
+	HCC_UNUSED(data);
+	HCC_UNUSED(size);
+	return false;
+#endif
+}
+
+bool hcc_local_socket_recv(HccLocalSocket s, void* data_out, uintptr_t size) {
+#ifdef HCC_OS_LINUX
+	uint8_t* bytes = data_out;
+	while (size) {
+		ssize_t recv_size = recv(s, bytes, size, 0);
+		if (recv_size <= 0) {
+			if (recv_size < 0 && errno == EINTR) {
+				continue;
+			}
+			return false;
+		}
+		bytes += recv_size;
+		size -= recv_size;
+	}
+	return true;
+#else
+	HCC_UNUSED(s);
+	HCC_UNUSED(data_out);
+	HCC_UNUSED(size);
+	return false;
+#endif
+}
+
+void hcc_local_socket_close(HccLocalSocket s) {
+#ifdef HCC_OS_LINUX
+	close(s);
+#else
+	HCC_UNUSED(s);
+#endif
+}
+
 #if defined(__linux__)
 void segfault_handler(int signum, siginfo_t* info, void* data) {
 	HCC_UNUSED(signum);
@@ -642,6 +821,13 @@ const char* hcc_error_strings[HCC_ERROR_COUNT] = {
 	[HCC_ERROR_END - HCC_ERROR_ALLOCATION_FAILURE - 1] = "error: allocation_failure",
 	[HCC_ERROR_END - HCC_ERROR_COLLECTION_FULL - 1] = "error: collection_full",
 	[HCC_ERROR_END - HCC_ERROR_MESSAGES - 1] = "error: messages",
+	[HCC_ERROR_END - HCC_ERROR_NOT_FINISHED - 1] = "error: not_finished",
+	[HCC_ERROR_END - HCC_ERROR_NOT_A_DIR - 1] = "error: not_a_dir",
+	[HCC_ERROR_END - HCC_ERROR_FILE_OPEN_READ - 1] = "error: file_open_read",
+	[HCC_ERROR_END - HCC_ERROR_FILE_READ - 1] = "error: file_read",
+	[HCC_ERROR_END - HCC_ERROR_INVALID_BINARY - 1] = "error: invalid_binary",
+	[HCC_ERROR_END - HCC_ERROR_OPEN_OUTPUT_FILE - 1] = "error: open_output_file",
+	[HCC_ERROR_END - HCC_ERROR_WRITE_OUTPUT_FILE - 1] = "error: write_output_file",
 	[HCC_ERROR_END - HCC_ERROR_THREAD_INIT - 1] = "error: thread_init",
 	[HCC_ERROR_END - HCC_ERROR_THREAD_WAIT_FOR_TERMINATION - 1] = "error: thread_wait_for_termination",
 	[HCC_ERROR_END - HCC_ERROR_SEMAPHORE_GIVE - 1] = "error: semaphore_give",
@@ -927,43 +1113,392 @@ void hcc_mutex_unlock(HccMutex* mutex) {
 
 const char* hcc_alloc_tag_strings[HCC_ALLOC_TAG_COUNT] = {
 	[HCC_ALLOC_TAG_NONE] = "NONE",
+	[HCC_ALLOC_TAG_GLOBAL_MEM_ARENA] = "GLOBAL_MEM_ARENA",
 	[HCC_ALLOC_TAG_CODE] = "CODE",
+	[HCC_ALLOC_TAG_STRING_TABLE_ENTRIES] = "STRING_TABLE_ENTRIES",
+	[HCC_ALLOC_TAG_STRING_TABLE_DATA] = "STRING_TABLE_DATA",
+	[HCC_ALLOC_TAG_STRING_TABLE_ID_TO_ENTRY_MAP] = "STRING_TABLE_ID_TO_ENTRY_MAP",
+	[HCC_ALLOC_TAG_WORKERS] = "WORKERS",
+	[HCC_ALLOC_TAG_WORKER_CALL_STACKS] = "WORKER_CALL_STACKS",
+	[HCC_ALLOC_TAG_WORKER_JOB_QUEUE] = "WORKER_JOB_QUEUE",
+	[HCC_ALLOC_TAG_ATA_TEXT] = "ATA_TEXT",
+	[HCC_ALLOC_TAG_ATA_BINARY] = "ATA_BINARY",
+	[HCC_ALLOC_TAG_ATA] = "ATA",
+	[HCC_ALLOC_TAG_AST_TEXT] = "AST_TEXT",
+	[HCC_ALLOC_TAG_AST_BINARY] = "AST_BINARY",
+	[HCC_ALLOC_TAG_AST] = "AST",
+	[HCC_ALLOC_TAG_AML_TEXT] = "AML_TEXT",
+	[HCC_ALLOC_TAG_AML_BINARY] = "AML_BINARY",
+	[HCC_ALLOC_TAG_AML] = "AML",
+	[HCC_ALLOC_TAG_WORKER_STRING_BUFFER] = "WORKER_STRING_BUFFER",
+	[HCC_ALLOC_TAG_WORKER_ARENA] = "WORKER_ARENA",
+	[HCC_ALLOC_TAG_MEM_TRACKER] = "MEM_TRACKER",
+	[HCC_ALLOC_TAG_CU_SHADER_FUNCTION_DECLS] = "CU_SHADER_FUNCTION_DECLS",
+	[HCC_ALLOC_TAG_CU_RESOURCE_STRUCTS] = "CU_RESOURCE_STRUCTS",
+	[HCC_ALLOC_TAG_CU_GLOBAL_DECLARATIONS] = "CU_GLOBAL_DECLARATIONS",
+	[HCC_ALLOC_TAG_CU_STRUCT_DECLARATIONS] = "CU_STRUCT_DECLARATIONS",
+	[HCC_ALLOC_TAG_CU_UNION_DECLARATIONS] = "CU_UNION_DECLARATIONS",
+	[HCC_ALLOC_TAG_CU_ENUM_DECLARATIONS] = "CU_ENUM_DECLARATIONS",
+	[HCC_ALLOC_TAG_DATA_TYPE_TABLE_ARRAYS] = "DATA_TYPE_TABLE_ARRAYS",
+	[HCC_ALLOC_TAG_DATA_TYPE_TABLE_COMPOUNDS] = "DATA_TYPE_TABLE_COMPOUNDS",
+	[HCC_ALLOC_TAG_DATA_TYPE_TABLE_COMPOUND_FIELDS] = "DATA_TYPE_TABLE_COMPOUND_FIELDS",
+	[HCC_ALLOC_TAG_DATA_TYPE_TABLE_TYPEDEFS] = "DATA_TYPE_TABLE_TYPEDEFS",
+	[HCC_ALLOC_TAG_DATA_TYPE_TABLE_ENUMS] = "DATA_TYPE_TABLE_ENUMS",
+	[HCC_ALLOC_TAG_DATA_TYPE_TABLE_ENUM_VALUES] = "DATA_TYPE_TABLE_ENUM_VALUES",
+	[HCC_ALLOC_TAG_DATA_TYPE_TABLE_POINTERS] = "DATA_TYPE_TABLE_POINTERS",
+	[HCC_ALLOC_TAG_DATA_TYPE_TABLE_FUNCTIONS] = "DATA_TYPE_TABLE_FUNCTIONS",
+	[HCC_ALLOC_TAG_DATA_TYPE_TABLE_FUNCTION_PARAMS] = "DATA_TYPE_TABLE_FUNCTION_PARAMS",
+	[HCC_ALLOC_TAG_DATA_TYPE_TABLE_BUFFERS] = "DATA_TYPE_TABLE_BUFFERS",
+	[HCC_ALLOC_TAG_DATA_TYPE_TABLE_ARRAYS_DEDUP_HASH_TABLE] = "DATA_TYPE_TABLE_ARRAYS_DEDUP_HASH_TABLE",
+	[HCC_ALLOC_TAG_DATA_TYPE_TABLE_POINTERS_DEDUP_HASH_TABLE] = "DATA_TYPE_TABLE_POINTERS_DEDUP_HASH_TABLE",
+	[HCC_ALLOC_TAG_DATA_TYPE_TABLE_FUNCTIONS_DEDUP_HASH_TABLE] = "DATA_TYPE_TABLE_FUNCTIONS_DEDUP_HASH_TABLE",
+	[HCC_ALLOC_TAG_DATA_TYPE_TABLE_BUFFERS_DEDUP_HASH_TABLE] = "DATA_TYPE_TABLE_BUFFERS_DEDUP_HASH_TABLE",
+	[HCC_ALLOC_TAG_DATA_TYPE_TABLE_ANON_COMPOUND_DEDUP_HASH_TABLE] = "DATA_TYPE_TABLE_ANON_COMPOUND_DEDUP_HASH_TABLE",
+	[HCC_ALLOC_TAG_LOCATION_TABLE_LOCATIONS] = "LOCATION_TABLE_LOCATIONS",
+	[HCC_ALLOC_TAG_LOCATION_TABLE_SPANS] = "LOCATION_TABLE_SPANS",
+	[HCC_ALLOC_TAG_LOCATION_TABLE_DECODED_HASH_TABLE] = "LOCATION_TABLE_DECODED_HASH_TABLE",
+	[HCC_ALLOC_TAG_ATA_TOKEN_BAG_TOKENS] = "ATA_TOKEN_BAG_TOKENS",
+	[HCC_ALLOC_TAG_ATA_TOKEN_BAG_LOCATIONS] = "ATA_TOKEN_BAG_LOCATIONS",
+	[HCC_ALLOC_TAG_ATA_TOKEN_BAG_VALUES] = "ATA_TOKEN_BAG_VALUES",
+	[HCC_ALLOC_TAG_AST_FILE_MACROS] = "AST_FILE_MACROS",
+	[HCC_ALLOC_TAG_AST_FILE_MACRO_PARAMS] = "AST_FILE_MACRO_PARAMS",
+	[HCC_ALLOC_TAG_AST_FILE_PRAGMA_ONCED_FILES] = "AST_FILE_PRAGMA_ONCED_FILES",
+	[HCC_ALLOC_TAG_AST_FILE_UNIQUE_INCLUDED_FILES] = "AST_FILE_UNIQUE_INCLUDED_FILES",
+	[HCC_ALLOC_TAG_AST_FORWARD_DECLARTIONS_TO_LINK] = "AST_FORWARD_DECLARTIONS_TO_LINK",
+	[HCC_ALLOC_TAG_AST_FILE_GLOBAL_DECLARATIONS] = "AST_FILE_GLOBAL_DECLARATIONS",
+	[HCC_ALLOC_TAG_AST_FILE_STRUCT_DECLARATIONS] = "AST_FILE_STRUCT_DECLARATIONS",
+	[HCC_ALLOC_TAG_AST_FILE_UNION_DECLARATIONS] = "AST_FILE_UNION_DECLARATIONS",
+	[HCC_ALLOC_TAG_AST_FILE_ENUM_DECLARATIONS] = "AST_FILE_ENUM_DECLARATIONS",
+	[HCC_ALLOC_TAG_AST_FILES_HASH_TABLE] = "AST_FILES_HASH_TABLE",
+	[HCC_ALLOC_TAG_AST_FILES] = "AST_FILES",
+	[HCC_ALLOC_TAG_AST_LINK_DEFERRED_FILES] = "AST_LINK_DEFERRED_FILES",
+	[HCC_ALLOC_TAG_AST_FUNCTION_PARAMS_AND_VARIABLES] = "AST_FUNCTION_PARAMS_AND_VARIABLES",
+	[HCC_ALLOC_TAG_AST_FUNCTIONS] = "AST_FUNCTIONS",
+	[HCC_ALLOC_TAG_AST_EXPRS] = "AST_EXPRS",
+	[HCC_ALLOC_TAG_AST_GLOBAL_VARIBALES] = "AST_GLOBAL_VARIBALES",
+	[HCC_ALLOC_TAG_AST_FORWARD_DECLARTIONS] = "AST_FORWARD_DECLARTIONS",
+	[HCC_ALLOC_TAG_AST_DESIGNATED_INITIALIZER_ELMT_INDICES] = "AST_DESIGNATED_INITIALIZER_ELMT_INDICES",
+	[HCC_ALLOC_TAG_AST_PCHS_HASH_TABLE] = "AST_PCHS_HASH_TABLE",
+	[HCC_ALLOC_TAG_AST_PCHS] = "AST_PCHS",
+	[HCC_ALLOC_TAG_AST_PCH_MACROS] = "AST_PCH_MACROS",
+	[HCC_ALLOC_TAG_AST_PCH_MACRO_PARAMS] = "AST_PCH_MACRO_PARAMS",
+	[HCC_ALLOC_TAG_AST_PCH_FILES] = "AST_PCH_FILES",
+	[HCC_ALLOC_TAG_AST_BINARY_CODE_FILES] = "AST_BINARY_CODE_FILES",
+	[HCC_ALLOC_TAG_AML_FUNCTION_ALCTOR_NODES_POOL] = "AML_FUNCTION_ALCTOR_NODES_POOL",
+	[HCC_ALLOC_TAG_AML_FUNCTION_ALCTOR_WORDS_POOL] = "AML_FUNCTION_ALCTOR_WORDS_POOL",
+	[HCC_ALLOC_TAG_AML_FUNCTION_ALCTOR_VALUES_POOL] = "AML_FUNCTION_ALCTOR_VALUES_POOL",
+	[HCC_ALLOC_TAG_AML_FUNCTION_ALCTOR_BASIC_BLOCKS_POOL] = "AML_FUNCTION_ALCTOR_BASIC_BLOCKS_POOL",
+	[HCC_ALLOC_TAG_AML_FUNCTION_ALCTOR_BASIC_BLOCK_PARAMS_POOL] = "AML_FUNCTION_ALCTOR_BASIC_BLOCK_PARAMS_POOL",
+	[HCC_ALLOC_TAG_AML_FUNCTION_ALCTOR_BASIC_BLOCK_PARAM_SRCS_POOL] = "AML_FUNCTION_ALCTOR_BASIC_BLOCK_PARAM_SRCS_POOL",
+	[HCC_ALLOC_TAG_AML_FUNCTIONS] = "AML_FUNCTIONS",
+	[HCC_ALLOC_TAG_AML_LOCATIONS] = "AML_LOCATIONS",
+	[HCC_ALLOC_TAG_AML_CALL_GRAPH_NODES] = "AML_CALL_GRAPH_NODES",
+	[HCC_ALLOC_TAG_AML_OPIMIZE_FUNCTIONS] = "AML_OPIMIZE_FUNCTIONS",
+	[HCC_ALLOC_TAG_AML_FUNCTION_CALL_NODE_LISTS] = "AML_FUNCTION_CALL_NODE_LISTS",
+	[HCC_ALLOC_TAG_AML_INLINE_FUNCTIONS] = "AML_INLINE_FUNCTIONS",
+	[HCC_ALLOC_TAG_SPIRV_FUNCTIONS] = "SPIRV_FUNCTIONS",
+	[HCC_ALLOC_TAG_SPIRV_FUNCTION_WORDS] = "SPIRV_FUNCTION_WORDS",
+	[HCC_ALLOC_TAG_SPIRV_TYPE_TABLE] = "SPIRV_TYPE_TABLE",
+	[HCC_ALLOC_TAG_SPIRV_DECL_TABLE] = "SPIRV_DECL_TABLE",
+	[HCC_ALLOC_TAG_SPIRV_DESCRIPTOR_BINDING_TABLE] = "SPIRV_DESCRIPTOR_BINDING_TABLE",
+	[HCC_ALLOC_TAG_SPIRV_CONSTANT_TABLE] = "SPIRV_CONSTANT_TABLE",
+	[HCC_ALLOC_TAG_SPIRV_TYPES_AND_CONSTANTS] = "SPIRV_TYPES_AND_CONSTANTS",
+	[HCC_ALLOC_TAG_SPIRV_TYPE_ELMT_IDS] = "SPIRV_TYPE_ELMT_IDS",
+	[HCC_ALLOC_TAG_SPIRV_ENTRY_POINTS] = "SPIRV_ENTRY_POINTS",
+	[HCC_ALLOC_TAG_SPIRV_ENTRY_POINT_GLOBAL_VARIABLE_IDS] = "SPIRV_ENTRY_POINT_GLOBAL_VARIABLE_IDS",
+	[HCC_ALLOC_TAG_SPIRV_GLOBAL_VARIABLE_WORDS] = "SPIRV_GLOBAL_VARIABLE_WORDS",
+	[HCC_ALLOC_TAG_SPIRV_NAME_WORDS] = "SPIRV_NAME_WORDS",
+	[HCC_ALLOC_TAG_SPIRV_DECORATE_WORDS] = "SPIRV_DECORATE_WORDS",
+	[HCC_ALLOC_TAG_SPIRV_DECORATE_BLOCKS] = "SPIRV_DECORATE_BLOCKS",
+	[HCC_ALLOC_TAG_SPIRV_ENTRY_POINT_BINARY_WORDS] = "SPIRV_ENTRY_POINT_BINARY_WORDS",
+	[HCC_ALLOC_TAG_SPIRV_LINK_JOBS] = "SPIRV_LINK_JOBS",
+	[HCC_ALLOC_TAG_SPIRV_FINAL_BINARY_WORDS] = "SPIRV_FINAL_BINARY_WORDS",
+	[HCC_ALLOC_TAG_PPGEN_EXPAND_STACK] = "PPGEN_EXPAND_STACK",
+	[HCC_ALLOC_TAG_PPGEN_EXPAND_MACRO_IDX_STACK] = "PPGEN_EXPAND_MACRO_IDX_STACK",
+	[HCC_ALLOC_TAG_PPGEN_STRINGIFY_BUFFER] = "PPGEN_STRINGIFY_BUFFER",
+	[HCC_ALLOC_TAG_PPGEN_IF_STACK] = "PPGEN_IF_STACK",
+	[HCC_ALLOC_TAG_PPGEN_MACRO_DECLARATIONS] = "PPGEN_MACRO_DECLARATIONS",
+	[HCC_ALLOC_TAG_PPGEN_MACRO_ARGS_STACK] = "PPGEN_MACRO_ARGS_STACK",
+	[HCC_ALLOC_TAG_ATAGEN_PAUSED_FILE_STACK] = "ATAGEN_PAUSED_FILE_STACK",
+	[HCC_ALLOC_TAG_ATAGEN_OPEN_BRACKET_STACK] = "ATAGEN_OPEN_BRACKET_STACK",
+	[HCC_ALLOC_TAG_ATAGEN_PCH_RECORD_STACK] = "ATAGEN_PCH_RECORD_STACK",
+	[HCC_ALLOC_TAG_ATAGEN_PCH_INCLUDED_FILES] = "ATAGEN_PCH_INCLUDED_FILES",
+	[HCC_ALLOC_TAG_ATAGEN_PCH_PRAGMA_ONCED_FILES] = "ATAGEN_PCH_PRAGMA_ONCED_FILES",
+	[HCC_ALLOC_TAG_ASTGEN_VARIABLE_STACK_STRINGS] = "ASTGEN_VARIABLE_STACK_STRINGS",
+	[HCC_ALLOC_TAG_ASTGEN_VARIABLE_STACK] = "ASTGEN_VARIABLE_STACK",
+	[HCC_ALLOC_TAG_ASTGEN_COMPOUND_FIELD_NAMES] = "ASTGEN_COMPOUND_FIELD_NAMES",
+	[HCC_ALLOC_TAG_ASTGEN_COMPOUND_FIELD_LOCATIONS] = "ASTGEN_COMPOUND_FIELD_LOCATIONS",
+	[HCC_ALLOC_TAG_ASTGEN_COMPOUND_TYPE_FIND_FIELDS] = "ASTGEN_COMPOUND_TYPE_FIND_FIELDS",
+	[HCC_ALLOC_TAG_ASTGEN_COMPOUND_FIELDS] = "ASTGEN_COMPOUND_FIELDS",
+	[HCC_ALLOC_TAG_ASTGEN_FUNCTION_PARAMS_AND_VARIABLES] = "ASTGEN_FUNCTION_PARAMS_AND_VARIABLES",
+	[HCC_ALLOC_TAG_ASTGEN_ENUM_VALUES] = "ASTGEN_ENUM_VALUES",
+	[HCC_ALLOC_TAG_ASTGEN_CURLY_INITIALIZER_NESTED] = "ASTGEN_CURLY_INITIALIZER_NESTED",
+	[HCC_ALLOC_TAG_ASTGEN_CURLY_INITIALIZER_NESTED_CURLYS] = "ASTGEN_CURLY_INITIALIZER_NESTED_CURLYS",
+	[HCC_ALLOC_TAG_ASTGEN_CURLY_INITIALIZER_NESTED_ELMTS] = "ASTGEN_CURLY_INITIALIZER_NESTED_ELMTS",
+	[HCC_ALLOC_TAG_AMLOPT_VALUE_REPLACEMENTS] = "AMLOPT_VALUE_REPLACEMENTS",
+	[HCC_ALLOC_TAG_AMLOPT_BASIC_BLOCKS] = "AMLOPT_BASIC_BLOCKS",
+	[HCC_ALLOC_TAG_AMLOPT_VALUES] = "AMLOPT_VALUES",
+	[HCC_ALLOC_TAG_AMLOPT_BASIC_BLOCK_PREDS] = "AMLOPT_BASIC_BLOCK_PREDS",
+	[HCC_ALLOC_TAG_AMLOPT_BASIC_BLOCK_ORDER] = "AMLOPT_BASIC_BLOCK_ORDER",
+	[HCC_ALLOC_TAG_AMLOPT_BASIC_BLOCK_WORK] = "AMLOPT_BASIC_BLOCK_WORK",
+	[HCC_ALLOC_TAG_AMLOPT_DOMINANCE_FRONTIERS] = "AMLOPT_DOMINANCE_FRONTIERS",
+	[HCC_ALLOC_TAG_AMLOPT_ALLOCS] = "AMLOPT_ALLOCS",
+	[HCC_ALLOC_TAG_AMLOPT_ALLOC_PARAMS] = "AMLOPT_ALLOC_PARAMS",
+	[HCC_ALLOC_TAG_AMLOPT_ALLOC_DEF_BASIC_BLOCKS] = "AMLOPT_ALLOC_DEF_BASIC_BLOCKS",
+	[HCC_ALLOC_TAG_AMLOPT_ALLOC_VALUES] = "AMLOPT_ALLOC_VALUES",
+	[HCC_ALLOC_TAG_AMLOPT_INLINE_SITES] = "AMLOPT_INLINE_SITES",
+	[HCC_ALLOC_TAG_AMLOPT_INLINE_CALLEE_MARKS] = "AMLOPT_INLINE_CALLEE_MARKS",
+	[HCC_ALLOC_TAG_AMLOPT_DOMINATOR_CHILDREN] = "AMLOPT_DOMINATOR_CHILDREN",
+	[HCC_ALLOC_TAG_AMLOPT_VALUE_NUMBERS] = "AMLOPT_VALUE_NUMBERS",
+	[HCC_ALLOC_TAG_AMLOPT_VALUE_NUMBER_BUCKETS] = "AMLOPT_VALUE_NUMBER_BUCKETS",
+	[HCC_ALLOC_TAG_AMLOPT_LOOP_HOISTS] = "AMLOPT_LOOP_HOISTS",
+	[HCC_ALLOC_TAG_AMLOPT_UNROLL_LOOPS] = "AMLOPT_UNROLL_LOOPS",
+	[HCC_ALLOC_TAG_AMLOPT_UNROLL_ITER_PARAMS] = "AMLOPT_UNROLL_ITER_PARAMS",
+	[HCC_ALLOC_TAG_SPIRVLINK_WORDS] = "SPIRVLINK_WORDS",
+	[HCC_ALLOC_TAG_SPIRVLINK_LIVE_FUNCTION_FLAGS] = "SPIRVLINK_LIVE_FUNCTION_FLAGS",
+	[HCC_ALLOC_TAG_SPIRVLINK_LIVE_ID_FLAGS] = "SPIRVLINK_LIVE_ID_FLAGS",
 };
 
-//
-// CONTRIBUTOR: we want track virtual memory reserves and releases so the user can
-// call a log and iterate over the allocated memory.
-//
-HCC_CONTRIBUTOR_TASK(memory tracking system)
-
 void hcc_mem_tracker_init(void) {
+	HccMemTracker* mt = &_hcc_gs.mem_tracker;
+
+	//
+	// the pages of the slots are only touched once they get used.
+	// the reservation is counted in its tag but it does not get a slot of its own.
+	uintptr_t size = HCC_INT_ROUND_UP_ALIGN(HCC_MEM_TRACKER_RESERVATIONS_CAP * sizeof(HccMemTrackerReservation), _hcc_gs.virt_mem_reserve_align);
+	HccMemTrackerReservation* reservations;
+	hcc_virt_mem_reserve_commit(HCC_ALLOC_TAG_MEM_TRACKER, NULL, size, HCC_VIRT_MEM_PROTECTION_READ_WRITE, (void**)&reservations);
+	atomic_store(&mt->reservations_end_idx, 0);
+	mt->reservations = reservations;
 }
 
 void hcc_mem_tracker_deinit(void) {
+	HccMemTracker* mt = &_hcc_gs.mem_tracker;
+	HccMemTrackerReservation* reservations = mt->reservations;
+	uintptr_t size = HCC_INT_ROUND_UP_ALIGN(HCC_MEM_TRACKER_RESERVATIONS_CAP * sizeof(HccMemTrackerReservation), _hcc_gs.virt_mem_reserve_align);
+	mt->reservations = NULL;
+	hcc_virt_mem_release(HCC_ALLOC_TAG_MEM_TRACKER, reservations, size);
+	hcc_mem_tracker_add_committed_size(HCC_ALLOC_TAG_MEM_TRACKER, -(int64_t)size);
 }
 
 void hcc_mem_tracker_update(HccAllocMode mode, HccAllocTag tag, void* addr, uintptr_t size) {
+	HccMemTracker* mt = &_hcc_gs.mem_tracker;
+	HccMemTrackerTag* mt_tag = &mt->tags[tag];
+	HccMemTrackerReservation* reservations = mt->reservations;
+	switch (mode) {
+		case HCC_ALLOC_MODE_ALLOC: {
+			atomic_fetch_add(&mt_tag->reserved_size, size);
+			atomic_fetch_add(&mt_tag->reserves_count, 1);
+			if (_hcc_tls.mem_tracker_task) {
+				atomic_fetch_add(&_hcc_tls.mem_tracker_task->mem_reserved_total_size, size);
+			}
+
+			if (reservations == NULL) {
+				break;
+			}
+
+			//
+			// take the first free slot so the slots of released reservations get used again and the scans stay short
+			uint32_t end_idx = atomic_load(&mt->reservations_end_idx);
+			for (uint32_t idx = 0; 1; idx += 1) {
+				while (idx == end_idx) {
+					if (end_idx == HCC_MEM_TRACKER_RESERVATIONS_CAP) {
+						atomic_fetch_add(&mt->untracked_reserves_count, 1);
+						goto END_ALLOC;
+					}
+
+					//
+					// every slot that has been used is taken, so start using a new one
+					if (atomic_compare_exchange_weak(&mt->reservations_end_idx, &end_idx, end_idx + 1)) {
+						end_idx += 1;
+					}
+				}
+
+				HccMemTrackerReservation* r = &reservations[idx];
+				uintptr_t expected_addr = 0;
+				if (atomic_load(&r->addr) == 0 && atomic_compare_exchange_strong(&r->addr, &expected_addr, HCC_MEM_TRACKER_ADDR_CLAIMED)) {
+					r->size = size;
+					r->tag = tag;
+					atomic_store(&r->committed_size, 0);
+					atomic_store(&r->addr, (uintptr_t)addr);
+					break;
+				}
+			}
+END_ALLOC: {}
+			break;
+		};
+		case HCC_ALLOC_MODE_DEALLOC: {
+			atomic_fetch_sub(&mt_tag->reserved_size, size);
+			atomic_fetch_sub(&mt_tag->reserves_count, 1);
+
+			//
+			// the committed bytes inside of the reservation are given back with it
+			HccMemTrackerReservation* r = hcc_mem_tracker_find_reservation(addr);
+			if (r) {
+				hcc_mem_tracker_add_committed_size(tag, -(int64_t)atomic_load(&r->committed_size));
+				atomic_store(&r->addr, 0);
+			}
+			break;
+		};
+	}
+
 	if (_hcc_gs.alloc_event_fn) {
 		_hcc_gs.alloc_event_fn(_hcc_gs.alloc_event_userdata, mode, tag, addr, size);
 	}
 }
 
-HccMemTrackerIter* hcc_mem_tracker_iter_start(void) {
+void hcc_mem_tracker_commit(HccAllocTag tag, void* addr, uintptr_t size) {
+	HccMemTrackerReservation* r = hcc_mem_tracker_find_reservation(addr);
+	if (r) {
+		atomic_fetch_add(&r->committed_size, size);
+	}
+	hcc_mem_tracker_add_committed_size(tag, size);
+	if (_hcc_tls.mem_tracker_task) {
+		atomic_fetch_add(&_hcc_tls.mem_tracker_task->mem_committed_total_size, size);
+	}
+}
+
+void hcc_mem_tracker_decommit(HccAllocTag tag, void* addr, uintptr_t size) {
+	HccMemTrackerReservation* r = hcc_mem_tracker_find_reservation(addr);
+	if (r) {
+		atomic_fetch_sub(&r->committed_size, size);
+	}
+	hcc_mem_tracker_add_committed_size(tag, -(int64_t)size);
+}
+
+HccMemTrackerReservation* hcc_mem_tracker_find_reservation(void* addr) {
+	HccMemTracker* mt = &_hcc_gs.mem_tracker;
+	HccMemTrackerReservation* reservations = mt->reservations;
+	if (reservations == NULL) {
+		return NULL;
+	}
+
+	uint32_t end_idx = atomic_load(&mt->reservations_end_idx);
+	for (uint32_t idx = 0; idx < end_idx; idx += 1) {
+		HccMemTrackerReservation* r = &reservations[idx];
+		uintptr_t r_addr = atomic_load(&r->addr);
+		if (r_addr <= HCC_MEM_TRACKER_ADDR_CLAIMED || (uintptr_t)addr < r_addr) {
+			continue;
+		}
+
+		//
+		// check the slot was not reused for another reservation while we were reading the size
+		uintptr_t r_size = r->size;
+		if ((uintptr_t)addr - r_addr < r_size && atomic_load(&r->addr) == r_addr) {
+			return r;
+		}
+	}
+
 	return NULL;
 }
 
+void hcc_mem_tracker_add_committed_size(HccAllocTag tag, int64_t size) {
+	HccMemTracker* mt = &_hcc_gs.mem_tracker;
+	HccMemTrackerTag* mt_tag = &mt->tags[tag];
+	uint64_t committed_size = atomic_fetch_add(&mt_tag->committed_size, size) + size;
+	uint64_t peak_size = atomic_load(&mt_tag->committed_peak_size);
+	while (committed_size > peak_size && !atomic_compare_exchange_weak(&mt_tag->committed_peak_size, &peak_size, committed_size)) {}
+
+	committed_size = atomic_fetch_add(&mt->committed_size, size) + size;
+	peak_size = atomic_load(&mt->committed_peak_size);
+	while (committed_size > peak_size && !atomic_compare_exchange_weak(&mt->committed_peak_size, &peak_size, committed_size)) {}
+}
+
+HccMemTrackerIter* hcc_mem_tracker_iter_start(void) {
+	HccMemTrackerIter* iter = &_hcc_tls.mem_tracker_iter;
+	HCC_ASSERT(!iter->is_active, "hcc_mem_tracker_iter_finish must be called before another iteration is started on the same thread");
+	iter->idx = 0;
+	iter->is_active = true;
+	return iter;
+}
+
 void hcc_mem_tracker_iter_finish(HccMemTrackerIter* iter) {
-	HCC_UNUSED(iter);
+	iter->is_active = false;
 }
 
 bool hcc_mem_tracker_iter_next(HccMemTrackerIter* iter, HccTrackedMem* out) {
-	HCC_UNUSED(iter);
-	HCC_UNUSED(out);
-	return true;
+	HccMemTracker* mt = &_hcc_gs.mem_tracker;
+	HccMemTrackerReservation* reservations = mt->reservations;
+	if (reservations == NULL) {
+		return false;
+	}
+
+	uint32_t end_idx = atomic_load(&mt->reservations_end_idx);
+	while (iter->idx < end_idx) {
+		HccMemTrackerReservation* r = &reservations[iter->idx];
+		iter->idx += 1;
+
+		uintptr_t r_addr = atomic_load(&r->addr);
+		if (r_addr <= HCC_MEM_TRACKER_ADDR_CLAIMED) {
+			continue;
+		}
+
+		out->tag = r->tag;
+		out->addr = (void*)r_addr;
+		out->size = r->size;
+		if (atomic_load(&r->addr) == r_addr) {
+			return true;
+		}
+	}
+
+	return false;
 }
 
-void hcc_mem_tracker_log(HccIIO* iio) {
-	HCC_UNUSED(iio);
+HccMemTrackerTagStats hcc_mem_tracker_tag_stats(HccAllocTag tag) {
+	HccMemTrackerTag* mt_tag = &_hcc_gs.mem_tracker.tags[tag];
+	HccMemTrackerTagStats stats;
+	stats.reserved_size = atomic_load(&mt_tag->reserved_size);
+	stats.committed_size = atomic_load(&mt_tag->committed_size);
+	stats.committed_peak_size = atomic_load(&mt_tag->committed_peak_size);
+	stats.reserves_count = atomic_load(&mt_tag->reserves_count);
+	return stats;
+}
+
+void hcc_mem_tracker_log(HccIIO* iio, HccCompiler* c, HccTask* t) {
+	HccMemTracker* mt = &_hcc_gs.mem_tracker;
+	hcc_iio_write_fmt(iio, "%-52s %14s %14s %14s %8s\n", "alloc tag", "reserved KiB", "committed KiB", "peak KiB", "reserves");
+
+	uint64_t reserved_size = 0;
+	uint32_t reserves_count = 0;
+	for (HccAllocTag tag = 0; tag < HCC_ALLOC_TAG_COUNT; tag += 1) {
+		HccMemTrackerTagStats stats = hcc_mem_tracker_tag_stats(tag);
+		if (stats.reserves_count == 0 && stats.committed_peak_size == 0) {
+			continue;
+		}
+
+		hcc_iio_write_fmt(
+			iio, "%-52s %14"PRIu64" %14"PRIu64" %14"PRIu64" %8u\n",
+			hcc_alloc_tag_strings[tag], stats.reserved_size / 1024, stats.committed_size / 1024, stats.committed_peak_size / 1024, stats.reserves_count
+		);
+		reserved_size += stats.reserved_size;
+		reserves_count += stats.reserves_count;
+	}
+
+	//
+	// the peak of the total is when the most was committed at once, not the sum of each tag's peak
+	hcc_iio_write_fmt(
+		iio, "%-52s %14"PRIu64" %14"PRIu64" %14"PRIu64" %8u\n",
+		"total", reserved_size / 1024, atomic_load(&mt->committed_size) / 1024, atomic_load(&mt->committed_peak_size) / 1024, reserves_count
+	);
+
+	uint32_t untracked_reserves_count = atomic_load(&mt->untracked_reserves_count);
+	if (untracked_reserves_count) {
+		hcc_iio_write_fmt(iio, "%u reserves did not fit in the tracker, the committed bytes of their tags will not go down when they are released\n", untracked_reserves_count);
+	}
+
+	hcc_iio_write_fmt(iio, "global arena high-water: %"PRIu64" KiB\n", hcc_arena_alctor_high_water_size(&_hcc_gs.arena_alctor) / 1024);
+	if (c) {
+		for (uint32_t worker_idx = 0; worker_idx < hcc_compiler_workers_count(c); worker_idx += 1) {
+			hcc_iio_write_fmt(iio, "worker %2u arena high-water: %"PRIu64" KiB\n", worker_idx, hcc_compiler_worker_arena_high_water_size(c, worker_idx) / 1024);
+		}
+	}
+
+	if (t) {
+		uint64_t task_reserved_total_size;
+		uint64_t task_committed_total_size;
+		hcc_task_mem_total_sizes(t, &task_reserved_total_size, &task_committed_total_size);
+		hcc_iio_write_fmt(iio, "task: %"PRIu64" KiB reserved, %"PRIu64" KiB committed in total, releases and decommits are not taken away\n", task_reserved_total_size / 1024, task_committed_total_size / 1024);
+	}
 }
 
 // ===========================================
@@ -988,16 +1523,15 @@ void hcc_arena_alctor_init(HccArenaAlctor* alctor, HccAllocTag tag, uint32_t are
 	HccArenaHeader* arena = hcc_arena_alloc(tag, arena_size);
 	alctor->arena = arena;
 	alctor->tag = tag;
+	alctor->high_water_size = 0;
 }
 
 void hcc_arena_alctor_deinit(HccArenaAlctor* alctor) {
-	uint32_t arena_size = alctor->arena->size;
 	while (alctor->arena) {
-		alctor->arena = alctor->arena->prev;
 		HccArenaHeader* arena = alctor->arena;
+		alctor->arena = arena->prev;
 		hcc_virt_mem_release(alctor->tag, arena, arena->size);
 	}
-	alctor->arena = NULL;
 }
 
 void* hcc_arena_alctor_alloc(HccArenaAlctor* alctor, uint32_t size, uint32_t align) {
@@ -1078,10 +1612,25 @@ void* hcc_arena_alctor_alloc_thread_safe(HccArenaAlctor* alctor, uint32_t size,
 
 void hcc_arena_alctor_reset(HccArenaAlctor* alctor) {
 	uint32_t arena_size = alctor->arena->size;
+	alctor->high_water_size = hcc_arena_alctor_high_water_size(alctor);
 	hcc_arena_alctor_deinit(alctor);
 	alctor->arena = hcc_arena_alloc(alctor->tag, arena_size);
 }
 
+uint64_t hcc_arena_alctor_used_size(HccArenaAlctor* alctor) {
+	uint64_t size = 0;
+	for (HccArenaHeader* arena = atomic_load(&alctor->arena); arena; arena = arena->prev) {
+		size += atomic_load(&arena->pos) - sizeof(HccArenaHeader);
+	}
+	return size;
+}
+
+uint64_t hcc_arena_alctor_high_water_size(HccArenaAlctor* alctor) {
+	//
+	// the arenas only grow until they are reset, so the most they have held since then is what they hold now
+	return HCC_MAX(alctor->high_water_size, hcc_arena_alctor_used_size(alctor));
+}
+
 // ===========================================
 //
 //
@@ -1165,6 +1714,7 @@ void hcc_virt_mem_reserve_commit(HccAllocTag tag, void* requested_addr, uintptr_
 #endif
 
 	hcc_mem_tracker_update(HCC_ALLOC_MODE_ALLOC, tag, addr, size);
+	hcc_mem_tracker_commit(tag, addr, size);
 	*addr_out = addr;
 }
 
@@ -1219,6 +1769,8 @@ void hcc_virt_mem_commit(HccAllocTag tag, void* addr, uintptr_t size, HccVirtMem
 #else
 #error "TODO implement virtual memory for this platform"
 #endif
+
+	hcc_mem_tracker_commit(tag, addr, size);
 }
 
 void hcc_virt_mem_protection_set(HccAllocTag tag, void* addr, uintptr_t size, HccVirtMemProtection protection) {
@@ -1267,6 +1819,8 @@ void hcc_virt_mem_decommit(HccAllocTag tag, void* addr, uintptr_t size) {
 #else
 #error "TODO implement virtual memory for this platform"
 #endif
+
+	hcc_mem_tracker_decommit(tag, addr, size);
 }
 
 void hcc_virt_mem_release(HccAllocTag tag, void* addr, uintptr_t size) {
@@ -1728,16 +2282,108 @@ HccHash32 hcc_hash_fnv_32(const void* data, uintptr_t size, HccHash32 hash) {
 	return hash;
 }
 
-HccHash64 hcc_hash_fnv_64(const void* data, uintptr_t size, HccHash64 hash) {
-	const char* bytes = data;
-	const char* bytes_end = bytes + size;
-	while (bytes < bytes_end) {
-		hash = hash ^ *bytes;
-		hash = hash * 0x00000100000001B3;
-		bytes += 1;
+//
+// a wyhash style hash that reads 8 bytes at a time, the secrets are the wyhash primes.
+const uint64_t hcc_hash_wy_secret[4] = { 0xa0761d6478bd642full, 0xe7037ed1a0b428dbull, 0x8ebc6af09c88c6e3ull, 0x589965cc75374cc3ull };
+
+void hcc_hash_wy_mum(uint64_t* a, uint64_t* b) {
+#ifdef __SIZEOF_INT128__
+	__uint128_t r = (__uint128_t)*a * *b;
+	*a = (uint64_t)r;
+	*b = (uint64_t)(r >> 64);
+#elif defined(HCC_OS_WINDOWS) && defined(HCC_ARCH_X86_64)
+	*a = _umul128(*a, *b, b);
+#else
+	//
+	// build the 128 bit result out of four 32 bit multiplies
+	uint64_t ha = *a >> 32, hb = *b >> 32, la = (uint32_t)*a, lb = (uint32_t)*b;
+	uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+	uint64_t t = rl + (rm0 << 32);
+	uint64_t carry = t < rl;
+	uint64_t lo = t + (rm1 << 32);
+	carry += lo < t;
+	*a = lo;
+	*b = rh + (rm0 >> 32) + (rm1 >> 32) + carry;
+#endif
+}
+
+uint64_t hcc_hash_wy_mix(uint64_t a, uint64_t b) {
+	hcc_hash_wy_mum(&a, &b);
+	return a ^ b;
+}
+
+uint64_t hcc_hash_wy_read_8(const uint8_t* bytes) {
+	uint64_t v;
+	memcpy(&v, bytes, sizeof(v));
+	return v;
+}
+
+uint64_t hcc_hash_wy_read_4(const uint8_t* bytes) {
+	uint32_t v;
+	memcpy(&v, bytes, sizeof(v));
+	return v;
+}
+
+HccHash64 hcc_hash_wy_64(const void* data, uintptr_t size, HccHash64 hash) {
+	const uint8_t* bytes = data;
+	uint64_t seed = hash ^ hcc_hash_wy_mix(hash ^ hcc_hash_wy_secret[0], hcc_hash_wy_secret[1]);
+	uint64_t a;
+	uint64_t b;
+	if (size <= 16) {
+		if (size >= 4) {
+			//
+			// read two overlapping pairs of 4 bytes from each end so 4 to 16 bytes need no loop
+			uintptr_t mid = (size >> 3) << 2;
+			a = (hcc_hash_wy_read_4(bytes) << 32) | hcc_hash_wy_read_4(bytes + mid);
+			b = (hcc_hash_wy_read_4(bytes + size - 4) << 32) | hcc_hash_wy_read_4(bytes + size - 4 - mid);
+		} else if (size > 0) {
+			a = ((uint64_t)bytes[0] << 16) | ((uint64_t)bytes[size >> 1] << 8) | bytes[size - 1];
+			b = 0;
+		} else {
+			a = 0;
+			b = 0;
+		}
+	} else {
+		uintptr_t remaining = size;
+		if (remaining > 48) {
+			//
+			// three independent lanes of 16 bytes so the multiplies can overlap
+			uint64_t seed1 = seed;
+			uint64_t seed2 = seed;
+			do {
+				seed = hcc_hash_wy_mix(hcc_hash_wy_read_8(bytes) ^ hcc_hash_wy_secret[1], hcc_hash_wy_read_8(bytes + 8) ^ seed);
+				seed1 = hcc_hash_wy_mix(hcc_hash_wy_read_8(bytes + 16) ^ hcc_hash_wy_secret[2], hcc_hash_wy_read_8(bytes + 24) ^ seed1);
+				seed2 = hcc_hash_wy_mix(hcc_hash_wy_read_8(bytes + 32) ^ hcc_hash_wy_secret[3], hcc_hash_wy_read_8(bytes + 40) ^ seed2);
+				bytes += 48;
+				remaining -= 48;
+			} while (remaining > 48);
+			seed ^= seed1 ^ seed2;
+		}
+
+		while (remaining > 16) {
+			seed = hcc_hash_wy_mix(hcc_hash_wy_read_8(bytes) ^ hcc_hash_wy_secret[1], hcc_hash_wy_read_8(bytes + 8) ^ seed);
+			bytes += 16;
+			remaining -= 16;
+		}
+
+		//
+		// the last 16 bytes overlap with the ones before them when the size is not a multiple of 16
+		a = hcc_hash_wy_read_8(bytes + remaining - 16);
+		b = hcc_hash_wy_read_8(bytes + remaining - 8);
 	}
 
-	return hash;
+	a ^= hcc_hash_wy_secret[1];
+	b ^= seed;
+	hcc_hash_wy_mum(&a, &b);
+	return hcc_hash_wy_mix(a ^ hcc_hash_wy_secret[0] ^ size, b ^ hcc_hash_wy_secret[1]);
+}
+
+HccHash32 hcc_hash_wy_32(const void* data, uintptr_t size, HccHash32 hash) {
+	return (HccHash32)hcc_hash_wy_64(data, size, hash);
+}
+
+HccHash64 hcc_hash_wy_u64(uint64_t v) {
+	return hcc_hash_wy_mix(v ^ hcc_hash_wy_secret[0], hcc_hash_wy_secret[1]);
 }
 
 void hcc_generate_enum_hashes(char* array_name, char** strings, char** enum_strings, uint32_t enums_count) {
@@ -2141,45 +2787,175 @@ enum {
 #endif
 static_assert(HCC_HASH_TABLE_BUCKET_ENTRIES_COUNT * sizeof(HccHash) % HCC_CACHE_LINE_SIZE == 0, "bucket must be a multiple of a cache line");
 
+#if defined(HCC_ARCH_X86_64)
+static_assert(sizeof(HccHash) == sizeof(uint64_t) && HCC_HASH_TABLE_BUCKET_ENTRIES_COUNT == 8, "the SIMD bucket matching expects 8 64 bit hashes per bucket");
+
+#ifdef __AVX2__
+#define HCC_HASH_TABLE_BUCKET_MASK(value) \
+	((uint32_t)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(lo, value))) | \
+	((uint32_t)_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(hi, value))) << 4))
+#else
+//
+// SSE2 has no 64 bit compare, so the low and high halves of the hashes are gathered into their own vectors
+// and both halves are compared 32 bits at a time.
+#define HCC_HASH_TABLE_BUCKET_MASK_SSE2(lo, hi, value_lo, value_hi) \
+	((uint32_t)_mm_movemask_ps(_mm_castsi128_ps(_mm_and_si128(_mm_cmpeq_epi32(lo, value_lo), _mm_cmpeq_epi32(hi, value_hi)))))
+#define HCC_HASH_TABLE_BUCKET_MASK(value) \
+	(HCC_HASH_TABLE_BUCKET_MASK_SSE2(lo0, hi0, _mm_set1_epi32((uint32_t)(value)), _mm_set1_epi32((uint32_t)((value) >> 32))) | \
+	(HCC_HASH_TABLE_BUCKET_MASK_SSE2(lo1, hi1, _mm_set1_epi32((uint32_t)(value)), _mm_set1_epi32((uint32_t)((value) >> 32))) << 4))
+#endif
+#endif
+
+HccHashTableBucketMasks hcc_hash_table_bucket_masks(HccAtomic(HccHash)* bucket, HccHash hash) {
+	HccHashTableBucketMasks masks;
+#if defined(HCC_ARCH_X86_64)
+	//
+	// the buckets are cache line aligned, so each 8 byte hash is still read in one piece by the vector loads.
+	// the loads are not atomic as a whole, but the callers only trust an entry after checking its key and
+	// they reload the bucket when they see an entry that is still being inserted.
+#ifdef __AVX2__
+	__m256i lo = _mm256_load_si256((const __m256i*)&bucket[0]);
+	__m256i hi = _mm256_load_si256((const __m256i*)&bucket[4]);
+	masks.match = HCC_HASH_TABLE_BUCKET_MASK(_mm256_set1_epi64x(hash));
+	masks.empty = HCC_HASH_TABLE_BUCKET_MASK(_mm256_setzero_si256());
+	masks.tombstone = HCC_HASH_TABLE_BUCKET_MASK(_mm256_set1_epi64x(HCC_HASH_TABLE_HASH_TOMBSTONE));
+	masks.inserting = HCC_HASH_TABLE_BUCKET_MASK(_mm256_set1_epi64x(HCC_HASH_TABLE_HASH_IS_INSERTING));
+#else
+	__m128 v0 = _mm_load_ps((const float*)&bucket[0]);
+	__m128 v1 = _mm_load_ps((const float*)&bucket[2]);
+	__m128 v2 = _mm_load_ps((const float*)&bucket[4]);
+	__m128 v3 = _mm_load_ps((const float*)&bucket[6]);
+	__m128i lo0 = _mm_castps_si128(_mm_shuffle_ps(v0, v1, _MM_SHUFFLE(2, 0, 2, 0)));
+	__m128i hi0 = _mm_castps_si128(_mm_shuffle_ps(v0, v1, _MM_SHUFFLE(3, 1, 3, 1)));
+	__m128i lo1 = _mm_castps_si128(_mm_shuffle_ps(v2, v3, _MM_SHUFFLE(2, 0, 2, 0)));
+	__m128i hi1 = _mm_castps_si128(_mm_shuffle_ps(v2, v3, _MM_SHUFFLE(3, 1, 3, 1)));
+	masks.match = HCC_HASH_TABLE_BUCKET_MASK((uint64_t)hash);
+	masks.empty = HCC_HASH_TABLE_BUCKET_MASK((uint64_t)HCC_HASH_TABLE_HASH_EMPTY);
+	masks.tombstone = HCC_HASH_TABLE_BUCKET_MASK((uint64_t)HCC_HASH_TABLE_HASH_TOMBSTONE);
+	masks.inserting = HCC_HASH_TABLE_BUCKET_MASK((uint64_t)HCC_HASH_TABLE_HASH_IS_INSERTING);
+#endif
+
+	//
+	// stop the compiler from moving the loads of the keys above the loads of the hashes
+	atomic_thread_fence(memory_order_acquire);
+#else
+	masks = (HccHashTableBucketMasks){0};
+	for (uint32_t idx = 0; idx < HCC_HASH_TABLE_BUCKET_ENTRIES_COUNT; idx += 1) {
+		HccHash existing_hash = atomic_load(&bucket[idx]);
+		uint32_t bit = (uint32_t)1 << idx;
+		if (existing_hash == hash) masks.match |= bit;
+		else if (existing_hash == HCC_HASH_TABLE_HASH_EMPTY) masks.empty |= bit;
+		else if (existing_hash == HCC_HASH_TABLE_HASH_TOMBSTONE) masks.tombstone |= bit;
+		else if (existing_hash == HCC_HASH_TABLE_HASH_IS_INSERTING) masks.inserting |= bit;
+	}
+#endif
+	return masks;
+}
+
+uintptr_t _hcc_hash_table_reserve_size(uintptr_t initial_cap, uintptr_t elmt_size, uintptr_t* hashes_offset_out) {
+	//
+	// the hashes start on their own page so each level can be committed and reset on it's own
+	uintptr_t reserve_cap = initial_cap * (((uintptr_t)1 << HCC_HASH_TABLE_LEVELS_MAX) - 1);
+	uintptr_t hashes_offset = HCC_INT_ROUND_UP_ALIGN(sizeof(HccHashTableHeader) + (reserve_cap * elmt_size), _hcc_gs.virt_mem_page_size);
+	if (hashes_offset_out) {
+		*hashes_offset_out = hashes_offset;
+	}
+	return HCC_INT_ROUND_UP_ALIGN(hashes_offset + (reserve_cap * sizeof(HccHash)), _hcc_gs.virt_mem_reserve_align);
+}
+
 HccHashTable(void) _hcc_hash_table_init(HccAllocTag tag, HccHashTableKeyCmpFn key_cmp_fn, HccHashTableKeyHashFn key_hash_fn, uintptr_t cap, uintptr_t elmt_size) {
 	HCC_DEBUG_ASSERT_POWER_OF_TWO(cap);
-	uintptr_t size = HCC_INT_ROUND_UP_ALIGN(HCC_INT_ROUND_UP_ALIGN(sizeof(HccHashTableHeader) + (cap * elmt_size), HCC_CACHE_LINE_ALIGN) + (cap * sizeof(HccHash)), _hcc_gs.virt_mem_reserve_align);
+	uintptr_t hashes_offset;
+	uintptr_t size = _hcc_hash_table_reserve_size(cap, elmt_size, &hashes_offset);
 	HccHashTableHeader* header;
-	hcc_virt_mem_reserve_commit(tag, NULL, size, HCC_VIRT_MEM_PROTECTION_READ_WRITE, (void**)&header);
+	hcc_virt_mem_reserve(tag, NULL, size, (void**)&header);
+	hcc_virt_mem_commit(tag, header, HCC_INT_ROUND_UP_ALIGN(sizeof(HccHashTableHeader), _hcc_gs.virt_mem_page_size), HCC_VIRT_MEM_PROTECTION_READ_WRITE);
 
 	//
 	// initialize the header and pass out the where the elements of the array start
 	header->count = 0;
-	header->cap = cap;
+	header->cap = 0;
+	header->levels_count = 0;
+	header->committed_levels_count = 0;
+	header->initial_cap = cap;
 	header->key_cmp_fn = key_cmp_fn;
 	header->key_hash_fn = key_hash_fn;
-	header->hashes = HCC_PTR_ROUND_UP_ALIGN(HCC_PTR_ADD((header + 1), cap * elmt_size), HCC_CACHE_LINE_ALIGN);
+	header->hashes = HCC_PTR_ADD(header, hashes_offset);
 	header->tag = tag;
 #if HCC_ENABLE_DEBUG_ASSERTIONS
 	header->magic_number = HCC_HASH_TABLE_MAGIC_NUMBER;
 	header->elmt_size = elmt_size;
 #endif
 
-	HccHashTable(void) table = header + 1;
-	_hcc_hash_table_clear(table, elmt_size);
-	return table;
+	//
+	// the memory is zeroed by the OS so the first level starts off empty
+	_hcc_hash_table_open_level(header, 0, elmt_size);
+	return header + 1;
 }
 
 void _hcc_hash_table_deinit(HccHashTable(void) table, uintptr_t elmt_size) {
 	HccHashTableHeader* header = hcc_hash_table_header(table);
 	HCC_DEBUG_ASSERT_HASH_TABLE(header, elmt_size);
-	uintptr_t size = HCC_INT_ROUND_UP_ALIGN(HCC_INT_ROUND_UP_ALIGN(sizeof(HccHashTableHeader) + (header->cap * elmt_size), HCC_CACHE_LINE_ALIGN) + (header->cap * sizeof(HccHash)), _hcc_gs.virt_mem_reserve_align);
+	uintptr_t size = _hcc_hash_table_reserve_size(header->initial_cap, elmt_size, NULL);
 	hcc_virt_mem_release(header->tag, header, size);
 }
 
 void _hcc_hash_table_clear(HccHashTable(void) table, uintptr_t elmt_size) {
 	HccHashTableHeader* header = hcc_hash_table_header(table);
 	HCC_DEBUG_ASSERT_HASH_TABLE(header, elmt_size);
-	uintptr_t size = HCC_INT_ROUND_UP_ALIGN(HCC_INT_ROUND_UP_ALIGN(sizeof(HccHashTableHeader) + (header->cap * elmt_size), HCC_CACHE_LINE_ALIGN) + (header->cap * sizeof(HccHash)), _hcc_gs.virt_mem_reserve_align);
+
+	//
+	// only the levels that have been opened need to be reset,
+	// the levels after the first one stay committed for when they get opened again.
+	uintptr_t cap = header->cap;
+	uintptr_t entries_size = HCC_INT_ROUND_UP_ALIGN(sizeof(HccHashTableHeader) + (cap * elmt_size), _hcc_gs.virt_mem_page_size);
+	uintptr_t hashes_size = HCC_INT_ROUND_UP_ALIGN(cap * sizeof(HccHash), _hcc_gs.virt_mem_page_size);
 	HccHashTableHeader h = *header;
-	hcc_virt_mem_reset(header->tag, header, size);
+	hcc_virt_mem_reset(h.tag, h.hashes, hashes_size);
+	hcc_virt_mem_reset(h.tag, header, entries_size);
 	*header = h;
 	header->count = 0;
+	header->cap = header->initial_cap;
+	header->levels_count = 1;
+}
+
+void _hcc_hash_table_open_level(HccHashTableHeader* header, uint32_t levels_count, uintptr_t elmt_size) {
+	hcc_spin_mutex_lock(&header->levels_mutex);
+
+	//
+	// another thread may have already opened the level while we were waiting on the lock
+	if (atomic_load(&header->levels_count) == levels_count) {
+		if (levels_count == HCC_HASH_TABLE_LEVELS_MAX) {
+			hcc_spin_mutex_unlock(&header->levels_mutex);
+			hcc_bail(HCC_ERROR_COLLECTION_FULL, header->tag);
+		}
+
+		uintptr_t level_start_idx = header->initial_cap * (((uintptr_t)1 << levels_count) - 1);
+		uintptr_t level_end_idx = header->initial_cap * (((uintptr_t)1 << (levels_count + 1)) - 1);
+
+		//
+		// the levels stay committed when the table is cleared.
+		// the start is rounded up as the page it is in was committed with the header or the level before.
+		if (levels_count == header->committed_levels_count) {
+			void* entries_start = HCC_PTR_ROUND_UP_ALIGN(HCC_PTR_ADD(header + 1, level_start_idx * elmt_size), _hcc_gs.virt_mem_page_size);
+			void* entries_end = HCC_PTR_ROUND_UP_ALIGN(HCC_PTR_ADD(header + 1, level_end_idx * elmt_size), _hcc_gs.virt_mem_page_size);
+			if (entries_start < entries_end) {
+				hcc_virt_mem_commit(header->tag, entries_start, HCC_PTR_DIFF(entries_end, entries_start), HCC_VIRT_MEM_PROTECTION_READ_WRITE);
+			}
+
+			void* hashes_start = HCC_PTR_ROUND_UP_ALIGN(&header->hashes[level_start_idx], _hcc_gs.virt_mem_page_size);
+			void* hashes_end = HCC_PTR_ROUND_UP_ALIGN(&header->hashes[level_end_idx], _hcc_gs.virt_mem_page_size);
+			if (hashes_start < hashes_end) {
+				hcc_virt_mem_commit(header->tag, hashes_start, HCC_PTR_DIFF(hashes_end, hashes_start), HCC_VIRT_MEM_PROTECTION_READ_WRITE);
+			}
+			header->committed_levels_count = levels_count + 1;
+		}
+
+		atomic_store(&header->cap, level_end_idx);
+		atomic_store(&header->levels_count, levels_count + 1);
+	}
+
+	hcc_spin_mutex_unlock(&header->levels_mutex);
 }
 
 uintptr_t _hcc_hash_table_find_idx(HccHashTable(void) table, void* key, uintptr_t key_size, uintptr_t elmt_size) {
@@ -2191,114 +2967,170 @@ uintptr_t _hcc_hash_table_find_idx(HccHashTable(void) table, void* key, uintptr_
 	HccHash hash = header->key_hash_fn(key, key_size);
 	if (hash < HCC_HASH_TABLE_HASH_START) hash += HCC_HASH_TABLE_HASH_START;
 
-	//
-	// divide the entry capacity by the number of entries in a bucket
-	// and see what bucket we should start our search in.
-	uintptr_t buckets_count = header->cap >> HCC_HASH_TABLE_BUCKET_ENTRIES_SHIFT;
-	uintptr_t bucket_idx = hash & (buckets_count - 1);
-
-	uintptr_t step = 1;
 	HccAtomic(HccHash)* hashes = header->hashes;
-	while (1) {
+	uint32_t levels_count = atomic_load(&header->levels_count);
+	for (uint32_t level = 0; level < levels_count; level += 1) {
 		//
-		// multiply by the number of entries in a bucket to get the position in the entry arrays.
-		uintptr_t bucket_entry_start_idx = bucket_idx << HCC_HASH_TABLE_BUCKET_ENTRIES_SHIFT;
-		for (uintptr_t entry_idx = bucket_entry_start_idx; entry_idx < bucket_entry_start_idx + HCC_HASH_TABLE_BUCKET_ENTRIES_COUNT; entry_idx += 1) {
-			HccHash existing_hash;
-			while ((existing_hash = atomic_load(&hashes[entry_idx])) == HCC_HASH_TABLE_HASH_IS_INSERTING) {
+		// divide the level's entry capacity by the number of entries in a bucket
+		// and see what bucket we should start our search in.
+		uintptr_t level_start_idx = header->initial_cap * (((uintptr_t)1 << level) - 1);
+		uintptr_t buckets_count = (header->initial_cap << level) >> HCC_HASH_TABLE_BUCKET_ENTRIES_SHIFT;
+		uintptr_t bucket_idx = hash & (buckets_count - 1);
+
+		//
+		// the quadratic probing visits every bucket in the level after buckets_count steps
+		for (uintptr_t step = 1; step <= buckets_count; step += 1) {
+			//
+			// multiply by the number of entries in a bucket to get the position in the entry arrays.
+			uintptr_t bucket_entry_start_idx = level_start_idx + (bucket_idx << HCC_HASH_TABLE_BUCKET_ENTRIES_SHIFT);
+
+			//
+			// the entries are filled in order, so only the ones before the first empty entry are in use.
+			// wait for any of those that are being inserted so we can see their hash.
+			HccHashTableBucketMasks masks;
+			uint32_t in_use_mask;
+			while (1) {
+				masks = hcc_hash_table_bucket_masks(&hashes[bucket_entry_start_idx], hash);
+				in_use_mask = (masks.empty & -masks.empty) - 1;
+				if (!(masks.inserting & in_use_mask)) {
+					break;
+				}
 				HCC_CPU_RELAX();
 			}
 
-			if (existing_hash == hash) {
+			for (uint32_t match_mask = masks.match & in_use_mask; match_mask; match_mask = HCC_LEAST_SET_BIT_REMOVE(match_mask)) {
 				//
 				// hash matches, check if the key matches
+				uintptr_t entry_idx = bucket_entry_start_idx + hcc_leastsetbitidx32(match_mask);
 				void* entry_ptr = HCC_PTR_ADD(table, entry_idx * elmt_size);
 				if (header->key_cmp_fn(key, entry_ptr, key_size)) {
 					// key matches, success!
 					return entry_idx;
 				}
-			} else if (existing_hash == HCC_HASH_TABLE_HASH_EMPTY) {
-				// found an empty hash, no other entries have been inserted past this point
-				return UINTPTR_MAX;
 			}
-		}
 
-		//
-		// quadratic probing to help reduce clustering of entries
-		bucket_idx += step;
-		step += 1;
-		bucket_idx &= (buckets_count - 1);
+			if (masks.empty) {
+				// found an empty hash, no other entries have been inserted past this point in this level
+				goto NEXT_LEVEL;
+			}
+
+			//
+			// quadratic probing to help reduce clustering of entries
+			bucket_idx += step;
+			bucket_idx &= (buckets_count - 1);
+		}
+NEXT_LEVEL: {}
 	}
+
+	return UINTPTR_MAX;
 }
 
 HccHashTableInsert _hcc_hash_table_find_insert_idx(HccHashTable(void) table, void* key, uintptr_t key_size, uintptr_t elmt_size) {
 	HccHashTableHeader* header = hcc_hash_table_header(table);
 	HCC_DEBUG_ASSERT_HASH_TABLE(header, elmt_size);
-	if (atomic_load(&header->count) >= header->cap) {
-		hcc_bail(HCC_ERROR_COLLECTION_FULL, header->tag);
-	}
 
 	//
 	// hash the key and ensure it is no one of the special marker hash values.
 	HccHash hash = header->key_hash_fn(key, key_size);
 	if (hash < HCC_HASH_TABLE_HASH_START) hash += HCC_HASH_TABLE_HASH_START;
 
-	//
-	// divide the entry capacity by the number of entries in a bucket
-	// and see what bucket we should start our search in.
-	uintptr_t buckets_count = header->cap >> HCC_HASH_TABLE_BUCKET_ENTRIES_SHIFT;
-	uintptr_t bucket_idx = hash & (buckets_count - 1);
-
-	uintptr_t step = 1;
 	HccAtomic(HccHash)* hashes = header->hashes;
 	while (1) {
+		uint32_t levels_count = atomic_load(&header->levels_count);
+
 		//
-		// multiply by the number of entries in a bucket to get the position in the entry arrays.
-		uintptr_t bucket_entry_start_idx = bucket_idx << HCC_HASH_TABLE_BUCKET_ENTRIES_SHIFT;
-		for (uintptr_t entry_idx = bucket_entry_start_idx; entry_idx < bucket_entry_start_idx + HCC_HASH_TABLE_BUCKET_ENTRIES_COUNT; entry_idx += 1) {
-TRY_THIS_HASH_AGAIN: {}
-			HccHash existing_hash;
-			while ((existing_hash = atomic_load(&hashes[entry_idx])) == HCC_HASH_TABLE_HASH_IS_INSERTING) {
-				HCC_CPU_RELAX();
-			}
+		// open the next level before the last one gets too full to probe quickly
+		uintptr_t cap = atomic_load(&header->cap);
+		if (atomic_load(&header->count) >= cap - cap / 4) {
+			_hcc_hash_table_open_level(header, levels_count, elmt_size);
+			continue;
+		}
 
-			if (existing_hash == hash) {
-				// hash matches, check if the key matches
-				void* entry_ptr = HCC_PTR_ADD(table, entry_idx * elmt_size);
-				if (header->key_cmp_fn(key, entry_ptr, key_size)) {
-					// key matches, success!
-					return (HccHashTableInsert) { .idx = entry_idx, .is_new = false };
-				}
-			} else if (existing_hash == HCC_HASH_TABLE_HASH_EMPTY || existing_hash == HCC_HASH_TABLE_HASH_TOMBSTONE) {
+		for (uint32_t level = 0; level < levels_count; level += 1) {
+			bool is_last_level = level + 1 == levels_count;
+
+			//
+			// divide the level's entry capacity by the number of entries in a bucket
+			// and see what bucket we should start our search in.
+			uintptr_t level_start_idx = header->initial_cap * (((uintptr_t)1 << level) - 1);
+			uintptr_t buckets_count = (header->initial_cap << level) >> HCC_HASH_TABLE_BUCKET_ENTRIES_SHIFT;
+			uintptr_t bucket_idx = hash & (buckets_count - 1);
+
+			//
+			// the quadratic probing visits every bucket in the level after buckets_count steps
+			for (uintptr_t step = 1; step <= buckets_count; step += 1) {
 				//
-				// found an empty or tombstone hash that we can use for our value.
-				// but lets fight all the other threads to see if we can take this hash first.
-				do {
-					if (atomic_compare_exchange_weak(&hashes[entry_idx], &existing_hash, HCC_HASH_TABLE_HASH_IS_INSERTING)) {
+				// multiply by the number of entries in a bucket to get the position in the entry arrays.
+				uintptr_t bucket_entry_start_idx = level_start_idx + (bucket_idx << HCC_HASH_TABLE_BUCKET_ENTRIES_SHIFT);
+TRY_THIS_BUCKET_AGAIN: {}
+				//
+				// the entries are filled in order, so only the ones before the first empty entry are in use.
+				// wait for any of those that are being inserted so we can see their hash.
+				HccHashTableBucketMasks masks = hcc_hash_table_bucket_masks(&hashes[bucket_entry_start_idx], hash);
+				uint32_t in_use_mask = (masks.empty & -masks.empty) - 1;
+				if (masks.inserting & in_use_mask) {
+					HCC_CPU_RELAX();
+					goto TRY_THIS_BUCKET_AGAIN;
+				}
+
+				for (uint32_t match_mask = masks.match & in_use_mask; match_mask; match_mask = HCC_LEAST_SET_BIT_REMOVE(match_mask)) {
+					// hash matches, check if the key matches
+					uintptr_t entry_idx = bucket_entry_start_idx + hcc_leastsetbitidx32(match_mask);
+					void* entry_ptr = HCC_PTR_ADD(table, entry_idx * elmt_size);
+					if (header->key_cmp_fn(key, entry_ptr, key_size)) {
+						// key matches, success!
+						return (HccHashTableInsert) { .idx = entry_idx, .is_new = false };
+					}
+				}
+
+				uint32_t free_mask = masks.empty | masks.tombstone;
+				if (free_mask && is_last_level) {
+					//
+					// found an empty or tombstone hash that we can use for our value.
+					// but lets fight all the other threads to see if we can take this hash first.
+					uint32_t free_bit = free_mask & -free_mask;
+					uintptr_t entry_idx = bucket_entry_start_idx + hcc_leastsetbitidx32(free_bit);
+					HccHash existing_hash = (masks.tombstone & free_bit) ? HCC_HASH_TABLE_HASH_TOMBSTONE : HCC_HASH_TABLE_HASH_EMPTY;
+					if (!atomic_compare_exchange_strong(&hashes[entry_idx], &existing_hash, HCC_HASH_TABLE_HASH_IS_INSERTING)) {
+						//
+						// another thread stole our entry slot,
+						// lets try again to see if it inserted the hash we are looking for.
+						goto TRY_THIS_BUCKET_AGAIN;
+					}
+
+					if (atomic_load(&header->levels_count) != levels_count) {
 						//
-						// we won against the other threads, so claim the slot.
-						void* entry_ptr = HCC_PTR_ADD(table, entry_idx * elmt_size);
-						atomic_fetch_add(&header->count, 1);
-						memcpy(entry_ptr, key, key_size ? key_size : sizeof(HccString));
-						atomic_store(&hashes[entry_idx], hash);
-						return (HccHashTableInsert){ .idx = entry_idx, .is_new = true };
+						// a new level was opened while we were probing, the other threads only insert into that level now.
+						// so give the slot back and start again so the key cannot end up in both levels.
+						atomic_store(&hashes[entry_idx], existing_hash);
+						goto RETRY;
 					}
-				} while (existing_hash == HCC_HASH_TABLE_HASH_EMPTY || existing_hash == HCC_HASH_TABLE_HASH_TOMBSTONE);
+
+					//
+					// we won against the other threads, so claim the slot.
+					void* entry_ptr = HCC_PTR_ADD(table, entry_idx * elmt_size);
+					atomic_fetch_add(&header->count, 1);
+					memcpy(entry_ptr, key, key_size ? key_size : sizeof(HccString));
+					atomic_store(&hashes[entry_idx], hash);
+					return (HccHashTableInsert){ .idx = entry_idx, .is_new = true };
+				} else if (masks.empty) {
+					// found an empty hash, the key can only be in one of the newer levels
+					goto NEXT_LEVEL;
+				}
 
 				//
-				// another thread stole our entry slot,
-				// lets try again to see if it inserted the hash we are looking for.
-				goto TRY_THIS_HASH_AGAIN;
+				// quadratic probing to help reduce clustering of entries
+				bucket_idx += step;
+				bucket_idx &= (buckets_count - 1);
 			}
+NEXT_LEVEL: {}
 		}
 
 		//
-		// quadratic probing to help reduce clustering of entries
-		bucket_idx += step;
-		step += 1;
-		bucket_idx &= (buckets_count - 1);
+		// every bucket in the last level is full, so open the next level and insert into that
+		_hcc_hash_table_open_level(header, levels_count, elmt_size);
+RETRY: {}
 	}
-
 }
 
 bool _hcc_hash_table_remove(HccHashTable(void) table, void* key, uintptr_t key_size, uintptr_t elmt_size) {
@@ -2309,10 +3141,31 @@ bool _hcc_hash_table_remove(HccHashTable(void) table, void* key, uintptr_t key_s
 
 	HccHashTableHeader* header = hcc_hash_table_header(table);
 	atomic_store(&header->hashes[entry_idx], HCC_HASH_TABLE_HASH_TOMBSTONE);
+	atomic_fetch_sub(&header->count, 1);
 
 	return true;
 }
 
+void _hcc_hash_table_insert_at_idx(HccHashTable(void) table, uintptr_t idx, void* key, uintptr_t key_size, uintptr_t elmt_size) {
+	HccHashTableHeader* header = hcc_hash_table_header(table);
+	HCC_DEBUG_ASSERT_HASH_TABLE(header, elmt_size);
+
+	//
+	// the slot may have been in a level that the original table had grown into
+	while (idx >= atomic_load(&header->cap)) {
+		_hcc_hash_table_open_level(header, atomic_load(&header->levels_count), elmt_size);
+	}
+	HCC_DEBUG_ASSERT(atomic_load(&header->hashes[idx]) == HCC_HASH_TABLE_HASH_EMPTY, "hash table slot '%zu' is already in use", idx);
+
+	HccHash hash = header->key_hash_fn(key, key_size);
+	if (hash < HCC_HASH_TABLE_HASH_START) hash += HCC_HASH_TABLE_HASH_START;
+
+	void* entry_ptr = HCC_PTR_ADD(table, idx * elmt_size);
+	memcpy(entry_ptr, key, key_size ? key_size : sizeof(HccString));
+	atomic_fetch_add(&header->count, 1);
+	atomic_store(&header->hashes[idx], hash);
+}
+
 bool hcc_u32_key_cmp(void* a, void* b, uintptr_t size) {
 	HCC_UNUSED(size);
 	return *(uint32_t*)a == *(uint32_t*)b;
@@ -2324,24 +3177,24 @@ bool hcc_u64_key_cmp(void* a, void* b, uintptr_t size) {
 }
 
 HccHash hcc_data_key_hash(void* key, uintptr_t size) {
-	return hcc_hash_fnv(key, size, HCC_HASH_FNV_INIT);
+	return hcc_hash_wy(key, size, HCC_HASH_WY_INIT);
 }
 
 HccHash hcc_string_key_hash(void* key, uintptr_t size) {
 	HCC_UNUSED(size);
 
 	HccString string = *(HccString*)key;
-	return hcc_hash_fnv(string.data, string.size, HCC_HASH_FNV_INIT);
+	return hcc_hash_wy(string.data, string.size, HCC_HASH_WY_INIT);
 }
 
 HccHash hcc_u32_key_hash(void* key, uintptr_t size) {
 	HCC_DEBUG_ASSERT(size == sizeof(uint32_t), "key is not a uint32_t");
-	return *(uint32_t*)key;
+	return hcc_hash_wy_u64(*(uint32_t*)key);
 }
 
 HccHash hcc_u64_key_hash(void* key, uintptr_t size) {
 	HCC_DEBUG_ASSERT(size == sizeof(uint64_t), "key is not a uint64_t");
-	return *(uint64_t*)key;
+	return hcc_hash_wy_u64(*(uint64_t*)key);
 }
 
 // ===========================================
@@ -2766,10 +3619,10 @@ void hcc_data_type_table_init(HccCU* cu, HccCUSetup* setup) {
 	cu->dtt.functions = hcc_stack_init(HccFunctionDataType, HCC_ALLOC_TAG_DATA_TYPE_TABLE_FUNCTIONS, setup->functions_grow_count, setup->functions_reserve_cap);
 	cu->dtt.function_params = hcc_stack_init(HccDataType, HCC_ALLOC_TAG_DATA_TYPE_TABLE_FUNCTION_PARAMS, setup->function_params_and_variables_grow_count, setup->function_params_and_variables_reserve_cap);
 	cu->dtt.buffers = hcc_stack_init(HccBufferDataType, HCC_ALLOC_TAG_DATA_TYPE_TABLE_BUFFERS, setup->dtt.buffers_grow_count, setup->dtt.buffers_reserve_cap);
-	cu->dtt.arrays_dedup_hash_table = hcc_hash_table_init(HccDataTypeDedupEntry, HCC_ALLOC_TAG_DATA_TYPE_TABLE_ARRAYS_DEDUP_HASH_TABLE, hcc_u64_key_cmp, hcc_u64_key_hash, setup->dtt.arrays_reserve_cap);
-	cu->dtt.pointers_dedup_hash_table = hcc_hash_table_init(HccDataTypeDedupEntry, HCC_ALLOC_TAG_DATA_TYPE_TABLE_POINTERS_DEDUP_HASH_TABLE, hcc_u64_key_cmp, hcc_u64_key_hash, setup->dtt.pointers_reserve_cap);
-	cu->dtt.functions_dedup_hash_table = hcc_hash_table_init(HccDataTypeDedupEntry, HCC_ALLOC_TAG_DATA_TYPE_TABLE_FUNCTIONS_DEDUP_HASH_TABLE, hcc_u64_key_cmp, hcc_u64_key_hash, setup->functions_reserve_cap);
-	cu->dtt.buffers_dedup_hash_table = hcc_hash_table_init(HccDataTypeDedupEntry, HCC_ALLOC_TAG_DATA_TYPE_TABLE_BUFFERS_DEDUP_HASH_TABLE, hcc_u64_key_cmp, hcc_u64_key_hash, setup->dtt.buffers_reserve_cap);
+	cu->dtt.arrays_dedup_hash_table = hcc_hash_table_init(HccDataTypeDedupEntry, HCC_ALLOC_TAG_DATA_TYPE_TABLE_ARRAYS_DEDUP_HASH_TABLE, hcc_u64_key_cmp, hcc_u64_key_hash, HCC_HASH_TABLE_INITIAL_CAP_FOR(setup->dtt.arrays_reserve_cap));
+	cu->dtt.pointers_dedup_hash_table = hcc_hash_table_init(HccDataTypeDedupEntry, HCC_ALLOC_TAG_DATA_TYPE_TABLE_POINTERS_DEDUP_HASH_TABLE, hcc_u64_key_cmp, hcc_u64_key_hash, HCC_HASH_TABLE_INITIAL_CAP_FOR(setup->dtt.pointers_reserve_cap));
+	cu->dtt.functions_dedup_hash_table = hcc_hash_table_init(HccDataTypeDedupEntry, HCC_ALLOC_TAG_DATA_TYPE_TABLE_FUNCTIONS_DEDUP_HASH_TABLE, hcc_u64_key_cmp, hcc_u64_key_hash, HCC_HASH_TABLE_INITIAL_CAP_FOR(setup->functions_reserve_cap));
+	cu->dtt.buffers_dedup_hash_table = hcc_hash_table_init(HccDataTypeDedupEntry, HCC_ALLOC_TAG_DATA_TYPE_TABLE_BUFFERS_DEDUP_HASH_TABLE, hcc_u64_key_cmp, hcc_u64_key_hash, HCC_HASH_TABLE_INITIAL_CAP_FOR(setup->dtt.buffers_reserve_cap));
 
 	switch (hcc_options_get_u32(cu->options, HCC_OPTION_KEY_TARGET_ARCH)) {
 		case HCC_TARGET_ARCH_X86_64:
@@ -2799,6 +3652,12 @@ void hcc_data_type_table_deinit(HccCU* cu) {
 	hcc_stack_deinit(cu->dtt.enum_values);
 	hcc_stack_deinit(cu->dtt.buffers);
 	hcc_stack_deinit(cu->dtt.pointers);
+	hcc_stack_deinit(cu->dtt.functions);
+	hcc_stack_deinit(cu->dtt.function_params);
+	hcc_hash_table_deinit(cu->dtt.arrays_dedup_hash_table);
+	hcc_hash_table_deinit(cu->dtt.pointers_dedup_hash_table);
+	hcc_hash_table_deinit(cu->dtt.functions_dedup_hash_table);
+	hcc_hash_table_deinit(cu->dtt.buffers_dedup_hash_table);
 }
 
 HccString hcc_data_type_string(HccCU* cu, HccDataType data_type) {
@@ -4328,12 +5187,12 @@ HccDataType hcc_function_data_type_deduplicate(HccCU* cu, HccDataType return_dat
 
 	return_data_type = hcc_data_type_lower_ast_to_aml(cu, return_data_type);
 
-	uint64_t key = HCC_HASH_FNV_64_INIT;
-	key = hcc_hash_fnv_64(&return_data_type, sizeof(HccDataType), key);
+	uint64_t key = HCC_HASH_WY_64_INIT;
+	key = hcc_hash_wy_64(&return_data_type, sizeof(HccDataType), key);
 	for (uint32_t param_idx = 0; param_idx < params_count; param_idx += 1) {
 		HccDataType* param_data_type_ptr = HCC_PTR_ADD(params, param_idx * params_stride);
 		HccDataType param_data_type = hcc_data_type_lower_ast_to_aml(cu, *param_data_type_ptr);
-		key = hcc_hash_fnv_64(&param_data_type, sizeof(HccDataType), key);
+		key = hcc_hash_wy_64(&param_data_type, sizeof(HccDataType), key);
 	}
 
 	HccHashTableInsert insert = hcc_hash_table_find_insert_idx(cu->dtt.functions_dedup_hash_table, &key);
@@ -4757,16 +5616,16 @@ HccHash hcc_constant_key_hash(void* key, uintptr_t size) {
 	HCC_DEBUG_ASSERT(size == sizeof(HccConstantEntry), "key is not a HccConstantEntry");
 
 	HccConstantEntry* entry = key;
-	HccHash hash = HCC_HASH_FNV_INIT;
-	hash = hcc_hash_fnv(&entry->data_type, sizeof(entry->data_type), hash);
+	HccHash hash = HCC_HASH_WY_INIT;
+	hash = hcc_hash_wy(&entry->data_type, sizeof(entry->data_type), hash);
 	uint32_t constant_size = entry->size;
-	hash = hcc_hash_fnv(&constant_size, sizeof(constant_size), hash);
-	hash = hcc_hash_fnv(entry->data, entry->size, hash);
+	hash = hcc_hash_wy(&constant_size, sizeof(constant_size), hash);
+	hash = hcc_hash_wy(entry->data, entry->size, hash);
 	return hash;
 }
 
 void hcc_constant_table_init(HccCU* cu, HccConstantTableSetup* setup) {
-	cu->constant_table.entries_hash_table = hcc_hash_table_init(HccConstantEntry, 0, hcc_constant_entry_key_cmp, hcc_constant_key_hash, setup->entries_cap);
+	cu->constant_table.entries_hash_table = hcc_hash_table_init(HccConstantEntry, 0, hcc_constant_entry_key_cmp, hcc_constant_key_hash, HCC_HASH_TABLE_INITIAL_CAP_FOR(setup->entries_cap));
 	cu->constant_table.data = hcc_stack_init(uint8_t, 0, setup->data_grow_size, setup->data_reserve_size);
 }
 
@@ -5220,6 +6079,7 @@ void hcc_iio_flush(HccIIO* iio) {
 void hcc_iio_close(HccIIO* iio) {
 	if (iio->close_fn) {
 		iio->close_fn(iio);
+		iio->close_fn = NULL;
 	}
 }
 
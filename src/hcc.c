@@ -57,26 +57,32 @@ void hcc_cu_init(HccCU* cu, HccCUSetup* setup, HccOptions* options) {
 		;
 
 	hcc_constant_table_init(cu, &setup->constant_table);
+	hcc_location_table_init(cu, &setup->location_table);
 	hcc_data_type_table_init(cu, setup);
 	hcc_ast_init(cu, setup);
 	hcc_aml_init(cu, setup);
 	hcc_spirv_init(cu, setup);
 	cu->shader_function_decls = hcc_stack_init(HccDecl, HCC_ALLOC_TAG_CU_SHADER_FUNCTION_DECLS, setup->functions_grow_count, setup->functions_reserve_cap);
 	cu->resource_structs = hcc_stack_init(HccDataType, HCC_ALLOC_TAG_CU_RESOURCE_STRUCTS, setup->dtt.compounds_grow_count, setup->dtt.compounds_reserve_cap);
-	cu->global_declarations = hcc_hash_table_init(HccDeclEntryAtomic, HCC_ALLOC_TAG_CU_GLOBAL_DECLARATIONS, hcc_u32_key_cmp, hcc_u32_key_hash, global_declarations_cap);
-	cu->struct_declarations = hcc_hash_table_init(HccDeclEntryAtomic, HCC_ALLOC_TAG_CU_STRUCT_DECLARATIONS, hcc_u32_key_cmp, hcc_u32_key_hash, setup->dtt.compounds_reserve_cap);
-	cu->union_declarations = hcc_hash_table_init(HccDeclEntryAtomic, HCC_ALLOC_TAG_CU_UNION_DECLARATIONS, hcc_u32_key_cmp, hcc_u32_key_hash, setup->dtt.compounds_reserve_cap);
-	cu->enum_declarations = hcc_hash_table_init(HccDeclEntryAtomic, HCC_ALLOC_TAG_CU_ENUM_DECLARATIONS, hcc_u32_key_cmp, hcc_u32_key_hash, setup->dtt.enums_reserve_cap);
-	cu->global_declarations_cap = global_declarations_cap;
-	cu->compounds_cap = setup->dtt.compounds_reserve_cap;
-	cu->enums_cap = setup->dtt.enums_reserve_cap;
+	cu->global_declarations = hcc_hash_table_init(HccDeclEntryAtomic, HCC_ALLOC_TAG_CU_GLOBAL_DECLARATIONS, hcc_u32_key_cmp, hcc_u32_key_hash, HCC_HASH_TABLE_INITIAL_CAP_FOR(global_declarations_cap));
+	cu->struct_declarations = hcc_hash_table_init(HccDeclEntryAtomic, HCC_ALLOC_TAG_CU_STRUCT_DECLARATIONS, hcc_u32_key_cmp, hcc_u32_key_hash, HCC_HASH_TABLE_INITIAL_CAP_FOR(setup->dtt.compounds_reserve_cap));
+	cu->union_declarations = hcc_hash_table_init(HccDeclEntryAtomic, HCC_ALLOC_TAG_CU_UNION_DECLARATIONS, hcc_u32_key_cmp, hcc_u32_key_hash, HCC_HASH_TABLE_INITIAL_CAP_FOR(setup->dtt.compounds_reserve_cap));
+	cu->enum_declarations = hcc_hash_table_init(HccDeclEntryAtomic, HCC_ALLOC_TAG_CU_ENUM_DECLARATIONS, hcc_u32_key_cmp, hcc_u32_key_hash, HCC_HASH_TABLE_INITIAL_CAP_FOR(setup->dtt.enums_reserve_cap));
 }
 
 void hcc_cu_deinit(HccCU* cu) {
 	hcc_constant_table_deinit(cu);
+	hcc_location_table_deinit(cu);
 	hcc_data_type_table_deinit(cu);
 	hcc_ast_deinit(cu);
 	hcc_aml_deinit(cu);
+	hcc_spirv_deinit(cu);
+	hcc_stack_deinit(cu->shader_function_decls);
+	hcc_stack_deinit(cu->resource_structs);
+	hcc_hash_table_deinit(cu->global_declarations);
+	hcc_hash_table_deinit(cu->struct_declarations);
+	hcc_hash_table_deinit(cu->union_declarations);
+	hcc_hash_table_deinit(cu->enum_declarations);
 }
 
 // ===========================================
@@ -114,6 +120,7 @@ HccOptionValue hcc_option_key_defaults[HCC_OPTION_KEY_COUNT] = {
 	[HCC_OPTION_KEY_SPIRV_OPT] =                    { .bool_ = false },
 	[HCC_OPTION_KEY_HLSL_PACKING] =                 { .bool_ = false },
 	[HCC_OPTION_KEY_UNORDERED_SWIZZLING_ENABLED] =  { .bool_ = false },
+	[HCC_OPTION_KEY_OPT_LEVEL] =                    { .uint = HCC_OPT_LEVEL_0 },
 };
 
 HccResult hcc_options_init(HccOptionsSetup* setup, HccOptions** o_out) {
@@ -261,6 +268,46 @@ HccResult hcc_options_add_define(HccOptions* options, HccString name, HccString
 	return HCC_RESULT_SUCCESS;
 }
 
+HccHash64 hcc_options_hash(HccOptions* options, HccHash64 hash) {
+	for (HccOptionKey key = 0; key < HCC_OPTION_KEY_COUNT; key += 1) {
+		switch (key) {
+			//
+			// these are only used from BACKENDGEN onwards, so changing them can still reuse an AST or AML binary.
+			// the float types are checked in AMLOPT, see HccASTBinaryHeader.supported_scalar_data_types_mask
+			case HCC_OPTION_KEY_TARGET_GFX_API:
+			case HCC_OPTION_KEY_TARGET_FORMAT:
+			case HCC_OPTION_KEY_FLOAT16_ENABLED:
+			case HCC_OPTION_KEY_FLOAT64_ENABLED:
+			case HCC_OPTION_KEY_RESOURCE_DESCRIPTORS_MAX:
+			case HCC_OPTION_KEY_SHADER_ENUM_NAME:
+			case HCC_OPTION_KEY_SHADER_ENUM_PREFIX:
+			case HCC_OPTION_KEY_SHADER_INFOS_NAME:
+			case HCC_OPTION_KEY_SHADER_NAMES_NAME:
+			case HCC_OPTION_KEY_RESOURCE_STRUCTS_ENUM_NAME:
+			case HCC_OPTION_KEY_RESOURCE_STRUCTS_ENUM_PREFIX:
+			case HCC_OPTION_KEY_SPIRV_OPT:
+				continue;
+			default:
+				break;
+		}
+
+		HccOptionValue value = hcc_options_get(options, key);
+		bool is_set = hcc_options_is_set(options, key);
+		hash = hcc_hash_wy_64(&value.uint, sizeof(value.uint), hash);
+		hash = hcc_hash_wy_64(&is_set, sizeof(is_set), hash);
+	}
+
+	for (uint32_t idx = 0; idx < hcc_stack_count(options->defines); idx += 1) {
+		HccOptionDefine* define = &options->defines[idx];
+		hash = hcc_hash_wy_64(&define->name.size, sizeof(define->name.size), hash);
+		hash = hcc_hash_wy_64(define->name.data, define->name.size, hash);
+		hash = hcc_hash_wy_64(&define->value.size, sizeof(define->value.size), hash);
+		hash = hcc_hash_wy_64(define->value.data, define->value.size, hash);
+	}
+
+	return hash;
+}
+
 bool hcc_options_is_char_unsigned(HccOptions* o) {
 	switch (hcc_options_get_u32(o, HCC_OPTION_KEY_TARGET_ARCH)) {
 		case HCC_TARGET_ARCH_X86_64:
@@ -284,6 +331,13 @@ HccTaskSetup hcc_task_setup_default = {
 			.data_reserve_size = 67108864, // 64MB
 			.entries_cap = 1048576,
 		},
+		.location_table = {
+			.locations_grow_count = 16384,
+			.locations_reserve_cap = 8388608,
+			.spans_grow_count = 1024,
+			.spans_reserve_cap = 262144,
+			.decoded_locations_cap = 262144,
+		},
 		.dtt = {
 			.arrays_grow_count = 1024,
 			.arrays_reserve_cap = 131072,
@@ -328,6 +382,10 @@ HccTaskSetup hcc_task_setup_default = {
 			.forward_declarations_reserve_cap = 131072,
 			.designated_initializer_elmt_indices_grow_count = 1024,
 			.designated_initializer_elmt_indices_reserve_cap = 131072,
+			.pchs_cap = 4096,
+			.pch_files_grow_count = 1024,
+			.pch_files_reserve_cap = 131072,
+			.binary_code_files_cap = 4096,
 		},
 		.aml = {
 			.function_alctor = {
@@ -346,6 +404,8 @@ HccTaskSetup hcc_task_setup_default = {
 	.include_paths_cap = 1024,
 	.messages_cap = 4096,
 	.message_strings_cap = 32768,
+	.ast_binary_grow_size = 1048576,    // 1MB
+	.ast_binary_reserve_size = 268435456, // 256MB
 };
 
 const char* hcc_worker_job_type_strings[HCC_WORKER_JOB_TYPE_COUNT] = {
@@ -358,6 +418,19 @@ const char* hcc_worker_job_type_strings[HCC_WORKER_JOB_TYPE_COUNT] = {
 	[HCC_WORKER_JOB_TYPE_BACKENDLINK] = "BACKENDLINK",
 };
 
+const char* hcc_aml_opt_pass_strings[HCC_AML_OPT_PASS_COUNT] = {
+	[HCC_AML_OPT_PASS_MAKE_CALL_GRAPH] = "make_call_graph",
+	[HCC_AML_OPT_PASS_CHECK_FOR_RECURSION] = "check_for_recursion",
+	[HCC_AML_OPT_PASS_CHECK_FOR_UNSUPPORTED_FEATURES] = "check_for_unsupported_features",
+	[HCC_AML_OPT_PASS_INLINE] = "inline",
+	[HCC_AML_OPT_PASS_PROMOTE_STATIC_ALLOCS] = "promote_static_allocs",
+	[HCC_AML_OPT_PASS_CONSTANT_FOLD] = "constant_fold",
+	[HCC_AML_OPT_PASS_VALUE_NUMBERING] = "value_numbering",
+	[HCC_AML_OPT_PASS_HOIST_LOOP_INVARIANTS] = "hoist_loop_invariants",
+	[HCC_AML_OPT_PASS_UNROLL_LOOPS] = "unroll_loops",
+	[HCC_AML_OPT_PASS_ELIMINATE_DEAD_CODE] = "eliminate_dead_code",
+};
+
 HccTaskInputLocation* hcc_task_input_location_init(HccTask* t, HccOptions* options) {
 	HccTaskInputLocation* il = HCC_ARENA_ALCTOR_ALLOC_ELMT_THREAD_SAFE(HccTaskInputLocation, &_hcc_gs.arena_alctor);
 	il->next = t->input_locations;
@@ -383,8 +456,9 @@ HccResult hcc_task_add_output(HccTask* t, HccWorkerJobType job_type, HccEncoding
 	return HCC_RESULT_SUCCESS;
 }
 
-void hcc_task_output_job(HccTask* t, HccWorkerJobType job_type) {
+HccResult hcc_task_output_job(HccTask* t, HccWorkerJobType job_type) {
 	HccTaskOutputLocation* output_location = &t->output_job_locations[job_type];
+	HccResult result = HCC_RESULT_SUCCESS;
 
 	switch (output_location->encoding) {
 		case HCC_ENCODING_TEXT: {
@@ -419,19 +493,48 @@ void hcc_task_output_job(HccTask* t, HccWorkerJobType job_type) {
 					break;
 				case HCC_WORKER_JOB_TYPE_ASTGEN:
 					break;
-				case HCC_WORKER_JOB_TYPE_ASTLINK:
+				case HCC_WORKER_JOB_TYPE_ASTLINK: {
+					//
+					// the AST that was loaded is the same as the one that would have been written.
+					// the front end does not run when the AML binary has been loaded, so the AST binary is written back as it was given.
+					HccStack(uint8_t) ast_binary = (t->flags & (HCC_TASK_FLAGS_HAS_LOADED_AST_BINARY | HCC_TASK_FLAGS_HAS_LOADED_AML_BINARY)) ? t->input_ast_binary : t->output_ast_binary;
+					if (ast_binary == NULL) {
+						break;
+					}
+
+					uintptr_t write_size = hcc_stack_count(ast_binary);
+					uintptr_t written_size = hcc_iio_write(iio, ast_binary, write_size);
+					if (written_size != write_size) {
+						result = HccResult(HCC_ERROR_WRITE_OUTPUT_FILE, 0, NULL);
+					}
 					break;
+				};
 				case HCC_WORKER_JOB_TYPE_AMLGEN:
 					break;
-				case HCC_WORKER_JOB_TYPE_AMLOPT:
+				case HCC_WORKER_JOB_TYPE_AMLOPT: {
+					//
+					// the AML is left untouched by the backend, so it is written out now just like the text output.
+					// the AML that was loaded is the same as the one that would have been written.
+					if (!(t->flags & HCC_TASK_FLAGS_HAS_LOADED_AML_BINARY)) {
+						hcc_task_capture_aml_binary(t);
+					}
+
+					HccStack(uint8_t) aml_binary = (t->flags & HCC_TASK_FLAGS_HAS_LOADED_AML_BINARY) ? t->input_aml_binary : t->output_aml_binary;
+					uintptr_t write_size = hcc_stack_count(aml_binary);
+					uintptr_t written_size = hcc_iio_write(iio, aml_binary, write_size);
+					if (written_size != write_size) {
+						result = HccResult(HCC_ERROR_WRITE_OUTPUT_FILE, 0, NULL);
+					}
 					break;
+				};
 				case HCC_WORKER_JOB_TYPE_BACKENDGEN:
 					break;
 				case HCC_WORKER_JOB_TYPE_BACKENDLINK: {
-					uint32_t write_size = t->cu->spirv.final_binary_words_count * sizeof(HccSPIRVWord);
+					uint32_t write_size = hcc_stack_count(t->cu->spirv.final_binary_words) * sizeof(HccSPIRVWord);
 					uint32_t written_size = hcc_iio_write(iio, t->cu->spirv.final_binary_words, write_size);
 					if (written_size != write_size) {
-						HCC_ABORT("TODO report this error properly: error writing out final file to disk. written %u, expected: %u", written_size, write_size);
+						result = HccResult(HCC_ERROR_WRITE_OUTPUT_FILE, 0, NULL);
+						break;
 					}
 
 					if (t->output_iio_metadata_c) {
@@ -465,6 +568,93 @@ void hcc_task_output_job(HccTask* t, HccWorkerJobType job_type) {
 			}
 			break;
 	}
+
+	return result;
+}
+
+HccResult hcc_task_output_entry_point_binaries(HccTask* t) {
+	HccCU* cu = t->cu;
+	for (uint32_t entry_point_idx = 0; entry_point_idx < hcc_stack_count(cu->spirv.entry_points); entry_point_idx += 1) {
+		HccSPIRVEntryPoint* entry_point = &cu->spirv.entry_points[entry_point_idx];
+		HccString name = hcc_string_table_get(entry_point->identifier_string_id);
+
+		char path[PATH_MAX];
+		snprintf(path, sizeof(path), "%s/%.*s.spirv", t->output_entry_point_binaries_dir, (int)name.size, name.data);
+
+		HccIIO iio;
+		if (!hcc_file_open_write(path, &iio)) {
+			return HccResult(HCC_ERROR_OPEN_OUTPUT_FILE, errno, NULL);
+		}
+
+		uint32_t write_size = entry_point->binary_words_count * sizeof(HccSPIRVWord);
+		uint32_t written_size = hcc_iio_write(&iio, &cu->spirv.entry_point_binary_words[entry_point->binary_words_start_idx], write_size);
+		hcc_iio_close(&iio);
+		if (written_size != write_size) {
+			return HccResult(HCC_ERROR_WRITE_OUTPUT_FILE, 0, NULL);
+		}
+	}
+
+	return HCC_RESULT_SUCCESS;
+}
+
+HccHash64 hcc_task_inputs_hash(HccTask* t) {
+	HccHash64 hash = HCC_HASH_WY_64_INIT;
+	hash = hcc_options_hash(t->options, hash);
+	for (uint32_t idx = 0; idx < hcc_stack_count(t->include_path_strings); idx += 1) {
+		HccString path = t->include_path_strings[idx];
+		hash = hcc_hash_wy_64(&path.size, sizeof(path.size), hash);
+		hash = hcc_hash_wy_64(path.data, path.size, hash);
+	}
+
+	//
+	// the contents of the files are checked by their code hash when the binary is loaded
+	for (HccTaskInputLocation* il = t->input_locations; il; il = il->next) {
+		hash = hcc_hash_wy_64(&il->file_path.size, sizeof(il->file_path.size), hash);
+		hash = hcc_hash_wy_64(il->file_path.data, il->file_path.size, hash);
+		hash = hcc_options_hash(il->options, hash);
+	}
+
+	return hash;
+}
+
+void hcc_task_capture_ast_binary(HccTask* t) {
+	if (t->output_ast_binary) {
+		hcc_stack_deinit(t->output_ast_binary);
+	}
+
+	t->output_ast_binary = hcc_ast_binary_write(t->cu, hcc_task_inputs_hash(t), false);
+}
+
+void hcc_task_capture_aml_binary(HccTask* t) {
+	if (t->output_aml_binary) {
+		hcc_stack_deinit(t->output_aml_binary);
+	}
+
+	t->output_aml_binary = hcc_ast_binary_write(t->cu, hcc_task_inputs_hash(t), true);
+}
+
+bool hcc_task_read_binary(HccTask* t, HccIIO* iio, HccStack(uint8_t) binary) {
+	while (1) {
+		uintptr_t count = hcc_stack_count(binary);
+		uintptr_t read_cap = hcc_stack_reserve_cap(binary) - count;
+		if (read_cap == 0) {
+			return false;
+		}
+
+		read_cap = HCC_MIN(read_cap, t->ast_binary_grow_size);
+		hcc_stack_push_many(binary, read_cap);
+		uintptr_t read_size = hcc_iio_read(iio, &binary[count], read_cap);
+		if (read_size == UINTPTR_MAX) {
+			return false;
+		}
+
+		hcc_stack_resize(binary, count + read_size);
+		if (read_size < read_cap) {
+			break;
+		}
+	}
+	hcc_iio_close(iio);
+	return true;
 }
 
 void hcc_task_finish(HccTask* t, bool thread_that_set_error) {
@@ -478,16 +668,27 @@ void hcc_task_finish(HccTask* t, bool thread_that_set_error) {
 	t->duration = hcc_time_diff(end_time, t->start_time);
 	bool is_compiler_finished = atomic_fetch_sub(&c->tasks_running_count, 1) == 1;
 	if (is_compiler_finished) {
+		//
+		// the workers are left idling so the compiler can be dispatched to again,
+		// they only stop when the compiler is deinitialized.
 		c->duration = hcc_time_diff(end_time, c->start_time);
-		atomic_fetch_or(&c->flags, HCC_COMPILER_FLAGS_IS_STOPPING);
 	}
 
 	if (was_successful) {
+		//
+		// a file that cannot be written fails the task instead of the process, as the compiler may be serving other tasks.
+		// every output is still given its turn so they all get closed, and the first error is kept.
 		for (HccWorkerJobType job_type = 0; job_type < HCC_WORKER_JOB_TYPE_COUNT; job_type += 1) {
 			if (t->output_job_locations[job_type].arg) {
-				hcc_task_output_job(t, job_type);
+				HccResult result = hcc_task_output_job(t, job_type);
+				if (result.code < 0 && t->result.code >= 0) {
+					t->result = result;
+				}
 			}
 		}
+		if (t->result.code >= 0 && t->output_entry_point_binaries_dir && t->final_worker_job_type == HCC_WORKER_JOB_TYPE_BACKENDLINK) {
+			t->result = hcc_task_output_entry_point_binaries(t);
+		}
 	}
 
 	if (is_compiler_finished) {
@@ -504,10 +705,14 @@ HccResult hcc_task_init(HccTaskSetup* setup, HccTask** t_out) {
 	t->cu_setup = setup->cu;
 	t->options = setup->options;
 	t->final_worker_job_type = HCC_WORKER_JOB_TYPE_BACKENDLINK;
+	hcc_spin_mutex_init(&t->worker_job_type_times_mutex);
+	hcc_spin_mutex_init(&t->aml_opt_pass_stats_mutex);
 	t->include_path_strings = hcc_stack_init(HccString, 0, setup->include_paths_cap, setup->include_paths_cap);
 	t->message_sys.elmts = hcc_stack_init(HccMessage, 0, setup->messages_cap, setup->messages_cap);
 	t->message_sys.locations = hcc_stack_init(HccLocation, 0, setup->messages_cap * 2, setup->messages_cap * 2);
 	t->message_sys.strings = hcc_stack_init(char, 0, setup->message_strings_cap, setup->message_strings_cap);
+	t->ast_binary_grow_size = setup->ast_binary_grow_size;
+	t->ast_binary_reserve_size = setup->ast_binary_reserve_size;
 
 	*t_out = t;
 	hcc_clear_bail_jmp_loc();
@@ -515,12 +720,48 @@ HccResult hcc_task_init(HccTaskSetup* setup, HccTask** t_out) {
 }
 
 void hcc_task_deinit(HccTask* t) {
+	if (_hcc_tls.mem_tracker_task == t) {
+		_hcc_tls.mem_tracker_task = NULL;
+	}
+
+	//
+	// close the outputs that were not written to because the task failed or stopped before their stage
+	for (HccWorkerJobType job_type = 0; job_type < HCC_WORKER_JOB_TYPE_COUNT; job_type += 1) {
+		HccTaskOutputLocation* ol = &t->output_job_locations[job_type];
+		if (ol->arg && ol->encoding != HCC_ENCODING_RUNTIME_BINARY) {
+			hcc_iio_close(ol->arg);
+		}
+	}
+	if (t->output_iio_metadata_c) {
+		hcc_iio_close(t->output_iio_metadata_c);
+	}
+	if (t->output_iio_metadata_json) {
+		hcc_iio_close(t->output_iio_metadata_json);
+	}
+
+	for (HccTaskInputLocation* il = t->input_locations; il; il = il->next) {
+		hcc_options_deinit(il->options);
+	}
 	hcc_stack_deinit(t->include_path_strings);
 	hcc_stack_deinit(t->message_sys.elmts);
 	hcc_stack_deinit(t->message_sys.locations);
 	hcc_stack_deinit(t->message_sys.strings);
+	if (t->input_ast_binary) {
+		hcc_stack_deinit(t->input_ast_binary);
+	}
+	if (t->output_ast_binary) {
+		hcc_stack_deinit(t->output_ast_binary);
+	}
+	if (t->input_aml_binary) {
+		hcc_stack_deinit(t->input_aml_binary);
+	}
+	if (t->output_aml_binary) {
+		hcc_stack_deinit(t->output_aml_binary);
+	}
 
-	hcc_cu_deinit(t->cu);
+	if (t->cu) {
+		hcc_cu_deinit(t->cu);
+	}
 }
 
 void hcc_task_set_final_worker_job_type(HccTask* t, HccWorkerJobType final_worker_job_type) {
@@ -552,6 +793,52 @@ HccResult hcc_task_add_input_code_file(HccTask* t, const char* file_path, HccOpt
 	return HCC_RESULT_SUCCESS;
 }
 
+HccResult hcc_task_add_input_ast_binary(HccTask* t, HccIIO* iio) {
+	HCC_SET_BAIL_JMP_LOC_GLOBAL();
+
+	HCC_ASSERT(t->input_ast_binary == NULL, "task AST binary input has already been set");
+	t->input_ast_binary = hcc_stack_init(uint8_t, HCC_ALLOC_TAG_AST_BINARY, t->ast_binary_grow_size, t->ast_binary_reserve_size);
+	if (!hcc_task_read_binary(t, iio, t->input_ast_binary)) {
+		//
+		// drop what has been read so the task runs the front end and writes out a fresh binary instead
+		hcc_stack_deinit(t->input_ast_binary);
+		t->input_ast_binary = NULL;
+		hcc_iio_close(iio);
+		hcc_bail(HCC_ERROR_FILE_READ, 0);
+	}
+
+	if (!hcc_ast_binary_is_intact(t->input_ast_binary, hcc_stack_count(t->input_ast_binary))) {
+		hcc_stack_deinit(t->input_ast_binary);
+		t->input_ast_binary = NULL;
+		hcc_bail(HCC_ERROR_INVALID_BINARY, 0);
+	}
+
+	hcc_clear_bail_jmp_loc();
+	return HCC_RESULT_SUCCESS;
+}
+
+HccResult hcc_task_add_input_aml_binary(HccTask* t, HccIIO* iio) {
+	HCC_SET_BAIL_JMP_LOC_GLOBAL();
+
+	HCC_ASSERT(t->input_aml_binary == NULL, "task AML binary input has already been set");
+	t->input_aml_binary = hcc_stack_init(uint8_t, HCC_ALLOC_TAG_AML_BINARY, t->ast_binary_grow_size, t->ast_binary_reserve_size);
+	if (!hcc_task_read_binary(t, iio, t->input_aml_binary)) {
+		hcc_stack_deinit(t->input_aml_binary);
+		t->input_aml_binary = NULL;
+		hcc_iio_close(iio);
+		hcc_bail(HCC_ERROR_FILE_READ, 0);
+	}
+
+	if (!hcc_ast_binary_is_intact(t->input_aml_binary, hcc_stack_count(t->input_aml_binary))) {
+		hcc_stack_deinit(t->input_aml_binary);
+		t->input_aml_binary = NULL;
+		hcc_bail(HCC_ERROR_INVALID_BINARY, 0);
+	}
+
+	hcc_clear_bail_jmp_loc();
+	return HCC_RESULT_SUCCESS;
+}
+
 HccResult hcc_task_add_output_ast_text(HccTask* t, HccIIO* iio) {
 	return hcc_task_add_output(t, HCC_WORKER_JOB_TYPE_ASTLINK, HCC_ENCODING_TEXT, iio);
 }
@@ -580,6 +867,15 @@ HccResult hcc_task_add_output_binary(HccTask* t, HccIIO* iio) {
 	return hcc_task_add_output(t, HCC_WORKER_JOB_TYPE_BACKENDLINK, HCC_ENCODING_BINARY, iio);
 }
 
+HccResult hcc_task_add_output_entry_point_binaries(HccTask* t, const char* dir_path) {
+	if (!hcc_make_directory(dir_path) && !hcc_path_is_directory(dir_path)) {
+		return HccResult(HCC_ERROR_NOT_A_DIR, 0, NULL);
+	}
+
+	t->output_entry_point_binaries_dir = dir_path;
+	return HCC_RESULT_SUCCESS;
+}
+
 HccResult hcc_task_add_output_metadata_c(HccTask* t, HccIIO* iio) {
 	t->output_iio_metadata_c = iio;
 	return HCC_RESULT_SUCCESS;
@@ -594,6 +890,19 @@ bool hcc_task_has_started(HccTask* t) {
 	return t->c;
 }
 
+bool hcc_task_has_loaded_ast_binary(HccTask* t) {
+	return t->flags & HCC_TASK_FLAGS_HAS_LOADED_AST_BINARY;
+}
+
+bool hcc_task_has_loaded_aml_binary(HccTask* t) {
+	return t->flags & HCC_TASK_FLAGS_HAS_LOADED_AML_BINARY;
+}
+
+void hcc_task_mem_total_sizes(HccTask* t, uint64_t* reserved_total_size_out, uint64_t* committed_total_size_out) {
+	*reserved_total_size_out = atomic_load(&t->mem_reserved_total_size);
+	*committed_total_size_out = atomic_load(&t->mem_committed_total_size);
+}
+
 bool hcc_task_is_complete(HccTask* t) {
 	return hcc_mutex_is_locked(&t->is_running_mutex);
 }
@@ -629,6 +938,10 @@ HccDuration hcc_task_worker_job_type_duration(HccTask* t, HccWorkerJobType type)
 	return t->worker_job_type_durations[type];
 }
 
+HccAMLOptPassStats hcc_task_aml_opt_pass_stats(HccTask* t, HccAMLOptPass pass) {
+	return t->aml_opt_pass_stats[pass];
+}
+
 // ===========================================
 //
 //
@@ -637,10 +950,81 @@ HccDuration hcc_task_worker_job_type_duration(HccTask* t, HccWorkerJobType type)
 //
 // ===========================================
 
+void hcc_worker_job_deque_init(HccWorkerJobDeque* deque, uint32_t cap) {
+	HCC_DEBUG_ASSERT_POWER_OF_TWO(cap);
+	uintptr_t size = HCC_INT_ROUND_UP_ALIGN((uintptr_t)cap * sizeof(HccWorkerJob), _hcc_gs.virt_mem_reserve_align);
+	hcc_virt_mem_reserve_commit(HCC_ALLOC_TAG_WORKER_JOB_QUEUE, NULL, size, HCC_VIRT_MEM_PROTECTION_READ_WRITE, (void**)&deque->data);
+	deque->cap = cap;
+	atomic_store(&deque->top_idx, 0);
+	atomic_store(&deque->bottom_idx, 0);
+}
+
+void hcc_worker_job_deque_deinit(HccWorkerJobDeque* deque) {
+	uintptr_t size = HCC_INT_ROUND_UP_ALIGN((uintptr_t)deque->cap * sizeof(HccWorkerJob), _hcc_gs.virt_mem_reserve_align);
+	hcc_virt_mem_release(HCC_ALLOC_TAG_WORKER_JOB_QUEUE, deque->data, size);
+}
+
+bool hcc_worker_job_deque_push(HccWorkerJobDeque* deque, HccWorkerJob* job) {
+	uint32_t bottom_idx = atomic_load(&deque->bottom_idx);
+	uint32_t top_idx = atomic_load(&deque->top_idx);
+	if (bottom_idx - top_idx >= deque->cap) {
+		return false;
+	}
+
+	deque->data[bottom_idx & (deque->cap - 1)] = *job;
+	atomic_store(&deque->bottom_idx, bottom_idx + 1);
+	return true;
+}
+
+bool hcc_worker_job_deque_pop(HccWorkerJobDeque* deque, HccWorkerJob* job_out) {
+	//
+	// claim the bottom slot first so any thief that comes after will see it as taken
+	uint32_t bottom_idx = atomic_load(&deque->bottom_idx) - 1;
+	atomic_store(&deque->bottom_idx, bottom_idx);
+	uint32_t top_idx = atomic_load(&deque->top_idx);
+
+	if ((int32_t)(bottom_idx - top_idx) < 0) {
+		// the deque was empty
+		atomic_store(&deque->bottom_idx, bottom_idx + 1);
+		return false;
+	}
+
+	*job_out = deque->data[bottom_idx & (deque->cap - 1)];
+	if (bottom_idx != top_idx) {
+		// there is more than one job in the deque so no thief can be racing us for this one
+		return true;
+	}
+
+	//
+	// this is the last job so race any thieves for it by claiming the top
+	bool is_taken = atomic_compare_exchange_strong(&deque->top_idx, &top_idx, top_idx + 1);
+	atomic_store(&deque->bottom_idx, bottom_idx + 1);
+	return is_taken;
+}
+
+bool hcc_worker_job_deque_steal(HccWorkerJobDeque* deque, HccWorkerJob* job_out) {
+	uint32_t top_idx = atomic_load(&deque->top_idx);
+	uint32_t bottom_idx = atomic_load(&deque->bottom_idx);
+	if ((int32_t)(bottom_idx - top_idx) <= 0) {
+		return false;
+	}
+
+	//
+	// pull the data out before we try to claim the slot.
+	// if we lose the race the copy is just thrown away.
+	*job_out = deque->data[top_idx & (deque->cap - 1)];
+	return atomic_compare_exchange_strong(&deque->top_idx, &top_idx, top_idx + 1);
+}
+
 void hcc_worker_init(HccWorker* w, HccCompiler* c, void* call_stack, uintptr_t call_stack_size, HccCompilerSetup* setup) {
-	HCC_UNUSED(setup);
 	w->c = c;
 
+	hcc_worker_job_deque_init(&w->job_deque, setup->worker_jobs_queue_cap);
+	w->string_buffer = hcc_stack_init(char, HCC_ALLOC_TAG_WORKER_STRING_BUFFER, setup->worker_string_buffer_grow_size, setup->worker_string_buffer_reserve_size);
+	hcc_arena_alctor_init(&w->arena_alctor, HCC_ALLOC_TAG_WORKER_ARENA, setup->worker_arena_size);
+
+	//
+	// start the thread last so the worker is fully setup before it starts looking for jobs
 	HccThreadSetup thread_setup = {
 		.thread_main_fn = hcc_worker_main,
 		.arg = w,
@@ -648,18 +1032,26 @@ void hcc_worker_init(HccWorker* w, HccCompiler* c, void* call_stack, uintptr_t c
 		.call_stack_size = call_stack_size,
 	};
 	hcc_thread_start(&w->thread, &thread_setup);
-
-	w->string_buffer = hcc_stack_init(char, HCC_ALLOC_TAG_WORKER_STRING_BUFFER, setup->worker_string_buffer_grow_size, setup->worker_string_buffer_reserve_size);
-	hcc_arena_alctor_init(&w->arena_alctor, HCC_ALLOC_TAG_WORKER_ARENA, setup->worker_arena_size);
 }
 
 void hcc_worker_deinit(HccWorker* w) {
+	hcc_worker_job_deque_deinit(&w->job_deque);
 	hcc_stack_deinit(w->string_buffer);
 	hcc_arena_alctor_deinit(&w->arena_alctor);
 }
 
 HccLocation* hcc_worker_alloc_location(HccWorker* w) {
-	return HCC_ARENA_ALCTOR_ALLOC_ELMT(HccLocation, &w->arena_alctor);
+	//
+	// take the locations a chunk at a time so we are not locking the location table for every token
+	if (w->locations_count == 0) {
+		w->locations = hcc_stack_push_many_thread_safe(w->cu->location_table.locations, HCC_WORKER_LOCATIONS_CHUNK_COUNT);
+		w->locations_count = HCC_WORKER_LOCATIONS_CHUNK_COUNT;
+	}
+
+	HccLocation* location = w->locations;
+	w->locations += 1;
+	w->locations_count -= 1;
+	return location;
 }
 
 HccTask* hcc_worker_task(HccWorker* w) {
@@ -689,14 +1081,107 @@ void hcc_worker_end_job(HccWorker* w) {
 		return;
 	}
 
-	if (atomic_fetch_sub(&t->queued_jobs_count, 1) == 1) {
+	{
 		//
-		// set the worker_job_type duration in the task and add it to the compiler's overall copy
-		HccTime end_time = hcc_time_now(HCC_TIME_MODE_MONOTONIC);
-		t->worker_job_type_durations[t->worker_job_type] = hcc_time_diff(end_time, t->worker_job_type_start_times[t->worker_job_type]);
-		c->worker_job_type_durations[t->worker_job_type] = hcc_duration_add(c->worker_job_type_durations[t->worker_job_type], t->worker_job_type_durations[t->worker_job_type]);
+		// stages overlap now so the duration of a worker job type is
+		// from when the first job of that type started to when the last one ended.
+		HccDuration job_start = hcc_time_diff(w->job_start_time, t->start_time);
+		HccDuration job_end = hcc_time_elapsed(t->start_time, HCC_TIME_MODE_MONOTONIC);
+		hcc_spin_mutex_lock(&t->worker_job_type_times_mutex);
+		if (!(t->worker_job_types_ran_bitset & (1 << w->job.type))) {
+			t->worker_job_types_ran_bitset |= (1 << w->job.type);
+			t->worker_job_type_first_starts[w->job.type] = job_start;
+			t->worker_job_type_last_ends[w->job.type] = job_end;
+		} else {
+			if (hcc_duration_lt(job_start, t->worker_job_type_first_starts[w->job.type])) {
+				t->worker_job_type_first_starts[w->job.type] = job_start;
+			}
+			if (hcc_duration_gt(job_end, t->worker_job_type_last_ends[w->job.type])) {
+				t->worker_job_type_last_ends[w->job.type] = job_end;
+			}
+		}
+		hcc_spin_mutex_unlock(&t->worker_job_type_times_mutex);
+	}
+
+	//
+	// give out the next job for this file or function straight away instead of waiting for
+	// every other job of this type to finish. this is done before our job is released
+	// so the task cannot reach its barrier while the next job is being given out.
+	if (!(t->message_sys.used_type_flags & HCC_MESSAGE_TYPE_ERROR)) {
+		switch (w->job.type) {
+			case HCC_WORKER_JOB_TYPE_ATAGEN:
+				hcc_compiler_give_worker_job(c, t, HCC_WORKER_JOB_TYPE_ASTGEN, w->atagen.ast_file);
+				break;
+			case HCC_WORKER_JOB_TYPE_ASTGEN: {
+				HccCU* cu = t->cu;
+				bool is_last_file = atomic_fetch_sub(&cu->ast.astgen_files_left_count, 1) == 1;
+				hcc_compiler_give_worker_job(c, t, HCC_WORKER_JOB_TYPE_ASTLINK, w->job.arg);
+				if (is_last_file) {
+					//
+					// every definition has now been published to the compilation unit,
+					// so link the files that were waiting on them again.
+					hcc_spin_mutex_lock(&cu->ast.link_deferred_files_mutex);
+					for (uint32_t idx = 0; idx < hcc_stack_count(cu->ast.link_deferred_files); idx += 1) {
+						hcc_compiler_give_worker_job(c, t, HCC_WORKER_JOB_TYPE_ASTLINK, cu->ast.link_deferred_files[idx]);
+					}
+					hcc_stack_clear(cu->ast.link_deferred_files);
+					hcc_spin_mutex_unlock(&cu->ast.link_deferred_files_mutex);
+				}
+				break;
+			};
+			case HCC_WORKER_JOB_TYPE_AMLGEN:
+				hcc_compiler_give_worker_job(c, t, HCC_WORKER_JOB_TYPE_AMLOPT, w->job.arg);
+				break;
+			case HCC_WORKER_JOB_TYPE_AMLOPT:
+				if (t->cu->aml.opt_phase == HCC_AML_OPT_PHASE_COUNT - 1) {
+					hcc_compiler_give_worker_job(c, t, HCC_WORKER_JOB_TYPE_BACKENDGEN, w->job.arg);
+				}
+				break;
+			case HCC_WORKER_JOB_TYPE_BACKENDLINK: {
+				HccSPIRVLinkJob* link_job = w->job.arg;
+				if (link_job->type == HCC_SPIRVLINK_JOB_TYPE_MODULE) {
+					for (uint32_t idx = link_job->start_idx; idx < link_job->end_idx; idx += 1) {
+						hcc_compiler_give_worker_job(c, t, HCC_WORKER_JOB_TYPE_BACKENDLINK, hcc_stack_get(t->cu->spirv.link_jobs, idx));
+					}
+				}
+				break;
+			};
+		}
+	}
+
+	//
+	// the task only waits for every job to finish at these barriers:
+	// - ASTLINK:     every file has been linked, so the number of functions is known for AMLGEN
+	// - AMLOPT:      between optimization phases as they need the call graph of the whole compilation unit
+	// - BACKENDGEN:  every function has been generated, so they can be linked in to a single binary or a binary per entry point
+	// - BACKENDLINK: the task is finished
+	bool is_last_job = atomic_fetch_sub(&t->queued_jobs_count, 1) == 1;
+	while (is_last_job) {
+		if (
+			t->worker_job_type == HCC_WORKER_JOB_TYPE_ASTLINK &&
+			!(t->flags & HCC_TASK_FLAGS_HAS_LOADED_AST_BINARY) &&
+			t->output_job_locations[HCC_WORKER_JOB_TYPE_ASTLINK].encoding == HCC_ENCODING_BINARY &&
+			t->output_job_locations[HCC_WORKER_JOB_TYPE_ASTLINK].arg &&
+			!(t->message_sys.used_type_flags & HCC_MESSAGE_TYPE_ERROR)
+		) {
+			hcc_task_capture_ast_binary(t);
+		}
 
-		if (t->worker_job_type == t->final_worker_job_type || (t->message_sys.used_type_flags & HCC_MESSAGE_TYPE_ERROR)) {
+		if (t->worker_job_type == HCC_WORKER_JOB_TYPE_BACKENDGEN) {
+			//
+			// the last optimization phase has finished, so nothing will inline from the old copies of the functions anymore
+			hcc_aml_inline_functions_return_refs(t->cu);
+		}
+
+		HccWorkerJobType next_job_type;
+		switch (t->worker_job_type) {
+			case HCC_WORKER_JOB_TYPE_ASTLINK: next_job_type = HCC_WORKER_JOB_TYPE_AMLGEN; break;
+			case HCC_WORKER_JOB_TYPE_AMLOPT: next_job_type = HCC_WORKER_JOB_TYPE_AMLOPT; break;
+			case HCC_WORKER_JOB_TYPE_BACKENDGEN: next_job_type = HCC_WORKER_JOB_TYPE_BACKENDLINK; break;
+			default: next_job_type = HCC_WORKER_JOB_TYPE_COUNT; break;
+		}
+
+		if (t->final_worker_job_type < next_job_type || (t->message_sys.used_type_flags & HCC_MESSAGE_TYPE_ERROR)) {
 			//
 			// we have finished all jobs and have reached the worker job type where we end.
 			// t->final_worker_job_type also stops any jobs being added that
@@ -705,88 +1190,97 @@ void hcc_worker_end_job(HccWorker* w) {
 			if (thread_that_set_error) {
 				t->result.code = HCC_ERROR_MESSAGES;
 			}
+
+			//
+			// set the worker_job_type durations in the task and add them to the compiler's overall copy
+			for (HccWorkerJobType job_type = 0; job_type < HCC_WORKER_JOB_TYPE_COUNT; job_type += 1) {
+				if (t->worker_job_types_ran_bitset & (1 << job_type)) {
+					t->worker_job_type_durations[job_type] = hcc_duration_sub(t->worker_job_type_last_ends[job_type], t->worker_job_type_first_starts[job_type]);
+					c->worker_job_type_durations[job_type] = hcc_duration_add(c->worker_job_type_durations[job_type], t->worker_job_type_durations[job_type]);
+				}
+			}
+			for (HccAMLOptPass pass = 0; pass < HCC_AML_OPT_PASS_COUNT; pass += 1) {
+				hcc_amlopt_pass_stats_add(&c->aml_opt_pass_stats[pass], &t->aml_opt_pass_stats[pass]);
+			}
+
 			hcc_task_finish(w->job.task, thread_that_set_error);
 			return;
 		}
 
 		//
-		// setup the next worker job type
-		HccWorkerJobType next_job_type = t->worker_job_type + 1;
+		// hold the next barrier open while we give out its jobs. otherwise a worker could
+		// finish the first job before the next one has been counted and reach the barrier early.
+		atomic_fetch_add(&t->queued_jobs_count, 1);
+
 		switch (t->worker_job_type) {
-			case HCC_WORKER_JOB_TYPE_ATAGEN: {
-				HccStack(HccASTFile*) ast_files = t->cu->ast.files;
-				uint32_t files_count = hcc_stack_count(ast_files);
-				for (uint32_t file_idx = 0; file_idx < files_count; file_idx += 1) {
-					hcc_compiler_give_worker_job(c, w->job.task, HCC_WORKER_JOB_TYPE_ASTGEN, ast_files[file_idx]);
-				}
-				break;
-			};
-			case HCC_WORKER_JOB_TYPE_ASTGEN: {
-				HccStack(HccASTFile*) ast_files = t->cu->ast.files;
-				uint32_t files_count = hcc_stack_count(ast_files);
-				for (uint32_t file_idx = 0; file_idx < files_count; file_idx += 1) {
-					hcc_compiler_give_worker_job(c, w->job.task, HCC_WORKER_JOB_TYPE_ASTLINK, ast_files[file_idx]);
-				}
-				break;
-			};
 			case HCC_WORKER_JOB_TYPE_ASTLINK: {
 				uint32_t functions_count = hcc_stack_count(t->cu->ast.functions);
 				hcc_stack_resize(t->cu->aml.functions, functions_count);
+				hcc_stack_resize(t->cu->aml.function_call_node_lists, functions_count);
 
+				//
+				// each AMLGEN job gives out the first AMLOPT phase for its function when it is done
 				for (uint32_t function_idx = HCC_FUNCTION_IDX_USER_START; function_idx < functions_count; function_idx += 1) {
 					HccDecl function_decl = HCC_DECL(FUNCTION, function_idx);
 					void* arg = (void*)(uintptr_t)function_decl;
 					hcc_compiler_give_worker_job(c, w->job.task, HCC_WORKER_JOB_TYPE_AMLGEN, arg);
 				}
+				t->worker_job_type = HCC_WORKER_JOB_TYPE_AMLOPT;
 				break;
 			};
-			case HCC_WORKER_JOB_TYPE_AMLGEN: {
-				uint32_t functions_count = hcc_stack_count(t->cu->aml.functions);
-				hcc_stack_resize(t->cu->aml.function_call_node_lists, functions_count);
+			case HCC_WORKER_JOB_TYPE_AMLOPT: {
+				t->cu->aml.opt_phase += 1;
+				bool is_last_phase = t->cu->aml.opt_phase == HCC_AML_OPT_PHASE_COUNT - 1;
+				if (is_last_phase) {
+					hcc_spirv_prepare(t->cu);
+					hcc_aml_inline_functions_take_refs(t->cu);
+				}
 
+				//
+				// switch arrays before giving out the jobs, as they can start pushing to the next array straight away.
+				// the last phase keeps the ordered function list around as BACKENDLINK outputs the functions in that order.
 				HccStack(HccDecl) optimize_functions = hcc_aml_optimize_functions(w->cu);
+				HCC_DEBUG_ASSERT(hcc_stack_count(optimize_functions), "we still have optimization phases to go but no functions where listed to be optimized");
+				if (is_last_phase) {
+					t->worker_job_type = HCC_WORKER_JOB_TYPE_BACKENDGEN;
+				} else {
+					hcc_aml_next_optimize_functions_array(w->cu);
+				}
+
+				//
+				// each job of the last phase gives out the BACKENDGEN job for its function when it is done
 				for (uint32_t idx = 0; idx < hcc_stack_count(optimize_functions); idx += 1) {
 					HccDecl function_decl = optimize_functions[idx];
 					void* arg = (void*)(uintptr_t)function_decl;
 					hcc_compiler_give_worker_job(c, w->job.task, HCC_WORKER_JOB_TYPE_AMLOPT, arg);
 				}
-				hcc_aml_next_optimize_functions_array(w->cu);
 				break;
 			};
-			case HCC_WORKER_JOB_TYPE_AMLOPT: {
-				uint32_t functions_count = hcc_stack_count(t->cu->aml.functions);
-				t->cu->aml.opt_phase += 1;
-
-				HccStack(HccDecl) optimize_functions = hcc_aml_optimize_functions(w->cu);
-				if (t->cu->aml.opt_phase < HCC_AML_OPT_PHASE_COUNT) {
-					HCC_DEBUG_ASSERT(hcc_stack_count(optimize_functions), "we still have optimization phases to go but no functions where listed to be optimized");
-					for (uint32_t idx = 0; idx < hcc_stack_count(optimize_functions); idx += 1) {
-						HccDecl function_decl = optimize_functions[idx];
-						void* arg = (void*)(uintptr_t)function_decl;
-						hcc_compiler_give_worker_job(c, w->job.task, HCC_WORKER_JOB_TYPE_AMLOPT, arg);
-					}
-					next_job_type = HCC_WORKER_JOB_TYPE_AMLOPT;
-					hcc_aml_next_optimize_functions_array(w->cu);
-				} else {
-					hcc_stack_resize(t->cu->spirv.functions, functions_count);
-
-					HCC_DEBUG_ASSERT(hcc_stack_count(optimize_functions), "we have have no functions to output after AMLOPT has completed");
-					for (uint32_t idx = 0; idx < hcc_stack_count(optimize_functions); idx += 1) {
-						HccDecl function_decl = optimize_functions[idx];
-						void* arg = (void*)(uintptr_t)function_decl;
-						hcc_compiler_give_worker_job(c, w->job.task, HCC_WORKER_JOB_TYPE_BACKENDGEN, arg);
+			case HCC_WORKER_JOB_TYPE_BACKENDGEN: {
+				HccCU* cu = t->cu;
+				hcc_spirvlink_prepare(cu);
+
+				//
+				// each entry point module is linked by its own job so they are linked in parallel.
+				// the MODULE job gives out the sections of the module with every entry point when it is done.
+				if (!t->output_entry_point_binaries_dir || t->output_job_locations[HCC_WORKER_JOB_TYPE_BACKENDLINK].arg) {
+					HccSPIRVLinkJob* link_job = hcc_spirvlink_add_job(cu, HCC_SPIRVLINK_JOB_TYPE_MODULE, 0);
+					hcc_compiler_give_worker_job(c, w->job.task, HCC_WORKER_JOB_TYPE_BACKENDLINK, link_job);
+				}
+				if (t->output_entry_point_binaries_dir) {
+					for (uint32_t entry_point_idx = 0; entry_point_idx < hcc_stack_count(cu->spirv.entry_points); entry_point_idx += 1) {
+						HccSPIRVLinkJob* link_job = hcc_spirvlink_add_job(cu, HCC_SPIRVLINK_JOB_TYPE_ENTRY_POINT, entry_point_idx);
+						hcc_compiler_give_worker_job(c, w->job.task, HCC_WORKER_JOB_TYPE_BACKENDLINK, link_job);
 					}
 				}
+				t->worker_job_type = HCC_WORKER_JOB_TYPE_BACKENDLINK;
 				break;
 			};
-			case HCC_WORKER_JOB_TYPE_BACKENDGEN:
-				hcc_compiler_give_worker_job(c, w->job.task, HCC_WORKER_JOB_TYPE_BACKENDLINK, NULL);
-				break;
-			case HCC_WORKER_JOB_TYPE_BACKENDLINK:
-				break;
 		}
-		t->worker_job_type = next_job_type;
-		t->worker_job_type_start_times[t->worker_job_type] = end_time;
+
+		//
+		// release our hold, if every job has already finished then we move onto the next barrier ourselves
+		is_last_job = atomic_fetch_sub(&t->queued_jobs_count, 1) == 1;
 	}
 }
 
@@ -796,7 +1290,7 @@ HCC_STDCALL void hcc_worker_main(void* arg) {
 	HCC_SET_BAIL_JMP_LOC_WORKER();
 
 	while (1) {
-		if (!hcc_compiler_take_or_wait_then_take_worker_job(c, &w->job)) {
+		if (!hcc_compiler_take_or_wait_then_take_worker_job(c, w, &w->job)) {
 			//
 			// kill the thread when the compiler is stopping
 			return;
@@ -808,6 +1302,8 @@ HCC_STDCALL void hcc_worker_main(void* arg) {
 
 		hcc_worker_start_job(w);
 		w->cu = w->job.task->cu;
+		_hcc_tls.mem_tracker_task = w->job.task;
+		w->locations_count = 0; // the chunk could belong to a different compilation unit
 
 		switch (w->job.type) {
 			case HCC_WORKER_JOB_TYPE_ATAGEN:
@@ -831,8 +1327,13 @@ HCC_STDCALL void hcc_worker_main(void* arg) {
 					hcc_astlink_init(w, &c->setup.astlink);
 					w->initialized_generators_bitset |= (1 << w->job.type);
 				}
-				hcc_astlink_reset(w);
-				hcc_astlink_link_file(w);
+				//
+				// there is no file to link when the AST has been loaded from a binary,
+				// the single job just gets the task to the ASTLINK barrier.
+				if (w->job.arg) {
+					hcc_astlink_reset(w);
+					hcc_astlink_link_file(w);
+				}
 				break;
 			case HCC_WORKER_JOB_TYPE_AMLGEN:
 				if (!(w->initialized_generators_bitset & (1 << w->job.type))) {
@@ -868,6 +1369,7 @@ HCC_STDCALL void hcc_worker_main(void* arg) {
 				break;
 		}
 
+		_hcc_tls.mem_tracker_task = NULL;
 		hcc_worker_end_job(w);
 	}
 }
@@ -897,6 +1399,8 @@ HccCompilerSetup hcc_compiler_setup_default = {
 		.paused_file_stack_reserve_cap = 1024,
 		.open_bracket_stack_grow_count = 256,
 		.open_bracket_stack_reserve_cap = 1024,
+		.pch_files_grow_count = 256,
+		.pch_files_reserve_cap = 16384,
 	},
 	.astgen = {
 		.variable_stack_grow_count = 1024,
@@ -913,6 +1417,24 @@ HccCompilerSetup hcc_compiler_setup_default = {
 	.amlgen = {
 		.placeholder = 1,
 	},
+	.amlopt = {
+		.value_replacements_grow_count = 4096,
+		.value_replacements_reserve_cap = 262144,
+		.basic_blocks_grow_count = 1024,
+		.basic_blocks_reserve_cap = 65536,
+		.values_grow_count = 4096,
+		.values_reserve_cap = 262144,
+		.basic_block_edges_grow_count = 4096,
+		.basic_block_edges_reserve_cap = 262144,
+		.allocs_grow_count = 1024,
+		.allocs_reserve_cap = 65536,
+		.alloc_values_grow_count = 65536,
+		.alloc_values_reserve_cap = 4194304,
+		.inline_sites_grow_count = 256,
+		.inline_sites_reserve_cap = 16384,
+		.value_numbers_grow_count = 65536,
+		.value_numbers_reserve_cap = 4194304,
+	},
 	.backendlink = {
 		.binary_grow_size = 8388608,
 		.binary_reserve_size = 67108864,
@@ -932,56 +1454,123 @@ void hcc_compiler_give_worker_job(HccCompiler* c, HccTask* t, HccWorkerJobType j
 	}
 
 	//
-	// spin until we are the thread to claim a slot to write the job into
-	uint32_t tail_idx = atomic_load(&c->worker_job_queue.tail_idx);
-	while (1) {
-		uint32_t head_idx = atomic_load(&c->worker_job_queue.head_idx);
-		uint32_t count = tail_idx >= head_idx
-			? tail_idx - head_idx
-			: tail_idx + (c->worker_job_queue.cap - head_idx);
+	// count the job before it can be taken so a worker cannot end it before it has been counted
+	atomic_fetch_add(&t->queued_jobs_count, 1);
+
+	HccWorkerJob job = {
+		.type = job_type,
+		.task = t,
+		.arg = arg,
+	};
+	hcc_compiler_push_worker_job(c, &job);
+}
 
-		if (count + 1 >= c->worker_job_queue.cap) {
+void hcc_compiler_push_worker_job(HccCompiler* c, HccWorkerJob* job) {
+	//
+	// if we are one of this compiler's workers then push onto our own deque so no other thread is touched.
+	// otherwise or when our deque is full, fallback to the shared injection queue.
+	HccWorker* w = _hcc_tls.w;
+	if (w == NULL || w->c != c || !hcc_worker_job_deque_push(&w->job_deque, job)) {
+		hcc_spin_mutex_lock(&c->injection_queue.mutex);
+
+		uint32_t head_idx = atomic_load(&c->injection_queue.head_idx);
+		uint32_t tail_idx = atomic_load(&c->injection_queue.tail_idx);
+		if (tail_idx - head_idx >= c->injection_queue.cap) {
+			hcc_spin_mutex_unlock(&c->injection_queue.mutex);
 			hcc_bail(HCC_ERROR_COLLECTION_FULL, HCC_ALLOC_TAG_WORKER_JOB_QUEUE);
 		}
 
-		uint32_t next_tail_idx = (tail_idx + 1) % c->worker_job_queue.cap;
-		if (atomic_compare_exchange_weak(&c->worker_job_queue.tail_idx, &tail_idx, next_tail_idx)) {
-			break;
-		}
-	}
+		c->injection_queue.data[tail_idx & (c->injection_queue.cap - 1)] = *job;
+		atomic_store(&c->injection_queue.tail_idx, tail_idx + 1);
 
-	HccWorkerJob* job = &c->worker_job_queue.data[tail_idx];
-	job->type = job_type;
-	job->task = t;
-	job->arg = arg;
+		hcc_spin_mutex_unlock(&c->injection_queue.mutex);
+	}
 
 	//
-	// tell the worker threads that there is a new job
-	atomic_fetch_add(&t->queued_jobs_count, 1);
-	hcc_semaphore_give(&c->worker_job_queue.semaphore, 1);
+	// only make the wake syscall when there is a worker asleep.
+	// workers register themselves as sleeping before they make their final check for a job
+	// so either we see them here or they will see the job we just pushed.
+	if (atomic_load(&c->sleeping_workers_count)) {
+		hcc_semaphore_give(&c->wake_semaphore, 1);
+	}
 }
 
-bool hcc_compiler_take_or_wait_then_take_worker_job(HccCompiler* c, HccWorkerJob* job_out) {
-	if (atomic_load(&c->flags) & HCC_COMPILER_FLAGS_IS_STOPPING) {
-		return false;
+bool hcc_compiler_find_worker_job(HccCompiler* c, HccWorker* w, HccWorkerJob* job_out) {
+	//
+	// newest job from our own deque first as its data is most likely still in our cache
+	if (hcc_worker_job_deque_pop(&w->job_deque, job_out)) {
+		return true;
+	}
+
+	//
+	// then the injection queue, checking it is not empty before we touch the lock
+	if (atomic_load(&c->injection_queue.head_idx) != atomic_load(&c->injection_queue.tail_idx)) {
+		bool found = false;
+		hcc_spin_mutex_lock(&c->injection_queue.mutex);
+		uint32_t head_idx = atomic_load(&c->injection_queue.head_idx);
+		if (head_idx != atomic_load(&c->injection_queue.tail_idx)) {
+			*job_out = c->injection_queue.data[head_idx & (c->injection_queue.cap - 1)];
+			atomic_store(&c->injection_queue.head_idx, head_idx + 1);
+			found = true;
+		}
+		hcc_spin_mutex_unlock(&c->injection_queue.mutex);
+		if (found) {
+			return true;
+		}
+	}
+
+	//
+	// finally try to steal the oldest job from another worker.
+	// start at our neighbour so all the thieves do not pile onto the first worker.
+	uint32_t worker_idx = w - c->workers;
+	for (uint32_t idx = 1; idx < c->workers_count; idx += 1) {
+		HccWorker* victim = &c->workers[(worker_idx + idx) % c->workers_count];
+		if (hcc_worker_job_deque_steal(&victim->job_deque, job_out)) {
+			return true;
+		}
 	}
 
-	hcc_semaphore_take_or_wait_then_take(&c->worker_job_queue.semaphore);
+	return false;
+}
 
+uint32_t hcc_compiler_worker_share_cap(uint32_t cap, uint32_t workers_count, uint32_t min_cap) {
 	//
-	// spin until we are the thread to claim this worker job
-	uint32_t head_idx = atomic_load(&c->worker_job_queue.head_idx);
+	// keep the share a power of two by rounding down, hash tables and deques rely on it
+	uint32_t share = cap / workers_count;
+	while (!HCC_IS_POWER_OF_TWO_OR_ZERO(share)) {
+		share &= share - 1;
+	}
+	return HCC_MIN(cap, HCC_MAX(share, min_cap));
+}
+
+bool hcc_compiler_take_or_wait_then_take_worker_job(HccCompiler* c, HccWorker* w, HccWorkerJob* job_out) {
 	while (1) {
-		// pull the data out before we store the updated head_idx back
-		*job_out = c->worker_job_queue.data[head_idx];
+		for (uint32_t spin_idx = 0; spin_idx < HCC_WORKER_IDLE_SPIN_COUNT; spin_idx += 1) {
+			if (atomic_load(&c->flags) & HCC_COMPILER_FLAGS_IS_STOPPING) {
+				return false;
+			}
 
-		uint32_t next_head_idx = (head_idx + 1) % c->worker_job_queue.cap;
-		if (atomic_compare_exchange_weak(&c->worker_job_queue.head_idx, &head_idx, next_head_idx)) {
-			break;
+			if (hcc_compiler_find_worker_job(c, w, job_out)) {
+				return true;
+			}
+
+			HCC_CPU_RELAX();
 		}
-	}
 
-	return true;
+		//
+		// register as sleeping before the final check so a job given after
+		// this point will wake us up. see hcc_compiler_give_worker_job
+		atomic_fetch_add(&c->sleeping_workers_count, 1);
+		if (hcc_compiler_find_worker_job(c, w, job_out)) {
+			atomic_fetch_sub(&c->sleeping_workers_count, 1);
+			return true;
+		}
+
+		if (!(atomic_load(&c->flags) & HCC_COMPILER_FLAGS_IS_STOPPING)) {
+			hcc_semaphore_take_or_wait_then_take(&c->wake_semaphore);
+		}
+		atomic_fetch_sub(&c->sleeping_workers_count, 1);
+	}
 }
 
 HccResult hcc_compiler_init(HccCompilerSetup* setup, HccCompiler** c_out) {
@@ -996,15 +1585,26 @@ HccResult hcc_compiler_init(HccCompilerSetup* setup, HccCompiler** c_out) {
 	if (workers_count == 0) {
 		workers_count = hcc_logical_cores_count();
 	}
+	workers_count = HCC_MIN(workers_count, HCC_WORKERS_COUNT_MAX);
+
+	HCC_ASSERT(HCC_IS_POWER_OF_TWO(setup->worker_jobs_queue_cap), "worker_jobs_queue_cap must be a power of two but got '%u'", setup->worker_jobs_queue_cap);
 
 	c->setup = *setup;
+	c->workers_count = workers_count;
+
+	//
+	// the job deques are split between the workers, so the committed memory does not multiply with the number of logical cores.
+	// a full deque falls back to the injection queue so it keeps the whole capacity.
+	// the other per-worker sizes have to hold a whole translation unit on any worker, so they are left alone.
+	c->setup.worker_jobs_queue_cap = hcc_compiler_worker_share_cap(setup->worker_jobs_queue_cap, workers_count, HCC_WORKER_JOB_DEQUE_MIN_CAP);
 
 	//
-	// allocate the job queue magic ring buffer
-	uint32_t worker_jobs_size = setup->worker_jobs_queue_cap * sizeof(HccWorkerJob);
-	worker_jobs_size = hcc_uint32_round_up_to_multiple(worker_jobs_size, _hcc_gs.virt_mem_page_size);
-	hcc_virt_mem_magic_ring_buffer_alloc(HCC_ALLOC_TAG_WORKER_JOB_QUEUE, NULL, worker_jobs_size, (void**)&c->worker_job_queue.data);
-	c->worker_job_queue.cap = setup->worker_jobs_queue_cap;
+	// allocate the injection queue, each worker allocates their own deque in hcc_worker_init
+	uintptr_t injection_queue_size = HCC_INT_ROUND_UP_ALIGN((uintptr_t)setup->worker_jobs_queue_cap * sizeof(HccWorkerJob), _hcc_gs.virt_mem_reserve_align);
+	hcc_virt_mem_reserve_commit(HCC_ALLOC_TAG_WORKER_JOB_QUEUE, NULL, injection_queue_size, HCC_VIRT_MEM_PROTECTION_READ_WRITE, (void**)&c->injection_queue.data);
+	c->injection_queue.cap = setup->worker_jobs_queue_cap;
+	hcc_spin_mutex_init(&c->injection_queue.mutex);
+	hcc_semaphore_init(&c->wake_semaphore, 0);
 
 	//
 	// reserve address space for all of the worker call stacks separated by a page
@@ -1021,18 +1621,19 @@ HccResult hcc_compiler_init(HccCompilerSetup* setup, HccCompiler** c_out) {
 	hcc_virt_mem_reserve(HCC_ALLOC_TAG_WORKER_CALL_STACKS, NULL, worker_call_stacks_size, (void**)&c->worker_call_stacks_addr);
 
 	void* call_stack = c->worker_call_stacks_addr;
-	c->workers = HCC_ARENA_ALCTOR_ALLOC_ARRAY_THREAD_SAFE(HccWorker, &_hcc_gs.arena_alctor, workers_count);
+	//
+	// the workers are allocated outside of the global arena as there can be a lot of them on machines with many logical cores
+	uintptr_t workers_size = HCC_INT_ROUND_UP_ALIGN((uintptr_t)workers_count * sizeof(HccWorker), hcc_virt_mem_reserve_align());
+	hcc_virt_mem_reserve_commit(HCC_ALLOC_TAG_WORKERS, NULL, workers_size, HCC_VIRT_MEM_PROTECTION_READ_WRITE, (void**)&c->workers);
 	for (uint32_t worker_idx = 0; worker_idx < workers_count; worker_idx += 1) {
 		call_stack = HCC_PTR_ADD(call_stack, page_size);
 		hcc_virt_mem_commit(HCC_ALLOC_TAG_WORKER_CALL_STACKS, call_stack, worker_call_stack_size, HCC_VIRT_MEM_PROTECTION_READ_WRITE);
-		hcc_worker_init(&c->workers[worker_idx], c, call_stack, worker_call_stack_size, setup);
+		hcc_worker_init(&c->workers[worker_idx], c, call_stack, worker_call_stack_size, &c->setup);
 		call_stack = HCC_PTR_ADD(call_stack, worker_call_stack_size);
 	}
 
 	hcc_mutex_init(&c->wait_for_all_mutex);
 
-	hcc_semaphore_init(&c->worker_job_queue.semaphore, 0);
-
 	*c_out = c;
 	hcc_clear_bail_jmp_loc();
 	return HCC_RESULT_SUCCESS;
@@ -1042,7 +1643,7 @@ HccResult hcc_compiler_deinit(HccCompiler* c) {
 	HCC_SET_BAIL_JMP_LOC_COMPILER();
 
 	atomic_fetch_or(&c->flags, HCC_COMPILER_FLAGS_IS_STOPPING);
-	hcc_semaphore_give(&c->worker_job_queue.semaphore, c->workers_count); // wake up all the workers to make stop their threads
+	hcc_semaphore_give(&c->wake_semaphore, c->workers_count); // wake up all the workers to make stop their threads
 	HccResult result = hcc_compiler_wait_for_all_tasks(c);
 	for (uint32_t idx = 0; idx < c->workers_count; idx += 1) {
 		hcc_worker_deinit(&c->workers[idx]);
@@ -1061,18 +1662,24 @@ HccResult hcc_compiler_dispatch_task(HccCompiler* c, HccTask* t) {
 	hcc_mutex_lock(&t->is_running_mutex);
 
 	t->result = HCC_RESULT_SUCCESS;
-	t->flags &= ~(HCC_TASK_FLAGS_IS_RESULT_SET);
-	t->worker_job_type = HCC_WORKER_JOB_TYPE_ATAGEN;
+	t->flags &= ~(HCC_TASK_FLAGS_IS_RESULT_SET | HCC_TASK_FLAGS_HAS_LOADED_AST_BINARY | HCC_TASK_FLAGS_HAS_LOADED_AML_BINARY);
+	t->worker_job_type = HCC_WORKER_JOB_TYPE_ASTLINK;
+	t->worker_job_types_ran_bitset = 0;
 	HCC_ZERO_ARRAY(t->worker_job_type_durations);
+	HCC_ZERO_ARRAY(t->aml_opt_pass_stats);
 	HCC_ZERO_ELMT(&t->duration);
 	t->start_time = hcc_time_now(HCC_TIME_MODE_MONOTONIC);
-	t->worker_job_type_start_times[HCC_WORKER_JOB_TYPE_ATAGEN] = t->start_time;
+	atomic_store(&t->mem_reserved_total_size, 0);
+	atomic_store(&t->mem_committed_total_size, 0);
 
 	if (t->cu) {
 		hcc_cu_deinit(t->cu);
 		t->cu = NULL;
 	}
 
+	//
+	// the memory for the compilation unit is made on this thread, the rest is made by the workers
+	_hcc_tls.mem_tracker_task = t;
 	t->cu = HCC_ARENA_ALCTOR_ALLOC_ELMT_THREAD_SAFE(HccCU, &_hcc_gs.arena_alctor);
 	hcc_cu_init(t->cu, &t->cu_setup, t->options);
 
@@ -1082,35 +1689,78 @@ HccResult hcc_compiler_dispatch_task(HccCompiler* c, HccTask* t) {
 		//
 		hcc_mutex_lock(&c->wait_for_all_mutex);
 		c->result_data.result = HCC_RESULT_SUCCESS;
-		c->flags &= ~(HCC_COMPILER_FLAGS_IS_RESULT_SET | HCC_COMPILER_FLAGS_IS_STOPPING);
+		c->flags &= ~HCC_COMPILER_FLAGS_IS_RESULT_SET;
 		if (_hcc_gs.flags & HCC_FLAGS_ENABLE_STACKTRACE) {
 			c->result_data.result.stacktrace = c->result_data.result_stacktrace;
 			c->result_data.result_stacktrace[0] = '\0';
 		}
 		HCC_ZERO_ARRAY(c->worker_job_type_durations);
+		HCC_ZERO_ARRAY(c->aml_opt_pass_stats);
 		HCC_ZERO_ELMT(&c->duration);
 		c->start_time = t->start_time;
 
 		//
-		// CONTRIBUTOR: we want to keep the code files in future and only
-		// throw them away if the user calls hcc_clear_code_files
-		// and we want to update them when a timestamp mismatches that we can an update from the OS
-		//
-		// - write a timestamp abstraction
-		// - write the code that refetches the file when the timestamp is out of date
-		//
-		HCC_CONTRIBUTOR_TASK(keep code files around between compiles);
-		hcc_clear_code_files();
+		// keep the code files from previous compiles around and only throw away the ones that have changed on disk
+		hcc_code_files_revalidate();
 	}
 
-	{
-		HccTaskInputLocation* il = t->input_locations;
-		while (il) {
-			hcc_compiler_give_worker_job(c, t, HCC_WORKER_JOB_TYPE_ATAGEN, il);
-			il = il->next;
+	if (
+		t->input_aml_binary &&
+		t->final_worker_job_type >= HCC_WORKER_JOB_TYPE_BACKENDGEN &&
+		hcc_ast_binary_read(t->cu, hcc_task_inputs_hash(t), t->input_aml_binary, hcc_stack_count(t->input_aml_binary), true)
+	) {
+		//
+		// none of the inputs used before the backend have changed since the binary was written,
+		// so give out the BACKENDGEN jobs like the last AMLOPT phase would have.
+		t->flags |= HCC_TASK_FLAGS_HAS_LOADED_AML_BINARY;
+		t->worker_job_type = HCC_WORKER_JOB_TYPE_BACKENDGEN;
+		hcc_spirv_prepare(t->cu);
+
+		HccStack(HccDecl) optimize_functions = hcc_aml_optimize_functions(t->cu);
+		atomic_fetch_add(&t->queued_jobs_count, hcc_stack_count(optimize_functions));
+		for (uint32_t idx = 0; idx < hcc_stack_count(optimize_functions); idx += 1) {
+			HccWorkerJob job = {
+				.type = HCC_WORKER_JOB_TYPE_BACKENDGEN,
+				.task = t,
+				.arg = (void*)(uintptr_t)optimize_functions[idx],
+			};
+			hcc_compiler_push_worker_job(c, &job);
+		}
+	} else if (t->input_ast_binary && hcc_ast_binary_read(t->cu, hcc_task_inputs_hash(t), t->input_ast_binary, hcc_stack_count(t->input_ast_binary), false)) {
+		//
+		// none of the inputs have changed since the binary was written, so go straight to the ASTLINK barrier
+		t->flags |= HCC_TASK_FLAGS_HAS_LOADED_AST_BINARY;
+		atomic_fetch_add(&t->queued_jobs_count, 1);
+		atomic_store(&t->cu->ast.astgen_files_left_count, 0);
+
+		HccWorkerJob job = {
+			.type = HCC_WORKER_JOB_TYPE_ASTLINK,
+			.task = t,
+			.arg = NULL,
+		};
+		hcc_compiler_push_worker_job(c, &job);
+	} else {
+		//
+		// count all of the jobs up front, otherwise a worker could finish the first job
+		// before the next one has been counted and think the ASTLINK barrier has been reached.
+		uint32_t jobs_count = 0;
+		for (HccTaskInputLocation* il = t->input_locations; il; il = il->next) {
+			jobs_count += 1;
+		}
+		atomic_fetch_add(&t->queued_jobs_count, jobs_count);
+		atomic_store(&t->cu->ast.astgen_files_left_count, jobs_count);
+
+		for (HccTaskInputLocation* il = t->input_locations; il; il = il->next) {
+			HccWorkerJob job = {
+				.type = HCC_WORKER_JOB_TYPE_ATAGEN,
+				.task = t,
+				.arg = il,
+			};
+			hcc_compiler_push_worker_job(c, &job);
 		}
 	}
 
+	_hcc_tls.mem_tracker_task = NULL;
 	hcc_clear_bail_jmp_loc();
 	return HCC_RESULT_SUCCESS;
 }
@@ -1142,6 +1792,19 @@ HccDuration hcc_compiler_worker_job_type_duration(HccCompiler* c, HccWorkerJobTy
 	return c->worker_job_type_durations[type];
 }
 
+HccAMLOptPassStats hcc_compiler_aml_opt_pass_stats(HccCompiler* c, HccAMLOptPass pass) {
+	return c->aml_opt_pass_stats[pass];
+}
+
+uint32_t hcc_compiler_workers_count(HccCompiler* c) {
+	return c->workers_count;
+}
+
+uint64_t hcc_compiler_worker_arena_high_water_size(HccCompiler* c, uint32_t worker_idx) {
+	HCC_ASSERT(worker_idx < c->workers_count, "worker index '%u' is out of bounds for '%u' workers", worker_idx, c->workers_count);
+	return hcc_arena_alctor_high_water_size(&c->workers[worker_idx].arena_alctor);
+}
+
 // ===========================================
 //
 //
@@ -1150,311 +1813,73 @@ HccDuration hcc_compiler_worker_job_type_duration(HccCompiler* c, HccWorkerJobTy
 //
 // ===========================================
 
-void hcc_string_table_intrinsic_add(uint32_t expected_string_id, const char* string) {
-	_hcc_gs.string_table.next_id = expected_string_id;
-
-	HccStringId id;
-	hcc_string_table_deduplicate(string, strlen(string), &id);
-	HCC_DEBUG_ASSERT(id.idx_plus_one == expected_string_id, "intrinsic string id for '%s' does not match! expected '%u' but got '%u'", string, expected_string_id, id.idx_plus_one);
+HccHash64 hcc_intrinsic_string_hash(const char* data, uintptr_t size) {
+	return hcc_hash_wy_64(data, size, HCC_HASH_WY_64_INIT);
 }
 
-void hcc_string_intrinsic_decl_add_function(char* buf, uint32_t buf_size, uint32_t insert_idx, const char* fmt, uint32_t expected_string_id, HccManyTypeClass support, int c, int r) {
-	// skip HCC_AML_INTRINSIC_DATA_TYPE_VOID
-	expected_string_id += 1;
-
-	if (support & HCC_MANY_TYPE_CLASS_BOOL) {
-		snprintf(buf + insert_idx, buf_size - insert_idx, fmt, hcc_aml_intrinsic_data_type_scalar_strings[HCC_AML_INTRINSIC_DATA_TYPE_BOOL], c, r);
-		hcc_string_table_intrinsic_add(expected_string_id, buf);
+uint32_t hcc_intrinsic_string_slot(HccHash64 hash, uint32_t displacement, uint32_t slots_count) {
+	//
+	// the bucket is picked with the low bits, so the slot is picked with the high bits
+	// and each displacement steps through the slots with a different odd stride.
+	uint32_t start = hash >> 32;
+	uint32_t stride = (hash >> 16) | 1;
+	return (start + displacement * stride) & (slots_count - 1);
+}
+
+bool hcc_intrinsic_string_find(HccString string, HccStringId* out) {
+	HccHash64 hash = hcc_intrinsic_string_hash(string.data, string.size);
+	uint32_t displacement = hcc_intrinsic_strings_bucket_displacements[hash & (HCC_INTRINSIC_STRINGS_BUCKETS_COUNT - 1)];
+	uint32_t idx_plus_one = hcc_intrinsic_strings_slots[hcc_intrinsic_string_slot(hash, displacement, HCC_INTRINSIC_STRINGS_SLOTS_COUNT)];
+	if (idx_plus_one == 0) {
+		return false;
 	}
-	expected_string_id += 1;
 
-	if (support & HCC_MANY_TYPE_CLASS_SINT) {
-		for (HccAMLIntrinsicDataType intrinsic = HCC_AML_INTRINSIC_DATA_TYPE_S8; intrinsic <= HCC_AML_INTRINSIC_DATA_TYPE_S64; intrinsic += 1) {
-			snprintf(buf + insert_idx, buf_size - insert_idx, fmt, hcc_aml_intrinsic_data_type_scalar_strings[intrinsic], c, r);
-			hcc_string_table_intrinsic_add(expected_string_id, buf);
-			expected_string_id += 1;
-		}
-	} else {
-		expected_string_id += 4;
+	const HccIntrinsicString* intrinsic = &hcc_intrinsic_strings[idx_plus_one - 1];
+	const char* data = &hcc_intrinsic_strings_data[intrinsic->data_idx / HCC_INTRINSIC_STRINGS_DATA_ROW_SIZE][intrinsic->data_idx % HCC_INTRINSIC_STRINGS_DATA_ROW_SIZE];
+	if (intrinsic->size != string.size || memcmp(data, string.data, string.size) != 0) {
+		return false;
 	}
 
-	if (support & HCC_MANY_TYPE_CLASS_UINT) {
-		for (HccAMLIntrinsicDataType intrinsic = HCC_AML_INTRINSIC_DATA_TYPE_U8; intrinsic <= HCC_AML_INTRINSIC_DATA_TYPE_U64; intrinsic += 1) {
-			snprintf(buf + insert_idx, buf_size - insert_idx, fmt, hcc_aml_intrinsic_data_type_scalar_strings[intrinsic], c, r);
-			hcc_string_table_intrinsic_add(expected_string_id, buf);
-			expected_string_id += 1;
-		}
-	} else {
-		expected_string_id += 4;
-	}
+	out->idx_plus_one = intrinsic->string_id;
+	return true;
+}
 
-	if (support & HCC_MANY_TYPE_CLASS_FLOAT) {
-		for (HccAMLIntrinsicDataType intrinsic = HCC_AML_INTRINSIC_DATA_TYPE_F16; intrinsic <= HCC_AML_INTRINSIC_DATA_TYPE_F64; intrinsic += 1) {
-			snprintf(buf + insert_idx, buf_size - insert_idx, fmt, hcc_aml_intrinsic_data_type_scalar_strings[intrinsic], c, r);
-			hcc_string_table_intrinsic_add(expected_string_id, buf);
-			expected_string_id += 1;
+HccString hcc_intrinsic_string_get(uint32_t string_id) {
+	//
+	// the intrinsic strings are ordered by their identifier but there are gaps,
+	// so binary search for it.
+	uint32_t start_idx = 0;
+	uint32_t end_idx = HCC_INTRINSIC_STRINGS_COUNT;
+	while (start_idx < end_idx) {
+		uint32_t mid_idx = start_idx + (end_idx - start_idx) / 2;
+		const HccIntrinsicString* intrinsic = &hcc_intrinsic_strings[mid_idx];
+		if (intrinsic->string_id == string_id) {
+			const char* data = &hcc_intrinsic_strings_data[intrinsic->data_idx / HCC_INTRINSIC_STRINGS_DATA_ROW_SIZE][intrinsic->data_idx % HCC_INTRINSIC_STRINGS_DATA_ROW_SIZE];
+			return hcc_string((char*)data, intrinsic->size);
+		} else if (intrinsic->string_id < string_id) {
+			start_idx = mid_idx + 1;
+		} else {
+			end_idx = mid_idx;
 		}
 	}
+
+	return hcc_string(NULL, 0);
 }
 
 void hcc_string_table_init(HccStringTable* string_table, uint32_t data_grow_count, uint32_t data_reserve_cap, uint32_t entries_cap) {
 	string_table->entries_hash_table = hcc_hash_table_init(HccStringEntry, HCC_ALLOC_TAG_STRING_TABLE_ENTRIES, hcc_string_key_cmp, hcc_string_key_hash, entries_cap);
-	string_table->id_to_entry_map = hcc_stack_init(uint32_t, HCC_ALLOC_TAG_STRING_TABLE_ID_TO_ENTRY_MAP, entries_cap, entries_cap);
+	string_table->id_to_entry_map = hcc_stack_init(uint32_t, HCC_ALLOC_TAG_STRING_TABLE_ID_TO_ENTRY_MAP, entries_cap, hcc_hash_table_reserve_cap(string_table->entries_hash_table));
 	hcc_stack_resize(string_table->id_to_entry_map, entries_cap);
 	string_table->data = hcc_stack_init(char, HCC_ALLOC_TAG_STRING_TABLE_DATA, data_grow_count, data_reserve_cap);
-	string_table->next_id = 1;
-
-	for (HccATAToken t = HCC_ATA_TOKEN_KEYWORDS_START; t < HCC_ATA_TOKEN_KEYWORDS_END; t += 1) {
-		const char* string = hcc_ata_token_strings[t];
-		uint32_t expected_string_id = HCC_STRING_ID_KEYWORDS_START + (t - HCC_ATA_TOKEN_KEYWORDS_START);
-		hcc_string_table_intrinsic_add(expected_string_id, string);
-	}
-
-	for (HccPPPredefinedMacro m = 0; m < HCC_PP_PREDEFINED_MACRO_COUNT; m += 1) {
-		const char* string = hcc_pp_predefined_macro_identifier_strings[m];
-		uint32_t expected_string_id = HCC_STRING_ID_PREDEFINED_MACROS_START + m;
-		hcc_string_table_intrinsic_add(expected_string_id, string);
-	}
-
-	for (HccPPPredefinedMacro m = 0; m < HCC_PP_PREDEFINED_MACRO_COUNT; m += 1) {
-		const char* string = hcc_pp_predefined_macro_identifier_strings[m];
-		uint32_t expected_string_id = HCC_STRING_ID_PREDEFINED_MACROS_START + m;
-		hcc_string_table_intrinsic_add(expected_string_id, string);
-	}
-
-	{
-		static const char* comps = "xyzw";
-		char buf[8];
-		uint32_t expected_string_id = HCC_STRING_ID_SWIZZLE_XYZW_START;
-		for (int c = 0; c < 4; c += 1) {
-			for (int cc = 0; cc < 4; cc += 1) {
-				snprintf(buf, sizeof(buf), "%c%c", comps[c], comps[cc]);
-				hcc_string_table_intrinsic_add(expected_string_id, buf);
-				expected_string_id += 1;
-			}
-		}
-		for (int c = 0; c < 4; c += 1) {
-			for (int cc = 0; cc < 4; cc += 1) {
-				for (int ccc = 0; ccc < 4; ccc += 1) {
-					snprintf(buf, sizeof(buf), "%c%c%c", comps[c], comps[cc], comps[ccc]);
-					hcc_string_table_intrinsic_add(expected_string_id, buf);
-					expected_string_id += 1;
-				}
-			}
-		}
-		for (int c = 0; c < 4; c += 1) {
-			for (int cc = 0; cc < 4; cc += 1) {
-				for (int ccc = 0; ccc < 4; ccc += 1) {
-					for (int cccc = 0; cccc < 4; cccc += 1) {
-						snprintf(buf, sizeof(buf), "%c%c%c%c", comps[c], comps[cc], comps[ccc], comps[cccc]);
-						hcc_string_table_intrinsic_add(expected_string_id, buf);
-						expected_string_id += 1;
-					}
-				}
-			}
-		}
-		HCC_DEBUG_ASSERT(expected_string_id == HCC_STRING_ID_SWIZZLE_XYZW_END, "did not fill in all the swizzle string ids");
-	}
-
-	{
-		static const char* comps = "rgba";
-		char buf[8];
-		uint32_t expected_string_id = HCC_STRING_ID_SWIZZLE_RGBA_START;
-		for (int c = 0; c < 4; c += 1) {
-			for (int cc = 0; cc < 4; cc += 1) {
-				snprintf(buf, sizeof(buf), "%c%c", comps[c], comps[cc]);
-				hcc_string_table_intrinsic_add(expected_string_id, buf);
-				expected_string_id += 1;
-			}
-		}
-		for (int c = 0; c < 4; c += 1) {
-			for (int cc = 0; cc < 4; cc += 1) {
-				for (int ccc = 0; ccc < 4; ccc += 1) {
-					snprintf(buf, sizeof(buf), "%c%c%c", comps[c], comps[cc], comps[ccc]);
-					hcc_string_table_intrinsic_add(expected_string_id, buf);
-					expected_string_id += 1;
-				}
-			}
-		}
-		for (int c = 0; c < 4; c += 1) {
-			for (int cc = 0; cc < 4; cc += 1) {
-				for (int ccc = 0; ccc < 4; ccc += 1) {
-					for (int cccc = 0; cccc < 4; cccc += 1) {
-						snprintf(buf, sizeof(buf), "%c%c%c%c", comps[c], comps[cc], comps[ccc], comps[cccc]);
-						hcc_string_table_intrinsic_add(expected_string_id, buf);
-						expected_string_id += 1;
-					}
-				}
-			}
-		}
-		HCC_DEBUG_ASSERT(expected_string_id == HCC_STRING_ID_SWIZZLE_RGBA_END, "did not fill in all the swizzle string ids");
-	}
-
-	hcc_string_table_intrinsic_add(HCC_STRING_ID_ONCE, "once");
-	hcc_string_table_intrinsic_add(HCC_STRING_ID_DEFINED, "defined");
-	hcc_string_table_intrinsic_add(HCC_STRING_ID___VA_ARGS__, "__VA_ARGS__");
-	hcc_string_table_intrinsic_add(HCC_STRING_ID_X, "x");
-	hcc_string_table_intrinsic_add(HCC_STRING_ID_Y, "y");
-	hcc_string_table_intrinsic_add(HCC_STRING_ID_Z, "z");
-	hcc_string_table_intrinsic_add(HCC_STRING_ID_W, "w");
-	hcc_string_table_intrinsic_add(HCC_STRING_ID_R, "r");
-	hcc_string_table_intrinsic_add(HCC_STRING_ID_G, "g");
-	hcc_string_table_intrinsic_add(HCC_STRING_ID_B, "b");
-	hcc_string_table_intrinsic_add(HCC_STRING_ID_A, "a");
-
-	{
-		char buf[128];
-
-		for (uint32_t f = 0; f < HCC_COMPOUND_DATA_TYPE_IDX_STRINGS_COUNT; f += 1) {
-			const char* string = hcc_intrinisic_compound_data_type_strings[f];
-
-			uint32_t expected_string_id = HCC_STRING_ID_INTRINSIC_COMPOUND_DATA_TYPES_START + f;
-			hcc_string_table_intrinsic_add(expected_string_id, string);
-		}
-
-		//
-		// generate the packed vector names
-		for (uint32_t c = 2; c <= 4; c += 1) {
-			for (HccAMLIntrinsicDataType intrinsic = HCC_AML_INTRINSIC_DATA_TYPE_S8; intrinsic <= HCC_AML_INTRINSIC_DATA_TYPE_F64; intrinsic += 1) {
-				snprintf(buf, sizeof(buf), "p%sx%u", hcc_aml_intrinsic_data_type_scalar_strings[intrinsic], c);
-				uint32_t expected_string_id = HCC_STRING_ID_INTRINSIC_COMPOUND_DATA_TYPES_START + HCC_COMPOUND_DATA_TYPE_IDX_PACKED_AML_START + HCC_AML_INTRINSIC_DATA_TYPE(intrinsic, c, 1);
-				hcc_string_table_intrinsic_add(expected_string_id, buf);
-			}
-		}
-
-		//
-		// generate the packed matrix names
-		for (uint32_t r = 2; r <= 4; r += 1) {
-			for (uint32_t c = 2; c <= 4; c += 1) {
-				for (HccAMLIntrinsicDataType intrinsic = HCC_AML_INTRINSIC_DATA_TYPE_S8; intrinsic <= HCC_AML_INTRINSIC_DATA_TYPE_F64; intrinsic += 1) {
-					snprintf(buf, sizeof(buf), "p%sx%ux%u", hcc_aml_intrinsic_data_type_scalar_strings[intrinsic], c, r);
-					uint32_t expected_string_id = HCC_STRING_ID_INTRINSIC_COMPOUND_DATA_TYPES_START + HCC_COMPOUND_DATA_TYPE_IDX_PACKED_AML_START + HCC_AML_INTRINSIC_DATA_TYPE(intrinsic, c, r);
-					hcc_string_table_intrinsic_add(expected_string_id, buf);
-				}
-			}
-		}
-
-		for (uint32_t f = 0; f < HCC_FUNCTION_IDX_STRINGS_COUNT; f += 1) {
-			const char* string = hcc_intrinisic_function_strings[f];
-			uint32_t expected_string_id = HCC_STRING_ID_INTRINSIC_FUNCTIONS_START + f;
-			hcc_string_table_intrinsic_add(expected_string_id, string);
-		}
-
-		for (uint32_t f = 0; f < HCC_FUNCTION_MANY_COUNT; f += 1) {
-			const char* function_prefix = hcc_intrinisic_function_many_strings[f];
-			uint32_t expected_string_id = HCC_STRING_ID_INTRINSIC_FUNCTIONS_START + HCC_FUNCTION_IDX_MANY_START + (f * HCC_FUNCTION_MANY_STRIDE);
-			uint32_t insert_idx = snprintf(buf, sizeof(buf), "%s_", function_prefix);
-
-			HccManyTypeClass support = hcc_intrinisic_function_many_support[f];
-
-			//
-			// generate the scalar versions of this function if they are supported
-			if (support & HCC_MANY_TYPE_CLASS_OPS_SCALAR) {
-				hcc_string_intrinsic_decl_add_function(buf, sizeof(buf), insert_idx, "%s", expected_string_id, support, 0, 0);
-			}
-			expected_string_id += 16;
-
-			//
-			// generate the vector versions of this function if they are supported
-			if (support & HCC_MANY_TYPE_CLASS_OPS_VECTOR) {
-				for (uint32_t c = 2; c <= 4; c += 1) {
-					hcc_string_intrinsic_decl_add_function(buf, sizeof(buf), insert_idx, "%sx%u", expected_string_id, support, c, 0);
-					expected_string_id += 16;
-				}
-			} else {
-				expected_string_id += 48;
-			}
-
-			if (support & HCC_MANY_TYPE_CLASS_STORAGE_TEXTURE) {
-				const char* fmt = "%s%s%s_%s";
-
-				for (uint32_t dim = 0; dim < HCC_TEXTURE_DIM_COUNT; dim += 1) {
-					for (uint32_t is_ms = 0; is_ms <= 1; is_ms += 1) {
-						const char* ms = is_ms ? "_ms" : "";
-						for (uint32_t is_array = 0; is_array <= 1; is_array += 1) {
-							const char* array = is_array ? "_array" : "";
-							for (uint32_t format = 0; format < HCC_TEXTURE_FORMAT_COUNT; format += 1) {
-								const char* fmt_string = hcc_texture_format_idents_lower[format];
-								snprintf(buf + insert_idx, sizeof(buf) - insert_idx, fmt, hcc_texture_dim_strings_lower[dim], ms, array, fmt_string);
-								hcc_string_table_intrinsic_add(expected_string_id, buf);
-								expected_string_id += 1;
-							}
-						}
-					}
-				}
-			}
+	string_table->next_id = HCC_STRING_ID_USER_START;
 
-			if (support & HCC_MANY_TYPE_CLASS_SAMPLE_TEXTURE) {
-				const char* fmt = "%s%s%s_%s%s";
-
-				for (uint32_t dim = 0; dim < HCC_TEXTURE_DIM_COUNT; dim += 1) {
-					for (uint32_t is_ms = 0; is_ms <= 1; is_ms += 1) {
-						const char* ms = is_ms ? "_ms" : "";
-						for (uint32_t is_array = 0; is_array <= 1; is_array += 1) {
-							const char* array = is_array ? "_array" : "";
-							for (uint32_t vector = 1; vector <= 4; vector += 1) {
-								const char* vector_suffix;
-								switch (vector) {
-									case 1: vector_suffix = ""; break;
-									case 2: vector_suffix = "x2"; break;
-									case 3: vector_suffix = "x3"; break;
-									case 4: vector_suffix = "x4"; break;
-								}
-								snprintf(buf + insert_idx, sizeof(buf) - insert_idx, fmt, hcc_texture_dim_strings_lower[dim], ms, array, hcc_aml_intrinsic_data_type_scalar_strings[HCC_AML_INTRINSIC_DATA_TYPE_F32], vector_suffix);
-								hcc_string_table_intrinsic_add(expected_string_id, buf);
-								expected_string_id += 1;
-
-								snprintf(buf + insert_idx, sizeof(buf) - insert_idx, fmt, hcc_texture_dim_strings_lower[dim], ms, array, hcc_aml_intrinsic_data_type_scalar_strings[HCC_AML_INTRINSIC_DATA_TYPE_S32], vector_suffix);
-								hcc_string_table_intrinsic_add(expected_string_id, buf);
-								expected_string_id += 1;
-
-								snprintf(buf + insert_idx, sizeof(buf) - insert_idx, fmt, hcc_texture_dim_strings_lower[dim], ms, array, hcc_aml_intrinsic_data_type_scalar_strings[HCC_AML_INTRINSIC_DATA_TYPE_U32], vector_suffix);
-								hcc_string_table_intrinsic_add(expected_string_id, buf);
-								expected_string_id += 1;
-
-								if (vector == 1) {
-									snprintf(buf + insert_idx, sizeof(buf) - insert_idx, fmt, hcc_texture_dim_strings_lower[dim], ms, array, hcc_aml_intrinsic_data_type_scalar_strings[HCC_AML_INTRINSIC_DATA_TYPE_S64], vector_suffix);
-									hcc_string_table_intrinsic_add(expected_string_id, buf);
-									expected_string_id += 1;
-
-									snprintf(buf + insert_idx, sizeof(buf) - insert_idx, fmt, hcc_texture_dim_strings_lower[dim], ms, array, hcc_aml_intrinsic_data_type_scalar_strings[HCC_AML_INTRINSIC_DATA_TYPE_U64], vector_suffix);
-									hcc_string_table_intrinsic_add(expected_string_id, buf);
-									expected_string_id += 1;
-								}
-							}
-						}
-					}
-				}
-			}
-
-			if (support & HCC_MANY_TYPE_CLASS_BYTE_BUFFER) {
-				const char* fmt = "%s%s";
-
-				for (uint32_t vector = 1; vector <= 4; vector += 1) {
-					const char* vector_suffix;
-					switch (vector) {
-						case 1: vector_suffix = ""; break;
-						case 2: vector_suffix = "x2"; break;
-						case 3: vector_suffix = "x3"; break;
-						case 4: vector_suffix = "x4"; break;
-					}
-					snprintf(buf + insert_idx, sizeof(buf) - insert_idx, fmt, hcc_aml_intrinsic_data_type_scalar_strings[HCC_AML_INTRINSIC_DATA_TYPE_F32], vector_suffix);
-					hcc_string_table_intrinsic_add(expected_string_id, buf);
-					expected_string_id += 1;
-
-					snprintf(buf + insert_idx, sizeof(buf) - insert_idx, fmt, hcc_aml_intrinsic_data_type_scalar_strings[HCC_AML_INTRINSIC_DATA_TYPE_S32], vector_suffix);
-					hcc_string_table_intrinsic_add(expected_string_id, buf);
-					expected_string_id += 1;
-
-					snprintf(buf + insert_idx, sizeof(buf) - insert_idx, fmt, hcc_aml_intrinsic_data_type_scalar_strings[HCC_AML_INTRINSIC_DATA_TYPE_U32], vector_suffix);
-					hcc_string_table_intrinsic_add(expected_string_id, buf);
-					expected_string_id += 1;
-				}
-			}
-		}
-
-		_hcc_gs.string_table.next_id = HCC_STRING_ID_USER_START;
-	}
+	//
+	// catch an intrinsic strings file that was generated with a different hash function
+	HccStringId id;
+	HCC_ASSERT(
+		hcc_intrinsic_string_find(hcc_string_c((char*)hcc_ata_token_strings[HCC_ATA_TOKEN_KEYWORDS_START]), &id) && id.idx_plus_one == HCC_STRING_ID_KEYWORDS_START,
+		"src/intrinsic_strings.c is out of date, regenerate it with scripts/intrinsics_gen.sh"
+	);
 }
 
 void hcc_string_table_deinit(HccStringTable* string_table) {
@@ -1476,6 +1901,11 @@ HccResult hcc_string_table_deduplicate(const char* string, uint32_t string_size,
 
 	HccStringTable* string_table = &_hcc_gs.string_table;
 	HccString str = hcc_string((char*)string, string_size);
+	if (hcc_intrinsic_string_find(str, out)) {
+		hcc_clear_bail_jmp_loc();
+		return HCC_RESULT_SUCCESS;
+	}
+
 	HccHashTableInsert insert = hcc_hash_table_find_insert_idx(string_table->entries_hash_table, &str);
 	HccStringEntry* entry = &string_table->entries_hash_table[insert.idx];
 	if (insert.is_new) {
@@ -1484,8 +1914,18 @@ HccResult hcc_string_table_deduplicate(const char* string, uint32_t string_size,
 		str.data = dst;
 		entry->string = str;
 		uint32_t id = atomic_fetch_add(&string_table->next_id, 1);
-		atomic_store(&entry->id, id);
+		HccStackHeader* map_header = hcc_stack_header(string_table->id_to_entry_map);
+		if (id >= atomic_load(&map_header->count)) {
+			//
+			// the entries hash table has grown, so grow the map along with it
+			hcc_spin_mutex_lock(&map_header->push_thread_safe_mutex);
+			if (id >= map_header->count) {
+				hcc_stack_resize(string_table->id_to_entry_map, hcc_uint32_round_up_to_multiple(id + 1, map_header->grow_count));
+			}
+			hcc_spin_mutex_unlock(&map_header->push_thread_safe_mutex);
+		}
 		*hcc_stack_get(string_table->id_to_entry_map, id) = insert.idx;
+		atomic_store(&entry->id, id);
 	} else {
 		//
 		// if another thread has just inserted this string into the string table.
@@ -1502,6 +1942,10 @@ HccResult hcc_string_table_deduplicate(const char* string, uint32_t string_size,
 
 HccString hcc_string_table_get(HccStringId id) {
 	HCC_DEBUG_ASSERT_NON_ZERO(id.idx_plus_one);
+	if (id.idx_plus_one < HCC_STRING_ID_USER_START) {
+		return hcc_intrinsic_string_get(id.idx_plus_one);
+	}
+
 	HccStringTable* string_table = &_hcc_gs.string_table;
 	uint32_t entry_idx = *hcc_stack_get(string_table->id_to_entry_map, id.idx_plus_one);
 	return string_table->entries_hash_table[entry_idx].string;
@@ -1509,7 +1953,13 @@ HccString hcc_string_table_get(HccStringId id) {
 
 HccString hcc_string_table_get_or_empty(HccStringId id) {
 	HccStringTable* string_table = &_hcc_gs.string_table;
-	if (id.idx_plus_one == 0 || id.idx_plus_one >= hcc_hash_table_cap(string_table->entries_hash_table)) {
+	if (id.idx_plus_one == 0) {
+		return hcc_string(NULL, 0);
+	}
+	if (id.idx_plus_one < HCC_STRING_ID_USER_START) {
+		return hcc_intrinsic_string_get(id.idx_plus_one);
+	}
+	if (id.idx_plus_one >= hcc_stack_count(string_table->id_to_entry_map)) {
 		return hcc_string(NULL, 0);
 	}
 	uint32_t entry_idx = *hcc_stack_get(string_table->id_to_entry_map, id.idx_plus_one);
@@ -1528,9 +1978,17 @@ HccResult hcc_code_file_init(HccCodeFile* code_file, HccString path_string, bool
 	code_file->path_string = path_string;
 	code_file->line_code_start_indices = hcc_stack_init(uint32_t, 0, _hcc_gs.code_file_lines_grow_count, _hcc_gs.code_file_lines_reserve_cap);
 	code_file->pp_if_spans = hcc_stack_init(HccPPIfSpan, 0, _hcc_gs.code_file_pp_if_spans_grow_count, _hcc_gs.code_file_pp_if_spans_reserve_cap);
+	code_file->loaded_generation = _hcc_gs.code_files_generation;
+	atomic_store(&code_file->used_generation, _hcc_gs.code_files_generation);
 	hcc_stack_push_many(code_file->line_code_start_indices, 2);
 
 	if (!do_not_open_file) {
+		//
+		// stat before reading so a write that lands while we read gets picked up on the next compile
+		if (!_hcc_gs.file_stat_fn || !_hcc_gs.file_stat_fn(path_string.data, &code_file->stat)) {
+			HCC_ZERO_ELMT(&code_file->stat);
+		}
+
 		HccIIO iio;
 		if (!_hcc_gs.file_open_read_fn(path_string.data, &iio)) {
 			return HccResult(HCC_ERROR_FILE_OPEN_READ, 0, NULL);
@@ -1540,9 +1998,14 @@ HccResult hcc_code_file_init(HccCodeFile* code_file, HccString path_string, bool
 		hcc_virt_mem_reserve_commit(HCC_ALLOC_TAG_CODE, NULL, alloc_size, HCC_VIRT_MEM_PROTECTION_READ_WRITE, (void**)&code_file->code.data);
 
 		code_file->code.size = iio.size;
-		if (hcc_iio_read(&iio, code_file->code.data, iio.size) == UINTPTR_MAX) {
+		uintptr_t read_size = hcc_iio_read(&iio, code_file->code.data, iio.size);
+		hcc_iio_close(&iio);
+		if (read_size == UINTPTR_MAX) {
 			return HccResult(HCC_ERROR_FILE_READ, 0, NULL);
 		}
+
+		code_file->code_hash = hcc_hash_wy_64(code_file->code.data, code_file->code.size, HCC_HASH_WY_64_INIT);
+		atomic_fetch_add(&_hcc_gs.code_file_cache_misses_count, 1);
 	}
 
 	atomic_fetch_or(&code_file->flags, HCC_CODE_FILE_FLAGS_IS_LOADED);
@@ -1552,8 +2015,77 @@ HccResult hcc_code_file_init(HccCodeFile* code_file, HccString path_string, bool
 void hcc_code_file_deinit(HccCodeFile* code_file) {
 	hcc_stack_deinit(code_file->line_code_start_indices);
 	hcc_stack_deinit(code_file->pp_if_spans);
-	uintptr_t alloc_size = HCC_INT_ROUND_UP_ALIGN(code_file->code.size + _HCC_TOKENIZER_LOOK_HEAD_SIZE, _hcc_gs.virt_mem_reserve_align);
-	hcc_virt_mem_release(HCC_ALLOC_TAG_CODE, code_file->code.data, alloc_size);
+	if (code_file->code.data) {
+		uintptr_t alloc_size = HCC_INT_ROUND_UP_ALIGN(code_file->code.size + _HCC_TOKENIZER_LOOK_HEAD_SIZE, _hcc_gs.virt_mem_reserve_align);
+		hcc_virt_mem_release(HCC_ALLOC_TAG_CODE, code_file->code.data, alloc_size);
+	}
+}
+
+bool hcc_code_file_is_up_to_date(HccCodeFile* code_file) {
+	HccFileStat stat;
+	bool has_stat = _hcc_gs.file_stat_fn && _hcc_gs.file_stat_fn(code_file->path_string.data, &stat);
+	if (has_stat) {
+		if (stat.size != code_file->stat.size) {
+			return false;
+		}
+
+		if (stat.modified_time.secs == code_file->stat.modified_time.secs && stat.modified_time.nanosecs == code_file->stat.modified_time.nanosecs) {
+			return true;
+		}
+	}
+
+	//
+	// the modified time has changed or we could not get it,
+	// so fallback to comparing the hash of the contents. a touched but unchanged file stays cached.
+	HccIIO iio;
+	if (!_hcc_gs.file_open_read_fn(code_file->path_string.data, &iio)) {
+		return false;
+	}
+
+	bool is_up_to_date = false;
+	if (iio.size == code_file->code.size) {
+		uintptr_t alloc_size = HCC_INT_ROUND_UP_ALIGN(iio.size + 1, _hcc_gs.virt_mem_reserve_align);
+		char* code;
+		hcc_virt_mem_reserve_commit(HCC_ALLOC_TAG_CODE, NULL, alloc_size, HCC_VIRT_MEM_PROTECTION_READ_WRITE, (void**)&code);
+		if (hcc_iio_read(&iio, code, iio.size) != UINTPTR_MAX) {
+			is_up_to_date = hcc_hash_wy_64(code, iio.size, HCC_HASH_WY_64_INIT) == code_file->code_hash;
+		}
+		hcc_virt_mem_release(HCC_ALLOC_TAG_CODE, code, alloc_size);
+	}
+	hcc_iio_close(&iio);
+
+	if (is_up_to_date && has_stat) {
+		code_file->stat = stat;
+	}
+	return is_up_to_date;
+}
+
+void hcc_code_files_revalidate(void) {
+	_hcc_gs.code_files_generation += 1;
+
+	for (uint32_t idx = 0; idx < hcc_hash_table_cap(_hcc_gs.path_to_code_file_map); idx += 1) {
+		HccCodeFileEntry* entry = &_hcc_gs.path_to_code_file_map[idx];
+		if (!entry->path_string.data) {
+			continue;
+		}
+
+		//
+		// a file that did not make it through a full mutator pass (a failed open or an error mid parse)
+		// has incomplete line & #if span information, so it must be loaded again.
+		HccCodeFile* code_file = &entry->file;
+		if ((atomic_load(&code_file->flags) & HCC_CODE_FILE_FLAGS_COMPLETED_MUTATOR_PASS) && hcc_code_file_is_up_to_date(code_file)) {
+			continue;
+		}
+
+		hcc_code_file_deinit(code_file);
+		HccString path_string = entry->path_string;
+		hcc_hash_table_remove(_hcc_gs.path_to_code_file_map, &path_string);
+
+		//
+		// zero the entry so the flags are clear when this slot gets reused for another file
+		HCC_ZERO_ELMT(entry);
+		atomic_fetch_add(&_hcc_gs.code_file_cache_invalidated_count, 1);
+	}
 }
 
 HccCodeFile* hcc_code_file_find(HccString file_path) {
@@ -1577,6 +2109,13 @@ HccResult hcc_code_file_find_or_insert(HccString file_path, HccCodeFile** code_f
 		while (!(atomic_load(&code_file->flags) & HCC_CODE_FILE_FLAGS_IS_LOADED)) {
 			HCC_CPU_RELAX();
 		}
+
+		//
+		// count a hit the first time a code file loaded by a previous compile is used in this one
+		uint32_t generation = _hcc_gs.code_files_generation;
+		if (code_file->loaded_generation != generation && atomic_exchange(&code_file->used_generation, generation) != generation) {
+			atomic_fetch_add(&_hcc_gs.code_file_cache_hits_count, 1);
+		}
 	}
 
 	if (HCC_IS_SUCCESS(result)) {
@@ -1634,6 +2173,38 @@ uint32_t hcc_code_file_lines_count(HccCodeFile* code_file) {
 	return hcc_stack_count(code_file->line_code_start_indices) - 1;
 }
 
+uint32_t hcc_code_file_line_at(HccCodeFile* code_file, uint32_t code_idx, uint32_t* line_code_start_idx_out) {
+	HCC_DEBUG_ASSERT(code_idx <= code_file->code.size, "internal error: code index is out of bounds");
+
+	//
+	// binary search for the last line that starts at or before code_idx.
+	// line 0 is not a real line, it is there so the line number can be used as the index.
+	// if the mutator of the code file is still tokenizing it, then it is the only one who can ask
+	// and every line up to its cursor has already been pushed.
+	uint32_t* line_code_start_indices = code_file->line_code_start_indices;
+	uint32_t start = 1;
+	uint32_t end = hcc_stack_count(line_code_start_indices);
+	while (end - start > 1) {
+		uint32_t mid = start + (end - start) / 2;
+		if (line_code_start_indices[mid] <= code_idx) {
+			start = mid;
+		} else {
+			end = mid;
+		}
+	}
+
+	*line_code_start_idx_out = line_code_start_indices[start];
+	return start;
+}
+
+HccCodeFileCacheStats hcc_code_file_cache_stats(void) {
+	return (HccCodeFileCacheStats) {
+		.hits_count = atomic_load(&_hcc_gs.code_file_cache_hits_count),
+		.misses_count = atomic_load(&_hcc_gs.code_file_cache_misses_count),
+		.invalidated_count = atomic_load(&_hcc_gs.code_file_cache_invalidated_count),
+	};
+}
+
 // ===========================================
 //
 //
@@ -1642,6 +2213,164 @@ uint32_t hcc_code_file_lines_count(HccCodeFile* code_file) {
 //
 // ===========================================
 
+void hcc_location_table_init(HccCU* cu, HccLocationTableSetup* setup) {
+	HccLocationTable* table = &cu->location_table;
+	table->locations = hcc_stack_init(HccLocation, HCC_ALLOC_TAG_LOCATION_TABLE_LOCATIONS, setup->locations_grow_count, setup->locations_reserve_cap);
+	table->spans = hcc_stack_init(HccLocationSpan, HCC_ALLOC_TAG_LOCATION_TABLE_SPANS, setup->spans_grow_count, setup->spans_reserve_cap);
+	table->decoded_hash_table = hcc_hash_table_init(HccLocationDecodedEntry, HCC_ALLOC_TAG_LOCATION_TABLE_DECODED_HASH_TABLE, hcc_u32_key_cmp, hcc_u32_key_hash, HCC_HASH_TABLE_INITIAL_CAP_FOR(setup->decoded_locations_cap));
+	atomic_store(&table->spans_count, 0);
+	table->next_offset = 1; // so HCC_LOCATION_ID_NULL is never a valid offset
+	hcc_spin_mutex_init(&table->spans_mutex);
+}
+
+void hcc_location_table_deinit(HccCU* cu) {
+	hcc_stack_deinit(cu->location_table.locations);
+	hcc_stack_deinit(cu->location_table.spans);
+	hcc_hash_table_deinit(cu->location_table.decoded_hash_table);
+}
+
+HccLocation* hcc_location_table_alloc(HccCU* cu) {
+	return hcc_stack_push_thread_safe(cu->location_table.locations);
+}
+
+uint32_t hcc_location_table_add_span(HccCU* cu, HccCodeFile* code_file, HccString display_path, uint32_t custom_line_dst, uint32_t custom_line_src) {
+	HccLocationTable* table = &cu->location_table;
+	uint32_t span_idx = UINT32_MAX;
+
+	hcc_spin_mutex_lock(&table->spans_mutex);
+	uint32_t spans_count = hcc_stack_count(table->spans);
+	uint64_t next_offset = (uint64_t)table->next_offset + code_file->code.size + 1;
+
+	//
+	// if we run out of offsets or spans, the caller falls back to storing the full locations
+	if (spans_count < hcc_stack_cap(table->spans) && next_offset <= HCC_LOCATION_ID_VALUE_MASK) {
+		HccLocationSpan* span = hcc_stack_push(table->spans);
+		span->code_file = code_file;
+		span->display_path = display_path;
+		span->offset_start = table->next_offset;
+		span->custom_line_dst = custom_line_dst;
+		span->custom_line_src = custom_line_src;
+		table->next_offset = next_offset;
+		atomic_store(&table->spans_count, spans_count + 1);
+		span_idx = spans_count;
+	}
+	hcc_spin_mutex_unlock(&table->spans_mutex);
+
+	return span_idx;
+}
+
+HccLocationId hcc_location_table_id(HccCU* cu, HccLocation* location) {
+	if (location == NULL) {
+		return HCC_LOCATION_ID_NULL;
+	}
+
+	HccLocationTable* table = &cu->location_table;
+	HCC_DEBUG_ASSERT(table->locations <= location && location < &table->locations[hcc_stack_count(table->locations)], "internal error: location was not allocated by the location table");
+	return (location - table->locations) | HCC_LOCATION_ID_FULL_BIT;
+}
+
+HccLocation* hcc_location_table_get(HccCU* cu, HccLocationId location_id) {
+	if (location_id == HCC_LOCATION_ID_NULL) {
+		return NULL;
+	}
+
+	if (location_id & HCC_LOCATION_ID_FULL_BIT) {
+		return hcc_stack_get(cu->location_table.locations, location_id & HCC_LOCATION_ID_VALUE_MASK);
+	}
+
+	//
+	// the first thread to ask for this offset decodes it, the rest wait for it and share the same location.
+	// so the table only grows by the number of different tokens that are looked up, not by every lookup.
+	// once the decoded hash table is half full, the rest are decoded without being remembered so it never runs out.
+	HccLocationTable* table = &cu->location_table;
+	if (hcc_hash_table_count(table->decoded_hash_table) >= hcc_hash_table_reserve_cap(table->decoded_hash_table) / 2) {
+		HccLocation* location = hcc_location_table_alloc(cu);
+		hcc_location_table_decode(cu, location_id, location, NULL);
+		return location;
+	}
+
+	HccHashTableInsert insert = hcc_hash_table_find_insert_idx(table->decoded_hash_table, &location_id);
+	HccLocationDecodedEntry* entry = &table->decoded_hash_table[insert.idx];
+	if (insert.is_new) {
+		HccLocation* location = hcc_location_table_alloc(cu);
+		hcc_location_table_decode(cu, location_id, location, NULL);
+		atomic_store(&entry->location_id, hcc_location_table_id(cu, location));
+		return location;
+	}
+
+	HccLocationId decoded_location_id;
+	while ((decoded_location_id = atomic_load(&entry->location_id)) == HCC_LOCATION_ID_NULL) {
+		HCC_CPU_RELAX();
+	}
+	return hcc_stack_get(table->locations, decoded_location_id & HCC_LOCATION_ID_VALUE_MASK);
+}
+
+void hcc_location_table_decode(HccCU* cu, HccLocationId location_id, HccLocation* location_out, HccLocationDecodeCache* cache) {
+	HCC_DEBUG_ASSERT(location_id != HCC_LOCATION_ID_NULL, "internal error: cannot decode a null location");
+	HccLocationTable* table = &cu->location_table;
+	if (location_id & HCC_LOCATION_ID_FULL_BIT) {
+		*location_out = *hcc_stack_get(table->locations, location_id & HCC_LOCATION_ID_VALUE_MASK);
+		return;
+	}
+
+	uint32_t offset = location_id & HCC_LOCATION_ID_VALUE_MASK;
+	HccLocationSpan* span = cache ? cache->span : NULL;
+	if (span == NULL || offset < span->offset_start || offset - span->offset_start > span->code_file->code.size) {
+		//
+		// binary search for the span that holds this offset
+		uint32_t start = 0;
+		uint32_t end = atomic_load(&table->spans_count);
+		while (end - start > 1) {
+			uint32_t mid = start + (end - start) / 2;
+			if (table->spans[mid].offset_start <= offset) {
+				start = mid;
+			} else {
+				end = mid;
+			}
+		}
+		span = &table->spans[start];
+		if (cache) {
+			cache->span = span;
+			cache->line_code_start_idx = 0;
+			cache->line_code_end_idx = 0;
+		}
+	}
+	HCC_DEBUG_ASSERT(span->offset_start <= offset && offset - span->offset_start <= span->code_file->code.size, "internal error: location offset is outside of the span");
+
+	//
+	// only tokens that sit on a single line are stored as an offset, see hcc_atagen_make_location_id.
+	// so the rest of the location can be found from the code of the token.
+	HccCodeFile* code_file = span->code_file;
+	uint32_t code_start_idx = offset - span->offset_start;
+	uint32_t code_size = hcc_atagen_token_code_size(code_file->code, code_start_idx);
+	uint32_t line;
+	uint32_t line_code_start_idx;
+	if (cache && cache->line_code_start_idx <= code_start_idx && code_start_idx < cache->line_code_end_idx) {
+		line = cache->line;
+		line_code_start_idx = cache->line_code_start_idx;
+	} else {
+		line = hcc_code_file_line_at(code_file, code_start_idx, &line_code_start_idx);
+		if (cache) {
+			uint32_t* next_line_code_start_idx = hcc_stack_get_or_null(code_file->line_code_start_indices, line + 1);
+			cache->line = line;
+			cache->line_code_start_idx = line_code_start_idx;
+			cache->line_code_end_idx = next_line_code_start_idx ? *next_line_code_start_idx : line_code_start_idx;
+		}
+	}
+
+	location_out->code_file = code_file;
+	location_out->parent_location = NULL;
+	location_out->macro = NULL;
+	location_out->code_start_idx = code_start_idx;
+	location_out->code_end_idx = code_start_idx + code_size;
+	location_out->line_start = line;
+	location_out->line_end = line + 1;
+	location_out->column_start = code_start_idx - line_code_start_idx + 1;
+	location_out->column_end = location_out->column_start + code_size;
+	location_out->display_path = span->display_path;
+	location_out->display_line = span->custom_line_dst ? span->custom_line_dst + (line - span->custom_line_src) : line;
+}
+
 void hcc_location_merge_apply(HccLocation* before, HccLocation* after) {
 	before->code_end_idx = after->code_end_idx;
 	if (before->line_start != after->line_start) {
@@ -1667,9 +2396,10 @@ HccSetup hcc_setup_default = {
 	.alloc_event_userdata = NULL,
 	.path_canonicalize_fn = hcc_path_canonicalize_internal,
 	.file_open_read_fn = hcc_file_open_read,
+	.file_stat_fn = hcc_file_stat,
 	.string_table_data_grow_count = 1048576,   // 1MB
 	.string_table_data_reserve_cap = 67108864, // 64MB
-	.string_table_entries_cap = 1048576,
+	.string_table_entries_cap = 65536,
 	.code_files_cap = 8192,
 	.code_file_lines_grow_count = 512,
 	.code_file_lines_reserve_cap = 131072,
@@ -1683,9 +2413,11 @@ HccResult hcc_init(HccSetup* setup) {
 	_hcc_gs.alloc_event_userdata = setup->alloc_event_userdata;
 	_hcc_gs.path_canonicalize_fn = setup->path_canonicalize_fn;
 	_hcc_gs.file_open_read_fn = setup->file_open_read_fn;
+	_hcc_gs.file_stat_fn = setup->file_stat_fn;
 	HCC_SET_BAIL_JMP_LOC_GLOBAL();
 
 	hcc_virt_mem_update_page_size_reserve_align();
+	hcc_mem_tracker_init();
 	hcc_arena_alctor_init(&_hcc_gs.arena_alctor, HCC_ALLOC_TAG_GLOBAL_MEM_ARENA, setup->global_mem_arena_size);
 	hcc_string_table_init(&_hcc_gs.string_table, setup->string_table_data_grow_count, setup->string_table_data_reserve_cap, setup->string_table_entries_cap);
 
@@ -1709,6 +2441,7 @@ void hcc_deinit(void) {
 		}
 	}
 	hcc_hash_table_deinit(_hcc_gs.path_to_code_file_map);
+	hcc_mem_tracker_deinit();
 }
 
 HccResult hcc_clear_global_mem_arena(void) {
@@ -1730,6 +2463,9 @@ HccResult hcc_clear_code_files(void) {
 		}
 	}
 	hcc_hash_table_clear(_hcc_gs.path_to_code_file_map);
+	atomic_store(&_hcc_gs.code_file_cache_hits_count, 0);
+	atomic_store(&_hcc_gs.code_file_cache_misses_count, 0);
+	atomic_store(&_hcc_gs.code_file_cache_invalidated_count, 0);
 
 	hcc_clear_bail_jmp_loc();
 	return HCC_RESULT_SUCCESS;
@@ -113,7 +113,9 @@ enum HccResultCode {
 	HCC_ERROR_NOT_A_DIR,
 	HCC_ERROR_FILE_OPEN_READ,
 	HCC_ERROR_FILE_READ,
-	HCC_ERROR_OPEN_OUTPUT_FILE,
+	HCC_ERROR_INVALID_BINARY,
+	HCC_ERROR_OPEN_OUTPUT_FILE,  // HccResult.value == errno
+	HCC_ERROR_WRITE_OUTPUT_FILE,
 
 	HCC_ERROR_THREAD_INIT,
 	HCC_ERROR_THREAD_WAIT_FOR_TERMINATION,
@@ -200,6 +202,7 @@ enum HccAllocTag {
 	HCC_ALLOC_TAG_STRING_TABLE_ENTRIES,
 	HCC_ALLOC_TAG_STRING_TABLE_DATA,
 	HCC_ALLOC_TAG_STRING_TABLE_ID_TO_ENTRY_MAP,
+	HCC_ALLOC_TAG_WORKERS,
 	HCC_ALLOC_TAG_WORKER_CALL_STACKS,
 	HCC_ALLOC_TAG_WORKER_JOB_QUEUE,
 	HCC_ALLOC_TAG_ATA_TEXT,
@@ -213,6 +216,7 @@ enum HccAllocTag {
 	HCC_ALLOC_TAG_AML,
 	HCC_ALLOC_TAG_WORKER_STRING_BUFFER,
 	HCC_ALLOC_TAG_WORKER_ARENA,
+	HCC_ALLOC_TAG_MEM_TRACKER,
 
 	HCC_ALLOC_TAG_CU_SHADER_FUNCTION_DECLS,
 	HCC_ALLOC_TAG_CU_RESOURCE_STRUCTS,
@@ -237,6 +241,10 @@ enum HccAllocTag {
 	HCC_ALLOC_TAG_DATA_TYPE_TABLE_BUFFERS_DEDUP_HASH_TABLE,
 	HCC_ALLOC_TAG_DATA_TYPE_TABLE_ANON_COMPOUND_DEDUP_HASH_TABLE,
 
+	HCC_ALLOC_TAG_LOCATION_TABLE_LOCATIONS,
+	HCC_ALLOC_TAG_LOCATION_TABLE_SPANS,
+	HCC_ALLOC_TAG_LOCATION_TABLE_DECODED_HASH_TABLE,
+
 	HCC_ALLOC_TAG_ATA_TOKEN_BAG_TOKENS,
 	HCC_ALLOC_TAG_ATA_TOKEN_BAG_LOCATIONS,
 	HCC_ALLOC_TAG_ATA_TOKEN_BAG_VALUES,
@@ -251,12 +259,19 @@ enum HccAllocTag {
 	HCC_ALLOC_TAG_AST_FILE_ENUM_DECLARATIONS,
 	HCC_ALLOC_TAG_AST_FILES_HASH_TABLE,
 	HCC_ALLOC_TAG_AST_FILES,
+	HCC_ALLOC_TAG_AST_LINK_DEFERRED_FILES,
 	HCC_ALLOC_TAG_AST_FUNCTION_PARAMS_AND_VARIABLES,
 	HCC_ALLOC_TAG_AST_FUNCTIONS,
 	HCC_ALLOC_TAG_AST_EXPRS,
 	HCC_ALLOC_TAG_AST_GLOBAL_VARIBALES,
 	HCC_ALLOC_TAG_AST_FORWARD_DECLARTIONS,
 	HCC_ALLOC_TAG_AST_DESIGNATED_INITIALIZER_ELMT_INDICES,
+	HCC_ALLOC_TAG_AST_PCHS_HASH_TABLE,
+	HCC_ALLOC_TAG_AST_PCHS,
+	HCC_ALLOC_TAG_AST_PCH_MACROS,
+	HCC_ALLOC_TAG_AST_PCH_MACRO_PARAMS,
+	HCC_ALLOC_TAG_AST_PCH_FILES,
+	HCC_ALLOC_TAG_AST_BINARY_CODE_FILES,
 
 	HCC_ALLOC_TAG_AML_FUNCTION_ALCTOR_NODES_POOL,
 	HCC_ALLOC_TAG_AML_FUNCTION_ALCTOR_WORDS_POOL,
@@ -269,6 +284,7 @@ enum HccAllocTag {
 	HCC_ALLOC_TAG_AML_CALL_GRAPH_NODES,
 	HCC_ALLOC_TAG_AML_OPIMIZE_FUNCTIONS,
 	HCC_ALLOC_TAG_AML_FUNCTION_CALL_NODE_LISTS,
+	HCC_ALLOC_TAG_AML_INLINE_FUNCTIONS,
 
 	HCC_ALLOC_TAG_SPIRV_FUNCTIONS,
 	HCC_ALLOC_TAG_SPIRV_FUNCTION_WORDS,
@@ -284,6 +300,9 @@ enum HccAllocTag {
 	HCC_ALLOC_TAG_SPIRV_NAME_WORDS,
 	HCC_ALLOC_TAG_SPIRV_DECORATE_WORDS,
 	HCC_ALLOC_TAG_SPIRV_DECORATE_BLOCKS,
+	HCC_ALLOC_TAG_SPIRV_ENTRY_POINT_BINARY_WORDS,
+	HCC_ALLOC_TAG_SPIRV_LINK_JOBS,
+	HCC_ALLOC_TAG_SPIRV_FINAL_BINARY_WORDS,
 
 	HCC_ALLOC_TAG_PPGEN_EXPAND_STACK,
 	HCC_ALLOC_TAG_PPGEN_EXPAND_MACRO_IDX_STACK,
@@ -293,6 +312,9 @@ enum HccAllocTag {
 	HCC_ALLOC_TAG_PPGEN_MACRO_ARGS_STACK,
 	HCC_ALLOC_TAG_ATAGEN_PAUSED_FILE_STACK,
 	HCC_ALLOC_TAG_ATAGEN_OPEN_BRACKET_STACK,
+	HCC_ALLOC_TAG_ATAGEN_PCH_RECORD_STACK,
+	HCC_ALLOC_TAG_ATAGEN_PCH_INCLUDED_FILES,
+	HCC_ALLOC_TAG_ATAGEN_PCH_PRAGMA_ONCED_FILES,
 
 	HCC_ALLOC_TAG_ASTGEN_VARIABLE_STACK_STRINGS,
 	HCC_ALLOC_TAG_ASTGEN_VARIABLE_STACK,
@@ -306,7 +328,29 @@ enum HccAllocTag {
 	HCC_ALLOC_TAG_ASTGEN_CURLY_INITIALIZER_NESTED_CURLYS,
 	HCC_ALLOC_TAG_ASTGEN_CURLY_INITIALIZER_NESTED_ELMTS,
 
+	HCC_ALLOC_TAG_AMLOPT_VALUE_REPLACEMENTS,
+	HCC_ALLOC_TAG_AMLOPT_BASIC_BLOCKS,
+	HCC_ALLOC_TAG_AMLOPT_VALUES,
+	HCC_ALLOC_TAG_AMLOPT_BASIC_BLOCK_PREDS,
+	HCC_ALLOC_TAG_AMLOPT_BASIC_BLOCK_ORDER,
+	HCC_ALLOC_TAG_AMLOPT_BASIC_BLOCK_WORK,
+	HCC_ALLOC_TAG_AMLOPT_DOMINANCE_FRONTIERS,
+	HCC_ALLOC_TAG_AMLOPT_ALLOCS,
+	HCC_ALLOC_TAG_AMLOPT_ALLOC_PARAMS,
+	HCC_ALLOC_TAG_AMLOPT_ALLOC_DEF_BASIC_BLOCKS,
+	HCC_ALLOC_TAG_AMLOPT_ALLOC_VALUES,
+	HCC_ALLOC_TAG_AMLOPT_INLINE_SITES,
+	HCC_ALLOC_TAG_AMLOPT_INLINE_CALLEE_MARKS,
+	HCC_ALLOC_TAG_AMLOPT_DOMINATOR_CHILDREN,
+	HCC_ALLOC_TAG_AMLOPT_VALUE_NUMBERS,
+	HCC_ALLOC_TAG_AMLOPT_VALUE_NUMBER_BUCKETS,
+	HCC_ALLOC_TAG_AMLOPT_LOOP_HOISTS,
+	HCC_ALLOC_TAG_AMLOPT_UNROLL_LOOPS,
+	HCC_ALLOC_TAG_AMLOPT_UNROLL_ITER_PARAMS,
+
 	HCC_ALLOC_TAG_SPIRVLINK_WORDS,
+	HCC_ALLOC_TAG_SPIRVLINK_LIVE_FUNCTION_FLAGS,
+	HCC_ALLOC_TAG_SPIRVLINK_LIVE_ID_FLAGS,
 
 	HCC_ALLOC_TAG_COUNT,
 };
@@ -328,13 +372,28 @@ struct HccTrackedMem {
 	uintptr_t   size;
 };
 
+typedef struct HccMemTrackerTagStats HccMemTrackerTagStats;
+struct HccMemTrackerTagStats {
+	uint64_t reserved_size;       // bytes of address space that are reserved right now
+	uint64_t committed_size;      // bytes that are committed right now
+	uint64_t committed_peak_size; // the most bytes that have been committed at once
+	uint32_t reserves_count;      // the number of reservations that have not been released
+};
+
 typedef struct HccMemTrackerIter HccMemTrackerIter;
 
+//
+// iterates over the reservations that have not been released, only one iteration per thread can be in progress at a time
 HccMemTrackerIter* hcc_mem_tracker_iter_start(void);
 void hcc_mem_tracker_iter_finish(HccMemTrackerIter* iter);
-bool hcc_mem_tracker_iter_next(HccMemTrackerIter* iter, HccTrackedMem* out);
+bool hcc_mem_tracker_iter_next(HccMemTrackerIter* iter, HccTrackedMem* out); // returns false when there are no more reservations
 
-void hcc_mem_tracker_log(HccIIO* iio);
+HccMemTrackerTagStats hcc_mem_tracker_tag_stats(HccAllocTag tag);
+
+//
+// logs the memory of each tag, then the arena high-water marks of the compiler's workers and the totals of the task.
+// c and t can be NULL, t must be complete.
+void hcc_mem_tracker_log(HccIIO* iio, HccCompiler* c, HccTask* t);
 
 // ===========================================
 //
@@ -1057,7 +1116,7 @@ enum {
 
 	HCC_FUNCTION_MANY_COUNT,
 };
-#define HCC_FUNCTION_MANY_STRIDE 512
+#define HCC_FUNCTION_MANY_STRIDE 1024
 
 enum {
 	HCC_FUNCTION_IDX_F16TOF32,
@@ -2294,7 +2353,7 @@ void hcc_ata_iter_finish(HccASTFile* file, HccATAIter* iter);
 HccATAToken hcc_ata_iter_next(HccATAIter* iter);
 HccATAToken hcc_ata_iter_peek(HccATAIter* iter);
 HccATAToken hcc_ata_iter_peek_ahead(HccATAIter* iter, uint32_t by);
-HccLocation* hcc_ata_iter_location(HccATAIter* iter);
+HccLocation* hcc_ata_iter_location(HccCU* cu, HccATAIter* iter);
 HccATAValue hcc_ata_iter_next_value(HccATAIter* iter);
 HccATAValue hcc_ata_iter_peek_value(HccATAIter* iter);
 
@@ -2330,7 +2389,7 @@ HccATAIter* hcc_ast_file_get_ata_iter(HccASTFile* file);
 HccStringId* hcc_ast_file_unique_included_files(HccASTFile* file, uint32_t* count_out);
 
 void hcc_ast_file_reset(HccASTFile* file);
-HccResult hcc_ast_file_push_token(HccASTFile* file, HccATAToken token, HccLocation* location);
+HccResult hcc_ast_file_push_token(HccCU* cu, HccASTFile* file, HccATAToken token, HccLocation* location);
 HccResult hcc_ast_file_push_value(HccASTFile* file, HccATAValue value);
 bool hcc_ast_file_pop_token(HccASTFile* file);
 
@@ -2358,6 +2417,10 @@ struct HccASTSetup {
 	uint32_t        forward_declarations_reserve_cap;
 	uint32_t        designated_initializer_elmt_indices_grow_count;
 	uint32_t        designated_initializer_elmt_indices_reserve_cap;
+	uint32_t        pchs_cap;
+	uint32_t        pch_files_grow_count;
+	uint32_t        pch_files_reserve_cap;
+	uint32_t        binary_code_files_cap;
 };
 
 // ===========================================
@@ -2744,6 +2807,23 @@ struct HccAMLInstrIter {
 HccAMLInstrIter hcc_aml_instr_iter(HccDecl decl);
 bool hcc_aml_instr_iter_next(HccAMLInstrIter* iter, uint32_t* instr_word_idx);
 
+// ===========================================
+//
+//
+// Location Table
+//
+//
+// ===========================================
+
+typedef struct HccLocationTableSetup HccLocationTableSetup;
+struct HccLocationTableSetup {
+	uint32_t locations_grow_count;
+	uint32_t locations_reserve_cap;
+	uint32_t spans_grow_count;
+	uint32_t spans_reserve_cap;
+	uint32_t decoded_locations_cap;
+};
+
 // ===========================================
 //
 //
@@ -2764,6 +2844,7 @@ typedef struct HccCUSetup HccCUSetup;
 struct HccCUSetup {
 	HccDataTypeTableSetup dtt;
 	HccConstantTableSetup constant_table;
+	HccLocationTableSetup location_table;
 	HccASTSetup           ast;
 	HccAMLSetup           aml;
 	uint32_t              functions_grow_count;
@@ -2868,6 +2949,7 @@ enum HccOptionKey {
 	HCC_OPTION_KEY_SPIRV_OPT,                   // bool
 	HCC_OPTION_KEY_HLSL_PACKING,                // bool
 	HCC_OPTION_KEY_UNORDERED_SWIZZLING_ENABLED, // bool
+	HCC_OPTION_KEY_OPT_LEVEL,                   // HccOptLevel
 
 	HCC_OPTION_KEY_COUNT,
 };
@@ -2936,6 +3018,37 @@ enum HccWorkerJobType {
 	HCC_WORKER_JOB_TYPE_COUNT,
 };
 
+typedef uint8_t HccAMLOptPass;
+enum HccAMLOptPass {
+	HCC_AML_OPT_PASS_MAKE_CALL_GRAPH,
+	HCC_AML_OPT_PASS_CHECK_FOR_RECURSION,
+	HCC_AML_OPT_PASS_CHECK_FOR_UNSUPPORTED_FEATURES,
+	HCC_AML_OPT_PASS_INLINE,
+	HCC_AML_OPT_PASS_PROMOTE_STATIC_ALLOCS,
+	HCC_AML_OPT_PASS_CONSTANT_FOLD,
+	HCC_AML_OPT_PASS_VALUE_NUMBERING,
+	HCC_AML_OPT_PASS_HOIST_LOOP_INVARIANTS,
+	HCC_AML_OPT_PASS_UNROLL_LOOPS,
+	HCC_AML_OPT_PASS_ELIMINATE_DEAD_CODE,
+
+	HCC_AML_OPT_PASS_COUNT,
+};
+
+//
+// the totals for every function a pass ran on. a pass that appears more than once
+// in the optimization phases is counted for each time it runs on a function.
+typedef struct HccAMLOptPassStats HccAMLOptPassStats;
+struct HccAMLOptPassStats {
+	HccDuration duration; // summed across the workers, so it can be more than the AMLOPT duration
+	uint32_t    runs_count;
+	uint64_t    words_count_before;
+	uint64_t    words_count_after;
+	uint64_t    values_count_before;
+	uint64_t    values_count_after;
+	uint64_t    basic_blocks_count_before;
+	uint64_t    basic_blocks_count_after;
+};
+
 typedef struct HccTaskSetup HccTaskSetup;
 struct HccTaskSetup {
 	HccCUSetup       cu;
@@ -2943,12 +3056,15 @@ struct HccTaskSetup {
 	uint32_t         include_paths_cap;
 	uint32_t         messages_cap;
 	uint32_t         message_strings_cap;
+	uint32_t         ast_binary_grow_size;
+	uint32_t         ast_binary_reserve_size;
 };
 
 typedef struct HccTask HccTask;
 
 extern HccTaskSetup hcc_task_setup_default;
 extern const char* hcc_worker_job_type_strings[HCC_WORKER_JOB_TYPE_COUNT];
+extern const char* hcc_aml_opt_pass_strings[HCC_AML_OPT_PASS_COUNT];
 
 HccResult hcc_task_init(HccTaskSetup* setup, HccTask** t_out);
 void hcc_task_deinit(HccTask* t);
@@ -2957,6 +3073,8 @@ void hcc_task_set_final_worker_job_type(HccTask* t, HccWorkerJobType final_worke
 
 HccResult hcc_task_add_include_path(HccTask* t, HccString path);
 HccResult hcc_task_add_input_code_file(HccTask* t, const char* file_path, HccOptions* options);
+HccResult hcc_task_add_input_ast_binary(HccTask* t, HccIIO* iio); // output of hcc_task_add_output_ast_binary, used instead of ATAGEN, ASTGEN & ASTLINK when none of the inputs have changed
+HccResult hcc_task_add_input_aml_binary(HccTask* t, HccIIO* iio); // output of hcc_task_add_output_aml_binary, the task starts at BACKENDGEN when none of the inputs used before it have changed
 
 HccResult hcc_task_add_output_ast_text(HccTask* t, HccIIO* iio);
 HccResult hcc_task_add_output_ast_binary(HccTask* t, HccIIO* iio);
@@ -2967,6 +3085,7 @@ HccResult hcc_task_add_output_aml_binary(HccTask* t, HccIIO* iio);
 HccResult hcc_task_add_output_aml(HccTask* t, HccAML** aml_out);
 
 HccResult hcc_task_add_output_binary(HccTask* t, HccIIO* iio);
+HccResult hcc_task_add_output_entry_point_binaries(HccTask* t, const char* dir_path); // writes a module for each entry point to 'dir_path/<entry point name>.spirv' with only the functions, globals, types & constants that it uses
 HccResult hcc_task_add_output_metadata_c(HccTask* t, HccIIO* iio);
 HccResult hcc_task_add_output_metadata_json(HccTask* t, HccIIO* iio);
 
@@ -2975,9 +3094,13 @@ bool hcc_task_is_complete(HccTask* t);
 HccResult hcc_task_result(HccTask* t);
 HccMessage* hcc_task_messages(HccTask* t, uint32_t* count_out);
 HccCU* hcc_task_cu(HccTask* t);
+bool hcc_task_has_loaded_ast_binary(HccTask* t); // true if the last dispatch started from the AST binary input
+bool hcc_task_has_loaded_aml_binary(HccTask* t); // true if the last dispatch started from the AML binary input
+void hcc_task_mem_total_sizes(HccTask* t, uint64_t* reserved_total_size_out, uint64_t* committed_total_size_out); // bytes reserved and committed in total for the task by the last dispatch, releases and decommits are not taken away. must be called when the task is complete
 HccResult hcc_task_wait_for_complete(HccTask* t);
 HccDuration hcc_task_duration(HccTask* t); // total duration from when the task started, must be called when the task is complete
 HccDuration hcc_task_worker_job_type_duration(HccTask* t, HccWorkerJobType type); // duration spent on the task by the workers for this job type, must be called when the task is complete
+HccAMLOptPassStats hcc_task_aml_opt_pass_stats(HccTask* t, HccAMLOptPass pass); // time spent and change in size made by an AMLOPT pass over the task's functions, must be called when the task is complete
 
 // ===========================================
 //
@@ -3007,6 +3130,8 @@ struct HccATAGenSetup {
 	uint32_t      paused_file_stack_reserve_cap;
 	uint32_t      open_bracket_stack_grow_count;
 	uint32_t      open_bracket_stack_reserve_cap;
+	uint32_t      pch_files_grow_count;
+	uint32_t      pch_files_reserve_cap;
 };
 
 typedef struct HccASTGenSetup HccASTGenSetup;
@@ -3033,6 +3158,26 @@ struct HccAMLGenSetup {
 	uint32_t placeholder;
 };
 
+typedef struct HccAMLOptSetup HccAMLOptSetup;
+struct HccAMLOptSetup {
+	uint32_t value_replacements_grow_count;
+	uint32_t value_replacements_reserve_cap;
+	uint32_t basic_blocks_grow_count;
+	uint32_t basic_blocks_reserve_cap;
+	uint32_t values_grow_count;
+	uint32_t values_reserve_cap;
+	uint32_t basic_block_edges_grow_count;
+	uint32_t basic_block_edges_reserve_cap;
+	uint32_t allocs_grow_count;
+	uint32_t allocs_reserve_cap;
+	uint32_t alloc_values_grow_count;
+	uint32_t alloc_values_reserve_cap;
+	uint32_t inline_sites_grow_count;
+	uint32_t inline_sites_reserve_cap;
+	uint32_t value_numbers_grow_count;
+	uint32_t value_numbers_reserve_cap;
+};
+
 typedef struct HccBackendLinkSetup HccBackendLinkSetup;
 struct HccBackendLinkSetup {
 	uint32_t binary_grow_size;
@@ -3045,15 +3190,18 @@ struct HccCompilerSetup {
 	HccASTGenSetup      astgen;
 	HccASTLinkSetup     astlink;
 	HccAMLGenSetup      amlgen;
+	HccAMLOptSetup      amlopt;
 	HccBackendLinkSetup backendlink;
 	uint32_t            worker_string_buffer_grow_size;
 	uint32_t            worker_string_buffer_reserve_size;
 	uint32_t            worker_arena_size;
-	uint32_t            workers_count;
+	uint32_t            workers_count; // 0 will use the number of logical cores, both are clamped to HCC_WORKERS_COUNT_MAX
 	uint32_t            worker_jobs_queue_cap;
 	uint32_t            worker_call_stack_size;
 };
 
+#define HCC_WORKERS_COUNT_MAX 256
+
 extern HccCompilerSetup hcc_compiler_setup_default;
 
 HccResult hcc_compiler_init(HccCompilerSetup* setup, HccCompiler** c_out);
@@ -3063,6 +3211,9 @@ HccResult hcc_compiler_wait_for_all_tasks(HccCompiler* c);
 HccResult hcc_compiler_clear_mem_arenas(HccCompiler* c);
 HccDuration hcc_compiler_duration(HccCompiler* c); // total duration from when the compiler started, must be called when the compiler is complete
 HccDuration hcc_compiler_worker_job_type_duration(HccCompiler* c, HccWorkerJobType type); // duration spent on the compiler by the workers for this job type, must be called when the compiler is complete
+HccAMLOptPassStats hcc_compiler_aml_opt_pass_stats(HccCompiler* c, HccAMLOptPass pass); // time spent and change in size made by an AMLOPT pass over every task's functions, must be called when the compiler is complete
+uint32_t hcc_compiler_workers_count(HccCompiler* c);
+uint64_t hcc_compiler_worker_arena_high_water_size(HccCompiler* c, uint32_t worker_idx); // the most bytes the worker's arena has held at once, must be called when the compiler is complete
 
 // ===========================================
 //
@@ -3103,6 +3254,18 @@ HccString hcc_code_file_code(HccCodeFile* code_file);
 uint32_t hcc_code_file_line_size(HccCodeFile* code_file, uint32_t line);
 uint32_t hcc_code_file_lines_count(HccCodeFile* code_file);
 
+//
+// code files are kept between compiles and are only reloaded when their size, modified time
+// or contents change on disk. these counters are accumulated since hcc_init or the last hcc_clear_code_files.
+typedef struct HccCodeFileCacheStats HccCodeFileCacheStats;
+struct HccCodeFileCacheStats {
+	uint32_t hits_count;        // code files that were reused from a previous compile
+	uint32_t misses_count;      // code files that had to be loaded from disk
+	uint32_t invalidated_count; // code files that were thrown away as they changed on disk
+};
+
+HccCodeFileCacheStats hcc_code_file_cache_stats(void);
+
 // ===========================================
 //
 //
@@ -3144,6 +3307,17 @@ enum HccFlags {
 typedef uint32_t (*HccPathCanonicalizeFn)(const char* path, char* out_buf);
 typedef bool (*HccFileOpenReadFn)(const char* path, HccIIO* out);
 
+typedef struct HccFileStat HccFileStat;
+struct HccFileStat {
+	uint64_t size;
+	HccTime  modified_time;
+};
+
+//
+// used to check whether a cached code file has changed on disk.
+// when this is NULL or it fails, the file contents are reread and hashed instead.
+typedef bool (*HccFileStatFn)(const char* path, HccFileStat* out);
+
 typedef struct HccSetup HccSetup;
 struct HccSetup {
 	HccFlags               flags;
@@ -3151,6 +3325,7 @@ struct HccSetup {
 	HccAllocEventFn        alloc_event_fn;
 	HccPathCanonicalizeFn  path_canonicalize_fn;
 	HccFileOpenReadFn      file_open_read_fn;
+	HccFileStatFn          file_stat_fn;
 	void*                  alloc_event_userdata;
 	uint32_t               string_table_data_grow_count;
 	uint32_t               string_table_data_reserve_cap;
@@ -21,6 +21,7 @@
 #include <hcc_shader.h>
 
 typedef struct HccWorker HccWorker;
+typedef struct HccPCH HccPCH;
 
 // ===========================================
 //
@@ -208,6 +209,7 @@ char* hcc_file_read_all_the_codes(const char* path, uint64_t* size_out);
 void hcc_stacktrace(uint32_t ignore_levels_count, char* buf, uint32_t buf_size);
 bool hcc_file_open_read(const char* path, HccIIO* out);
 bool hcc_file_open_write(const char* path, HccIIO* out);
+bool hcc_file_stat(const char* path, HccFileStat* out);
 bool hcc_path_is_relative(const char* path);
 bool hcc_path_exists(const char* path);
 bool hcc_path_is_file(const char* path);
@@ -216,8 +218,19 @@ bool hcc_make_directory(const char* path);
 HccString hcc_path_replace_file_name(HccString parent, HccString file_name);
 uint32_t hcc_logical_cores_count(void);
 int hcc_execute_shell_command(const char* shell_command);
+bool hcc_executable_is_in_path(const char* file_name);
 void hcc_register_segfault_handler(void);
 
+//
+// a stream socket that is addressed by a path on the local machine, only implemented on Linux for now
+typedef intptr_t HccLocalSocket;
+bool hcc_local_socket_listen(const char* path, HccLocalSocket* out); // replaces any stale socket file at the path
+bool hcc_local_socket_accept(HccLocalSocket listener, HccLocalSocket* out);
+bool hcc_local_socket_connect(const char* path, HccLocalSocket* out);
+bool hcc_local_socket_send(HccLocalSocket s, const void* data, uintptr_t size); // sends all of the data
+bool hcc_local_socket_recv(HccLocalSocket s, void* data_out, uintptr_t size); // receives exactly size bytes, false if the other end closes first
+void hcc_local_socket_close(HccLocalSocket s);
+
 // ===========================================
 //
 //
@@ -253,8 +266,8 @@ void hcc_register_segfault_handler(void);
 #define HCC_ZERO_ARRAY(array) memset(array, 0, sizeof(array))
 #define HCC_ONE_ARRAY(array) memset(array, 0xff, sizeof(array))
 #define HCC_COPY_ARRAY(dst, src) memcpy(dst, src, sizeof(dst))
-#define HCC_COPY_ELMT_MANY(dst, src, elmts_count) memcpy(dst, src, elmts_count * sizeof(*(dst)))
-#define HCC_COPY_OVERLAP_ELMT_MANY(dst, src, elmts_count) memmove(dst, src, elmts_count * sizeof(*(dst)))
+#define HCC_COPY_ELMT_MANY(dst, src, elmts_count) memcpy(dst, src, (elmts_count) * sizeof(*(dst)))
+#define HCC_COPY_OVERLAP_ELMT_MANY(dst, src, elmts_count) memmove(dst, src, (elmts_count) * sizeof(*(dst)))
 #define HCC_CMP_ARRAY(a, b) (memcmp(a, b, sizeof(a)) == 0)
 #define HCC_CMP_ELMT(a, b) (memcmp(a, b, sizeof(*(a))) == 0)
 #define HCC_CMP_ELMT_MANY(a, b, elmts_count) (memcmp(a, b, elmts_count * sizeof(*(a))) == 0)
@@ -421,9 +434,54 @@ void hcc_mutex_unlock(HccMutex* mutex);
 //
 // ===========================================
 
+//
+// the tracker only counts with atomics, it never takes a lock.
+// every reservation gets a slot in a fixed size array so it can be iterated over and
+// so the bytes committed inside of it can be taken away from its tag when it is released.
+#define HCC_MEM_TRACKER_RESERVATIONS_CAP 65536
+
+//
+// a reservation's addr while the rest of its slot is being filled in
+#define HCC_MEM_TRACKER_ADDR_CLAIMED ((uintptr_t)1)
+
+typedef struct HccMemTrackerReservation HccMemTrackerReservation;
+struct HccMemTrackerReservation {
+	HccAtomic(uintptr_t) addr; // 0 when the slot is free
+	uintptr_t            size;
+	HccAtomic(uintptr_t) committed_size;
+	HccAllocTag          tag;
+};
+
+typedef struct HccMemTrackerTag HccMemTrackerTag;
+struct HccMemTrackerTag {
+	HccAtomic(uint64_t) reserved_size;
+	HccAtomic(uint64_t) committed_size;
+	HccAtomic(uint64_t) committed_peak_size;
+	HccAtomic(uint32_t) reserves_count;
+};
+
+typedef struct HccMemTracker HccMemTracker;
+struct HccMemTracker {
+	HccMemTrackerTag          tags[HCC_ALLOC_TAG_COUNT];
+	HccMemTrackerReservation* reservations;
+	HccAtomic(uint32_t)       reservations_end_idx; // every slot past this has never been used
+	HccAtomic(uint32_t)       untracked_reserves_count; // reserves that did not fit in the reservations array
+	HccAtomic(uint64_t)       committed_size;
+	HccAtomic(uint64_t)       committed_peak_size;
+};
+
+struct HccMemTrackerIter {
+	uint32_t idx;
+	bool     is_active;
+};
+
 void hcc_mem_tracker_init(void);
 void hcc_mem_tracker_deinit(void);
 void hcc_mem_tracker_update(HccAllocMode mode, HccAllocTag tag, void* addr, uintptr_t size);
+void hcc_mem_tracker_commit(HccAllocTag tag, void* addr, uintptr_t size);
+void hcc_mem_tracker_decommit(HccAllocTag tag, void* addr, uintptr_t size);
+HccMemTrackerReservation* hcc_mem_tracker_find_reservation(void* addr);
+void hcc_mem_tracker_add_committed_size(HccAllocTag tag, int64_t size);
 
 // ===========================================
 //
@@ -445,6 +503,7 @@ struct HccArenaAlctor {
 	HccAtomic(HccArenaHeader*) arena;
 	HccAtomic(bool) alloc_arena_sync_point;
 	HccAllocTag     tag;
+	uint64_t        high_water_size; // the most bytes the arenas have held before the last reset
 };
 
 HccArenaHeader* hcc_arena_alloc(HccAllocTag tag, uint32_t arena_size);
@@ -453,6 +512,8 @@ void hcc_arena_alctor_deinit(HccArenaAlctor* alctor);
 void* hcc_arena_alctor_alloc(HccArenaAlctor* alctor, uint32_t size, uint32_t align);
 void* hcc_arena_alctor_alloc_thread_safe(HccArenaAlctor* alctor, uint32_t size, uint32_t align);
 void hcc_arena_alctor_reset(HccArenaAlctor* alctor);
+uint64_t hcc_arena_alctor_used_size(HccArenaAlctor* alctor);
+uint64_t hcc_arena_alctor_high_water_size(HccArenaAlctor* alctor);
 #define HCC_ARENA_ALCTOR_ALLOC_ELMT(T, alctor) hcc_arena_alctor_alloc(alctor, sizeof(T), alignof(T))
 #define HCC_ARENA_ALCTOR_ALLOC_ARRAY(T, alctor, count) hcc_arena_alctor_alloc(alctor, sizeof(T) * count, alignof(T))
 #define HCC_ARENA_ALCTOR_ALLOC_ELMT_THREAD_SAFE(T, alctor) hcc_arena_alctor_alloc_thread_safe(alctor, sizeof(T), alignof(T))
@@ -699,25 +760,42 @@ typedef uint64_t HccHash64;
 typedef uintptr_t HccHash;
 
 #define HCC_HASH_FNV_32_INIT 0x811c9dc5
-#define HCC_HASH_FNV_64_INIT 0xcbf29ce484222325
 
 typedef HccHash32 (*HccHash32Fn)(void* data, HccHash32 hash);
 typedef HccHash64 (*HccHash64Fn)(void* data, HccHash64 hash);
 
+#define HCC_HASH_WY_32_INIT 0
+#define HCC_HASH_WY_64_INIT 0
+
 #if UINTPTR_MAX == 0xFFFFFFFF
 #define HccHashFn HccHash32Fn
-#define hcc_hash_fnv hcc_hash_fnv_32
-#define HCC_HASH_FNV_INIT HCC_HASH_FNV_32_INIT
+#define hcc_hash_wy hcc_hash_wy_32
+#define HCC_HASH_WY_INIT HCC_HASH_WY_32_INIT
 #elif UINTPTR_MAX == 0xFFFFFFFFFFFFFFFFu
 #define HccHashFn HccHash64Fn
-#define hcc_hash_fnv hcc_hash_fnv_64
-#define HCC_HASH_FNV_INIT HCC_HASH_FNV_64_INIT
+#define hcc_hash_wy hcc_hash_wy_64
+#define HCC_HASH_WY_INIT HCC_HASH_WY_64_INIT
 #else
 #error "unsupported platform"
 #endif
 
+//
+// FNV-1a goes a byte at a time, it is only used for the hcc_pp_directive_hashes table.
+// everything else uses hcc_hash_wy as it goes 8 bytes at a time.
 HccHash32 hcc_hash_fnv_32(const void* data, uintptr_t size, HccHash32 hash);
-HccHash64 hcc_hash_fnv_64(const void* data, uintptr_t size, HccHash64 hash);
+
+extern const uint64_t hcc_hash_wy_secret[4];
+
+void hcc_hash_wy_mum(uint64_t* a, uint64_t* b);
+uint64_t hcc_hash_wy_mix(uint64_t a, uint64_t b);
+uint64_t hcc_hash_wy_read_8(const uint8_t* bytes);
+uint64_t hcc_hash_wy_read_4(const uint8_t* bytes);
+HccHash32 hcc_hash_wy_32(const void* data, uintptr_t size, HccHash32 hash);
+HccHash64 hcc_hash_wy_64(const void* data, uintptr_t size, HccHash64 hash);
+
+//
+// a fast path for hashing a single integer, used by the integer key hash tables
+HccHash64 hcc_hash_wy_u64(uint64_t v);
 
 void hcc_generate_enum_hashes(char* array_name, char** strings, char** enum_strings, uint32_t enums_count);
 void hcc_generate_hashes(void);
@@ -899,6 +977,23 @@ void _hcc_deque_pop_back_many(HccDeque(void) deque, uintptr_t amount, uintptr_t
 
 #define HCC_HASH_TABLE_MAGIC_NUMBER 0x0b7ec7b7
 
+//
+// a hash table grows by opening a new level that is double the size of the last one.
+// the levels sit one after the other in the same virtual memory reservation, so the
+// entries never move and the index of an entry is stable for the lifetime of the table.
+// so an index can be used as an identifier and other threads can keep using their entry pointers.
+// only the last level is inserted into, the older levels are searched first to find existing keys.
+#if UINTPTR_MAX == 0xFFFFFFFF
+#define HCC_HASH_TABLE_LEVELS_MAX 4
+#elif UINTPTR_MAX == 0xFFFFFFFFFFFFFFFFu
+#define HCC_HASH_TABLE_LEVELS_MAX 6
+#endif
+
+//
+// the initial capacity of a table that can still hold at least cap entries once all of its levels are open.
+// the compilation unit wide tables are sized from the setup with this, so they do not reserve and commit all of it up front.
+#define HCC_HASH_TABLE_INITIAL_CAP_FOR(cap) HCC_MAX((uintptr_t)(cap) >> (HCC_HASH_TABLE_LEVELS_MAX - 1), 64)
+
 typedef bool (*HccHashTableKeyCmpFn)(void* a, void* b, uintptr_t size);
 typedef HccHash (*HccHashTableKeyHashFn)(void* key, uintptr_t size);
 
@@ -906,7 +1001,11 @@ typedef struct HccHashTableHeader HccHashTableHeader;
 struct HccHashTableHeader {
 	alignas(hcc_max_align_t)
 	HccAtomic(uintptr_t) count;
-	uintptr_t            cap;
+	HccAtomic(uintptr_t) cap;          // the capacity of all of the levels that are open
+	HccAtomic(uint32_t)  levels_count; // see HCC_HASH_TABLE_LEVELS_MAX
+	uint32_t             committed_levels_count; // the levels that have been committed, they stay committed when the table is cleared
+	uintptr_t            initial_cap;  // the capacity of the first level, each level after is double the size of the one before it
+	HccSpinMutex         levels_mutex;
 	HccHashTableKeyCmpFn  key_cmp_fn;
 	HccHashTableKeyHashFn key_hash_fn;
 	HccAtomic(HccHash)*  hashes;
@@ -923,6 +1022,16 @@ struct HccHashTableInsert {
 	bool is_new;
 };
 
+//
+// a bit per entry in a bucket, the lowest bit is the first entry.
+typedef struct HccHashTableBucketMasks HccHashTableBucketMasks;
+struct HccHashTableBucketMasks {
+	uint32_t match;     // the entries that have the hash we are looking for
+	uint32_t empty;
+	uint32_t tombstone;
+	uint32_t inserting;
+};
+
 typedef struct HccNameToIdxEntry HccNameToIdxEntry;
 struct HccNameToIdxEntry {
 	HccString key;
@@ -934,6 +1043,8 @@ struct HccNameToIdxEntry {
 #define hcc_hash_table_header(table) ((table) ? (((HccHashTableHeader*)(table)) - 1) : NULL)
 #define hcc_hash_table_count(table)  ((table) ? hcc_hash_table_header(table)->count  : 0)
 #define hcc_hash_table_cap(table)    ((table) ? hcc_hash_table_header(table)->cap    : 0)
+#define hcc_hash_table_initial_cap(table) ((table) ? hcc_hash_table_header(table)->initial_cap : 0)
+#define hcc_hash_table_reserve_cap(table) ((table) ? hcc_hash_table_header(table)->initial_cap * (((uintptr_t)1 << HCC_HASH_TABLE_LEVELS_MAX) - 1) : 0)
 
 #if HCC_ENABLE_DEBUG_ASSERTIONS
 #define hcc_hash_table_get(table, idx) (&(table)[_HCC_ASSERT_ARRAY_BOUNDS(idx, hcc_hash_table_cap(table))])
@@ -944,6 +1055,9 @@ struct HccNameToIdxEntry {
 #define hcc_hash_table_init(KVEntry, tag, key_cmp_fn, key_hash_fn, cap) _hcc_hash_table_init(tag, key_cmp_fn, key_hash_fn, cap, sizeof(KVEntry))
 HccHashTable(void) _hcc_hash_table_init(HccAllocTag tag, HccHashTableKeyCmpFn key_cmp_fn, HccHashTableKeyHashFn key_hash_fn, uintptr_t cap, uintptr_t elmt_size);
 
+uintptr_t _hcc_hash_table_reserve_size(uintptr_t initial_cap, uintptr_t elmt_size, uintptr_t* hashes_offset_out);
+void _hcc_hash_table_open_level(HccHashTableHeader* header, uint32_t levels_count, uintptr_t elmt_size);
+
 #define hcc_hash_table_deinit(table) _hcc_hash_table_deinit(table, sizeof(*(table)))
 void _hcc_hash_table_deinit(HccHashTable(void) table, uintptr_t elmt_size);
 
@@ -959,6 +1073,15 @@ HccHashTableInsert _hcc_hash_table_find_insert_idx(HccHashTable(void) table, voi
 #define hcc_hash_table_remove(table, key) _hcc_hash_table_remove(table, key, sizeof(*(key)), sizeof(*(table)))
 bool _hcc_hash_table_remove(HccHashTable(void) table, void* key, uintptr_t key_size, uintptr_t elmt_size);
 
+//
+// places the key in a specific empty slot, used to restore tables where the slot index is the identifier.
+#define hcc_hash_table_insert_at_idx(table, idx, key) _hcc_hash_table_insert_at_idx(table, idx, key, sizeof(*(key)), sizeof(*(table)))
+void _hcc_hash_table_insert_at_idx(HccHashTable(void) table, uintptr_t idx, void* key, uintptr_t key_size, uintptr_t elmt_size);
+
+//
+// compares every hash in the bucket at once, using AVX2 or SSE2 when they are available.
+HccHashTableBucketMasks hcc_hash_table_bucket_masks(HccAtomic(HccHash)* bucket, HccHash hash);
+
 bool hcc_u32_key_cmp(void* a, void* b, uintptr_t size);
 bool hcc_u64_key_cmp(void* a, void* b, uintptr_t size);
 
@@ -1618,6 +1741,75 @@ struct HccATATokenCursor {
 
 uint32_t hcc_ata_token_cursor_tokens_count(HccATATokenCursor* cursor);
 
+// ===========================================
+//
+//
+// Location Table
+//
+//
+// ===========================================
+
+//
+// a 32 bit handle to a HccLocation that the token bags and the AML store for every token and instruction.
+// a token that comes straight from a code file is stored as an offset into a HccLocationSpan, it gets decoded
+// back into a HccLocation only when it is needed by using the code of the file, see hcc_location_table_decode.
+// every other location (macro expansions, merged ranges) is stored in full and the handle is its index.
+typedef uint32_t HccLocationId;
+#define HCC_LOCATION_ID_NULL       0
+#define HCC_LOCATION_ID_FULL_BIT   0x80000000 // when set, the value is an index into HccLocationTable.locations
+#define HCC_LOCATION_ID_PP_BIT     0x40000000 // free for the preprocessor to tag tokens with, see HCC_PP_TOKEN_IS_PREEXPANDED_MACRO_ARG
+#define HCC_LOCATION_ID_VALUE_MASK 0x3fffffff
+
+//
+// a run of tokens from a code file that all share the same #line remapping.
+// the location id of a token is the offset_start of the span + the code_start_idx of the token.
+typedef struct HccLocationSpan HccLocationSpan;
+struct HccLocationSpan {
+	HccCodeFile* code_file;
+	HccString    display_path;
+	uint32_t     offset_start;
+	uint32_t     custom_line_dst;
+	uint32_t     custom_line_src;
+};
+
+//
+// maps an offset location id to the full location it was decoded into by hcc_location_table_get,
+// so asking for the same token again does not allocate another HccLocation.
+typedef struct HccLocationDecodedEntry HccLocationDecodedEntry;
+struct HccLocationDecodedEntry {
+	HccLocationId            offset_location_id;
+	HccAtomic(HccLocationId) location_id; // HCC_LOCATION_ID_NULL while the thread that inserted the entry is decoding it
+};
+
+typedef struct HccLocationTable HccLocationTable;
+struct HccLocationTable {
+	HccStack(HccLocation)     locations;
+	HccStack(HccLocationSpan) spans;       // sorted by offset_start
+	HccAtomic(uint32_t)       spans_count; // only counts the spans that are fully written, so it is safe to search without locking
+	uint32_t                  next_offset;
+	HccSpinMutex              spans_mutex;
+	HccHashTable(HccLocationDecodedEntry) decoded_hash_table;
+};
+
+//
+// remembers the span and line of the last decode, tokens are mostly decoded in order
+// so the next one will usually be on the same line and this skips the searches.
+typedef struct HccLocationDecodeCache HccLocationDecodeCache;
+struct HccLocationDecodeCache {
+	HccLocationSpan* span;
+	uint32_t         line;
+	uint32_t         line_code_start_idx;
+	uint32_t         line_code_end_idx;
+};
+
+void hcc_location_table_init(HccCU* cu, HccLocationTableSetup* setup);
+void hcc_location_table_deinit(HccCU* cu);
+HccLocation* hcc_location_table_alloc(HccCU* cu);
+uint32_t hcc_location_table_add_span(HccCU* cu, HccCodeFile* code_file, HccString display_path, uint32_t custom_line_dst, uint32_t custom_line_src);
+HccLocationId hcc_location_table_id(HccCU* cu, HccLocation* location);
+HccLocation* hcc_location_table_get(HccCU* cu, HccLocationId location_id);
+void hcc_location_table_decode(HccCU* cu, HccLocationId location_id, HccLocation* location_out, HccLocationDecodeCache* cache);
+
 // ===========================================
 //
 //
@@ -1626,23 +1818,25 @@ uint32_t hcc_ata_token_cursor_tokens_count(HccATATokenCursor* cursor);
 //
 // ===========================================
 
-#define HCC_PP_TOKEN_IS_PREEXPANDED_MACRO_ARG(location) (((uintptr_t)location) & 0x1)
-#define HCC_PP_TOKEN_SET_PREEXPANDED_MACRO_ARG(location) ((HccLocation*)(((uintptr_t)location) | 0x1))
-#define HCC_PP_TOKEN_STRIP_PREEXPANDED_MACRO_ARG(location) ((HccLocation*)(((uintptr_t)location) & ~(uintptr_t)0x1))
+#define HCC_PP_TOKEN_IS_PREEXPANDED_MACRO_ARG(location_id) ((location_id) & HCC_LOCATION_ID_PP_BIT)
+#define HCC_PP_TOKEN_SET_PREEXPANDED_MACRO_ARG(location_id) ((location_id) | HCC_LOCATION_ID_PP_BIT)
+#define HCC_PP_TOKEN_STRIP_PREEXPANDED_MACRO_ARG(location_id) ((location_id) & ~HCC_LOCATION_ID_PP_BIT)
 
 typedef struct HccATATokenBag HccATATokenBag;
 struct HccATATokenBag {
-	HccStack(HccATAToken)  tokens;
-	HccStack(HccLocation*) locations;
-	HccStack(HccATAValue)  values;
+	HccStack(HccATAToken)   tokens;
+	HccStack(HccLocationId) locations;
+	HccStack(HccATAValue)   values;
 };
 
 void hcc_ata_token_bag_init(HccATATokenBag* bag, uint32_t tokens_grow_count, uint32_t tokens_reserve_cap, uint32_t values_grow_count, uint32_t values_reserve_cap);
 void hcc_ata_token_bag_deinit(HccATATokenBag* bag);
 void hcc_ata_token_bag_reset(HccATATokenBag* bag);
-void hcc_ata_token_bag_push_token(HccATATokenBag* bag, HccATAToken token, HccLocation* location);
+void hcc_ata_token_bag_push_token(HccATATokenBag* bag, HccATAToken token, HccLocationId location_id);
 void hcc_ata_token_bag_push_value(HccATATokenBag* bag, HccATAValue value);
 bool hcc_ata_token_bag_pop_token(HccATATokenBag* bag);
+void hcc_ata_token_bag_push_range(HccATATokenBag* dst_bag, HccATATokenBag* src_bag, uint32_t tokens_start_idx, uint32_t tokens_count, uint32_t values_start_idx, uint32_t values_count);
+uint32_t hcc_ata_tokens_values_count(HccATAToken* tokens, uint32_t tokens_count);
 uint32_t hcc_ata_token_bag_stringify_single(HccATATokenBag* bag, HccATATokenCursor* cursor, HccPPMacro* macro, char* outbuf, uint32_t outbufsize);
 HccATAToken hcc_ata_token_bag_stringify_single_or_macro_param(HccWorker* w, HccATATokenBag* bag, HccATATokenCursor* cursor, uint32_t args_start_idx, HccATATokenBag* args_src_bag, bool false_before_true_after, char* outbuf, uint32_t outbufsize, uint32_t* outbufidx_out);
 HccStringId hcc_ata_token_bag_stringify_range(HccATATokenBag* bag, HccATATokenCursor* cursor, HccPPMacro* macro, char* outbuf, uint32_t outbufsize, uint32_t* outbufidx_out);
@@ -1747,15 +1941,20 @@ extern uint32_t hcc_pp_directive_hashes[HCC_PP_DIRECTIVE_COUNT];
 
 typedef struct HccATAIter HccATAIter;
 struct HccATAIter {
-	HccATAToken*  tokens;
-	HccLocation** locations;
-	HccATAValue*  values;
+	HccATAToken*   tokens;
+	HccLocationId* locations;
+	HccATAValue*   values;
+	HccLocationDecodeCache location_decode_cache;
 	uint32_t      token_idx;
 	uint32_t      value_idx;
 	uint32_t      tokens_count;
 	uint32_t      values_count;
 };
 
+//
+// same as hcc_ata_iter_location but the location is allocated from the worker's chunk when w is not NULL
+HccLocation* hcc_ata_iter_worker_location(HccCU* cu, HccWorker* w, HccATAIter* iter);
+
 // ===========================================
 //
 //
@@ -1779,10 +1978,17 @@ struct HccCodeFile {
 	HccString                   code;
 	HccStack(uint32_t)          line_code_start_indices;
 	HccStack(HccPPIfSpan)       pp_if_spans;
+	HccFileStat                 stat;
+	HccHash64                   code_hash;
+	uint32_t                    loaded_generation;
+	HccAtomic(uint32_t)         used_generation;
 };
 
 HccResult hcc_code_file_init(HccCodeFile* code_file, HccString path_string, bool do_not_open_file);
 void hcc_code_file_deinit(HccCodeFile* code_file);
+bool hcc_code_file_is_up_to_date(HccCodeFile* code_file);
+void hcc_code_files_revalidate(void);
+uint32_t hcc_code_file_line_at(HccCodeFile* code_file, uint32_t code_idx, uint32_t* line_code_start_idx_out);
 
 // ===========================================
 //
@@ -1817,6 +2023,7 @@ struct HccPPGen {
 	HccStack(HccPPGenIf)                 if_stack;
 	HccHashTable(HccPPGenMacroDeclEntry) macro_declarations;
 	HccStack(HccPPMacroArg)              macro_args_stack;
+	HccHash64                            macro_set_hash; // the sum of hcc_ppgen_macro_hash for every macro in macro_declarations
 };
 
 typedef uint8_t HccPPExpandFlags;
@@ -1835,6 +2042,7 @@ struct HccPPEval {
 void hcc_ppgen_init(HccWorker* w, HccPPGenSetup* setup);
 void hcc_ppgen_deinit(HccWorker* w);
 void hcc_ppgen_reset(HccWorker* w);
+HccHash64 hcc_ppgen_macro_hash(HccWorker* w, HccStringId identifier_string_id, uint32_t macro_idx);
 
 HccPPIfSpan* hcc_ppgen_if_span_get(HccWorker* w, uint32_t if_span_id);
 uint32_t hcc_ppgen_if_span_id(HccWorker* w, HccPPIfSpan* if_span);
@@ -1873,7 +2081,7 @@ void hcc_ppgen_copy_expand_range(HccWorker* w, HccPPExpand* expand, HccATATokenB
 void hcc_ppgen_copy_expand_macro(HccWorker* w, HccPPMacro* macro, HccLocation* macro_callsite_location, HccLocation* parent_location, HccPPExpand* arg_expand, HccATATokenBag* args_src_bag, HccATATokenBag* dst_bag, HccATATokenBag* alt_dst_bag, HccPPExpandFlags flags);
 uint32_t hcc_ppgen_process_macro_args(HccWorker* w, HccPPMacro* macro, HccPPExpand* expand, HccATATokenBag* src_bag, HccLocation* parent_location);
 HccPPMacroArg* hcc_ppgen_push_macro_arg(HccWorker* w, HccPPExpand* expand, HccATATokenBag* src_bag, HccLocation* parent_location);
-void hcc_ppgen_finalize_macro_arg(HccPPMacroArg* arg, HccPPExpand* expand, HccATATokenBag* src_bag);
+void hcc_ppgen_finalize_macro_arg(HccWorker* w, HccPPMacroArg* arg, HccPPExpand* expand, HccATATokenBag* src_bag);
 void hcc_ppgen_attach_to_most_parent(HccWorker* w, HccLocation* location, HccLocation* parent_location);
 
 // ===========================================
@@ -1886,8 +2094,8 @@ void hcc_ppgen_attach_to_most_parent(HccWorker* w, HccLocation* location, HccLoc
 
 typedef struct HccATAOpenBracket HccATAOpenBracket;
 struct HccATAOpenBracket {
-	HccATAToken close_token;
-	HccLocation* open_token_location;
+	HccATAToken   close_token;
+	HccLocationId open_token_location_id;
 };
 
 typedef uint8_t HccATAGenRunMode;
@@ -1906,9 +2114,27 @@ struct HccATAPausedFile {
 	bool        we_are_mutator_of_code_file;
 	uint32_t    pp_if_span_id;
 	uint32_t    if_stack_count;
+	uint32_t    location_span_idx;
 	HccLocation location;
 };
 
+//
+// the state of a system header that is being preprocessed for the first time with the current macro set.
+// when the header's file is popped off the paused file stack, the tokens & macros it generated are stored as a HccPCH.
+typedef struct HccATAPCHRecord HccATAPCHRecord;
+struct HccATAPCHRecord {
+	HccHash64   key;
+	HccStringId path_string_id;
+	uint32_t    paused_files_count; // the paused file stack count straight after the header was entered
+	uint32_t    tokens_start_idx;
+	uint32_t    values_start_idx;
+	uint32_t    macros_start_idx;
+	uint32_t    included_files_start_idx;
+	uint32_t    pragma_onced_files_start_idx;
+	uint32_t    open_brackets_count;
+	bool        is_invalid; // the header did something that depends on more than the macro set. eg. #undef a macro from outside or __COUNTER__
+};
+
 typedef struct HccATAGen HccATAGen;
 struct HccATAGen {
 	HccPPGen                 ppgen;
@@ -1918,6 +2144,9 @@ struct HccATAGen {
 	HccATATokenBag*             dst_token_bag;
 	HccStack(HccATAPausedFile)  paused_file_stack;
 	HccStack(HccATAOpenBracket) open_bracket_stack;
+	HccStack(HccATAPCHRecord)   pch_record_stack;
+	HccStack(HccStringId)       pch_included_files;     // files found included while a PCH is being recorded
+	HccStack(HccStringId)       pch_pragma_onced_files; // files that are #pragma once'd while a PCH is being recorded
 	bool                        we_are_mutator_of_code_file; // this is true when this is the first thread to start parsing the code file.
 
 	//
@@ -1934,6 +2163,7 @@ struct HccATAGen {
 	uint32_t                 pp_if_span_id;
 	uint32_t                 custom_line_dst;
 	uint32_t                 custom_line_src;
+	uint32_t                 location_span_idx; // the span in the location table that the tokens of location.code_file go in, UINT32_MAX if there is none yet
 
 	int32_t                  __counter__;
 };
@@ -1944,6 +2174,8 @@ void hcc_atagen_reset(HccWorker* w);
 void hcc_atagen_generate(HccWorker* w);
 
 HccLocation* hcc_atagen_make_location(HccWorker* w);
+HccLocationId hcc_atagen_make_location_id(HccWorker* w);
+uint32_t hcc_atagen_token_code_size(HccString code, uint32_t code_idx);
 void hcc_atagen_advance_column(HccWorker* w, uint32_t by);
 void hcc_atagen_advance_newline(HccWorker* w);
 uint32_t hcc_atagen_display_line(HccWorker* w);
@@ -1954,6 +2186,15 @@ _Noreturn void hcc_atagen_bail_error_1(HccWorker* w, HccErrorCode error_code, ..
 _Noreturn void hcc_atagen_bail_error_2(HccWorker* w, HccErrorCode error_code, HccLocation* token_location, HccLocation* other_token_location, ...);
 void hcc_atagen_paused_file_push(HccWorker* w);
 void hcc_atagen_paused_file_pop(HccWorker* w);
+void hcc_atagen_found_included_file(HccWorker* w, HccStringId path_string_id);
+void hcc_atagen_set_pragma_onced(HccWorker* w, HccStringId path_string_id);
+HccHash64 hcc_atagen_pch_key(HccWorker* w, HccStringId path_string_id);
+bool hcc_atagen_pch_splice(HccWorker* w, HccHash64 key);
+bool hcc_atagen_pch_has_code_file(HccWorker* w, HccPCH* pch, HccCodeFile* code_file);
+HccLocation* hcc_atagen_pch_reparent_location(HccWorker* w, HccPCH* pch, HccLocation* location);
+void hcc_atagen_pch_record_begin(HccWorker* w, HccHash64 key, HccStringId path_string_id);
+void hcc_atagen_pch_record_end(HccWorker* w);
+void hcc_atagen_pch_invalidate_records(HccWorker* w, uint32_t macro_idx);
 void hcc_atagen_location_setup_new_file(HccWorker* w, HccCodeFile* code_file);
 bool hcc_atagen_is_last_token_string(HccATATokenBag* bag);
 void hcc_atagen_token_merge_append_string(HccWorker* w, HccATATokenBag* bag, HccString append_string);
@@ -1971,7 +2212,7 @@ void hcc_atagen_parse_string(HccWorker* w, char terminator_byte, bool ignore_esc
 uint32_t hcc_atagen_find_macro_param(HccWorker* w, HccStringId ident_string_id);
 void hcc_atagen_consume_hash_for_define_replacement_list(HccWorker* w);
 bool hcc_atagen_is_first_non_whitespace_on_line(HccWorker* w);
-void hcc_atagen_bracket_open(HccWorker* w, HccATAToken token, HccLocation* location);
+void hcc_atagen_bracket_open(HccWorker* w, HccATAToken token, HccLocationId location_id);
 void hcc_atagen_bracket_close(HccWorker* w, HccATAToken token, HccLocation* location);
 void hcc_atagen_run(HccWorker* w, HccATATokenBag* dst_token_bag, HccATAGenRunMode run_mode);
 
@@ -1983,6 +2224,13 @@ void hcc_atagen_run(HccWorker* w, HccATATokenBag* dst_token_bag, HccATAGenRunMod
 //
 // ===========================================
 
+//
+// the declaration tables of a file start off at these sizes and grow when they need to.
+// most files only declare a small amount compared to the whole compilation unit.
+#define HCC_AST_FILE_GLOBAL_DECLARATIONS_INITIAL_CAP 4096
+#define HCC_AST_FILE_COMPOUND_DECLARATIONS_INITIAL_CAP 1024
+#define HCC_AST_FILE_ENUM_DECLARATIONS_INITIAL_CAP 1024
+
 typedef struct HccDeclEntry HccDeclEntry;
 struct HccDeclEntry {
 	HccStringId       string_id;
@@ -2031,6 +2279,31 @@ struct HccASTFileEntry {
 	HccASTFile file;
 };
 
+//
+// a precompiled header, the tokens and macros that a system header generated for a particular macro set.
+// these index into the pch_* arrays in HccAST.
+typedef struct HccPCH HccPCH;
+struct HccPCH {
+	HccHash64   end_macro_set_hash;
+	HccStringId path_string_id;
+	uint32_t    tokens_start_idx;
+	uint32_t    tokens_count;
+	uint32_t    values_start_idx;
+	uint32_t    values_count;
+	uint32_t    macros_start_idx;
+	uint32_t    macros_count;
+	uint32_t    included_files_start_idx;
+	uint32_t    included_files_count;
+	uint32_t    pragma_onced_files_start_idx;
+	uint32_t    pragma_onced_files_count;
+};
+
+typedef struct HccPCHEntry HccPCHEntry;
+struct HccPCHEntry {
+	HccHash64           key;
+	HccAtomic(uint32_t) pch_idx_plus_one; // zero until the PCH has been stored
+};
+
 typedef struct HccAST HccAST;
 struct HccAST {
 	HccASTFileSetup               file_setup;
@@ -2039,10 +2312,34 @@ struct HccAST {
 	HccStack(HccASTVariable)      function_params_and_variables;
 	HccStack(HccASTFunction)      functions;
 	HccStack(HccASTExpr)          exprs;
-	HccStack(HccLocation)         expr_locations;
 	HccStack(HccASTVariable)      global_variables;
 	HccStack(HccASTForwardDecl)   forward_declarations;
 	HccStack(uint64_t)            designated_initializer_elmt_indices; // referenced by HCC_AST_EXPR_TYPE_DESIGNATED_INITIALIZER
+
+	//
+	// a file can be linked as soon as it has finished ASTGEN but a forward declaration
+	// may be defined in a file that is still going through ASTGEN.
+	// those files are put in the deferred list and linked again once every file has finished ASTGEN.
+	HccAtomic(uint32_t)           astgen_files_left_count;
+	HccStack(HccASTFile*)         link_deferred_files;
+	HccSpinMutex                  link_deferred_files_mutex;
+
+	//
+	// system headers are preprocessed once per macro set and then spliced into every other file that includes them.
+	// a PCH is keyed by hcc_atagen_pch_key, the macro tokens have their own bag as HccPPMacro indexes into it.
+	HccHashTable(HccPCHEntry)     pchs_hash_table;
+	HccStack(HccPCH)              pchs;
+	HccATATokenBag                pch_token_bag;
+	HccATATokenBag                pch_macro_token_bag;
+	HccStack(HccPPMacro)          pch_macros;
+	HccStack(HccStringId)         pch_macro_params;
+	HccStack(HccStringId)         pch_files;
+	HccSpinMutex                  pchs_mutex;
+
+	//
+	// the code files that the locations point to when the AST has been loaded from a binary
+	// and those files have not been through ATAGEN in this process yet.
+	HccStack(HccCodeFile)         binary_code_files;
 };
 
 void hcc_ast_init(HccCU* cu, HccCUSetup* setup);
@@ -2052,6 +2349,223 @@ HccASTFile* hcc_ast_find_file(HccCU* cu, HccString file_path);
 void hcc_ast_print_expr(HccCU* cu, HccASTFunction* function, HccASTExpr* expr, uint32_t indent, HccIIO* iio);
 void hcc_ast_print(HccCU* cu, HccIIO* iio);
 
+// ===========================================
+//
+//
+// AST Binary
+//
+//
+// ===========================================
+//
+// the linked AST of a compilation unit encoded so a later task can skip ATAGEN, ASTGEN and ASTLINK.
+// when HCC_AST_BINARY_FLAGS_HAS_AML is set it also holds the AML after AMLOPT, so a later task can start at BACKENDGEN.
+// it is a header followed by sections of fixed size records, so the file can be mapped and read in place.
+// pointers are stored as an index + 1 into the section they point into and 0 is NULL.
+// string ids are only valid in the process that made them, so the user string ids
+// are stored as HCC_STRING_ID_USER_START + an index into the strings section.
+//
+
+#define HCC_AST_BINARY_MAGIC 0x54534148 // "HAST"
+#define HCC_AST_BINARY_VERSION 5
+
+typedef uint8_t HccASTBinarySection;
+enum HccASTBinarySection {
+	HCC_AST_BINARY_SECTION_STRINGS,
+	HCC_AST_BINARY_SECTION_STRING_DATA,
+	HCC_AST_BINARY_SECTION_CODE_FILES,
+	HCC_AST_BINARY_SECTION_LOCATIONS,
+	HCC_AST_BINARY_SECTION_FILES,
+	HCC_AST_BINARY_SECTION_FILE_DEPENDENCIES,
+	HCC_AST_BINARY_SECTION_FILE_DECLS,
+	HCC_AST_BINARY_SECTION_CONSTANTS,
+	HCC_AST_BINARY_SECTION_CONSTANT_DATA,
+	HCC_AST_BINARY_SECTION_ARRAYS,
+	HCC_AST_BINARY_SECTION_COMPOUNDS,
+	HCC_AST_BINARY_SECTION_COMPOUND_FIELDS,
+	HCC_AST_BINARY_SECTION_TYPEDEFS,
+	HCC_AST_BINARY_SECTION_ENUMS,
+	HCC_AST_BINARY_SECTION_ENUM_VALUES,
+	HCC_AST_BINARY_SECTION_POINTERS,
+	HCC_AST_BINARY_SECTION_FUNCTION_DATA_TYPES,
+	HCC_AST_BINARY_SECTION_FUNCTION_DATA_TYPE_PARAMS,
+	HCC_AST_BINARY_SECTION_BUFFERS,
+	HCC_AST_BINARY_SECTION_FUNCTION_PARAMS_AND_VARIABLES,
+	HCC_AST_BINARY_SECTION_FUNCTIONS,
+	HCC_AST_BINARY_SECTION_FUNCTION_IDXS,
+	HCC_AST_BINARY_SECTION_EXPRS,
+	HCC_AST_BINARY_SECTION_GLOBAL_VARIABLES,
+	HCC_AST_BINARY_SECTION_FORWARD_DECLARATIONS,
+	HCC_AST_BINARY_SECTION_DESIGNATED_INITIALIZER_ELMT_INDICES,
+	HCC_AST_BINARY_SECTION_SHADER_FUNCTION_DECLS,
+	HCC_AST_BINARY_SECTION_RESOURCE_STRUCTS,
+	HCC_AST_BINARY_SECTION_AML_FUNCTIONS,
+	HCC_AST_BINARY_SECTION_AML_FUNCTION_IDXS,
+	HCC_AST_BINARY_SECTION_AML_WORDS,
+	HCC_AST_BINARY_SECTION_AML_VALUES,
+	HCC_AST_BINARY_SECTION_AML_BASIC_BLOCKS,
+	HCC_AST_BINARY_SECTION_AML_BASIC_BLOCK_PARAMS,
+	HCC_AST_BINARY_SECTION_AML_BASIC_BLOCK_PARAM_SRCS,
+	HCC_AST_BINARY_SECTION_AML_LOCATIONS,
+	HCC_AST_BINARY_SECTION_AML_CALL_GRAPH_NODES,
+	HCC_AST_BINARY_SECTION_AML_FUNCTION_CALL_NODE_LISTS,
+	HCC_AST_BINARY_SECTION_AML_OPTIMIZE_FUNCTIONS,
+
+	HCC_AST_BINARY_SECTION_COUNT,
+};
+
+typedef uint32_t HccASTBinaryFlags;
+enum HccASTBinaryFlags {
+	HCC_AST_BINARY_FLAGS_NONE =    0x0,
+	HCC_AST_BINARY_FLAGS_HAS_AML = 0x1,
+};
+
+typedef struct HccASTBinarySectionHeader HccASTBinarySectionHeader;
+struct HccASTBinarySectionHeader {
+	uint64_t offset; // from the start of the binary, aligned to 8 bytes
+	uint64_t count;
+};
+
+typedef struct HccASTBinaryHeader HccASTBinaryHeader;
+struct HccASTBinaryHeader {
+	uint32_t                  magic;
+	uint32_t                  version;
+	HccHash64                 layout_hash;  // see hcc_ast_binary_layout_hash
+	HccHash64                 inputs_hash;  // see hcc_task_inputs_hash
+	HccHash64                 content_hash; // of everything after this header
+	uint64_t                  size;
+	uint64_t                  constants_cap; // a HccConstantId is the slot in the constant table, so the table must start with the same size
+	HccASTBinaryFlags         flags;
+	uint32_t                  supported_scalar_data_types_mask; // the AML was checked against these in AMLOPT, so a reader must support at least these
+	HccASTBinarySectionHeader sections[HCC_AST_BINARY_SECTION_COUNT];
+};
+
+typedef struct HccASTBinaryString HccASTBinaryString;
+struct HccASTBinaryString {
+	uint32_t data_offset; // into HCC_AST_BINARY_SECTION_STRING_DATA, null terminated
+	uint32_t size;
+};
+
+typedef struct HccASTBinaryCodeFile HccASTBinaryCodeFile;
+struct HccASTBinaryCodeFile {
+	uint32_t  path_string_idx;
+	uint32_t  code_size;
+	HccHash64 code_hash;
+};
+
+typedef struct HccASTBinaryLocation HccASTBinaryLocation;
+struct HccASTBinaryLocation {
+	uint32_t code_file_idx;
+	uint32_t parent_location_idx_plus_one;
+	uint32_t code_start_idx;
+	uint32_t code_end_idx;
+	uint32_t line_start;
+	uint32_t line_end;
+	uint32_t column_start;
+	uint32_t column_end;
+	uint32_t display_path_string_idx_plus_one;
+	uint32_t display_line;
+};
+
+typedef struct HccASTBinaryFile HccASTBinaryFile;
+struct HccASTBinaryFile {
+	uint32_t path_string_idx;
+	uint32_t dependencies_start_idx; // into HCC_AST_BINARY_SECTION_FILE_DEPENDENCIES, a list of string indices for the unique included file paths
+	uint32_t dependencies_count;
+};
+
+typedef uint8_t HccASTBinaryDeclKind;
+enum HccASTBinaryDeclKind {
+	HCC_AST_BINARY_DECL_KIND_GLOBAL,
+	HCC_AST_BINARY_DECL_KIND_STRUCT,
+	HCC_AST_BINARY_DECL_KIND_UNION,
+};
+
+//
+// a declaration of a HccASTFile. only the ones that the forward declarations
+// resolve through are stored, see hcc_decl_resolve_and_strip_qualifiers.
+typedef struct HccASTBinaryFileDecl HccASTBinaryFileDecl;
+struct HccASTBinaryFileDecl {
+	uint32_t             file_idx;
+	HccStringId          string_id;
+	HccDecl              decl;
+	uint32_t             location_idx_plus_one;
+	HccASTBinaryDeclKind kind;
+};
+
+typedef struct HccASTBinaryConstant HccASTBinaryConstant;
+struct HccASTBinaryConstant {
+	uint32_t    slot_idx;
+	uint32_t    data_offset; // into HCC_AST_BINARY_SECTION_CONSTANT_DATA
+	uint32_t    size: 31;
+	uint32_t    is_zero: 1;
+	HccDataType data_type;
+};
+
+//
+// the arrays of the function are stored as a range in their HCC_AST_BINARY_SECTION_AML_* section
+typedef struct HccASTBinaryAMLFunction HccASTBinaryAMLFunction;
+struct HccASTBinaryAMLFunction {
+	uint32_t       identifier_location_idx_plus_one;
+	uint32_t       found_texture_sample_location_idx_plus_one;
+	HccStringId    identifier_string_id;
+	HccDataType    function_data_type;
+	HccDataType    return_data_type;
+	uint32_t       compute_dispatch_group_size_x;
+	uint32_t       compute_dispatch_group_size_y;
+	uint32_t       compute_dispatch_group_size_z;
+	uint32_t       words_start_idx;
+	uint32_t       words_count;
+	uint32_t       values_start_idx;
+	uint32_t       values_count;
+	uint32_t       basic_blocks_start_idx;
+	uint32_t       basic_blocks_count;
+	uint32_t       basic_block_params_start_idx;
+	uint32_t       basic_block_params_count;
+	uint32_t       basic_block_param_srcs_start_idx;
+	uint32_t       basic_block_param_srcs_count;
+	HccShaderStage shader_stage;
+	HccOptLevel    opt_level;
+	uint8_t        params_count;
+};
+
+typedef struct HccASTBinaryPtrEntry HccASTBinaryPtrEntry;
+struct HccASTBinaryPtrEntry {
+	uint64_t ptr;
+	uint32_t idx; // UINT32_MAX if the pointer cannot be stored
+};
+
+typedef struct HccASTBinaryWriter HccASTBinaryWriter;
+struct HccASTBinaryWriter {
+	HccCU*                             cu;
+	HccStack(uint8_t)                  out;
+	HccASTBinaryHeader*                header;
+	HccStack(uint32_t)                 string_idx_plus_ones; // indexed by HccStringId.idx_plus_one
+	HccHashTable(HccASTBinaryPtrEntry) ptr_to_idx_hash_table; // for HccLocation, HccCodeFile & HccASTFile
+	HccStack(HccASTBinaryString)       strings;
+	HccStack(char)                     string_data;
+	HccStack(HccASTBinaryCodeFile)     code_files;
+	HccStack(HccASTBinaryLocation)     locations;
+};
+
+typedef struct HccASTBinaryReader HccASTBinaryReader;
+struct HccASTBinaryReader {
+	HccCU*                cu;
+	uint8_t*              data;
+	HccASTBinaryHeader*   header;
+	HccStack(HccStringId) string_ids; // indexed by the binary string index
+	HccStack(HccString)   persistent_strings; // null terminated copies in the global arena, made on first use
+	HccStack(HccCodeFile*) code_files;
+	HccStack(HccASTFile*) files;
+	HccLocation*          locations;
+};
+
+extern uint32_t hcc_ast_binary_section_elmt_sizes[HCC_AST_BINARY_SECTION_COUNT];
+
+HccHash64 hcc_ast_binary_layout_hash(void);
+bool hcc_ast_binary_is_intact(uint8_t* data, uintptr_t size);
+HccStack(uint8_t) hcc_ast_binary_write(HccCU* cu, HccHash64 inputs_hash, bool include_aml);
+bool hcc_ast_binary_read(HccCU* cu, HccHash64 inputs_hash, uint8_t* data, uintptr_t size, bool include_aml);
+
 // ===========================================
 //
 //
@@ -2496,6 +3010,7 @@ void hcc_aml_function_alctor_init(HccCU* cu, HccAMLFunctionAlctorSetup* setup);
 void hcc_aml_function_alctor_deinit(HccCU* cu);
 uint32_t hcc_aml_function_alctor_instr_count_round_up_log2(HccCU* cu, uint32_t max_instrs_count);
 HccAMLFunction* hcc_aml_function_alctor_alloc(HccCU* cu, uint32_t max_instrs_count);
+HccAMLFunction* hcc_aml_function_alctor_alloc_for_counts(HccCU* cu, uint32_t words_count, uint32_t values_count, uint32_t basic_blocks_count, uint32_t basic_block_params_count, uint32_t basic_block_param_srcs_count);
 void hcc_aml_function_alctor_dealloc(HccCU* cu, HccAMLFunction* function);
 
 // ===========================================
@@ -2525,13 +3040,14 @@ typedef struct HccAML HccAML;
 struct HccAML {
 	HccAMLFunctionAlctor      function_alctor;
 	HccStack(HccAtomic(HccAMLFunction*)) functions; // use index of HccDecl(Function) to access this array
-	HccStack(HccLocation*)    locations; // all the HccAMLInstr have a location index into this array
+	HccStack(HccLocationId)   locations; // all the HccAMLInstr have a location index into this array
 	HccAMLOptPhase opt_phase;
 	HccStack(HccAMLCallNode)  call_graph_nodes;
 	HccStack(HccAMLCallNode*) function_call_node_lists;
 	HccStack(HccDecl)         optimize_functions[2];
 	uint32_t                  optimize_functions_idx;
 	HccSpinMutex              optimize_functions_mutex; // used to lock and deduplicate optimize functions when needed
+	HccStack(HccAMLFunction*) inline_functions; // a reference to each function as it was at the start of the last optimization phase, the inliner copies callees from here
 };
 
 void hcc_aml_init(HccCU* cu, HccCUSetup* setup);
@@ -2541,6 +3057,8 @@ void hcc_aml_print(HccCU* cu, HccIIO* iio);
 HccLocation* hcc_aml_instr_location(HccCU* cu, HccAMLInstr* instr);
 HccStack(HccDecl) hcc_aml_optimize_functions(HccCU* cu);
 void hcc_aml_next_optimize_functions_array(HccCU* cu);
+void hcc_aml_inline_functions_take_refs(HccCU* cu);
+void hcc_aml_inline_functions_return_refs(HccCU* cu);
 HccAMLOperand hcc_aml_basic_block_next(const HccAMLFunction* function, HccAMLOperand basic_block_operand);
 HccAMLOperand hcc_aml_instr_switch_merge_basic_block_operand(const HccAMLFunction* function, HccAMLInstr* instr);
 
@@ -2615,10 +3133,177 @@ void hcc_amlgen_generate(HccWorker* w);
 //
 // ===========================================
 
+typedef struct HccAMLOptBasicBlock HccAMLOptBasicBlock;
+struct HccAMLOptBasicBlock {
+	uint32_t new_idx;
+	uint32_t merge_word_idx;         // the HCC_AML_OP_SELECTION_MERGE or HCC_AML_OP_LOOP_MERGE, UINT32_MAX if there is none
+	uint32_t terminator_word_idx;    // UINT32_MAX if the basic block does not end in a terminator
+	uint32_t branch_target_idx;      // UINT32_MAX unless the terminator has a constant condition and becomes a HCC_AML_OP_BRANCH to this basic block
+	uint32_t idom_idx;               // the immediate dominator, UINT32_MAX if the basic block cannot be reached from the entry
+	uint32_t order_idx;              // the position in the reverse postorder, UINT32_MAX if the basic block cannot be reached from the entry
+	uint32_t preds_start_idx;        // into HccAMLOpt.basic_block_preds
+	uint32_t preds_count;
+	uint32_t frontier_start_idx;     // into HccAMLOpt.dominance_frontiers
+	uint32_t frontier_count;
+	uint32_t dominator_children_start_idx; // into HccAMLOpt.dominator_children
+	uint32_t dominator_children_count;
+	uint32_t alloc_params_start_idx; // into HccAMLOpt.alloc_params
+	uint32_t alloc_params_count;
+	uint32_t new_params_start_idx;
+	uint32_t alloc_param_mark;       // the last HccAMLOptAlloc that got a basic block parameter here, plus one
+	uint32_t alloc_work_mark;        // the last HccAMLOptAlloc that put this basic block on the work list, plus one
+	uint32_t exit_new_idx;           // the new index of the basic block that ends up with the terminator once the calls in here have been inlined
+	uint32_t loop_header_idx;        // the header of the innermost loop this basic block is in, a loop header is in its own loop. UINT32_MAX if there is none
+	uint32_t loop_parent_idx;        // for a loop header, the header of the loop it is in, UINT32_MAX if there is none
+	uint32_t loop_preheader_idx;     // for a loop header, the one basic block outside of the loop that branches to it, UINT32_MAX if there is none
+	uint32_t hoists_start_idx;       // into HccAMLOpt.loop_hoists
+	uint32_t hoists_count;
+	uint32_t unroll_loop_idx;        // into HccAMLOpt.unroll_loops, UINT32_MAX unless this basic block is in a loop that is being unrolled
+	uint32_t unroll_local_idx;       // the position in the body of the loop that is being unrolled, UINT32_MAX for the header and condition
+	uint32_t unroll_local_params_start_idx;
+	bool     is_live;
+	bool     is_loop_header;
+	bool     is_structured_target;   // the merge or continue basic block of a live structured construct
+	bool     is_merged_with_next;    // the branch at the end goes away as the basic block it goes to is joined on to this one
+	bool     is_merged_with_prev;    // joined on to the end of the live basic block before it, which is its only predecessor
+};
+
+//
+// holds both the values and the basic block parameters of a function.
+// the basic block parameters come straight after the values.
+typedef struct HccAMLOptValue HccAMLOptValue;
+struct HccAMLOptValue {
+	uint32_t      uses_count;
+	uint32_t      store_uses_count;      // how many of the uses only write through the pointer
+	uint32_t      def_word_idx;          // UINT32_MAX for the function parameters
+	uint32_t      def_basic_block_idx;
+	uint32_t      new_idx;
+	HccAMLOperand replacement;           // a basic block parameter that always gets the same operand is replaced by it
+	uint32_t      alloc_idx;             // the HccAMLOptAlloc of a HCC_AML_OP_PTR_STATIC_ALLOC that is being promoted, UINT32_MAX otherwise
+	bool          is_removed;
+	bool          is_write_only;
+	bool          is_dead_store_target;
+	bool          is_hoisted;            // moved out to the preheader of a loop, def_basic_block_idx is the preheader
+};
+
+//
+// a HCC_AML_OP_PTR_STATIC_ALLOC that is only ever loaded from and stored to as a whole,
+// so it can be turned into values and basic block parameters.
+typedef struct HccAMLOptAlloc HccAMLOptAlloc;
+struct HccAMLOptAlloc {
+	uint32_t      value_idx;
+	HccDataType   data_type;                  // the data type that is stored in the allocation
+	HccAMLOperand undefined_operand;          // what is loaded before anything has been stored, made when it is first needed
+	uint32_t      stored_basic_block_idx;     // the basic block of the last store that was seen while scanning
+	uint32_t      def_basic_blocks_start_idx; // into HccAMLOpt.alloc_def_basic_blocks
+	uint32_t      def_basic_blocks_count;
+	bool          is_escaped;                 // the pointer is used for something other than a load or a store
+	bool          is_live_in;                 // it is loaded in a basic block before it is stored there, so it needs basic block parameters
+};
+
+typedef struct HccAMLOptAllocParam HccAMLOptAllocParam;
+struct HccAMLOptAllocParam {
+	uint32_t basic_block_idx;
+	uint32_t alloc_idx;
+};
+
+//
+// a HCC_AML_OP_CALL that gets replaced by a copy of the callee's body.
+// the caller basic block is split at the call, the callee's basic blocks go in between the two halves.
+typedef struct HccAMLOptInlineSite HccAMLOptInlineSite;
+struct HccAMLOptInlineSite {
+	uint32_t              word_idx;                         // of the HCC_AML_OP_CALL in the caller
+	const HccAMLFunction* callee;                           // from HccAML.inline_functions
+	uint32_t              values_start_idx;                 // the callee's values after its parameters go here, the parameters become the arguments
+	uint32_t              basic_blocks_start_idx;
+	uint32_t              basic_block_params_start_idx;
+	uint32_t              basic_block_param_srcs_start_idx;
+	uint32_t              header_basic_block_idx;           // the loop that the returns break out of when there is more than one, UINT32_MAX otherwise
+	uint32_t              continue_basic_block_idx;
+	uint32_t              return_basic_block_idx;           // the second half of the caller basic block
+	uint32_t              return_param_idx;                 // gets the return value when there is more than one return, UINT32_MAX otherwise
+	uint32_t              returns_count;
+};
+
+typedef uint8_t HccAMLOptValueNumberKind;
+enum HccAMLOptValueNumberKind {
+	HCC_AMLOPT_VALUE_NUMBER_KIND_NONE,    // never shares its result with another instruction
+	HCC_AMLOPT_VALUE_NUMBER_KIND_PURE,    // the result only depends on the operands
+	HCC_AMLOPT_VALUE_NUMBER_KIND_MEMORY,  // reads memory that can change, so the result can only be shared in the same basic block up until the next clobber
+	HCC_AMLOPT_VALUE_NUMBER_KIND_CLOBBER, // can write to memory or make writes from other threads visible
+};
+
+//
+// an instruction that others with the same hash get checked against.
+// entries are pushed as the dominator tree is walked down and popped on the way back up,
+// so an instruction only ever gets replaced by one in a basic block that dominates it.
+typedef struct HccAMLOptValueNumber HccAMLOptValueNumber;
+struct HccAMLOptValueNumber {
+	HccHash32 hash;
+	uint32_t  word_idx;
+	uint32_t  memory_epoch; // 0 for HCC_AMLOPT_VALUE_NUMBER_KIND_PURE
+	uint32_t  prev_idx;     // the entry that was in the bucket before this one, UINT32_MAX if there is none
+};
+
+//
+// a loop with a constant trip count whose body gets copied back to back.
+// a full unroll drops the header and condition, a partial unroll keeps them and the condition is checked every copies_count iterations.
+typedef struct HccAMLOptUnrollLoop HccAMLOptUnrollLoop;
+struct HccAMLOptUnrollLoop {
+	uint32_t header_basic_block_idx;
+	uint32_t cond_basic_block_idx;       // only has the comparison and the HCC_AML_OP_BRANCH_CONDITIONAL
+	uint32_t entry_basic_block_idx;      // where the condition branches to when the loop keeps going
+	uint32_t continue_basic_block_idx;
+	uint32_t merge_basic_block_idx;
+	uint32_t preheader_basic_block_idx;
+	uint32_t trip_count;
+	uint32_t copies_count;               // how many times the body is written out
+	uint32_t body_basic_blocks_count;
+	uint32_t body_basic_block_params_count;
+	uint32_t body_values_count;
+	uint32_t body_words_count;
+	uint32_t body_basic_block_param_srcs_count;
+	uint32_t new_basic_blocks_start_idx; // of the first copy of the body
+	uint32_t new_basic_block_params_start_idx;
+	uint32_t new_values_start_idx;       // of the second copy of the body, the first copy keeps the original values
+	uint32_t iter_params_start_idx;      // into HccAMLOpt.unroll_iter_params, what the header parameters are going into each copy and after the last one
+	bool     is_full;
+};
+
+typedef struct HccAMLOptUnrollLimits HccAMLOptUnrollLimits;
+struct HccAMLOptUnrollLimits {
+	uint32_t full_trip_count_max; // loops that run at most this many times get fully unrolled
+	uint32_t partial_copies_max;  // otherwise the body is copied up to this many times, it must divide the trip count
+	uint32_t instrs_max;          // the most instructions that all of the copies of the body can add up to
+};
+
+#define HCC_AMLOPT_INLINE_FUNCTION_WORDS_CAP 65536 // stop inlining into a function once it would grow past this
+#define HCC_AMLOPT_UNROLL_FUNCTION_WORDS_CAP 65536 // stop unrolling loops in a function once it would grow past this
+#define HCC_AMLOPT_UNROLL_TRIP_COUNT_MAX 4096      // give up working out the trip count of a loop after this many iterations
+
 typedef struct HccAMLOpt HccAMLOpt;
 struct HccAMLOpt {
-	uint16_t function_recursion_call_stack_count;
-	HccDecl  function_recursion_call_stack[HCC_FUNCTION_CALL_STACK_CAP];
+	uint16_t                      function_recursion_call_stack_count;
+	HccDecl                       function_recursion_call_stack[HCC_FUNCTION_CALL_STACK_CAP];
+	HccStack(HccAMLOperand)       value_replacements;
+	HccStack(HccAMLOptBasicBlock) basic_blocks;
+	HccStack(HccAMLOptValue)      values;
+	HccStack(uint32_t)            basic_block_preds;
+	HccStack(uint32_t)            basic_block_order;
+	HccStack(uint32_t)            basic_block_work;
+	HccStack(uint32_t)            dominance_frontiers;
+	HccStack(HccAMLOptAlloc)      allocs;
+	HccStack(HccAMLOptAllocParam) alloc_params;
+	HccStack(uint32_t)            alloc_def_basic_blocks;
+	HccStack(HccAMLOperand)       alloc_values;
+	HccStack(HccAMLOptInlineSite) inline_sites;
+	HccStack(uint32_t)            inline_callee_marks;
+	HccStack(uint32_t)            dominator_children;
+	HccStack(HccAMLOptValueNumber) value_numbers;
+	HccStack(uint32_t)            value_number_buckets;
+	HccStack(uint32_t)            loop_hoists;
+	HccStack(HccAMLOptUnrollLoop) unroll_loops;
+	HccStack(HccAMLOperand)       unroll_iter_params;
 };
 
 typedef const HccAMLFunction* (*HccAMLOptFn)(HccWorker* w, HccDecl function_decl, const HccAMLFunction* aml_function);
@@ -2642,7 +3327,10 @@ extern HccAMLOptFn hcc_aml_opts_phase_0_level_g[];
 extern HccAMLOptFn hcc_aml_opts_phase_1_level_g[];
 extern HccAMLOptFn hcc_aml_opts_phase_2_level_g[];
 extern HccAMLOptFn* hcc_aml_opts[HCC_AML_OPT_PHASE_COUNT][HCC_OPT_LEVEL_COUNT];
+extern HccAMLOptFn hcc_aml_opt_pass_fns[HCC_AML_OPT_PASS_COUNT];
 extern uint32_t hcc_aml_opts_count[HCC_AML_OPT_PHASE_COUNT][HCC_OPT_LEVEL_COUNT];
+extern uint32_t hcc_amlopt_inline_instrs_limits[HCC_OPT_LEVEL_COUNT];
+extern HccAMLOptUnrollLimits hcc_amlopt_unroll_limits[HCC_OPT_LEVEL_COUNT];
 
 void hcc_amlopt_init(HccWorker* w, HccCompilerSetup* setup);
 void hcc_amlopt_deinit(HccWorker* w);
@@ -2657,6 +3345,76 @@ bool hcc_amlopt_ensure_supported_type(HccWorker* w, HccDataType data_type, HccLo
 const HccAMLFunction* hcc_amlopt_make_call_graph(HccWorker* w, HccDecl function_decl, const HccAMLFunction* aml_function);
 const HccAMLFunction* hcc_amlopt_check_for_recursion_and_make_ordered_function_list(HccWorker* w, HccDecl function_decl, const HccAMLFunction* aml_function);
 const HccAMLFunction* hcc_amlopt_check_for_unsupported_features(HccWorker* w, HccDecl function_decl, const HccAMLFunction* aml_function);
+HccAMLFunction* hcc_amlopt_function_alloc(HccCU* cu, const HccAMLFunction* aml_function, uint32_t words_count, uint32_t values_count, uint32_t basic_blocks_count, uint32_t basic_block_params_count, uint32_t basic_block_param_srcs_count);
+HccAMLOptBasicBlock* hcc_amlopt_basic_blocks_init(HccWorker* w, const HccAMLFunction* aml_function);
+uint32_t hcc_amlopt_basic_block_successors_count(const HccAMLFunction* aml_function, const HccAMLOptBasicBlock* basic_block);
+uint32_t hcc_amlopt_basic_block_successor(const HccAMLFunction* aml_function, const HccAMLOptBasicBlock* basic_block, uint32_t successor_idx);
+void hcc_amlopt_dominators(HccWorker* w, const HccAMLFunction* aml_function);
+uint32_t hcc_amlopt_dominators_intersect(HccAMLOptBasicBlock* basic_blocks, uint32_t a_basic_block_idx, uint32_t b_basic_block_idx);
+void hcc_amlopt_dominance_frontiers(HccWorker* w);
+void hcc_amlopt_dominator_tree(HccWorker* w);
+uint32_t hcc_amlopt_loops_init(HccWorker* w, const HccAMLFunction* aml_function);
+HccAMLOptValue* hcc_amlopt_values_init(HccWorker* w, const HccAMLFunction* aml_function);
+HccDataType hcc_amlopt_constant_fold_scalar_data_type(HccCU* cu, HccDataType data_type, uint32_t* columns_out);
+HccConstantId hcc_amlopt_constant_fold_component(HccCU* cu, HccAMLOperand operand, HccDataType scalar_data_type, uint32_t columns, uint32_t idx);
+HccAMLOperand hcc_amlopt_constant_fold_result(HccCU* cu, HccDataType data_type, uint32_t columns, HccConstantId* component_constant_ids);
+bool hcc_amlopt_constant_fold_is_splat(HccCU* cu, HccAMLOperand operand, HccDataType scalar_data_type, uint32_t columns, int64_t value);
+double hcc_amlopt_constant_fold_float(HccCU* cu, HccDataType scalar_data_type, HccBasic basic);
+uint64_t hcc_amlopt_constant_fold_int(HccDataType scalar_data_type, HccBasic basic);
+bool hcc_amlopt_constant_fold_math(HccAMLOp op, double* args, double* result_out);
+HccAMLOperand hcc_amlopt_constant_fold_instr(HccWorker* w, const HccAMLFunction* aml_function, HccAMLOp aml_op, HccAMLOperand* aml_operands, uint32_t aml_operands_count);
+HccAMLOperand hcc_amlopt_constant_fold_operand(HccStack(HccAMLOperand) value_replacements, HccAMLOperand operand);
+const HccAMLFunction* hcc_amlopt_constant_fold(HccWorker* w, HccDecl function_decl, const HccAMLFunction* aml_function);
+HccAMLFunction* hcc_amlopt_replace_values(HccWorker* w, const HccAMLFunction* aml_function, uint32_t removed_words_count);
+HccAMLOptValueNumberKind hcc_amlopt_value_numbering_kind(HccCU* cu, const HccAMLFunction* aml_function, HccAMLInstr* aml_instr);
+bool hcc_amlopt_value_numbering_is_commutative(HccAMLOp op);
+HccHash32 hcc_amlopt_value_numbering_hash(HccWorker* w, const HccAMLFunction* aml_function, HccAMLInstr* aml_instr, uint32_t memory_epoch);
+bool hcc_amlopt_value_numbering_is_match(HccWorker* w, const HccAMLFunction* aml_function, HccAMLInstr* a_aml_instr, HccAMLInstr* b_aml_instr);
+uint32_t hcc_amlopt_value_numbering_basic_block(HccWorker* w, const HccAMLFunction* aml_function, uint32_t basic_block_idx, uint32_t* memory_epoch_in_out);
+const HccAMLFunction* hcc_amlopt_value_numbering(HccWorker* w, HccDecl function_decl, const HccAMLFunction* aml_function);
+bool hcc_amlopt_hoist_loop_invariants_is_param_ptr(HccWorker* w, const HccAMLFunction* aml_function, HccAMLOperand operand);
+bool hcc_amlopt_hoist_loop_invariants_is_candidate(HccWorker* w, const HccAMLFunction* aml_function, HccAMLInstr* aml_instr);
+bool hcc_amlopt_hoist_loop_invariants_is_outside(HccWorker* w, const HccAMLFunction* aml_function, HccAMLOperand operand, uint32_t loop_header_idx);
+const HccAMLFunction* hcc_amlopt_hoist_loop_invariants(HccWorker* w, HccDecl function_decl, const HccAMLFunction* aml_function);
+bool hcc_amlopt_unroll_loops_is_true(HccWorker* w, const HccAMLFunction* aml_function, HccAMLOperand condition, bool* is_true_out);
+bool hcc_amlopt_unroll_loops_trip_count(HccWorker* w, const HccAMLFunction* aml_function, HccAMLOptUnrollLoop* loop);
+bool hcc_amlopt_unroll_loops_analyze(HccWorker* w, const HccAMLFunction* aml_function, uint32_t header_basic_block_idx, HccAMLOptUnrollLoop* loop);
+HccAMLOperand hcc_amlopt_unroll_loops_operand(HccWorker* w, const HccAMLFunction* aml_function, HccAMLOptUnrollLoop* loop, uint32_t copy_idx, HccAMLOperand operand);
+void hcc_amlopt_unroll_loops_basic_block(HccWorker* w, const HccAMLFunction* aml_function, HccAMLFunction* new_aml_function, uint32_t basic_block_idx, HccAMLOptUnrollLoop* loop, uint32_t copy_idx);
+bool hcc_amlopt_unroll_loops_is_in_loop(HccWorker* w, const HccAMLFunction* aml_function, uint32_t header_basic_block_idx, HccAMLOperand operand);
+bool hcc_amlopt_unroll_loops_is_used_unreachably(HccWorker* w, const HccAMLFunction* aml_function, uint32_t header_basic_block_idx);
+HccAMLFunction* hcc_amlopt_unroll_loops_once(HccWorker* w, const HccAMLFunction* aml_function, bool* has_unrolled_inner_loop_out);
+const HccAMLFunction* hcc_amlopt_unroll_loops(HccWorker* w, HccDecl function_decl, const HccAMLFunction* aml_function);
+HccAMLOptValue* hcc_amlopt_eliminate_dead_code_value(HccWorker* w, const HccAMLFunction* aml_function, HccAMLOperand operand);
+bool hcc_amlopt_eliminate_dead_code_is_pure(HccAMLOp op);
+uint32_t hcc_amlopt_eliminate_dead_code_branch_target(HccWorker* w, const HccAMLFunction* aml_function, HccAMLOptBasicBlock* basic_block);
+uint32_t hcc_amlopt_eliminate_dead_code_operands_count(HccAMLOptBasicBlock* basic_block, uint32_t aml_word_idx, HccAMLInstr* aml_instr);
+void hcc_amlopt_eliminate_dead_code_read_operands_range(HccAMLOptBasicBlock* basic_block, uint32_t aml_word_idx, HccAMLInstr* aml_instr, uint32_t* start_out, uint32_t* end_out);
+bool hcc_amlopt_eliminate_dead_code_is_edge(HccWorker* w, const HccAMLFunction* aml_function, uint32_t src_basic_block_idx, uint32_t dst_basic_block_idx);
+bool hcc_amlopt_eliminate_dead_code_is_instr_reachable(HccAMLOptBasicBlock* basic_block, uint32_t aml_word_idx);
+uint32_t hcc_amlopt_eliminate_dead_code_jump_target(HccWorker* w, const HccAMLFunction* aml_function, HccAMLOptBasicBlock* basic_block);
+bool hcc_amlopt_eliminate_dead_code_is_instr_live(HccWorker* w, const HccAMLFunction* aml_function, HccAMLOptBasicBlock* basic_block, uint32_t aml_word_idx);
+void hcc_amlopt_eliminate_dead_code_mark_live_basic_blocks(HccWorker* w, const HccAMLFunction* aml_function);
+void hcc_amlopt_eliminate_dead_code_merge_basic_blocks(HccWorker* w, const HccAMLFunction* aml_function);
+HccAMLOperand hcc_amlopt_eliminate_dead_code_resolve(HccWorker* w, const HccAMLFunction* aml_function, HccAMLOperand operand);
+void hcc_amlopt_eliminate_dead_code_remove_use(HccWorker* w, const HccAMLFunction* aml_function, HccAMLOperand operand);
+HccAMLOperand hcc_amlopt_eliminate_dead_code_operand(HccWorker* w, const HccAMLFunction* aml_function, HccAMLOperand operand);
+const HccAMLFunction* hcc_amlopt_eliminate_dead_code(HccWorker* w, HccDecl function_decl, const HccAMLFunction* aml_function);
+uint32_t hcc_amlopt_promote_static_allocs_alloc_idx(HccWorker* w, HccAMLOperand operand);
+bool hcc_amlopt_promote_static_allocs_is_promoted_instr(HccWorker* w, HccAMLInstr* aml_instr);
+HccAMLOperand hcc_amlopt_promote_static_allocs_undefined(HccWorker* w, uint32_t alloc_idx);
+HccAMLOperand hcc_amlopt_promote_static_allocs_operand(HccWorker* w, const HccAMLFunction* aml_function, HccAMLOperand operand);
+void hcc_amlopt_promote_static_allocs_find_defs(HccWorker* w, const HccAMLFunction* aml_function, bool is_counting);
+const HccAMLFunction* hcc_amlopt_promote_static_allocs(HccWorker* w, HccDecl function_decl, const HccAMLFunction* aml_function);
+uint32_t hcc_amlopt_inline_instrs_count(const HccAMLFunction* callee);
+uint32_t hcc_amlopt_inline_returns_count(HccWorker* w, const HccAMLFunction* callee);
+HccAMLOperand hcc_amlopt_inline_caller_operand(HccWorker* w, HccAMLOperand operand);
+HccAMLOperand hcc_amlopt_inline_callee_operand(HccWorker* w, const HccAMLFunction* aml_function, HccAMLOptInlineSite* site, HccAMLOperand operand);
+void hcc_amlopt_inline_basic_block_add(HccAMLFunction* new_aml_function, uint32_t basic_block_idx, uint32_t params_start_idx, uint32_t params_count, uint32_t location_idx);
+HccAMLFunction* hcc_amlopt_inline_calls(HccWorker* w, const HccAMLFunction* aml_function);
+const HccAMLFunction* hcc_amlopt_inline(HccWorker* w, HccDecl function_decl, const HccAMLFunction* aml_function);
+HccAMLOptPass hcc_amlopt_pass(HccAMLOptFn optimize_fn);
+void hcc_amlopt_pass_stats_add(HccAMLOptPassStats* dst, const HccAMLOptPassStats* src);
 
 void hcc_amlopt_optimize(HccWorker* w);
 
@@ -3242,12 +4000,44 @@ struct HccSPIRVUniqueTypeEntry {
 	HccAtomic(HccSPIRVId) spirv_id;
 };
 
+typedef uint8_t HccSPIRVLinkJobType;
+enum HccSPIRVLinkJobType {
+	HCC_SPIRVLINK_JOB_TYPE_MODULE,              // liveness, the header and the small sections of the module with every entry point, then gives out the rest
+	HCC_SPIRVLINK_JOB_TYPE_ENTRY_POINT,         // the whole module for a single entry point
+	HCC_SPIRVLINK_JOB_TYPE_NAMES,
+	HCC_SPIRVLINK_JOB_TYPE_DECORATES,
+	HCC_SPIRVLINK_JOB_TYPE_TYPES_AND_CONSTANTS,
+	HCC_SPIRVLINK_JOB_TYPE_GLOBAL_VARIABLES,
+	HCC_SPIRVLINK_JOB_TYPE_FUNCTIONS,
+};
+
+//
+// the argument of a BACKENDLINK job.
+// the section jobs write straight in to HccSPIRV.final_binary_words at the offset the MODULE job made space for.
+typedef struct HccSPIRVLinkJob HccSPIRVLinkJob;
+struct HccSPIRVLinkJob {
+	HccSPIRVLinkJobType type;
+	uint32_t            start_idx; // MODULE: HccSPIRV.link_jobs, ENTRY_POINT: HccSPIRV.entry_points, FUNCTIONS: hcc_aml_optimize_functions
+	uint32_t            end_idx;
+	uint32_t            dst_word_idx;
+	uint32_t            words_count;
+};
+
+typedef struct HccSPIRVLiveness HccSPIRVLiveness;
+struct HccSPIRVLiveness {
+	HccStack(bool) function_flags; // indexed by HCC_DECL_AUX of the function
+	HccStack(bool) id_flags; // indexed by the spirv id
+	bool           is_stripping_dead_code;
+};
+
 typedef struct HccSPIRVEntryPoint HccSPIRVEntryPoint;
 struct HccSPIRVEntryPoint {
 	HccShaderStage shader_stage;
 	HccStringId    identifier_string_id;
 	HccSPIRVId     spirv_id;
 	HccDecl        function_decl;
+	uint32_t       binary_words_start_idx; // into HccSPIRV.entry_point_binary_words, only set when the task outputs entry point binaries
+	uint32_t       binary_words_count;
 };
 
 typedef struct HccSPIRV HccSPIRV;
@@ -3280,10 +4070,17 @@ struct HccSPIRV {
 	HccSPIRVId                                   quad_swap_x_spirv_id;
 	HccSPIRVId                                   quad_swap_y_spirv_id;
 	HccSPIRVId                                   quad_swap_diagonal_spirv_id;
+	HccSPIRVId                                   variable_input_f32x4_type_id; // the builtin variable types are set by hcc_spirvlink_prepare
+	HccSPIRVId                                   variable_input_u32x3_type_id;
+	HccSPIRVId                                   variable_input_u32_type_id;
+	HccSPIRVId                                   variable_output_f32x4_type_id;
+	HccSPIRVId                                   variable_output_f32_type_id;
 	bool                                         found_image_int64_atomics;
 
-	HccSPIRVWord*                                final_binary_words;
-	uint32_t                                     final_binary_words_count;
+	HccStack(HccSPIRVLinkJob)                    link_jobs;
+	HccSPIRVLiveness                             module_liveness;
+	HccStack(HccSPIRVWord)                       final_binary_words;
+	HccStack(HccSPIRVWord)                       entry_point_binary_words;
 };
 
 typedef struct HccSPIRVDescriptorBindingInfo HccSPIRVDescriptorBindingInfo;
@@ -3296,6 +4093,8 @@ struct HccSPIRVDescriptorBindingInfo {
 extern uint32_t hcc_spirv_image_format[HCC_TEXTURE_FORMAT_COUNT];
 
 void hcc_spirv_init(HccCU* cu, HccCUSetup* setup);
+void hcc_spirv_deinit(HccCU* cu);
+void hcc_spirv_prepare(HccCU* cu);
 HccSPIRVId hcc_spirv_next_id(HccCU* cu);
 HccSPIRVId hcc_spirv_next_id_many(HccCU* cu, uint32_t amount);
 HccSPIRVId hcc_spirv_type_deduplicate(HccCU* cu, HccSPIRVStorageClass storage_class, HccDataType data_type);
@@ -3303,6 +4102,7 @@ HccSPIRVId hcc_spirv_decl_deduplicate(HccCU* cu, HccDecl decl);
 void hcc_spirv_resource_descriptor_binding_deduplicate(HccCU* cu, HccDataType data_type, HccSPIRVDescriptorBindingInfo* info_out);
 HccSPIRVId hcc_spirv_constant_deduplicate(HccCU* cu, HccConstantId constant_id);
 HccSPIRVStorageClass hcc_spirv_storage_class_from_aml_operand(HccCU* cu, const HccAMLFunction* aml_function, HccAMLOperand aml_operand);
+bool hcc_spirv_op_operand_is_literal(HccSPIRVOp op, uint32_t operand_idx);
 uint32_t hcc_spirv_string_words_count(uint32_t string_size);
 void hcc_spirv_encode_string(HccSPIRVWord* dst_words, HccString string);
 HccSPIRVOperand* hcc_spirv_add_global_variable(HccCU* cu, uint32_t operands_count);
@@ -3365,9 +4165,16 @@ void hcc_spirvgen_generate(HccWorker* w);
 
 #define HCC_SPIRVLINK_INSTR_OPERANDS_CAP 256
 
+//
+// the functions of the module with every entry point are split in to FUNCTIONS jobs of at least this many words
+#define HCC_SPIRVLINK_FUNCTIONS_JOB_WORDS_MIN 32768
+
 typedef struct HccSPIRVLink HccSPIRVLink;
 struct HccSPIRVLink {
-	HccStack(HccSPIRVWord) words;
+	HccStack(HccSPIRVWord) words; // the binary of an ENTRY_POINT job
+	HccStack(HccSPIRVWord) dst_words; // where the instructions are added to, either words or HccSPIRV.final_binary_words
+	HccSPIRVLiveness       entry_point_liveness;
+	HccSPIRVLiveness*      liveness; // either entry_point_liveness or HccSPIRV.module_liveness
 
 	HccSPIRVOp             instr_op;
 	uint16_t               instr_operands_count;
@@ -3389,9 +4196,23 @@ void hcc_spirvlink_instr_add_operand(HccWorker* w, HccSPIRVWord word);
 void hcc_spirvlink_instr_add_operands_string(HccWorker* w, char* string, uint32_t string_size);
 #define hcc_spirvlink_instr_add_operands_string_lit(w, string) hcc_spirvlink_instr_add_operands_string(w, string, sizeof(string) - 1)
 void hcc_spirvlink_instr_end(HccWorker* w);
+bool hcc_spirvlink_is_live(HccWorker* w, HccSPIRVId spirv_id);
+bool hcc_spirvlink_is_live_function(HccWorker* w, HccDecl function_decl);
+HccSPIRVId hcc_spirvlink_type_or_constant_id(HccSPIRVTypeOrConstant* type_or_constant);
+bool hcc_spirvlink_mark_live(HccWorker* w, HccSPIRVWord word);
+bool hcc_spirvlink_mark_live_operands(HccWorker* w, HccSPIRVOp op, HccSPIRVWord* operands, uint32_t operands_count);
+void hcc_spirvlink_mark_live_functions(HccWorker* w, HccSPIRVEntryPoint* entry_point);
+void hcc_spirvlink_mark_live_globals_types_and_constants(HccWorker* w);
+uint32_t hcc_spirvlink_copy_live_instrs(HccWorker* w, HccSPIRVWord* dst, HccSPIRVWord* words, uint32_t words_count, uint32_t target_operand_idx);
+uint32_t hcc_spirvlink_write_section(HccWorker* w, HccSPIRVLinkJob* link_job, HccSPIRVWord* dst);
+void hcc_spirvlink_add_section(HccWorker* w, HccSPIRVLinkJobType type);
+void hcc_spirvlink_add_functions(HccWorker* w);
 bool hcc_spirvlink_add_used_global_variable_ids(HccWorker* w, HccDecl function_decl);
 
+void hcc_spirvlink_prepare(HccCU* cu);
+HccSPIRVLinkJob* hcc_spirvlink_add_job(HccCU* cu, HccSPIRVLinkJobType type, uint32_t start_idx);
 void hcc_spirvlink_link(HccWorker* w);
+void hcc_spirvlink_link_module(HccWorker* w, HccSPIRVEntryPoint* single_entry_point);
 
 // ===========================================
 //
@@ -3436,15 +4257,13 @@ struct HccDeclEntryAtomic {
 typedef struct HccCU HccCU;
 struct HccCU {
 	HccConstantTable         constant_table;
+	HccLocationTable         location_table;
 	HccDataTypeTable         dtt;
 	HccAST                   ast;
 	HccAML                   aml;
 	HccSPIRV                 spirv;
 	HccAMLScalarDataTypeMask supported_scalar_data_types_mask;
 	HccOptions*              options;
-	uint32_t                 global_declarations_cap;
-	uint32_t                 compounds_cap;
-	uint32_t                 enums_cap;
 
 	//
 	// these hash tables are all of the declarations from all of the files.
@@ -3513,6 +4332,8 @@ struct HccOptions {
 	HccStack(HccOptionDefine) defines;
 };
 
+HccHash64 hcc_options_hash(HccOptions* options, HccHash64 hash); // only the options that are used before BACKENDGEN
+
 // ===========================================
 //
 //
@@ -3544,8 +4365,10 @@ struct HccTaskOutputLocation {
 
 typedef uint8_t HccTaskFlags;
 enum HccTaskFlags {
-	HCC_TASK_FLAGS_NONE =          0x0,
-	HCC_TASK_FLAGS_IS_RESULT_SET = 0x1,
+	HCC_TASK_FLAGS_NONE =                     0x0,
+	HCC_TASK_FLAGS_IS_RESULT_SET =            0x1,
+	HCC_TASK_FLAGS_HAS_LOADED_AST_BINARY =    0x2,
+	HCC_TASK_FLAGS_HAS_LOADED_AML_BINARY =    0x4,
 };
 
 typedef struct HccTask HccTask;
@@ -3561,22 +4384,41 @@ struct HccTask {
 	HccTaskOutputLocation   output_job_locations[HCC_WORKER_JOB_TYPE_COUNT];
 	HccIIO*                 output_iio_metadata_c;
 	HccIIO*                 output_iio_metadata_json;
+	const char*             output_entry_point_binaries_dir;
+	HccStack(uint8_t)       input_ast_binary;
+	HccStack(uint8_t)       output_ast_binary; // written at the ASTLINK barrier as the later stages add to the data type & constant tables
+	HccStack(uint8_t)       input_aml_binary;
+	HccStack(uint8_t)       output_aml_binary; // written when the task finishes, see hcc_task_output_job
+	uint32_t                ast_binary_grow_size; // used for the AML binaries too
+	uint32_t                ast_binary_reserve_size;
 	HccMessageSys           message_sys;
 	HccStack(HccString)     include_path_strings;
 	HccMutex                is_running_mutex;
-	HccAtomic(uint32_t)     queued_jobs_count;
-	HccTime                 worker_job_type_start_times[HCC_WORKER_JOB_TYPE_COUNT];
+	HccAtomic(uint32_t)     queued_jobs_count; // jobs left until the task reaches the barrier for worker_job_type
+	HccSpinMutex            worker_job_type_times_mutex;
+	uint32_t                worker_job_types_ran_bitset;
+	HccDuration             worker_job_type_first_starts[HCC_WORKER_JOB_TYPE_COUNT]; // relative to start_time
+	HccDuration             worker_job_type_last_ends[HCC_WORKER_JOB_TYPE_COUNT]; // relative to start_time
 	HccDuration             worker_job_type_durations[HCC_WORKER_JOB_TYPE_COUNT];
+	HccSpinMutex            aml_opt_pass_stats_mutex;
+	HccAMLOptPassStats      aml_opt_pass_stats[HCC_AML_OPT_PASS_COUNT];
 	HccDuration             duration;
 	HccTime                 start_time;
+	HccAtomic(uint64_t)     mem_reserved_total_size;  // reserved in total for this task by the last dispatch, releases are not taken away
+	HccAtomic(uint64_t)     mem_committed_total_size; // committed in total for this task by the last dispatch, decommits are not taken away
 
 	HccCU*                  cu;
 };
 
 HccTaskInputLocation* hcc_task_input_location_init(HccTask* t, HccOptions* options);
 HccResult hcc_task_add_output(HccTask* t, HccWorkerJobType job_type, HccEncoding encoding, void* arg);
-void hcc_task_output_job(HccTask* t, HccWorkerJobType job_type);
+HccResult hcc_task_output_job(HccTask* t, HccWorkerJobType job_type);
+HccResult hcc_task_output_entry_point_binaries(HccTask* t);
 void hcc_task_finish(HccTask* t, bool thread_that_set_error);
+HccHash64 hcc_task_inputs_hash(HccTask* t);
+void hcc_task_capture_ast_binary(HccTask* t);
+void hcc_task_capture_aml_binary(HccTask* t);
+bool hcc_task_read_binary(HccTask* t, HccIIO* iio, HccStack(uint8_t) binary);
 
 // ===========================================
 //
@@ -3593,25 +4435,58 @@ struct HccWorkerJob {
 	void*            arg;
 };
 
+//
+// the number of times an idle worker will try to find a job
+// before going to sleep on the compiler's wake semaphore
+#define HCC_WORKER_IDLE_SPIN_COUNT 64
+
+//
+// the smallest share of the job queue that each worker's deque will get when there are many workers.
+// see hcc_compiler_worker_share_cap
+#define HCC_WORKER_JOB_DEQUE_MIN_CAP 256
+
+//
+// a fixed capacity Chase-Lev work stealing deque.
+// only the owning worker pushes and pops jobs from the bottom.
+// any other worker can steal jobs from the top when they are idle.
+typedef struct HccWorkerJobDeque HccWorkerJobDeque;
+struct HccWorkerJobDeque {
+	HccWorkerJob*       data;
+	uint32_t            cap; // power of two
+	HccAtomic(uint32_t) top_idx;
+	HccAtomic(uint32_t) bottom_idx;
+};
+
+void hcc_worker_job_deque_init(HccWorkerJobDeque* deque, uint32_t cap);
+void hcc_worker_job_deque_deinit(HccWorkerJobDeque* deque);
+bool hcc_worker_job_deque_push(HccWorkerJobDeque* deque, HccWorkerJob* job);
+bool hcc_worker_job_deque_pop(HccWorkerJobDeque* deque, HccWorkerJob* job_out);
+bool hcc_worker_job_deque_steal(HccWorkerJobDeque* deque, HccWorkerJob* job_out);
+
 typedef struct HccWorker HccWorker;
 struct HccWorker {
-	HccCompiler*   c;
-	HccCU*         cu;
-	HccWorkerJob   job;
-	HccThread      thread;
-	HccTime        job_start_time;
-	uint8_t        initialized_generators_bitset;
-	HccStack(char) string_buffer;
-	HccArenaAlctor arena_alctor;
-
-	HccATAGen      atagen;
-	HccASTGen      astgen;
-	HccASTLink     astlink;
-	HccAMLGen      amlgen;
-	HccAMLOpt      amlopt;
-	HccSPIRVGen    spirvgen;
-	HccSPIRVLink   spirvlink;
-};
+	HccCompiler*      c;
+	HccCU*            cu;
+	HccWorkerJob      job;
+	HccWorkerJobDeque job_deque;
+	HccThread         thread;
+	HccTime           job_start_time;
+	uint8_t           initialized_generators_bitset;
+	HccStack(char)    string_buffer;
+	HccArenaAlctor    arena_alctor;
+	HccLocation*      locations;       // a chunk of the w->cu location table that only this worker allocates from
+	uint32_t          locations_count; // the number of locations left in the chunk
+
+	HccATAGen         atagen;
+	HccASTGen         astgen;
+	HccASTLink        astlink;
+	HccAMLGen         amlgen;
+	HccAMLOpt         amlopt;
+	HccSPIRVGen       spirvgen;
+	HccSPIRVLink      spirvlink;
+};
+
+#define HCC_WORKER_LOCATIONS_CHUNK_COUNT 64
 
 void hcc_worker_init(HccWorker* w, HccCompiler* c, void* call_stack, uintptr_t call_stack_size, HccCompilerSetup* setup);
 void hcc_worker_deinit(HccWorker* w);
@@ -3651,19 +4526,28 @@ struct HccCompiler {
 	HccMutex                       wait_for_all_mutex;
 	HccResultData                  result_data;
 	HccDuration                    worker_job_type_durations[HCC_WORKER_JOB_TYPE_COUNT];
+	HccAMLOptPassStats             aml_opt_pass_stats[HCC_AML_OPT_PASS_COUNT];
 	HccDuration                    duration;
 	HccTime                        start_time;
+	//
+	// jobs given from threads that are not workers of this compiler
+	// and jobs that overflow a worker's deque go in here.
 	struct {
 		HccWorkerJob*              data;
-		uint32_t                   cap;
+		uint32_t                   cap; // power of two
 		HccAtomic(uint32_t)        head_idx;
 		HccAtomic(uint32_t)        tail_idx;
-		HccSemaphore               semaphore;
-	} worker_job_queue;
+		HccSpinMutex               mutex;
+	} injection_queue;
+	HccAtomic(uint32_t)            sleeping_workers_count;
+	HccSemaphore                   wake_semaphore;
 };
 
 void hcc_compiler_give_worker_job(HccCompiler* c, HccTask* t, HccWorkerJobType job_type, void* arg);
-bool hcc_compiler_take_or_wait_then_take_worker_job(HccCompiler* c, HccWorkerJob* job_out);
+void hcc_compiler_push_worker_job(HccCompiler* c, HccWorkerJob* job);
+bool hcc_compiler_find_worker_job(HccCompiler* c, HccWorker* w, HccWorkerJob* job_out);
+uint32_t hcc_compiler_worker_share_cap(uint32_t cap, uint32_t workers_count, uint32_t min_cap);
+bool hcc_compiler_take_or_wait_then_take_worker_job(HccCompiler* c, HccWorker* w, HccWorkerJob* job_out);
 
 // ===========================================
 //
@@ -3732,6 +4616,31 @@ enum {
 #define HCC_STRING_ID_INTRINSIC_END HCC_STRING_ID_USER_START
 };
 
+//
+// the intrinsic strings are generated by tools/intrinsics_gen.c into src/intrinsic_strings.c,
+// so they are in the executable and do not go through the string table hash table.
+// they are found with a perfect hash, the hash picks a bucket and that bucket's displacement picks the slot.
+// the strings are packed into rows of HCC_INTRINSIC_STRINGS_DATA_ROW_SIZE so each row can be a string literal.
+//
+#define HCC_INTRINSIC_STRINGS_DATA_ROW_SIZE 4096
+
+typedef struct HccIntrinsicString HccIntrinsicString;
+struct HccIntrinsicString {
+	uint32_t string_id;
+	uint32_t data_idx;
+	uint32_t size;
+};
+
+extern const uint16_t           hcc_intrinsic_strings_bucket_displacements[];
+extern const uint16_t           hcc_intrinsic_strings_slots[];
+extern const HccIntrinsicString hcc_intrinsic_strings[];
+extern const char               hcc_intrinsic_strings_data[][HCC_INTRINSIC_STRINGS_DATA_ROW_SIZE];
+
+HccHash64 hcc_intrinsic_string_hash(const char* data, uintptr_t size);
+uint32_t hcc_intrinsic_string_slot(HccHash64 hash, uint32_t displacement, uint32_t slots_count);
+bool hcc_intrinsic_string_find(HccString string, HccStringId* out);
+HccString hcc_intrinsic_string_get(uint32_t string_id);
+
 void hcc_string_table_init(HccStringTable* string_table, uint32_t data_grow_count, uint32_t data_reserve_cap, uint32_t entries_cap);
 void hcc_string_table_deinit(HccStringTable* string_table);
 HccStringId hcc_string_table_alloc_next_id(HccStringTable* string_table);
@@ -3759,6 +4668,7 @@ struct HccGS {
 	HccAllocEventFn                alloc_event_fn;
 	HccPathCanonicalizeFn          path_canonicalize_fn;
 	HccFileOpenReadFn              file_open_read_fn;
+	HccFileStatFn                  file_stat_fn;
 	HccArenaAlctor                 arena_alctor;
 	void*                          alloc_event_userdata;
 	HccStringTable                 string_table;
@@ -3767,18 +4677,25 @@ struct HccGS {
 	uint32_t                       code_file_lines_reserve_cap;
 	uint32_t                       code_file_pp_if_spans_grow_count;
 	uint32_t                       code_file_pp_if_spans_reserve_cap;
+	uint32_t                       code_files_generation;
+	HccAtomic(uint32_t)            code_file_cache_hits_count;
+	HccAtomic(uint32_t)            code_file_cache_misses_count;
+	HccAtomic(uint32_t)            code_file_cache_invalidated_count;
+	HccMemTracker                  mem_tracker;
 };
 
 extern HccGS _hcc_gs;
 
 typedef struct HccTLS HccTLS;
 struct HccTLS {
-	HccCompiler*    c;
-	HccWorker*      w;
-	HccResultData   result_data;
-	HccResultData*  jmp_result_data;
-	jmp_buf         jmp_loc;
-	uint32_t        jmp_loc_recursive_set_count;
+	HccCompiler*      c;
+	HccWorker*        w;
+	HccResultData     result_data;
+	HccResultData*    jmp_result_data;
+	jmp_buf           jmp_loc;
+	uint32_t          jmp_loc_recursive_set_count;
+	HccTask*          mem_tracker_task; // the task the memory reserved and committed on this thread is counted towards
+	HccMemTrackerIter mem_tracker_iter;
 };
 
 extern thread_local HccTLS _hcc_tls;
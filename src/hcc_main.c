@@ -1,4 +1,5 @@
 #include <stdlib.h>
+#include <inttypes.h>
 
 #include "core.c"
 #include "ata.c"
@@ -14,6 +15,7 @@
 #include "spirvlink.c"
 #include "metadatagen.c"
 #include "../interop/hcc_interop.c"
+#include "intrinsic_strings.c"
 #include "hcc.c"
 #include <hmaths.c>
 
@@ -21,30 +23,44 @@ void print_duration(const char* what, HccDuration d) {
 	printf("%s took: %.2fms\n", what, hcc_duration_to_f32_millisecs(d));
 }
 
-int main(int argc, char** argv) {
-	hcc_register_segfault_handler();
-
-	HccSetup hcc_setup = hcc_setup_default;
-	HCC_ENSURE(hcc_init(&hcc_setup));
+//
+// parses the integer that follows '-j'.
+// signs, 0 and values above HCC_WORKERS_COUNT_MAX are rejected.
+bool parse_workers_count(const char* a, uint32_t* workers_count_out) {
+	if (a[0] < '0' || a[0] > '9') {
+		return false;
+	}
 
-	HccOptions* options;
-	HccOptionsSetup options_setup = hcc_options_setup_default;
-	HCC_ENSURE(hcc_options_init(&options_setup, &options));
+	char* end_ptr;
+	errno = 0;
+	unsigned long num = strtoul(a, &end_ptr, 10);
+	if (*end_ptr != '\0' || errno == ERANGE || num == 0 || num > HCC_WORKERS_COUNT_MAX) {
+		return false;
+	}
 
-	HccCompiler* compiler;
-	HccCompilerSetup compiler_setup = hcc_compiler_setup_default;
-	HCC_ENSURE(hcc_compiler_init(&compiler_setup, &compiler));
+	*workers_count_out = num;
+	return true;
+}
 
-	HccTask* task;
-	HccTaskSetup task_setup = hcc_task_setup_default;
-	task_setup.options = options;
-	HCC_ENSURE(hcc_task_init(&task_setup, &task));
+//
+// the same as HCC_ENSURE but returns an exit code instead of exiting,
+// so a bad request to the compile server only fails that request.
+#define COMPILE_ENSURE(expr) { HccResult result__ = (expr); if (result__.code < 0) { hcc_result_print(#expr, result__); printf("\n"); return 1; } }
 
+//
+// compiles with the command line arguments in argv. compiler is created from the arguments when it is NULL.
+int compile_task(int argc, char** argv, HccCompiler* compiler, HccOptions* options, HccTask* task) {
 	int arg_idx = 1;
 	const char* output_file_path = NULL;
+	const char* output_entry_points_dir = NULL;
 	bool output_final_file = true;
 	bool has_input = false;
 	bool debug_time = false;
+	bool debug_opt_stats = false;
+	bool debug_mem = false;
+	bool spirv_val = false;
+	bool no_spirv_val = false;
+	uint32_t workers_count = 0; // 0 will use the number of logical cores
 	const char* hlsl_dir = NULL;
 	const char* msl_dir = NULL;
 	bool enable_stdout_color = true;
@@ -56,139 +72,237 @@ int main(int argc, char** argv) {
 			arg_idx += 1;
 			if (arg_idx == argc) {
 				fprintf(stderr, "'-I' is missing a following include path. eg. '-I path/to/directory'\n");
-				exit(1);
+				return 1;
 			}
 
 			const char* include_path = argv[arg_idx];
 			if (!hcc_path_exists(include_path)) {
 				fprintf(stderr, "-I '%s' path does not exist\n", include_path);
-				exit(1);
+				return 1;
 			}
 			if (!hcc_path_is_directory(include_path)) {
 				fprintf(stderr, "-I '%s' is not a directory\n", include_path);
-				exit(1);
+				return 1;
 			}
 
-			HCC_ENSURE(hcc_task_add_include_path(task, hcc_string_c((char*)include_path)));
+			COMPILE_ENSURE(hcc_task_add_include_path(task, hcc_string_c((char*)include_path)));
 		} else if (strcmp(argv[arg_idx], "-fi") == 0) {
 			arg_idx += 1;
 			if (arg_idx == argc) {
 				fprintf(stderr, "'-fi' is missing a following input file path to follow '-fi path/to/file.c'\n");
-				exit(1);
+				return 1;
 			}
 
 			const char* input_file_path = argv[arg_idx];
 			if (!hcc_path_exists(input_file_path)) {
 				fprintf(stderr, "-fi '%s' path does not exist\n", input_file_path);
-				exit(1);
+				return 1;
 			}
 			if (!hcc_path_is_file(input_file_path)) {
 				fprintf(stderr, "-fi '%s' is not a directory\n", input_file_path);
-				exit(1);
+				return 1;
 			}
 
 			const char* path = argv[arg_idx];
 			uint32_t path_size = strlen(path);
 			if (!(path_size > 2 && path[path_size - 2] == '.' && path[path_size - 1] == 'c')) {
 				fprintf(stderr, "'-fi %s' is supposed to have a .c file extension\n", path);
-				exit(1);
+				return 1;
 			}
 
-			HCC_ENSURE(hcc_task_add_input_code_file(task, input_file_path, NULL));
+			COMPILE_ENSURE(hcc_task_add_input_code_file(task, input_file_path, NULL));
 			has_input = true;
 		} else if (strcmp(argv[arg_idx], "-fo") == 0) {
 			arg_idx += 1;
 			if (arg_idx == argc) {
 				fprintf(stderr, "'-fo' is missing a following output file path to follow '-fo path/to/file.spirv'\n");
-				exit(1);
+				return 1;
 			}
 
 			const char* path = argv[arg_idx];
 			uint32_t path_size = strlen(path);
 			if (!(path_size > 6 && path[path_size - 6] == '.' && path[path_size - 5] == 's' && path[path_size - 4] == 'p' && path[path_size - 3] == 'i' && path[path_size - 2] == 'r' && path[path_size - 1] == 'v')) {
 				fprintf(stderr, "'-fo %s' is supposed to have a .spirv file extension\n", path);
-				exit(1);
+				return 1;
 			}
 
 			if (output_file_path) {
 				fprintf(stderr, "there can only be a single '-fo' argument... '-fo %s' is the second '-fo' argument\n", path);
-				exit(1);
+				return 1;
 			}
 
 			output_file_path = argv[arg_idx];
 			HccIIO* binary_iio = HCC_ARENA_ALCTOR_ALLOC_ELMT(HccIIO, &_hcc_gs.arena_alctor);
-			hcc_file_open_write(output_file_path, binary_iio);
-			HCC_ENSURE(hcc_task_add_output_binary(task, binary_iio));
+			if (!hcc_file_open_write(output_file_path, binary_iio)) {
+				fprintf(stderr, "-fo '%s' failed to open for writing\n", output_file_path);
+				return 1;
+			}
+			COMPILE_ENSURE(hcc_task_add_output_binary(task, binary_iio));
 		} else if (strcmp(argv[arg_idx], "-fomc") == 0) {
 			arg_idx += 1;
 			if (arg_idx == argc) {
 				fprintf(stderr, "'-fomc' is missing a following output file path. eg. '-fomc path/to/file.h\n");
-				exit(1);
+				return 1;
 			}
 
 			const char* path = argv[arg_idx];
 			uint32_t path_size = strlen(path);
 			if (!(path_size > 2 && path[path_size - 2] == '.' && path[path_size - 1] == 'h')) {
 				fprintf(stderr, "'-fomc %s' is supposed to have a .h file extension\n", path);
-				exit(1);
+				return 1;
 			}
 
 			HccIIO* iio = HCC_ARENA_ALCTOR_ALLOC_ELMT(HccIIO, &_hcc_gs.arena_alctor);
-			hcc_file_open_write(path, iio);
-			HCC_ENSURE(hcc_task_add_output_metadata_c(task, iio));
+			if (!hcc_file_open_write(path, iio)) {
+				fprintf(stderr, "-fomc '%s' failed to open for writing\n", path);
+				return 1;
+			}
+			COMPILE_ENSURE(hcc_task_add_output_metadata_c(task, iio));
 		} else if (strcmp(argv[arg_idx], "-fomjson") == 0) {
 			arg_idx += 1;
 			if (arg_idx == argc) {
 				fprintf(stderr, "'-fomjson' is missing a following output file path. eg. '-fomjson path/to/file.json\n");
-				exit(1);
+				return 1;
 			}
 
 			const char* path = argv[arg_idx];
 			uint32_t path_size = strlen(path);
 			if (!(path_size > 5 && path[path_size - 5] == '.' && path[path_size - 4] == 'j' && path[path_size - 3] == 's' && path[path_size - 2] == 'o' && path[path_size - 1] == 'n')) {
 				fprintf(stderr, "'-fomjson %s' is supposed to have a .json file extension\n", path);
-				exit(1);
+				return 1;
 			}
 
 			HccIIO* iio = HCC_ARENA_ALCTOR_ALLOC_ELMT(HccIIO, &_hcc_gs.arena_alctor);
-			hcc_file_open_write(path, iio);
-			HCC_ENSURE(hcc_task_add_output_metadata_json(task, iio));
+			if (!hcc_file_open_write(path, iio)) {
+				fprintf(stderr, "-fomjson '%s' failed to open for writing\n", path);
+				return 1;
+			}
+			COMPILE_ENSURE(hcc_task_add_output_metadata_json(task, iio));
+		} else if (strcmp(argv[arg_idx], "-foep") == 0) {
+			arg_idx += 1;
+			if (arg_idx == argc) {
+				fprintf(stderr, "'-foep' is missing a following directory path to follow '-foep path/to/directory'\n");
+				return 1;
+			}
+
+			if (output_entry_points_dir) {
+				fprintf(stderr, "there can only be a single '-foep' argument... '-foep %s' is the second '-foep' argument\n", argv[arg_idx]);
+				return 1;
+			}
+
+			output_entry_points_dir = argv[arg_idx];
+			if (hcc_task_add_output_entry_point_binaries(task, output_entry_points_dir).code != HCC_SUCCESS) {
+				fprintf(stderr, "-foep '%s' is not a directory and it could not be made\n", output_entry_points_dir);
+				return 1;
+			}
+		} else if (strcmp(argv[arg_idx], "-j") == 0) {
+			arg_idx += 1;
+			if (arg_idx == argc) {
+				fprintf(stderr, "'-j' is missing a following integer for the number of worker threads. eg. '-j 4'\n");
+				return 1;
+			}
+
+			const char* a = argv[arg_idx];
+			if (!parse_workers_count(a, &workers_count)) {
+				fprintf(stderr, "'-j %s' argument is not an integer between 1 and %u\n", a, HCC_WORKERS_COUNT_MAX);
+				return 1;
+			}
+		} else if (strcmp(argv[arg_idx], "--ast-cache") == 0) {
+			arg_idx += 1;
+			if (arg_idx == argc) {
+				fprintf(stderr, "'--ast-cache' is missing a following file path to follow '--ast-cache path/to/file.hccast'\n");
+				return 1;
+			}
+
+			//
+			// load the AST from the last compile if it exists and write it back out for the next one
+			const char* path = argv[arg_idx];
+			HccIIO input_iio;
+			if (hcc_file_open_read(path, &input_iio) && !HCC_IS_SUCCESS(hcc_task_add_input_ast_binary(task, &input_iio))) {
+				fprintf(stderr, "warning: --ast-cache '%s' could not be read or is corrupt, the inputs will be fully compiled and it will be written again\n", path);
+			}
+
+			HccIIO* output_iio = HCC_ARENA_ALCTOR_ALLOC_ELMT(HccIIO, &_hcc_gs.arena_alctor);
+			if (!hcc_file_open_write(path, output_iio)) {
+				fprintf(stderr, "--ast-cache '%s' failed to open for writing\n", path);
+				return 1;
+			}
+			COMPILE_ENSURE(hcc_task_add_output_ast_binary(task, output_iio));
+		} else if (strcmp(argv[arg_idx], "--aml-cache") == 0) {
+			arg_idx += 1;
+			if (arg_idx == argc) {
+				fprintf(stderr, "'--aml-cache' is missing a following file path to follow '--aml-cache path/to/file.hccaml'\n");
+				return 1;
+			}
+
+			//
+			// load the AML from the last compile if it exists and write it back out for the next one
+			const char* path = argv[arg_idx];
+			HccIIO input_iio;
+			if (hcc_file_open_read(path, &input_iio) && !HCC_IS_SUCCESS(hcc_task_add_input_aml_binary(task, &input_iio))) {
+				fprintf(stderr, "warning: --aml-cache '%s' could not be read or is corrupt, the inputs will be fully compiled and it will be written again\n", path);
+			}
+
+			HccIIO* output_iio = HCC_ARENA_ALCTOR_ALLOC_ELMT(HccIIO, &_hcc_gs.arena_alctor);
+			if (!hcc_file_open_write(path, output_iio)) {
+				fprintf(stderr, "--aml-cache '%s' failed to open for writing\n", path);
+				return 1;
+			}
+			COMPILE_ENSURE(hcc_task_add_output_aml_binary(task, output_iio));
 		} else if (strcmp(argv[arg_idx], "-O") == 0) {
+			hcc_options_set_u32(options, HCC_OPTION_KEY_OPT_LEVEL, HCC_OPT_LEVEL_2);
+		} else if (strcmp(argv[arg_idx], "--spirv-opt") == 0) {
 			hcc_options_set_bool(options, HCC_OPTION_KEY_SPIRV_OPT, true);
+		} else if (strcmp(argv[arg_idx], "--spirv-val") == 0) {
+			spirv_val = true;
+		} else if (strcmp(argv[arg_idx], "--no-spirv-val") == 0) {
+			no_spirv_val = true;
+		} else if (strcmp(argv[arg_idx], "-O0") == 0) {
+			hcc_options_set_u32(options, HCC_OPTION_KEY_OPT_LEVEL, HCC_OPT_LEVEL_0);
+		} else if (strcmp(argv[arg_idx], "-O1") == 0) {
+			hcc_options_set_u32(options, HCC_OPTION_KEY_OPT_LEVEL, HCC_OPT_LEVEL_1);
+		} else if (strcmp(argv[arg_idx], "-O2") == 0) {
+			hcc_options_set_u32(options, HCC_OPTION_KEY_OPT_LEVEL, HCC_OPT_LEVEL_2);
+		} else if (strcmp(argv[arg_idx], "-O3") == 0) {
+			hcc_options_set_u32(options, HCC_OPTION_KEY_OPT_LEVEL, HCC_OPT_LEVEL_3);
+		} else if (strcmp(argv[arg_idx], "-Os") == 0) {
+			hcc_options_set_u32(options, HCC_OPTION_KEY_OPT_LEVEL, HCC_OPT_LEVEL_S);
+		} else if (strcmp(argv[arg_idx], "-Og") == 0) {
+			hcc_options_set_u32(options, HCC_OPTION_KEY_OPT_LEVEL, HCC_OPT_LEVEL_G);
 		} else if (strcmp(argv[arg_idx], "--hlsl-packing") == 0) {
 			hcc_options_set_bool(options, HCC_OPTION_KEY_HLSL_PACKING, true);
 		} else if (strcmp(argv[arg_idx], "--hlsl") == 0) {
 			arg_idx += 1;
 			if (arg_idx == argc) {
 				fprintf(stderr, "'--hlsl' is missing a following input directory path to follow '--hlsl path/to/directory'\n");
-				exit(1);
+				return 1;
 			}
 
 			hlsl_dir = argv[arg_idx];
 
 			if (hcc_path_exists(hlsl_dir) && hcc_path_is_file(hlsl_dir)) {
 				fprintf(stderr, "--hlsl '%s' path is a file and not a directory\n", hlsl_dir);
-				exit(1);
+				return 1;
 			}
 			hcc_options_set_bool(options, HCC_OPTION_KEY_HLSL_PACKING, true);
 		} else if (strcmp(argv[arg_idx], "--msl") == 0) {
 			arg_idx += 1;
 			if (arg_idx == argc) {
 				fprintf(stderr, "'--msl' is missing a following input directory path to follow '--msl path/to/directory'\n");
-				exit(1);
+				return 1;
 			}
 
 			msl_dir = argv[arg_idx];
 
 			if (hcc_path_exists(msl_dir) && hcc_path_is_file(msl_dir)) {
 				fprintf(stderr, "--msl '%s' path is a file and not a directory\n", msl_dir);
-				exit(1);
+				return 1;
 			}
 		} else if (strcmp(argv[arg_idx], "--max-descriptors") == 0) {
 			arg_idx += 1;
 			if (arg_idx == argc) {
 				fprintf(stderr, "'--max-descriptors' is missing a following integer for the maximum number of descriptors\n");
-				exit(1);
+				return 1;
 			}
 
 			const char* a = argv[arg_idx];
@@ -198,7 +312,7 @@ int main(int argc, char** argv) {
 			long num = strtoul(a, &end_ptr, 10);
 			if (a + size != end_ptr) {
 				fprintf(stderr, "'--max-descriptors %s' argument is not an unsigned integer\n", a);
-				exit(1);
+				return 1;
 			}
 
 			hcc_options_set_u32(options, HCC_OPTION_KEY_RESOURCE_DESCRIPTORS_MAX, num);
@@ -206,7 +320,7 @@ int main(int argc, char** argv) {
 			arg_idx += 1;
 			if (arg_idx == argc) {
 				fprintf(stderr, "'--max-bc-size' is missing a following integer for the maximum number of descriptors\n");
-				exit(1);
+				return 1;
 			}
 
 			const char* a = argv[arg_idx];
@@ -216,7 +330,7 @@ int main(int argc, char** argv) {
 			long num = strtoul(a, &end_ptr, 10);
 			if (a + size != end_ptr) {
 				fprintf(stderr, "'--max-bc-size %s' argument is not an unsigned integer\n", a);
-				exit(1);
+				return 1;
 			}
 
 			hcc_options_set_u32(options, HCC_OPTION_KEY_BUNDLED_CONSTANTS_MAX_SIZE, num);
@@ -236,25 +350,32 @@ int main(int argc, char** argv) {
 			hcc_options_set_bool(options, HCC_OPTION_KEY_UNORDERED_SWIZZLING_ENABLED, true);
 		} else if (strcmp(argv[arg_idx], "--debug-time") == 0) {
 			debug_time = true;
+		} else if (strcmp(argv[arg_idx], "--debug-opt-stats") == 0) {
+			debug_opt_stats = true;
+		} else if (strcmp(argv[arg_idx], "--debug-mem") == 0) {
+			debug_mem = true;
 		} else if (strcmp(argv[arg_idx], "--debug-ata") == 0) {
 			HccIIO* stdout_iio = HCC_ARENA_ALCTOR_ALLOC_ELMT(HccIIO, &_hcc_gs.arena_alctor);
 			*stdout_iio = hcc_iio_file(stdout);
+			stdout_iio->close_fn = NULL; // the messages are printed to stdout after this
 			hcc_iio_set_ascii_colors_enabled(stdout_iio, enable_stdout_color);
-			HCC_ENSURE(hcc_task_add_output_ast_text(task, stdout_iio));
+			COMPILE_ENSURE(hcc_task_add_output_ast_text(task, stdout_iio));
 			hcc_task_set_final_worker_job_type(task, HCC_WORKER_JOB_TYPE_ATAGEN);
 			output_final_file = false;
 		} else if (strcmp(argv[arg_idx], "--debug-ast") == 0) {
 			HccIIO* stdout_iio = HCC_ARENA_ALCTOR_ALLOC_ELMT(HccIIO, &_hcc_gs.arena_alctor);
 			*stdout_iio = hcc_iio_file(stdout);
+			stdout_iio->close_fn = NULL; // the messages are printed to stdout after this
 			hcc_iio_set_ascii_colors_enabled(stdout_iio, enable_stdout_color);
-			HCC_ENSURE(hcc_task_add_output_ast_text(task, stdout_iio));
+			COMPILE_ENSURE(hcc_task_add_output_ast_text(task, stdout_iio));
 			hcc_task_set_final_worker_job_type(task, HCC_WORKER_JOB_TYPE_ASTLINK);
 			output_final_file = false;
 		} else if (strcmp(argv[arg_idx], "--debug-aml") == 0) {
 			HccIIO* stdout_iio = HCC_ARENA_ALCTOR_ALLOC_ELMT(HccIIO, &_hcc_gs.arena_alctor);
 			*stdout_iio = hcc_iio_file(stdout);
+			stdout_iio->close_fn = NULL; // the messages are printed to stdout after this
 			hcc_iio_set_ascii_colors_enabled(stdout_iio, enable_stdout_color);
-			HCC_ENSURE(hcc_task_add_output_aml_text(task, stdout_iio));
+			COMPILE_ENSURE(hcc_task_add_output_aml_text(task, stdout_iio));
 			hcc_task_set_final_worker_job_type(task, HCC_WORKER_JOB_TYPE_AMLOPT);
 			output_final_file = false;
 		} else if (strcmp(argv[arg_idx], "--help") == 0) {
@@ -265,8 +386,15 @@ int main(int argc, char** argv) {
 				"\t-fi   <path>.c               | <path>.c to a C file to compile\n"
 				"\t-fo   <path>.spirv           | <path>.spirv to where you want the output file to go\n"
 				"\t-fomc <path>.h               | <path>.h to where you want the output metadata file to go\n"
+				"\t-foep <dir>                  | <dir> to where you want a <entry point name>.spirv file to go for each entry point, with only what that entry point uses\n"
 				"\t-I    <path>                 | add an include search directory path for #include <...>\n"
-				"\t-O                           | turn on optimizations, currently using spirv-opt\n"
+				"\t-j    <int>                  | the number of worker threads to compile with, defaults to the number of logical cores\n"
+				"\t-O                           | turn on optimizations, the same as -O2\n"
+				"\t--spirv-opt                  | also runs spirv-opt -O on the output file. requires the SPIR-V tools to be installed\n"
+				"\t--spirv-val                  | validates the output file with spirv-val, warns if the SPIR-V tools are not installed. this is on by default when spirv-val is in the PATH\n"
+				"\t--no-spirv-val               | do not run spirv-val on the output file\n"
+				"\t--ast-cache <path>           | loads the AST from <path> to skip parsing when none of the inputs have changed, then writes it back out\n"
+				"\t--aml-cache <path>           | loads the optimized AML from <path> to only run the backend when none of the inputs it was made from have changed, then writes it back out\n"
 				"\t--hlsl-packing               | errors on bundled constants if they do not follow the HLSL packing rules for cbuffers. --hlsl also enables this\n"
 				"\t--hlsl <path>                | path to a directory where the HLSL files will go. requires spirv-cross to be installed\n"
 				"\t--msl  <path>                | path to a directory where the MSL files will go. requires spirv-cross to be installed\n"
@@ -279,17 +407,21 @@ int main(int argc, char** argv) {
 				"\t--enable-float16             | enables 16bit float support\n"
 				"\t--enable-float64             | enables 64bit float support\n"
 				"\t--enable-unordered-swizzling | allows for vector swizzling x, y, z, w out of order eg. .zyx or .xx or .yyzz \n"
+				"\t--server <path>              | must be the first argument. stays running and compiles the requests sent by '--connect <path>' with a warm compiler, '-j <int>' may follow\n"
+				"\t--connect <path> <args...>   | must be the first argument. compiles <args...> on the 'hcc --server <path>' instead of starting a new compiler\n"
 				"\t--help                       | displays this prompt and then exits\n"
 				"\t--debug-time                 | prints the duration of each compiliation stage of the compiler\n"
+				"\t--debug-opt-stats            | prints the duration of each AML optimization pass and the words, values and basic blocks before and after it\n"
+				"\t--debug-mem                  | prints the memory reserved and committed for each allocation tag, the arena high-water mark of each worker and the totals of the compile\n"
 				"\t--debug-ata                  | prints the Abstract Token Array made by the compiler, it will stop after ATAGEN stage\n"
 				"\t--debug-ast                  | prints the Abstract Syntax Tree made by the compiler, it will stop after ASTGEN stage\n"
 				"\t--debug-aml                  | prints the Abstract Machine Language made by the compiler, it will stop after AMLGEN stage\n"
 				, argv[0]
 			);
-			exit(0);
+			return 0;
 		} else {
 			fprintf(stderr, "invalid argument '%s'\n", argv[arg_idx]);
-			exit(1);
+			return 1;
 		}
 
 		arg_idx += 1;
@@ -297,30 +429,36 @@ int main(int argc, char** argv) {
 
 	{
 		HccString path = hcc_path_replace_file_name(hcc_string_c(argv[0]), hcc_string_lit("libc"));
-		HCC_ENSURE(hcc_task_add_include_path(task, path));
+		COMPILE_ENSURE(hcc_task_add_include_path(task, path));
 	}
 
 	{
 		HccString path = hcc_path_replace_file_name(hcc_string_c(argv[0]), hcc_string_lit("libhccintrinsics"));
-		HCC_ENSURE(hcc_task_add_include_path(task, path));
+		COMPILE_ENSURE(hcc_task_add_include_path(task, path));
 	}
 
 	{
 		HccString path = hcc_path_replace_file_name(hcc_string_c(argv[0]), hcc_string_lit("libhmaths"));
-		HCC_ENSURE(hcc_task_add_include_path(task, path));
+		COMPILE_ENSURE(hcc_task_add_include_path(task, path));
 
 		path = hcc_path_replace_file_name(hcc_string_c(argv[0]), hcc_string_lit("libhmaths/hmaths.c"));
-		HCC_ENSURE(hcc_task_add_input_code_file(task, path.data, NULL));
+		COMPILE_ENSURE(hcc_task_add_input_code_file(task, path.data, NULL));
 	}
 
 	if (!has_input) {
 		fprintf(stderr, "missing input file/s. please call hcc with one or more '-fi' flag/s followed by the .c file/s you wish to compile\n");
-		exit(1);
+		return 1;
 	}
 
-	if (!output_file_path) {
-		fprintf(stderr, "missing the output file. please call hcc with a '-fo' flag followed by the .spirv file you wish to output\n");
-		exit(1);
+	if (!output_file_path && !output_entry_points_dir) {
+		fprintf(stderr, "missing the output file. please call hcc with a '-fo' flag followed by the .spirv file you wish to output or a '-foep' flag followed by a directory for a .spirv file per entry point\n");
+		return 1;
+	}
+
+	if (!compiler) {
+		HccCompilerSetup compiler_setup = hcc_compiler_setup_default;
+		compiler_setup.workers_count = workers_count;
+		COMPILE_ENSURE(hcc_compiler_init(&compiler_setup, &compiler));
 	}
 
 	hcc_compiler_dispatch_task(compiler, task);
@@ -341,20 +479,27 @@ int main(int argc, char** argv) {
 	if (result.code == HCC_ERROR_MESSAGES) {
 		return 1;
 	} else {
-		HCC_ENSURE(result);
+		COMPILE_ENSURE(result);
 
 		if (output_file_path && output_final_file) {
+			//
+			// the AML optimizer does the work that spirv-opt is needed for, so it is only run when asked for.
+			// spirv-val still runs by default, but only when it can be found so a missing install does not warn on every compile.
+			if (!spirv_val && !no_spirv_val) {
+				spirv_val = hcc_executable_is_in_path("spirv-val" HCC_EXE_EXTENSION);
+			}
 			char shell_command[1024];
+			shell_command[0] = '\0';
 			if (hcc_options_get_bool(options, HCC_OPTION_KEY_SPIRV_OPT)) {
 				snprintf(shell_command, sizeof(shell_command), "spirv-opt%s --scalar-block-layout -O -o %s %s", HCC_EXE_EXTENSION, output_file_path, output_file_path);
-			} else {
+			} else if (spirv_val && !no_spirv_val) {
 				snprintf(shell_command, sizeof(shell_command), "spirv-val%s --scalar-block-layout %s", HCC_EXE_EXTENSION, output_file_path);
 			}
-			int res = hcc_execute_shell_command(shell_command);
+			int res = shell_command[0] ? hcc_execute_shell_command(shell_command) : 0;
 			if (res != 0) {
 				if (res == 1 || res == 256 /* 1 || 256 is return by the SPIR-V tools for a general error */) {
 					printf("Please report this error on the HCC github issue tracker\n");
-					exit(1);
+					return 1;
 				} else {
 					printf(
 						"WARNING: successfully wrote output file '%s' but failed to execute '%s'.\n"
@@ -371,7 +516,7 @@ int main(int argc, char** argv) {
 					char buf[1024];
 					hcc_get_last_system_error_string(buf, sizeof(buf));
 					fprintf(stderr, "failed to make directory at '%s': %s\n", hlsl_dir, buf);
-					exit(1);
+					return 1;
 				}
 
 				for (uint32_t shader_idx = 0; shader_idx < hcc_stack_count(cu->shader_function_decls); shader_idx += 1) {
@@ -389,7 +534,7 @@ int main(int argc, char** argv) {
 					if (res != 0) {
 						if (res == 256 /* 256 is return by the SPIR-V tools for a general error */) {
 							printf("Please report this error on the HCC github issue tracker\n");
-							exit(1);
+							return 1;
 						} else {
 							printf(
 								"WARNING: successfully wrote output file '%s' but failed to execute '%s'.\n"
@@ -409,7 +554,7 @@ int main(int argc, char** argv) {
 					char buf[1024];
 					hcc_get_last_system_error_string(buf, sizeof(buf));
 					fprintf(stderr, "failed to make directory at '%s': %s\n", msl_dir, buf);
-					exit(1);
+					return 1;
 				}
 
 				for (uint32_t shader_idx = 0; shader_idx < hcc_stack_count(cu->shader_function_decls); shader_idx += 1) {
@@ -427,7 +572,7 @@ int main(int argc, char** argv) {
 					if (res != 0) {
 						if (res == 256 /* 256 is return by the SPIR-V tools for a general error */) {
 							printf("Please report this error on the HCC github issue tracker\n");
-							exit(1);
+							return 1;
 						} else {
 							printf(
 								"WARNING: successfully wrote output file '%s' but failed to execute '%s'.\n"
@@ -455,6 +600,369 @@ int main(int argc, char** argv) {
 		}
 	}
 
+	if (debug_opt_stats) {
+		printf("%-32s %8s %10s %22s %22s %22s\n", "AMLOPT pass", "runs", "ms", "words", "values", "basic blocks");
+		for (HccAMLOptPass pass = 0; pass < HCC_AML_OPT_PASS_COUNT; pass += 1) {
+			HccAMLOptPassStats stats = hcc_compiler_aml_opt_pass_stats(compiler, pass);
+			if (stats.runs_count == 0) {
+				continue;
+			}
+
+			printf(
+				"%-32s %8u %10.2f %10"PRIu64" -> %-8"PRIu64" %10"PRIu64" -> %-8"PRIu64" %10"PRIu64" -> %-8"PRIu64"\n",
+				hcc_aml_opt_pass_strings[pass], stats.runs_count, hcc_duration_to_f64_millisecs(stats.duration),
+				stats.words_count_before, stats.words_count_after,
+				stats.values_count_before, stats.values_count_after,
+				stats.basic_blocks_count_before, stats.basic_blocks_count_after
+			);
+		}
+	}
+
+	if (debug_mem) {
+		hcc_mem_tracker_log(&iio, compiler, task);
+	}
+
+	return 0;
+}
+
+
+int compile(int argc, char** argv, HccCompiler* compiler) {
+	HccOptions* options;
+	HccOptionsSetup options_setup = hcc_options_setup_default;
+	COMPILE_ENSURE(hcc_options_init(&options_setup, &options));
+
+	HccTask* task;
+	HccTaskSetup task_setup = hcc_task_setup_default;
+	task_setup.options = options;
+	HccResult result = hcc_task_init(&task_setup, &task);
+	if (!HCC_IS_SUCCESS(result)) {
+		hcc_result_print("hcc_task_init(&task_setup, &task)", result);
+		printf("\n");
+		hcc_options_deinit(options);
+		return 1;
+	}
+
+	int exit_code = compile_task(argc, argv, compiler, options, task);
+
+	hcc_task_deinit(task);
+	hcc_options_deinit(options);
+	return exit_code;
+}
+
+// ===========================================
+//
+//
+// Compile Server
+//
+//
+// ===========================================
+//
+// 'hcc --server <path>' keeps the compiler, its workers and its caches resident and compiles the requests sent to the local socket at <path>.
+// 'hcc --connect <path> <args...>' is a client that sends its working directory and arguments to the server,
+// then prints what the compile printed and exits with the same code.
+// requests are compiled one at a time in the order they connect, each compile still uses all of the workers.
+// a request that fails, even with an internal error, only sends back its exit code and messages and the server carries on.
+//
+// request:  HccServerRequestHeader, the working directory then each argument as null terminated strings
+// response: HccServerResponseHeader, what the compile printed to stdout then what it printed to stderr
+//
+// the server is on the same machine, so it writes the output files itself relative to the client's working directory
+// and the binaries are not sent back over the socket.
+//
+
+#define HCC_SERVER_REQUEST_MAGIC  0x51434348 // "HCCQ"
+#define HCC_SERVER_RESPONSE_MAGIC 0x52434348 // "HCCR"
+#define HCC_SERVER_VERSION        1
+#define HCC_SERVER_ARGS_MAX       1024
+#define HCC_SERVER_STRINGS_MAX    (1024 * 1024)
+
+typedef struct HccServerRequestHeader HccServerRequestHeader;
+struct HccServerRequestHeader {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t args_count; // not including the working directory
+	uint32_t strings_size;
+};
+
+typedef struct HccServerResponseHeader HccServerResponseHeader;
+struct HccServerResponseHeader {
+	uint32_t magic;
+	int32_t  exit_code;
+	uint32_t stdout_size;
+	uint32_t stderr_size;
+};
+
+#ifdef HCC_OS_LINUX
+
+bool server_send_file(HccLocalSocket s, FILE* f, uint32_t size) {
+	char buf[4096];
+	rewind(f);
+	while (size) {
+		uint32_t read_size = fread(buf, 1, HCC_MIN(size, sizeof(buf)), f);
+		if (read_size == 0 || !hcc_local_socket_send(s, buf, read_size)) {
+			return false;
+		}
+		size -= read_size;
+	}
+	return true;
+}
+
+void server_handle_request(HccLocalSocket s, HccCompiler* compiler, const char* exe_path, HccStack(char) strings, HccStack(char*) args) {
+	HccServerRequestHeader request;
+	if (
+		!hcc_local_socket_recv(s, &request, sizeof(request)) ||
+		request.magic != HCC_SERVER_REQUEST_MAGIC ||
+		request.version != HCC_SERVER_VERSION ||
+		request.args_count > HCC_SERVER_ARGS_MAX ||
+		request.strings_size == 0 ||
+		request.strings_size > HCC_SERVER_STRINGS_MAX
+	) {
+		return;
+	}
+
+	hcc_stack_resize(strings, request.strings_size);
+	hcc_stack_resize(args, request.args_count + 2);
+	if (!hcc_local_socket_recv(s, strings, request.strings_size) || strings[request.strings_size - 1] != '\0') {
+		return;
+	}
+
+	//
+	// split the strings up in to the working directory and the arguments
+	const char* working_dir = strings;
+	uint32_t args_count = 1;
+	args[0] = (char*)exe_path;
+	for (uint32_t idx = strlen(strings) + 1; idx < request.strings_size; idx += strlen(&strings[idx]) + 1) {
+		if (args_count == request.args_count + 1) {
+			return;
+		}
+		args[args_count] = &strings[idx];
+		args_count += 1;
+	}
+	if (args_count != request.args_count + 1) {
+		return;
+	}
+	args[args_count] = NULL;
+
+	//
+	// capture everything printed by the compile, including the SPIR-V tools it runs, so it can be sent back to the client
+	FILE* stdout_file = tmpfile();
+	FILE* stderr_file = tmpfile();
+	if (!stdout_file || !stderr_file) {
+		goto END;
+	}
+	fflush(stdout);
+	fflush(stderr);
+	int saved_stdout_fd = dup(STDOUT_FILENO);
+	int saved_stderr_fd = dup(STDERR_FILENO);
+	dup2(fileno(stdout_file), STDOUT_FILENO);
+	dup2(fileno(stderr_file), STDERR_FILENO);
+
+	int exit_code;
+	if (chdir(working_dir) == 0) {
+		exit_code = compile(args_count, args, compiler);
+
+		//
+		// the task has been deinitialized, so nothing points in to the worker arenas anymore
+		HccResult result = hcc_compiler_clear_mem_arenas(compiler);
+		if (!HCC_IS_SUCCESS(result)) {
+			hcc_result_print("hcc_compiler_clear_mem_arenas(compiler)", result);
+			printf("\n");
+			exit_code = 1;
+		}
+	} else {
+		char buf[1024];
+		hcc_get_last_system_error_string(buf, sizeof(buf));
+		fprintf(stderr, "hcc server failed to change to the working directory '%s': %s\n", working_dir, buf);
+		exit_code = 1;
+	}
+
+	fflush(stdout);
+	fflush(stderr);
+	dup2(saved_stdout_fd, STDOUT_FILENO);
+	dup2(saved_stderr_fd, STDERR_FILENO);
+	close(saved_stdout_fd);
+	close(saved_stderr_fd);
+
+	HccServerResponseHeader response = {
+		.magic = HCC_SERVER_RESPONSE_MAGIC,
+		.exit_code = exit_code,
+		.stdout_size = ftell(stdout_file),
+		.stderr_size = ftell(stderr_file),
+	};
+	if (hcc_local_socket_send(s, &response, sizeof(response))) {
+		if (server_send_file(s, stdout_file, response.stdout_size)) {
+			server_send_file(s, stderr_file, response.stderr_size);
+		}
+	}
+
+END: {}
+	if (stdout_file) {
+		fclose(stdout_file);
+	}
+	if (stderr_file) {
+		fclose(stderr_file);
+	}
+}
+
+int server(int argc, char** argv) {
+	if (argc < 3) {
+		fprintf(stderr, "'--server' is missing a following socket path. eg. '--server /tmp/hcc.sock'\n");
+		return 1;
+	}
+	const char* socket_path = argv[2];
+
+	uint32_t workers_count = 0; // 0 will use the number of logical cores
+	if (argc == 5 && strcmp(argv[3], "-j") == 0) {
+		if (!parse_workers_count(argv[4], &workers_count)) {
+			fprintf(stderr, "'-j %s' argument is not an integer between 1 and %u\n", argv[4], HCC_WORKERS_COUNT_MAX);
+			return 1;
+		}
+	} else if (argc != 3) {
+		fprintf(stderr, "'--server' only takes a socket path and an optional '-j <int>'. eg. '--server /tmp/hcc.sock -j 8'\n");
+		return 1;
+	}
+
+	//
+	// the include paths are found next to the executable, so make its path absolute before the requests change the working directory
+	HccString exe_path = hcc_path_canonicalize(argv[0]);
+	if (exe_path.size == 0) {
+		exe_path = hcc_string_c(argv[0]);
+	}
+
+	HccCompiler* compiler;
+	HccCompilerSetup compiler_setup = hcc_compiler_setup_default;
+	compiler_setup.workers_count = workers_count;
+	HCC_ENSURE(hcc_compiler_init(&compiler_setup, &compiler));
+
+	HccLocalSocket listener;
+	if (!hcc_local_socket_listen(socket_path, &listener)) {
+		char buf[1024];
+		hcc_get_last_system_error_string(buf, sizeof(buf));
+		fprintf(stderr, "--server '%s' failed to listen: %s\n", socket_path, buf);
+		return 1;
+	}
+
+	HccStack(char) strings = hcc_stack_init(char, HCC_ALLOC_TAG_NONE, 4096, HCC_SERVER_STRINGS_MAX);
+	HccStack(char*) args = hcc_stack_init(char*, HCC_ALLOC_TAG_NONE, 64, HCC_SERVER_ARGS_MAX + 2);
+
+	printf("hcc server is listening on '%s'\n", socket_path);
+	fflush(stdout);
+	while (1) {
+		HccLocalSocket s;
+		if (!hcc_local_socket_accept(listener, &s)) {
+			continue;
+		}
+
+		server_handle_request(s, compiler, exe_path.data, strings, args);
+		hcc_local_socket_close(s);
+	}
+
 	return 0;
 }
 
+bool client_print(HccLocalSocket s, FILE* f, uint32_t size) {
+	char buf[4096];
+	while (size) {
+		uint32_t recv_size = HCC_MIN(size, sizeof(buf));
+		if (!hcc_local_socket_recv(s, buf, recv_size)) {
+			return false;
+		}
+		fwrite(buf, 1, recv_size, f);
+		size -= recv_size;
+	}
+	return true;
+}
+
+int client(int argc, char** argv) {
+	if (argc < 3) {
+		fprintf(stderr, "'--connect' is missing a following socket path. eg. '--connect /tmp/hcc.sock -fi shader.c -fo shader.spirv'\n");
+		return 1;
+	}
+	const char* socket_path = argv[2];
+
+	char working_dir[PATH_MAX];
+	if (!getcwd(working_dir, sizeof(working_dir))) {
+		fprintf(stderr, "failed to get the working directory\n");
+		return 1;
+	}
+
+	HccServerRequestHeader request = {
+		.magic = HCC_SERVER_REQUEST_MAGIC,
+		.version = HCC_SERVER_VERSION,
+		.args_count = argc - 3,
+		.strings_size = strlen(working_dir) + 1,
+	};
+	for (int arg_idx = 3; arg_idx < argc; arg_idx += 1) {
+		request.strings_size += strlen(argv[arg_idx]) + 1;
+	}
+	if (request.args_count > HCC_SERVER_ARGS_MAX || request.strings_size > HCC_SERVER_STRINGS_MAX) {
+		fprintf(stderr, "too many arguments to send to the hcc server\n");
+		return 1;
+	}
+
+	HccLocalSocket s;
+	if (!hcc_local_socket_connect(socket_path, &s)) {
+		char buf[1024];
+		hcc_get_last_system_error_string(buf, sizeof(buf));
+		fprintf(stderr, "--connect '%s' failed to connect, is 'hcc --server %s' running?: %s\n", socket_path, socket_path, buf);
+		return 1;
+	}
+
+	bool is_sent = hcc_local_socket_send(s, &request, sizeof(request)) && hcc_local_socket_send(s, working_dir, strlen(working_dir) + 1);
+	for (int arg_idx = 3; is_sent && arg_idx < argc; arg_idx += 1) {
+		is_sent = hcc_local_socket_send(s, argv[arg_idx], strlen(argv[arg_idx]) + 1);
+	}
+
+	HccServerResponseHeader response;
+	if (
+		!is_sent ||
+		!hcc_local_socket_recv(s, &response, sizeof(response)) ||
+		response.magic != HCC_SERVER_RESPONSE_MAGIC ||
+		!client_print(s, stdout, response.stdout_size) ||
+		!client_print(s, stderr, response.stderr_size)
+	) {
+		fprintf(stderr, "--connect '%s' lost the connection to the hcc server\n", socket_path);
+		hcc_local_socket_close(s);
+		return 1;
+	}
+
+	hcc_local_socket_close(s);
+	return response.exit_code;
+}
+
+#else // !HCC_OS_LINUX
+
+int server(int argc, char** argv) {
+	HCC_UNUSED(argc);
+	HCC_UNUSED(argv);
+	fprintf(stderr, "'--server' is only supported on Linux\n");
+	return 1;
+}
+
+int client(int argc, char** argv) {
+	HCC_UNUSED(argc);
+	HCC_UNUSED(argv);
+	fprintf(stderr, "'--connect' is only supported on Linux\n");
+	return 1;
+}
+
+#endif // HCC_OS_LINUX
+
+int main(int argc, char** argv) {
+	hcc_register_segfault_handler();
+
+	//
+	// the client does not initialize hcc, that is the start up time it is here to avoid
+	if (argc > 1 && strcmp(argv[1], "--connect") == 0) {
+		return client(argc, argv);
+	}
+
+	HccSetup hcc_setup = hcc_setup_default;
+	HCC_ENSURE(hcc_init(&hcc_setup));
+
+	if (argc > 1 && strcmp(argv[1], "--server") == 0) {
+		return server(argc, argv);
+	}
+
+	return compile(argc, argv, NULL);
+}
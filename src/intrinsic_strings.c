@@ -0,0 +1,19031 @@
+// !?!?!?!?!?!?!?!?!?!?!?!?!?!?!?!?!
+// !?!?!? WARNING CONTRIBUTOR ?!?!?!
+// !?!?!?!?!?!?!?!?!?!?!?!?!?!?!?!?!
+// this file is generated by tools/intrinsics_gen.c
+// please edit that file and regenerate this one if you want to make edits
+
+#define HCC_INTRINSIC_STRINGS_COUNT 8352
+#define HCC_INTRINSIC_STRINGS_BUCKETS_COUNT 4096
+#define HCC_INTRINSIC_STRINGS_SLOTS_COUNT 32768
+
+static_assert(HCC_STRING_ID_INTRINSIC_END == 130093, "src/intrinsic_strings.c is out of date, regenerate it with scripts/intrinsics_gen.sh");
+
+const uint16_t hcc_intrinsic_strings_bucket_displacements[4096] = {
+	3, 0, 0, 1, 1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+	1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 3, 0,
+	0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1,
+	0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0,
+	1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+	1, 0, 0, 1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 2, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+	0, 0, 0, 0, 0, 0, 0, 3, 1, 0, 1, 0, 3, 0, 0, 2,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0,
+	0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0,
+	0, 2, 0, 0, 2, 1, 0, 0, 2, 0, 1, 1, 0, 1, 0, 1,
+	0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+	0, 1, 1, 0, 1, 0, 1, 2, 0, 1, 0, 0, 0, 0, 3, 0,
+	0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1, 0, 2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+	2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 3, 0, 0,
+	0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 1,
+	0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+	1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 2, 0, 0,
+	0, 0, 0, 2, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0,
+	1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 3,
+	0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0,
+	0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1,
+	0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+	1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+	0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+	0, 0, 1, 0, 0, 0, 2, 0, 1, 0, 1, 1, 0, 0, 0, 0,
+	0, 1, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 0,
+	0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 1, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+	0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 1, 1,
+	1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+	0, 0, 0, 0, 4, 0, 1, 0, 0, 1, 0, 0, 0, 2, 0, 0,
+	0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0,
+	1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+	0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+	0, 0, 3, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1,
+	0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 1, 0, 0,
+	0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1, 2, 0, 1, 0,
+	2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+	0, 0, 0, 1, 1, 0, 1, 1, 0, 3, 1, 0, 0, 1, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0,
+	0, 4, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 3,
+	0, 0, 0, 0, 0, 1, 0, 4, 0, 0, 1, 0, 1, 1, 1, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 1,
+	0, 0, 2, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 1,
+	2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+	0, 3, 0, 0, 0, 1, 0, 0, 2, 0, 0, 0, 0, 0, 1, 0,
+	0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0,
+	0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+	2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+	0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+	0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 1, 1, 0, 1, 0, 0, 0, 1, 1, 0, 1, 1, 0, 0,
+	0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+	1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 2, 0, 0, 1,
+	1, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0,
+	2, 1, 0, 0, 2, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0,
+	1, 0, 1, 0, 0, 0, 1, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1, 4, 0, 0, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+	0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0,
+	2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 3, 0, 0, 1,
+	0, 1, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0,
+	3, 0, 0, 0, 0, 0, 0, 0, 1, 2, 1, 0, 0, 1, 0, 0,
+	0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 1, 3, 0, 0, 0,
+	0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4, 0, 0, 0, 0, 0, 2, 0, 0, 0, 2, 0, 0, 1, 0, 0,
+	1, 0, 0, 2, 0, 0, 1, 0, 0, 0, 0, 4, 0, 0, 1, 0,
+	0, 1, 1, 0, 0, 2, 0, 0, 0, 2, 0, 0, 2, 0, 1, 0,
+	0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 3, 0,
+	0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0,
+	0, 0, 0, 1, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1, 0, 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 2, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 2, 1, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0,
+	1, 0, 2, 0, 0, 0, 1, 0, 0, 0, 3, 0, 0, 0, 1, 0,
+	0, 1, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 3, 0, 2, 1,
+	1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 2, 0,
+	0, 0, 0, 0, 0, 2, 1, 0, 1, 0, 0, 0, 0, 1, 0, 0,
+	0, 1, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 2, 0,
+	3, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 2, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 0, 1,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+	0, 1, 0, 0, 2, 0, 0, 0, 2, 1, 0, 0, 1, 0, 0, 0,
+	0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+	0, 0, 2, 1, 1, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+	0, 0, 0, 0, 0, 0, 0, 1, 0, 2, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 1, 1, 0, 1, 3,
+	0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1, 0, 0, 2, 0, 0, 0, 0, 1, 0, 1, 0, 0, 1, 2,
+	0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3, 0, 0, 0, 0, 1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 2,
+	0, 0, 0, 0, 1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+	0, 0, 0, 1, 1, 0, 0, 0, 3, 0, 0, 0, 0, 1, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0,
+	1, 2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0,
+	0, 0, 0, 1, 2, 1, 0, 2, 1, 1, 0, 0, 0, 1, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 2, 0, 1, 0, 0, 0, 0, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 1, 0,
+	1, 0, 0, 1, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0,
+	0, 0, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1,
+	0, 0, 2, 0, 0, 3, 0, 1, 0, 0, 0, 0, 3, 0, 0, 0,
+	0, 1, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0,
+	0, 0, 2, 0, 0, 0, 0, 2, 0, 1, 0, 0, 0, 1, 0, 0,
+	0, 0, 1, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0,
+	0, 1, 1, 0, 0, 0, 2, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+	3, 0, 1, 0, 0, 2, 1, 0, 0, 0, 1, 0, 0, 0, 0, 2,
+	0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 1, 0, 1,
+	0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0,
+	0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 1, 0, 1, 0, 3, 1, 0, 0, 1, 0, 0, 0, 1, 0,
+	0, 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 4,
+	1, 0, 2, 0, 1, 1, 0, 0, 1, 0, 0, 0, 0, 5, 0, 0,
+	0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 1, 0, 0,
+	0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 2, 1, 0, 0, 1, 0,
+	0, 0, 0, 0, 0, 1, 0, 0, 3, 1, 1, 0, 0, 0, 2, 0,
+	0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+	0, 0, 2, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 1, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 1, 1, 0, 1, 0,
+	0, 0, 4, 1, 0, 0, 0, 0, 2, 0, 1, 0, 0, 1, 0, 0,
+	2, 0, 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2,
+	0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 3,
+	1, 0, 0, 2, 0, 1, 0, 1, 2, 1, 2, 1, 0, 1, 1, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2, 0, 0, 0, 0,
+	0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+	0, 0, 0, 1, 0, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1,
+	0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+	2, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+	1, 0, 1, 2, 0, 0, 1, 0, 0, 2, 2, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 3, 1, 0, 0, 0, 0, 2, 1, 0, 1,
+	1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 1, 0, 0, 0, 0,
+	0, 0, 1, 0, 0, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+	1, 1, 1, 0, 0, 2, 0, 0, 0, 2, 0, 0, 0, 1, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 0, 1, 0,
+	0, 2, 0, 0, 1, 2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1,
+	0, 0, 0, 0, 0, 0, 1, 0, 2, 1, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 1, 0, 5, 0, 0, 0, 2, 2, 1, 0, 0, 1, 0,
+	0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 1, 0, 0, 1, 0, 1,
+	0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1,
+	0, 0, 0, 1, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+	1, 0, 1, 0, 0, 1, 0, 0, 2, 2, 0, 1, 1, 0, 0, 0,
+	1, 2, 0, 0, 0, 2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+	1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+	0, 0, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+	1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 5, 2,
+	0, 0, 3, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 4, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+	1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1,
+	0, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0,
+	2, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 3, 0, 0, 2, 0,
+	1, 0, 0, 0, 0, 3, 1, 1, 1, 0, 0, 0, 0, 2, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 2, 0, 0, 1, 0,
+	1, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 2, 0, 4, 4,
+	0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 0, 0, 0, 0,
+	1, 2, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0,
+	0, 0, 3, 0, 0, 0, 1, 1, 0, 2, 0, 0, 1, 2, 0, 0,
+	0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 0,
+	0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0,
+	0, 2, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 1, 0, 0, 0,
+	3, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+	0, 1, 2, 0, 0, 0, 1, 0, 4, 1, 0, 2, 1, 2, 0, 0,
+	0, 1, 1, 0, 1, 0, 0, 4, 1, 1, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2, 1, 1, 2, 0,
+	0, 1, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 1, 2,
+	1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0,
+	1, 3, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0,
+	0, 1, 2, 0, 0, 0, 0, 0, 3, 1, 1, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 3, 0, 1, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+	0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 2, 0,
+	0, 0, 0, 2, 0, 0, 1, 0, 0, 1, 0, 0, 2, 1, 0, 0,
+	0, 0, 0, 2, 0, 1, 1, 0, 2, 0, 0, 0, 0, 1, 2, 0,
+	0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3, 0, 0, 1, 0, 0, 1, 2, 1, 0, 1, 1, 0, 1, 1,
+	0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 2, 0, 0, 2, 0,
+	0, 1, 0, 0, 1, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0,
+	0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0,
+	0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+	0, 1, 1, 0, 0, 1, 1, 0, 0, 0, 0, 2, 0, 0, 0, 0,
+	1, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 1, 0, 1, 2, 0,
+	0, 4, 0, 0, 0, 6, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1, 1, 0, 0, 2, 0, 1, 1, 1, 0, 0, 1, 0, 0, 2,
+	0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 2, 0, 0, 1,
+	0, 1, 0, 0, 0, 0, 3, 0, 1, 0, 1, 0, 0, 0, 0, 0,
+	0, 0, 1, 0, 0, 0, 2, 1, 0, 0, 1, 2, 0, 0, 0, 0,
+	1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1,
+	0, 0, 3, 1, 1, 2, 0, 0, 0, 0, 2, 0, 0, 0, 1, 0,
+	0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+	1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+	0, 0, 0, 0, 2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+	0, 1, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1,
+	1, 0, 0, 3, 0, 0, 1, 0, 0, 1, 0, 2, 0, 0, 0, 0,
+	0, 0, 1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2, 1, 1, 1, 0, 0, 2, 0, 2, 1, 1, 1, 1, 0, 0, 0,
+	0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 3, 0, 1, 0, 0, 3,
+	2, 0, 0, 0, 1, 1, 0, 0, 2, 0, 0, 0, 1, 1, 0, 0,
+	0, 5, 0, 0, 0, 0, 0, 1, 1, 0, 0, 3, 0, 1, 0, 0,
+	0, 0, 0, 0, 0, 0, 2, 0, 2, 5, 0, 1, 0, 0, 0, 0,
+	0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+	3, 0, 0, 0, 1, 0, 0, 0, 0, 0, 2, 1, 0, 2, 0, 0,
+	1, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+	0, 0, 1, 2, 1, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0,
+	0, 1, 2, 0, 0, 1, 1, 0, 0, 2, 1, 0, 1, 0, 0, 0,
+	0, 0, 1, 2, 0, 0, 0, 0, 3, 1, 0, 0, 0, 0, 1, 1,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 5, 0, 0, 0,
+	0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0,
+	2, 1, 0, 0, 1, 0, 0, 1, 2, 1, 0, 0, 0, 1, 0, 0,
+	4, 1, 0, 2, 0, 1, 0, 0, 6, 1, 0, 0, 1, 0, 1, 0,
+	1, 0, 0, 0, 2, 0, 0, 0, 1, 1, 3, 0, 1, 1, 2, 0,
+	0, 1, 0, 2, 0, 0, 0, 2, 0, 1, 0, 0, 0, 0, 0, 6,
+	0, 1, 0, 0, 0, 1, 0, 0, 1, 0, 2, 1, 0, 0, 1, 0,
+	0, 0, 0, 0, 0, 0, 1, 0, 3, 0, 0, 1, 0, 0, 0, 2,
+	1, 2, 1, 0, 4, 0, 0, 2, 0, 1, 0, 0, 0, 0, 0, 1,
+	2, 1, 0, 0, 2, 0, 2, 1, 0, 1, 0, 0, 0, 0, 0, 0,
+	0, 1, 0, 0, 0, 0, 1, 2, 0, 1, 0, 0, 0, 0, 1, 0,
+	0, 0, 0, 1, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0,
+	0, 2, 0, 1, 0, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0,
+	0, 2, 0, 0, 0, 0, 1, 1, 1, 0, 1, 0, 1, 1, 0, 0,
+	1, 0, 1, 0, 0, 3, 1, 0, 1, 0, 1, 1, 0, 0, 0, 0,
+	0, 0, 1, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 0, 2, 2, 0, 0, 3, 0, 1, 0, 0, 0,
+	0, 0, 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 2, 0,
+	2, 0, 0, 0, 2, 0, 0, 0, 0, 5, 2, 0, 0, 0, 1, 1,
+	0, 8, 0, 0, 0, 2, 0, 1, 0, 0, 0, 2, 0, 1, 0, 1,
+};
+
+const uint16_t hcc_intrinsic_strings_slots[32768] = {
+	0, 2462, 2740, 0, 4342, 0, 0, 0, 2754, 0, 0, 6832, 322, 0, 0, 0,
+	0, 0, 0, 0, 6013, 0, 0, 1294, 0, 0, 0, 4593, 0, 0, 0, 0,
+	0, 6500, 0, 0, 0, 2994, 0, 8204, 3354, 0, 0, 961, 0, 0, 0, 0,
+	0, 0, 0, 0, 3646, 1963, 0, 0, 4007, 0, 0, 4730, 1941, 5095, 0, 0,
+	0, 0, 6991, 0, 0, 0, 0, 0, 0, 0, 228, 0, 3006, 0, 0, 5631,
+	6603, 0, 0, 0, 0, 1981, 1776, 0, 7190, 0, 0, 0, 6772, 7823, 0, 3387,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 3946, 0, 0, 7741, 0, 6194, 5967,
+	0, 3574, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5899, 0, 0, 0,
+	0, 0, 0, 0, 4204, 2633, 0, 0, 0, 2321, 0, 0, 0, 0, 0, 0,
+	0, 2079, 0, 0, 0, 0, 0, 0, 0, 0, 0, 299, 0, 0, 0, 7414,
+	0, 0, 7236, 0, 0, 0, 1449, 2378, 0, 0, 3589, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 7440, 766, 0, 0, 0, 0, 1695, 0, 0, 0, 0,
+	0, 5933, 0, 0, 0, 0, 0, 0, 0, 5637, 0, 0, 0, 0, 0, 0,
+	0, 6589, 0, 0, 2854, 0, 4569, 1938, 0, 5743, 0, 5193, 0, 0, 0, 0,
+	0, 1411, 0, 0, 0, 0, 0, 0, 0, 6918, 7830, 0, 0, 0, 0, 0,
+	906, 0, 0, 0, 0, 0, 0, 0, 1226, 0, 0, 0, 0, 0, 3677, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1462, 1241, 721, 0, 7601, 0, 4254,
+	0, 3478, 1681, 0, 0, 0, 0, 0, 0, 2021, 0, 0, 0, 5452, 0, 0,
+	0, 0, 0, 0, 7060, 0, 6437, 0, 0, 0, 0, 8065, 0, 4946, 0, 0,
+	1029, 0, 0, 7808, 0, 2816, 4245, 0, 0, 0, 0, 0, 0, 1077, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 6417, 0, 0, 2059, 7836, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 930, 1713, 0, 0, 0, 2721, 0, 6557, 0, 0, 0,
+	0, 0, 787, 481, 0, 0, 0, 0, 0, 0, 0, 6212, 8230, 0, 0, 0,
+	0, 0, 5514, 6066, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 2203, 0, 6162, 7787, 0, 0, 0, 0, 0, 0, 0, 0, 4884, 0, 0,
+	0, 0, 0, 8107, 0, 7605, 1321, 7816, 0, 0, 0, 2817, 0, 0, 6805, 0,
+	0, 0, 6443, 0, 0, 2138, 128, 0, 0, 0, 0, 4454, 0, 0, 0, 0,
+	0, 0, 5025, 0, 0, 1363, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 707, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6687, 0, 3314,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 102, 1254, 0, 2861, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6188, 0, 0, 0, 0, 0,
+	4857, 0, 0, 0, 0, 0, 0, 0, 0, 4675, 0, 0, 0, 0, 0, 0,
+	0, 5258, 0, 4977, 0, 0, 3027, 5515, 0, 0, 4366, 4768, 6773, 5166, 3338, 0,
+	0, 0, 7529, 0, 0, 0, 0, 0, 0, 0, 2880, 0, 0, 2371, 4955, 0,
+	0, 0, 3849, 0, 2222, 2029, 0, 0, 0, 286, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2665, 0, 0, 8163, 0, 4807,
+	0, 0, 0, 2441, 0, 0, 141, 0, 0, 0, 0, 0, 0, 0, 1656, 0,
+	0, 0, 0, 0, 6590, 0, 518, 0, 0, 0, 0, 2121, 0, 0, 0, 0,
+	4769, 0, 0, 0, 6838, 2891, 8196, 2345, 0, 3778, 3492, 8118, 0, 0, 0, 3024,
+	0, 0, 2443, 7379, 0, 0, 0, 0, 0, 0, 0, 0, 5271, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 202, 4705, 0, 0, 0, 0, 0, 2201,
+	765, 4886, 0, 0, 0, 0, 0, 0, 0, 3852, 0, 0, 0, 0, 0, 0,
+	0, 2205, 4406, 0, 0, 0, 0, 0, 536, 2322, 7003, 0, 0, 247, 0, 0,
+	0, 0, 0, 1356, 1786, 1913, 0, 0, 0, 592, 6471, 3511, 0, 5471, 0, 0,
+	4722, 0, 0, 6945, 0, 2257, 0, 133, 0, 880, 1934, 3903, 1563, 0, 0, 0,
+	0, 0, 0, 0, 554, 2548, 7571, 0, 0, 0, 0, 3299, 2042, 5360, 0, 1564,
+	0, 0, 0, 3409, 0, 1142, 5682, 1948, 0, 0, 0, 6781, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1160, 2355, 485, 0, 0, 4316, 0, 0, 0, 4034,
+	5870, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4099,
+	0, 0, 3754, 0, 0, 0, 0, 0, 0, 0, 4507, 0, 0, 0, 0, 0,
+	0, 0, 559, 0, 7691, 168, 3822, 0, 0, 0, 0, 0, 0, 344, 0, 0,
+	0, 0, 0, 0, 3406, 0, 0, 0, 0, 0, 2384, 0, 0, 0, 3750, 5075,
+	6751, 0, 0, 0, 0, 0, 6230, 0, 0, 5950, 0, 0, 0, 0, 0, 7641,
+	0, 0, 0, 0, 0, 0, 0, 5572, 1179, 0, 0, 7410, 2793, 0, 5151, 0,
+	0, 893, 0, 0, 0, 0, 0, 0, 0, 0, 3566, 0, 0, 0, 7075, 0,
+	273, 0, 0, 0, 0, 0, 0, 4305, 0, 0, 0, 7597, 0, 0, 0, 0,
+	0, 0, 0, 0, 7734, 5391, 5695, 0, 0, 600, 7468, 0, 0, 0, 0, 1777,
+	5676, 0, 0, 4737, 0, 0, 5751, 0, 0, 0, 0, 0, 0, 1429, 1825, 0,
+	726, 0, 0, 0, 0, 0, 0, 390, 0, 0, 0, 0, 0, 0, 0, 0,
+	6739, 0, 5603, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 6153, 0, 0, 0, 0, 0, 0, 5160,
+	2363, 0, 250, 0, 0, 0, 0, 0, 2447, 0, 0, 6592, 0, 0, 657, 0,
+	0, 0, 6328, 0, 0, 0, 196, 0, 0, 0, 0, 0, 0, 6197, 0, 1790,
+	0, 0, 623, 0, 0, 5321, 0, 5778, 1754, 0, 35, 0, 0, 0, 0, 709,
+	8299, 0, 0, 92, 5141, 0, 0, 5986, 3216, 0, 0, 0, 410, 1308, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1888, 0, 0, 0, 0, 6513, 0, 0,
+	5717, 0, 0, 0, 3506, 1190, 0, 1194, 7661, 0, 0, 0, 2166, 0, 0, 0,
+	5508, 0, 0, 0, 7555, 0, 0, 7630, 5674, 0, 0, 0, 0, 6914, 7363, 0,
+	0, 0, 0, 225, 0, 5287, 0, 0, 0, 0, 0, 0, 753, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 7807, 0, 674, 0, 0, 0, 0, 0,
+	5284, 0, 452, 0, 0, 0, 0, 0, 7274, 0, 0, 0, 257, 0, 0, 0,
+	4192, 0, 0, 0, 2683, 7094, 0, 0, 7450, 0, 0, 0, 0, 5756, 2640, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 932, 0, 4310, 0,
+	0, 0, 1708, 0, 0, 0, 0, 0, 1886, 0, 0, 0, 0, 0, 0, 0,
+	0, 2225, 0, 0, 6714, 0, 0, 0, 0, 0, 0, 6921, 0, 4498, 3395, 0,
+	0, 0, 0, 0, 0, 29, 3176, 4422, 0, 3967, 1441, 0, 0, 0, 6253, 0,
+	6106, 0, 0, 4969, 6379, 0, 0, 0, 7953, 0, 0, 0, 0, 2235, 0, 0,
+	0, 0, 6169, 0, 1868, 0, 0, 0, 5596, 0, 0, 0, 0, 0, 0, 1406,
+	0, 0, 0, 34, 0, 0, 0, 965, 0, 4990, 679, 0, 0, 0, 0, 1969,
+	0, 0, 0, 0, 0, 0, 0, 4915, 7208, 0, 4257, 4665, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 8111, 0, 0, 0, 0, 0, 1735,
+	2840, 1549, 2416, 0, 0, 0, 328, 2655, 3326, 0, 1837, 0, 0, 1378, 8260, 0,
+	2180, 0, 7832, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5628, 0, 0, 0,
+	0, 0, 4473, 0, 7391, 3746, 3174, 0, 0, 0, 0, 49, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3868, 0, 0, 0, 7600,
+	0, 0, 0, 897, 0, 0, 667, 0, 0, 0, 0, 334, 0, 0, 4911, 6540,
+	0, 0, 6726, 0, 2194, 3415, 1643, 0, 0, 2937, 352, 0, 0, 0, 0, 0,
+	0, 0, 0, 6228, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1887, 0, 0, 3043, 2457, 0, 563, 0, 1134, 0, 0, 0, 6883, 0, 0, 0,
+	0, 3446, 6878, 0, 0, 646, 0, 0, 1104, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3816, 0, 0, 0, 113, 3527, 8056, 6084, 0, 0, 0,
+	0, 219, 6354, 0, 0, 0, 0, 0, 0, 5893, 3235, 5320, 0, 0, 3418, 0,
+	0, 0, 0, 0, 4750, 0, 0, 0, 0, 0, 7537, 0, 0, 0, 0, 0,
+	0, 8255, 0, 6181, 0, 0, 4763, 0, 0, 0, 6441, 0, 0, 0, 0, 0,
+	0, 5403, 0, 0, 0, 0, 0, 0, 0, 5553, 4981, 0, 0, 0, 0, 0,
+	3359, 0, 3815, 0, 3490, 0, 0, 0, 0, 0, 4713, 0, 0, 0, 0, 0,
+	0, 0, 5600, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3036,
+	6545, 8017, 0, 0, 0, 0, 0, 0, 1150, 0, 0, 1870, 602, 0, 0, 5939,
+	0, 0, 2581, 0, 0, 0, 0, 0, 0, 0, 0, 2582, 0, 0, 0, 0,
+	8240, 0, 0, 7019, 4379, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2936, 0,
+	0, 0, 0, 0, 0, 0, 6319, 0, 701, 4467, 0, 1004, 3776, 0, 0, 5270,
+	0, 0, 0, 0, 0, 5400, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	7464, 0, 0, 0, 0, 0, 5959, 0, 0, 0, 0, 0, 6700, 0, 0, 0,
+	0, 0, 0, 0, 0, 1519, 0, 0, 3658, 872, 0, 1991, 0, 0, 0, 0,
+	0, 7168, 0, 0, 0, 7255, 0, 3739, 4815, 0, 0, 0, 0, 2966, 0, 0,
+	0, 0, 3937, 0, 0, 0, 5157, 7776, 0, 6727, 6884, 487, 0, 0, 5659, 0,
+	0, 0, 0, 0, 0, 0, 0, 4452, 0, 0, 4361, 0, 0, 0, 0, 7051,
+	0, 0, 0, 794, 0, 0, 0, 3300, 0, 5912, 3320, 0, 0, 0, 0, 0,
+	0, 2507, 0, 0, 0, 0, 5746, 0, 0, 0, 5951, 0, 4557, 3563, 0, 0,
+	0, 0, 0, 0, 7105, 0, 0, 0, 0, 0, 809, 8352, 0, 0, 0, 0,
+	0, 1299, 7325, 0, 0, 828, 0, 0, 0, 0, 702, 0, 0, 0, 0, 0,
+	4715, 0, 1520, 4227, 0, 3428, 0, 0, 0, 7326, 177, 0, 0, 0, 0, 0,
+	7779, 0, 0, 0, 0, 3285, 0, 3366, 0, 0, 0, 0, 0, 0, 0, 0,
+	4086, 0, 0, 0, 0, 0, 0, 0, 3898, 209, 0, 0, 0, 0, 0, 0,
+	0, 5401, 0, 0, 0, 4236, 0, 5145, 0, 0, 0, 8227, 0, 0, 0, 0,
+	2748, 0, 0, 0, 0, 871, 0, 0, 0, 0, 0, 0, 0, 5702, 0, 0,
+	4993, 0, 0, 0, 6448, 0, 0, 0, 0, 3255, 6729, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 6908, 5341, 0, 0, 0, 0, 8208, 0, 2054, 0, 0, 0,
+	0, 0, 3908, 5683, 0, 0, 0, 0, 0, 1048, 0, 0, 0, 7162, 3791, 0,
+	0, 0, 3655, 1301, 0, 0, 0, 0, 1263, 0, 0, 0, 0, 0, 0, 0,
+	6525, 0, 0, 0, 0, 0, 0, 0, 7346, 0, 0, 0, 6190, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1460, 0, 0, 2635, 0, 0, 0, 0, 0, 3377,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 2905, 0, 0, 0, 0, 0, 0,
+	0, 0, 1474, 5483, 1286, 0, 0, 0, 0, 0, 2750, 277, 0, 3824, 0, 0,
+	7566, 0, 0, 0, 8024, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 7925, 0, 4396, 0, 0, 0, 0, 0, 0, 0, 0, 5445, 2007, 7079, 0,
+	8224, 0, 1626, 3360, 0, 0, 0, 1303, 0, 0, 0, 0, 0, 0, 0, 0,
+	6059, 0, 112, 8211, 0, 0, 0, 0, 0, 0, 0, 0, 4963, 0, 0, 0,
+	6199, 0, 188, 0, 0, 778, 7367, 0, 0, 0, 1688, 0, 0, 0, 7578, 0,
+	0, 0, 0, 7312, 0, 0, 3907, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4754, 0, 0, 3656, 0, 0, 0, 0, 3887, 0, 8286, 0, 0, 0, 0, 0,
+	0, 4760, 0, 0, 0, 0, 0, 0, 4080, 0, 0, 0, 2847, 0, 0, 0,
+	0, 0, 0, 0, 4078, 0, 0, 2658, 1039, 6674, 0, 0, 3343, 0, 0, 0,
+	4331, 6936, 0, 1081, 0, 0, 0, 0, 0, 0, 0, 0, 4691, 4584, 0, 0,
+	0, 0, 0, 0, 0, 1747, 0, 0, 0, 2268, 3634, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6298, 2959, 0, 0, 0, 0,
+	0, 0, 0, 0, 1417, 0, 88, 0, 0, 0, 356, 0, 0, 6625, 0, 0,
+	0, 0, 0, 3262, 0, 0, 5072, 0, 0, 0, 6685, 0, 0, 4268, 6599, 4531,
+	2846, 0, 166, 0, 0, 4081, 0, 6706, 0, 0, 0, 4723, 0, 0, 0, 7260,
+	0, 3180, 0, 0, 0, 0, 0, 1936, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3013, 0, 0, 6678, 0, 7480, 0, 0, 0, 0, 3344, 0, 5894, 0, 0,
+	0, 0, 0, 0, 0, 0, 2570, 335, 0, 0, 0, 0, 0, 2749, 0, 4313,
+	0, 7231, 0, 0, 456, 0, 0, 0, 0, 0, 0, 0, 0, 4241, 0, 0,
+	0, 0, 1925, 0, 1099, 0, 0, 0, 0, 0, 1612, 8057, 0, 7595, 0, 0,
+	0, 0, 1222, 0, 2297, 0, 0, 0, 0, 0, 5422, 575, 0, 0, 3376, 477,
+	0, 0, 1878, 0, 0, 0, 0, 81, 0, 534, 3168, 0, 3429, 0, 0, 0,
+	0, 0, 0, 1038, 1922, 3128, 0, 0, 3487, 0, 0, 0, 5262, 0, 0, 0,
+	0, 0, 0, 5431, 2421, 0, 313, 0, 1120, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2621, 0, 0, 0,
+	2872, 0, 0, 2960, 4481, 0, 3847, 0, 0, 0, 581, 1671, 2895, 0, 0, 0,
+	714, 0, 0, 0, 0, 0, 2990, 0, 7175, 0, 3293, 0, 0, 0, 0, 0,
+	0, 0, 1507, 0, 0, 0, 0, 0, 3041, 0, 0, 7969, 0, 0, 0, 7291,
+	0, 0, 3105, 0, 0, 5579, 0, 0, 0, 5307, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 6386, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8091,
+	0, 0, 0, 0, 0, 7575, 0, 0, 0, 4169, 0, 0, 0, 4782, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3906, 0,
+	0, 7879, 6798, 0, 0, 0, 2575, 0, 0, 0, 0, 0, 8122, 0, 0, 0,
+	0, 0, 5561, 0, 0, 0, 2801, 0, 637, 0, 0, 0, 0, 0, 4387, 5536,
+	0, 0, 0, 0, 6486, 0, 0, 0, 0, 0, 0, 0, 0, 2707, 7974, 0,
+	0, 3679, 0, 0, 7101, 0, 5248, 0, 0, 0, 0, 0, 5985, 0, 3464, 0,
+	0, 0, 1845, 0, 0, 0, 7810, 0, 0, 0, 0, 0, 3109, 0, 0, 4581,
+	751, 0, 0, 0, 0, 0, 0, 7375, 0, 0, 4237, 0, 0, 0, 0, 0,
+	0, 4790, 0, 0, 0, 0, 0, 0, 0, 0, 2207, 0, 0, 0, 0, 0,
+	0, 696, 7085, 0, 0, 1807, 0, 0, 0, 0, 0, 0, 1542, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 7222, 67, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 5877, 0, 0, 0, 0, 0, 0, 2214, 0, 7307, 0,
+	0, 5775, 0, 0, 0, 7576, 0, 0, 0, 0, 6829, 6104, 0, 0, 0, 0,
+	0, 0, 0, 0, 3916, 0, 0, 0, 0, 4087, 0, 2049, 3309, 4253, 0, 995,
+	0, 0, 1579, 0, 0, 0, 5175, 0, 0, 0, 0, 7826, 0, 0, 2898, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6961, 4354, 0, 8073,
+	0, 0, 0, 0, 0, 0, 0, 0, 2273, 0, 0, 0, 0, 0, 2184, 6681,
+	0, 8045, 0, 0, 0, 0, 0, 7599, 0, 6638, 0, 0, 0, 0, 0, 998,
+	2584, 4312, 0, 0, 2765, 4232, 2732, 1565, 0, 4041, 7244, 296, 0, 0, 7915, 0,
+	0, 0, 0, 0, 1084, 0, 0, 5654, 0, 0, 0, 7773, 5831, 0, 0, 0,
+	0, 0, 7568, 5384, 0, 0, 4547, 0, 0, 0, 0, 0, 5542, 0, 0, 0,
+	0, 6406, 0, 8027, 436, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 1774, 5711, 0, 0, 6940, 0, 5217, 0, 2718,
+	0, 0, 0, 0, 0, 0, 0, 0, 6174, 0, 0, 0, 7169, 2016, 3980, 0,
+	0, 0, 0, 0, 0, 7435, 0, 0, 0, 0, 0, 0, 0, 6019, 4861, 0,
+	0, 0, 0, 1842, 0, 0, 628, 0, 6028, 0, 0, 0, 0, 0, 0, 0,
+	7479, 7228, 0, 0, 3181, 32, 0, 947, 0, 0, 0, 0, 6506, 0, 0, 0,
+	0, 0, 3650, 565, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2035,
+	0, 0, 0, 0, 0, 1258, 0, 0, 0, 817, 0, 0, 0, 3244, 4437, 0,
+	0, 4211, 0, 6096, 0, 0, 0, 0, 743, 0, 0, 0, 0, 0, 0, 1841,
+	0, 3909, 0, 0, 0, 0, 0, 7694, 3238, 0, 3828, 0, 0, 3185, 5824, 1515,
+	0, 0, 7744, 5491, 0, 0, 4595, 3630, 0, 0, 0, 0, 0, 8197, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 5784, 0, 0, 1597, 0, 0, 0, 496, 6825, 4115, 0, 189, 0, 0, 0,
+	0, 0, 3724, 0, 0, 0, 0, 5792, 0, 6916, 0, 0, 0, 0, 4844, 1140,
+	0, 0, 8061, 0, 0, 0, 2006, 0, 0, 0, 0, 4188, 4742, 2520, 0, 0,
+	0, 0, 0, 2940, 0, 1973, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 7037, 0, 0, 320, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 33, 0, 0, 0, 3557, 0, 0, 0, 6873, 0,
+	0, 0, 0, 0, 0, 0, 1323, 0, 0, 2934, 0, 0, 0, 0, 0, 5650,
+	0, 0, 0, 0, 0, 0, 0, 5381, 0, 0, 0, 2976, 0, 0, 0, 0,
+	0, 0, 5331, 0, 0, 0, 7388, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	5759, 8016, 0, 0, 6355, 2056, 0, 1590, 0, 0, 6164, 439, 0, 2103, 2015, 0,
+	6173, 2362, 0, 4651, 0, 0, 0, 0, 572, 0, 0, 0, 0, 0, 0, 0,
+	0, 1832, 0, 0, 0, 0, 0, 0, 0, 0, 555, 0, 0, 0, 0, 0,
+	0, 0, 0, 5125, 0, 0, 0, 3644, 0, 0, 0, 7983, 0, 0, 1494, 0,
+	0, 0, 3414, 0, 4796, 0, 1823, 2420, 0, 0, 0, 4795, 0, 310, 0, 5318,
+	0, 0, 0, 7932, 0, 3921, 0, 0, 0, 0, 0, 0, 3330, 0, 5407, 0,
+	0, 1551, 0, 0, 0, 0, 1636, 0, 0, 0, 0, 0, 6965, 0, 1035, 0,
+	4513, 0, 0, 0, 0, 0, 4906, 2066, 0, 0, 8319, 0, 0, 0, 4457, 0,
+	7431, 8271, 0, 0, 0, 0, 0, 0, 1603, 0, 0, 2325, 0, 0, 6594, 0,
+	3312, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5069, 0, 6900, 0,
+	0, 0, 0, 0, 0, 2883, 0, 0, 2102, 0, 0, 398, 0, 0, 0, 4428,
+	0, 0, 1257, 0, 0, 0, 5849, 0, 0, 0, 0, 0, 1030, 612, 2981, 0,
+	2702, 0, 4168, 6868, 0, 5548, 881, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 4458, 0, 4676, 4522, 0, 0, 4570, 0, 0, 8282, 0, 0, 0, 4017, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 2909, 7604, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 8229, 0, 0, 0, 0, 1055, 0, 0, 0, 5340, 582, 0,
+	0, 1957, 0, 0, 0, 0, 0, 0, 0, 0, 0, 474, 4734, 0, 0, 3290,
+	0, 0, 1965, 0, 0, 1484, 1022, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3228, 0, 0, 0, 0, 4229, 0, 0, 0, 0, 0, 678, 0, 0, 7911,
+	1050, 0, 0, 0, 4699, 0, 0, 0, 6195, 0, 0, 0, 0, 0, 0, 0,
+	6904, 0, 0, 0, 0, 0, 0, 4882, 0, 0, 0, 0, 0, 0, 0, 0,
+	2152, 0, 0, 0, 0, 0, 1501, 0, 7123, 0, 0, 5461, 0, 3012, 4325, 0,
+	0, 3974, 0, 0, 0, 882, 0, 0, 2459, 0, 0, 2470, 0, 0, 0, 5555,
+	0, 0, 0, 2931, 0, 51, 0, 0, 0, 0, 0, 0, 6794, 0, 0, 0,
+	6919, 0, 0, 0, 0, 1904, 0, 7485, 0, 0, 0, 0, 0, 0, 0, 0,
+	5581, 0, 7653, 0, 0, 0, 5724, 0, 0, 0, 0, 4265, 0, 0, 0, 2825,
+	0, 0, 0, 0, 0, 0, 649, 0, 0, 1113, 0, 4852, 0, 0, 4117, 0,
+	2622, 13, 0, 0, 7455, 0, 6888, 0, 0, 0, 0, 0, 2183, 0, 0, 0,
+	0, 0, 0, 0, 0, 287, 0, 0, 0, 0, 2574, 7358, 1503, 2919, 0, 0,
+	0, 0, 0, 0, 6269, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4579, 0,
+	0, 0, 2217, 7293, 8068, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 6129, 0, 5419, 0, 0, 3270, 5334, 3261, 0, 0, 0,
+	0, 0, 0, 0, 1721, 0, 0, 0, 0, 0, 0, 4975, 0, 5914, 0, 39,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	5240, 2461, 0, 0, 0, 0, 0, 4717, 0, 0, 6491, 0, 0, 1060, 0, 0,
+	0, 0, 245, 2046, 0, 0, 0, 0, 305, 0, 7620, 0, 0, 0, 0, 0,
+	0, 0, 0, 3541, 0, 0, 0, 1843, 0, 0, 0, 0, 1940, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 917, 1727, 0, 0, 0, 0, 3594, 7102, 0, 1813,
+	4909, 0, 7213, 5904, 0, 0, 0, 0, 0, 0, 2946, 0, 0, 0, 0, 0,
+	0, 8038, 0, 0, 0, 7506, 0, 0, 0, 1737, 1890, 0, 0, 0, 0, 6309,
+	0, 0, 0, 0, 0, 0, 0, 6812, 0, 6396, 0, 0, 5241, 0, 5003, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 4440, 6648, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 5354, 0, 4488, 0, 2464, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 226, 0, 7827, 0, 783, 0, 3351, 2986, 2365, 0, 0, 0, 0, 1677,
+	0, 0, 1430, 0, 0, 3386, 1810, 0, 3430, 4618, 5408, 0, 3596, 0, 0, 0,
+	0, 0, 0, 7872, 0, 0, 0, 0, 3840, 0, 0, 0, 0, 0, 0, 8316,
+	0, 1467, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3856, 0, 7495, 0, 0, 0, 5942, 4476, 0, 2800, 7135, 0, 1658, 0, 0,
+	0, 4090, 0, 0, 0, 0, 0, 6859, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 7825, 4786, 798, 0, 0, 1013, 0, 0, 0, 0, 0, 671, 0,
+	0, 6662, 0, 0, 0, 0, 0, 0, 0, 0, 5770, 5358, 0, 0, 0, 0,
+	7888, 0, 0, 7187, 0, 0, 0, 0, 0, 999, 0, 8324, 4137, 5020, 2769, 0,
+	3075, 0, 0, 99, 0, 7930, 0, 0, 0, 2375, 0, 0, 0, 2081, 0, 0,
+	2590, 130, 0, 0, 1295, 0, 0, 0, 0, 0, 0, 1028, 5083, 0, 0, 0,
+	0, 0, 0, 4399, 0, 0, 680, 0, 0, 0, 0, 0, 0, 4888, 0, 4534,
+	252, 6776, 0, 0, 0, 6464, 0, 0, 0, 0, 0, 2914, 1205, 7703, 885, 0,
+	0, 0, 0, 281, 0, 0, 5818, 0, 0, 0, 1102, 0, 0, 0, 0, 0,
+	0, 0, 4996, 2744, 0, 1069, 1714, 0, 0, 0, 0, 0, 599, 1138, 1285, 0,
+	0, 0, 4097, 1409, 0, 0, 6462, 0, 0, 909, 0, 6352, 0, 0, 0, 46,
+	0, 0, 0, 0, 0, 0, 0, 7308, 0, 0, 0, 0, 0, 0, 4568, 3072,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 6912, 0, 0, 0, 4161, 0, 0,
+	0, 7491, 0, 7220, 73, 1306, 0, 0, 0, 0, 1701, 0, 0, 0, 0, 6102,
+	0, 0, 2753, 0, 0, 0, 0, 1529, 0, 0, 0, 0, 0, 2390, 0, 1745,
+	7183, 0, 0, 0, 0, 0, 761, 0, 0, 7923, 0, 4866, 0, 0, 0, 0,
+	0, 0, 0, 1989, 0, 0, 0, 2395, 0, 5610, 0, 5908, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 345, 0, 0, 0, 460, 4108, 0, 0, 0, 0,
+	7420, 0, 0, 0, 0, 0, 0, 0, 4856, 0, 0, 0, 6362, 0, 4591, 0,
+	3504, 0, 0, 0, 0, 5608, 6130, 0, 0, 0, 0, 0, 0, 4181, 0, 0,
+	4166, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5710, 0, 3078, 2428, 929,
+	0, 0, 0, 0, 6766, 0, 2018, 1962, 0, 0, 3305, 0, 0, 0, 0, 0,
+	0, 8336, 0, 0, 5098, 0, 0, 0, 0, 604, 0, 0, 0, 0, 0, 0,
+	426, 6680, 0, 0, 0, 0, 0, 3671, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3710, 0, 0, 0, 3192, 0, 4024, 0, 7523, 0, 781, 0, 4486, 6767,
+	8052, 0, 0, 7001, 0, 0, 8090, 1975, 0, 0, 0, 0, 0, 0, 0, 4653,
+	0, 0, 0, 0, 0, 0, 0, 0, 6555, 0, 5060, 7446, 0, 0, 0, 0,
+	0, 0, 4966, 0, 0, 465, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 5642, 3992, 5624, 7695, 4771, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3333, 0, 1835, 0, 0, 0, 0, 0, 0, 0, 2478, 0, 0, 0, 0, 0,
+	7172, 0, 2864, 0, 0, 0, 0, 1741, 0, 2229, 0, 0, 0, 0, 0, 0,
+	0, 0, 7546, 0, 0, 7005, 0, 0, 0, 6622, 0, 0, 7889, 0, 0, 0,
+	0, 0, 3503, 0, 0, 0, 0, 5748, 5878, 0, 0, 0, 0, 0, 0, 0,
+	0, 5118, 0, 5795, 0, 0, 1876, 4586, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1698, 0, 0, 2733, 0, 0, 0, 0, 0, 0, 3635, 0, 0, 7234, 0,
+	0, 0, 7298, 2471, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5467, 0, 1273,
+	2968, 0, 0, 0, 2324, 1414, 0, 0, 0, 4052, 0, 1481, 0, 757, 0, 6623,
+	5946, 0, 0, 0, 0, 3610, 5753, 1198, 0, 0, 0, 1527, 0, 0, 0, 0,
+	0, 0, 0, 1270, 2977, 1566, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 186, 0, 0, 0, 2523, 4960, 0, 0, 0, 0, 6865, 0, 0,
+	0, 6112, 0, 0, 0, 6087, 5909, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 5941, 2775, 0, 0, 0, 0, 4967, 0, 0,
+	0, 0, 0, 0, 4289, 0, 3864, 0, 1268, 6690, 0, 0, 8195, 0, 0, 0,
+	0, 2107, 0, 0, 0, 7322, 0, 3705, 0, 0, 0, 5501, 7980, 7924, 0, 6031,
+	0, 407, 0, 0, 0, 0, 4303, 0, 0, 0, 0, 2179, 0, 208, 4320, 0,
+	0, 0, 0, 0, 0, 0, 0, 2193, 5466, 0, 7458, 0, 0, 4230, 0, 0,
+	6482, 0, 0, 7266, 0, 0, 0, 350, 0, 0, 0, 866, 0, 0, 0, 7342,
+	0, 1242, 1834, 0, 0, 0, 0, 0, 0, 0, 1730, 0, 0, 0, 6962, 0,
+	0, 0, 0, 0, 0, 7422, 0, 0, 0, 0, 0, 3535, 0, 0, 0, 0,
+	6425, 0, 0, 0, 0, 8121, 0, 7589, 0, 0, 109, 0, 0, 0, 8025, 6649,
+	0, 0, 0, 0, 8307, 2866, 4984, 0, 0, 1001, 0, 535, 0, 0, 0, 0,
+	0, 8320, 4504, 1420, 6740, 0, 2358, 6089, 0, 8063, 0, 0, 0, 4402, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 6615, 0, 3945, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 556, 0, 0, 0, 0,
+	0, 0, 4530, 1570, 7451, 0, 0, 0, 2185, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 486, 0, 0, 0, 3401, 0, 3994, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1165, 5446, 0,
+	0, 0, 0, 0, 0, 5169, 0, 8328, 0, 0, 0, 0, 0, 0, 0, 0,
+	3069, 0, 0, 0, 0, 7509, 0, 0, 0, 0, 0, 0, 0, 1929, 0, 0,
+	8291, 796, 5372, 0, 0, 0, 4054, 0, 0, 0, 0, 0, 1066, 0, 0, 0,
+	3472, 0, 0, 1256, 0, 4290, 0, 0, 0, 0, 0, 501, 0, 0, 0, 1259,
+	0, 0, 7292, 0, 0, 7680, 0, 0, 0, 509, 0, 0, 3146, 8290, 0, 0,
+	0, 1622, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2162, 3454, 0, 0, 6620, 7093, 0, 4003, 0, 0, 5845, 2868, 1195, 0, 0, 4286,
+	0, 6051, 0, 0, 1690, 0, 7732, 0, 1413, 0, 0, 0, 1815, 0, 0, 0,
+	0, 5059, 0, 0, 0, 0, 0, 0, 0, 4961, 0, 3813, 0, 0, 0, 5560,
+	0, 1067, 0, 0, 0, 0, 0, 0, 0, 0, 739, 0, 0, 0, 0, 0,
+	733, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 1889, 0, 0, 0, 0, 0, 0, 3114, 0, 0, 0, 6007, 0, 0, 0,
+	0, 0, 0, 0, 5365, 0, 0, 0, 0, 0, 5178, 0, 0, 0, 0, 0,
+	6348, 0, 0, 3493, 0, 0, 7323, 0, 0, 6497, 0, 5917, 0, 0, 0, 0,
+	0, 0, 0, 0, 4805, 0, 0, 0, 0, 0, 0, 0, 0, 0, 103, 0,
+	0, 5481, 0, 0, 507, 3004, 0, 0, 4829, 0, 3055, 3348, 0, 0, 5595, 0,
+	3691, 0, 6276, 0, 0, 0, 0, 0, 0, 1208, 0, 7770, 0, 0, 0, 0,
+	0, 0, 1581, 31, 0, 0, 0, 0, 0, 1528, 68, 0, 0, 289, 7514, 0,
+	0, 0, 0, 0, 0, 940, 7656, 0, 0, 0, 6286, 0, 0, 0, 0, 0,
+	0, 5957, 0, 0, 0, 0, 5991, 0, 2087, 0, 6880, 7049, 0, 993, 7419, 0,
+	0, 0, 0, 0, 0, 0, 0, 1652, 0, 3258, 0, 0, 0, 7528, 4176, 0,
+	2429, 1396, 2132, 0, 0, 0, 0, 0, 0, 0, 0, 2910, 0, 0, 0, 0,
+	0, 0, 7859, 0, 0, 0, 0, 0, 0, 1155, 0, 0, 4947, 3210, 0, 2284,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3470,
+	0, 0, 0, 0, 0, 1534, 4233, 0, 0, 7802, 0, 0, 6356, 0, 0, 0,
+	0, 6906, 0, 2084, 1591, 0, 0, 0, 0, 7887, 0, 0, 0, 0, 0, 0,
+	0, 1167, 220, 0, 7259, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4369, 0,
+	0, 0, 0, 0, 0, 0, 1068, 0, 2283, 0, 0, 6029, 396, 0, 0, 5325,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3575, 1166, 0, 4806,
+	4610, 0, 7788, 2530, 0, 0, 0, 0, 0, 0, 8048, 0, 0, 0, 1444, 2975,
+	0, 0, 0, 0, 0, 0, 1345, 626, 0, 1516, 0, 0, 7069, 0, 3951, 0,
+	7712, 7, 395, 0, 0, 0, 5273, 1632, 0, 7113, 3976, 2819, 0, 1510, 0, 0,
+	0, 0, 2496, 4505, 0, 0, 0, 0, 4461, 0, 0, 7103, 2943, 0, 1101, 0,
+	0, 0, 3850, 974, 0, 0, 3450, 0, 0, 0, 0, 0, 987, 0, 0, 0,
+	0, 7997, 0, 506, 0, 7848, 0, 6764, 0, 0, 0, 0, 0, 4972, 0, 7224,
+	4804, 0, 0, 0, 0, 3842, 937, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 7350, 0, 7116, 7753, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1800, 4247,
+	0, 1250, 1880, 658, 0, 8088, 2730, 0, 0, 0, 0, 0, 0, 0, 0, 7117,
+	0, 0, 0, 7487, 0, 7786, 5513, 0, 5294, 0, 433, 0, 3077, 2130, 0, 0,
+	0, 7086, 0, 0, 1573, 2253, 0, 0, 0, 0, 0, 2957, 0, 0, 0, 2299,
+	0, 0, 0, 3858, 0, 0, 0, 3602, 2791, 0, 0, 0, 4792, 0, 0, 0,
+	4173, 0, 1594, 275, 0, 1368, 0, 0, 0, 0, 0, 6741, 0, 0, 230, 0,
+	0, 0, 0, 0, 0, 0, 0, 2188, 0, 0, 5670, 0, 0, 0, 0, 6565,
+	0, 0, 4022, 0, 0, 0, 0, 0, 0, 0, 0, 3952, 0, 0, 0, 0,
+	0, 7617, 2715, 0, 0, 3001, 0, 0, 0, 0, 6275, 0, 4696, 0, 0, 8099,
+	8115, 0, 2924, 0, 329, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 5280, 0, 0, 0, 5679, 0, 7396, 6857, 0, 0, 0,
+	1463, 0, 0, 0, 0, 2337, 0, 0, 0, 0, 0, 0, 0, 2178, 0, 7290,
+	0, 3065, 0, 6775, 0, 0, 0, 0, 0, 0, 2630, 2158, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 5228, 0, 0, 0, 0, 1482, 0, 0, 0, 0, 0,
+	4215, 3010, 0, 0, 744, 0, 0, 0, 6748, 0, 0, 0, 3241, 0, 0, 2411,
+	0, 0, 0, 0, 0, 0, 4274, 0, 0, 0, 0, 0, 6808, 0, 0, 0,
+	3375, 0, 0, 5807, 0, 0, 2758, 0, 0, 1953, 6753, 0, 0, 0, 0, 3538,
+	2145, 0, 5918, 7559, 0, 0, 0, 0, 0, 3915, 0, 0, 0, 3820, 8194, 0,
+	0, 4935, 0, 4403, 0, 0, 0, 2782, 3073, 0, 5131, 0, 0, 0, 2556, 0,
+	0, 0, 0, 5225, 3408, 0, 0, 0, 0, 0, 0, 6397, 5570, 0, 0, 0,
+	0, 0, 0, 0, 394, 0, 0, 0, 0, 8179, 0, 0, 0, 0, 1866, 0,
+	3194, 0, 0, 0, 0, 0, 0, 7082, 0, 8263, 0, 6208, 0, 353, 5658, 0,
+	0, 0, 0, 0, 0, 5232, 0, 0, 3417, 0, 0, 3243, 0, 7272, 6458, 0,
+	0, 0, 0, 0, 0, 0, 0, 6866, 0, 0, 0, 0, 0, 0, 546, 0,
+	0, 0, 0, 2307, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6765,
+	0, 0, 1123, 0, 0, 0, 0, 0, 7214, 0, 0, 0, 0, 0, 0, 0,
+	6964, 0, 0, 0, 0, 2681, 0, 1673, 5429, 8013, 0, 2350, 1634, 2974, 0, 0,
+	7334, 0, 0, 421, 0, 912, 406, 0, 0, 5148, 8221, 0, 7998, 0, 0, 0,
+	0, 0, 0, 115, 0, 7639, 0, 0, 0, 0, 3859, 1376, 0, 0, 0, 0,
+	1357, 2546, 1894, 0, 0, 0, 0, 0, 0, 5152, 0, 0, 0, 2810, 4654, 0,
+	0, 0, 0, 288, 0, 0, 458, 3066, 4867, 0, 0, 0, 0, 0, 0, 0,
+	3135, 2673, 0, 1749, 0, 0, 268, 0, 4360, 0, 7443, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 369, 0, 0, 2497, 2832, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 2247, 0, 0, 5714, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1778, 0, 5096, 7024, 1448, 5741, 992, 0, 2663, 0, 3626, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 144, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 5747, 0, 0, 0, 0, 0, 4455, 0, 0, 663, 0, 0,
+	4412, 0, 0, 0, 4779, 2930, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0,
+	0, 0, 7594, 5993, 326, 0, 0, 0, 0, 0, 0, 2604, 0, 0, 0, 0,
+	0, 3011, 7353, 2267, 0, 0, 6980, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2212, 0, 4319, 3215, 3494, 0, 5545, 0, 0, 0, 0, 0, 0, 0, 0, 7032,
+	0, 0, 8047, 0, 4327, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3548, 0,
+	0, 0, 7899, 3627, 0, 0, 854, 0, 0, 2509, 0, 6220, 2676, 0, 0, 2385,
+	0, 0, 0, 7903, 7235, 0, 4213, 0, 0, 0, 8112, 0, 0, 0, 0, 0,
+	8205, 0, 3514, 0, 0, 0, 0, 0, 3230, 2370, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 525, 0, 0, 0, 0, 5033, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 5597, 0, 0, 0, 1071, 7593, 5093, 0,
+	0, 1558, 0, 0, 138, 0, 0, 0, 0, 0, 0, 4761, 0, 0, 0, 0,
+	0, 3190, 0, 0, 0, 0, 6474, 0, 0, 0, 0, 0, 6343, 0, 0, 0,
+	0, 7280, 4658, 0, 6902, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 7640, 0, 0, 0, 0, 0, 4094, 1830, 0, 896, 0, 0, 4892, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1923, 0, 0,
+	0, 0, 0, 1381, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 505, 6456, 0, 1746, 0, 3534, 0, 0,
+	4587, 0, 4898, 0, 0, 0, 0, 6107, 0, 2988, 0, 0, 0, 0, 1115, 1049,
+	0, 0, 0, 0, 0, 0, 0, 0, 5244, 0, 0, 0, 0, 1137, 2538, 0,
+	54, 4702, 1760, 825, 0, 0, 0, 0, 1511, 0, 0, 0, 1130, 0, 0, 0,
+	7933, 3726, 7967, 0, 0, 0, 0, 7490, 5889, 0, 0, 0, 0, 1213, 0, 0,
+	0, 7651, 0, 962, 7907, 0, 0, 0, 497, 0, 2845, 0, 0, 0, 6519, 0,
+	994, 3280, 0, 7869, 0, 0, 7311, 6472, 0, 0, 0, 0, 0, 1424, 0, 0,
+	0, 0, 0, 4877, 0, 0, 0, 0, 2120, 0, 0, 4603, 3396, 0, 0, 0,
+	3991, 0, 5931, 1859, 0, 0, 6475, 0, 0, 0, 0, 0, 0, 0, 0, 2418,
+	0, 2534, 0, 3273, 0, 0, 0, 0, 0, 0, 0, 480, 0, 0, 0, 84,
+	0, 0, 5858, 0, 0, 0, 0, 3809, 2885, 0, 0, 0, 0, 5550, 0, 0,
+	0, 0, 0, 0, 0, 4647, 0, 0, 0, 0, 0, 0, 0, 0, 2804, 6756,
+	0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 8288, 0, 4523, 1152,
+	0, 0, 0, 0, 0, 2632, 0, 0, 0, 0, 0, 0, 0, 6956, 2890, 2481,
+	6210, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6770, 223, 1418, 0, 0, 0,
+	0, 2047, 0, 0, 0, 0, 3512, 0, 673, 0, 0, 2490, 2677, 0, 0, 6200,
+	1302, 0, 0, 0, 8331, 7395, 0, 0, 0, 0, 0, 3588, 0, 0, 3556, 6048,
+	2674, 0, 4712, 824, 0, 0, 0, 0, 0, 7063, 0, 0, 6882, 0, 0, 1382,
+	0, 0, 0, 2263, 2781, 0, 0, 0, 0, 6325, 0, 0, 0, 0, 0, 0,
+	0, 0, 3304, 500, 7129, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7635, 0,
+	5998, 0, 0, 0, 8338, 1711, 0, 0, 1665, 0, 0, 0, 0, 0, 0, 0,
+	7457, 1461, 0, 0, 4840, 5618, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 2261, 0, 0, 0, 0, 6978, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2024, 0, 2644, 7970, 6070,
+	3520, 0, 0, 0, 0, 7938, 0, 1836, 1610, 0, 0, 0, 862, 0, 0, 0,
+	0, 0, 6788, 0, 0, 0, 0, 0, 0, 3581, 0, 0, 0, 2314, 0, 0,
+	0, 0, 2383, 0, 0, 2668, 4149, 0, 0, 0, 0, 0, 0, 0, 7945, 0,
+	0, 0, 7281, 0, 0, 0, 4441, 0, 0, 0, 0, 0, 0, 6453, 3367, 6337,
+	0, 7330, 0, 0, 0, 0, 2777, 0, 0, 0, 2437, 0, 0, 0, 0, 2912,
+	7327, 6135, 4070, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3353, 0, 959,
+	0, 5427, 0, 4352, 0, 0, 0, 7806, 0, 0, 0, 0, 0, 0, 2853, 2788,
+	0, 0, 5644, 0, 4493, 0, 0, 0, 4609, 192, 0, 0, 8040, 0, 0, 3505,
+	0, 4123, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5210,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 864, 0, 0, 0, 6294, 0,
+	0, 4814, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1395, 0, 0, 0, 0,
+	0, 2246, 3402, 0, 0, 1903, 0, 0, 0, 7603, 0, 0, 0, 0, 0, 1410,
+	7739, 0, 0, 0, 0, 0, 0, 0, 4891, 0, 0, 0, 7682, 0, 6378, 0,
+	0, 5087, 0, 0, 0, 0, 0, 0, 7484, 0, 4252, 7038, 0, 4687, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 522, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1380, 0, 4830, 0,
+	2860, 0, 0, 4178, 2641, 0, 4508, 0, 321, 6222, 7454, 0, 0, 4100, 0, 0,
+	0, 0, 0, 0, 0, 7652, 0, 3837, 7563, 0, 0, 0, 0, 0, 0, 0,
+	6332, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2211, 0, 0,
+	0, 1935, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2001, 0, 1271, 0, 2338,
+	0, 0, 0, 2444, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 603, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6322, 1151, 0, 0,
+	0, 6320, 803, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	7996, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7345, 0, 0, 0, 3170,
+	3612, 0, 0, 0, 0, 0, 8325, 0, 5566, 4410, 0, 0, 0, 0, 0, 0,
+	5303, 0, 2806, 1980, 0, 0, 0, 2019, 0, 2888, 5106, 0, 0, 0, 0, 0,
+	0, 3076, 0, 0, 0, 5021, 0, 6584, 0, 0, 0, 0, 7821, 0, 0, 0,
+	5667, 0, 6849, 1728, 0, 4015, 7778, 0, 0, 0, 0, 0, 4177, 0, 5016, 4020,
+	0, 0, 4028, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2150, 0, 0, 2645,
+	0, 0, 3164, 0, 4251, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 8066, 0, 0, 0, 0, 2141, 0, 0, 7884, 0, 0, 0, 1857, 0, 0,
+	0, 807, 0, 469, 0, 6854, 0, 0, 0, 0, 0, 0, 7301, 0, 0, 0,
+	8150, 0, 0, 0, 0, 1009, 0, 0, 0, 2238, 0, 7155, 0, 2516, 0, 0,
+	0, 0, 0, 0, 0, 0, 4638, 0, 3510, 0, 7206, 0, 0, 0, 1637, 0,
+	5428, 4740, 0, 0, 0, 0, 1766, 0, 0, 0, 0, 4780, 3530, 0, 0, 0,
+	0, 0, 0, 3621, 1314, 0, 0, 0, 0, 727, 0, 0, 0, 0, 0, 1759,
+	0, 0, 0, 4197, 7882, 0, 6688, 0, 4519, 0, 7427, 0, 0, 0, 0, 0,
+	1296, 0, 2045, 0, 0, 0, 0, 7104, 0, 3341, 0, 5721, 0, 3981, 0, 0,
+	0, 0, 3281, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3002,
+	453, 2835, 0, 0, 0, 0, 0, 0, 0, 0, 6515, 0, 0, 0, 0, 0,
+	5947, 0, 0, 7178, 0, 0, 7793, 6613, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 2695, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 2022, 0, 0, 0, 0, 0, 0, 0, 1300, 0, 0, 0, 815,
+	0, 0, 0, 0, 0, 5976, 0, 966, 0, 0, 7107, 5447, 0, 7211, 0, 0,
+	0, 0, 7721, 0, 0, 0, 0, 0, 3462, 6405, 0, 0, 8142, 0, 0, 0,
+	0, 0, 372, 0, 0, 0, 0, 7408, 0, 0, 0, 0, 0, 0, 0, 6202,
+	0, 5500, 0, 0, 2811, 0, 0, 7398, 0, 5316, 0, 1330, 6975, 0, 0, 0,
+	996, 2567, 3250, 5689, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3666, 0, 0, 0, 904, 0, 0, 0, 0, 0, 0, 0,
+	0, 1157, 4726, 0, 0, 0, 0, 7429, 4384, 0, 5123, 1008, 3256, 2998, 6330, 0,
+	0, 0, 4660, 0, 3988, 0, 0, 0, 0, 0, 0, 7627, 0, 0, 0, 7415,
+	0, 0, 0, 1504, 0, 0, 3585, 0, 0, 37, 0, 0, 0, 0, 0, 0,
+	0, 2147, 0, 0, 5962, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1574, 971, 0, 0, 0, 6721, 8238, 0, 4390, 0, 2319, 0, 0, 0, 0, 0,
+	2176, 2305, 0, 0, 0, 0, 3547, 2114, 0, 0, 0, 0, 0, 0, 7683, 0,
+	0, 0, 0, 0, 868, 0, 0, 0, 0, 5475, 0, 0, 124, 0, 0, 0,
+	5388, 0, 0, 330, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 6399, 0, 8273, 3237, 0, 0, 0, 0, 0, 0, 0, 278, 0,
+	359, 0, 0, 0, 0, 4367, 0, 790, 0, 0, 0, 1390, 0, 7180, 7858, 97,
+	0, 8289, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4321, 0, 0,
+	0, 5490, 0, 0, 0, 0, 0, 1111, 0, 0, 0, 0, 1987, 0, 0, 0,
+	0, 0, 0, 0, 0, 6239, 0, 0, 0, 0, 0, 0, 1340, 0, 0, 0,
+	0, 0, 0, 5146, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7543, 0,
+	0, 4031, 0, 221, 5455, 0, 0, 0, 0, 0, 6607, 0, 0, 0, 1183, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7636, 2876, 0, 0, 606,
+	5347, 0, 0, 0, 0, 0, 0, 0, 7100, 0, 3007, 0, 0, 0, 0, 0,
+	122, 0, 0, 7294, 6737, 4012, 0, 0, 1132, 0, 0, 0, 0, 0, 0, 587,
+	23, 8114, 550, 2731, 1399, 0, 552, 0, 7150, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 3826, 0, 0, 0, 0, 0, 0, 1432,
+	0, 504, 0, 0, 0, 0, 8346, 0, 3794, 6430, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 4244, 586, 567, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 6952, 0, 0, 0, 0, 0, 0, 0, 0, 8308, 0, 0, 0, 0, 0,
+	2023, 0, 0, 0, 0, 578, 2279, 8199, 0, 6124, 2586, 6465, 1779, 0, 2072, 0,
+	0, 0, 0, 0, 0, 0, 0, 6108, 0, 0, 4998, 0, 621, 0, 0, 0,
+	0, 0, 0, 0, 0, 101, 0, 0, 0, 0, 6632, 0, 0, 0, 4837, 5180,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 331, 0, 380, 1178, 0,
+	0, 0, 0, 0, 0, 0, 0, 4794, 0, 0, 0, 0, 0, 3412, 0, 0,
+	0, 0, 0, 0, 1901, 0, 0, 3663, 8281, 6927, 0, 0, 0, 3158, 0, 0,
+	0, 3101, 0, 0, 0, 0, 0, 0, 0, 1007, 3641, 0, 0, 0, 1752, 0,
+	0, 0, 0, 0, 0, 0, 0, 5315, 0, 0, 1394, 0, 0, 125, 0, 0,
+	7590, 0, 0, 0, 0, 2116, 0, 0, 6923, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 1719, 0, 0, 0, 0, 7706, 1617, 8257, 8248, 0, 0, 3444, 0,
+	4287, 0, 0, 4920, 5144, 0, 0, 0, 7881, 0, 7161, 0, 0, 0, 1567, 5015,
+	0, 0, 0, 0, 0, 0, 1397, 0, 5134, 0, 0, 0, 0, 8085, 0, 0,
+	0, 0, 0, 5978, 0, 7471, 0, 3875, 6660, 0, 0, 4718, 0, 0, 2266, 0,
+	0, 5902, 0, 0, 0, 0, 1153, 0, 0, 0, 0, 0, 3616, 3126, 5593, 6015,
+	0, 0, 0, 0, 0, 0, 3362, 7548, 3104, 0, 6806, 0, 0, 6073, 30, 0,
+	0, 0, 0, 0, 1702, 7021, 5779, 0, 4147, 785, 0, 911, 0, 0, 3298, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1086, 0, 0,
+	3714, 0, 0, 4902, 0, 5764, 0, 0, 0, 0, 0, 5283, 3640, 0, 0, 0,
+	0, 8060, 6247, 6561, 158, 5214, 0, 25, 0, 0, 6892, 0, 0, 0, 1117, 0,
+	0, 0, 0, 0, 0, 0, 8330, 0, 0, 4299, 256, 3014, 6001, 0, 6995, 0,
+	0, 0, 4420, 0, 0, 2784, 3935, 0, 0, 0, 0, 6990, 0, 0, 0, 0,
+	0, 5028, 0, 0, 0, 0, 7524, 0, 6039, 0, 0, 0, 0, 0, 8135, 0,
+	0, 0, 2013, 0, 0, 0, 2799, 0, 0, 0, 0, 5282, 0, 0, 5768, 0,
+	0, 0, 0, 0, 0, 2169, 0, 0, 0, 0, 0, 6612, 0, 4269, 0, 4789,
+	6216, 0, 0, 7950, 0, 0, 0, 7352, 0, 0, 5235, 6970, 0, 0, 0, 7960,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8170, 0, 0, 0, 0, 0,
+	5554, 7166, 0, 0, 0, 0, 0, 0, 4936, 0, 6427, 0, 3918, 0, 7671, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6074, 0, 0, 0, 1709, 0,
+	0, 0, 0, 0, 0, 4560, 0, 0, 0, 2877, 1367, 0, 6523, 0, 0, 0,
+	0, 0, 0, 0, 0, 4890, 0, 0, 0, 0, 3266, 3680, 0, 0, 0, 5370,
+	3808, 0, 0, 0, 0, 0, 0, 5080, 0, 5790, 0, 0, 6588, 0, 0, 0,
+	773, 0, 0, 0, 3123, 8329, 2870, 8302, 0, 0, 0, 6032, 5249, 0, 0, 0,
+	0, 0, 0, 0, 2293, 0, 0, 3712, 0, 7122, 0, 0, 0, 2783, 0, 0,
+	0, 0, 6315, 0, 0, 0, 0, 0, 5794, 0, 860, 0, 3681, 0, 0, 5084,
+	0, 0, 538, 0, 5506, 0, 0, 0, 0, 0, 2124, 6132, 0, 0, 0, 0,
+	0, 0, 0, 0, 2951, 0, 0, 0, 4831, 1550, 7070, 0, 134, 0, 0, 0,
+	662, 0, 0, 0, 840, 0, 0, 0, 6455, 0, 0, 0, 0, 6677, 0, 0,
+	0, 5036, 949, 0, 0, 8092, 0, 0, 791, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 6889, 6103, 0, 0, 0, 0, 1229, 0, 0, 3259, 0,
+	0, 0, 0, 0, 0, 0, 4339, 7619, 1588, 0, 8169, 0, 0, 0, 0, 1239,
+	2973, 0, 0, 0, 0, 0, 0, 3187, 0, 7551, 1676, 0, 0, 0, 2557, 0,
+	0, 0, 0, 5276, 1854, 3382, 0, 0, 5730, 0, 0, 0, 0, 0, 6803, 0,
+	0, 0, 0, 2438, 0, 0, 6932, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 888, 0, 0, 0, 0, 0, 0, 0, 2248, 0, 0, 0, 0, 0, 0,
+	370, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 385, 0,
+	0, 3662, 0, 0, 0, 7338, 0, 0, 0, 0, 1717, 6407, 4500, 2030, 3223, 4516,
+	0, 0, 0, 0, 0, 5183, 0, 0, 162, 0, 0, 5780, 0, 0, 5344, 0,
+	0, 0, 6368, 0, 3793, 0, 0, 0, 4868, 1199, 3350, 0, 0, 5643, 0, 0,
+	0, 5181, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4405,
+	0, 0, 0, 0, 2419, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1985, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	7138, 7258, 0, 1426, 0, 5449, 0, 0, 0, 4053, 0, 0, 0, 0, 0, 0,
+	0, 845, 4291, 0, 6982, 0, 0, 0, 0, 0, 0, 4753, 0, 0, 5414, 0,
+	5649, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	7364, 0, 0, 0, 0, 0, 0, 0, 1806, 1956, 0, 0, 0, 0, 3798, 0,
+	5251, 0, 0, 0, 1852, 0, 5590, 0, 3870, 0, 0, 2479, 0, 0, 0, 0,
+	0, 0, 5323, 0, 0, 409, 0, 0, 0, 3257, 0, 0, 0, 0, 0, 3324,
+	0, 0, 0, 0, 7351, 0, 0, 8259, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 771, 0, 5968, 0, 0, 0, 0, 0,
+	1670, 0, 0, 7885, 0, 0, 0, 3900, 0, 0, 0, 1639, 0, 1238, 3122, 0,
+	5191, 4071, 0, 0, 0, 3263, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5454, 0,
+	7792, 1638, 6935, 0, 4607, 0, 0, 0, 0, 0, 0, 0, 2642, 0, 0, 0,
+	0, 4552, 0, 0, 0, 0, 0, 0, 0, 0, 5954, 0, 0, 0, 0, 5578,
+	0, 0, 0, 0, 0, 0, 2606, 0, 0, 0, 0, 0, 0, 2460, 0, 0,
+	0, 0, 0, 6913, 7538, 0, 0, 0, 0, 475, 0, 0, 0, 0, 0, 0,
+	0, 1336, 0, 0, 0, 0, 0, 0, 5444, 0, 2901, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 417, 0, 0, 0, 0, 0, 0, 924, 0,
+	0, 0, 3025, 0, 0, 0, 669, 2344, 0, 0, 0, 0, 7994, 5630, 2186, 0,
+	0, 0, 0, 4478, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	175, 0, 0, 0, 0, 0, 0, 2230, 6304, 0, 0, 7583, 6060, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1251, 0,
+	3222, 0, 0, 826, 0, 528, 0, 0, 0, 0, 0, 0, 2313, 0, 0, 5937,
+	2473, 0, 746, 0, 0, 0, 4518, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 7718, 0, 0, 0, 0, 0, 0, 0, 0, 4304,
+	0, 0, 0, 2652, 0, 0, 0, 0, 6488, 0, 0, 0, 0, 0, 2164, 6414,
+	0, 0, 3193, 5088, 0, 5571, 6735, 0, 4084, 2272, 0, 0, 0, 0, 0, 0,
+	4144, 4639, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	5648, 0, 0, 0, 2596, 0, 3086, 0, 0, 0, 5068, 2602, 0, 0, 8009, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 7210, 1604, 0, 7730, 7111, 1129, 0, 0,
+	0, 0, 3603, 7759, 0, 0, 8251, 0, 0, 0, 2797, 0, 0, 0, 0, 0,
+	0, 5253, 444, 0, 7174, 0, 0, 6725, 0, 7252, 7584, 0, 1819, 0, 0, 3481,
+	0, 0, 0, 0, 0, 0, 0, 0, 1365, 0, 0, 1305, 6842, 654, 0, 0,
+	4517, 0, 1655, 0, 0, 0, 3661, 0, 0, 0, 0, 0, 0, 6536, 779, 0,
+	5927, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 605, 0, 7197, 0, 2792,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5891, 2449,
+	0, 0, 0, 0, 0, 7610, 0, 2409, 0, 0, 1984, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 2505, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 2902, 6797, 0, 0, 0, 0, 0, 0, 3810, 0, 0, 0, 5339, 1347,
+	0, 0, 0, 0, 0, 0, 0, 0, 3929, 0, 0, 4612, 0, 0, 6234, 0,
+	0, 4664, 0, 0, 0, 7592, 0, 0, 263, 0, 0, 0, 0, 3867, 6303, 6786,
+	4444, 0, 0, 0, 0, 0, 0, 0, 0, 437, 0, 541, 0, 0, 0, 0,
+	0, 0, 1553, 0, 0, 0, 5203, 0, 4046, 3015, 914, 0, 0, 0, 0, 5255,
+	0, 5362, 0, 0, 0, 0, 0, 0, 0, 1192, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 3425, 0, 0, 0, 0,
+	0, 0, 0, 0, 6146, 939, 0, 0, 0, 5382, 2060, 0, 0, 0, 0, 0,
+	0, 0, 2982, 0, 0, 0, 0, 0, 0, 8264, 0, 0, 7781, 0, 0, 6635,
+	0, 0, 0, 0, 0, 0, 6207, 0, 0, 3693, 4431, 0, 0, 0, 7866, 0,
+	0, 0, 0, 0, 0, 0, 4749, 0, 0, 0, 0, 0, 1327, 0, 0, 0,
+	0, 3537, 1996, 0, 0, 1014, 4962, 4524, 0, 0, 1315, 0, 0, 0, 0, 0,
+	0, 3888, 12, 0, 0, 0, 0, 0, 6260, 0, 0, 346, 0, 0, 0, 7077,
+	0, 0, 0, 0, 0, 0, 0, 3106, 0, 0, 2915, 0, 0, 0, 5387, 0,
+	0, 0, 0, 0, 0, 0, 0, 222, 0, 2199, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 2963, 0, 2579, 0, 3678, 3283, 0, 0, 0, 0, 0, 0, 442,
+	0, 0, 0, 0, 5378, 2787, 0, 2216, 0, 0, 6851, 0, 0, 6373, 0, 0,
+	0, 4085, 0, 0, 2100, 0, 0, 0, 4611, 0, 0, 0, 0, 2427, 0, 0,
+	0, 0, 0, 1187, 0, 0, 0, 0, 0, 0, 3790, 0, 0, 0, 0, 0,
+	392, 0, 2555, 0, 0, 339, 2544, 2333, 0, 0, 891, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 4851, 846, 0, 0, 0, 2493, 0, 4194, 5275, 0, 0,
+	0, 0, 0, 2442, 0, 0, 2871, 0, 3276, 0, 0, 0, 1495, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1729, 3095, 4860, 0, 0, 0, 0, 0,
+	0, 0, 1875, 0, 0, 5070, 0, 0, 0, 0, 0, 3325, 0, 0, 181, 0,
+	0, 0, 5995, 0, 0, 0, 0, 7482, 0, 6114, 6144, 0, 7939, 0, 0, 4129,
+	0, 0, 0, 0, 0, 0, 0, 0, 302, 4350, 0, 0, 0, 0, 8228, 0,
+	0, 0, 2657, 0, 0, 1974, 2128, 0, 0, 0, 2083, 0, 4370, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1370, 0, 0, 0, 0, 7263, 786,
+	0, 0, 0, 0, 0, 0, 0, 0, 3877, 0, 0, 0, 0, 0, 0, 262,
+	1197, 0, 0, 0, 0, 0, 0, 2198, 7108, 7080, 0, 0, 0, 7403, 3096, 0,
+	0, 0, 0, 3059, 742, 0, 3149, 875, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 2063, 0, 0, 0, 0, 2542, 422, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 6424, 0, 6487, 0, 0, 4938, 0, 0, 0, 3784, 0, 0,
+	0, 0, 0, 4487, 0, 0, 0, 0, 0, 0, 0, 0, 2094, 3653, 6351, 0,
+	5474, 0, 0, 0, 0, 8167, 0, 0, 0, 0, 0, 7698, 0, 0, 0, 0,
+	0, 0, 0, 2391, 0, 0, 0, 0, 0, 7608, 0, 7467, 0, 6987, 2327, 0,
+	3121, 1312, 0, 0, 0, 0, 4934, 0, 0, 0, 0, 0, 6768, 4695, 3132, 3765,
+	74, 0, 2091, 0, 0, 0, 0, 3539, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 8055, 0, 736, 0, 3730, 8069, 0, 0, 2867, 0, 0, 3553, 3781,
+	5612, 0, 0, 0, 0, 0, 0, 2458, 0, 0, 3068, 0, 0, 0, 4666, 0,
+	0, 4628, 0, 0, 0, 0, 0, 0, 0, 0, 3862, 0, 0, 0, 0, 2316,
+	8222, 0, 5053, 0, 0, 0, 0, 0, 1186, 0, 0, 0, 3568, 0, 3829, 687,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4721, 2368, 0, 0, 0, 2536,
+	1148, 0, 0, 0, 0, 0, 7348, 0, 0, 0, 4174, 0, 0, 6801, 0, 0,
+	0, 0, 3936, 0, 0, 4485, 1697, 4445, 1003, 0, 0, 0, 0, 0, 6586, 0,
+	0, 0, 6349, 0, 3316, 1783, 0, 0, 0, 0, 0, 0, 1272, 0, 0, 1722,
+	0, 0, 569, 0, 3269, 0, 0, 473, 6529, 0, 6457, 0, 0, 2142, 7689, 3745,
+	0, 7562, 0, 0, 0, 5441, 0, 0, 0, 0, 5720, 2650, 7871, 6983, 0, 0,
+	0, 0, 0, 2724, 0, 0, 0, 3054, 0, 0, 0, 0, 0, 0, 6696, 0,
+	0, 5576, 8314, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 4126, 2255, 60, 0, 0, 0, 0, 0, 0, 6189, 0, 0, 0, 6266,
+	0, 0, 0, 0, 0, 0, 0, 4736, 3801, 53, 0, 0, 0, 2844, 0, 0,
+	0, 0, 0, 0, 5136, 2482, 0, 0, 0, 0, 0, 0, 5345, 5767, 0, 0,
+	0, 8190, 0, 0, 0, 0, 1704, 0, 3103, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 1354, 0, 3079, 0, 0, 0, 0, 0, 0,
+	0, 0, 8242, 6316, 0, 0, 0, 0, 5138, 0, 0, 7995, 7805, 0, 0, 4372,
+	0, 6929, 0, 0, 7897, 0, 876, 317, 0, 0, 0, 495, 5184, 5432, 0, 0,
+	5622, 0, 0, 0, 0, 1232, 0, 0, 0, 0, 2796, 784, 0, 0, 0, 7820,
+	0, 0, 0, 0, 0, 7265, 0, 0, 4273, 0, 0, 677, 1993, 0, 0, 0,
+	0, 3873, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1646, 0, 6651, 0, 0,
+	0, 0, 0, 0, 7287, 8094, 0, 0, 0, 1641, 0, 0, 0, 0, 6647, 0,
+	5127, 0, 7861, 0, 0, 0, 0, 0, 0, 0, 0, 3345, 0, 0, 0, 0,
+	4463, 0, 5222, 0, 0, 0, 0, 0, 6062, 0, 0, 0, 4217, 0, 0, 0,
+	0, 0, 0, 0, 0, 4092, 0, 0, 0, 0, 0, 6511, 7324, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 7898, 2139, 0, 4029, 0, 0, 0,
+	589, 0, 0, 0, 3622, 0, 0, 857, 2359, 0, 0, 3560, 0, 7319, 0, 0,
+	0, 0, 7044, 0, 0, 0, 0, 0, 0, 2790, 0, 0, 1892, 0, 6367, 0,
+	0, 8219, 176, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 4686, 2374, 0, 0, 6479, 2050, 0, 0, 0, 0, 2239,
+	0, 0, 0, 0, 0, 0, 0, 1387, 630, 3894, 6420, 0, 1775, 0, 0, 0,
+	4725, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7133, 0, 6503, 0, 0,
+	1575, 0, 0, 316, 0, 0, 0, 0, 8210, 0, 0, 0, 3578, 0, 0, 0,
+	0, 6377, 0, 0, 0, 0, 0, 3501, 0, 0, 5691, 0, 0, 0, 5964, 0,
+	5652, 0, 0, 0, 6167, 5373, 0, 0, 0, 3912, 0, 6494, 0, 0, 0, 0,
+	0, 4072, 3380, 0, 1911, 0, 0, 0, 7916, 0, 0, 0, 4765, 8262, 0, 0,
+	1310, 3, 459, 7314, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 6116, 0, 0, 0, 0, 0, 0, 0, 0, 4904, 0, 0, 2396, 0, 0,
+	2660, 0, 0, 0, 0, 5848, 6099, 0, 4388, 6972, 0, 0, 0, 1075, 6445, 0,
+	0, 0, 0, 0, 0, 0, 0, 4329, 0, 0, 5024, 1678, 0, 7819, 0, 0,
+	0, 0, 0, 980, 0, 0, 0, 6293, 0, 0, 0, 0, 0, 0, 0, 5727,
+	5424, 5911, 1204, 7817, 0, 0, 7130, 0, 0, 0, 2361, 0, 0, 3292, 0, 0,
+	1733, 0, 0, 212, 0, 8275, 6221, 0, 6563, 0, 1358, 4023, 5463, 0, 0, 0,
+	0, 8058, 4741, 0, 0, 3843, 0, 0, 0, 6722, 0, 0, 0, 0, 0, 0,
+	1095, 5557, 1577, 0, 0, 0, 0, 0, 0, 5094, 4259, 0, 0, 0, 1121, 0,
+	0, 7318, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 990, 0,
+	4103, 4456, 1053, 4543, 0, 0, 0, 8172, 0, 0, 0, 0, 0, 4627, 3839, 0,
+	6942, 0, 0, 0, 1292, 0, 0, 0, 0, 0, 0, 0, 5740, 0, 3764, 0,
+	0, 5164, 0, 1163, 0, 0, 0, 2778, 0, 0, 0, 0, 0, 0, 0, 0,
+	8214, 224, 2135, 0, 7986, 0, 0, 0, 0, 0, 5591, 0, 1805, 0, 0, 0,
+	0, 0, 0, 5913, 0, 4323, 7624, 4167, 3422, 0, 0, 0, 0, 0, 7629, 6419,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 957, 0, 0, 0, 0, 0, 0, 3835, 7874, 0, 0, 5556, 0, 0,
+	0, 0, 8283, 0, 0, 0, 0, 7928, 4005, 0, 368, 0, 0, 0, 0, 0,
+	683, 8120, 0, 0, 0, 8033, 0, 0, 4870, 5777, 0, 0, 0, 5043, 0, 0,
+	0, 0, 3751, 2978, 2280, 1522, 0, 0, 1498, 0, 0, 2920, 0, 0, 0, 0,
+	0, 0, 0, 3242, 4899, 4153, 0, 0, 0, 0, 0, 3914, 6223, 0, 0, 0,
+	0, 0, 0, 3229, 5299, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3770, 0, 0, 3748, 810, 0, 0, 0, 0, 0, 5704, 0, 0, 6050, 3178,
+	0, 2954, 0, 0, 120, 0, 0, 5757, 0, 0, 0, 3278, 7675, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1191, 0, 2767, 0, 0, 0, 3933, 1319, 0, 0,
+	0, 0, 0, 6552, 0, 0, 5137, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3669, 0, 98, 0, 0, 0, 0, 0, 0, 0, 0, 2543, 1325, 0, 0,
+	8003, 0, 0, 0, 4152, 0, 0, 0, 0, 3271, 0, 0, 2347, 383, 0, 0,
+	0, 0, 3124, 0, 0, 0, 5187, 0, 6306, 0, 0, 0, 0, 3787, 0, 5176,
+	1593, 0, 0, 0, 0, 2173, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 5706, 0, 0, 0, 8077, 0, 1762, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 6350, 0, 907, 0, 0, 1928, 0, 0, 0,
+	0, 0, 0, 8254, 0, 0, 0, 2537, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 6535, 0, 1221, 0, 5165, 7144, 0, 0, 0, 0, 4238, 1794, 0, 0,
+	0, 7056, 0, 0, 0, 0, 3339, 0, 0, 3762, 7532, 0, 1804, 3284, 0, 0,
+	0, 0, 0, 0, 0, 0, 5328, 1972, 0, 7908, 0, 251, 7709, 0, 1970, 5379,
+	0, 0, 0, 0, 0, 1063, 0, 0, 4545, 0, 195, 0, 0, 0, 0, 0,
+	0, 2759, 0, 1425, 0, 0, 0, 0, 0, 0, 0, 0, 1552, 6180, 0, 5394,
+	0, 0, 0, 0, 0, 0, 2609, 0, 6092, 0, 0, 0, 0, 4565, 6421, 3855,
+	0, 7841, 5074, 4590, 963, 0, 6754, 867, 0, 3736, 5319, 0, 1455, 0, 0, 0,
+	0, 0, 0, 0, 0, 4104, 0, 3188, 0, 0, 0, 0, 5754, 0, 0, 0,
+	0, 0, 0, 6856, 6243, 6573, 829, 0, 1696, 7868, 5955, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 191, 0, 0, 0, 6816, 0, 0, 0, 0,
+	0, 0, 0, 4744, 0, 0, 0, 6081, 0, 0, 0, 0, 7366, 1220, 6807, 4336,
+	0, 6967, 0, 0, 0, 0, 0, 0, 834, 0, 0, 0, 0, 1159, 0, 2646,
+	0, 0, 0, 6899, 7115, 0, 1141, 4585, 0, 0, 0, 6728, 0, 1545, 3786, 0,
+	0, 0, 0, 0, 0, 0, 6840, 0, 0, 0, 2220, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 2568, 3334, 0, 0, 0, 0, 844, 0, 0, 0, 0,
+	0, 0, 0, 0, 2320, 0, 0, 0, 0, 0, 4282, 0, 0, 3147, 0, 0,
+	0, 0, 0, 0, 0, 0, 7439, 6435, 0, 0, 0, 0, 1720, 0, 0, 0,
+	7569, 0, 0, 0, 0, 0, 5975, 2077, 0, 0, 2512, 0, 0, 0, 0, 0,
+	4228, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5460, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 516, 2916, 0, 6333, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 2710, 1037, 0, 0, 0, 0, 0, 0, 4189, 0,
+	0, 0, 0, 0, 0, 216, 455, 0, 0, 0, 7132, 0, 0, 0, 0, 1808,
+	0, 0, 0, 0, 5163, 0, 0, 0, 0, 0, 0, 0, 2369, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 7057, 0, 0, 0, 0, 0, 0,
+	6404, 0, 0, 0, 0, 0, 4164, 0, 0, 0, 0, 0, 0, 4745, 0, 0,
+	0, 1767, 0, 0, 0, 0, 0, 0, 0, 4662, 0, 5437, 0, 0, 0, 0,
+	0, 2726, 6061, 0, 0, 0, 324, 4706, 0, 0, 0, 0, 0, 0, 0, 2776,
+	0, 7648, 0, 0, 0, 0, 0, 4727, 853, 0, 0, 0, 2379, 0, 6570, 0,
+	0, 0, 0, 0, 0, 0, 0, 1223, 0, 5265, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 1797, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5928, 0, 0,
+	0, 0, 0, 0, 0, 0, 6657, 0, 0, 0, 0, 0, 0, 0, 172, 7230,
+	7198, 0, 0, 0, 6460, 0, 0, 375, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 5216, 0, 0, 0, 4539, 0, 6376, 0, 0, 0, 4731, 0, 0, 5298, 0,
+	0, 0, 2415, 0, 0, 1136, 0, 0, 0, 0, 5423, 0, 6789, 0, 0, 0,
+	0, 7649, 0, 7618, 0, 0, 5681, 0, 0, 0, 0, 6137, 0, 0, 0, 0,
+	3886, 7425, 0, 2177, 0, 0, 5158, 0, 0, 0, 3774, 0, 1472, 0, 0, 0,
+	0, 0, 4209, 0, 0, 0, 2999, 0, 0, 0, 0, 0, 1126, 0, 3577, 4692,
+	0, 0, 0, 8317, 0, 0, 0, 0, 0, 0, 0, 0, 568, 7329, 0, 0,
+	0, 0, 0, 0, 0, 0, 8123, 0, 0, 0, 0, 0, 0, 0, 0, 91,
+	0, 0, 6439, 14, 5970, 2071, 0, 0, 4708, 0, 0, 0, 0, 0, 0, 0,
+	0, 1750, 0, 0, 0, 0, 540, 0, 0, 3089, 0, 0, 0, 7083, 6161, 0,
+	4044, 0, 7386, 770, 0, 4729, 0, 0, 0, 0, 0, 0, 0, 5119, 0, 1685,
+	0, 0, 0, 42, 0, 4343, 4159, 0, 0, 0, 0, 0, 0, 0, 740, 4656,
+	802, 5242, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3495, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 5324, 0, 0, 0, 4107, 0, 0, 0, 0,
+	0, 0, 0, 3130, 3282, 0, 1772, 4793, 0, 131, 0, 0, 3779, 4501, 0, 0,
+	0, 0, 0, 0, 659, 1269, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 6769, 0, 0, 5953, 0, 86, 0, 0, 0, 0, 0, 0, 0, 0, 4175,
+	0, 79, 5256, 0, 0, 6608, 3093, 0, 6930, 0, 0, 0, 0, 0, 0, 0,
+	8239, 0, 0, 0, 0, 0, 2277, 0, 5453, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 7098, 0, 0, 5657, 0, 0, 0, 0, 0, 0, 0, 0,
+	3169, 0, 0, 0, 0, 0, 0, 6554, 0, 428, 0, 0, 0, 0, 7015, 0,
+	0, 0, 0, 5635, 0, 0, 0, 2254, 0, 0, 0, 0, 2003, 0, 0, 0,
+	7690, 0, 0, 0, 0, 0, 0, 3056, 0, 676, 0, 0, 0, 2294, 0, 0,
+	0, 2558, 0, 0, 0, 4049, 0, 0, 0, 0, 0, 0, 0, 0, 5634, 0,
+	0, 0, 0, 0, 0, 6055, 0, 0, 0, 4832, 0, 0, 5091, 0, 2492, 2098,
+	0, 0, 0, 0, 615, 0, 5288, 0, 0, 0, 0, 0, 0, 5518, 1990, 0,
+	7448, 0, 0, 0, 0, 0, 0, 0, 0, 5782, 0, 0, 0, 0, 8348, 0,
+	0, 0, 0, 0, 0, 0, 0, 6012, 0, 0, 3682, 0, 7186, 0, 0, 0,
+	3930, 0, 0, 668, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7507, 0,
+	0, 0, 0, 0, 0, 2315, 5363, 2090, 931, 5606, 0, 8267, 0, 0, 5472, 0,
+	0, 4797, 1211, 0, 0, 0, 0, 0, 5516, 0, 0, 2843, 0, 0, 0, 6388,
+	0, 7668, 0, 0, 4089, 0, 0, 5309, 4808, 0, 3997, 0, 0, 0, 0, 0,
+	0, 0, 3857, 0, 0, 0, 4271, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	8006, 0, 5507, 0, 0, 7837, 0, 0, 0, 5897, 0, 0, 2699, 0, 0, 0,
+	0, 0, 0, 1264, 2958, 0, 2331, 0, 0, 0, 0, 0, 5839, 7134, 0, 0,
+	5027, 0, 5410, 2182, 0, 0, 7725, 0, 0, 0, 0, 2372, 0, 0, 0, 7944,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 608, 0, 7851, 0, 0, 0, 0,
+	0, 0, 0, 5532, 4359, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	7401, 0, 431, 2308, 0, 1379, 0, 0, 0, 0, 0, 6583, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 5713, 0, 0, 2841, 2174, 6863, 0, 3473, 3364, 0, 0,
+	0, 0, 0, 0, 119, 0, 0, 1214, 0, 0, 0, 0, 0, 0, 3617, 0,
+	0, 0, 0, 4036, 238, 0, 8269, 0, 0, 0, 0, 0, 0, 0, 2755, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 2226, 3053, 0, 3156, 0, 5761, 0, 4926, 0, 1668, 0, 0, 0,
+	0, 1583, 0, 0, 2984, 6879, 6520, 0, 0, 0, 0, 1924, 0, 0, 0, 0,
+	0, 1000, 0, 0, 0, 7989, 0, 0, 8220, 0, 0, 0, 2545, 0, 0, 7068,
+	0, 0, 7499, 0, 655, 5906, 6875, 0, 0, 0, 0, 0, 1114, 0, 0, 0,
+	0, 5076, 0, 1525, 0, 0, 7253, 0, 0, 66, 0, 0, 0, 0, 5040, 0,
+	0, 0, 0, 0, 0, 0, 4162, 1947, 0, 1248, 0, 0, 498, 5124, 0, 1635,
+	0, 0, 0, 0, 1926, 0, 0, 0, 0, 5459, 0, 2761, 0, 0, 0, 0,
+	7727, 0, 0, 7905, 0, 0, 4953, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 2234, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1891, 0, 0, 0, 0, 0, 3619, 0, 0, 0, 0, 0, 0, 3987, 0, 0,
+	8174, 2097, 0, 0, 0, 0, 0, 0, 0, 1725, 5617, 0, 0, 0, 1523, 0,
+	0, 0, 0, 0, 0, 4756, 0, 0, 0, 0, 1092, 3082, 0, 0, 0, 0,
+	0, 6067, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 2487, 0, 0, 0, 0, 0, 0, 0, 232, 3923,
+	0, 0, 0, 0, 2155, 0, 0, 3676, 0, 4709, 0, 0, 408, 0, 0, 0,
+	7369, 0, 5690, 0, 0, 3226, 2105, 0, 1386, 0, 0, 0, 0, 0, 6040, 8168,
+	0, 0, 3515, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	8008, 0, 0, 0, 0, 3311, 5774, 0, 6371, 0, 4613, 2560, 0, 0, 0, 0,
+	0, 0, 0, 4503, 0, 0, 4540, 0, 0, 1596, 0, 0, 3533, 0, 0, 2055,
+	4937, 0, 0, 0, 0, 0, 0, 4096, 0, 0, 0, 0, 1631, 7164, 0, 6206,
+	0, 0, 0, 0, 7522, 0, 0, 0, 0, 0, 7934, 0, 0, 0, 8133, 0,
+	0, 0, 0, 0, 0, 0, 7110, 6679, 0, 0, 0, 0, 524, 0, 0, 0,
+	0, 0, 0, 6138, 0, 7447, 0, 0, 0, 851, 6986, 0, 4677, 3111, 8337, 7245,
+	0, 0, 3783, 0, 1994, 0, 0, 4190, 0, 0, 0, 0, 8084, 0, 981, 0,
+	0, 0, 2394, 0, 0, 0, 2144, 0, 0, 70, 0, 7962, 0, 3863, 6426, 0,
+	0, 0, 0, 3115, 2031, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5901, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3434, 0, 0, 0,
+	0, 0, 6027, 0, 0, 0, 0, 0, 0, 5787, 0, 0, 2611, 0, 1561, 0,
+	0, 2619, 0, 0, 1916, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2659, 7713, 0, 2221, 0, 0, 0, 0, 6365, 3455, 0, 0, 729, 0, 1154, 0,
+	0, 0, 0, 3265, 0, 0, 2387, 0, 0, 0, 0, 0, 530, 0, 0, 1885,
+	0, 0, 0, 0, 0, 0, 0, 0, 7904, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 1664, 0, 0, 0, 4989, 0, 710, 0, 0, 0, 0, 972, 0, 0,
+	0, 0, 0, 0, 199, 4105, 0, 0, 7331, 0, 1555, 0, 0, 301, 0, 8258,
+	0, 3973, 0, 0, 3932, 0, 0, 0, 0, 0, 4641, 1787, 0, 3231, 0, 7494,
+	0, 0, 0, 1871, 0, 5960, 0, 0, 6974, 0, 2541, 0, 0, 0, 0, 6467,
+	0, 0, 0, 0, 0, 0, 0, 4739, 0, 0, 0, 4580, 0, 0, 0, 0,
+	0, 0, 0, 1954, 0, 0, 0, 6917, 0, 5143, 2340, 0, 0, 0, 0, 227,
+	0, 0, 0, 0, 0, 8086, 0, 0, 6834, 0, 1490, 0, 0, 0, 0, 0,
+	6853, 0, 0, 0, 4674, 0, 2839, 0, 0, 0, 0, 0, 7812, 0, 0, 0,
+	4865, 0, 0, 0, 0, 0, 0, 0, 0, 1033, 3836, 0, 5735, 877, 4275, 6273,
+	0, 0, 0, 0, 0, 0, 7488, 0, 0, 0, 2823, 0, 0, 8098, 0, 0,
+	2410, 0, 0, 0, 0, 5752, 0, 0, 2504, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 4930, 734, 2629, 3335, 0, 0, 8309,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 633, 0, 0, 0, 6110, 0,
+	0, 3928, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6201, 6762,
+	0, 3832, 0, 0, 1589, 0, 0, 2900, 0, 0, 0, 0, 0, 0, 0, 7751,
+	0, 7402, 0, 6118, 0, 0, 0, 3485, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 7789, 664, 0, 0, 0, 0, 5945,
+	0, 0, 0, 0, 3051, 0, 0, 0, 6844, 0, 0, 0, 0, 0, 4905, 0,
+	0, 0, 5613, 0, 0, 2058, 3729, 0, 0, 0, 4200, 0, 0, 0, 0, 8070,
+	0, 0, 4630, 1961, 0, 0, 0, 7199, 0, 5398, 0, 0, 0, 0, 6898, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2869, 0, 2278, 0, 0,
+	0, 0, 0, 3416, 0, 2814, 0, 0, 0, 0, 533, 0, 780, 0, 0, 1428,
+	0, 0, 0, 6440, 0, 0, 0, 6171, 0, 0, 0, 0, 5238, 0, 0, 0,
+	1139, 0, 0, 0, 0, 1644, 6000, 0, 839, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 4958, 0, 0, 0, 0, 0, 8116, 0, 644, 0, 0,
+	7977, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1234, 3876, 0,
+	0, 0, 0, 0, 0, 558, 7606, 4802, 0, 7708, 1339, 0, 0, 0, 0, 3625,
+	0, 2764, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 187, 0, 0, 0,
+	0, 0, 611, 0, 0, 0, 0, 5147, 0, 0, 0, 0, 5936, 4335, 5375, 0,
+	0, 0, 0, 0, 0, 0, 1247, 0, 0, 0, 0, 0, 214, 0, 0, 5823,
+	0, 6897, 0, 0, 0, 0, 6855, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 2742, 0, 0, 0, 0, 0, 0, 0, 0, 7598, 0, 0, 6470, 4207,
+	8053, 0, 6229, 0, 0, 0, 0, 0, 0, 5353, 0, 0, 0, 0, 0, 0,
+	2701, 6205, 0, 0, 1316, 0, 0, 0, 0, 0, 0, 0, 956, 0, 0, 545,
+	0, 5223, 447, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 6150, 0, 0, 0, 3587, 898, 77, 0, 0, 11, 5048, 0, 0,
+	0, 0, 0, 0, 0, 4925, 0, 1036, 0, 0, 0, 0, 5114, 0, 0, 0,
+	0, 6818, 0, 7667, 0, 494, 6072, 7416, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 837, 0, 0, 0, 0, 0, 0, 2143, 0, 0, 0, 4600, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3668, 0, 0, 7971, 0,
+	0, 0, 0, 0, 0, 6893, 0, 0, 59, 7109, 0, 0, 234, 0, 6971, 0,
+	0, 0, 0, 0, 0, 4599, 0, 0, 0, 0, 0, 0, 1966, 0, 0, 0,
+	0, 4788, 0, 6256, 5640, 0, 0, 1400, 0, 4679, 0, 0, 0, 0, 4119, 0,
+	0, 0, 0, 4182, 0, 0, 3884, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 7797, 0, 0, 0, 0, 4940, 0, 0, 2671, 4048, 0, 0, 7011, 0, 0,
+	0, 0, 0, 0, 0, 0, 3516, 0, 0, 0, 1193, 0, 1540, 0, 0, 0,
+	0, 0, 6817, 0, 0, 0, 0, 0, 2735, 1828, 0, 7959, 5641, 0, 0, 6895,
+	0, 0, 6760, 0, 0, 0, 0, 0, 0, 5804, 0, 0, 0, 0, 6779, 5415,
+	0, 0, 0, 0, 7815, 0, 0, 0, 3084, 0, 3592, 0, 0, 0, 0, 6510,
+	0, 0, 3584, 0, 0, 0, 0, 0, 0, 0, 5686, 0, 0, 0, 0, 5056,
+	4376, 2904, 0, 0, 3474, 5349, 0, 0, 0, 0, 0, 0, 0, 4128, 0, 0,
+	0, 4472, 0, 0, 0, 0, 0, 0, 0, 443, 7613, 0, 3704, 6702, 5493, 7399,
+	503, 0, 0, 0, 2127, 0, 0, 0, 0, 0, 0, 0, 1605, 0, 0, 0,
+	0, 7895, 0, 6658, 0, 0, 0, 8250, 0, 0, 0, 0, 0, 5112, 0, 0,
+	0, 7972, 6483, 0, 0, 0, 0, 0, 0, 0, 0, 5846, 0, 0, 6551, 7919,
+	5418, 0, 4553, 0, 0, 0, 5837, 0, 4464, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3142, 0, 0, 5733, 0, 0, 0, 0, 0, 0, 0, 3639, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 259, 0,
+	0, 0, 8266, 1512, 3236, 0, 0, 8226, 0, 0, 0, 0, 1279, 0, 0, 0,
+	0, 2336, 0, 5694, 0, 0, 0, 5433, 0, 4567, 0, 4809, 0, 0, 0, 0,
+	0, 3715, 0, 0, 0, 0, 0, 0, 0, 0, 2752, 5482, 5012, 0, 6968, 0,
+	17, 0, 0, 0, 0, 0, 6250, 0, 0, 0, 0, 0, 0, 1276, 0, 0,
+	0, 0, 0, 0, 2401, 0, 0, 0, 0, 0, 7987, 0, 0, 0, 0, 8129,
+	0, 0, 0, 4425, 0, 4198, 4563, 0, 0, 0, 0, 0, 0, 0, 0, 7504,
+	0, 0, 0, 7557, 0, 0, 0, 0, 3295, 0, 0, 7843, 8268, 4661, 0, 0,
+	0, 0, 0, 6288, 0, 0, 4858, 0, 1407, 3413, 6642, 3218, 0, 0, 0, 0,
+	0, 0, 6091, 0, 0, 0, 0, 6524, 7829, 1905, 0, 0, 418, 1173, 0, 0,
+	0, 0, 4746, 3154, 0, 0, 0, 5013, 0, 0, 5863, 0, 0, 0, 4900, 2737,
+	0, 3749, 0, 2468, 0, 0, 0, 0, 0, 0, 87, 0, 0, 2631, 3355, 0,
+	0, 0, 0, 3883, 816, 8044, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4994,
+	0, 0, 0, 0, 0, 0, 3738, 0, 0, 0, 0, 5393, 0, 0, 0, 0,
+	0, 0, 0, 5540, 0, 0, 5435, 0, 0, 4077, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 7498, 0, 0, 0, 0, 2053, 0, 0, 0, 0, 197, 0, 0,
+	0, 0, 0, 0, 1335, 0, 0, 0, 0, 0, 0, 0, 5797, 0, 0, 0,
+	0, 5825, 3020, 5260, 0, 0, 0, 1122, 3310, 1914, 0, 5261, 0, 5857, 0, 0,
+	2136, 0, 0, 0, 4364, 0, 0, 315, 0, 0, 0, 0, 0, 0, 0, 2093,
+	0, 0, 0, 0, 3252, 6292, 2680, 0, 0, 4442, 0, 775, 0, 0, 0, 3990,
+	625, 0, 6076, 4784, 0, 0, 0, 0, 0, 0, 7549, 0, 0, 0, 0, 0,
+	0, 596, 0, 0, 5577, 0, 6433, 0, 0, 0, 0, 0, 0, 4278, 0, 0,
+	7140, 0, 0, 0, 5277, 6097, 0, 6732, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 2540, 0, 0, 0, 0, 0, 1710, 641, 0, 0, 0, 0, 0,
+	0, 0, 0, 44, 0, 1162, 7588, 640, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 6699, 2032, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 5988, 0, 0, 5833, 0, 0, 0, 4652, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 5868, 0, 0, 0, 6400, 0, 5476, 863, 0, 0, 4294, 0,
+	0, 0, 0, 0, 619, 5008, 0, 0, 1391, 1793, 0, 0, 0, 0, 2617, 5086,
+	4239, 0, 0, 0, 0, 0, 3182, 0, 0, 0, 3088, 0, 5801, 6533, 63, 0,
+	0, 0, 185, 0, 0, 0, 0, 0, 511, 7433, 0, 0, 0, 0, 2703, 0,
+	0, 0, 0, 0, 4615, 0, 0, 0, 0, 900, 0, 2667, 8079, 3315, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 4180, 0, 0, 916, 6610, 0, 0, 0,
+	0, 0, 0, 0, 0, 2821, 0, 0, 0, 8297, 0, 0, 0, 0, 4571, 0,
+	1734, 4263, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8232, 0, 0, 0, 0,
+	0, 4532, 0, 0, 7719, 5219, 0, 3652, 0, 0, 0, 0, 5645, 0, 3685, 0,
+	4035, 0, 0, 8154, 0, 4550, 0, 0, 1705, 1883, 0, 4116, 0, 0, 0, 0,
+	3369, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2711, 0, 0, 0, 0, 7723,
+	435, 0, 0, 291, 0, 0, 0, 4823, 4156, 0, 0, 1536, 0, 0, 0, 5932,
+	0, 0, 0, 6505, 0, 0, 0, 0, 0, 0, 7089, 0, 0, 0, 0, 0,
+	1669, 0, 0, 0, 0, 0, 365, 7119, 3559, 0, 0, 0, 0, 4494, 0, 0,
+	5965, 0, 5416, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4443, 4853,
+	7152, 1, 0, 0, 0, 2964, 0, 0, 0, 0, 7207, 3404, 387, 0, 0, 0,
+	0, 0, 4864, 0, 0, 7728, 7121, 7520, 0, 0, 0, 0, 7880, 0, 0, 0,
+	0, 0, 0, 0, 0, 954, 0, 4965, 6008, 0, 0, 3772, 0, 3099, 0, 0,
+	0, 0, 7517, 0, 0, 0, 2456, 0, 0, 0, 0, 5859, 8185, 0, 3195, 1341,
+	5291, 0, 0, 0, 878, 7147, 0, 0, 0, 3221, 0, 7195, 0, 0, 4058, 0,
+	0, 0, 6187, 0, 0, 0, 8310, 0, 0, 384, 0, 0, 2812, 0, 0, 0,
+	2858, 2454, 0, 0, 0, 0, 0, 255, 0, 4536, 0, 0, 0, 5065, 3148, 0,
+	4225, 3720, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3108, 0,
+	0, 0, 3301, 0, 5615, 2779, 0, 0, 0, 0, 4678, 1227, 0, 7800, 0, 0,
+	0, 0, 0, 0, 0, 1951, 283, 0, 0, 6466, 0, 1731, 7581, 0, 0, 0,
+	0, 2774, 0, 0, 0, 0, 0, 0, 6670, 0, 0, 0, 0, 0, 3018, 1097,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 3670, 0, 0, 0, 0, 1385, 5873,
+	6556, 0, 0, 0, 0, 0, 7733, 0, 2466, 0, 2822, 3378, 0, 6550, 0, 0,
+	4819, 0, 0, 0, 0, 0, 0, 2051, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3112, 0, 0, 0, 0, 0, 4847, 0, 4158, 3922, 0, 0, 0,
+	0, 0, 0, 6307, 0, 0, 0, 0, 3947, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 4489, 1930, 0, 0, 4636, 7697, 0, 0, 2210, 0, 7411, 0, 2467,
+	0, 0, 0, 0, 0, 0, 3253, 6139, 0, 0, 8156, 0, 4064, 0, 2012, 341,
+	0, 0, 7072, 5563, 0, 0, 697, 0, 0, 1748, 0, 0, 0, 0, 0, 6057,
+	0, 0, 5357, 2896, 0, 0, 0, 0, 0, 6641, 0, 0, 723, 0, 152, 0,
+	0, 5834, 47, 5464, 0, 6996, 0, 0, 0, 7309, 276, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2197, 0, 0, 0, 0, 0, 0, 3447, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 3689, 0, 0, 6691, 0, 4959, 0, 0, 0, 0,
+	2848, 0, 0, 0, 0, 2628, 4510, 1096, 0, 0, 958, 0, 0, 5497, 0, 6254,
+	0, 0, 4535, 0, 0, 0, 0, 0, 0, 720, 0, 1884, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6431, 0, 0,
+	7344, 8106, 0, 0, 0, 0, 0, 5661, 0, 0, 0, 0, 0, 2947, 5646, 0,
+	0, 988, 0, 0, 0, 0, 8312, 0, 0, 3773, 0, 7196, 0, 0, 0, 0,
+	0, 0, 0, 3421, 0, 0, 3760, 0, 0, 0, 0, 0, 4088, 0, 0, 0,
+	0, 6698, 0, 0, 5, 0, 8089, 0, 0, 0, 0, 93, 2992, 0, 0, 2518,
+	0, 4348, 3294, 0, 6981, 6098, 7337, 0, 0, 908, 0, 0, 5803, 6246, 510, 0,
+	0, 6783, 0, 0, 0, 6226, 0, 0, 7784, 0, 0, 0, 0, 0, 0, 7289,
+	114, 0, 0, 2484, 0, 0, 0, 0, 3789, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 4881, 0, 0, 0, 1844, 0, 0, 4527, 5257, 5487, 0,
+	0, 0, 0, 0, 0, 7625, 164, 0, 6609, 0, 0, 0, 7127, 0, 0, 0,
+	0, 4907, 0, 0, 7282, 0, 0, 6886, 0, 0, 0, 0, 0, 4629, 0, 0,
+	5185, 0, 0, 2550, 0, 0, 638, 0, 0, 0, 1188, 0, 0, 544, 1773, 0,
+	0, 0, 0, 5205, 0, 434, 0, 0, 0, 0, 0, 5457, 0, 0, 0, 0,
+	6068, 0, 0, 0, 0, 0, 0, 0, 0, 7023, 0, 5055, 2859, 3806, 7092, 0,
+	7650, 0, 3385, 0, 0, 5655, 6009, 6723, 6799, 7669, 0, 0, 0, 0, 1174, 0,
+	0, 0, 0, 0, 6006, 0, 0, 0, 0, 2076, 0, 2407, 0, 0, 7886, 0,
+	4281, 0, 0, 0, 0, 3211, 6634, 0, 0, 0, 8001, 0, 0, 0, 0, 0,
+	4751, 0, 6264, 0, 0, 0, 6939, 0, 0, 5949, 7200, 4901, 0, 0, 0, 1781,
+	0, 0, 0, 5800, 0, 0, 4838, 0, 0, 2095, 0, 4803, 0, 0, 0, 3499,
+	0, 1059, 0, 0, 0, 0, 7303, 0, 0, 0, 3453, 0, 1847, 0, 3565, 5620,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5062, 0, 0, 0, 0, 0,
+	0, 0, 0, 6290, 0, 0, 2298, 0, 0, 0, 0, 0, 7404, 730, 4845, 0,
+	0, 6796, 180, 3046, 6514, 0, 1044, 0, 4439, 7918, 5269, 0, 0, 0, 0, 0,
+	0, 0, 0, 6177, 0, 0, 0, 3321, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 6211, 0, 0, 378, 0, 0, 0, 0, 0,
+	0, 0, 0, 7750, 0, 5111, 0, 5828, 0, 0, 0, 0, 0, 0, 5732, 0,
+	0, 6843, 0, 0, 0, 0, 3161, 0, 0, 0, 0, 0, 0, 0, 0, 6711,
+	0, 0, 0, 260, 0, 0, 0, 6449, 5073, 0, 0, 0, 0, 0, 8209, 0,
+	0, 922, 694, 0, 3942, 6047, 0, 0, 0, 0, 0, 0, 0, 1025, 0, 8351,
+	0, 118, 0, 0, 5367, 0, 0, 0, 0, 2739, 0, 7761, 0, 0, 7217, 0,
+	4056, 3654, 4408, 304, 7171, 7392, 0, 0, 0, 0, 4711, 0, 0, 4859, 0, 0,
+	6793, 0, 1736, 0, 0, 4065, 0, 0, 7685, 0, 0, 7163, 0, 684, 0, 7212,
+	0, 0, 5289, 0, 0, 0, 0, 0, 1290, 0, 4280, 0, 0, 4506, 3234, 0,
+	0, 2339, 3058, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4246, 0, 0, 6784,
+	0, 0, 0, 0, 3572, 0, 0, 7136, 0, 0, 0, 3955, 0, 3329, 7503, 0,
+	0, 0, 0, 7798, 0, 0, 0, 0, 160, 1435, 0, 7368, 0, 4358, 3136, 0,
+	0, 0, 0, 6744, 0, 0, 0, 0, 1131, 0, 3702, 0, 0, 2594, 0, 0,
+	0, 0, 0, 3397, 0, 0, 0, 0, 0, 0, 2494, 0, 0, 0, 1753, 4118,
+	0, 4220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2583, 0, 0,
+	4165, 198, 0, 0, 0, 1616, 0, 0, 0, 0, 1614, 0, 0, 0, 0, 0,
+	0, 279, 4747, 0, 0, 0, 6185, 0, 0, 2393, 0, 0, 0, 0, 1369, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 6192, 0, 0, 0, 2123, 0, 0, 0,
+	0, 0, 0, 5259, 0, 6738, 1185, 4465, 0, 4813, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 7906, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4249, 0, 0, 6596, 0, 0, 0, 0, 0, 4202, 7777, 0, 0, 0, 7035, 2328,
+	0, 0, 0, 0, 0, 0, 0, 5636, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 4187, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5458, 5061, 3733, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3426, 0, 0, 5997, 0, 137,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 2524, 580, 0, 1216, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 614, 1073, 0, 211, 5202, 0, 3788,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7124, 5392, 5866, 0, 0, 2704,
+	0, 0, 0, 0, 0, 1366, 0, 0, 3860, 0, 38, 0, 90, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 7696, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 7616, 0, 0, 0, 3264, 0, 0, 6176, 0, 7412, 3747, 0, 0, 1831, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6761, 6979, 0, 0,
+	7940, 0, 0, 0, 0, 0, 0, 0, 0, 577, 0, 0, 0, 0, 0, 0,
+	0, 4421, 0, 3752, 0, 1041, 0, 7040, 0, 0, 0, 0, 0, 0, 6661, 7232,
+	5697, 0, 3874, 2944, 913, 0, 0, 0, 0, 4235, 0, 0, 0, 0, 3138, 2709,
+	0, 3393, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5791, 0,
+	0, 4199, 0, 0, 0, 0, 0, 1960, 0, 4266, 0, 7149, 0, 0, 0, 0,
+	0, 0, 0, 2903, 1514, 0, 752, 3892, 3172, 0, 883, 0, 0, 0, 0, 0,
+	0, 1818, 0, 1480, 0, 0, 0, 2408, 0, 76, 0, 0, 4210, 0, 0, 6780,
+	0, 4800, 4671, 0, 0, 349, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 5494, 0, 0, 0, 0, 0, 0, 0, 1983,
+	0, 0, 0, 0, 0, 0, 0, 2161, 1287, 0, 3023, 0, 0, 0, 0, 0,
+	8182, 3707, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3225, 0, 0, 0, 0, 7984, 0, 0, 0, 4344, 0, 0, 3728, 0,
+	0, 0, 0, 0, 2089, 5838, 6244, 0, 4462, 0, 7515, 0, 2773, 190, 0, 0,
+	0, 0, 0, 3686, 4334, 0, 0, 0, 0, 1235, 0, 0, 5522, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1333, 0, 0, 3166, 0, 0, 0,
+	0, 0, 0, 0, 0, 3545, 0, 0, 438, 0, 8212, 0, 0, 0, 0, 0,
+	5977, 0, 0, 0, 1982, 5844, 0, 3177, 0, 0, 0, 244, 548, 3373, 0, 0,
+	269, 5405, 0, 3432, 0, 0, 0, 3260, 0, 0, 0, 0, 0, 5559, 0, 0,
+	0, 8126, 0, 0, 0, 7714, 0, 0, 0, 7867, 0, 0, 2598, 7156, 0, 0,
+	0, 0, 0, 0, 7126, 3734, 0, 0, 0, 419, 0, 0, 0, 0, 1751, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5503, 0, 0, 0, 0,
+	5802, 6606, 0, 0, 0, 0, 0, 5126, 0, 0, 7909, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 7177, 0, 0, 7796, 0, 1959, 0, 0,
+	0, 0, 2664, 2406, 0, 0, 0, 3763, 0, 0, 4855, 0, 2700, 0, 55, 0,
+	0, 8166, 0, 0, 0, 0, 7929, 6233, 2634, 0, 0, 0, 0, 1280, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1439, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 4757, 4351, 0, 0, 0, 0, 7839, 6650, 0, 4262, 0,
+	0, 2686, 0, 0, 0, 0, 0, 4875, 2894, 0, 0, 0, 0, 0, 0, 7679,
+	6398, 0, 0, 0, 2146, 0, 1262, 0, 0, 3439, 1338, 0, 3152, 7160, 0, 2613,
+	0, 0, 0, 6011, 0, 0, 1580, 0, 0, 0, 0, 6094, 5969, 0, 0, 0,
+	4196, 0, 4578, 0, 0, 0, 0, 0, 2678, 0, 0, 0, 0, 6311, 0, 5314,
+	4582, 0, 0, 0, 0, 8215, 0, 7767, 0, 0, 0, 0, 0, 0, 7097, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 446, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4138, 0, 0, 2813, 2789,
+	0, 292, 0, 0, 1483, 0, 3614, 0, 0, 0, 0, 0, 0, 0, 5509, 0,
+	0, 0, 0, 7762, 0, 4011, 0, 0, 5871, 0, 6374, 0, 0, 0, 0, 0,
+	0, 0, 7452, 0, 0, 0, 7531, 4818, 0, 0, 5805, 0, 0, 6344, 0, 471,
+	0, 5544, 7463, 2041, 0, 0, 0, 2010, 0, 3141, 0, 0, 0, 0, 3866, 0,
+	0, 6757, 0, 0, 210, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7611, 0,
+	4391, 5616, 0, 0, 0, 7300, 3526, 0, 0, 2181, 0, 0, 0, 2303, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6372, 0, 2526,
+	0, 0, 0, 0, 0, 0, 2918, 0, 5066, 0, 0, 1757, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 3844, 5327, 561, 0, 0, 2587, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3615, 0,
+	3536, 0, 8097, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7508, 5629,
+	0, 0, 0, 0, 0, 7673, 0, 0, 551, 3459, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 4772, 0, 0, 0, 0, 0, 6493, 0, 3611, 0,
+	3552, 0, 0, 0, 0, 0, 0, 889, 0, 0, 0, 2794, 6504, 0, 0, 0,
+	5565, 0, 4326, 4306, 0, 0, 143, 0, 6004, 0, 0, 0, 905, 0, 0, 0,
+	0, 0, 2908, 0, 0, 762, 7317, 4828, 0, 0, 0, 0, 0, 0, 3718, 514,
+	0, 0, 0, 0, 1464, 2286, 0, 0, 4551, 0, 0, 373, 5712, 0, 0, 0,
+	0, 0, 0, 0, 0, 6742, 0, 0, 0, 0, 0, 0, 0, 0, 3206, 5541,
+	0, 0, 0, 5785, 0, 0, 0, 0, 4878, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1799, 0, 0, 2265, 0,
+	0, 0, 0, 0, 7612, 0, 0, 6605, 0, 0, 0, 831, 0, 0, 0, 0,
+	7572, 0, 7250, 886, 0, 0, 0, 0, 0, 0, 6257, 0, 0, 0, 0, 0,
+	0, 6837, 0, 0, 0, 0, 5999, 0, 0, 0, 542, 0, 1518, 0, 0, 0,
+	0, 0, 5749, 0, 0, 6547, 0, 0, 0, 0, 3201, 1283, 0, 0, 0, 0,
+	0, 8014, 0, 0, 4549, 0, 0, 0, 0, 0, 0, 4632, 0, 0, 0, 6281,
+	5783, 0, 6604, 2330, 272, 0, 0, 0, 0, 0, 6667, 745, 2815, 6347, 0, 0,
+	0, 4921, 0, 1900, 0, 0, 6950, 3405, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3368, 0, 0, 0, 0, 0, 0, 0, 6075, 0, 1361, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 6795, 0, 0, 0, 0, 7306, 0, 0,
+	5140, 0, 0, 1020, 0, 5907, 7143, 0, 0, 0, 3743, 0, 2435, 0, 0, 0,
+	0, 1932, 0, 0, 0, 4285, 0, 0, 0, 6562, 0, 0, 0, 0, 5531, 0,
+	0, 7347, 0, 0, 0, 0, 0, 5130, 6402, 4480, 0, 1541, 0, 2270, 0, 0,
+	747, 0, 2884, 0, 0, 7360, 0, 0, 0, 0, 0, 0, 0, 0, 6578, 0,
+	0, 7564, 0, 1006, 0, 2600, 6724, 0, 0, 0, 4752, 4602, 0, 0, 1328, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5675, 0, 0, 0, 712, 0,
+	0, 0, 6261, 0, 0, 0, 8305, 1408, 0, 0, 1440, 0, 5440, 5898, 0, 0,
+	0, 0, 0, 0, 0, 5411, 0, 2684, 5097, 0, 2933, 5903, 0, 1785, 0, 2906,
+	0, 0, 0, 0, 0, 0, 3659, 2382, 0, 246, 0, 0, 0, 0, 0, 0,
+	7681, 0, 0, 0, 0, 0, 140, 0, 0, 6640, 0, 5609, 0, 0, 0, 0,
+	0, 0, 0, 7931, 0, 0, 0, 0, 1046, 3175, 6618, 0, 0, 7029, 2082, 0,
+	0, 0, 0, 0, 3984, 6219, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	7954, 865, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7951, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4748, 0, 0, 0, 0, 0,
+	0, 3777, 0, 0, 3034, 0, 6937, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3522, 0, 0, 0, 0, 0, 7646, 2009, 0, 1291, 842, 0, 0, 3948, 0, 0,
+	0, 6172, 0, 2422, 0, 583, 0, 1156, 0, 0, 0, 0, 0, 0, 0, 6811,
+	0, 0, 0, 0, 0, 6416, 0, 3467, 0, 0, 0, 6580, 7890, 0, 0, 0,
+	1620, 0, 0, 2356, 1359, 0, 0, 0, 0, 0, 3026, 0, 0, 0, 0, 4283,
+	0, 0, 386, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5765, 0, 5017, 0,
+	0, 0, 5264, 40, 0, 1611, 0, 0, 0, 0, 7775, 8134, 0, 0, 0, 3827,
+	2392, 0, 0, 0, 0, 5523, 1627, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	5102, 0, 8284, 0, 0, 0, 0, 0, 8323, 0, 0, 0, 0, 0, 2649, 4308,
+	0, 2932, 2312, 117, 8203, 6630, 0, 0, 0, 450, 6413, 3139, 4957, 0, 4234, 0,
+	0, 0, 0, 0, 0, 0, 194, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 4102, 0, 0, 0, 7963, 0, 5956, 0, 0,
+	0, 0, 0, 0, 811, 0, 0, 0, 1816, 1062, 0, 0, 0, 0, 590, 0,
+	0, 0, 0, 0, 2719, 0, 0, 0, 0, 0, 0, 0, 0, 7270, 0, 0,
+	5204, 0, 22, 0, 6872, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3998, 973, 0, 6444, 0, 0, 0, 0, 0, 0, 3118,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1433, 0, 1496, 0, 6966, 0, 0,
+	6804, 2809, 3953, 3797, 0, 899, 2879, 0, 0, 7284, 0, 0, 0, 0, 0, 2618,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7526, 0, 0,
+	7158, 0, 0, 0, 0, 737, 0, 8333, 0, 1531, 0, 0, 0, 2569, 0, 0,
+	0, 7181, 0, 0, 0, 0, 0, 0, 2237, 0, 3272, 0, 0, 0, 0, 7965,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4362, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 7381, 0, 0, 0, 0, 2202, 0, 0, 2475,
+	0, 2260, 0, 0, 0, 1661, 0, 0, 0, 0, 0, 0, 0, 6296, 0, 0,
+	0, 4226, 0, 0, 0, 0, 5853, 2829, 0, 0, 951, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 367, 1442, 0, 8241, 5368, 0, 0, 0, 3411, 0,
+	0, 0, 8151, 0, 0, 5122, 0, 0, 0, 0, 0, 1080, 0, 0, 0, 2722,
+	3247, 0, 468, 6701, 0, 0, 3637, 7790, 0, 4914, 0, 0, 0, 0, 0, 0,
+	8076, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6101, 0, 7017, 0, 0, 0,
+	4045, 0, 0, 0, 0, 6644, 0, 8020, 6841, 6369, 0, 361, 0, 0, 266, 3717,
+	0, 0, 0, 6750, 5621, 0, 3814, 2911, 0, 0, 0, 3143, 3331, 0, 0, 1488,
+	7756, 0, 0, 0, 3029, 0, 0, 2706, 0, 0, 0, 0, 6156, 0, 0, 0,
+	0, 0, 1952, 0, 0, 0, 0, 5310, 3296, 0, 0, 0, 0, 0, 0, 0,
+	2953, 0, 0, 5582, 983, 0, 0, 0, 0, 0, 0, 6845, 4424, 0, 0, 0,
+	0, 0, 0, 15, 0, 0, 0, 1317, 7316, 0, 0, 7966, 0, 0, 0, 6831,
+	0, 5041, 0, 0, 5773, 0, 0, 0, 0, 0, 0, 0, 4385, 2551, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 6393, 0, 0, 3891, 0, 1609, 0, 0,
+	0, 0, 0, 6026, 5874, 1839, 5371, 0, 0, 0, 0, 0, 0, 1624, 0, 0,
+	4450, 0, 0, 0, 0, 0, 4548, 5058, 0, 0, 0, 7333, 0, 0, 0, 0,
+	0, 3204, 0, 0, 0, 0, 0, 0, 0, 5236, 0, 0, 7390, 0, 0, 0,
+	0, 0, 686, 0, 1125, 0, 0, 0, 0, 0, 0, 3996, 2638, 0, 0, 0,
+	0, 4682, 0, 0, 0, 0, 4697, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 5521, 0, 0, 0, 0, 8345, 0, 0, 0, 4564, 6951, 0,
+	0, 6905, 0, 0, 4110, 1457, 0, 0, 6461, 0, 0, 0, 0, 0, 0, 2578,
+	5172, 0, 735, 0, 0, 5057, 2259, 0, 3480, 748, 2945, 0, 0, 0, 0, 0,
+	8235, 0, 3564, 0, 0, 601, 0, 0, 0, 0, 1275, 0, 0, 0, 0, 0,
+	0, 0, 4039, 0, 5252, 0, 0, 3071, 7666, 1106, 4375, 0, 3217, 0, 0, 0,
+	80, 0, 0, 0, 0, 6267, 0, 0, 0, 5200, 0, 4419, 0, 4142, 0, 0,
+	0, 0, 0, 4767, 3173, 0, 2798, 0, 0, 0, 0, 982, 0, 5186, 0, 1789,
+	0, 0, 4183, 0, 0, 3183, 0, 0, 2295, 0, 0, 3823, 2892, 1798, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 8158, 0, 0, 8171, 0, 0, 0, 693, 0,
+	0, 0, 4378, 0, 0, 0, 0, 0, 0, 969, 0, 0, 0, 0, 0, 5972,
+	0, 564, 0, 0, 1267, 7053, 6911, 0, 2323, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2160, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 7065, 0, 2592, 2938, 0, 0, 0, 0, 106, 1964, 0, 0, 0,
+	4529, 6869, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6391, 0, 6152, 0, 7382,
+	0, 0, 0, 0, 2195, 0, 0, 0, 0, 3555, 1492, 0, 0, 0, 163, 1761,
+	0, 0, 3363, 0, 0, 7920, 0, 4601, 7128, 0, 0, 0, 0, 2206, 0, 0,
+	0, 0, 0, 0, 0, 4622, 0, 0, 1018, 0, 0, 0, 0, 4055, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 57, 0, 6564, 0, 0,
+	0, 6249, 0, 0, 0, 0, 0, 0, 0, 0, 8096, 0, 0, 0, 0, 0,
+	0, 0, 0, 3934, 1437, 1500, 3384, 0, 0, 0, 0, 0, 0, 0, 7981, 7460,
+	0, 0, 3431, 0, 0, 0, 0, 3742, 0, 1547, 6752, 0, 0, 0, 0, 0,
+	0, 0, 4135, 0, 0, 0, 0, 2463, 0, 0, 0, 6021, 0, 0, 0, 4979,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8265, 0, 0,
+	688, 0, 3507, 0, 0, 5243, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2348,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 2653, 2941, 0, 0, 0, 3390, 0, 0, 6692, 374, 0, 0, 0, 0,
+	0, 1882, 0, 0, 0, 7349, 0, 0, 0, 0, 6258, 1998, 0, 0, 0, 984,
+	7219, 5855, 6695, 0, 1755, 3672, 308, 0, 0, 0, 0, 4459, 0, 0, 0, 5989,
+	0, 2037, 0, 0, 6656, 0, 0, 0, 0, 0, 0, 7988, 0, 0, 2547, 0,
+	0, 0, 0, 3207, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 6065, 0, 0, 0, 0, 0, 0, 0, 2440, 6749, 0, 0,
+	0, 0, 16, 0, 4411, 0, 0, 4248, 2585, 0, 1679, 0, 0, 0, 6340, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 415, 64, 0, 0, 0,
+	3365, 0, 8081, 48, 0, 5010, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4145, 2110, 0, 0, 0, 0, 0, 3961, 0, 0, 0, 0, 0, 0, 0, 836,
+	6240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4185, 0, 3966, 0, 0,
+	0, 0, 0, 0, 0, 0, 1647, 0, 0, 0, 6810, 0, 7862, 4896, 0, 0,
+	0, 789, 0, 3302, 0, 4515, 0, 0, 4774, 0, 0, 0, 6392, 2929, 0, 0,
+	0, 0, 2264, 0, 7478, 3144, 0, 0, 4704, 0, 0, 2857, 682, 0, 0, 0,
+	0, 0, 0, 0, 0, 1629, 0, 0, 7417, 0, 0, 0, 0, 0, 0, 0,
+	7474, 0, 0, 0, 0, 0, 0, 1479, 0, 0, 3381, 0, 0, 0, 0, 3398,
+	7831, 0, 0, 0, 1692, 3438, 7243, 0, 0, 0, 3925, 4293, 0, 0, 0, 0,
+	0, 3497, 6639, 5587, 0, 0, 3196, 0, 0, 0, 804, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 2521, 4502, 1371, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3458, 0, 0, 0, 5574, 2824, 622, 0, 0, 0, 0, 0,
+	0, 5063, 8144, 0, 0, 0, 0, 0, 0, 249, 0, 1662, 0, 610, 0, 0,
+	6140, 3291, 5888, 0, 0, 3248, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 1872, 3288, 0, 3573, 0, 0, 2648, 0, 0, 1535, 0, 975, 0,
+	0, 672, 0, 8149, 0, 0, 0, 0, 0, 0, 0, 0, 2561, 0, 0, 0,
+	3599, 0, 0, 977, 7711, 0, 5355, 2850, 0, 0, 2288, 0, 0, 0, 0, 0,
+	0, 0, 1052, 0, 0, 0, 7362, 0, 4019, 0, 0, 7822, 0, 5696, 0, 0,
+	0, 0, 0, 7081, 0, 0, 0, 0, 0, 0, 0, 0, 3821, 0, 0, 0,
+	0, 2099, 0, 0, 0, 0, 0, 0, 2597, 0, 0, 0, 7579, 0, 0, 0,
+	4013, 3466, 0, 0, 127, 0, 4655, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3919, 0, 0, 2917, 0, 0, 0, 5653, 0, 0, 8062, 0, 4043, 7857, 0,
+	5546, 0, 0, 0, 0, 7626, 0, 0, 0, 0, 0, 7283, 5669, 4309, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 6560, 218, 0, 4203, 0, 1621, 0, 0, 0,
+	0, 0, 0, 2672, 0, 0, 0, 6263, 0, 0, 0, 0, 820, 0, 0, 8326,
+	0, 0, 0, 0, 0, 3440, 0, 0, 0, 3768, 0, 3979, 0, 340, 0, 0,
+	110, 0, 0, 0, 0, 0, 4154, 0, 0, 0, 3197, 0, 0, 0, 0, 0,
+	0, 0, 3220, 0, 1979, 0, 0, 0, 0, 0, 0, 3865, 0, 0, 0, 0,
+	0, 5153, 6359, 0, 0, 0, 1135, 416, 0, 7828, 0, 4949, 0, 0, 0, 6626,
+	6516, 0, 0, 0, 5199, 0, 0, 0, 0, 0, 425, 5573, 0, 0, 2736, 0,
+	0, 0, 6517, 0, 6614, 0, 7693, 270, 0, 0, 1266, 0, 0, 0, 0, 0,
+	0, 0, 0, 7076, 6036, 0, 0, 0, 861, 0, 7628, 3812, 0, 0, 0, 0,
+	0, 0, 0, 0, 847, 2837, 0, 0, 2818, 0, 643, 0, 4521, 0, 0, 0,
+	0, 7530, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 6602, 165, 6323, 2949, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6321, 0, 3457, 0, 2017,
+	7958, 1219, 0, 0, 2935, 0, 0, 0, 0, 0, 0, 0, 0, 1824, 0, 0,
+	0, 0, 0, 0, 0, 0, 7193, 0, 0, 0, 0, 0, 989, 0, 0, 0,
+	0, 0, 0, 0, 4791, 0, 0, 0, 0, 0, 0, 0, 0, 593, 0, 0,
+	0, 0, 0, 236, 0, 0, 0, 0, 0, 0, 0, 521, 6955, 466, 0, 6663,
+	0, 5421, 0, 0, 0, 0, 65, 0, 0, 3567, 0, 0, 0, 0, 1768, 0,
+	0, 0, 1452, 0, 0, 7179, 0, 0, 7804, 314, 5229, 0, 0, 0, 0, 0,
+	0, 0, 0, 6836, 0, 0, 2154, 0, 0, 0, 0, 3605, 0, 0, 0, 337,
+	0, 0, 0, 2434, 0, 0, 0, 0, 0, 1389, 0, 0, 1304, 5161, 6080, 2000,
+	0, 0, 0, 0, 0, 0, 3021, 0, 0, 0, 0, 0, 0, 2771, 0, 2785,
+	267, 0, 0, 3586, 0, 0, 4380, 0, 0, 0, 0, 0, 0, 0, 0, 5750,
+	0, 0, 2510, 0, 0, 0, 6126, 0, 0, 0, 0, 0, 0, 5352, 0, 0,
+	2766, 0, 0, 0, 0, 2572, 0, 0, 0, 1348, 6785, 0, 0, 0, 6521, 6020,
+	0, 0, 4001, 0, 0, 0, 0, 0, 0, 5399, 0, 0, 0, 0, 0, 7782,
+	5990, 0, 0, 0, 0, 0, 0, 4583, 0, 2432, 0, 0, 0, 0, 4151, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6628, 2757, 0, 0,
+	0, 3498, 0, 0, 0, 0, 2075, 0, 2451, 0, 0, 0, 0, 0, 1277, 0,
+	7824, 0, 0, 0, 0, 0, 0, 0, 2431, 0, 0, 0, 0, 764, 0, 5568,
+	2157, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2070, 4620, 0, 3957, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3442, 0, 6214, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 7855, 8311, 0, 5971, 0, 0, 0, 0, 4250, 0,
+	4634, 0, 0, 7444, 0, 0, 3233, 0, 0, 0, 1398, 0, 6025, 2036, 0, 0,
+	0, 0, 0, 2159, 0, 0, 539, 0, 0, 0, 508, 0, 0, 0, 3943, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 6363, 0, 0, 0, 0, 0, 0, 5786,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1236, 0, 0, 0, 0, 0,
+	0, 7393, 0, 0, 0, 0, 0, 0, 0, 0, 2662, 0, 1587, 0, 0, 5035,
+	0, 792, 0, 0, 0, 5101, 3780, 5633, 0, 8165, 0, 0, 0, 0, 0, 0,
+	4992, 0, 0, 0, 0, 0, 0, 0, 0, 6947, 0, 0, 7847, 0, 0, 8164,
+	0, 6030, 0, 5000, 0, 0, 0, 0, 3317, 4775, 1471, 777, 4897, 0, 4466, 0,
+	0, 2983, 7139, 0, 0, 0, 0, 0, 0, 0, 0, 2140, 0, 0, 0, 0,
+	0, 6713, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 6018, 0, 0, 0, 7878, 6213, 874, 0, 0, 0, 0, 0, 0, 0,
+	0, 2985, 0, 1738, 0, 0, 0, 0, 0, 2131, 6901, 0, 6198, 1374, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 7418, 0, 0, 0, 0, 0, 0, 0,
+	8132, 0, 0, 0, 0, 0, 0, 2956, 0, 6308, 0, 0, 105, 0, 0, 4374,
+	7755, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5886, 0, 0, 5492, 0,
+	0, 0, 0, 0, 0, 0, 0, 8201, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 1740, 0, 0, 411, 7535, 0, 0, 3463, 0, 0, 0, 0, 0,
+	512, 0, 0, 2436, 0, 0, 0, 0, 5925, 0, 4231, 0, 0, 0, 0, 991,
+	0, 852, 0, 0, 0, 4762, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3469, 0, 0, 72, 0, 0, 0, 0, 8, 7374, 2335, 0, 5935, 0, 8050, 0,
+	0, 0, 0, 8339, 0, 0, 0, 0, 0, 0, 0, 0, 5194, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 2997, 0, 0, 0, 5796, 0, 6272,
+	0, 0, 0, 2275, 0, 0, 5673, 0, 0, 0, 0, 5922, 0, 0, 7165, 7678,
+	0, 0, 0, 0, 0, 5534, 0, 0, 0, 0, 0, 3636, 0, 0, 7146, 0,
+	0, 3959, 0, 0, 0, 0, 0, 4646, 0, 0, 0, 0, 0, 5864, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 6079, 0, 0, 0, 0, 0, 0, 0, 0,
+	8147, 0, 0, 0, 1568, 5602, 0, 4895, 0, 7502, 8306, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 1202, 0, 0, 0, 6317, 0, 1602, 0, 0,
+	0, 0, 0, 0, 0, 6279, 0, 0, 0, 4846, 0, 0, 0, 0, 0, 0,
+	0, 2511, 0, 0, 2455, 0, 0, 0, 2301, 0, 0, 0, 0, 0, 4839, 3604,
+	7742, 0, 0, 0, 0, 7567, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3792,
+	7876, 0, 0, 0, 0, 0, 1228, 0, 0, 0, 0, 393, 0, 0, 1802, 0,
+	0, 0, 0, 0, 0, 2489, 0, 0, 3119, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 5627, 7982, 934, 0, 0, 2836, 0, 0, 1691, 0, 0, 0, 0, 3133,
+	0, 3944, 0, 0, 0, 0, 0, 7913, 0, 0, 8075, 0, 0, 0, 5081, 0,
+	0, 3885, 0, 6774, 0, 4111, 4918, 0, 0, 0, 0, 6874, 0, 1826, 0, 0,
+	2697, 7041, 325, 0, 6179, 0, 6184, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	6790, 0, 0, 0, 7096, 0, 3016, 0, 6646, 0, 0, 5707, 2893, 0, 0, 0,
+	0, 0, 0, 0, 0, 616, 0, 0, 0, 0, 0, 4633, 0, 0, 769, 5668,
+	3307, 0, 0, 6846, 1765, 0, 0, 0, 0, 0, 0, 7453, 0, 0, 0, 0,
+	0, 0, 0, 5625, 8347, 492, 362, 0, 0, 0, 0, 5737, 0, 0, 0, 5772,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 7516, 0, 7022, 941, 4644, 0, 1971,
+	695, 0, 6203, 0, 0, 0, 0, 620, 0, 0, 6864, 0, 0, 0, 0, 0,
+	0, 0, 0, 148, 0, 0, 0, 0, 0, 0, 1855, 5905, 0, 7271, 0, 0,
+	0, 0, 0, 0, 0, 1517, 0, 6976, 0, 0, 0, 0, 0, 3756, 5246, 0,
+	412, 5224, 0, 5438, 0, 0, 0, 0, 0, 8244, 0, 0, 3965, 6539, 0, 0,
+	879, 0, 0, 0, 0, 0, 0, 5884, 0, 0, 3904, 0, 0, 0, 2874, 0,
+	928, 3595, 111, 7659, 0, 0, 0, 3131, 0, 0, 5231, 0, 0, 8279, 0, 0,
+	5465, 0, 0, 5426, 0, 7276, 0, 0, 0, 3517, 591, 0, 0, 3423, 0, 3542,
+	0, 0, 7055, 2897, 2043, 0, 0, 489, 0, 0, 0, 0, 0, 8104, 0, 3047,
+	0, 0, 0, 0, 6204, 0, 2026, 0, 0, 0, 6049, 0, 5154, 0, 7239, 0,
+	0, 0, 6248, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 204, 6673, 0,
+	0, 0, 0, 0, 0, 157, 0, 0, 0, 0, 4311, 0, 0, 0, 3003, 0,
+	0, 0, 5477, 0, 0, 0, 0, 1598, 1873, 2352, 4821, 3591, 0, 0, 5517, 135,
+	0, 5089, 0, 179, 0, 282, 5207, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 5350, 0, 0, 5583, 0, 0, 0, 0, 1526, 0, 0,
+	0, 0, 0, 6527, 0, 2309, 0, 0, 2738, 0, 6022, 1569, 5412, 0, 0, 0,
+	0, 4062, 26, 0, 0, 0, 0, 5771, 0, 0, 4407, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 6338, 0, 5046, 0, 213, 0, 0, 5700, 0, 0, 0, 0,
+	5295, 0, 0, 0, 5014, 0, 0, 6815, 5023, 0, 5212, 0, 0, 0, 0, 0,
+	0, 5197, 0, 0, 5026, 0, 3033, 0, 0, 0, 2376, 0, 0, 0, 0, 7216,
+	0, 0, 0, 0, 0, 0, 2038, 0, 0, 0, 1318, 7993, 0, 1240, 0, 6860,
+	3995, 0, 3975, 0, 0, 3848, 0, 0, 8274, 0, 0, 5329, 7699, 0, 0, 4014,
+	2693, 0, 8160, 0, 0, 0, 0, 0, 2078, 0, 0, 0, 5479, 0, 0, 6985,
+	0, 0, 2855, 0, 0, 0, 0, 0, 6704, 0, 7050, 0, 0, 7421, 0, 0,
+	0, 0, 0, 2495, 6111, 0, 0, 703, 8246, 5826, 0, 0, 0, 0, 0, 7622,
+	2485, 0, 0, 0, 3761, 0, 0, 0, 0, 7354, 4184, 0, 0, 7313, 0, 2608,
+	0, 7842, 0, 0, 0, 0, 7304, 0, 0, 0, 0, 0, 0, 7426, 0, 0,
+	0, 1021, 357, 0, 691, 718, 0, 0, 0, 0, 4798, 5099, 0, 0, 0, 0,
+	363, 0, 0, 0, 0, 2692, 0, 0, 0, 0, 0, 4951, 6601, 0, 0, 0,
+	0, 0, 3303, 0, 0, 0, 0, 6271, 0, 0, 0, 0, 0, 0, 6876, 7008,
+	4680, 6232, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 488,
+	0, 0, 4700, 6285, 0, 0, 2171, 0, 0, 0, 7159, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 3403, 0, 0, 0, 0, 0, 4592, 0, 0, 5312,
+	0, 0, 0, 0, 3337, 0, 4172, 0, 0, 1026, 4919, 0, 0, 0, 0, 0,
+	0, 0, 6280, 7870, 8223, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2168, 0, 1618, 0, 0,
+	5758, 0, 0, 0, 0, 0, 0, 3219, 0, 0, 0, 5860, 0, 8119, 0, 0,
+	0, 0, 3647, 1217, 0, 0, 0, 0, 0, 0, 6676, 0, 0, 0, 0, 0,
+	0, 0, 5547, 0, 3349, 1392, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2245,
+	1920, 0, 1098, 0, 0, 0, 7676, 2014, 0, 0, 5538, 1293, 0, 1700, 3465, 0,
+	0, 0, 242, 1792, 0, 0, 0, 0, 0, 6689, 0, 635, 4657, 0, 0, 0,
+	0, 0, 0, 2281, 4862, 1949, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1576, 2044, 0, 6147, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5380, 0, 0, 0, 0,
+	0, 0, 6154, 0, 0, 0, 0, 0, 0, 0, 0, 1683, 3972, 0, 0, 6265,
+	0, 0, 0, 5221, 0, 0, 0, 0, 5885, 0, 0, 0, 0, 0, 4732, 2040,
+	0, 0, 0, 3162, 0, 0, 0, 0, 1864, 6284, 0, 0, 0, 0, 0, 5763,
+	5369, 0, 0, 0, 5852, 7952, 0, 6358, 0, 0, 7634, 0, 0, 4589, 4330, 0,
+	0, 915, 0, 8342, 0, 0, 0, 0, 0, 0, 0, 1879, 6383, 0, 0, 0,
+	0, 0, 0, 6459, 7833, 7288, 0, 5502, 0, 0, 5030, 0, 0, 2262, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 5594, 0, 0, 0, 3523, 0, 0, 0, 4091,
+	0, 0, 0, 8037, 0, 0, 0, 4621, 0, 0, 0, 0, 0, 0, 4106, 3701,
+	7813, 1032, 0, 3741, 0, 0, 0, 0, 7731, 0, 3674, 0, 0, 5813, 0, 0,
+	0, 0, 7552, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7664, 0, 0,
+	5342, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	6071, 4497, 0, 0, 4688, 0, 4150, 0, 0, 0, 0, 636, 0, 0, 3983, 4707,
+	0, 0, 0, 0, 0, 0, 6024, 4134, 8213, 0, 4157, 0, 0, 0, 0, 6145,
+	0, 4667, 0, 0, 5078, 0, 0, 0, 0, 6384, 2367, 0, 0, 0, 0, 0,
+	2148, 2241, 0, 2849, 0, 0, 2698, 0, 0, 7580, 0, 0, 0, 0, 8093, 0,
+	7935, 0, 0, 0, 0, 0, 8278, 0, 0, 0, 0, 0, 0, 833, 0, 0,
+	0, 449, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3989, 0, 0,
+	0, 7343, 0, 0, 0, 0, 0, 0, 0, 0, 1127, 0, 681, 0, 3580, 0,
+	0, 0, 0, 0, 5209, 0, 5335, 5736, 0, 0, 7154, 0, 7704, 0, 7297, 1543,
+	0, 0, 0, 0, 0, 0, 8026, 0, 0, 0, 665, 0, 0, 8184, 0, 0,
+	0, 0, 0, 5840, 6509, 5892, 0, 0, 0, 0, 0, 6938, 0, 0, 1331, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 3090, 5728, 0, 5984, 0, 0, 0, 0,
+	7377, 0, 5699, 0, 4315, 0, 0, 0, 0, 0, 0, 5504, 0, 0, 4810, 0,
+	0, 0, 0, 0, 0, 0, 0, 8036, 0, 0, 1253, 0, 0, 0, 0, 0,
+	0, 0, 0, 892, 2928, 4140, 0, 7637, 0, 0, 711, 0, 0, 0, 0, 8296,
+	0, 5011, 0, 0, 0, 0, 0, 0, 708, 0, 0, 0, 0, 7167, 0, 1119,
+	0, 0, 0, 6821, 7513, 0, 0, 0, 0, 3561, 0, 0, 0, 0, 0, 0,
+	5385, 0, 183, 0, 1742, 0, 0, 0, 0, 6792, 0, 0, 0, 0, 4843, 0,
+	0, 0, 0, 6708, 2445, 1447, 0, 3804, 6666, 0, 0, 1072, 0, 2224, 0, 5843,
+	5156, 0, 0, 0, 0, 0, 0, 0, 3460, 4191, 0, 0, 0, 0, 3841, 0,
+	0, 0, 0, 953, 0, 0, 0, 0, 0, 0, 6242, 0, 0, 0, 0, 0,
+	1326, 0, 0, 0, 0, 6694, 3477, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6954, 1383, 0, 6395, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3145, 0, 7477, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 5305, 0, 6683, 0, 0, 0, 0, 0,
+	0, 0, 1821, 3519, 0, 7896, 6830, 1334, 0, 0, 6134, 0, 0, 0, 0, 0,
+	7674, 6693, 0, 642, 3753, 0, 0, 0, 7863, 0, 2961, 0, 0, 3550, 0, 0,
+	0, 0, 7432, 264, 0, 0, 0, 1502, 0, 4663, 0, 0, 0, 0, 4179, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 7979, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 1537, 0, 0, 0, 7533, 651, 1898, 0, 4243,
+	6155, 0, 0, 5819, 4347, 4693, 0, 0, 0, 0, 0, 7013, 0, 8321, 0, 0,
+	0, 0, 0, 0, 0, 4025, 399, 0, 0, 2827, 0, 0, 0, 0, 2108, 3597,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3186, 6835, 0,
+	0, 0, 4685, 0, 0, 5537, 0, 414, 0, 0, 0, 5744, 8029, 3939, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 3091, 0, 0, 0, 0, 0, 0, 0,
+	3044, 0, 0, 0, 2528, 0, 5213, 3275, 7394, 0, 4483, 0, 0, 0, 7614, 0,
+	167, 0, 0, 0, 6148, 0, 0, 0, 8011, 0, 0, 0, 3427, 4720, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1732, 0, 2092, 0, 0, 7585, 0, 0,
+	0, 0, 0, 5037, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3008, 0,
+	0, 0, 4490, 0, 3203, 725, 2452, 0, 0, 300, 1034, 0, 0, 7087, 0, 0,
+	0, 0, 0, 0, 1434, 0, 0, 0, 1112, 0, 722, 0, 0, 8012, 0, 0,
+	0, 0, 0, 0, 502, 0, 0, 0, 0, 0, 0, 0, 4357, 0, 788, 0,
+	4835, 3638, 0, 0, 0, 0, 0, 0, 3688, 0, 0, 0, 7114, 7737, 859, 0,
+	0, 0, 0, 5498, 0, 7310, 3062, 1499, 1657, 5346, 0, 0, 0, 0, 1144, 0,
+	0, 6894, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3911, 0, 0, 0, 7192, 1255, 0, 0, 0, 0, 4427, 3896,
+	0, 6282, 6215, 0, 0, 2027, 0, 6508, 0, 0, 0, 942, 0, 0, 0, 0,
+	3697, 7059, 0, 0, 2517, 647, 0, 812, 0, 0, 0, 0, 7545, 0, 1404, 0,
+	8202, 0, 0, 0, 0, 4801, 0, 0, 4076, 0, 3509, 237, 0, 0, 0, 7849,
+	0, 0, 0, 0, 2856, 0, 0, 0, 0, 7045, 0, 161, 0, 0, 0, 0,
+	7553, 0, 0, 3544, 6175, 997, 0, 0, 0, 0, 652, 7539, 0, 4787, 1645, 0,
+	6217, 0, 0, 2251, 0, 0, 933, 0, 295, 0, 8059, 0, 0, 1360, 0, 2760,
+	0, 0, 0, 0, 0, 0, 0, 0, 6992, 8152, 6209, 2290, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 2833, 841, 0, 0, 4533, 3245, 1416,
+	0, 0, 0, 0, 4970, 0, 0, 0, 0, 0, 6616, 0, 8198, 0, 0, 7246,
+	0, 0, 0, 0, 1978, 4353, 0, 0, 3657, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 4255, 6671, 6158, 0, 0, 0, 104, 1726, 5239, 0, 0, 7941, 0,
+	3624, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6957, 0, 6277, 5575,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7476, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 4826, 0, 2386, 0, 2187, 0, 0, 594, 0, 759, 8298, 0, 0, 0, 7615,
+	0, 0, 0, 0, 1200, 0, 0, 0, 0, 0, 0, 5009, 0, 0, 0, 7631,
+	0, 0, 4624, 0, 0, 0, 0, 0, 5815, 3120, 6387, 0, 0, 0, 0, 0,
+	0, 0, 7405, 0, 0, 0, 7074, 0, 7677, 0, 0, 0, 0, 0, 0, 0,
+	0, 4927, 0, 0, 0, 0, 0, 5592, 0, 0, 4446, 2623, 0, 0, 0, 0,
+	3696, 5726, 3306, 4449, 0, 0, 0, 4356, 0, 0, 0, 0, 0, 1530, 0, 0,
+	0, 0, 0, 0, 0, 0, 3267, 4943, 0, 4112, 0, 0, 0, 0, 6703, 0,
+	0, 0, 3825, 1355, 0, 7647, 2276, 0, 1064, 0, 0, 0, 0, 78, 0, 0,
+	0, 0, 332, 0, 1128, 3049, 7942, 1770, 0, 0, 5079, 0, 0, 0, 0, 7296,
+	0, 0, 0, 0, 0, 0, 0, 0, 1005, 7795, 0, 0, 0, 0, 5103, 0,
+	8181, 0, 0, 0, 7542, 0, 0, 0, 0, 0, 0, 0, 2249, 0, 0, 4141,
+	0, 0, 0, 1337, 0, 0, 0, 0, 0, 4163, 0, 0, 8341, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 7204, 306, 0, 303, 0, 0, 0, 0, 0,
+	0, 0, 0, 7430, 0, 0, 0, 0, 0, 0, 0, 6450, 0, 0, 0, 0,
+	0, 3107, 0, 0, 0, 0, 3424, 0, 0, 2167, 0, 0, 5940, 0, 3374, 0,
+	0, 6823, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 7914, 0, 0, 0, 0, 0, 0, 2612, 0, 0, 0, 0, 0, 0, 0,
+	0, 8216, 0, 0, 0, 2539, 0, 2720, 0, 5456, 0, 8189, 0, 0, 0, 0,
+	0, 2446, 0, 0, 8315, 0, 0, 0, 1040, 0, 0, 0, 0, 0, 0, 0,
+	0, 5926, 0, 0, 0, 0, 0, 6231, 0, 0, 1489, 0, 0, 4995, 2601, 5469,
+	0, 0, 7203, 0, 0, 0, 855, 2353, 2987, 0, 0, 0, 0, 2826, 0, 6088,
+	6934, 0, 0, 0, 7052, 0, 0, 0, 0, 0, 7814, 0, 0, 0, 0, 0,
+	0, 0, 0, 7009, 1124, 0, 0, 0, 0, 0, 2780, 3400, 0, 7131, 0, 4160,
+	0, 0, 0, 0, 0, 7118, 0, 0, 2213, 0, 0, 0, 0, 0, 0, 0,
+	5234, 0, 0, 0, 5731, 6890, 0, 0, 0, 1933, 0, 0, 0, 5031, 1640, 8139,
+	2519, 0, 0, 0, 0, 4201, 0, 0, 6743, 3649, 4127, 0, 6861, 0, 0, 6117,
+	0, 0, 0, 0, 0, 0, 5220, 0, 0, 2566, 0, 0, 0, 0, 0, 4880,
+	0, 0, 0, 0, 0, 0, 8127, 0, 0, 3598, 799, 0, 8046, 0, 0, 0,
+	0, 597, 5789, 0, 0, 0, 7838, 6168, 0, 0, 0, 2491, 1147, 0, 2380, 0,
+	0, 0, 0, 5549, 0, 0, 0, 0, 0, 6771, 0, 8350, 0, 4574, 0, 768,
+	6301, 0, 0, 0, 0, 5039, 0, 0, 6183, 6218, 0, 0, 3606, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 7014, 0, 0, 0, 6926, 0, 5054, 0,
+	0, 0, 624, 0, 7493, 2465, 0, 0, 0, 0, 0, 0, 0, 0, 5604, 838,
+	0, 0, 0, 0, 0, 0, 0, 0, 4368, 0, 0, 0, 5174, 0, 2708, 3807,
+	0, 7225, 3546, 0, 0, 0, 0, 0, 0, 6800, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2240, 0, 2200, 0, 0, 7893, 0, 0, 0, 0, 0, 0,
+	0, 0, 5611, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5245, 0, 0, 0,
+	1224, 0, 0, 0, 0, 1384, 1811, 0, 0, 0, 0, 0, 0, 2694, 0, 0,
+	0, 3153, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1625, 3713,
+	0, 0, 0, 0, 0, 2828, 6121, 2993, 7268, 0, 0, 0, 0, 0, 2342, 0,
+	0, 3213, 0, 0, 0, 5979, 0, 0, 0, 0, 895, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 5842, 0, 0, 0, 0, 0, 240, 0, 0, 0,
+	0, 0, 0, 560, 0, 0, 7853, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 2126, 0, 0, 0, 0, 0, 0, 0, 3030,
+	0, 0, 0, 0, 968, 5924, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 3890, 0, 0, 0, 0, 6824, 0, 0,
+	0, 0, 0, 0, 0, 5266, 527, 6438, 0, 0, 0, 0, 0, 478, 0, 0,
+	0, 0, 8010, 0, 5227, 0, 0, 6848, 0, 0, 0, 0, 3958, 0, 1170, 0,
+	0, 0, 0, 364, 5703, 0, 0, 0, 0, 0, 0, 0, 0, 6654, 0, 0,
+	0, 6442, 0, 0, 6492, 0, 0, 0, 3940, 0, 0, 0, 7602, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2926, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 82, 0, 7850, 0, 0, 0, 0, 354, 6624, 2349,
+	5308, 0, 0, 0, 0, 441, 0, 0, 0, 0, 0, 0, 8261, 3392, 0, 8162,
+	0, 2402, 1373, 0, 0, 0, 0, 0, 8318, 1829, 142, 0, 3435, 0, 5002, 0,
+	0, 0, 0, 8143, 0, 0, 7321, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	797, 0, 0, 5168, 5045, 0, 5876, 0, 0, 0, 0, 0, 0, 0, 0, 2433,
+	0, 0, 0, 0, 0, 1212, 0, 0, 0, 8183, 0, 0, 1585, 0, 0, 1650,
+	645, 0, 0, 3872, 0, 0, 7002, 4109, 0, 3419, 0, 0, 0, 5738, 0, 3897,
+	0, 4009, 0, 0, 0, 2244, 0, 0, 0, 6401, 0, 0, 0, 0, 1817, 0,
+	0, 0, 0, 0, 0, 1091, 0, 0, 1649, 0, 0, 0, 7948, 0, 0, 0,
+	7738, 4363, 5390, 0, 0, 0, 7900, 0, 0, 7901, 0, 2469, 0, 0, 336, 0,
+	0, 0, 0, 0, 0, 3227, 0, 0, 0, 0, 0, 0, 0, 4673, 0, 0,
+	0, 0, 5473, 0, 0, 0, 0, 0, 2565, 0, 0, 0, 0, 562, 4556, 467,
+	2527, 0, 0, 0, 0, 0, 2589, 0, 0, 0, 7720, 0, 0, 935, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 6814, 0, 0, 5567, 0, 0, 0, 0, 6499,
+	0, 0, 0, 0, 4337, 7305, 0, 0, 0, 706, 0, 0, 0, 0, 3094, 0,
+	0, 4608, 6827, 0, 0, 0, 6944, 0, 0, 3593, 0, 0, 0, 6664, 4292, 0,
+	1421, 0, 0, 7099, 4598, 0, 0, 3695, 0, 0, 0, 5580, 3769, 0, 0, 3420,
+	0, 0, 0, 1043, 0, 0, 1548, 0, 0, 5698, 0, 0, 0, 0, 6163, 0,
+	0, 0, 0, 7710, 0, 3452, 6481, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1415, 0, 0, 0, 0, 0, 0, 0, 0, 3340, 0, 7754,
+	0, 0, 0, 0, 0, 0, 0, 7655, 0, 0, 0, 0, 6778, 1607, 0, 0,
+	43, 0, 0, 0, 0, 0, 0, 0, 6675, 0, 0, 0, 0, 8161, 0, 6763,
+	0, 0, 0, 0, 0, 0, 6946, 0, 2191, 919, 0, 0, 0, 1822, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 6045, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1051, 0, 0, 6653, 5678, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 7834, 0, 0, 4400, 0, 0, 0, 7254, 2717,
+	4143, 6549, 7999, 0, 0, 0, 2577, 0, 0, 1105, 0, 5607, 0, 0, 5192, 0,
+	2942, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7662, 0, 0, 4295, 0, 0,
+	7462, 5496, 0, 0, 0, 772, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7043,
+	0, 2725, 0, 2311, 0, 0, 0, 7927, 0, 0, 3297, 0, 5835, 4526, 0, 0,
+	0, 7091, 2228, 6054, 0, 0, 0, 0, 8110, 5409, 5793, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1544, 3017, 0, 0, 0, 0, 0, 0, 0, 0,
+	7438, 0, 0, 0, 0, 0, 0, 1718, 0, 7189, 0, 0, 0, 0, 0, 0,
+	0, 7205, 0, 5530, 1592, 1085, 0, 0, 0, 0, 2925, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 7845, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 6434, 0, 0, 0, 0, 0, 0, 0, 371, 0, 5943, 6496,
+	0, 7500, 427, 0, 0, 0, 0, 0, 0, 0, 5462, 2691, 0, 5052, 0, 5525,
+	0, 0, 0, 0, 1427, 0, 4193, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 6364, 0, 6346, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1716, 0,
+	3050, 0, 0, 2151, 0, 0, 0, 660, 1164, 0, 2808, 0, 0, 0, 0, 3554,
+	0, 0, 0, 0, 6408, 0, 0, 4324, 6636, 1999, 1431, 0, 1877, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 5526, 5718, 0, 0, 0, 2332, 0, 0, 0,
+	0, 3525, 0, 0, 1443, 0, 0, 4288, 0, 3113, 0, 0, 0, 0, 6366, 0,
+	2274, 0, 0, 0, 0, 0, 1010, 0, 5406, 6480, 0, 0, 8095, 0, 0, 7389,
+	0, 0, 4066, 4121, 7955, 0, 0, 0, 7922, 0, 0, 0, 0, 2952, 2163, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7660, 0, 0, 2831, 0, 0,
+	0, 7763, 0, 0, 6924, 4956, 0, 5722, 0, 0, 2851, 0, 0, 0, 0, 2088,
+	0, 0, 0, 0, 0, 3060, 0, 0, 0, 0, 3449, 0, 0, 0, 0, 0,
+	8280, 8188, 0, 0, 0, 0, 0, 0, 8140, 0, 0, 0, 0, 0, 0, 5880,
+	347, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1459, 0, 0,
+	2258, 0, 0, 0, 0, 1189, 0, 8225, 0, 0, 4433, 0, 0, 7910, 3456, 0,
+	3978, 7544, 0, 0, 0, 0, 0, 0, 0, 4973, 0, 0, 0, 0, 0, 0,
+	1133, 0, 1554, 0, 0, 0, 0, 0, 0, 0, 1513, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1675, 0, 0, 0, 0,
+	6665, 0, 6043, 338, 0, 0, 2980, 0, 0, 0, 0, 0, 0, 0, 0, 6501,
+	0, 0, 0, 6546, 0, 0, 0, 1149, 3882, 0, 2637, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 2972, 3383, 0, 0, 7279, 2564, 0, 0,
+	0, 6166, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1207, 0,
+	0, 0, 0, 6, 0, 0, 0, 0, 7926, 0, 0, 0, 0, 7142, 0, 0,
+	0, 0, 0, 5233, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	6543, 0, 0, 0, 0, 0, 0, 0, 0, 4317, 0, 0, 0, 0, 0, 3540,
+	0, 0, 5281, 0, 0, 4434, 0, 0, 0, 0, 0, 0, 1353, 0, 0, 0,
+	0, 0, 1743, 0, 0, 0, 8176, 3834, 0, 2400, 4381, 0, 0, 0, 4216, 0,
+	0, 0, 5996, 0, 0, 0, 0, 0, 0, 5632, 0, 0, 0, 0, 6083, 0,
+	0, 1556, 0, 0, 4061, 1094, 0, 3057, 0, 0, 5896, 0, 3085, 0, 0, 4010,
+	4314, 0, 0, 0, 0, 0, 8233, 0, 0, 0, 0, 1633, 6833, 0, 0, 0,
+	8049, 0, 0, 0, 0, 0, 0, 7758, 0, 0, 0, 7269, 0, 0, 0, 0,
+	0, 2923, 0, 0, 0, 3830, 0, 0, 0, 0, 0, 61, 0, 0, 0, 0,
+	0, 6297, 0, 7030, 6710, 6478, 0, 0, 0, 0, 0, 8128, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 2048, 2882, 0, 0, 0, 0, 4393, 0, 1047, 0, 0,
+	0, 0, 0, 5051, 1454, 0, 0, 0, 3818, 0, 0, 0, 0, 8145, 0, 0,
+	0, 0, 3926, 3347, 0, 0, 0, 0, 0, 0, 2341, 0, 0, 0, 2218, 7218,
+	7456, 0, 0, 0, 0, 0, 0, 2498, 4874, 0, 0, 0, 0, 3508, 0, 0,
+	0, 520, 0, 0, 0, 0, 0, 0, 4903, 0, 0, 4916, 0, 0, 8074, 0,
+	0, 8304, 1477, 0, 0, 0, 0, 6633, 3570, 0, 0, 0, 0, 0, 6581, 0,
+	0, 0, 0, 7088, 7151, 0, 6943, 0, 0, 2620, 0, 0, 0, 0, 2233, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7465, 0, 0, 7746,
+	0, 6485, 0, 0, 3664, 7573, 0, 0, 0, 6463, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 6014, 0, 0, 731, 5584, 0, 0, 0, 0, 9, 0, 0, 0, 1297,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 1218, 5558, 0, 3927, 0, 6720, 5120, 1918, 7846,
+	0, 7376, 0, 0, 0, 6534, 3722, 0, 0, 5588, 6451, 0, 0, 0, 6225, 0,
+	0, 6120, 0, 0, 0, 4394, 5719, 4876, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 5326, 0, 0, 5520, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 2500, 4435, 0, 2873, 0, 0, 6758, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1169, 0, 0, 3687, 0, 0, 0,
+	1538, 7226, 0, 0, 0, 0, 0, 946, 0, 3356, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 1578, 4816, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1908, 0,
+	0, 0, 0, 5958, 0, 0, 0, 461, 0, 3097, 0, 0, 0, 4690, 6621, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 2962, 0, 0, 2119, 0, 0, 0, 1942, 3319, 0,
+	0, 0, 0, 0, 0, 0, 0, 7387, 6300, 6128, 1145, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 3433, 0, 0, 0, 0, 0, 4338, 7359, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1663, 0, 0, 0, 0, 0, 0,
+	1116, 0, 0, 5841, 0, 0, 0, 1350, 0, 0, 0, 0, 0, 0, 0, 3067,
+	0, 0, 6734, 0, 0, 3061, 0, 6380, 0, 0, 8109, 0, 319, 0, 6125, 0,
+	0, 0, 0, 0, 6375, 2921, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8303,
+	0, 960, 0, 3125, 0, 4575, 7409, 0, 0, 0, 0, 0, 6016, 0, 0, 0,
+	0, 1769, 0, 6652, 0, 0, 0, 4008, 5167, 0, 0, 0, 0, 0, 0, 0,
+	391, 0, 0, 3977, 0, 7066, 239, 1651, 0, 0, 0, 0, 0, 0, 7961, 0,
+	0, 0, 0, 7700, 4987, 7875, 4554, 1623, 3549, 0, 0, 0, 0, 2483, 0, 0,
+	0, 0, 0, 0, 0, 0, 850, 0, 6122, 0, 0, 7556, 0, 0, 0, 0,
+	0, 6165, 5396, 0, 462, 0, 0, 0, 0, 0, 0, 7591, 0, 0, 0, 0,
+	8153, 0, 0, 0, 7320, 0, 0, 0, 5688, 0, 0, 0, 0, 3410, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 3352, 1686, 0, 0, 0, 0, 4341, 0, 0,
+	6802, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7262,
+	0, 4392, 0, 0, 0, 0, 0, 7873, 0, 3895, 0, 0, 0, 0, 0, 0,
+	0, 4945, 0, 0, 0, 0, 5762, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 758, 0, 0, 0, 0, 0, 5420, 0, 0, 0, 6127, 8103,
+	0, 493, 1175, 0, 0, 0, 0, 0, 454, 2064, 0, 5286, 0, 5042, 0, 0,
+	0, 0, 923, 0, 1988, 0, 0, 4413, 0, 7372, 0, 0, 2232, 0, 0, 0,
+	0, 5883, 5004, 0, 0, 0, 3905, 0, 0, 0, 1869, 0, 0, 0, 1505, 2405,
+	7864, 0, 0, 0, 0, 0, 0, 0, 0, 5495, 1109, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6361, 3379, 0,
+	0, 2950, 0, 5338, 0, 0, 0, 4139, 0, 0, 0, 3690, 0, 0, 0, 0,
+	0, 0, 482, 5218, 7036, 6495, 0, 5486, 0, 0, 0, 0, 0, 4616, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 653, 0,
+	1601, 0, 0, 0, 0, 3543, 0, 3755, 8177, 0, 0, 0, 0, 0, 0, 0,
+	0, 2503, 0, 0, 0, 0, 0, 6476, 0, 6370, 2690, 0, 6331, 0, 0, 0,
+	7936, 3189, 0, 126, 0, 0, 0, 0, 0, 6597, 0, 0, 0, 0, 7336, 0,
+	0, 0, 258, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 7687, 0, 0, 0, 5263, 0, 4619, 0, 0, 0, 2153, 0,
+	0, 0, 0, 0, 0, 5155, 2219, 0, 0, 3165, 0, 0, 7985, 0, 1307, 0,
+	4850, 0, 0, 0, 0, 0, 0, 2969, 0, 0, 0, 0, 0, 7511, 0, 0,
+	6278, 5821, 0, 7946, 0, 2448, 0, 0, 2242, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3005, 0, 0, 3009, 0, 6532, 0, 0, 0, 4050, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5529, 0, 0, 0,
+	0, 5104, 0, 0, 0, 0, 3451, 0, 819, 0, 7407, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 8051, 1893, 0, 0, 6270, 0, 0, 0, 0, 0, 0, 0,
+	7658, 0, 0, 0, 0, 910, 129, 7665, 0, 0, 0, 7191, 5729, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 7437, 3665, 0, 0, 0, 0, 0, 7947,
+	0, 6507, 1045, 0, 0, 0, 0, 178, 7112, 0, 0, 0, 0, 0, 3700, 0,
+	0, 5739, 0, 0, 2532, 0, 0, 0, 0, 69, 6953, 0, 0, 0, 0, 5034,
+	0, 3913, 0, 3576, 0, 0, 0, 1146, 0, 7475, 0, 0, 0, 3920, 0, 0,
+	6617, 8032, 0, 0, 0, 4631, 0, 0, 0, 0, 3968, 0, 0, 0, 0, 0,
+	0, 0, 0, 6287, 0, 0, 6038, 0, 0, 0, 0, 1715, 0, 4520, 0, 0,
+	0, 4371, 0, 0, 0, 3239, 3645, 0, 0, 0, 0, 0, 5082, 0, 0, 6686,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4171, 0, 0, 0, 7621, 0,
+	0, 0, 0, 1201, 0, 0, 5485, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 5982, 0, 0, 0, 821, 0, 0, 0, 0, 6411, 0,
+	0, 0, 8245, 5064, 0, 0, 0, 5799, 0, 0, 0, 0, 0, 0, 5182, 0,
+	0, 0, 0, 0, 6238, 0, 0, 0, 0, 0, 7397, 0, 0, 6705, 0, 0,
+	0, 0, 0, 4605, 0, 0, 0, 5589, 5179, 6826, 0, 0, 0, 6044, 0, 0,
+	0, 0, 0, 7701, 0, 0, 0, 0, 0, 0, 7791, 1342, 0, 0, 0, 0,
+	0, 0, 7547, 6085, 4027, 0, 0, 5511, 0, 0, 0, 0, 0, 0, 0, 0,
+	5830, 0, 0, 0, 0, 5142, 0, 0, 0, 0, 0, 0, 1788, 1375, 4186, 0,
+	0, 8125, 0, 0, 0, 0, 0, 1910, 749, 2554, 1093, 0, 0, 0, 0, 8157,
+	2399, 0, 1470, 0, 6541, 0, 4743, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 5869, 3022, 0, 0, 0, 0, 0, 0, 0, 5383, 0, 5133, 5317, 0, 0,
+	0, 0, 0, 0, 2351, 0, 0, 0, 1491, 0, 0, 0, 0, 0, 7067, 0,
+	0, 0, 7275, 0, 0, 0, 0, 0, 0, 0, 0, 3698, 0, 463, 1758, 0,
+	0, 0, 0, 0, 0, 0, 0, 1070, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 6907, 0, 0, 0, 0, 4546, 3709, 0, 0, 3902, 2559, 0,
+	3491, 2762, 0, 0, 0, 0, 0, 0, 0, 2627, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 978, 0, 0, 0, 0, 7663, 0, 0, 0, 4059, 2508, 6090, 0,
+	0, 1557, 0, 0, 8322, 0, 0, 0, 0, 0, 566, 0, 0, 0, 0, 0,
+	0, 0, 4398, 1078, 0, 0, 7332, 0, 0, 0, 0, 0, 0, 1473, 0, 0,
+	0, 6477, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 856, 0, 2085, 1958,
+	0, 0, 0, 1161, 0, 0, 0, 0, 0, 3399, 0, 0, 0, 0, 2252, 0,
+	0, 0, 6182, 0, 0, 0, 0, 0, 0, 2346, 0, 0, 0, 0, 0, 0,
+	0, 1680, 6237, 0, 0, 0, 5484, 0, 7840, 0, 0, 4541, 618, 0, 4848, 6600,
+	0, 3628, 0, 0, 0, 0, 0, 0, 0, 0, 1107, 0, 0, 3949, 0, 6915,
+	1706, 0, 0, 0, 0, 570, 0, 0, 7031, 0, 0, 0, 0, 0, 2599, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 579, 0, 4701,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8039, 8041, 2118, 0, 0, 0,
+	7233, 2404, 0, 0, 0, 0, 763, 0, 0, 0, 0, 0, 0, 0, 7623, 0,
+	0, 0, 0, 0, 3569, 6595, 0, 0, 0, 0, 0, 0, 7302, 0, 0, 0,
+	6998, 0, 0, 0, 0, 0, 0, 0, 0, 738, 1083, 0, 4386, 2576, 0, 0,
+	4640, 0, 2529, 0, 0, 0, 0, 0, 7373, 1628, 0, 0, 4423, 5614, 0, 4684,
+	7315, 0, 0, 0, 5267, 0, 0, 0, 0, 0, 0, 0, 6484, 3771, 451, 0,
+	0, 5598, 0, 0, 0, 4131, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 1780, 217, 0, 0, 0, 0, 0, 0, 0, 0, 7264, 0, 0, 2412,
+	0, 0, 631, 0, 732, 0, 0, 0, 0, 920, 0, 0, 1172, 0, 0, 1867,
+	4703, 0, 0, 0, 0, 0, 0, 0, 0, 389, 0, 0, 0, 0, 1233, 0,
+	0, 7492, 0, 0, 0, 0, 0, 0, 0, 0, 8100, 0, 8002, 0, 0, 0,
+	0, 0, 0, 0, 457, 0, 0, 0, 0, 0, 0, 0, 0, 7684, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 108, 0, 0, 0, 0, 0,
+	0, 7558, 0, 4496, 2685, 0, 1672, 4448, 774, 3901, 0, 0, 0, 0, 0, 0,
+	2970, 0, 0, 967, 0, 0, 0, 0, 6452, 0, 0, 8334, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 2875, 0, 2424, 0, 0, 1209, 0,
+	0, 0, 0, 0, 0, 0, 7371, 0, 0, 7078, 0, 0, 0, 0, 0, 8117,
+	0, 3471, 0, 5992, 0, 0, 0, 0, 5468, 0, 0, 8200, 0, 0, 0, 0,
+	0, 4887, 5333, 4006, 0, 0, 0, 0, 0, 0, 0, 0, 7461, 4542, 7176, 0,
+	0, 3372, 6056, 0, 0, 0, 0, 0, 0, 0, 3757, 0, 1246, 3651, 5135, 1176,
+	0, 0, 0, 4383, 0, 0, 0, 0, 0, 0, 0, 5651, 0, 7229, 0, 0,
+	0, 6428, 0, 0, 6160, 6324, 0, 0, 0, 0, 0, 0, 0, 1364, 0, 0,
+	7943, 5788, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6787, 2109, 0, 7811,
+	0, 2073, 0, 6537, 0, 0, 5343, 0, 0, 0, 6058, 0, 0, 629, 5108, 0,
+	0, 0, 0, 0, 571, 4195, 1524, 171, 0, 0, 0, 0, 0, 0, 0, 0,
+	2562, 0, 0, 0, 767, 549, 0, 2607, 0, 0, 0, 0, 0, 5117, 2061, 0,
+	0, 7757, 0, 0, 6224, 0, 0, 0, 1497, 0, 2326, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 7865, 5623, 0, 0, 0, 0, 174, 0, 0, 484, 4208, 3802,
+	7054, 4623, 6852, 5709, 0, 0, 0, 0, 4333, 0, 5195, 0, 6631, 6960, 0, 5836,
+	4222, 0, 0, 0, 0, 0, 0, 0, 0, 7978, 0, 6302, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 75, 0, 0, 0, 0, 0, 5395, 0, 5665, 0,
+	0, 0, 0, 0, 6341, 1243, 0, 0, 0, 1648, 0, 0, 0, 2125, 0, 0,
+	147, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 634, 0, 0, 0,
+	0, 0, 0, 5356, 0, 0, 0, 0, 1016, 0, 0, 0, 6005, 0, 0, 0,
+	0, 0, 0, 7090, 0, 0, 0, 0, 0, 0, 2113, 0, 843, 0, 0, 5107,
+	0, 0, 1682, 0, 0, 0, 5519, 0, 0, 0, 7973, 0, 0, 0, 0, 4863,
+	0, 0, 4738, 5882, 0, 0, 0, 0, 0, 0, 0, 0, 1977, 0, 0, 0,
+	1608, 3287, 0, 0, 0, 0, 0, 7769, 0, 0, 3070, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 2595, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 2965, 0, 8108, 0, 0, 0, 0, 0, 4318,
+	0, 0, 1344, 0, 609, 0, 0, 800, 0, 0, 0, 0, 0, 0, 0, 0,
+	6196, 0, 0, 4482, 8301, 0, 0, 1539, 0, 0, 0, 0, 0, 0, 0, 8083,
+	0, 0, 4474, 6345, 0, 0, 3179, 0, 6262, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 1031, 0, 0, 0, 6885, 0, 0, 0, 0, 4566, 0, 1403, 6973, 2705,
+	7073, 0, 0, 0, 1453, 0, 0, 0, 7835, 0, 0, 0, 8159, 4625, 0, 6910,
+	0, 1582, 1171, 0, 0, 0, 0, 7785, 0, 0, 1521, 0, 0, 0, 0, 0,
+	4242, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2034, 5811, 0, 0, 0,
+	490, 0, 0, 0, 7357, 0, 0, 0, 2552, 6274, 0, 0, 0, 2115, 0, 0,
+	2513, 0, 0, 0, 0, 0, 2067, 0, 0, 0, 2334, 7339, 0, 5684, 0, 0,
+	0, 3087, 607, 0, 2955, 0, 3970, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 5865, 0, 0, 0, 0, 0, 617, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 6579, 8054, 3805, 0, 0, 0, 0, 0, 0, 0, 3735,
+	0, 0, 0, 0, 0, 3251, 6871, 0, 0, 2886, 8072, 2426, 6423, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1203, 3579, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 6412, 0, 0, 1388, 0, 0, 0, 6881, 0, 1921, 4894, 1560, 5285, 0,
+	4057, 0, 0, 0, 0, 0, 0, 0, 0, 6063, 0, 6115, 0, 4415, 0, 235,
+	5671, 0, 0, 7267, 0, 0, 5208, 0, 1402, 0, 0, 149, 6473, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 4051, 6576, 8101, 0, 576, 0, 0,
+	0, 0, 0, 8349, 0, 0, 0, 0, 0, 0, 7975, 19, 0, 0, 0, 0,
+	0, 6489, 0, 0, 0, 0, 0, 0, 2535, 0, 0, 0, 7521, 3371, 5948, 0,
+	0, 0, 0, 0, 0, 6522, 2624, 0, 2304, 0, 0, 0, 0, 0, 2080, 0,
+	6858, 0, 4908, 0, 0, 0, 5190, 0, 0, 0, 0, 0, 0, 243, 0, 0,
+	0, 0, 0, 0, 4397, 0, 903, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3631, 0, 0, 0, 0, 0, 0, 0, 293, 0, 0, 7459, 8178, 0, 0, 0,
+	0, 8146, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2878, 0, 0, 598, 8113,
+	0, 6339, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2329, 0, 7654,
+	0, 0, 0, 5934, 0, 6409, 0, 0, 4986, 0, 0, 7173, 0, 0, 0, 0,
+	0, 5921, 0, 2995, 0, 0, 0, 0, 3723, 0, 0, 0, 8206, 0, 3731, 1809,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5005, 0, 0, 0,
+	2300, 0, 948, 0, 0, 3869, 0, 3202, 0, 0, 952, 0, 0, 0, 0, 0,
+	0, 715, 0, 0, 0, 0, 8124, 483, 0, 3879, 343, 0, 670, 705, 0, 0,
+	0, 0, 0, 1466, 0, 0, 0, 52, 0, 0, 8141, 4716, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 5524, 0, 7717, 1814, 0, 0, 0, 0,
+	0, 0, 4212, 0, 0, 0, 0, 7771, 6252, 0, 0, 2989, 3484, 0, 0, 0,
+	0, 0, 0, 5987, 0, 0, 0, 0, 574, 0, 0, 0, 0, 2834, 0, 0,
+	6747, 6312, 0, 0, 3032, 0, 0, 7512, 0, 3986, 0, 0, 0, 0, 0, 96,
+	0, 5963, 8018, 0, 0, 3035, 0, 0, 0, 0, 0, 0, 3963, 0, 0, 0,
+	6887, 0, 0, 0, 0, 0, 0, 403, 0, 3279, 7726, 3938, 0, 0, 0, 0,
+	0, 0, 0, 3817, 0, 0, 0, 0, 0, 0, 523, 4146, 557, 4573, 0, 0,
+	1054, 0, 0, 0, 0, 0, 0, 0, 1343, 0, 1180, 0, 0, 0, 0, 0,
+	0, 7577, 4063, 0, 0, 0, 0, 0, 0, 0, 0, 4436, 5822, 2682, 0, 0,
+	0, 8034, 0, 0, 0, 0, 5139, 0, 0, 4074, 0, 0, 6446, 0, 0, 0,
+	0, 0, 0, 0, 0, 4614, 0, 0, 0, 0, 0, 0, 0, 4223, 6353, 0,
+	0, 0, 0, 0, 0, 0, 4869, 4401, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 4777, 0, 6719, 0, 0, 0, 0, 0, 0, 0, 4812, 0, 0, 0,
+	5638, 4040, 5499, 265, 0, 0, 8231, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3117, 2397, 0, 0, 0, 0, 7434, 0, 0, 0, 0, 0, 6289, 0, 0,
+	0, 5814, 0, 0, 0, 0, 0, 8293, 0, 3766, 0, 3127, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 2991, 0, 0, 0, 0, 1352, 0, 0, 0, 0, 832,
+	8335, 0, 0, 0, 0, 0, 0, 970, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 585, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8138, 0, 5029, 0, 3518,
+	0, 0, 0, 0, 0, 5115, 4124, 0, 0, 0, 0, 2614, 2101, 1968, 5564, 0,
+	0, 0, 0, 0, 2687, 7441, 4755, 719, 7400, 5129, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1659, 873, 0, 0, 5716, 6909, 0,
+	7496, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7157, 0, 0, 0, 6862,
+	0, 0, 0, 0, 0, 0, 0, 1476, 0, 0, 5489, 0, 0, 0, 0, 0,
+	0, 7912, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3019, 5961,
+	0, 0, 0, 0, 2477, 2971, 0, 0, 0, 0, 0, 0, 5810, 0, 0, 0,
+	6498, 0, 0, 342, 0, 0, 0, 0, 0, 0, 5188, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7596, 0, 0, 7445, 0,
+	0, 0, 0, 0, 0, 5272, 0, 0, 0, 0, 0, 0, 5851, 0, 0, 7844,
+	0, 0, 0, 0, 5973, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3240, 0,
+	0, 0, 0, 0, 0, 6394, 1896, 0, 0, 0, 0, 0, 0, 0, 4418, 0,
+	0, 0, 0, 0, 0, 4783, 1249, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 2714, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6143,
+	0, 0, 1606, 0, 0, 0, 4021, 0, 7249, 0, 0, 2899, 0, 0, 0, 0,
+	0, 6093, 5436, 0, 0, 0, 0, 0, 0, 0, 7536, 0, 0, 0, 7716, 58,
+	0, 1419, 4460, 4849, 515, 0, 0, 584, 6142, 0, 0, 0, 0, 0, 0, 3711,
+	0, 4256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 650,
+	4985, 0, 0, 0, 8237, 0, 0, 0, 6755, 0, 0, 0, 0, 6559, 0, 2196,
+	5662, 6141, 0, 0, 0, 0, 6157, 0, 2033, 0, 0, 0, 0, 0, 5018, 0,
+	0, 0, 4785, 0, 0, 3716, 6809, 0, 0, 0, 0, 0, 0, 0, 499, 0,
+	1615, 0, 0, 0, 3163, 0, 5966, 8005, 0, 0, 7768, 0, 0, 0, 0, 0,
+	0, 0, 6984, 0, 6336, 6528, 0, 1412, 0, 5149, 4950, 0, 7027, 0, 0, 0,
+	0, 0, 5337, 0, 6684, 0, 0, 0, 0, 0, 0, 0, 2086, 0, 4206, 0,
+	0, 0, 0, 0, 0, 3608, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	890, 0, 0, 0, 0, 0, 0, 0, 0, 4300, 5916, 0, 5586, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2306, 0, 0, 0, 429, 0,
+	0, 0, 0, 0, 0, 4643, 0, 0, 0, 0, 0, 5861, 0, 0, 0, 0,
+	0, 0, 0, 1931, 0, 0, 0, 0, 1724, 0, 0, 0, 0, 0, 0, 381,
+	440, 6716, 0, 0, 0, 0, 0, 0, 7341, 0, 0, 0, 4572, 0, 6645, 5121,
+	0, 0, 0, 0, 0, 0, 0, 0, 3643, 4409, 0, 0, 1699, 0, 0, 0,
+	0, 0, 0, 4417, 4562, 0, 0, 0, 0, 760, 5983, 7586, 0, 0, 1082, 699,
+	3184, 0, 0, 7241, 0, 0, 0, 0, 0, 0, 3719, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 233, 0, 0, 0, 795, 0, 7643, 0, 0,
+	0, 0, 7917, 717, 0, 0, 0, 0, 0, 0, 0, 4026, 0, 323, 0, 0,
+	0, 0, 5680, 4270, 0, 0, 0, 3582, 0, 0, 0, 5742, 0, 0, 0, 0,
+	0, 0, 0, 0, 1907, 0, 0, 0, 3846, 0, 0, 0, 0, 8234, 312, 0,
+	0, 0, 0, 0, 0, 0, 7937, 0, 1225, 0, 5639, 0, 1475, 0, 0, 0,
+	1260, 0, 6295, 0, 0, 0, 0, 0, 0, 6822, 6867, 0, 0, 0, 0, 0,
+	0, 1436, 0, 0, 0, 0, 0, 0, 0, 7033, 0, 0, 0, 0, 0, 0,
+	5451, 0, 0, 8187, 7361, 0, 0, 0, 0, 0, 0, 5196, 0, 0, 3800, 1703,
+	1915, 0, 0, 3562, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4307, 0, 0, 0, 0, 0, 0, 0, 0, 3327, 0, 1856, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 7497, 0, 0, 0, 0, 0, 7642, 0, 0, 0,
+	639, 0, 0, 0, 0, 2112, 0, 0, 0, 526, 1619, 0, 0, 3358, 0, 0,
+	0, 2476, 0, 0, 6949, 3910, 0, 0, 0, 0, 0, 0, 0, 0, 5001, 0,
+	0, 0, 0, 0, 4082, 0, 0, 3092, 0, 0, 0, 0, 5478, 0, 0, 0,
+	6390, 4822, 3785, 0, 0, 6717, 0, 0, 0, 3357, 0, 2165, 0, 0, 5862, 0,
+	0, 3871, 207, 0, 0, 0, 0, 943, 4468, 2728, 0, 6544, 0, 0, 2593, 0,
+	3528, 0, 0, 1586, 0, 0, 0, 0, 0, 3833, 0, 0, 0, 0, 1177, 3441,
+	0, 0, 7182, 0, 0, 0, 0, 0, 0, 6023, 0, 0, 0, 0, 0, 0,
+	2398, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3209, 0, 0, 0, 0,
+	0, 0, 0, 2603, 0, 0, 0, 0, 0, 0, 0, 3601, 0, 5994, 0, 0,
+	4842, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5715, 0, 0, 5237, 0, 0,
+	0, 4060, 0, 0, 0, 6819, 0, 0, 7760, 2563, 0, 1946, 4068, 2450, 0, 0,
+	0, 4349, 0, 4125, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4811, 6993, 1858, 0, 3268, 0, 0, 0, 689, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 7949, 0, 3445, 0, 0, 1057, 0, 0, 0, 0, 7672, 0, 0,
+	7990, 4932, 0, 5539, 5944, 0, 0, 5443, 0, 0, 944, 4033, 5332, 0, 0, 0,
+	0, 376, 0, 0, 5047, 0, 0, 0, 0, 0, 7120, 0, 0, 0, 3590, 776,
+	404, 3558, 3437, 0, 0, 1902, 0, 0, 3129, 0, 4976, 1458, 6577, 0, 0, 0,
+	7188, 4272, 0, 6655, 0, 0, 2291, 2134, 0, 0, 0, 6418, 0, 0, 0, 6777,
+	0, 6659, 0, 0, 4588, 0, 0, 2636, 2979, 0, 0, 4728, 0, 6123, 0, 4101,
+	6086, 1508, 0, 0, 0, 0, 0, 5389, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 3880, 0, 0, 0, 0, 0, 445, 0, 2129, 0, 0, 7018, 4594,
+	8030, 0, 215, 0, 0, 2474, 0, 0, 0, 1613, 5708, 0, 1468, 0, 0, 0,
+	0, 0, 0, 2149, 0, 0, 0, 955, 0, 0, 0, 692, 2522, 0, 5100, 3982,
+	0, 0, 0, 6131, 0, 0, 0, 0, 0, 3917, 0, 0, 0, 0, 0, 8021,
+	1791, 0, 0, 0, 5512, 6268, 0, 0, 2020, 0, 0, 0, 0, 6105, 388, 0,
+	0, 0, 5198, 2377, 0, 0, 0, 0, 0, 0, 0, 0, 1919, 0, 0, 0,
+	7125, 1950, 0, 0, 0, 0, 0, 0, 4735, 0, 6591, 0, 0, 0, 0, 0,
+	0, 8155, 0, 0, 0, 0, 0, 0, 0, 0, 1666, 0, 0, 5816, 1024, 0,
+	0, 0, 0, 0, 5386, 0, 0, 0, 7278, 0, 0, 0, 0, 0, 0, 0,
+	0, 656, 0, 0, 0, 3448, 531, 6360, 0, 0, 0, 0, 0, 6429, 7856, 0,
+	3191, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1912, 0, 0,
+	0, 0, 2913, 0, 0, 3893, 4098, 298, 0, 519, 3551, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 7764, 0, 0, 0, 0, 0, 0, 3775, 4659, 3134, 0, 4670,
+	7809, 0, 1874, 0, 0, 4971, 0, 0, 2156, 0, 0, 0, 0, 3845, 0, 8105,
+	0, 0, 0, 0, 0, 0, 0, 360, 0, 0, 0, 0, 7424, 0, 0, 5278,
+	6611, 6526, 0, 0, 0, 0, 0, 0, 8207, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 479, 0, 0, 0, 0, 0, 0, 6241, 0, 0, 0, 0, 1313, 0,
+	3878, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4773, 0, 6034, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6119, 0, 6468,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 595, 0, 0, 0, 4669, 0, 0, 4781, 0, 2580, 3483, 588, 4114, 0,
+	0, 3157, 0, 7570, 0, 0, 5551, 0, 0, 6010, 0, 4954, 8175, 4931, 0, 0,
+	0, 0, 4648, 5150, 6571, 5881, 0, 6410, 1532, 6619, 0, 0, 0, 0, 0, 0,
+	5930, 0, 3531, 0, 3328, 0, 1100, 0, 1079, 1756, 0, 0, 6531, 5085, 6925, 8285,
+	0, 0, 0, 0, 0, 5872, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 7472, 0, 0, 0, 0, 0, 0, 0, 0, 3388, 0, 0, 6178,
+	1995, 0, 0, 2381, 0, 0, 3048, 0, 0, 0, 0, 5599, 0, 0, 2025, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4032, 0, 4939, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5847, 1252, 3502, 0,
+	3482, 0, 0, 0, 203, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 318, 7256, 4854, 0, 3500, 3028, 0, 0, 0, 0, 0, 0, 4148, 0, 0,
+	470, 0, 0, 0, 4113, 0, 0, 0, 7469, 5974, 0, 45, 4267, 0, 0, 0,
+	1181, 0, 5439, 0, 0, 0, 0, 0, 5077, 0, 0, 0, 0, 0, 0, 0,
+	4377, 0, 1298, 4885, 0, 0, 0, 0, 0, 0, 0, 0, 1850, 5173, 0, 0,
+	0, 553, 0, 2413, 0, 0, 0, 3532, 0, 0, 6310, 27, 0, 0, 0, 0,
+	8191, 0, 1723, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 1282, 0, 0, 0, 5348, 4714, 0, 0, 6136, 5952, 0, 0, 822, 0,
+	7058, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 2052, 0, 2269, 0, 0, 0, 7705, 0, 0, 0, 0, 0, 513, 849, 926,
+	0, 0, 0, 0, 0, 0, 2713, 0, 0, 0, 5915, 0, 6159, 0, 0, 0,
+	0, 0, 0, 1927, 0, 0, 0, 0, 3063, 0, 0, 8102, 0, 0, 4642, 0,
+	18, 20, 7046, 0, 0, 0, 0, 0, 0, 0, 1446, 7423, 0, 0, 3045, 0,
+	0, 0, 0, 0, 0, 4484, 0, 1261, 0, 805, 0, 728, 0, 0, 0, 0,
+	0, 0, 1487, 6707, 7964, 0, 0, 0, 0, 448, 7028, 0, 0, 0, 0, 0,
+	6170, 0, 0, 5374, 0, 0, 0, 0, 5981, 0, 0, 0, 0, 5170, 2502, 0,
+	8236, 0, 0, 0, 8295, 0, 0, 0, 0, 0, 0, 7020, 0, 0, 7894, 0,
+	0, 4130, 0, 0, 0, 0, 1881, 146, 0, 0, 7766, 0, 0, 0, 0, 0,
+	2643, 0, 7574, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4512, 4002,
+	0, 0, 0, 0, 2227, 0, 0, 0, 0, 4037, 0, 0, 0, 1707, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 4999, 0, 0, 0, 0, 0, 0,
+	7481, 0, 0, 4983, 2133, 1917, 0, 5279, 0, 0, 0, 0, 0, 1478, 0, 0,
+	0, 0, 0, 0, 0, 3803, 0, 358, 0, 1019, 1861, 0, 0, 0, 0, 0,
+	0, 0, 0, 945, 0, 0, 0, 0, 632, 0, 1653, 0, 0, 379, 0, 0,
+	3851, 0, 7774, 4426, 0, 1465, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1087, 4389, 0, 2068, 0, 0, 6251, 0, 0, 0,
+	0, 0, 1764, 0, 0, 4453, 0, 0, 7752, 0, 0, 0, 0, 0, 0, 7047,
+	0, 0, 0, 0, 0, 0, 4284, 0, 0, 3524, 0, 0, 3313, 0, 6566, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5304, 0, 0, 6042, 0,
+	0, 0, 0, 0, 4820, 0, 4776, 0, 2716, 0, 0, 0, 1377, 0, 0, 0,
+	0, 6415, 0, 0, 0, 0, 3083, 0, 0, 0, 0, 0, 0, 0, 6709, 0,
+	0, 3137, 0, 0, 2656, 0, 0, 0, 0, 4778, 0, 0, 0, 0, 6948, 6572,
+	0, 0, 0, 0, 0, 0, 0, 7215, 0, 0, 7042, 2111, 0, 0, 0, 0,
+	0, 0, 0, 4637, 0, 0, 0, 4447, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 8217, 0, 0, 0, 6133, 0, 0, 6903, 0, 7295, 0, 0,
+	0, 0, 7209, 0, 1812, 0, 3969, 0, 2480, 0, 0, 0, 0, 0, 1284, 0,
+	2488, 0, 0, 0, 0, 0, 0, 4491, 1076, 6759, 0, 0, 0, 0, 4883, 0,
+	5050, 0, 0, 7061, 0, 1660, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4000,
+	0, 6574, 2065, 3475, 0, 0, 0, 8256, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 4132, 0, 0, 0, 6245, 0, 517, 0,
+	0, 0, 3496, 6877, 0, 0, 4766, 2591, 0, 2889, 4432, 0, 0, 0, 3811, 0,
+	0, 0, 0, 1329, 0, 0, 0, 0, 420, 0, 0, 2287, 3336, 0, 0, 0,
+	7010, 0, 309, 0, 0, 1599, 0, 1509, 0, 0, 0, 0, 0, 0, 0, 1865,
+	0, 1895, 0, 2729, 2654, 0, 0, 3208, 0, 2074, 0, 0, 0, 0, 7039, 0,
+	0, 0, 7715, 3796, 0, 0, 7891, 2807, 0, 0, 0, 0, 3443, 5832, 0, 0,
+	0, 0, 7707, 1846, 0, 1667, 6548, 0, 0, 5434, 1485, 0, 3993, 0, 0, 927,
+	0, 4296, 7560, 0, 5404, 2967, 7247, 8087, 0, 0, 0, 0, 0, 1017, 0, 0,
+	6839, 0, 5177, 3521, 0, 0, 3513, 0, 0, 0, 0, 0, 4917, 2862, 0, 0,
+	0, 2373, 5032, 0, 0, 0, 976, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1011, 1546, 0, 0, 0, 0, 0, 0, 0, 7992, 4240, 0,
+	0, 1393, 0, 0, 0, 4277, 0, 5929, 0, 0, 0, 1332, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 4968, 0, 1803, 0, 7657, 0, 0, 0, 0,
+	0, 0, 5226, 132, 0, 0, 0, 0, 0, 0, 0, 7237, 24, 0, 0, 4537,
+	0, 0, 8173, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7801, 0, 887,
+	7818, 0, 0, 2688, 3889, 1572, 0, 0, 0, 0, 0, 4261, 0, 0, 0, 0,
+	0, 0, 648, 5162, 0, 0, 0, 0, 0, 5725, 2271, 0, 0, 0, 0, 0,
+	0, 0, 0, 6357, 0, 0, 0, 0, 0, 3000, 0, 0, 7335, 0, 5829, 0,
+	0, 0, 5301, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2802, 0, 0, 0,
+	5230, 0, 0, 986, 0, 0, 8043, 0, 0, 6958, 4923, 5090, 0, 0, 2360, 0,
+	0, 4944, 0, 0, 0, 0, 0, 0, 0, 0, 2626, 0, 0, 0, 2208, 0,
+	0, 0, 0, 351, 0, 3956, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 8148, 4221, 0, 0, 2282, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 3277, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 206, 724, 0, 151, 1897, 0,
+	532, 1827, 0, 0, 0, 0, 0, 0, 0, 6558, 0, 0, 0, 0, 0, 0,
+	89, 0, 0, 0, 3274, 0, 0, 0, 0, 0, 0, 0, 2318, 0, 0, 0,
+	0, 0, 0, 5656, 0, 0, 4913, 0, 0, 0, 5006, 0, 0, 2805, 0, 0,
+	2069, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6791, 0, 0, 0, 0,
+	0, 5601, 0, 0, 0, 0, 2515, 1684, 0, 0, 6326, 0, 1559, 0, 3200, 0,
+	0, 0, 1182, 0, 3692, 0, 0, 0, 0, 0, 0, 0, 0, 2772, 2712, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7550, 0,
+	0, 0, 0, 5189, 311, 0, 4555, 0, 0, 0, 0, 0, 4928, 0, 0, 0,
+	0, 0, 0, 0, 0, 2679, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 5211, 0, 0, 0, 0, 4219, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 2104, 0, 4525, 0, 0, 4069, 6931, 0, 0, 0, 0,
+	0, 0, 1289, 0, 0, 1493, 0, 0, 0, 0, 0, 0, 0, 2610, 0, 0,
+	0, 6041, 2215, 4122, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 1801, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1118, 0, 0, 2741, 0, 0, 3861, 0, 0, 0, 4596, 4824,
+	0, 3881, 0, 0, 0, 0, 8340, 0, 0, 0, 0, 0, 159, 0, 0, 0,
+	0, 0, 0, 0, 0, 5798, 0, 0, 741, 0, 613, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 5543, 0, 0, 0, 0, 0, 3102, 8249, 0, 4475, 0,
+	0, 284, 0, 0, 0, 1027, 0, 0, 0, 0, 2096, 0, 0, 0, 0, 0,
+	3486, 56, 0, 0, 62, 0, 0, 0, 3727, 0, 0, 2189, 0, 537, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 397, 0, 0, 7062, 0, 0,
+	4328, 0, 464, 0, 5812, 6113, 0, 0, 0, 7006, 7299, 0, 7686, 0, 0, 0,
+	0, 2588, 7688, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 6053, 0, 0, 0, 0, 1943, 0, 0,
+	0, 0, 0, 2842, 0, 4941, 8078, 0, 2122, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 4298, 0, 0, 355, 0, 0, 0, 0, 0, 0,
+	0, 7486, 6999, 5585, 7201, 0, 2661, 7356, 5402, 0, 0, 3042, 0, 0, 2243, 0,
+	0, 6530, 2137, 0, 0, 0, 7587, 7541, 0, 0, 0, 0, 3985, 0, 0, 0,
+	0, 0, 0, 0, 3052, 0, 5510, 5879, 1281, 543, 835, 0, 0, 0, 661, 0,
+	0, 0, 7765, 0, 3110, 5533, 0, 3224, 6643, 0, 0, 0, 2615, 0, 0, 0,
+	0, 0, 4650, 4871, 0, 0, 0, 0, 8294, 0, 0, 0, 0, 0, 2745, 0,
+	0, 0, 5808, 0, 0, 3212, 4689, 0, 0, 3703, 0, 0, 1074, 0, 0, 3767,
+	5745, 0, 0, 0, 0, 0, 0, 0, 6259, 0, 4626, 0, 5569, 0, 0, 0,
+	8019, 0, 5766, 4893, 0, 0, 830, 0, 0, 0, 0, 0, 2830, 0, 0, 0,
+	0, 8067, 0, 0, 0, 5361, 4597, 0, 1600, 0, 0, 5820, 1103, 0, 0, 0,
+	0, 0, 0, 7261, 0, 0, 1405, 0, 8292, 4924, 0, 4302, 0, 3831, 8186, 0,
+	4948, 1654, 0, 0, 0, 0, 0, 0, 4495, 0, 2002, 0, 6314, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 870, 7957, 0, 0, 432, 0, 0,
+	0, 0, 5254, 0, 0, 0, 0, 0, 5417, 0, 0, 0, 0, 0, 0, 0,
+	4668, 5769, 0, 6327, 0, 3683, 0, 0, 2734, 7565, 0, 0, 0, 0, 0, 7436,
+	1562, 7883, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5685, 0,
+	0, 0, 0, 6313, 139, 0, 0, 0, 0, 3140, 0, 0, 0, 0, 0, 0,
+	0, 1694, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 4264, 0, 0, 0, 0, 0, 0, 6436, 0, 0, 2231, 0, 6334, 4260, 0,
+	0, 6941, 1015, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4073, 801,
+	1012, 0, 0, 0, 0, 0, 0, 0, 3838, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 5920, 0, 0, 0, 0, 0, 0, 5552, 2881, 0, 0, 3571, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5900, 0, 0,
+	0, 0, 869, 0, 0, 0, 8270, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	7956, 327, 0, 0, 0, 5274, 3031, 0, 0, 3318, 0, 0, 0, 0, 0, 0,
+	184, 0, 0, 0, 4879, 156, 0, 0, 0, 0, 0, 1324, 0, 6718, 50, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6731, 0, 0, 0, 4910, 0,
+	0, 0, 0, 0, 0, 0, 3342, 0, 0, 0, 4635, 6627, 0, 0, 0, 8218,
+	4382, 0, 0, 0, 0, 0, 0, 0, 0, 700, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 1848, 5776, 0, 0, 200, 0, 0, 0, 0, 0,
+	0, 0, 5527, 2571, 0, 1274, 0, 5128, 0, 0, 7518, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 491, 0, 0, 0, 1210, 0, 6227, 0, 1863, 0, 0, 793,
+	0, 0, 3039, 0, 0, 0, 0, 7000, 0, 0, 0, 0, 0, 0, 0, 0,
+	4509, 0, 7384, 0, 0, 0, 0, 5300, 0, 0, 3583, 0, 0, 985, 0, 0,
+	0, 4004, 4733, 7519, 0, 8300, 4770, 1763, 0, 0, 7184, 0, 0, 0, 0, 2366,
+	0, 0, 0, 7428, 0, 2996, 4577, 0, 0, 0, 0, 7607, 5105, 0, 0, 0,
+	8136, 0, 0, 0, 1689, 3323, 0, 0, 0, 0, 83, 0, 0, 7633, 0, 0,
+	0, 0, 0, 5330, 3308, 0, 8277, 7137, 8253, 0, 0, 7799, 0, 0, 6959, 1168,
+	0, 0, 6454, 0, 6933, 0, 7084, 0, 5201, 0, 4471, 7735, 0, 0, 754, 7413,
+	0, 0, 0, 0, 0, 0, 5910, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	6712, 0, 7004, 424, 0, 0, 0, 3758, 0, 0, 2852, 0, 0, 0, 0, 1909,
+	2296, 0, 0, 0, 1674, 4764, 0, 0, 0, 0, 0, 0, 4922, 7016, 0, 1362,
+	6745, 0, 0, 0, 0, 0, 0, 0, 7025, 5376, 0, 0, 0, 0, 0, 5038,
+	0, 0, 0, 1739, 0, 0, 0, 0, 0, 4345, 0, 0, 0, 0, 0, 2751,
+	0, 6236, 0, 0, 0, 0, 0, 4872, 6235, 2939, 756, 1346, 0, 0, 0, 0,
+	0, 3673, 0, 0, 0, 0, 0, 0, 6064, 0, 2062, 0, 0, 3064, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 3694, 0, 2414, 3476, 0, 0, 2525,
+	7921, 0, 1450, 0, 7489, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 5660, 0, 1065, 0, 0, 3962, 0, 2756, 2008, 0, 750, 0, 0, 0,
+	2625, 0, 6077, 0, 0, 8035, 0, 0, 0, 2310, 0, 0, 5022, 0, 5687, 6002,
+	0, 0, 0, 1196, 2533, 0, 0, 7185, 0, 3633, 8082, 1687, 1278, 0, 7048, 0,
+	0, 0, 7534, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 6989, 0, 0, 4373, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 3924, 0, 2907, 0, 0, 0, 0, 0, 0, 0, 5450,
+	3479, 0, 0, 0, 0, 4340, 0, 0, 0, 0, 0, 0, 0, 0, 0, 169,
+	5535, 0, 0, 0, 0, 0, 170, 5110, 0, 0, 0, 0, 0, 7095, 0, 0,
+	0, 0, 0, 3854, 0, 7026, 3853, 0, 0, 0, 0, 0, 0, 5809, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 7670, 7803, 0, 0, 0, 0, 0, 4514,
+	0, 0, 7749, 0, 5044, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1712, 6151, 0, 0, 0, 0, 0, 5562, 0, 0, 0, 2425, 413, 0, 7170, 0,
+	0, 0, 0, 7860, 0, 0, 0, 0, 0, 307, 6977, 0, 0, 0, 3999, 0,
+	0, 0, 808, 0, 0, 0, 0, 0, 0, 0, 5619, 0, 0, 3950, 2786, 0,
+	0, 0, 0, 3799, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3706, 0, 3795,
+	0, 2689, 0, 0, 0, 0, 0, 333, 0, 0, 0, 0, 5887, 0, 4075, 0,
+	0, 0, 0, 0, 7153, 0, 0, 7071, 0, 4346, 0, 0, 2106, 6569, 0, 0,
+	0, 0, 0, 0, 3286, 4492, 0, 0, 0, 0, 0, 7145, 0, 0, 0, 0,
+	4332, 2927, 0, 0, 2204, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3199,
+	0, 4942, 0, 71, 0, 1486, 0, 0, 0, 690, 0, 0, 8015, 0, 5895, 0,
+	0, 4799, 3732, 0, 0, 0, 0, 0, 0, 0, 1422, 0, 0, 5067, 0, 2531,
+	0, 2887, 5854, 0, 0, 0, 3407, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4395, 7223, 0, 0, 0, 5250, 0, 4083, 0, 0, 6305, 0, 0, 7285, 3074, 0,
+	0, 0, 0, 2430, 0, 5528, 0, 0, 7273, 0, 0, 0, 0, 0, 0, 0,
+	0, 2616, 6389, 0, 0, 0, 0, 0, 0, 4645, 5647, 0, 2357, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 382, 0, 0, 1820, 0, 0,
+	6870, 0, 0, 0, 0, 1445, 348, 0, 0, 0, 0, 675, 0, 0, 0, 0,
+	0, 0, 0, 0, 6299, 0, 0, 0, 7692, 0, 0, 0, 0, 0, 0, 0,
+	2057, 5692, 7702, 201, 0, 0, 0, 0, 0, 4889, 0, 0, 7976, 0, 5092, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 7286, 0, 2453, 0, 0, 0, 3675, 0,
+	6283, 0, 0, 0, 0, 0, 0, 0, 7257, 0, 0, 0, 7540, 5938, 0, 0,
+	6469, 0, 4649, 0, 0, 5666, 0, 0, 0, 5781, 4978, 0, 858, 0, 0, 0,
+	0, 5827, 7380, 0, 813, 0, 0, 0, 0, 0, 0, 0, 2289, 0, 0, 0,
+	0, 6813, 7638, 0, 0, 0, 0, 6447, 0, 0, 0, 823, 2192, 0, 0, 0,
+	0, 0, 2669, 0, 116, 0, 248, 94, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 8313, 0, 7242, 0, 3488, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 7794, 0, 0, 0, 7527, 0, 0, 5359, 0, 0, 6052, 0, 0,
+	0, 0, 3629, 0, 0, 0, 0, 0, 0, 0, 1311, 1322, 0, 4276, 4095, 5488,
+	0, 0, 0, 2302, 3737, 0, 5442, 3100, 7783, 0, 0, 0, 0, 0, 0, 0,
+	0, 2317, 2670, 0, 2763, 8028, 1023, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 814, 0, 0, 0, 0, 8004, 0, 0, 7106, 5290, 0,
+	7328, 0, 0, 0, 0, 5919, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	6575, 0, 0, 0, 0, 0, 0, 0, 7892, 0, 0, 0, 0, 0, 1002, 0,
+	0, 0, 0, 0, 0, 0, 3232, 0, 0, 0, 0, 6100, 0, 0, 0, 0,
+	0, 0, 0, 884, 0, 0, 6746, 0, 253, 3167, 0, 0, 0, 405, 0, 0,
+	2343, 0, 0, 0, 0, 0, 0, 0, 0, 4759, 0, 0, 698, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 5677, 0, 0, 0, 0, 1110, 0,
+	0, 2028, 0, 3159, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 121, 4479, 0, 0, 6582, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 8031, 6587, 0, 3155, 4604, 666, 0, 0, 2651, 0,
+	2389, 0, 0, 0, 0, 2696, 0, 3040, 0, 0, 0, 1320, 0, 529, 3620, 0,
+	1744, 0, 0, 0, 0, 7470, 0, 0, 0, 2553, 0, 0, 0, 0, 1833, 7505,
+	0, 0, 6733, 2190, 0, 3171, 0, 0, 6715, 0, 274, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 7251, 0, 0, 0, 0, 0, 0, 173, 3332, 0, 3960, 0,
+	0, 290, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5206, 0,
+	0, 0, 2838, 0, 2256, 0, 1265, 0, 0, 0, 6385, 0, 0, 0, 2573, 0,
+	0, 0, 0, 0, 627, 0, 4827, 0, 0, 0, 0, 0, 0, 902, 0, 0,
+	0, 0, 0, 231, 0, 0, 0, 423, 0, 3607, 0, 0, 7740, 6291, 0, 0,
+	0, 0, 0, 1158, 0, 0, 0, 0, 0, 0, 6082, 0, 0, 0, 0, 6342,
+	0, 0, 6502, 0, 8272, 0, 0, 0, 0, 2209, 0, 0, 0, 0, 0, 0,
+	0, 4018, 0, 0, 1853, 0, 0, 1860, 0, 0, 0, 0, 0, 0, 0, 979,
+	0, 0, 0, 0, 0, 1899, 0, 4322, 8131, 0, 0, 0, 0, 0, 0, 0,
+	0, 7852, 3205, 41, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1230,
+	4170, 0, 0, 8130, 0, 0, 0, 3899, 0, 0, 4724, 6782, 0, 0, 0, 0,
+	8193, 0, 4841, 7406, 0, 7743, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4258,
+	0, 0, 0, 6963, 0, 0, 5302, 0, 0, 0, 1451, 0, 0, 0, 0, 0,
+	0, 0, 0, 2675, 6318, 0, 0, 193, 0, 0, 4355, 0, 7378, 2364, 0, 0,
+	0, 0, 1944, 0, 0, 0, 0, 0, 0, 0, 0, 3609, 0, 6896, 0, 0,
+	0, 0, 0, 3613, 0, 0, 401, 6078, 3461, 0, 3116, 0, 0, 4136, 0, 0,
+	4414, 0, 0, 107, 0, 1796, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 5705, 0, 2506, 0, 0, 0, 0, 0, 6598, 7370, 0, 0, 4155,
+	0, 0, 3081, 0, 0, 0, 0, 0, 4451, 0, 0, 0, 0, 4681, 0, 0,
+	0, 0, 0, 3721, 0, 0, 0, 0, 7772, 0, 925, 0, 1061, 0, 0, 0,
+	0, 0, 6033, 0, 0, 0, 0, 0, 6994, 8137, 0, 0, 0, 6255, 1042, 271,
+	0, 0, 0, 0, 0, 0, 2948, 6432, 0, 6969, 0, 0, 0, 0, 1851, 0,
+	0, 0, 0, 0, 6567, 0, 0, 7385, 0, 0, 0, 0, 0, 6637, 0, 0,
+	0, 0, 8344, 0, 0, 0, 0, 0, 2863, 0, 0, 0, 0, 6382, 0, 5448,
+	0, 0, 0, 0, 5875, 0, 0, 0, 0, 1997, 0, 0, 0, 0, 0, 2501,
+	7202, 0, 0, 0, 4205, 0, 7466, 0, 261, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 7561, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3819, 7724, 0, 0,
+	100, 0, 0, 7877, 0, 0, 0, 0, 0, 5397, 0, 0, 0, 0, 6997, 2172,
+	0, 0, 5215, 0, 0, 6542, 0, 921, 6109, 0, 0, 1838, 0, 3954, 547, 0,
+	4093, 6490, 0, 0, 0, 0, 0, 5755, 0, 0, 0, 0, 3667, 0, 0, 0,
+	1184, 0, 0, 5605, 0, 0, 0, 0, 0, 0, 0, 123, 7449, 0, 0, 1862,
+	0, 1215, 0, 0, 0, 0, 7645, 0, 0, 0, 0, 6697, 2768, 0, 36, 0,
+	0, 0, 0, 0, 0, 0, 2723, 0, 7240, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 5377, 0, 0, 0, 0, 0, 0, 0, 0, 7582,
+	7729, 7747, 0, 0, 0, 1967, 3361, 0, 0, 2743, 0, 0, 0, 0, 297, 0,
+	0, 0, 0, 0, 7365, 0, 0, 0, 7748, 5980, 0, 0, 5701, 0, 0, 4817,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4365, 0, 0,
+	0, 0, 2865, 0, 0, 0, 0, 0, 0, 402, 7854, 0, 0, 0, 0, 3964,
+	0, 0, 6037, 0, 0, 6928, 0, 8023, 0, 0, 5425, 0, 0, 0, 0, 0,
+	0, 2250, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 901, 0, 0,
+	229, 3160, 0, 0, 0, 7221, 0, 0, 0, 0, 0, 936, 0, 0, 0, 0,
+	0, 3198, 4974, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0,
+	0, 0, 0, 4698, 0, 0, 0, 0, 0, 0, 0, 8287, 6003, 0, 4834, 0,
+	3489, 0, 0, 0, 0, 0, 0, 0, 0, 5413, 0, 0, 0, 8064, 154, 0,
+	918, 3151, 2820, 0, 0, 0, 0, 0, 0, 0, 0, 4224, 4912, 3436, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4079, 0, 0, 0, 0,
+	5268, 2499, 0, 0, 0, 0, 0, 0, 0, 0, 4606, 5049, 3037, 0, 0, 3080,
+	0, 0, 0, 0, 0, 8022, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	6381, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7340, 5663, 0, 0,
+	0, 2514, 4617, 0, 0, 0, 0, 0, 0, 6672, 0, 0, 0, 0, 8252, 2175,
+	2647, 2292, 0, 0, 0, 0, 7034, 0, 0, 685, 0, 0, 0, 0, 136, 0,
+	5430, 0, 0, 0, 0, 0, 0, 0, 0, 3370, 5366, 0, 0, 0, 0, 0,
+	3971, 0, 7277, 0, 2004, 5364, 4438, 0, 0, 0, 0, 4710, 0, 1782, 0, 5109,
+	0, 0, 0, 0, 0, 0, 0, 4758, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 716, 7148, 0, 0, 0, 0, 0, 0, 0, 0, 3391, 0, 0, 0, 1231,
+	964, 0, 0, 153, 4499, 0, 0, 0, 0, 7501, 0, 0, 0, 0, 4559, 0,
+	2472, 0, 0, 0, 0, 4683, 0, 0, 0, 0, 0, 0, 1630, 145, 0, 0,
+	0, 0, 0, 0, 1795, 0, 430, 1058, 6403, 0, 3648, 0, 0, 0, 0, 0,
+	1351, 3254, 0, 713, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6335, 0, 0,
+	0, 0, 0, 0, 0, 8180, 6891, 0, 2354, 0, 0, 0, 0, 0, 0, 0,
+	0, 1245, 0, 0, 8247, 0, 5171, 0, 0, 0, 0, 0, 0, 0, 6585, 0,
+	0, 0, 2285, 0, 0, 0, 3759, 0, 0, 0, 6329, 0, 285, 0, 0, 0,
+	5480, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4833, 5292, 5351,
+	5760, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4477, 0, 8276, 0, 0,
+	0, 1456, 4067, 3468, 573, 1423, 0, 0, 0, 0, 3246, 0, 0, 0, 0, 6035,
+	0, 0, 2417, 0, 0, 0, 0, 0, 0, 0, 0, 1976, 0, 0, 0, 0,
+	0, 0, 0, 3038, 0, 0, 1309, 0, 0, 7473, 2388, 0, 0, 0, 0, 0,
+	0, 0, 0, 6820, 0, 0, 0, 0, 6017, 0, 4997, 818, 1939, 0, 0, 6149,
+	0, 21, 205, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2770, 0, 0,
+	0, 0, 0, 0, 1840, 0, 0, 0, 254, 0, 0, 0, 0, 4042, 0, 0,
+	0, 0, 0, 8243, 0, 0, 0, 0, 0, 6095, 3600, 294, 0, 0, 0, 0,
+	0, 1937, 0, 0, 2549, 0, 0, 0, 0, 6422, 0, 0, 0, 6568, 0, 806,
+	0, 1693, 0, 0, 0, 0, 3642, 0, 5019, 0, 0, 0, 0, 5806, 0, 0,
+	0, 5071, 0, 0, 0, 241, 0, 0, 5306, 366, 0, 8343, 7902, 0, 0, 1237,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5693, 0, 0, 2922,
+	0, 4576, 0, 0, 0, 0, 4558, 0, 0, 0, 0, 0, 6512, 3699, 0, 0,
+	0, 0, 0, 0, 0, 1244, 0, 0, 0, 0, 0, 0, 0, 7525, 0, 0,
+	0, 0, 2486, 1992, 0, 0, 0, 0, 0, 0, 0, 0, 5856, 0, 0, 0,
+	0, 0, 3529, 0, 0, 0, 0, 1143, 0, 0, 6668, 0, 2011, 7442, 1849, 0,
+	0, 0, 0, 0, 0, 0, 7991, 0, 0, 0, 0, 4719, 0, 4561, 0, 5817,
+	0, 0, 0, 1056, 0, 4030, 0, 0, 2223, 1955, 0, 0, 0, 0, 10, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5890,
+	0, 7012, 4430, 0, 4964, 0, 0, 0, 0, 7722, 4301, 0, 0, 1469, 2746, 0,
+	0, 0, 0, 6518, 0, 0, 0, 4672, 3098, 0, 0, 0, 2423, 2747, 0, 2727,
+	0, 0, 6850, 0, 0, 0, 0, 0, 0, 0, 6730, 4218, 0, 0, 782, 1372,
+	0, 894, 0, 0, 0, 0, 5723, 4929, 7007, 0, 0, 0, 0, 0, 7968, 0,
+	0, 0, 0, 0, 0, 3744, 0, 0, 155, 0, 4825, 0, 0, 0, 0, 0,
+	0, 3660, 3322, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5923, 0, 2170, 0,
+	5116, 0, 6847, 5007, 0, 6193, 0, 0, 0, 0, 0, 0, 0, 476, 0, 0,
+	0, 0, 4416, 1771, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5297, 0, 6682,
+	0, 1986, 8000, 0, 8327, 0, 0, 7609, 0, 4470, 4511, 0, 0, 0, 8332, 3684,
+	0, 5470, 0, 3346, 0, 0, 704, 3394, 5505, 0, 7227, 0, 5113, 2795, 4214, 0,
+	0, 0, 0, 0, 0, 7248, 0, 0, 6828, 0, 7780, 400, 1089, 0, 3289, 0,
+	0, 0, 5293, 7141, 0, 0, 0, 0, 5311, 0, 0, 4133, 0, 0, 0, 848,
+	0, 4297, 5322, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3941, 0, 0, 0, 0, 0, 0, 0, 4982, 0, 0, 0, 0, 4544, 0, 0,
+	0, 0, 5132, 0, 5867, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3725, 0,
+	0, 950, 0, 0, 0, 4538, 0, 0, 0, 0, 0, 0, 0, 0, 7483, 0,
+	0, 0, 0, 0, 0, 0, 4873, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	8007, 0, 8071, 0, 0, 0, 4279, 1090, 0, 0, 0, 0, 3782, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 7194, 3618, 755, 0, 0, 0, 1906, 0, 1108, 8192,
+	1206, 0, 0, 0, 0, 0, 3150, 0, 0, 0, 7064, 4528, 1595, 0, 0, 7510,
+	0, 0, 0, 0, 0, 0, 4836, 0, 0, 1401, 0, 0, 0, 0, 5336, 7238,
+	0, 0, 7736, 0, 0, 0, 4016, 0, 0, 1642, 6593, 0, 0, 0, 2039, 4991,
+	1088, 0, 0, 0, 95, 0, 0, 0, 4047, 938, 5664, 0, 0, 1784, 3623, 0,
+	0, 5296, 0, 0, 0, 2403, 0, 7745, 0, 2605, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 5672, 0, 0, 0, 4952, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 2236, 0, 0, 182, 0, 0, 6186, 0, 0, 0, 0,
+	0, 0, 0, 5313, 0, 0, 4694, 0, 1584, 0, 0, 0, 0, 0, 0, 0,
+	827, 0, 0, 0, 0, 5734, 0, 0, 4429, 0, 5247, 0, 0, 0, 3931, 6046,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3632, 0, 0, 0, 0, 1506, 0, 0, 0, 0, 4404, 0, 0, 0, 0,
+	4120, 0, 0, 0, 0, 0, 1288, 0, 0, 0, 0, 6669, 0, 0, 0, 0,
+	0, 0, 3740, 0, 0, 0, 0, 0, 6988, 7554, 0, 7632, 0, 0, 3389, 0,
+	0, 0, 0, 3214, 4980, 0, 0, 0, 0, 4988, 0, 0, 0, 5159, 0, 0,
+	7355, 0, 1945, 0, 0, 0, 0, 0, 0, 0, 0, 1533, 3249, 0, 3708, 2439,
+	0, 2117, 0, 0, 0, 0, 0, 0, 0, 0, 6553, 0, 0, 6191, 0, 1349,
+	0, 6736, 0, 0, 0, 6538, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4469, 0, 0, 0, 0, 0, 0, 0, 0, 2803, 472, 5626, 28, 0, 7383, 0,
+	0, 280, 0, 0, 4038, 8042, 0, 0, 0, 0, 0, 1571, 6069, 2005, 7644, 0,
+	0, 0, 2639, 0, 0, 0, 0, 0, 0, 6922, 0, 6629, 0, 4933, 6920, 0,
+	377, 2666, 0, 5850, 0, 0, 0, 0, 0, 0, 0, 1438, 8080, 0, 0, 0,
+};
+
+const HccIntrinsicString hcc_intrinsic_strings[8352] = {
+	{ 1, 0, 4 },
+	{ 2, 4, 5 },
+	{ 3, 9, 4 },
+	{ 4, 13, 5 },
+	{ 5, 18, 3 },
+	{ 6, 21, 4 },
+	{ 7, 25, 5 },
+	{ 8, 30, 6 },
+	{ 9, 36, 8 },
+	{ 10, 44, 6 },
+	{ 11, 50, 8 },
+	{ 12, 58, 7 },
+	{ 13, 65, 6 },
+	{ 14, 71, 2 },
+	{ 15, 73, 4 },
+	{ 16, 77, 2 },
+	{ 17, 79, 5 },
+	{ 18, 84, 3 },
+	{ 19, 87, 6 },
+	{ 20, 93, 4 },
+	{ 21, 97, 7 },
+	{ 22, 104, 5 },
+	{ 23, 109, 8 },
+	{ 24, 117, 4 },
+	{ 25, 121, 5 },
+	{ 26, 126, 12 },
+	{ 27, 138, 11 },
+	{ 28, 149, 13 },
+	{ 29, 162, 14 },
+	{ 30, 176, 10 },
+	{ 31, 186, 4 },
+	{ 32, 190, 6 },
+	{ 33, 196, 5 },
+	{ 34, 201, 7 },
+	{ 35, 208, 6 },
+	{ 36, 214, 5 },
+	{ 37, 219, 7 },
+	{ 38, 226, 4 },
+	{ 39, 230, 8 },
+	{ 40, 238, 8 },
+	{ 41, 246, 6 },
+	{ 42, 252, 13 },
+	{ 43, 265, 20 },
+	{ 44, 285, 6 },
+	{ 45, 291, 9 },
+	{ 46, 300, 6 },
+	{ 47, 306, 8 },
+	{ 48, 314, 8 },
+	{ 49, 322, 14 },
+	{ 50, 336, 8 },
+	{ 51, 344, 8 },
+	{ 52, 352, 12 },
+	{ 53, 364, 14 },
+	{ 54, 378, 22 },
+	{ 55, 400, 17 },
+	{ 56, 417, 12 },
+	{ 57, 429, 14 },
+	{ 58, 443, 12 },
+	{ 59, 455, 11 },
+	{ 60, 466, 14 },
+	{ 61, 480, 19 },
+	{ 62, 499, 14 },
+	{ 63, 513, 19 },
+	{ 64, 532, 16 },
+	{ 65, 548, 21 },
+	{ 66, 569, 14 },
+	{ 67, 583, 11 },
+	{ 68, 594, 14 },
+	{ 69, 608, 19 },
+	{ 70, 627, 14 },
+	{ 71, 641, 19 },
+	{ 72, 660, 16 },
+	{ 73, 676, 21 },
+	{ 74, 697, 14 },
+	{ 75, 711, 11 },
+	{ 76, 722, 14 },
+	{ 77, 736, 19 },
+	{ 78, 755, 14 },
+	{ 79, 769, 19 },
+	{ 80, 788, 16 },
+	{ 81, 804, 21 },
+	{ 82, 825, 14 },
+	{ 83, 839, 18 },
+	{ 84, 857, 23 },
+	{ 85, 880, 18 },
+	{ 86, 898, 23 },
+	{ 87, 921, 20 },
+	{ 88, 941, 25 },
+	{ 89, 966, 18 },
+	{ 90, 984, 8 },
+	{ 91, 992, 8 },
+	{ 92, 1000, 8 },
+	{ 93, 1008, 16 },
+	{ 94, 1024, 11 },
+	{ 95, 1035, 7 },
+	{ 96, 1042, 11 },
+	{ 97, 1053, 14 },
+	{ 98, 1067, 15 },
+	{ 99, 1082, 13 },
+	{ 100, 1095, 15 },
+	{ 101, 1110, 2 },
+	{ 102, 1112, 2 },
+	{ 103, 1114, 2 },
+	{ 104, 1116, 2 },
+	{ 105, 1118, 2 },
+	{ 106, 1120, 2 },
+	{ 107, 1122, 2 },
+	{ 108, 1124, 2 },
+	{ 109, 1126, 2 },
+	{ 110, 1128, 2 },
+	{ 111, 1130, 2 },
+	{ 112, 1132, 2 },
+	{ 113, 1134, 2 },
+	{ 114, 1136, 2 },
+	{ 115, 1138, 2 },
+	{ 116, 1140, 2 },
+	{ 117, 1142, 3 },
+	{ 118, 1145, 3 },
+	{ 119, 1148, 3 },
+	{ 120, 1151, 3 },
+	{ 121, 1154, 3 },
+	{ 122, 1157, 3 },
+	{ 123, 1160, 3 },
+	{ 124, 1163, 3 },
+	{ 125, 1166, 3 },
+	{ 126, 1169, 3 },
+	{ 127, 1172, 3 },
+	{ 128, 1175, 3 },
+	{ 129, 1178, 3 },
+	{ 130, 1181, 3 },
+	{ 131, 1184, 3 },
+	{ 132, 1187, 3 },
+	{ 133, 1190, 3 },
+	{ 134, 1193, 3 },
+	{ 135, 1196, 3 },
+	{ 136, 1199, 3 },
+	{ 137, 1202, 3 },
+	{ 138, 1205, 3 },
+	{ 139, 1208, 3 },
+	{ 140, 1211, 3 },
+	{ 141, 1214, 3 },
+	{ 142, 1217, 3 },
+	{ 143, 1220, 3 },
+	{ 144, 1223, 3 },
+	{ 145, 1226, 3 },
+	{ 146, 1229, 3 },
+	{ 147, 1232, 3 },
+	{ 148, 1235, 3 },
+	{ 149, 1238, 3 },
+	{ 150, 1241, 3 },
+	{ 151, 1244, 3 },
+	{ 152, 1247, 3 },
+	{ 153, 1250, 3 },
+	{ 154, 1253, 3 },
+	{ 155, 1256, 3 },
+	{ 156, 1259, 3 },
+	{ 157, 1262, 3 },
+	{ 158, 1265, 3 },
+	{ 159, 1268, 3 },
+	{ 160, 1271, 3 },
+	{ 161, 1274, 3 },
+	{ 162, 1277, 3 },
+	{ 163, 1280, 3 },
+	{ 164, 1283, 3 },
+	{ 165, 1286, 3 },
+	{ 166, 1289, 3 },
+	{ 167, 1292, 3 },
+	{ 168, 1295, 3 },
+	{ 169, 1298, 3 },
+	{ 170, 1301, 3 },
+	{ 171, 1304, 3 },
+	{ 172, 1307, 3 },
+	{ 173, 1310, 3 },
+	{ 174, 1313, 3 },
+	{ 175, 1316, 3 },
+	{ 176, 1319, 3 },
+	{ 177, 1322, 3 },
+	{ 178, 1325, 3 },
+	{ 179, 1328, 3 },
+	{ 180, 1331, 3 },
+	{ 181, 1334, 4 },
+	{ 182, 1338, 4 },
+	{ 183, 1342, 4 },
+	{ 184, 1346, 4 },
+	{ 185, 1350, 4 },
+	{ 186, 1354, 4 },
+	{ 187, 1358, 4 },
+	{ 188, 1362, 4 },
+	{ 189, 1366, 4 },
+	{ 190, 1370, 4 },
+	{ 191, 1374, 4 },
+	{ 192, 1378, 4 },
+	{ 193, 1382, 4 },
+	{ 194, 1386, 4 },
+	{ 195, 1390, 4 },
+	{ 196, 1394, 4 },
+	{ 197, 1398, 4 },
+	{ 198, 1402, 4 },
+	{ 199, 1406, 4 },
+	{ 200, 1410, 4 },
+	{ 201, 1414, 4 },
+	{ 202, 1418, 4 },
+	{ 203, 1422, 4 },
+	{ 204, 1426, 4 },
+	{ 205, 1430, 4 },
+	{ 206, 1434, 4 },
+	{ 207, 1438, 4 },
+	{ 208, 1442, 4 },
+	{ 209, 1446, 4 },
+	{ 210, 1450, 4 },
+	{ 211, 1454, 4 },
+	{ 212, 1458, 4 },
+	{ 213, 1462, 4 },
+	{ 214, 1466, 4 },
+	{ 215, 1470, 4 },
+	{ 216, 1474, 4 },
+	{ 217, 1478, 4 },
+	{ 218, 1482, 4 },
+	{ 219, 1486, 4 },
+	{ 220, 1490, 4 },
+	{ 221, 1494, 4 },
+	{ 222, 1498, 4 },
+	{ 223, 1502, 4 },
+	{ 224, 1506, 4 },
+	{ 225, 1510, 4 },
+	{ 226, 1514, 4 },
+	{ 227, 1518, 4 },
+	{ 228, 1522, 4 },
+	{ 229, 1526, 4 },
+	{ 230, 1530, 4 },
+	{ 231, 1534, 4 },
+	{ 232, 1538, 4 },
+	{ 233, 1542, 4 },
+	{ 234, 1546, 4 },
+	{ 235, 1550, 4 },
+	{ 236, 1554, 4 },
+	{ 237, 1558, 4 },
+	{ 238, 1562, 4 },
+	{ 239, 1566, 4 },
+	{ 240, 1570, 4 },
+	{ 241, 1574, 4 },
+	{ 242, 1578, 4 },
+	{ 243, 1582, 4 },
+	{ 244, 1586, 4 },
+	{ 245, 1590, 4 },
+	{ 246, 1594, 4 },
+	{ 247, 1598, 4 },
+	{ 248, 1602, 4 },
+	{ 249, 1606, 4 },
+	{ 250, 1610, 4 },
+	{ 251, 1614, 4 },
+	{ 252, 1618, 4 },
+	{ 253, 1622, 4 },
+	{ 254, 1626, 4 },
+	{ 255, 1630, 4 },
+	{ 256, 1634, 4 },
+	{ 257, 1638, 4 },
+	{ 258, 1642, 4 },
+	{ 259, 1646, 4 },
+	{ 260, 1650, 4 },
+	{ 261, 1654, 4 },
+	{ 262, 1658, 4 },
+	{ 263, 1662, 4 },
+	{ 264, 1666, 4 },
+	{ 265, 1670, 4 },
+	{ 266, 1674, 4 },
+	{ 267, 1678, 4 },
+	{ 268, 1682, 4 },
+	{ 269, 1686, 4 },
+	{ 270, 1690, 4 },
+	{ 271, 1694, 4 },
+	{ 272, 1698, 4 },
+	{ 273, 1702, 4 },
+	{ 274, 1706, 4 },
+	{ 275, 1710, 4 },
+	{ 276, 1714, 4 },
+	{ 277, 1718, 4 },
+	{ 278, 1722, 4 },
+	{ 279, 1726, 4 },
+	{ 280, 1730, 4 },
+	{ 281, 1734, 4 },
+	{ 282, 1738, 4 },
+	{ 283, 1742, 4 },
+	{ 284, 1746, 4 },
+	{ 285, 1750, 4 },
+	{ 286, 1754, 4 },
+	{ 287, 1758, 4 },
+	{ 288, 1762, 4 },
+	{ 289, 1766, 4 },
+	{ 290, 1770, 4 },
+	{ 291, 1774, 4 },
+	{ 292, 1778, 4 },
+	{ 293, 1782, 4 },
+	{ 294, 1786, 4 },
+	{ 295, 1790, 4 },
+	{ 296, 1794, 4 },
+	{ 297, 1798, 4 },
+	{ 298, 1802, 4 },
+	{ 299, 1806, 4 },
+	{ 300, 1810, 4 },
+	{ 301, 1814, 4 },
+	{ 302, 1818, 4 },
+	{ 303, 1822, 4 },
+	{ 304, 1826, 4 },
+	{ 305, 1830, 4 },
+	{ 306, 1834, 4 },
+	{ 307, 1838, 4 },
+	{ 308, 1842, 4 },
+	{ 309, 1846, 4 },
+	{ 310, 1850, 4 },
+	{ 311, 1854, 4 },
+	{ 312, 1858, 4 },
+	{ 313, 1862, 4 },
+	{ 314, 1866, 4 },
+	{ 315, 1870, 4 },
+	{ 316, 1874, 4 },
+	{ 317, 1878, 4 },
+	{ 318, 1882, 4 },
+	{ 319, 1886, 4 },
+	{ 320, 1890, 4 },
+	{ 321, 1894, 4 },
+	{ 322, 1898, 4 },
+	{ 323, 1902, 4 },
+	{ 324, 1906, 4 },
+	{ 325, 1910, 4 },
+	{ 326, 1914, 4 },
+	{ 327, 1918, 4 },
+	{ 328, 1922, 4 },
+	{ 329, 1926, 4 },
+	{ 330, 1930, 4 },
+	{ 331, 1934, 4 },
+	{ 332, 1938, 4 },
+	{ 333, 1942, 4 },
+	{ 334, 1946, 4 },
+	{ 335, 1950, 4 },
+	{ 336, 1954, 4 },
+	{ 337, 1958, 4 },
+	{ 338, 1962, 4 },
+	{ 339, 1966, 4 },
+	{ 340, 1970, 4 },
+	{ 341, 1974, 4 },
+	{ 342, 1978, 4 },
+	{ 343, 1982, 4 },
+	{ 344, 1986, 4 },
+	{ 345, 1990, 4 },
+	{ 346, 1994, 4 },
+	{ 347, 1998, 4 },
+	{ 348, 2002, 4 },
+	{ 349, 2006, 4 },
+	{ 350, 2010, 4 },
+	{ 351, 2014, 4 },
+	{ 352, 2018, 4 },
+	{ 353, 2022, 4 },
+	{ 354, 2026, 4 },
+	{ 355, 2030, 4 },
+	{ 356, 2034, 4 },
+	{ 357, 2038, 4 },
+	{ 358, 2042, 4 },
+	{ 359, 2046, 4 },
+	{ 360, 2050, 4 },
+	{ 361, 2054, 4 },
+	{ 362, 2058, 4 },
+	{ 363, 2062, 4 },
+	{ 364, 2066, 4 },
+	{ 365, 2070, 4 },
+	{ 366, 2074, 4 },
+	{ 367, 2078, 4 },
+	{ 368, 2082, 4 },
+	{ 369, 2086, 4 },
+	{ 370, 2090, 4 },
+	{ 371, 2094, 4 },
+	{ 372, 2098, 4 },
+	{ 373, 2102, 4 },
+	{ 374, 2106, 4 },
+	{ 375, 2110, 4 },
+	{ 376, 2114, 4 },
+	{ 377, 2118, 4 },
+	{ 378, 2122, 4 },
+	{ 379, 2126, 4 },
+	{ 380, 2130, 4 },
+	{ 381, 2134, 4 },
+	{ 382, 2138, 4 },
+	{ 383, 2142, 4 },
+	{ 384, 2146, 4 },
+	{ 385, 2150, 4 },
+	{ 386, 2154, 4 },
+	{ 387, 2158, 4 },
+	{ 388, 2162, 4 },
+	{ 389, 2166, 4 },
+	{ 390, 2170, 4 },
+	{ 391, 2174, 4 },
+	{ 392, 2178, 4 },
+	{ 393, 2182, 4 },
+	{ 394, 2186, 4 },
+	{ 395, 2190, 4 },
+	{ 396, 2194, 4 },
+	{ 397, 2198, 4 },
+	{ 398, 2202, 4 },
+	{ 399, 2206, 4 },
+	{ 400, 2210, 4 },
+	{ 401, 2214, 4 },
+	{ 402, 2218, 4 },
+	{ 403, 2222, 4 },
+	{ 404, 2226, 4 },
+	{ 405, 2230, 4 },
+	{ 406, 2234, 4 },
+	{ 407, 2238, 4 },
+	{ 408, 2242, 4 },
+	{ 409, 2246, 4 },
+	{ 410, 2250, 4 },
+	{ 411, 2254, 4 },
+	{ 412, 2258, 4 },
+	{ 413, 2262, 4 },
+	{ 414, 2266, 4 },
+	{ 415, 2270, 4 },
+	{ 416, 2274, 4 },
+	{ 417, 2278, 4 },
+	{ 418, 2282, 4 },
+	{ 419, 2286, 4 },
+	{ 420, 2290, 4 },
+	{ 421, 2294, 4 },
+	{ 422, 2298, 4 },
+	{ 423, 2302, 4 },
+	{ 424, 2306, 4 },
+	{ 425, 2310, 4 },
+	{ 426, 2314, 4 },
+	{ 427, 2318, 4 },
+	{ 428, 2322, 4 },
+	{ 429, 2326, 4 },
+	{ 430, 2330, 4 },
+	{ 431, 2334, 4 },
+	{ 432, 2338, 4 },
+	{ 433, 2342, 4 },
+	{ 434, 2346, 4 },
+	{ 435, 2350, 4 },
+	{ 436, 2354, 4 },
+	{ 437, 2358, 2 },
+	{ 438, 2360, 2 },
+	{ 439, 2362, 2 },
+	{ 440, 2364, 2 },
+	{ 441, 2366, 2 },
+	{ 442, 2368, 2 },
+	{ 443, 2370, 2 },
+	{ 444, 2372, 2 },
+	{ 445, 2374, 2 },
+	{ 446, 2376, 2 },
+	{ 447, 2378, 2 },
+	{ 448, 2380, 2 },
+	{ 449, 2382, 2 },
+	{ 450, 2384, 2 },
+	{ 451, 2386, 2 },
+	{ 452, 2388, 2 },
+	{ 453, 2390, 3 },
+	{ 454, 2393, 3 },
+	{ 455, 2396, 3 },
+	{ 456, 2399, 3 },
+	{ 457, 2402, 3 },
+	{ 458, 2405, 3 },
+	{ 459, 2408, 3 },
+	{ 460, 2411, 3 },
+	{ 461, 2414, 3 },
+	{ 462, 2417, 3 },
+	{ 463, 2420, 3 },
+	{ 464, 2423, 3 },
+	{ 465, 2426, 3 },
+	{ 466, 2429, 3 },
+	{ 467, 2432, 3 },
+	{ 468, 2435, 3 },
+	{ 469, 2438, 3 },
+	{ 470, 2441, 3 },
+	{ 471, 2444, 3 },
+	{ 472, 2447, 3 },
+	{ 473, 2450, 3 },
+	{ 474, 2453, 3 },
+	{ 475, 2456, 3 },
+	{ 476, 2459, 3 },
+	{ 477, 2462, 3 },
+	{ 478, 2465, 3 },
+	{ 479, 2468, 3 },
+	{ 480, 2471, 3 },
+	{ 481, 2474, 3 },
+	{ 482, 2477, 3 },
+	{ 483, 2480, 3 },
+	{ 484, 2483, 3 },
+	{ 485, 2486, 3 },
+	{ 486, 2489, 3 },
+	{ 487, 2492, 3 },
+	{ 488, 2495, 3 },
+	{ 489, 2498, 3 },
+	{ 490, 2501, 3 },
+	{ 491, 2504, 3 },
+	{ 492, 2507, 3 },
+	{ 493, 2510, 3 },
+	{ 494, 2513, 3 },
+	{ 495, 2516, 3 },
+	{ 496, 2519, 3 },
+	{ 497, 2522, 3 },
+	{ 498, 2525, 3 },
+	{ 499, 2528, 3 },
+	{ 500, 2531, 3 },
+	{ 501, 2534, 3 },
+	{ 502, 2537, 3 },
+	{ 503, 2540, 3 },
+	{ 504, 2543, 3 },
+	{ 505, 2546, 3 },
+	{ 506, 2549, 3 },
+	{ 507, 2552, 3 },
+	{ 508, 2555, 3 },
+	{ 509, 2558, 3 },
+	{ 510, 2561, 3 },
+	{ 511, 2564, 3 },
+	{ 512, 2567, 3 },
+	{ 513, 2570, 3 },
+	{ 514, 2573, 3 },
+	{ 515, 2576, 3 },
+	{ 516, 2579, 3 },
+	{ 517, 2582, 4 },
+	{ 518, 2586, 4 },
+	{ 519, 2590, 4 },
+	{ 520, 2594, 4 },
+	{ 521, 2598, 4 },
+	{ 522, 2602, 4 },
+	{ 523, 2606, 4 },
+	{ 524, 2610, 4 },
+	{ 525, 2614, 4 },
+	{ 526, 2618, 4 },
+	{ 527, 2622, 4 },
+	{ 528, 2626, 4 },
+	{ 529, 2630, 4 },
+	{ 530, 2634, 4 },
+	{ 531, 2638, 4 },
+	{ 532, 2642, 4 },
+	{ 533, 2646, 4 },
+	{ 534, 2650, 4 },
+	{ 535, 2654, 4 },
+	{ 536, 2658, 4 },
+	{ 537, 2662, 4 },
+	{ 538, 2666, 4 },
+	{ 539, 2670, 4 },
+	{ 540, 2674, 4 },
+	{ 541, 2678, 4 },
+	{ 542, 2682, 4 },
+	{ 543, 2686, 4 },
+	{ 544, 2690, 4 },
+	{ 545, 2694, 4 },
+	{ 546, 2698, 4 },
+	{ 547, 2702, 4 },
+	{ 548, 2706, 4 },
+	{ 549, 2710, 4 },
+	{ 550, 2714, 4 },
+	{ 551, 2718, 4 },
+	{ 552, 2722, 4 },
+	{ 553, 2726, 4 },
+	{ 554, 2730, 4 },
+	{ 555, 2734, 4 },
+	{ 556, 2738, 4 },
+	{ 557, 2742, 4 },
+	{ 558, 2746, 4 },
+	{ 559, 2750, 4 },
+	{ 560, 2754, 4 },
+	{ 561, 2758, 4 },
+	{ 562, 2762, 4 },
+	{ 563, 2766, 4 },
+	{ 564, 2770, 4 },
+	{ 565, 2774, 4 },
+	{ 566, 2778, 4 },
+	{ 567, 2782, 4 },
+	{ 568, 2786, 4 },
+	{ 569, 2790, 4 },
+	{ 570, 2794, 4 },
+	{ 571, 2798, 4 },
+	{ 572, 2802, 4 },
+	{ 573, 2806, 4 },
+	{ 574, 2810, 4 },
+	{ 575, 2814, 4 },
+	{ 576, 2818, 4 },
+	{ 577, 2822, 4 },
+	{ 578, 2826, 4 },
+	{ 579, 2830, 4 },
+	{ 580, 2834, 4 },
+	{ 581, 2838, 4 },
+	{ 582, 2842, 4 },
+	{ 583, 2846, 4 },
+	{ 584, 2850, 4 },
+	{ 585, 2854, 4 },
+	{ 586, 2858, 4 },
+	{ 587, 2862, 4 },
+	{ 588, 2866, 4 },
+	{ 589, 2870, 4 },
+	{ 590, 2874, 4 },
+	{ 591, 2878, 4 },
+	{ 592, 2882, 4 },
+	{ 593, 2886, 4 },
+	{ 594, 2890, 4 },
+	{ 595, 2894, 4 },
+	{ 596, 2898, 4 },
+	{ 597, 2902, 4 },
+	{ 598, 2906, 4 },
+	{ 599, 2910, 4 },
+	{ 600, 2914, 4 },
+	{ 601, 2918, 4 },
+	{ 602, 2922, 4 },
+	{ 603, 2926, 4 },
+	{ 604, 2930, 4 },
+	{ 605, 2934, 4 },
+	{ 606, 2938, 4 },
+	{ 607, 2942, 4 },
+	{ 608, 2946, 4 },
+	{ 609, 2950, 4 },
+	{ 610, 2954, 4 },
+	{ 611, 2958, 4 },
+	{ 612, 2962, 4 },
+	{ 613, 2966, 4 },
+	{ 614, 2970, 4 },
+	{ 615, 2974, 4 },
+	{ 616, 2978, 4 },
+	{ 617, 2982, 4 },
+	{ 618, 2986, 4 },
+	{ 619, 2990, 4 },
+	{ 620, 2994, 4 },
+	{ 621, 2998, 4 },
+	{ 622, 3002, 4 },
+	{ 623, 3006, 4 },
+	{ 624, 3010, 4 },
+	{ 625, 3014, 4 },
+	{ 626, 3018, 4 },
+	{ 627, 3022, 4 },
+	{ 628, 3026, 4 },
+	{ 629, 3030, 4 },
+	{ 630, 3034, 4 },
+	{ 631, 3038, 4 },
+	{ 632, 3042, 4 },
+	{ 633, 3046, 4 },
+	{ 634, 3050, 4 },
+	{ 635, 3054, 4 },
+	{ 636, 3058, 4 },
+	{ 637, 3062, 4 },
+	{ 638, 3066, 4 },
+	{ 639, 3070, 4 },
+	{ 640, 3074, 4 },
+	{ 641, 3078, 4 },
+	{ 642, 3082, 4 },
+	{ 643, 3086, 4 },
+	{ 644, 3090, 4 },
+	{ 645, 3094, 4 },
+	{ 646, 3098, 4 },
+	{ 647, 3102, 4 },
+	{ 648, 3106, 4 },
+	{ 649, 3110, 4 },
+	{ 650, 3114, 4 },
+	{ 651, 3118, 4 },
+	{ 652, 3122, 4 },
+	{ 653, 3126, 4 },
+	{ 654, 3130, 4 },
+	{ 655, 3134, 4 },
+	{ 656, 3138, 4 },
+	{ 657, 3142, 4 },
+	{ 658, 3146, 4 },
+	{ 659, 3150, 4 },
+	{ 660, 3154, 4 },
+	{ 661, 3158, 4 },
+	{ 662, 3162, 4 },
+	{ 663, 3166, 4 },
+	{ 664, 3170, 4 },
+	{ 665, 3174, 4 },
+	{ 666, 3178, 4 },
+	{ 667, 3182, 4 },
+	{ 668, 3186, 4 },
+	{ 669, 3190, 4 },
+	{ 670, 3194, 4 },
+	{ 671, 3198, 4 },
+	{ 672, 3202, 4 },
+	{ 673, 3206, 4 },
+	{ 674, 3210, 4 },
+	{ 675, 3214, 4 },
+	{ 676, 3218, 4 },
+	{ 677, 3222, 4 },
+	{ 678, 3226, 4 },
+	{ 679, 3230, 4 },
+	{ 680, 3234, 4 },
+	{ 681, 3238, 4 },
+	{ 682, 3242, 4 },
+	{ 683, 3246, 4 },
+	{ 684, 3250, 4 },
+	{ 685, 3254, 4 },
+	{ 686, 3258, 4 },
+	{ 687, 3262, 4 },
+	{ 688, 3266, 4 },
+	{ 689, 3270, 4 },
+	{ 690, 3274, 4 },
+	{ 691, 3278, 4 },
+	{ 692, 3282, 4 },
+	{ 693, 3286, 4 },
+	{ 694, 3290, 4 },
+	{ 695, 3294, 4 },
+	{ 696, 3298, 4 },
+	{ 697, 3302, 4 },
+	{ 698, 3306, 4 },
+	{ 699, 3310, 4 },
+	{ 700, 3314, 4 },
+	{ 701, 3318, 4 },
+	{ 702, 3322, 4 },
+	{ 703, 3326, 4 },
+	{ 704, 3330, 4 },
+	{ 705, 3334, 4 },
+	{ 706, 3338, 4 },
+	{ 707, 3342, 4 },
+	{ 708, 3346, 4 },
+	{ 709, 3350, 4 },
+	{ 710, 3354, 4 },
+	{ 711, 3358, 4 },
+	{ 712, 3362, 4 },
+	{ 713, 3366, 4 },
+	{ 714, 3370, 4 },
+	{ 715, 3374, 4 },
+	{ 716, 3378, 4 },
+	{ 717, 3382, 4 },
+	{ 718, 3386, 4 },
+	{ 719, 3390, 4 },
+	{ 720, 3394, 4 },
+	{ 721, 3398, 4 },
+	{ 722, 3402, 4 },
+	{ 723, 3406, 4 },
+	{ 724, 3410, 4 },
+	{ 725, 3414, 4 },
+	{ 726, 3418, 4 },
+	{ 727, 3422, 4 },
+	{ 728, 3426, 4 },
+	{ 729, 3430, 4 },
+	{ 730, 3434, 4 },
+	{ 731, 3438, 4 },
+	{ 732, 3442, 4 },
+	{ 733, 3446, 4 },
+	{ 734, 3450, 4 },
+	{ 735, 3454, 4 },
+	{ 736, 3458, 4 },
+	{ 737, 3462, 4 },
+	{ 738, 3466, 4 },
+	{ 739, 3470, 4 },
+	{ 740, 3474, 4 },
+	{ 741, 3478, 4 },
+	{ 742, 3482, 4 },
+	{ 743, 3486, 4 },
+	{ 744, 3490, 4 },
+	{ 745, 3494, 4 },
+	{ 746, 3498, 4 },
+	{ 747, 3502, 4 },
+	{ 748, 3506, 4 },
+	{ 749, 3510, 4 },
+	{ 750, 3514, 4 },
+	{ 751, 3518, 4 },
+	{ 752, 3522, 4 },
+	{ 753, 3526, 4 },
+	{ 754, 3530, 4 },
+	{ 755, 3534, 4 },
+	{ 756, 3538, 4 },
+	{ 757, 3542, 4 },
+	{ 758, 3546, 4 },
+	{ 759, 3550, 4 },
+	{ 760, 3554, 4 },
+	{ 761, 3558, 4 },
+	{ 762, 3562, 4 },
+	{ 763, 3566, 4 },
+	{ 764, 3570, 4 },
+	{ 765, 3574, 4 },
+	{ 766, 3578, 4 },
+	{ 767, 3582, 4 },
+	{ 768, 3586, 4 },
+	{ 769, 3590, 4 },
+	{ 770, 3594, 4 },
+	{ 771, 3598, 4 },
+	{ 772, 3602, 4 },
+	{ 773, 3606, 4 },
+	{ 774, 3610, 7 },
+	{ 775, 3617, 11 },
+	{ 776, 3628, 1 },
+	{ 777, 3629, 1 },
+	{ 778, 3630, 1 },
+	{ 779, 3631, 1 },
+	{ 780, 3632, 1 },
+	{ 781, 3633, 1 },
+	{ 782, 3634, 1 },
+	{ 783, 3635, 1 },
+	{ 784, 3636, 11 },
+	{ 785, 3647, 14 },
+	{ 786, 3661, 10 },
+	{ 787, 3671, 13 },
+	{ 788, 3684, 12 },
+	{ 807, 3696, 5 },
+	{ 808, 3701, 6 },
+	{ 809, 3707, 6 },
+	{ 810, 3713, 6 },
+	{ 811, 3719, 5 },
+	{ 812, 3724, 6 },
+	{ 813, 3730, 6 },
+	{ 814, 3736, 6 },
+	{ 815, 3742, 6 },
+	{ 816, 3748, 6 },
+	{ 817, 3754, 6 },
+	{ 823, 3760, 5 },
+	{ 824, 3765, 6 },
+	{ 825, 3771, 6 },
+	{ 826, 3777, 6 },
+	{ 827, 3783, 5 },
+	{ 828, 3788, 6 },
+	{ 829, 3794, 6 },
+	{ 830, 3800, 6 },
+	{ 831, 3806, 6 },
+	{ 832, 3812, 6 },
+	{ 833, 3818, 6 },
+	{ 839, 3824, 5 },
+	{ 840, 3829, 6 },
+	{ 841, 3835, 6 },
+	{ 842, 3841, 6 },
+	{ 843, 3847, 5 },
+	{ 844, 3852, 6 },
+	{ 845, 3858, 6 },
+	{ 846, 3864, 6 },
+	{ 847, 3870, 6 },
+	{ 848, 3876, 6 },
+	{ 849, 3882, 6 },
+	{ 871, 3888, 7 },
+	{ 872, 3895, 8 },
+	{ 873, 3903, 8 },
+	{ 874, 3911, 8 },
+	{ 875, 3919, 7 },
+	{ 876, 3926, 8 },
+	{ 877, 3934, 8 },
+	{ 878, 3942, 8 },
+	{ 879, 3950, 8 },
+	{ 880, 3958, 8 },
+	{ 881, 3966, 8 },
+	{ 887, 3974, 7 },
+	{ 888, 3981, 8 },
+	{ 889, 3989, 8 },
+	{ 890, 3997, 8 },
+	{ 891, 4005, 7 },
+	{ 892, 4012, 8 },
+	{ 893, 4020, 8 },
+	{ 894, 4028, 8 },
+	{ 895, 4036, 8 },
+	{ 896, 4044, 8 },
+	{ 897, 4052, 8 },
+	{ 903, 4060, 7 },
+	{ 904, 4067, 8 },
+	{ 905, 4075, 8 },
+	{ 906, 4083, 8 },
+	{ 907, 4096, 7 },
+	{ 908, 4103, 8 },
+	{ 909, 4111, 8 },
+	{ 910, 4119, 8 },
+	{ 911, 4127, 8 },
+	{ 912, 4135, 8 },
+	{ 913, 4143, 8 },
+	{ 935, 4151, 7 },
+	{ 936, 4158, 8 },
+	{ 937, 4166, 8 },
+	{ 938, 4174, 8 },
+	{ 939, 4182, 7 },
+	{ 940, 4189, 8 },
+	{ 941, 4197, 8 },
+	{ 942, 4205, 8 },
+	{ 943, 4213, 8 },
+	{ 944, 4221, 8 },
+	{ 945, 4229, 8 },
+	{ 951, 4237, 7 },
+	{ 952, 4244, 8 },
+	{ 953, 4252, 8 },
+	{ 954, 4260, 8 },
+	{ 955, 4268, 7 },
+	{ 956, 4275, 8 },
+	{ 957, 4283, 8 },
+	{ 958, 4291, 8 },
+	{ 959, 4299, 8 },
+	{ 960, 4307, 8 },
+	{ 961, 4315, 8 },
+	{ 967, 4323, 7 },
+	{ 968, 4330, 8 },
+	{ 969, 4338, 8 },
+	{ 970, 4346, 8 },
+	{ 971, 4354, 7 },
+	{ 972, 4361, 8 },
+	{ 973, 4369, 8 },
+	{ 974, 4377, 8 },
+	{ 975, 4385, 8 },
+	{ 976, 4393, 8 },
+	{ 977, 4401, 8 },
+	{ 999, 4409, 7 },
+	{ 1000, 4416, 8 },
+	{ 1001, 4424, 8 },
+	{ 1002, 4432, 8 },
+	{ 1003, 4440, 7 },
+	{ 1004, 4447, 8 },
+	{ 1005, 4455, 8 },
+	{ 1006, 4463, 8 },
+	{ 1007, 4471, 8 },
+	{ 1008, 4479, 8 },
+	{ 1009, 4487, 8 },
+	{ 1015, 4495, 7 },
+	{ 1016, 4502, 8 },
+	{ 1017, 4510, 8 },
+	{ 1018, 4518, 8 },
+	{ 1019, 4526, 7 },
+	{ 1020, 4533, 8 },
+	{ 1021, 4541, 8 },
+	{ 1022, 4549, 8 },
+	{ 1023, 4557, 8 },
+	{ 1024, 4565, 8 },
+	{ 1025, 4573, 8 },
+	{ 1031, 4581, 7 },
+	{ 1032, 4588, 8 },
+	{ 1033, 4596, 8 },
+	{ 1034, 4604, 8 },
+	{ 1035, 4612, 7 },
+	{ 1036, 4619, 8 },
+	{ 1037, 4627, 8 },
+	{ 1038, 4635, 8 },
+	{ 1039, 4643, 8 },
+	{ 1040, 4651, 8 },
+	{ 1041, 4659, 8 },
+	{ 1045, 4667, 8 },
+	{ 1046, 4675, 8 },
+	{ 1047, 4683, 8 },
+	{ 1048, 4691, 8 },
+	{ 1049, 4699, 16 },
+	{ 1050, 4715, 18 },
+	{ 1051, 4733, 16 },
+	{ 1052, 4749, 18 },
+	{ 1053, 4767, 16 },
+	{ 1054, 4783, 18 },
+	{ 1055, 4801, 15 },
+	{ 1056, 4816, 17 },
+	{ 1057, 4833, 15 },
+	{ 1058, 4848, 17 },
+	{ 1059, 4865, 13 },
+	{ 1060, 4878, 23 },
+	{ 1061, 4901, 29 },
+	{ 1062, 4930, 18 },
+	{ 1063, 4948, 24 },
+	{ 1064, 4972, 30 },
+	{ 1065, 5002, 19 },
+	{ 1066, 5021, 20 },
+	{ 1067, 5041, 15 },
+	{ 1068, 5056, 13 },
+	{ 1086, 5069, 10 },
+	{ 1087, 5079, 8 },
+	{ 1088, 5087, 9 },
+	{ 1089, 5096, 9 },
+	{ 1090, 5105, 9 },
+	{ 1091, 5114, 8 },
+	{ 1092, 5122, 9 },
+	{ 1093, 5131, 9 },
+	{ 1094, 5140, 9 },
+	{ 1095, 5149, 9 },
+	{ 1096, 5158, 9 },
+	{ 1097, 5167, 9 },
+	{ 1102, 5176, 10 },
+	{ 1103, 5186, 8 },
+	{ 1104, 5194, 9 },
+	{ 1105, 5203, 9 },
+	{ 1106, 5212, 9 },
+	{ 1107, 5221, 8 },
+	{ 1108, 5229, 9 },
+	{ 1109, 5238, 9 },
+	{ 1110, 5247, 9 },
+	{ 1111, 5256, 9 },
+	{ 1112, 5265, 9 },
+	{ 1113, 5274, 9 },
+	{ 1118, 5283, 10 },
+	{ 1119, 5293, 8 },
+	{ 1120, 5301, 9 },
+	{ 1121, 5310, 9 },
+	{ 1122, 5319, 9 },
+	{ 1123, 5328, 8 },
+	{ 1124, 5336, 9 },
+	{ 1125, 5345, 9 },
+	{ 1126, 5354, 9 },
+	{ 1127, 5363, 9 },
+	{ 1128, 5372, 9 },
+	{ 1129, 5381, 9 },
+	{ 2110, 5390, 10 },
+	{ 2111, 5400, 8 },
+	{ 2112, 5408, 9 },
+	{ 2113, 5417, 9 },
+	{ 2114, 5426, 9 },
+	{ 2115, 5435, 8 },
+	{ 2116, 5443, 9 },
+	{ 2117, 5452, 9 },
+	{ 2118, 5461, 9 },
+	{ 2119, 5470, 9 },
+	{ 2120, 5479, 9 },
+	{ 2121, 5488, 9 },
+	{ 2126, 5497, 10 },
+	{ 2127, 5507, 8 },
+	{ 2128, 5515, 9 },
+	{ 2129, 5524, 9 },
+	{ 2130, 5533, 9 },
+	{ 2131, 5542, 8 },
+	{ 2132, 5550, 9 },
+	{ 2133, 5559, 9 },
+	{ 2134, 5568, 9 },
+	{ 2135, 5577, 9 },
+	{ 2136, 5586, 9 },
+	{ 2137, 5595, 9 },
+	{ 2142, 5604, 10 },
+	{ 2143, 5614, 8 },
+	{ 2144, 5622, 9 },
+	{ 2145, 5631, 9 },
+	{ 2146, 5640, 9 },
+	{ 2147, 5649, 8 },
+	{ 2148, 5657, 9 },
+	{ 2149, 5666, 9 },
+	{ 2150, 5675, 9 },
+	{ 2151, 5684, 9 },
+	{ 2152, 5693, 9 },
+	{ 2153, 5702, 9 },
+	{ 3119, 5711, 6 },
+	{ 3120, 5717, 7 },
+	{ 3121, 5724, 7 },
+	{ 3122, 5731, 7 },
+	{ 3123, 5738, 6 },
+	{ 3124, 5744, 7 },
+	{ 3125, 5751, 7 },
+	{ 3126, 5758, 7 },
+	{ 3127, 5765, 7 },
+	{ 3128, 5772, 7 },
+	{ 3129, 5779, 7 },
+	{ 3135, 5786, 8 },
+	{ 3136, 5794, 9 },
+	{ 3137, 5803, 9 },
+	{ 3138, 5812, 9 },
+	{ 3139, 5821, 8 },
+	{ 3140, 5829, 9 },
+	{ 3141, 5838, 9 },
+	{ 3142, 5847, 9 },
+	{ 3143, 5856, 9 },
+	{ 3144, 5865, 9 },
+	{ 3145, 5874, 9 },
+	{ 3151, 5883, 8 },
+	{ 3152, 5891, 9 },
+	{ 3153, 5900, 9 },
+	{ 3154, 5909, 9 },
+	{ 3155, 5918, 8 },
+	{ 3156, 5926, 9 },
+	{ 3157, 5935, 9 },
+	{ 3158, 5944, 9 },
+	{ 3159, 5953, 9 },
+	{ 3160, 5962, 9 },
+	{ 3161, 5971, 9 },
+	{ 3167, 5980, 8 },
+	{ 3168, 5988, 9 },
+	{ 3169, 5997, 9 },
+	{ 3170, 6006, 9 },
+	{ 3171, 6015, 8 },
+	{ 3172, 6023, 9 },
+	{ 3173, 6032, 9 },
+	{ 3174, 6041, 9 },
+	{ 3175, 6050, 9 },
+	{ 3176, 6059, 9 },
+	{ 3177, 6068, 9 },
+	{ 4143, 6077, 6 },
+	{ 4144, 6083, 7 },
+	{ 4145, 6090, 7 },
+	{ 4146, 6097, 7 },
+	{ 4147, 6104, 6 },
+	{ 4148, 6110, 7 },
+	{ 4149, 6117, 7 },
+	{ 4150, 6124, 7 },
+	{ 4151, 6131, 7 },
+	{ 4152, 6138, 7 },
+	{ 4153, 6145, 7 },
+	{ 4159, 6152, 8 },
+	{ 4160, 6160, 9 },
+	{ 4161, 6169, 9 },
+	{ 4162, 6178, 9 },
+	{ 4163, 6187, 8 },
+	{ 4164, 6195, 9 },
+	{ 4165, 6204, 9 },
+	{ 4166, 6213, 9 },
+	{ 4167, 6222, 9 },
+	{ 4168, 6231, 9 },
+	{ 4169, 6240, 9 },
+	{ 4175, 6249, 8 },
+	{ 4176, 6257, 9 },
+	{ 4177, 6266, 9 },
+	{ 4178, 6275, 9 },
+	{ 4179, 6284, 8 },
+	{ 4180, 6292, 9 },
+	{ 4181, 6301, 9 },
+	{ 4182, 6310, 9 },
+	{ 4183, 6319, 9 },
+	{ 4184, 6328, 9 },
+	{ 4185, 6337, 9 },
+	{ 4191, 6346, 8 },
+	{ 4192, 6354, 9 },
+	{ 4193, 6363, 9 },
+	{ 4194, 6372, 9 },
+	{ 4195, 6381, 8 },
+	{ 4196, 6389, 9 },
+	{ 4197, 6398, 9 },
+	{ 4198, 6407, 9 },
+	{ 4199, 6416, 9 },
+	{ 4200, 6425, 9 },
+	{ 4201, 6434, 9 },
+	{ 5167, 6443, 6 },
+	{ 5168, 6449, 7 },
+	{ 5169, 6456, 7 },
+	{ 5170, 6463, 7 },
+	{ 5171, 6470, 6 },
+	{ 5172, 6476, 7 },
+	{ 5173, 6483, 7 },
+	{ 5174, 6490, 7 },
+	{ 5175, 6497, 7 },
+	{ 5176, 6504, 7 },
+	{ 5177, 6511, 7 },
+	{ 5183, 6518, 8 },
+	{ 5184, 6526, 9 },
+	{ 5185, 6535, 9 },
+	{ 5186, 6544, 9 },
+	{ 5187, 6553, 8 },
+	{ 5188, 6561, 9 },
+	{ 5189, 6570, 9 },
+	{ 5190, 6579, 9 },
+	{ 5191, 6588, 9 },
+	{ 5192, 6597, 9 },
+	{ 5193, 6606, 9 },
+	{ 5199, 6615, 8 },
+	{ 5200, 6623, 9 },
+	{ 5201, 6632, 9 },
+	{ 5202, 6641, 9 },
+	{ 5203, 6650, 8 },
+	{ 5204, 6658, 9 },
+	{ 5205, 6667, 9 },
+	{ 5206, 6676, 9 },
+	{ 5207, 6685, 9 },
+	{ 5208, 6694, 9 },
+	{ 5209, 6703, 9 },
+	{ 5215, 6712, 8 },
+	{ 5216, 6720, 9 },
+	{ 5217, 6729, 9 },
+	{ 5218, 6738, 9 },
+	{ 5219, 6747, 8 },
+	{ 5220, 6755, 9 },
+	{ 5221, 6764, 9 },
+	{ 5222, 6773, 9 },
+	{ 5223, 6782, 9 },
+	{ 5224, 6791, 9 },
+	{ 5225, 6800, 9 },
+	{ 6191, 6809, 6 },
+	{ 6192, 6815, 7 },
+	{ 6193, 6822, 7 },
+	{ 6194, 6829, 7 },
+	{ 6195, 6836, 6 },
+	{ 6196, 6842, 7 },
+	{ 6197, 6849, 7 },
+	{ 6198, 6856, 7 },
+	{ 6199, 6863, 7 },
+	{ 6200, 6870, 7 },
+	{ 6201, 6877, 7 },
+	{ 6207, 6884, 8 },
+	{ 6208, 6892, 9 },
+	{ 6209, 6901, 9 },
+	{ 6210, 6910, 9 },
+	{ 6211, 6919, 8 },
+	{ 6212, 6927, 9 },
+	{ 6213, 6936, 9 },
+	{ 6214, 6945, 9 },
+	{ 6215, 6954, 9 },
+	{ 6216, 6963, 9 },
+	{ 6217, 6972, 9 },
+	{ 6223, 6981, 8 },
+	{ 6224, 6989, 9 },
+	{ 6225, 6998, 9 },
+	{ 6226, 7007, 9 },
+	{ 6227, 7016, 8 },
+	{ 6228, 7024, 9 },
+	{ 6229, 7033, 9 },
+	{ 6230, 7042, 9 },
+	{ 6231, 7051, 9 },
+	{ 6232, 7060, 9 },
+	{ 6233, 7069, 9 },
+	{ 6239, 7078, 8 },
+	{ 6240, 7086, 9 },
+	{ 6241, 7095, 9 },
+	{ 6242, 7104, 9 },
+	{ 6243, 7113, 8 },
+	{ 6244, 7121, 9 },
+	{ 6245, 7130, 9 },
+	{ 6246, 7139, 9 },
+	{ 6247, 7148, 9 },
+	{ 6248, 7157, 9 },
+	{ 6249, 7166, 9 },
+	{ 7215, 7175, 6 },
+	{ 7216, 7181, 7 },
+	{ 7217, 7188, 7 },
+	{ 7218, 7195, 7 },
+	{ 7219, 7202, 6 },
+	{ 7220, 7208, 7 },
+	{ 7221, 7215, 7 },
+	{ 7222, 7222, 7 },
+	{ 7223, 7229, 7 },
+	{ 7224, 7236, 7 },
+	{ 7225, 7243, 7 },
+	{ 7231, 7250, 8 },
+	{ 7232, 7258, 9 },
+	{ 7233, 7267, 9 },
+	{ 7234, 7276, 9 },
+	{ 7235, 7285, 8 },
+	{ 7236, 7293, 9 },
+	{ 7237, 7302, 9 },
+	{ 7238, 7311, 9 },
+	{ 7239, 7320, 9 },
+	{ 7240, 7329, 9 },
+	{ 7241, 7338, 9 },
+	{ 7247, 7347, 8 },
+	{ 7248, 7355, 9 },
+	{ 7249, 7364, 9 },
+	{ 7250, 7373, 9 },
+	{ 7251, 7382, 8 },
+	{ 7252, 7390, 9 },
+	{ 7253, 7399, 9 },
+	{ 7254, 7408, 9 },
+	{ 7255, 7417, 9 },
+	{ 7256, 7426, 9 },
+	{ 7257, 7435, 9 },
+	{ 7263, 7444, 8 },
+	{ 7264, 7452, 9 },
+	{ 7265, 7461, 9 },
+	{ 7266, 7470, 9 },
+	{ 7267, 7479, 8 },
+	{ 7268, 7487, 9 },
+	{ 7269, 7496, 9 },
+	{ 7270, 7505, 9 },
+	{ 7271, 7514, 9 },
+	{ 7272, 7523, 9 },
+	{ 7273, 7532, 9 },
+	{ 8239, 7541, 5 },
+	{ 8240, 7546, 6 },
+	{ 8241, 7552, 6 },
+	{ 8242, 7558, 6 },
+	{ 8243, 7564, 5 },
+	{ 8244, 7569, 6 },
+	{ 8245, 7575, 6 },
+	{ 8246, 7581, 6 },
+	{ 8247, 7587, 6 },
+	{ 8248, 7593, 6 },
+	{ 8249, 7599, 6 },
+	{ 8255, 7605, 7 },
+	{ 8256, 7612, 8 },
+	{ 8257, 7620, 8 },
+	{ 8258, 7628, 8 },
+	{ 8259, 7636, 7 },
+	{ 8260, 7643, 8 },
+	{ 8261, 7651, 8 },
+	{ 8262, 7659, 8 },
+	{ 8263, 7667, 8 },
+	{ 8264, 7675, 8 },
+	{ 8265, 7683, 8 },
+	{ 8271, 7691, 7 },
+	{ 8272, 7698, 8 },
+	{ 8273, 7706, 8 },
+	{ 8274, 7714, 8 },
+	{ 8275, 7722, 7 },
+	{ 8276, 7729, 8 },
+	{ 8277, 7737, 8 },
+	{ 8278, 7745, 8 },
+	{ 8279, 7753, 8 },
+	{ 8280, 7761, 8 },
+	{ 8281, 7769, 8 },
+	{ 8287, 7777, 7 },
+	{ 8288, 7784, 8 },
+	{ 8289, 7792, 8 },
+	{ 8290, 7800, 8 },
+	{ 8291, 7808, 7 },
+	{ 8292, 7815, 8 },
+	{ 8293, 7823, 8 },
+	{ 8294, 7831, 8 },
+	{ 8295, 7839, 8 },
+	{ 8296, 7847, 8 },
+	{ 8297, 7855, 8 },
+	{ 9263, 7863, 6 },
+	{ 9264, 7869, 7 },
+	{ 9265, 7876, 7 },
+	{ 9266, 7883, 7 },
+	{ 9267, 7890, 6 },
+	{ 9268, 7896, 7 },
+	{ 9269, 7903, 7 },
+	{ 9270, 7910, 7 },
+	{ 9271, 7917, 7 },
+	{ 9272, 7924, 7 },
+	{ 9273, 7931, 7 },
+	{ 9279, 7938, 8 },
+	{ 9280, 7946, 9 },
+	{ 9281, 7955, 9 },
+	{ 9282, 7964, 9 },
+	{ 9283, 7973, 8 },
+	{ 9284, 7981, 9 },
+	{ 9285, 7990, 9 },
+	{ 9286, 7999, 9 },
+	{ 9287, 8008, 9 },
+	{ 9288, 8017, 9 },
+	{ 9289, 8026, 9 },
+	{ 9295, 8035, 8 },
+	{ 9296, 8043, 9 },
+	{ 9297, 8052, 9 },
+	{ 9298, 8061, 9 },
+	{ 9299, 8070, 8 },
+	{ 9300, 8078, 9 },
+	{ 9301, 8087, 9 },
+	{ 9302, 8096, 9 },
+	{ 9303, 8105, 9 },
+	{ 9304, 8114, 9 },
+	{ 9305, 8123, 9 },
+	{ 9311, 8132, 8 },
+	{ 9312, 8140, 9 },
+	{ 9313, 8149, 9 },
+	{ 9314, 8158, 9 },
+	{ 9315, 8167, 8 },
+	{ 9316, 8175, 9 },
+	{ 9317, 8192, 9 },
+	{ 9318, 8201, 9 },
+	{ 9319, 8210, 9 },
+	{ 9320, 8219, 9 },
+	{ 9321, 8228, 9 },
+	{ 10287, 8237, 5 },
+	{ 10288, 8242, 6 },
+	{ 10289, 8248, 6 },
+	{ 10290, 8254, 6 },
+	{ 10291, 8260, 5 },
+	{ 10292, 8265, 6 },
+	{ 10293, 8271, 6 },
+	{ 10294, 8277, 6 },
+	{ 10295, 8283, 6 },
+	{ 10296, 8289, 6 },
+	{ 10297, 8295, 6 },
+	{ 10303, 8301, 7 },
+	{ 10304, 8308, 8 },
+	{ 10305, 8316, 8 },
+	{ 10306, 8324, 8 },
+	{ 10307, 8332, 7 },
+	{ 10308, 8339, 8 },
+	{ 10309, 8347, 8 },
+	{ 10310, 8355, 8 },
+	{ 10311, 8363, 8 },
+	{ 10312, 8371, 8 },
+	{ 10313, 8379, 8 },
+	{ 10319, 8387, 7 },
+	{ 10320, 8394, 8 },
+	{ 10321, 8402, 8 },
+	{ 10322, 8410, 8 },
+	{ 10323, 8418, 7 },
+	{ 10324, 8425, 8 },
+	{ 10325, 8433, 8 },
+	{ 10326, 8441, 8 },
+	{ 10327, 8449, 8 },
+	{ 10328, 8457, 8 },
+	{ 10329, 8465, 8 },
+	{ 10335, 8473, 7 },
+	{ 10336, 8480, 8 },
+	{ 10337, 8488, 8 },
+	{ 10338, 8496, 8 },
+	{ 10339, 8504, 7 },
+	{ 10340, 8511, 8 },
+	{ 10341, 8519, 8 },
+	{ 10342, 8527, 8 },
+	{ 10343, 8535, 8 },
+	{ 10344, 8543, 8 },
+	{ 10345, 8551, 8 },
+	{ 11311, 8559, 7 },
+	{ 11312, 8566, 8 },
+	{ 11313, 8574, 8 },
+	{ 11314, 8582, 8 },
+	{ 11315, 8590, 7 },
+	{ 11316, 8597, 8 },
+	{ 11317, 8605, 8 },
+	{ 11318, 8613, 8 },
+	{ 11319, 8621, 8 },
+	{ 11320, 8629, 8 },
+	{ 11321, 8637, 8 },
+	{ 11327, 8645, 9 },
+	{ 11328, 8654, 10 },
+	{ 11329, 8664, 10 },
+	{ 11330, 8674, 10 },
+	{ 11331, 8684, 9 },
+	{ 11332, 8693, 10 },
+	{ 11333, 8703, 10 },
+	{ 11334, 8713, 10 },
+	{ 11335, 8723, 10 },
+	{ 11336, 8733, 10 },
+	{ 11337, 8743, 10 },
+	{ 11343, 8753, 9 },
+	{ 11344, 8762, 10 },
+	{ 11345, 8772, 10 },
+	{ 11346, 8782, 10 },
+	{ 11347, 8792, 9 },
+	{ 11348, 8801, 10 },
+	{ 11349, 8811, 10 },
+	{ 11350, 8821, 10 },
+	{ 11351, 8831, 10 },
+	{ 11352, 8841, 10 },
+	{ 11353, 8851, 10 },
+	{ 11359, 8861, 9 },
+	{ 11360, 8870, 10 },
+	{ 11361, 8880, 10 },
+	{ 11362, 8890, 10 },
+	{ 11363, 8900, 9 },
+	{ 11364, 8909, 10 },
+	{ 11365, 8919, 10 },
+	{ 11366, 8929, 10 },
+	{ 11367, 8939, 10 },
+	{ 11368, 8949, 10 },
+	{ 11369, 8959, 10 },
+	{ 12335, 8969, 5 },
+	{ 12336, 8974, 6 },
+	{ 12337, 8980, 6 },
+	{ 12338, 8986, 6 },
+	{ 12339, 8992, 5 },
+	{ 12340, 8997, 6 },
+	{ 12341, 9003, 6 },
+	{ 12342, 9009, 6 },
+	{ 12343, 9015, 6 },
+	{ 12344, 9021, 6 },
+	{ 12345, 9027, 6 },
+	{ 12351, 9033, 7 },
+	{ 12352, 9040, 8 },
+	{ 12353, 9048, 8 },
+	{ 12354, 9056, 8 },
+	{ 12355, 9064, 7 },
+	{ 12356, 9071, 8 },
+	{ 12357, 9079, 8 },
+	{ 12358, 9087, 8 },
+	{ 12359, 9095, 8 },
+	{ 12360, 9103, 8 },
+	{ 12361, 9111, 8 },
+	{ 12367, 9119, 7 },
+	{ 12368, 9126, 8 },
+	{ 12369, 9134, 8 },
+	{ 12370, 9142, 8 },
+	{ 12371, 9150, 7 },
+	{ 12372, 9157, 8 },
+	{ 12373, 9165, 8 },
+	{ 12374, 9173, 8 },
+	{ 12375, 9181, 8 },
+	{ 12376, 9189, 8 },
+	{ 12377, 9197, 8 },
+	{ 12383, 9205, 7 },
+	{ 12384, 9212, 8 },
+	{ 12385, 9220, 8 },
+	{ 12386, 9228, 8 },
+	{ 12387, 9236, 7 },
+	{ 12388, 9243, 8 },
+	{ 12389, 9251, 8 },
+	{ 12390, 9259, 8 },
+	{ 12391, 9267, 8 },
+	{ 12392, 9275, 8 },
+	{ 12393, 9283, 8 },
+	{ 13359, 9291, 7 },
+	{ 13360, 9298, 8 },
+	{ 13361, 9306, 8 },
+	{ 13362, 9314, 8 },
+	{ 13363, 9322, 7 },
+	{ 13364, 9329, 8 },
+	{ 13365, 9337, 8 },
+	{ 13366, 9345, 8 },
+	{ 13367, 9353, 8 },
+	{ 13368, 9361, 8 },
+	{ 13369, 9369, 8 },
+	{ 13375, 9377, 9 },
+	{ 13376, 9386, 10 },
+	{ 13377, 9396, 10 },
+	{ 13378, 9406, 10 },
+	{ 13379, 9416, 9 },
+	{ 13380, 9425, 10 },
+	{ 13381, 9435, 10 },
+	{ 13382, 9445, 10 },
+	{ 13383, 9455, 10 },
+	{ 13384, 9465, 10 },
+	{ 13385, 9475, 10 },
+	{ 13391, 9485, 9 },
+	{ 13392, 9494, 10 },
+	{ 13393, 9504, 10 },
+	{ 13394, 9514, 10 },
+	{ 13395, 9524, 9 },
+	{ 13396, 9533, 10 },
+	{ 13397, 9543, 10 },
+	{ 13398, 9553, 10 },
+	{ 13399, 9563, 10 },
+	{ 13400, 9573, 10 },
+	{ 13401, 9583, 10 },
+	{ 13407, 9593, 9 },
+	{ 13408, 9602, 10 },
+	{ 13409, 9612, 10 },
+	{ 13410, 9622, 10 },
+	{ 13411, 9632, 9 },
+	{ 13412, 9641, 10 },
+	{ 13413, 9651, 10 },
+	{ 13414, 9661, 10 },
+	{ 13415, 9671, 10 },
+	{ 13416, 9681, 10 },
+	{ 13417, 9691, 10 },
+	{ 14382, 9701, 8 },
+	{ 14383, 9709, 6 },
+	{ 14384, 9715, 7 },
+	{ 14385, 9722, 7 },
+	{ 14386, 9729, 7 },
+	{ 14387, 9736, 6 },
+	{ 14388, 9742, 7 },
+	{ 14389, 9749, 7 },
+	{ 14390, 9756, 7 },
+	{ 14391, 9763, 7 },
+	{ 14392, 9770, 7 },
+	{ 14393, 9777, 7 },
+	{ 14398, 9784, 10 },
+	{ 14399, 9794, 8 },
+	{ 14400, 9802, 9 },
+	{ 14401, 9811, 9 },
+	{ 14402, 9820, 9 },
+	{ 14403, 9829, 8 },
+	{ 14404, 9837, 9 },
+	{ 14405, 9846, 9 },
+	{ 14406, 9855, 9 },
+	{ 14407, 9864, 9 },
+	{ 14408, 9873, 9 },
+	{ 14409, 9882, 9 },
+	{ 14414, 9891, 10 },
+	{ 14415, 9901, 8 },
+	{ 14416, 9909, 9 },
+	{ 14417, 9918, 9 },
+	{ 14418, 9927, 9 },
+	{ 14419, 9936, 8 },
+	{ 14420, 9944, 9 },
+	{ 14421, 9953, 9 },
+	{ 14422, 9962, 9 },
+	{ 14423, 9971, 9 },
+	{ 14424, 9980, 9 },
+	{ 14425, 9989, 9 },
+	{ 14430, 9998, 10 },
+	{ 14431, 10008, 8 },
+	{ 14432, 10016, 9 },
+	{ 14433, 10025, 9 },
+	{ 14434, 10034, 9 },
+	{ 14435, 10043, 8 },
+	{ 14436, 10051, 9 },
+	{ 14437, 10060, 9 },
+	{ 14438, 10069, 9 },
+	{ 14439, 10078, 9 },
+	{ 14440, 10087, 9 },
+	{ 14441, 10096, 9 },
+	{ 15407, 10105, 6 },
+	{ 15408, 10111, 7 },
+	{ 15409, 10118, 7 },
+	{ 15410, 10125, 7 },
+	{ 15411, 10132, 6 },
+	{ 15412, 10138, 7 },
+	{ 15413, 10145, 7 },
+	{ 15414, 10152, 7 },
+	{ 15415, 10159, 7 },
+	{ 15416, 10166, 7 },
+	{ 15417, 10173, 7 },
+	{ 15423, 10180, 8 },
+	{ 15424, 10188, 9 },
+	{ 15425, 10197, 9 },
+	{ 15426, 10206, 9 },
+	{ 15427, 10215, 8 },
+	{ 15428, 10223, 9 },
+	{ 15429, 10232, 9 },
+	{ 15430, 10241, 9 },
+	{ 15431, 10250, 9 },
+	{ 15432, 10259, 9 },
+	{ 15433, 10268, 9 },
+	{ 15439, 10277, 8 },
+	{ 15440, 10285, 9 },
+	{ 15441, 10294, 9 },
+	{ 15442, 10303, 9 },
+	{ 15443, 10312, 8 },
+	{ 15444, 10320, 9 },
+	{ 15445, 10329, 9 },
+	{ 15446, 10338, 9 },
+	{ 15447, 10347, 9 },
+	{ 15448, 10356, 9 },
+	{ 15449, 10365, 9 },
+	{ 15455, 10374, 8 },
+	{ 15456, 10382, 9 },
+	{ 15457, 10391, 9 },
+	{ 15458, 10400, 9 },
+	{ 15459, 10409, 8 },
+	{ 15460, 10417, 9 },
+	{ 15461, 10426, 9 },
+	{ 15462, 10435, 9 },
+	{ 15463, 10444, 9 },
+	{ 15464, 10453, 9 },
+	{ 15465, 10462, 9 },
+	{ 16431, 10471, 9 },
+	{ 16432, 10480, 10 },
+	{ 16433, 10490, 10 },
+	{ 16434, 10500, 10 },
+	{ 16435, 10510, 9 },
+	{ 16436, 10519, 10 },
+	{ 16437, 10529, 10 },
+	{ 16438, 10539, 10 },
+	{ 16447, 10549, 11 },
+	{ 16448, 10560, 12 },
+	{ 16449, 10572, 12 },
+	{ 16450, 10584, 12 },
+	{ 16451, 10596, 11 },
+	{ 16452, 10607, 12 },
+	{ 16453, 10619, 12 },
+	{ 16454, 10631, 12 },
+	{ 16463, 10643, 11 },
+	{ 16464, 10654, 12 },
+	{ 16465, 10666, 12 },
+	{ 16466, 10678, 12 },
+	{ 16467, 10690, 11 },
+	{ 16468, 10701, 12 },
+	{ 16469, 10713, 12 },
+	{ 16470, 10725, 12 },
+	{ 16479, 10737, 11 },
+	{ 16480, 10748, 12 },
+	{ 16481, 10760, 12 },
+	{ 16482, 10772, 12 },
+	{ 16483, 10784, 11 },
+	{ 16484, 10795, 12 },
+	{ 16485, 10807, 12 },
+	{ 16486, 10819, 12 },
+	{ 17455, 10831, 6 },
+	{ 17456, 10837, 7 },
+	{ 17457, 10844, 7 },
+	{ 17458, 10851, 7 },
+	{ 17459, 10858, 6 },
+	{ 17460, 10864, 7 },
+	{ 17461, 10871, 7 },
+	{ 17462, 10878, 7 },
+	{ 17463, 10885, 7 },
+	{ 17464, 10892, 7 },
+	{ 17465, 10899, 7 },
+	{ 17471, 10906, 8 },
+	{ 17472, 10914, 9 },
+	{ 17473, 10923, 9 },
+	{ 17474, 10932, 9 },
+	{ 17475, 10941, 8 },
+	{ 17476, 10949, 9 },
+	{ 17477, 10958, 9 },
+	{ 17478, 10967, 9 },
+	{ 17479, 10976, 9 },
+	{ 17480, 10985, 9 },
+	{ 17481, 10994, 9 },
+	{ 17487, 11003, 8 },
+	{ 17488, 11011, 9 },
+	{ 17489, 11020, 9 },
+	{ 17490, 11029, 9 },
+	{ 17491, 11038, 8 },
+	{ 17492, 11046, 9 },
+	{ 17493, 11055, 9 },
+	{ 17494, 11064, 9 },
+	{ 17495, 11073, 9 },
+	{ 17496, 11082, 9 },
+	{ 17497, 11091, 9 },
+	{ 17503, 11100, 8 },
+	{ 17504, 11108, 9 },
+	{ 17505, 11117, 9 },
+	{ 17506, 11126, 9 },
+	{ 17507, 11135, 8 },
+	{ 17508, 11143, 9 },
+	{ 17509, 11152, 9 },
+	{ 17510, 11161, 9 },
+	{ 17511, 11170, 9 },
+	{ 17512, 11179, 9 },
+	{ 17513, 11188, 9 },
+	{ 18479, 11197, 6 },
+	{ 18480, 11203, 7 },
+	{ 18481, 11210, 7 },
+	{ 18482, 11217, 7 },
+	{ 18483, 11224, 6 },
+	{ 18484, 11230, 7 },
+	{ 18485, 11237, 7 },
+	{ 18486, 11244, 7 },
+	{ 18487, 11251, 7 },
+	{ 18488, 11258, 7 },
+	{ 18489, 11265, 7 },
+	{ 18495, 11272, 8 },
+	{ 18496, 11280, 9 },
+	{ 18497, 11289, 9 },
+	{ 18498, 11298, 9 },
+	{ 18499, 11307, 8 },
+	{ 18500, 11315, 9 },
+	{ 18501, 11324, 9 },
+	{ 18502, 11333, 9 },
+	{ 18503, 11342, 9 },
+	{ 18504, 11351, 9 },
+	{ 18505, 11360, 9 },
+	{ 18511, 11369, 8 },
+	{ 18512, 11377, 9 },
+	{ 18513, 11386, 9 },
+	{ 18514, 11395, 9 },
+	{ 18515, 11404, 8 },
+	{ 18516, 11412, 9 },
+	{ 18517, 11421, 9 },
+	{ 18518, 11430, 9 },
+	{ 18519, 11439, 9 },
+	{ 18520, 11448, 9 },
+	{ 18521, 11457, 9 },
+	{ 18527, 11466, 8 },
+	{ 18528, 11474, 9 },
+	{ 18529, 11483, 9 },
+	{ 18530, 11492, 9 },
+	{ 18531, 11501, 8 },
+	{ 18532, 11509, 9 },
+	{ 18533, 11518, 9 },
+	{ 18534, 11527, 9 },
+	{ 18535, 11536, 9 },
+	{ 18536, 11545, 9 },
+	{ 18537, 11554, 9 },
+	{ 19503, 11563, 8 },
+	{ 19504, 11571, 9 },
+	{ 19505, 11580, 9 },
+	{ 19506, 11589, 9 },
+	{ 19507, 11598, 8 },
+	{ 19508, 11606, 9 },
+	{ 19509, 11615, 9 },
+	{ 19510, 11624, 9 },
+	{ 19511, 11633, 9 },
+	{ 19512, 11642, 9 },
+	{ 19513, 11651, 9 },
+	{ 19519, 11660, 10 },
+	{ 19520, 11670, 11 },
+	{ 19521, 11681, 11 },
+	{ 19522, 11692, 11 },
+	{ 19523, 11703, 10 },
+	{ 19524, 11713, 11 },
+	{ 19525, 11724, 11 },
+	{ 19526, 11735, 11 },
+	{ 19527, 11746, 11 },
+	{ 19528, 11757, 11 },
+	{ 19529, 11768, 11 },
+	{ 19535, 11779, 10 },
+	{ 19536, 11789, 11 },
+	{ 19537, 11800, 11 },
+	{ 19538, 11811, 11 },
+	{ 19539, 11822, 10 },
+	{ 19540, 11832, 11 },
+	{ 19541, 11843, 11 },
+	{ 19542, 11854, 11 },
+	{ 19543, 11865, 11 },
+	{ 19544, 11876, 11 },
+	{ 19545, 11887, 11 },
+	{ 19551, 11898, 10 },
+	{ 19552, 11908, 11 },
+	{ 19553, 11919, 11 },
+	{ 19554, 11930, 11 },
+	{ 19555, 11941, 10 },
+	{ 19556, 11951, 11 },
+	{ 19557, 11962, 11 },
+	{ 19558, 11973, 11 },
+	{ 19559, 11984, 11 },
+	{ 19560, 11995, 11 },
+	{ 19561, 12006, 11 },
+	{ 20527, 12017, 7 },
+	{ 20528, 12024, 8 },
+	{ 20529, 12032, 8 },
+	{ 20530, 12040, 8 },
+	{ 20535, 12048, 8 },
+	{ 20536, 12056, 8 },
+	{ 20537, 12064, 8 },
+	{ 20543, 12072, 9 },
+	{ 20544, 12081, 10 },
+	{ 20545, 12091, 10 },
+	{ 20546, 12101, 10 },
+	{ 20551, 12111, 10 },
+	{ 20552, 12121, 10 },
+	{ 20553, 12131, 10 },
+	{ 20559, 12141, 9 },
+	{ 20560, 12150, 10 },
+	{ 20561, 12160, 10 },
+	{ 20562, 12170, 10 },
+	{ 20567, 12180, 10 },
+	{ 20568, 12190, 10 },
+	{ 20569, 12200, 10 },
+	{ 20575, 12210, 9 },
+	{ 20576, 12219, 10 },
+	{ 20577, 12229, 10 },
+	{ 20578, 12239, 10 },
+	{ 20583, 12249, 10 },
+	{ 20584, 12259, 10 },
+	{ 20585, 12269, 10 },
+	{ 21551, 12279, 6 },
+	{ 21552, 12288, 7 },
+	{ 21553, 12295, 7 },
+	{ 21554, 12302, 7 },
+	{ 21559, 12309, 7 },
+	{ 21560, 12316, 7 },
+	{ 21561, 12323, 7 },
+	{ 21567, 12330, 8 },
+	{ 21568, 12338, 9 },
+	{ 21569, 12347, 9 },
+	{ 21570, 12356, 9 },
+	{ 21575, 12365, 9 },
+	{ 21576, 12374, 9 },
+	{ 21577, 12383, 9 },
+	{ 21583, 12392, 8 },
+	{ 21584, 12400, 9 },
+	{ 21585, 12409, 9 },
+	{ 21586, 12418, 9 },
+	{ 21591, 12427, 9 },
+	{ 21592, 12436, 9 },
+	{ 21593, 12445, 9 },
+	{ 21599, 12454, 8 },
+	{ 21600, 12462, 9 },
+	{ 21601, 12471, 9 },
+	{ 21602, 12480, 9 },
+	{ 21607, 12489, 9 },
+	{ 21608, 12498, 9 },
+	{ 21609, 12507, 9 },
+	{ 22575, 12516, 9 },
+	{ 22576, 12525, 10 },
+	{ 22577, 12535, 10 },
+	{ 22578, 12545, 10 },
+	{ 22579, 12555, 9 },
+	{ 22580, 12564, 10 },
+	{ 22581, 12574, 10 },
+	{ 22582, 12584, 10 },
+	{ 22591, 12594, 11 },
+	{ 22592, 12605, 12 },
+	{ 22593, 12617, 12 },
+	{ 22594, 12629, 12 },
+	{ 22595, 12641, 11 },
+	{ 22596, 12652, 12 },
+	{ 22597, 12664, 12 },
+	{ 22598, 12676, 12 },
+	{ 22607, 12688, 11 },
+	{ 22608, 12699, 12 },
+	{ 22609, 12711, 12 },
+	{ 22610, 12723, 12 },
+	{ 22611, 12735, 11 },
+	{ 22612, 12746, 12 },
+	{ 22613, 12758, 12 },
+	{ 22614, 12770, 12 },
+	{ 22623, 12782, 11 },
+	{ 22624, 12793, 12 },
+	{ 22625, 12805, 12 },
+	{ 22626, 12817, 12 },
+	{ 22627, 12829, 11 },
+	{ 22628, 12840, 12 },
+	{ 22629, 12852, 12 },
+	{ 22630, 12864, 12 },
+	{ 23599, 12876, 8 },
+	{ 23600, 12884, 9 },
+	{ 23601, 12893, 9 },
+	{ 23602, 12902, 9 },
+	{ 23603, 12911, 8 },
+	{ 23604, 12919, 9 },
+	{ 23605, 12928, 9 },
+	{ 23606, 12937, 9 },
+	{ 23615, 12946, 10 },
+	{ 23616, 12956, 11 },
+	{ 23617, 12967, 11 },
+	{ 23618, 12978, 11 },
+	{ 23619, 12989, 10 },
+	{ 23620, 12999, 11 },
+	{ 23621, 13010, 11 },
+	{ 23622, 13021, 11 },
+	{ 23631, 13032, 10 },
+	{ 23632, 13042, 11 },
+	{ 23633, 13053, 11 },
+	{ 23634, 13064, 11 },
+	{ 23635, 13075, 10 },
+	{ 23636, 13085, 11 },
+	{ 23637, 13096, 11 },
+	{ 23638, 13107, 11 },
+	{ 23647, 13118, 10 },
+	{ 23648, 13128, 11 },
+	{ 23649, 13139, 11 },
+	{ 23650, 13150, 11 },
+	{ 23651, 13161, 10 },
+	{ 23652, 13171, 11 },
+	{ 23653, 13182, 11 },
+	{ 23654, 13193, 11 },
+	{ 24623, 13204, 9 },
+	{ 24624, 13213, 10 },
+	{ 24625, 13223, 10 },
+	{ 24626, 13233, 10 },
+	{ 24627, 13243, 9 },
+	{ 24628, 13252, 10 },
+	{ 24629, 13262, 10 },
+	{ 24630, 13272, 10 },
+	{ 24639, 13282, 11 },
+	{ 24640, 13293, 12 },
+	{ 24641, 13305, 12 },
+	{ 24642, 13317, 12 },
+	{ 24643, 13329, 11 },
+	{ 24644, 13340, 12 },
+	{ 24645, 13352, 12 },
+	{ 24646, 13364, 12 },
+	{ 24655, 13376, 11 },
+	{ 24656, 13387, 12 },
+	{ 24657, 13399, 12 },
+	{ 24658, 13411, 12 },
+	{ 24659, 13423, 11 },
+	{ 24660, 13434, 12 },
+	{ 24661, 13446, 12 },
+	{ 24662, 13458, 12 },
+	{ 24671, 13470, 11 },
+	{ 24672, 13481, 12 },
+	{ 24673, 13493, 12 },
+	{ 24674, 13505, 12 },
+	{ 24675, 13517, 11 },
+	{ 24676, 13528, 12 },
+	{ 24677, 13540, 12 },
+	{ 24678, 13552, 12 },
+	{ 25647, 13564, 9 },
+	{ 25648, 13573, 10 },
+	{ 25649, 13583, 10 },
+	{ 25650, 13593, 10 },
+	{ 25651, 13603, 9 },
+	{ 25652, 13612, 10 },
+	{ 25653, 13622, 10 },
+	{ 25654, 13632, 10 },
+	{ 25663, 13642, 11 },
+	{ 25664, 13653, 12 },
+	{ 25665, 13665, 12 },
+	{ 25666, 13677, 12 },
+	{ 25667, 13689, 11 },
+	{ 25668, 13700, 12 },
+	{ 25669, 13712, 12 },
+	{ 25670, 13724, 12 },
+	{ 25679, 13736, 11 },
+	{ 25680, 13747, 12 },
+	{ 25681, 13759, 12 },
+	{ 25682, 13771, 12 },
+	{ 25683, 13783, 11 },
+	{ 25684, 13794, 12 },
+	{ 25685, 13806, 12 },
+	{ 25686, 13818, 12 },
+	{ 25695, 13830, 11 },
+	{ 25696, 13841, 12 },
+	{ 25697, 13853, 12 },
+	{ 25698, 13865, 12 },
+	{ 25699, 13877, 11 },
+	{ 25700, 13888, 12 },
+	{ 25701, 13900, 12 },
+	{ 25702, 13912, 12 },
+	{ 26671, 13924, 9 },
+	{ 26672, 13933, 10 },
+	{ 26673, 13943, 10 },
+	{ 26674, 13953, 10 },
+	{ 26675, 13963, 9 },
+	{ 26676, 13972, 10 },
+	{ 26677, 13982, 10 },
+	{ 26678, 13992, 10 },
+	{ 26687, 14002, 11 },
+	{ 26688, 14013, 12 },
+	{ 26689, 14025, 12 },
+	{ 26690, 14037, 12 },
+	{ 26691, 14049, 11 },
+	{ 26692, 14060, 12 },
+	{ 26693, 14072, 12 },
+	{ 26694, 14084, 12 },
+	{ 26703, 14096, 11 },
+	{ 26704, 14107, 12 },
+	{ 26705, 14119, 12 },
+	{ 26706, 14131, 12 },
+	{ 26707, 14143, 11 },
+	{ 26708, 14154, 12 },
+	{ 26709, 14166, 12 },
+	{ 26710, 14178, 12 },
+	{ 26719, 14190, 11 },
+	{ 26720, 14201, 12 },
+	{ 26721, 14213, 12 },
+	{ 26722, 14225, 12 },
+	{ 26723, 14237, 11 },
+	{ 26724, 14248, 12 },
+	{ 26725, 14260, 12 },
+	{ 26726, 14272, 12 },
+	{ 27699, 14284, 9 },
+	{ 27700, 14293, 10 },
+	{ 27701, 14303, 10 },
+	{ 27702, 14313, 10 },
+	{ 27715, 14323, 11 },
+	{ 27716, 14334, 12 },
+	{ 27717, 14346, 12 },
+	{ 27718, 14358, 12 },
+	{ 27731, 14370, 11 },
+	{ 27732, 14381, 12 },
+	{ 27733, 14393, 12 },
+	{ 27734, 14405, 12 },
+	{ 27747, 14417, 11 },
+	{ 27748, 14428, 12 },
+	{ 27749, 14440, 12 },
+	{ 27750, 14452, 12 },
+	{ 28723, 14464, 9 },
+	{ 28724, 14473, 10 },
+	{ 28725, 14483, 10 },
+	{ 28726, 14493, 10 },
+	{ 28739, 14503, 11 },
+	{ 28740, 14514, 12 },
+	{ 28741, 14526, 12 },
+	{ 28742, 14538, 12 },
+	{ 28755, 14550, 11 },
+	{ 28756, 14561, 12 },
+	{ 28757, 14573, 12 },
+	{ 28758, 14585, 12 },
+	{ 28771, 14597, 11 },
+	{ 28772, 14608, 12 },
+	{ 28773, 14620, 12 },
+	{ 28774, 14632, 12 },
+	{ 29747, 14644, 11 },
+	{ 29748, 14655, 12 },
+	{ 29749, 14667, 12 },
+	{ 29750, 14679, 12 },
+	{ 29763, 14691, 13 },
+	{ 29764, 14704, 14 },
+	{ 29765, 14718, 14 },
+	{ 29766, 14732, 14 },
+	{ 29779, 14746, 13 },
+	{ 29780, 14759, 14 },
+	{ 29781, 14773, 14 },
+	{ 29782, 14787, 14 },
+	{ 29795, 14801, 13 },
+	{ 29796, 14814, 14 },
+	{ 29797, 14828, 14 },
+	{ 29798, 14842, 14 },
+	{ 30775, 14856, 7 },
+	{ 30776, 14863, 7 },
+	{ 30777, 14870, 7 },
+	{ 30791, 14877, 9 },
+	{ 30792, 14886, 9 },
+	{ 30793, 14895, 9 },
+	{ 30807, 14904, 9 },
+	{ 30808, 14913, 9 },
+	{ 30809, 14922, 9 },
+	{ 30823, 14931, 9 },
+	{ 30824, 14940, 9 },
+	{ 30825, 14949, 9 },
+	{ 31799, 14958, 9 },
+	{ 31800, 14967, 9 },
+	{ 31801, 14976, 9 },
+	{ 31815, 14985, 11 },
+	{ 31816, 14996, 11 },
+	{ 31817, 15007, 11 },
+	{ 31831, 15018, 11 },
+	{ 31832, 15029, 11 },
+	{ 31833, 15040, 11 },
+	{ 31847, 15051, 11 },
+	{ 31848, 15062, 11 },
+	{ 31849, 15073, 11 },
+	{ 32823, 15084, 8 },
+	{ 32824, 15092, 8 },
+	{ 32825, 15100, 8 },
+	{ 32839, 15108, 10 },
+	{ 32840, 15118, 10 },
+	{ 32841, 15128, 10 },
+	{ 32855, 15138, 10 },
+	{ 32856, 15148, 10 },
+	{ 32857, 15158, 10 },
+	{ 32871, 15168, 10 },
+	{ 32872, 15178, 10 },
+	{ 32873, 15188, 10 },
+	{ 33847, 15198, 9 },
+	{ 33848, 15207, 9 },
+	{ 33849, 15216, 9 },
+	{ 33863, 15225, 11 },
+	{ 33864, 15236, 11 },
+	{ 33865, 15247, 11 },
+	{ 33879, 15258, 11 },
+	{ 33880, 15269, 11 },
+	{ 33881, 15280, 11 },
+	{ 33895, 15291, 11 },
+	{ 33896, 15302, 11 },
+	{ 33897, 15313, 11 },
+	{ 34871, 15324, 9 },
+	{ 34872, 15333, 9 },
+	{ 34873, 15342, 9 },
+	{ 34887, 15351, 11 },
+	{ 34888, 15362, 11 },
+	{ 34889, 15373, 11 },
+	{ 34903, 15384, 11 },
+	{ 34904, 15395, 11 },
+	{ 34905, 15406, 11 },
+	{ 34919, 15417, 11 },
+	{ 34920, 15428, 11 },
+	{ 34921, 15439, 11 },
+	{ 35895, 15450, 9 },
+	{ 35896, 15459, 9 },
+	{ 35897, 15468, 9 },
+	{ 35911, 15477, 11 },
+	{ 35912, 15488, 11 },
+	{ 35913, 15499, 11 },
+	{ 35927, 15510, 11 },
+	{ 35928, 15521, 11 },
+	{ 35929, 15532, 11 },
+	{ 35943, 15543, 11 },
+	{ 35944, 15554, 11 },
+	{ 35945, 15565, 11 },
+	{ 36919, 15576, 11 },
+	{ 36920, 15587, 11 },
+	{ 36921, 15598, 11 },
+	{ 36935, 15609, 13 },
+	{ 36936, 15622, 13 },
+	{ 36937, 15635, 13 },
+	{ 36951, 15648, 13 },
+	{ 36952, 15661, 13 },
+	{ 36953, 15674, 13 },
+	{ 36967, 15687, 13 },
+	{ 36968, 15700, 13 },
+	{ 36969, 15713, 13 },
+	{ 37943, 15726, 11 },
+	{ 37944, 15737, 11 },
+	{ 37945, 15748, 11 },
+	{ 37959, 15759, 13 },
+	{ 37960, 15772, 13 },
+	{ 37961, 15785, 13 },
+	{ 37975, 15798, 13 },
+	{ 37976, 15811, 13 },
+	{ 37977, 15824, 13 },
+	{ 37991, 15837, 13 },
+	{ 37992, 15850, 13 },
+	{ 37993, 15863, 13 },
+	{ 38967, 15876, 8 },
+	{ 38968, 15884, 8 },
+	{ 38969, 15892, 8 },
+	{ 38983, 15900, 10 },
+	{ 38984, 15910, 10 },
+	{ 38985, 15920, 10 },
+	{ 38999, 15930, 10 },
+	{ 39000, 15940, 10 },
+	{ 39001, 15950, 10 },
+	{ 39015, 15960, 10 },
+	{ 39016, 15970, 10 },
+	{ 39017, 15980, 10 },
+	{ 39991, 15990, 14 },
+	{ 39992, 16004, 14 },
+	{ 39993, 16018, 14 },
+	{ 40007, 16032, 16 },
+	{ 40008, 16048, 16 },
+	{ 40009, 16064, 16 },
+	{ 40023, 16080, 16 },
+	{ 40024, 16096, 16 },
+	{ 40025, 16112, 16 },
+	{ 40039, 16128, 16 },
+	{ 40040, 16144, 16 },
+	{ 40041, 16160, 16 },
+	{ 41015, 16176, 10 },
+	{ 41016, 16186, 10 },
+	{ 41017, 16196, 10 },
+	{ 41031, 16206, 12 },
+	{ 41032, 16218, 12 },
+	{ 41033, 16230, 12 },
+	{ 41047, 16242, 12 },
+	{ 41048, 16254, 12 },
+	{ 41049, 16266, 12 },
+	{ 41063, 16278, 12 },
+	{ 41064, 16290, 12 },
+	{ 41065, 16302, 12 },
+	{ 42039, 16314, 12 },
+	{ 42040, 16326, 12 },
+	{ 42041, 16338, 12 },
+	{ 42055, 16350, 14 },
+	{ 42056, 16364, 14 },
+	{ 42057, 16384, 14 },
+	{ 42071, 16398, 14 },
+	{ 42072, 16412, 14 },
+	{ 42073, 16426, 14 },
+	{ 42087, 16440, 14 },
+	{ 42088, 16454, 14 },
+	{ 42089, 16468, 14 },
+	{ 43063, 16482, 7 },
+	{ 43064, 16489, 7 },
+	{ 43065, 16496, 7 },
+	{ 43079, 16503, 9 },
+	{ 43080, 16512, 9 },
+	{ 43081, 16521, 9 },
+	{ 43095, 16530, 9 },
+	{ 43096, 16539, 9 },
+	{ 43097, 16548, 9 },
+	{ 43111, 16557, 9 },
+	{ 43112, 16566, 9 },
+	{ 43113, 16575, 9 },
+	{ 44087, 16584, 7 },
+	{ 44088, 16591, 7 },
+	{ 44089, 16598, 7 },
+	{ 44103, 16605, 9 },
+	{ 44104, 16614, 9 },
+	{ 44105, 16623, 9 },
+	{ 44119, 16632, 9 },
+	{ 44120, 16641, 9 },
+	{ 44121, 16650, 9 },
+	{ 44135, 16659, 9 },
+	{ 44136, 16668, 9 },
+	{ 44137, 16677, 9 },
+	{ 45111, 16686, 7 },
+	{ 45112, 16693, 7 },
+	{ 45113, 16700, 7 },
+	{ 45127, 16707, 9 },
+	{ 45128, 16716, 9 },
+	{ 45129, 16725, 9 },
+	{ 45143, 16734, 9 },
+	{ 45144, 16743, 9 },
+	{ 45145, 16752, 9 },
+	{ 45159, 16761, 9 },
+	{ 45160, 16770, 9 },
+	{ 45161, 16779, 9 },
+	{ 46135, 16788, 8 },
+	{ 46136, 16796, 8 },
+	{ 46137, 16804, 8 },
+	{ 46151, 16812, 10 },
+	{ 46152, 16822, 10 },
+	{ 46153, 16832, 10 },
+	{ 46167, 16842, 10 },
+	{ 46168, 16852, 10 },
+	{ 46169, 16862, 10 },
+	{ 46183, 16872, 10 },
+	{ 46184, 16882, 10 },
+	{ 46185, 16892, 10 },
+	{ 47159, 16902, 8 },
+	{ 47160, 16910, 8 },
+	{ 47161, 16918, 8 },
+	{ 47175, 16926, 10 },
+	{ 47176, 16936, 10 },
+	{ 47177, 16946, 10 },
+	{ 47191, 16956, 10 },
+	{ 47192, 16966, 10 },
+	{ 47193, 16976, 10 },
+	{ 47207, 16986, 10 },
+	{ 47208, 16996, 10 },
+	{ 47209, 17006, 10 },
+	{ 48183, 17016, 8 },
+	{ 48184, 17024, 8 },
+	{ 48185, 17032, 8 },
+	{ 48199, 17040, 10 },
+	{ 48200, 17050, 10 },
+	{ 48201, 17060, 10 },
+	{ 48215, 17070, 10 },
+	{ 48216, 17080, 10 },
+	{ 48217, 17090, 10 },
+	{ 48231, 17100, 10 },
+	{ 48232, 17110, 10 },
+	{ 48233, 17120, 10 },
+	{ 49207, 17130, 8 },
+	{ 49208, 17138, 8 },
+	{ 49209, 17146, 8 },
+	{ 49223, 17154, 10 },
+	{ 49224, 17164, 10 },
+	{ 49225, 17174, 10 },
+	{ 49239, 17184, 10 },
+	{ 49240, 17194, 10 },
+	{ 49241, 17204, 10 },
+	{ 49255, 17214, 10 },
+	{ 49256, 17224, 10 },
+	{ 49257, 17234, 10 },
+	{ 50231, 17244, 8 },
+	{ 50232, 17252, 8 },
+	{ 50233, 17260, 8 },
+	{ 50247, 17268, 10 },
+	{ 50248, 17278, 10 },
+	{ 50249, 17288, 10 },
+	{ 50263, 17298, 10 },
+	{ 50264, 17308, 10 },
+	{ 50265, 17318, 10 },
+	{ 50279, 17328, 10 },
+	{ 50280, 17338, 10 },
+	{ 50281, 17348, 10 },
+	{ 51255, 17358, 8 },
+	{ 51256, 17366, 8 },
+	{ 51257, 17374, 8 },
+	{ 51271, 17382, 10 },
+	{ 51272, 17392, 10 },
+	{ 51273, 17402, 10 },
+	{ 51287, 17412, 10 },
+	{ 51288, 17422, 10 },
+	{ 51289, 17432, 10 },
+	{ 51303, 17442, 10 },
+	{ 51304, 17452, 10 },
+	{ 51305, 17462, 10 },
+	{ 52279, 17472, 9 },
+	{ 52280, 17481, 9 },
+	{ 52281, 17490, 9 },
+	{ 52295, 17499, 11 },
+	{ 52296, 17510, 11 },
+	{ 52297, 17521, 11 },
+	{ 52311, 17532, 11 },
+	{ 52312, 17543, 11 },
+	{ 52313, 17554, 11 },
+	{ 52327, 17565, 11 },
+	{ 52328, 17576, 11 },
+	{ 52329, 17587, 11 },
+	{ 53303, 17598, 9 },
+	{ 53304, 17607, 9 },
+	{ 53305, 17616, 9 },
+	{ 53319, 17625, 11 },
+	{ 53320, 17636, 11 },
+	{ 53321, 17647, 11 },
+	{ 53335, 17658, 11 },
+	{ 53336, 17669, 11 },
+	{ 53337, 17680, 11 },
+	{ 53351, 17691, 11 },
+	{ 53352, 17702, 11 },
+	{ 53353, 17713, 11 },
+	{ 54327, 17724, 9 },
+	{ 54328, 17733, 9 },
+	{ 54329, 17742, 9 },
+	{ 54343, 17751, 11 },
+	{ 54344, 17762, 11 },
+	{ 54345, 17773, 11 },
+	{ 54359, 17784, 11 },
+	{ 54360, 17795, 11 },
+	{ 54361, 17806, 11 },
+	{ 54375, 17817, 11 },
+	{ 54376, 17828, 11 },
+	{ 54377, 17839, 11 },
+	{ 55351, 17850, 9 },
+	{ 55352, 17859, 9 },
+	{ 55353, 17868, 9 },
+	{ 55367, 17877, 11 },
+	{ 55368, 17888, 11 },
+	{ 55369, 17899, 11 },
+	{ 55383, 17910, 11 },
+	{ 55384, 17921, 11 },
+	{ 55385, 17932, 11 },
+	{ 55399, 17943, 11 },
+	{ 55400, 17954, 11 },
+	{ 55401, 17965, 11 },
+	{ 56375, 17976, 7 },
+	{ 56376, 17983, 7 },
+	{ 56377, 17990, 7 },
+	{ 56391, 17997, 9 },
+	{ 56392, 18006, 9 },
+	{ 56393, 18015, 9 },
+	{ 56407, 18024, 9 },
+	{ 56408, 18033, 9 },
+	{ 56409, 18042, 9 },
+	{ 56423, 18051, 9 },
+	{ 56424, 18060, 9 },
+	{ 56425, 18069, 9 },
+	{ 57399, 18078, 7 },
+	{ 57400, 18085, 7 },
+	{ 57401, 18092, 7 },
+	{ 57415, 18099, 9 },
+	{ 57416, 18108, 9 },
+	{ 57417, 18117, 9 },
+	{ 57431, 18126, 9 },
+	{ 57432, 18135, 9 },
+	{ 57433, 18144, 9 },
+	{ 57447, 18153, 9 },
+	{ 57448, 18162, 9 },
+	{ 57449, 18171, 9 },
+	{ 58423, 18180, 7 },
+	{ 58424, 18187, 7 },
+	{ 58425, 18194, 7 },
+	{ 58439, 18201, 9 },
+	{ 58440, 18210, 9 },
+	{ 58441, 18219, 9 },
+	{ 58455, 18228, 9 },
+	{ 58456, 18237, 9 },
+	{ 58457, 18246, 9 },
+	{ 58471, 18255, 9 },
+	{ 58472, 18264, 9 },
+	{ 58473, 18273, 9 },
+	{ 59447, 18282, 8 },
+	{ 59448, 18290, 8 },
+	{ 59449, 18298, 8 },
+	{ 59463, 18306, 10 },
+	{ 59464, 18316, 10 },
+	{ 59465, 18326, 10 },
+	{ 59479, 18336, 10 },
+	{ 59480, 18346, 10 },
+	{ 59481, 18356, 10 },
+	{ 59495, 18366, 10 },
+	{ 59496, 18376, 10 },
+	{ 59497, 18386, 10 },
+	{ 60471, 18396, 8 },
+	{ 60472, 18404, 8 },
+	{ 60473, 18412, 8 },
+	{ 60487, 18420, 10 },
+	{ 60488, 18430, 10 },
+	{ 60489, 18440, 10 },
+	{ 60503, 18450, 10 },
+	{ 60504, 18460, 10 },
+	{ 60505, 18470, 10 },
+	{ 60519, 18480, 10 },
+	{ 60520, 18490, 10 },
+	{ 60521, 18500, 10 },
+	{ 61495, 18510, 8 },
+	{ 61496, 18518, 8 },
+	{ 61497, 18526, 8 },
+	{ 61511, 18534, 10 },
+	{ 61512, 18544, 10 },
+	{ 61513, 18554, 10 },
+	{ 61527, 18564, 10 },
+	{ 61528, 18574, 10 },
+	{ 61529, 18584, 10 },
+	{ 61543, 18594, 10 },
+	{ 61544, 18604, 10 },
+	{ 61545, 18614, 10 },
+	{ 62519, 18624, 9 },
+	{ 62520, 18633, 9 },
+	{ 62521, 18642, 9 },
+	{ 62535, 18651, 11 },
+	{ 62536, 18662, 11 },
+	{ 62537, 18673, 11 },
+	{ 62551, 18684, 11 },
+	{ 62552, 18695, 11 },
+	{ 62553, 18706, 11 },
+	{ 62567, 18717, 11 },
+	{ 62568, 18728, 11 },
+	{ 62569, 18739, 11 },
+	{ 63543, 18750, 9 },
+	{ 63544, 18759, 9 },
+	{ 63545, 18768, 9 },
+	{ 63559, 18777, 11 },
+	{ 63560, 18788, 11 },
+	{ 63561, 18799, 11 },
+	{ 63575, 18810, 11 },
+	{ 63576, 18821, 11 },
+	{ 63577, 18832, 11 },
+	{ 63591, 18843, 11 },
+	{ 63592, 18854, 11 },
+	{ 63593, 18865, 11 },
+	{ 64567, 18876, 9 },
+	{ 64568, 18885, 9 },
+	{ 64569, 18894, 9 },
+	{ 64583, 18903, 11 },
+	{ 64584, 18914, 11 },
+	{ 64585, 18925, 11 },
+	{ 64599, 18936, 11 },
+	{ 64600, 18947, 11 },
+	{ 64601, 18958, 11 },
+	{ 64615, 18969, 11 },
+	{ 64616, 18980, 11 },
+	{ 64617, 18991, 11 },
+	{ 65591, 19002, 8 },
+	{ 65592, 19010, 8 },
+	{ 65593, 19018, 8 },
+	{ 65607, 19026, 10 },
+	{ 65608, 19036, 10 },
+	{ 65609, 19046, 10 },
+	{ 65623, 19056, 10 },
+	{ 65624, 19066, 10 },
+	{ 65625, 19076, 10 },
+	{ 65639, 19086, 10 },
+	{ 65640, 19096, 10 },
+	{ 65641, 19106, 10 },
+	{ 66631, 19116, 11 },
+	{ 66632, 19127, 11 },
+	{ 66633, 19138, 11 },
+	{ 66647, 19149, 11 },
+	{ 66648, 19160, 11 },
+	{ 66649, 19171, 11 },
+	{ 66663, 19182, 11 },
+	{ 66664, 19193, 11 },
+	{ 66665, 19204, 11 },
+	{ 67655, 19215, 9 },
+	{ 67656, 19224, 9 },
+	{ 67657, 19233, 9 },
+	{ 67671, 19242, 9 },
+	{ 67672, 19251, 9 },
+	{ 67673, 19260, 9 },
+	{ 67687, 19269, 9 },
+	{ 67688, 19278, 9 },
+	{ 67689, 19287, 9 },
+	{ 68679, 19296, 9 },
+	{ 68680, 19305, 9 },
+	{ 68681, 19314, 9 },
+	{ 68695, 19323, 9 },
+	{ 68696, 19332, 9 },
+	{ 68697, 19341, 9 },
+	{ 68711, 19350, 9 },
+	{ 68712, 19359, 9 },
+	{ 68713, 19368, 9 },
+	{ 69703, 19377, 10 },
+	{ 69704, 19387, 10 },
+	{ 69705, 19397, 10 },
+	{ 69719, 19407, 10 },
+	{ 69720, 19417, 10 },
+	{ 69721, 19427, 10 },
+	{ 69735, 19437, 10 },
+	{ 69736, 19447, 10 },
+	{ 69737, 19457, 10 },
+	{ 70727, 19467, 13 },
+	{ 70728, 19480, 13 },
+	{ 70729, 19493, 13 },
+	{ 70743, 19506, 13 },
+	{ 70744, 19519, 13 },
+	{ 70745, 19532, 13 },
+	{ 70759, 19545, 13 },
+	{ 70760, 19558, 13 },
+	{ 70761, 19571, 13 },
+	{ 71751, 19584, 13 },
+	{ 71752, 19597, 13 },
+	{ 71753, 19610, 13 },
+	{ 71767, 19623, 13 },
+	{ 71768, 19636, 13 },
+	{ 71769, 19649, 13 },
+	{ 71783, 19662, 13 },
+	{ 71784, 19675, 13 },
+	{ 71785, 19688, 13 },
+	{ 72759, 19701, 7 },
+	{ 72760, 19708, 7 },
+	{ 72761, 19715, 7 },
+	{ 72775, 19722, 9 },
+	{ 72776, 19731, 9 },
+	{ 72777, 19740, 9 },
+	{ 72791, 19749, 9 },
+	{ 72792, 19758, 9 },
+	{ 72793, 19767, 9 },
+	{ 72807, 19776, 9 },
+	{ 72808, 19785, 9 },
+	{ 72809, 19794, 9 },
+	{ 73783, 19803, 7 },
+	{ 73784, 19810, 7 },
+	{ 73785, 19817, 7 },
+	{ 73799, 19824, 9 },
+	{ 73800, 19833, 9 },
+	{ 73801, 19842, 9 },
+	{ 73815, 19851, 9 },
+	{ 73816, 19860, 9 },
+	{ 73817, 19869, 9 },
+	{ 73831, 19878, 9 },
+	{ 73832, 19887, 9 },
+	{ 73833, 19896, 9 },
+	{ 74807, 19905, 10 },
+	{ 74808, 19915, 10 },
+	{ 74809, 19925, 10 },
+	{ 74823, 19935, 12 },
+	{ 74824, 19947, 12 },
+	{ 74825, 19959, 12 },
+	{ 74839, 19971, 12 },
+	{ 74840, 19983, 12 },
+	{ 74841, 19995, 12 },
+	{ 74855, 20007, 12 },
+	{ 74856, 20019, 12 },
+	{ 74857, 20031, 12 },
+	{ 75831, 20043, 12 },
+	{ 75832, 20055, 12 },
+	{ 75833, 20067, 12 },
+	{ 75847, 20079, 14 },
+	{ 75848, 20093, 14 },
+	{ 75849, 20107, 14 },
+	{ 75863, 20121, 14 },
+	{ 75864, 20135, 14 },
+	{ 75865, 20149, 14 },
+	{ 75879, 20163, 14 },
+	{ 75880, 20177, 14 },
+	{ 75881, 20191, 14 },
+	{ 76855, 20205, 12 },
+	{ 76856, 20217, 12 },
+	{ 76857, 20229, 12 },
+	{ 76871, 20241, 14 },
+	{ 76872, 20255, 14 },
+	{ 76873, 20269, 14 },
+	{ 76887, 20283, 14 },
+	{ 76888, 20297, 14 },
+	{ 76889, 20311, 14 },
+	{ 76903, 20325, 14 },
+	{ 76904, 20339, 14 },
+	{ 76905, 20353, 14 },
+	{ 77879, 20367, 15 },
+	{ 77880, 20382, 15 },
+	{ 77881, 20397, 15 },
+	{ 77895, 20412, 17 },
+	{ 77896, 20429, 17 },
+	{ 77897, 20446, 17 },
+	{ 77911, 20480, 17 },
+	{ 77912, 20497, 17 },
+	{ 77913, 20514, 17 },
+	{ 77927, 20531, 17 },
+	{ 77928, 20548, 17 },
+	{ 77929, 20565, 17 },
+	{ 78903, 20582, 14 },
+	{ 78904, 20596, 14 },
+	{ 78905, 20610, 14 },
+	{ 78919, 20624, 16 },
+	{ 78920, 20640, 16 },
+	{ 78921, 20656, 16 },
+	{ 78935, 20672, 16 },
+	{ 78936, 20688, 16 },
+	{ 78937, 20704, 16 },
+	{ 78951, 20720, 16 },
+	{ 78952, 20736, 16 },
+	{ 78953, 20752, 16 },
+	{ 79927, 20768, 14 },
+	{ 79928, 20782, 14 },
+	{ 79929, 20796, 14 },
+	{ 79943, 20810, 16 },
+	{ 79944, 20826, 16 },
+	{ 79945, 20842, 16 },
+	{ 79959, 20858, 16 },
+	{ 79960, 20874, 16 },
+	{ 79961, 20890, 16 },
+	{ 79975, 20906, 16 },
+	{ 79976, 20922, 16 },
+	{ 79977, 20938, 16 },
+	{ 80951, 20954, 17 },
+	{ 80952, 20971, 17 },
+	{ 80953, 20988, 17 },
+	{ 80967, 21005, 19 },
+	{ 80968, 21024, 19 },
+	{ 80969, 21043, 19 },
+	{ 80983, 21062, 19 },
+	{ 80984, 21081, 19 },
+	{ 80985, 21100, 19 },
+	{ 80999, 21119, 19 },
+	{ 81000, 21138, 19 },
+	{ 81001, 21157, 19 },
+	{ 81966, 21176, 16 },
+	{ 81967, 21192, 14 },
+	{ 81968, 21206, 15 },
+	{ 81969, 21221, 15 },
+	{ 81970, 21236, 15 },
+	{ 81971, 21251, 14 },
+	{ 81972, 21265, 15 },
+	{ 81973, 21280, 15 },
+	{ 81974, 21295, 15 },
+	{ 81975, 21310, 15 },
+	{ 81976, 21325, 15 },
+	{ 81977, 21340, 15 },
+	{ 81982, 21355, 18 },
+	{ 81983, 21373, 16 },
+	{ 81984, 21389, 17 },
+	{ 81985, 21406, 17 },
+	{ 81986, 21423, 17 },
+	{ 81987, 21440, 16 },
+	{ 81988, 21456, 17 },
+	{ 81989, 21473, 17 },
+	{ 81990, 21490, 17 },
+	{ 81991, 21507, 17 },
+	{ 81992, 21524, 17 },
+	{ 81993, 21541, 17 },
+	{ 81998, 21558, 18 },
+	{ 81999, 21576, 16 },
+	{ 82000, 21592, 17 },
+	{ 82001, 21609, 17 },
+	{ 82002, 21626, 17 },
+	{ 82003, 21643, 16 },
+	{ 82004, 21659, 17 },
+	{ 82005, 21676, 17 },
+	{ 82006, 21693, 17 },
+	{ 82007, 21710, 17 },
+	{ 82008, 21727, 17 },
+	{ 82009, 21744, 17 },
+	{ 82014, 21761, 18 },
+	{ 82015, 21779, 16 },
+	{ 82016, 21795, 17 },
+	{ 82017, 21812, 17 },
+	{ 82018, 21829, 17 },
+	{ 82019, 21846, 16 },
+	{ 82020, 21862, 17 },
+	{ 82021, 21879, 17 },
+	{ 82022, 21896, 17 },
+	{ 82023, 21913, 17 },
+	{ 82024, 21930, 17 },
+	{ 82025, 21947, 17 },
+	{ 82990, 21964, 16 },
+	{ 82991, 21980, 14 },
+	{ 82992, 21994, 15 },
+	{ 82993, 22009, 15 },
+	{ 82994, 22024, 15 },
+	{ 82995, 22039, 14 },
+	{ 82996, 22053, 15 },
+	{ 82997, 22068, 15 },
+	{ 82998, 22083, 15 },
+	{ 82999, 22098, 15 },
+	{ 83000, 22113, 15 },
+	{ 83001, 22128, 15 },
+	{ 83006, 22143, 18 },
+	{ 83007, 22161, 16 },
+	{ 83008, 22177, 17 },
+	{ 83009, 22194, 17 },
+	{ 83010, 22211, 17 },
+	{ 83011, 22228, 16 },
+	{ 83012, 22244, 17 },
+	{ 83013, 22261, 17 },
+	{ 83014, 22278, 17 },
+	{ 83015, 22295, 17 },
+	{ 83016, 22312, 17 },
+	{ 83017, 22329, 17 },
+	{ 83022, 22346, 18 },
+	{ 83023, 22364, 16 },
+	{ 83024, 22380, 17 },
+	{ 83025, 22397, 17 },
+	{ 83026, 22414, 17 },
+	{ 83027, 22431, 16 },
+	{ 83028, 22447, 17 },
+	{ 83029, 22464, 17 },
+	{ 83030, 22481, 17 },
+	{ 83031, 22498, 17 },
+	{ 83032, 22515, 17 },
+	{ 83033, 22532, 17 },
+	{ 83038, 22549, 18 },
+	{ 83039, 22567, 16 },
+	{ 83040, 22583, 17 },
+	{ 83041, 22600, 17 },
+	{ 83042, 22617, 17 },
+	{ 83043, 22634, 16 },
+	{ 83044, 22650, 17 },
+	{ 83045, 22667, 17 },
+	{ 83046, 22684, 17 },
+	{ 83047, 22701, 17 },
+	{ 83048, 22718, 17 },
+	{ 83049, 22735, 17 },
+	{ 84014, 22752, 23 },
+	{ 84015, 22775, 21 },
+	{ 84016, 22796, 22 },
+	{ 84017, 22818, 22 },
+	{ 84018, 22840, 22 },
+	{ 84019, 22862, 21 },
+	{ 84020, 22883, 22 },
+	{ 84021, 22905, 22 },
+	{ 84022, 22927, 22 },
+	{ 84023, 22949, 22 },
+	{ 84024, 22971, 22 },
+	{ 84025, 22993, 22 },
+	{ 84030, 23015, 25 },
+	{ 84031, 23040, 23 },
+	{ 84032, 23063, 24 },
+	{ 84033, 23087, 24 },
+	{ 84034, 23111, 24 },
+	{ 84035, 23135, 23 },
+	{ 84036, 23158, 24 },
+	{ 84037, 23182, 24 },
+	{ 84038, 23206, 24 },
+	{ 84039, 23230, 24 },
+	{ 84040, 23254, 24 },
+	{ 84041, 23278, 24 },
+	{ 84046, 23302, 25 },
+	{ 84047, 23327, 23 },
+	{ 84048, 23350, 24 },
+	{ 84049, 23374, 24 },
+	{ 84050, 23398, 24 },
+	{ 84051, 23422, 23 },
+	{ 84052, 23445, 24 },
+	{ 84053, 23469, 24 },
+	{ 84054, 23493, 24 },
+	{ 84055, 23517, 24 },
+	{ 84056, 23541, 24 },
+	{ 84057, 23565, 24 },
+	{ 84062, 23589, 25 },
+	{ 84063, 23614, 23 },
+	{ 84064, 23637, 24 },
+	{ 84065, 23661, 24 },
+	{ 84066, 23685, 24 },
+	{ 84067, 23709, 23 },
+	{ 84068, 23732, 24 },
+	{ 84069, 23756, 24 },
+	{ 84070, 23780, 24 },
+	{ 84071, 23804, 24 },
+	{ 84072, 23828, 24 },
+	{ 84073, 23852, 24 },
+	{ 85038, 23876, 21 },
+	{ 85039, 23897, 19 },
+	{ 85040, 23916, 20 },
+	{ 85041, 23936, 20 },
+	{ 85042, 23956, 20 },
+	{ 85043, 23976, 19 },
+	{ 85044, 23995, 20 },
+	{ 85045, 24015, 20 },
+	{ 85046, 24035, 20 },
+	{ 85047, 24055, 20 },
+	{ 85048, 24075, 20 },
+	{ 85049, 24095, 20 },
+	{ 85054, 24115, 23 },
+	{ 85055, 24138, 21 },
+	{ 85056, 24159, 22 },
+	{ 85057, 24181, 22 },
+	{ 85058, 24203, 22 },
+	{ 85059, 24225, 21 },
+	{ 85060, 24246, 22 },
+	{ 85061, 24268, 22 },
+	{ 85062, 24290, 22 },
+	{ 85063, 24312, 22 },
+	{ 85064, 24334, 22 },
+	{ 85065, 24356, 22 },
+	{ 85070, 24378, 23 },
+	{ 85071, 24401, 21 },
+	{ 85072, 24422, 22 },
+	{ 85073, 24444, 22 },
+	{ 85074, 24466, 22 },
+	{ 85075, 24488, 21 },
+	{ 85076, 24509, 22 },
+	{ 85077, 24531, 22 },
+	{ 85078, 24553, 22 },
+	{ 85079, 24576, 22 },
+	{ 85080, 24598, 22 },
+	{ 85081, 24620, 22 },
+	{ 85086, 24642, 23 },
+	{ 85087, 24665, 21 },
+	{ 85088, 24686, 22 },
+	{ 85089, 24708, 22 },
+	{ 85090, 24730, 22 },
+	{ 85091, 24752, 21 },
+	{ 85092, 24773, 22 },
+	{ 85093, 24795, 22 },
+	{ 85094, 24817, 22 },
+	{ 85095, 24839, 22 },
+	{ 85096, 24861, 22 },
+	{ 85097, 24883, 22 },
+	{ 86062, 24905, 13 },
+	{ 86063, 24918, 11 },
+	{ 86064, 24929, 12 },
+	{ 86065, 24941, 12 },
+	{ 86066, 24953, 12 },
+	{ 86067, 24965, 11 },
+	{ 86068, 24976, 12 },
+	{ 86069, 24988, 12 },
+	{ 86070, 25000, 12 },
+	{ 86071, 25012, 12 },
+	{ 86072, 25024, 12 },
+	{ 86073, 25036, 12 },
+	{ 87086, 25048, 13 },
+	{ 87087, 25061, 11 },
+	{ 87088, 25072, 12 },
+	{ 87089, 25084, 12 },
+	{ 87090, 25096, 12 },
+	{ 87091, 25108, 11 },
+	{ 87092, 25119, 12 },
+	{ 87093, 25131, 12 },
+	{ 87094, 25143, 12 },
+	{ 87095, 25155, 12 },
+	{ 87096, 25167, 12 },
+	{ 87097, 25179, 12 },
+	{ 88110, 25191, 20 },
+	{ 88111, 25211, 18 },
+	{ 88112, 25229, 19 },
+	{ 88113, 25248, 19 },
+	{ 88114, 25267, 19 },
+	{ 88115, 25286, 18 },
+	{ 88116, 25304, 19 },
+	{ 88117, 25323, 19 },
+	{ 88118, 25342, 19 },
+	{ 88119, 25361, 19 },
+	{ 88120, 25380, 19 },
+	{ 88121, 25399, 19 },
+	{ 89134, 25418, 20 },
+	{ 89135, 25438, 18 },
+	{ 89136, 25456, 19 },
+	{ 89137, 25475, 19 },
+	{ 89138, 25494, 19 },
+	{ 89139, 25513, 18 },
+	{ 89140, 25531, 19 },
+	{ 89141, 25550, 19 },
+	{ 89142, 25569, 19 },
+	{ 89143, 25588, 19 },
+	{ 89144, 25607, 19 },
+	{ 89145, 25626, 19 },
+	{ 90158, 25645, 21 },
+	{ 90159, 25666, 19 },
+	{ 90160, 25685, 20 },
+	{ 90161, 25705, 20 },
+	{ 90162, 25725, 20 },
+	{ 90163, 25745, 19 },
+	{ 90164, 25764, 20 },
+	{ 90165, 25784, 20 },
+	{ 90166, 25804, 20 },
+	{ 90167, 25824, 20 },
+	{ 90168, 25844, 20 },
+	{ 90169, 25864, 20 },
+	{ 90174, 25884, 23 },
+	{ 90175, 25907, 21 },
+	{ 90176, 25928, 22 },
+	{ 90177, 25950, 22 },
+	{ 90178, 25972, 22 },
+	{ 90179, 25994, 21 },
+	{ 90180, 26015, 22 },
+	{ 90181, 26037, 22 },
+	{ 90182, 26059, 22 },
+	{ 90183, 26081, 22 },
+	{ 90184, 26103, 22 },
+	{ 90185, 26125, 22 },
+	{ 90190, 26147, 23 },
+	{ 90191, 26170, 21 },
+	{ 90192, 26191, 22 },
+	{ 90193, 26213, 22 },
+	{ 90194, 26235, 22 },
+	{ 90195, 26257, 21 },
+	{ 90196, 26278, 22 },
+	{ 90197, 26300, 22 },
+	{ 90198, 26322, 22 },
+	{ 90199, 26344, 22 },
+	{ 90200, 26366, 22 },
+	{ 90201, 26388, 22 },
+	{ 90206, 26410, 23 },
+	{ 90207, 26433, 21 },
+	{ 90208, 26454, 22 },
+	{ 90209, 26476, 22 },
+	{ 90210, 26498, 22 },
+	{ 90211, 26520, 21 },
+	{ 90212, 26541, 22 },
+	{ 90213, 26563, 22 },
+	{ 90214, 26585, 22 },
+	{ 90215, 26607, 22 },
+	{ 90216, 26629, 22 },
+	{ 90217, 26651, 22 },
+	{ 91182, 26673, 26 },
+	{ 91183, 26699, 24 },
+	{ 91184, 26723, 25 },
+	{ 91185, 26748, 25 },
+	{ 91186, 26773, 25 },
+	{ 91187, 26798, 24 },
+	{ 91188, 26822, 25 },
+	{ 91189, 26847, 25 },
+	{ 91190, 26872, 25 },
+	{ 91191, 26897, 25 },
+	{ 91192, 26922, 25 },
+	{ 91193, 26947, 25 },
+	{ 91198, 26972, 28 },
+	{ 91199, 27000, 26 },
+	{ 91200, 27026, 27 },
+	{ 91201, 27053, 27 },
+	{ 91202, 27080, 27 },
+	{ 91203, 27107, 26 },
+	{ 91204, 27133, 27 },
+	{ 91205, 27160, 27 },
+	{ 91206, 27187, 27 },
+	{ 91207, 27214, 27 },
+	{ 91208, 27241, 27 },
+	{ 91209, 27268, 27 },
+	{ 91214, 27295, 28 },
+	{ 91215, 27323, 26 },
+	{ 91216, 27349, 27 },
+	{ 91217, 27376, 27 },
+	{ 91218, 27403, 27 },
+	{ 91219, 27430, 26 },
+	{ 91220, 27456, 27 },
+	{ 91221, 27483, 27 },
+	{ 91222, 27510, 27 },
+	{ 91223, 27537, 27 },
+	{ 91224, 27564, 27 },
+	{ 91225, 27591, 27 },
+	{ 91230, 27618, 28 },
+	{ 91231, 27646, 26 },
+	{ 91232, 27672, 27 },
+	{ 91233, 27699, 27 },
+	{ 91234, 27726, 27 },
+	{ 91235, 27753, 26 },
+	{ 91236, 27779, 27 },
+	{ 91237, 27806, 27 },
+	{ 91238, 27833, 27 },
+	{ 91239, 27860, 27 },
+	{ 91240, 27887, 27 },
+	{ 91241, 27914, 27 },
+	{ 92207, 27941, 18 },
+	{ 92208, 27959, 19 },
+	{ 92209, 27978, 19 },
+	{ 92210, 27997, 19 },
+	{ 92211, 28016, 18 },
+	{ 92212, 28034, 19 },
+	{ 92213, 28053, 19 },
+	{ 92214, 28072, 19 },
+	{ 92215, 28091, 19 },
+	{ 92216, 28110, 19 },
+	{ 92217, 28129, 19 },
+	{ 92223, 28148, 20 },
+	{ 92224, 28168, 21 },
+	{ 92225, 28189, 21 },
+	{ 92226, 28210, 21 },
+	{ 92227, 28231, 20 },
+	{ 92228, 28251, 21 },
+	{ 92229, 28272, 21 },
+	{ 92230, 28293, 21 },
+	{ 92231, 28314, 21 },
+	{ 92232, 28335, 21 },
+	{ 92233, 28356, 21 },
+	{ 92239, 28377, 20 },
+	{ 92240, 28397, 21 },
+	{ 92241, 28418, 21 },
+	{ 92242, 28439, 21 },
+	{ 92243, 28460, 20 },
+	{ 92244, 28480, 21 },
+	{ 92245, 28501, 21 },
+	{ 92246, 28522, 21 },
+	{ 92247, 28543, 21 },
+	{ 92248, 28564, 21 },
+	{ 92249, 28585, 21 },
+	{ 92255, 28606, 20 },
+	{ 92256, 28626, 21 },
+	{ 92257, 28647, 21 },
+	{ 92258, 28672, 21 },
+	{ 92259, 28693, 20 },
+	{ 92260, 28713, 21 },
+	{ 92261, 28734, 21 },
+	{ 92262, 28755, 21 },
+	{ 92263, 28776, 21 },
+	{ 92264, 28797, 21 },
+	{ 92265, 28818, 21 },
+	{ 93231, 28839, 18 },
+	{ 93232, 28857, 19 },
+	{ 93233, 28876, 19 },
+	{ 93234, 28895, 19 },
+	{ 93235, 28914, 18 },
+	{ 93236, 28932, 19 },
+	{ 93237, 28951, 19 },
+	{ 93238, 28970, 19 },
+	{ 93239, 28989, 19 },
+	{ 93240, 29008, 19 },
+	{ 93241, 29027, 19 },
+	{ 93247, 29046, 20 },
+	{ 93248, 29066, 21 },
+	{ 93249, 29087, 21 },
+	{ 93250, 29108, 21 },
+	{ 93251, 29129, 20 },
+	{ 93252, 29149, 21 },
+	{ 93253, 29170, 21 },
+	{ 93254, 29191, 21 },
+	{ 93255, 29212, 21 },
+	{ 93256, 29233, 21 },
+	{ 93257, 29254, 21 },
+	{ 93263, 29275, 20 },
+	{ 93264, 29295, 21 },
+	{ 93265, 29316, 21 },
+	{ 93266, 29337, 21 },
+	{ 93267, 29358, 20 },
+	{ 93268, 29378, 21 },
+	{ 93269, 29399, 21 },
+	{ 93270, 29420, 21 },
+	{ 93271, 29441, 21 },
+	{ 93272, 29462, 21 },
+	{ 93273, 29483, 21 },
+	{ 93279, 29504, 20 },
+	{ 93280, 29524, 21 },
+	{ 93281, 29545, 21 },
+	{ 93282, 29566, 21 },
+	{ 93283, 29587, 20 },
+	{ 93284, 29607, 21 },
+	{ 93285, 29628, 21 },
+	{ 93286, 29649, 21 },
+	{ 93287, 29670, 21 },
+	{ 93288, 29691, 21 },
+	{ 93289, 29712, 21 },
+	{ 94255, 29733, 18 },
+	{ 94256, 29751, 19 },
+	{ 94257, 29770, 19 },
+	{ 94258, 29789, 19 },
+	{ 94259, 29808, 18 },
+	{ 94260, 29826, 19 },
+	{ 94261, 29845, 19 },
+	{ 94262, 29864, 19 },
+	{ 94263, 29883, 19 },
+	{ 94264, 29902, 19 },
+	{ 94265, 29921, 19 },
+	{ 94271, 29940, 20 },
+	{ 94272, 29960, 21 },
+	{ 94273, 29981, 21 },
+	{ 94274, 30002, 21 },
+	{ 94275, 30023, 20 },
+	{ 94276, 30043, 21 },
+	{ 94277, 30064, 21 },
+	{ 94278, 30085, 21 },
+	{ 94279, 30106, 21 },
+	{ 94280, 30127, 21 },
+	{ 94281, 30148, 21 },
+	{ 94287, 30169, 20 },
+	{ 94288, 30189, 21 },
+	{ 94289, 30210, 21 },
+	{ 94290, 30231, 21 },
+	{ 94291, 30252, 20 },
+	{ 94292, 30272, 21 },
+	{ 94293, 30293, 21 },
+	{ 94294, 30314, 21 },
+	{ 94295, 30335, 21 },
+	{ 94296, 30356, 21 },
+	{ 94297, 30377, 21 },
+	{ 94303, 30398, 20 },
+	{ 94304, 30418, 21 },
+	{ 94305, 30439, 21 },
+	{ 94306, 30460, 21 },
+	{ 94307, 30481, 20 },
+	{ 94308, 30501, 21 },
+	{ 94309, 30522, 21 },
+	{ 94310, 30543, 21 },
+	{ 94311, 30564, 21 },
+	{ 94312, 30585, 21 },
+	{ 94313, 30606, 21 },
+	{ 95279, 30627, 25 },
+	{ 95280, 30652, 26 },
+	{ 95281, 30678, 26 },
+	{ 95282, 30704, 26 },
+	{ 95283, 30730, 25 },
+	{ 95284, 30755, 26 },
+	{ 95285, 30781, 26 },
+	{ 95286, 30807, 26 },
+	{ 95287, 30833, 26 },
+	{ 95288, 30859, 26 },
+	{ 95289, 30885, 26 },
+	{ 95295, 30911, 27 },
+	{ 95296, 30938, 28 },
+	{ 95297, 30966, 28 },
+	{ 95298, 30994, 28 },
+	{ 95299, 31022, 27 },
+	{ 95300, 31049, 28 },
+	{ 95301, 31077, 28 },
+	{ 95302, 31105, 28 },
+	{ 95303, 31133, 28 },
+	{ 95304, 31161, 28 },
+	{ 95305, 31189, 28 },
+	{ 95311, 31217, 27 },
+	{ 95312, 31244, 28 },
+	{ 95313, 31272, 28 },
+	{ 95314, 31300, 28 },
+	{ 95315, 31328, 27 },
+	{ 95316, 31355, 28 },
+	{ 95317, 31383, 28 },
+	{ 95318, 31411, 28 },
+	{ 95319, 31439, 28 },
+	{ 95320, 31467, 28 },
+	{ 95321, 31495, 28 },
+	{ 95327, 31523, 27 },
+	{ 95328, 31550, 28 },
+	{ 95329, 31578, 28 },
+	{ 95330, 31606, 28 },
+	{ 95331, 31634, 27 },
+	{ 95332, 31661, 28 },
+	{ 95333, 31689, 28 },
+	{ 95334, 31717, 28 },
+	{ 95335, 31745, 28 },
+	{ 95336, 31773, 28 },
+	{ 95337, 31801, 28 },
+	{ 96303, 31829, 22 },
+	{ 96304, 31851, 23 },
+	{ 96305, 31874, 23 },
+	{ 96306, 31897, 23 },
+	{ 96307, 31920, 22 },
+	{ 96308, 31942, 23 },
+	{ 96309, 31965, 23 },
+	{ 96310, 31988, 23 },
+	{ 96311, 32011, 23 },
+	{ 96312, 32034, 23 },
+	{ 96313, 32057, 23 },
+	{ 96319, 32080, 24 },
+	{ 96320, 32104, 25 },
+	{ 96321, 32129, 25 },
+	{ 96322, 32154, 25 },
+	{ 96323, 32179, 24 },
+	{ 96324, 32203, 25 },
+	{ 96325, 32228, 25 },
+	{ 96326, 32253, 25 },
+	{ 96327, 32278, 25 },
+	{ 96328, 32303, 25 },
+	{ 96329, 32328, 25 },
+	{ 96335, 32353, 24 },
+	{ 96336, 32377, 25 },
+	{ 96337, 32402, 25 },
+	{ 96338, 32427, 25 },
+	{ 96339, 32452, 24 },
+	{ 96340, 32476, 25 },
+	{ 96341, 32501, 25 },
+	{ 96342, 32526, 25 },
+	{ 96343, 32551, 25 },
+	{ 96344, 32576, 25 },
+	{ 96345, 32601, 25 },
+	{ 96351, 32626, 24 },
+	{ 96352, 32650, 25 },
+	{ 96353, 32675, 25 },
+	{ 96354, 32700, 25 },
+	{ 96355, 32725, 24 },
+	{ 96356, 32768, 25 },
+	{ 96357, 32793, 25 },
+	{ 96358, 32818, 25 },
+	{ 96359, 32843, 25 },
+	{ 96360, 32868, 25 },
+	{ 96361, 32893, 25 },
+	{ 97327, 32918, 29 },
+	{ 97328, 32947, 30 },
+	{ 97329, 32977, 30 },
+	{ 97330, 33007, 30 },
+	{ 97331, 33037, 29 },
+	{ 97332, 33066, 30 },
+	{ 97333, 33096, 30 },
+	{ 97334, 33126, 30 },
+	{ 97335, 33156, 30 },
+	{ 97336, 33186, 30 },
+	{ 97337, 33216, 30 },
+	{ 97343, 33246, 31 },
+	{ 97344, 33277, 32 },
+	{ 97345, 33309, 32 },
+	{ 97346, 33341, 32 },
+	{ 97347, 33373, 31 },
+	{ 97348, 33404, 32 },
+	{ 97349, 33436, 32 },
+	{ 97350, 33468, 32 },
+	{ 97351, 33500, 32 },
+	{ 97352, 33532, 32 },
+	{ 97353, 33564, 32 },
+	{ 97359, 33596, 31 },
+	{ 97360, 33627, 32 },
+	{ 97361, 33659, 32 },
+	{ 97362, 33691, 32 },
+	{ 97363, 33723, 31 },
+	{ 97364, 33754, 32 },
+	{ 97365, 33786, 32 },
+	{ 97366, 33818, 32 },
+	{ 97367, 33850, 32 },
+	{ 97368, 33882, 32 },
+	{ 97369, 33914, 32 },
+	{ 97375, 33946, 31 },
+	{ 97376, 33977, 32 },
+	{ 97377, 34009, 32 },
+	{ 97378, 34041, 32 },
+	{ 97379, 34073, 31 },
+	{ 97380, 34104, 32 },
+	{ 97381, 34136, 32 },
+	{ 97382, 34168, 32 },
+	{ 97383, 34200, 32 },
+	{ 97384, 34232, 32 },
+	{ 97385, 34264, 32 },
+	{ 98350, 34296, 27 },
+	{ 99374, 34323, 34 },
+	{ 100399, 34357, 22 },
+	{ 100400, 34379, 23 },
+	{ 100401, 34402, 23 },
+	{ 100402, 34425, 23 },
+	{ 100403, 34448, 22 },
+	{ 100404, 34470, 23 },
+	{ 100405, 34493, 23 },
+	{ 100406, 34516, 23 },
+	{ 100415, 34539, 24 },
+	{ 100416, 34563, 25 },
+	{ 100417, 34588, 25 },
+	{ 100418, 34613, 25 },
+	{ 100419, 34638, 24 },
+	{ 100420, 34662, 25 },
+	{ 100421, 34687, 25 },
+	{ 100422, 34712, 25 },
+	{ 100431, 34737, 24 },
+	{ 100432, 34761, 25 },
+	{ 100433, 34786, 25 },
+	{ 100434, 34811, 25 },
+	{ 100435, 34836, 24 },
+	{ 100436, 34860, 25 },
+	{ 100437, 34885, 25 },
+	{ 100438, 34910, 25 },
+	{ 100447, 34935, 24 },
+	{ 100448, 34959, 25 },
+	{ 100449, 34984, 25 },
+	{ 100450, 35009, 25 },
+	{ 100451, 35034, 24 },
+	{ 100452, 35058, 25 },
+	{ 100453, 35083, 25 },
+	{ 100454, 35108, 25 },
+	{ 101423, 35133, 21 },
+	{ 101424, 35154, 22 },
+	{ 101425, 35176, 22 },
+	{ 101426, 35198, 22 },
+	{ 101427, 35220, 21 },
+	{ 101428, 35241, 22 },
+	{ 101429, 35263, 22 },
+	{ 101430, 35285, 22 },
+	{ 101439, 35307, 23 },
+	{ 101440, 35330, 24 },
+	{ 101441, 35354, 24 },
+	{ 101442, 35378, 24 },
+	{ 101443, 35402, 23 },
+	{ 101444, 35425, 24 },
+	{ 101445, 35449, 24 },
+	{ 101446, 35473, 24 },
+	{ 101455, 35497, 23 },
+	{ 101456, 35520, 24 },
+	{ 101457, 35544, 24 },
+	{ 101458, 35568, 24 },
+	{ 101459, 35592, 23 },
+	{ 101460, 35615, 24 },
+	{ 101461, 35639, 24 },
+	{ 101462, 35663, 24 },
+	{ 101471, 35687, 23 },
+	{ 101472, 35710, 24 },
+	{ 101473, 35734, 24 },
+	{ 101474, 35758, 24 },
+	{ 101475, 35782, 23 },
+	{ 101476, 35805, 24 },
+	{ 101477, 35829, 24 },
+	{ 101478, 35853, 24 },
+	{ 102447, 35877, 22 },
+	{ 102448, 35899, 23 },
+	{ 102449, 35922, 23 },
+	{ 102450, 35945, 23 },
+	{ 102451, 35968, 22 },
+	{ 102452, 35990, 23 },
+	{ 102453, 36013, 23 },
+	{ 102454, 36036, 23 },
+	{ 102463, 36059, 24 },
+	{ 102464, 36083, 25 },
+	{ 102465, 36108, 25 },
+	{ 102466, 36133, 25 },
+	{ 102467, 36158, 24 },
+	{ 102468, 36182, 25 },
+	{ 102469, 36207, 25 },
+	{ 102470, 36232, 25 },
+	{ 102479, 36257, 24 },
+	{ 102480, 36281, 25 },
+	{ 102481, 36306, 25 },
+	{ 102482, 36331, 25 },
+	{ 102483, 36356, 24 },
+	{ 102484, 36380, 25 },
+	{ 102485, 36405, 25 },
+	{ 102486, 36430, 25 },
+	{ 102495, 36455, 24 },
+	{ 102496, 36479, 25 },
+	{ 102497, 36504, 25 },
+	{ 102498, 36529, 25 },
+	{ 102499, 36554, 24 },
+	{ 102500, 36578, 25 },
+	{ 102501, 36603, 25 },
+	{ 102502, 36628, 25 },
+	{ 103471, 36653, 14 },
+	{ 103472, 36667, 15 },
+	{ 103473, 36682, 15 },
+	{ 103474, 36697, 15 },
+	{ 103475, 36712, 14 },
+	{ 103476, 36726, 15 },
+	{ 103477, 36741, 15 },
+	{ 103478, 36756, 15 },
+	{ 103479, 36771, 15 },
+	{ 103480, 36786, 15 },
+	{ 103481, 36801, 15 },
+	{ 103487, 36816, 16 },
+	{ 103488, 36832, 17 },
+	{ 103489, 36864, 17 },
+	{ 103490, 36881, 17 },
+	{ 103491, 36898, 16 },
+	{ 103492, 36914, 17 },
+	{ 103493, 36931, 17 },
+	{ 103494, 36948, 17 },
+	{ 103495, 36965, 17 },
+	{ 103496, 36982, 17 },
+	{ 103497, 36999, 17 },
+	{ 103503, 37016, 16 },
+	{ 103504, 37032, 17 },
+	{ 103505, 37049, 17 },
+	{ 103506, 37066, 17 },
+	{ 103507, 37083, 16 },
+	{ 103508, 37099, 17 },
+	{ 103509, 37116, 17 },
+	{ 103510, 37133, 17 },
+	{ 103511, 37150, 17 },
+	{ 103512, 37167, 17 },
+	{ 103513, 37184, 17 },
+	{ 103519, 37201, 16 },
+	{ 103520, 37217, 17 },
+	{ 103521, 37234, 17 },
+	{ 103522, 37251, 17 },
+	{ 103523, 37268, 16 },
+	{ 103524, 37284, 17 },
+	{ 103525, 37301, 17 },
+	{ 103526, 37318, 17 },
+	{ 103527, 37335, 17 },
+	{ 103528, 37352, 17 },
+	{ 103529, 37369, 17 },
+	{ 104495, 37386, 15 },
+	{ 104496, 37401, 16 },
+	{ 104497, 37417, 16 },
+	{ 104498, 37433, 16 },
+	{ 104499, 37449, 15 },
+	{ 104500, 37464, 16 },
+	{ 104501, 37480, 16 },
+	{ 104502, 37496, 16 },
+	{ 104503, 37512, 16 },
+	{ 104504, 37528, 16 },
+	{ 104505, 37544, 16 },
+	{ 104511, 37560, 17 },
+	{ 104512, 37577, 18 },
+	{ 104513, 37595, 18 },
+	{ 104514, 37613, 18 },
+	{ 104515, 37631, 17 },
+	{ 104516, 37648, 18 },
+	{ 104517, 37666, 18 },
+	{ 104518, 37684, 18 },
+	{ 104519, 37702, 18 },
+	{ 104520, 37720, 18 },
+	{ 104521, 37738, 18 },
+	{ 104527, 37756, 17 },
+	{ 104528, 37773, 18 },
+	{ 104529, 37791, 18 },
+	{ 104530, 37809, 18 },
+	{ 104531, 37827, 17 },
+	{ 104532, 37844, 18 },
+	{ 104533, 37862, 18 },
+	{ 104534, 37880, 18 },
+	{ 104535, 37898, 18 },
+	{ 104536, 37916, 18 },
+	{ 104537, 37934, 18 },
+	{ 104543, 37952, 17 },
+	{ 104544, 37969, 18 },
+	{ 104545, 37987, 18 },
+	{ 104546, 38005, 18 },
+	{ 104547, 38023, 17 },
+	{ 104548, 38040, 18 },
+	{ 104549, 38058, 18 },
+	{ 104550, 38076, 18 },
+	{ 104551, 38094, 18 },
+	{ 104552, 38112, 18 },
+	{ 104553, 38130, 18 },
+	{ 105519, 38148, 18 },
+	{ 105520, 38166, 19 },
+	{ 105521, 38185, 19 },
+	{ 105522, 38204, 19 },
+	{ 105523, 38223, 18 },
+	{ 105524, 38241, 19 },
+	{ 105525, 38260, 19 },
+	{ 105526, 38279, 19 },
+	{ 105527, 38298, 19 },
+	{ 105528, 38317, 19 },
+	{ 105529, 38336, 19 },
+	{ 105535, 38355, 20 },
+	{ 105536, 38375, 21 },
+	{ 105537, 38396, 21 },
+	{ 105538, 38417, 21 },
+	{ 105539, 38438, 20 },
+	{ 105540, 38458, 21 },
+	{ 105541, 38479, 21 },
+	{ 105542, 38500, 21 },
+	{ 105543, 38521, 21 },
+	{ 105544, 38542, 21 },
+	{ 105545, 38563, 21 },
+	{ 105551, 38584, 20 },
+	{ 105552, 38604, 21 },
+	{ 105553, 38625, 21 },
+	{ 105554, 38646, 21 },
+	{ 105555, 38667, 20 },
+	{ 105556, 38687, 21 },
+	{ 105557, 38708, 21 },
+	{ 105558, 38729, 21 },
+	{ 105559, 38750, 21 },
+	{ 105560, 38771, 21 },
+	{ 105561, 38792, 21 },
+	{ 105567, 38813, 20 },
+	{ 105568, 38833, 21 },
+	{ 105569, 38854, 21 },
+	{ 105570, 38875, 21 },
+	{ 105571, 38896, 20 },
+	{ 105572, 38916, 21 },
+	{ 105573, 38937, 21 },
+	{ 105574, 38958, 21 },
+	{ 105575, 38979, 21 },
+	{ 105576, 39000, 21 },
+	{ 105577, 39021, 21 },
+	{ 106543, 39042, 26 },
+	{ 106544, 39068, 27 },
+	{ 106545, 39095, 27 },
+	{ 106546, 39122, 27 },
+	{ 106547, 39149, 26 },
+	{ 106548, 39175, 27 },
+	{ 106549, 39202, 27 },
+	{ 106550, 39229, 27 },
+	{ 106559, 39256, 28 },
+	{ 106560, 39284, 29 },
+	{ 106561, 39313, 29 },
+	{ 106562, 39342, 29 },
+	{ 106563, 39371, 28 },
+	{ 106564, 39399, 29 },
+	{ 106565, 39428, 29 },
+	{ 106566, 39457, 29 },
+	{ 106575, 39486, 28 },
+	{ 106576, 39514, 29 },
+	{ 106577, 39543, 29 },
+	{ 106578, 39572, 29 },
+	{ 106579, 39601, 28 },
+	{ 106580, 39629, 29 },
+	{ 106581, 39658, 29 },
+	{ 106582, 39687, 29 },
+	{ 106591, 39716, 28 },
+	{ 106592, 39744, 29 },
+	{ 106593, 39773, 29 },
+	{ 106594, 39802, 29 },
+	{ 106595, 39831, 28 },
+	{ 106596, 39859, 29 },
+	{ 106597, 39888, 29 },
+	{ 106598, 39917, 29 },
+	{ 107567, 39946, 13 },
+	{ 107568, 39959, 14 },
+	{ 107569, 39973, 14 },
+	{ 107570, 39987, 14 },
+	{ 107571, 40001, 13 },
+	{ 107572, 40014, 14 },
+	{ 107573, 40028, 14 },
+	{ 107574, 40042, 14 },
+	{ 107583, 40056, 15 },
+	{ 107584, 40071, 16 },
+	{ 107585, 40087, 16 },
+	{ 107586, 40103, 16 },
+	{ 107587, 40119, 15 },
+	{ 107588, 40134, 16 },
+	{ 107589, 40150, 16 },
+	{ 107590, 40166, 16 },
+	{ 107599, 40182, 15 },
+	{ 107600, 40197, 16 },
+	{ 107601, 40213, 16 },
+	{ 107602, 40229, 16 },
+	{ 107603, 40245, 15 },
+	{ 107604, 40260, 16 },
+	{ 107605, 40276, 16 },
+	{ 107606, 40292, 16 },
+	{ 107615, 40308, 15 },
+	{ 107616, 40323, 16 },
+	{ 107617, 40339, 16 },
+	{ 107618, 40355, 16 },
+	{ 107619, 40371, 15 },
+	{ 107620, 40386, 16 },
+	{ 107621, 40402, 16 },
+	{ 107622, 40418, 16 },
+	{ 108591, 40434, 13 },
+	{ 108592, 40447, 14 },
+	{ 108593, 40461, 14 },
+	{ 108594, 40475, 14 },
+	{ 108595, 40489, 13 },
+	{ 108596, 40502, 14 },
+	{ 108597, 40516, 14 },
+	{ 108598, 40530, 14 },
+	{ 108607, 40544, 15 },
+	{ 108608, 40559, 16 },
+	{ 108609, 40575, 16 },
+	{ 108610, 40591, 16 },
+	{ 108611, 40607, 15 },
+	{ 108612, 40622, 16 },
+	{ 108613, 40638, 16 },
+	{ 108614, 40654, 16 },
+	{ 108623, 40670, 15 },
+	{ 108624, 40685, 16 },
+	{ 108625, 40701, 16 },
+	{ 108626, 40717, 16 },
+	{ 108627, 40733, 15 },
+	{ 108628, 40748, 16 },
+	{ 108629, 40764, 16 },
+	{ 108630, 40780, 16 },
+	{ 108639, 40796, 15 },
+	{ 108640, 40811, 16 },
+	{ 108641, 40827, 16 },
+	{ 108642, 40843, 16 },
+	{ 108643, 40859, 15 },
+	{ 108644, 40874, 16 },
+	{ 108645, 40890, 16 },
+	{ 108646, 40906, 16 },
+	{ 109615, 40922, 13 },
+	{ 109616, 40935, 14 },
+	{ 109617, 40960, 14 },
+	{ 109618, 40974, 14 },
+	{ 109619, 40988, 13 },
+	{ 109620, 41001, 14 },
+	{ 109621, 41015, 14 },
+	{ 109622, 41029, 14 },
+	{ 109631, 41043, 15 },
+	{ 109632, 41058, 16 },
+	{ 109633, 41074, 16 },
+	{ 109634, 41090, 16 },
+	{ 109635, 41106, 15 },
+	{ 109636, 41121, 16 },
+	{ 109637, 41137, 16 },
+	{ 109638, 41153, 16 },
+	{ 109647, 41169, 15 },
+	{ 109648, 41184, 16 },
+	{ 109649, 41200, 16 },
+	{ 109650, 41216, 16 },
+	{ 109651, 41232, 15 },
+	{ 109652, 41247, 16 },
+	{ 109653, 41263, 16 },
+	{ 109654, 41279, 16 },
+	{ 109663, 41295, 15 },
+	{ 109664, 41310, 16 },
+	{ 109665, 41326, 16 },
+	{ 109666, 41342, 16 },
+	{ 109667, 41358, 15 },
+	{ 109668, 41373, 16 },
+	{ 109669, 41389, 16 },
+	{ 109670, 41405, 16 },
+	{ 110639, 41421, 13 },
+	{ 110640, 41434, 14 },
+	{ 110641, 41448, 14 },
+	{ 110642, 41462, 14 },
+	{ 110643, 41476, 13 },
+	{ 110644, 41489, 14 },
+	{ 110645, 41503, 14 },
+	{ 110646, 41517, 14 },
+	{ 110655, 41531, 15 },
+	{ 110656, 41546, 16 },
+	{ 110657, 41562, 16 },
+	{ 110658, 41578, 16 },
+	{ 110659, 41594, 15 },
+	{ 110660, 41609, 16 },
+	{ 110661, 41625, 16 },
+	{ 110662, 41641, 16 },
+	{ 110671, 41657, 15 },
+	{ 110672, 41672, 16 },
+	{ 110673, 41688, 16 },
+	{ 110674, 41704, 16 },
+	{ 110675, 41720, 15 },
+	{ 110676, 41735, 16 },
+	{ 110677, 41751, 16 },
+	{ 110678, 41767, 16 },
+	{ 110687, 41783, 15 },
+	{ 110688, 41798, 16 },
+	{ 110689, 41814, 16 },
+	{ 110690, 41830, 16 },
+	{ 110691, 41846, 15 },
+	{ 110692, 41861, 16 },
+	{ 110693, 41877, 16 },
+	{ 110694, 41893, 16 },
+	{ 111663, 41909, 17 },
+	{ 111664, 41926, 18 },
+	{ 111665, 41944, 18 },
+	{ 111666, 41962, 18 },
+	{ 111667, 41980, 17 },
+	{ 111668, 41997, 18 },
+	{ 111669, 42015, 18 },
+	{ 111670, 42033, 18 },
+	{ 111679, 42051, 19 },
+	{ 111680, 42070, 20 },
+	{ 111681, 42090, 20 },
+	{ 111682, 42110, 20 },
+	{ 111683, 42130, 19 },
+	{ 111684, 42149, 20 },
+	{ 111685, 42169, 20 },
+	{ 111686, 42189, 20 },
+	{ 111695, 42209, 19 },
+	{ 111696, 42228, 20 },
+	{ 111697, 42248, 20 },
+	{ 111698, 42268, 20 },
+	{ 111699, 42288, 19 },
+	{ 111700, 42307, 20 },
+	{ 111701, 42327, 20 },
+	{ 111702, 42347, 20 },
+	{ 111711, 42367, 19 },
+	{ 111712, 42386, 20 },
+	{ 111713, 42406, 20 },
+	{ 111714, 42426, 20 },
+	{ 111715, 42446, 19 },
+	{ 111716, 42465, 20 },
+	{ 111717, 42485, 20 },
+	{ 111718, 42505, 20 },
+	{ 112687, 42525, 16 },
+	{ 112688, 42541, 17 },
+	{ 112689, 42558, 17 },
+	{ 112690, 42575, 17 },
+	{ 112691, 42592, 16 },
+	{ 112692, 42608, 17 },
+	{ 112693, 42625, 17 },
+	{ 112694, 42642, 17 },
+	{ 112703, 42659, 18 },
+	{ 112704, 42677, 19 },
+	{ 112705, 42696, 19 },
+	{ 112706, 42715, 19 },
+	{ 112707, 42734, 18 },
+	{ 112708, 42752, 19 },
+	{ 112709, 42771, 19 },
+	{ 112710, 42790, 19 },
+	{ 112719, 42809, 18 },
+	{ 112720, 42827, 19 },
+	{ 112721, 42846, 19 },
+	{ 112722, 42865, 19 },
+	{ 112723, 42884, 18 },
+	{ 112724, 42902, 19 },
+	{ 112725, 42921, 19 },
+	{ 112726, 42940, 19 },
+	{ 112735, 42959, 18 },
+	{ 112736, 42977, 19 },
+	{ 112737, 42996, 19 },
+	{ 112738, 43015, 19 },
+	{ 112739, 43034, 18 },
+	{ 112740, 43052, 19 },
+	{ 112741, 43071, 19 },
+	{ 112742, 43090, 19 },
+	{ 113711, 43109, 17 },
+	{ 113712, 43126, 18 },
+	{ 113713, 43144, 18 },
+	{ 113714, 43162, 18 },
+	{ 113715, 43180, 17 },
+	{ 113716, 43197, 18 },
+	{ 113717, 43215, 18 },
+	{ 113718, 43233, 18 },
+	{ 113727, 43251, 19 },
+	{ 113728, 43270, 20 },
+	{ 113729, 43290, 20 },
+	{ 113730, 43310, 20 },
+	{ 113731, 43330, 19 },
+	{ 113732, 43349, 20 },
+	{ 113733, 43369, 20 },
+	{ 113734, 43389, 20 },
+	{ 113743, 43409, 19 },
+	{ 113744, 43428, 20 },
+	{ 113745, 43448, 20 },
+	{ 113746, 43468, 20 },
+	{ 113747, 43488, 19 },
+	{ 113748, 43507, 20 },
+	{ 113749, 43527, 20 },
+	{ 113750, 43547, 20 },
+	{ 113759, 43567, 19 },
+	{ 113760, 43586, 20 },
+	{ 113761, 43606, 20 },
+	{ 113762, 43626, 20 },
+	{ 113763, 43646, 19 },
+	{ 113764, 43665, 20 },
+	{ 113765, 43685, 20 },
+	{ 113766, 43705, 20 },
+	{ 114797, 43725, 33 },
+	{ 114798, 43758, 33 },
+	{ 114799, 43791, 32 },
+	{ 114800, 43823, 32 },
+	{ 114801, 43855, 29 },
+	{ 114802, 43884, 29 },
+	{ 114803, 43913, 28 },
+	{ 114804, 43941, 28 },
+	{ 114805, 43969, 27 },
+	{ 114806, 43996, 27 },
+	{ 114807, 44023, 26 },
+	{ 114808, 44049, 26 },
+	{ 114809, 44075, 37 },
+	{ 114810, 44112, 37 },
+	{ 114811, 44149, 37 },
+	{ 114812, 44186, 36 },
+	{ 114813, 44222, 36 },
+	{ 114814, 44258, 31 },
+	{ 114815, 44289, 31 },
+	{ 114816, 44320, 31 },
+	{ 114817, 44351, 30 },
+	{ 114818, 44381, 30 },
+	{ 114819, 44411, 28 },
+	{ 114820, 44439, 28 },
+	{ 114821, 44467, 28 },
+	{ 114822, 44495, 27 },
+	{ 114823, 44522, 27 },
+	{ 114824, 44549, 37 },
+	{ 114825, 44586, 36 },
+	{ 114826, 44622, 36 },
+	{ 114827, 44658, 31 },
+	{ 114828, 44689, 30 },
+	{ 114829, 44719, 30 },
+	{ 114830, 44749, 28 },
+	{ 114831, 44777, 27 },
+	{ 114832, 44804, 27 },
+	{ 114833, 44831, 27 },
+	{ 114834, 44858, 27 },
+	{ 114835, 44885, 34 },
+	{ 114836, 44919, 36 },
+	{ 114837, 44955, 35 },
+	{ 114838, 44990, 39 },
+	{ 114839, 45056, 39 },
+	{ 114840, 45095, 38 },
+	{ 114841, 45133, 38 },
+	{ 114842, 45171, 35 },
+	{ 114843, 45206, 35 },
+	{ 114844, 45241, 34 },
+	{ 114845, 45275, 34 },
+	{ 114846, 45309, 33 },
+	{ 114847, 45342, 33 },
+	{ 114848, 45375, 32 },
+	{ 114849, 45407, 32 },
+	{ 114850, 45439, 43 },
+	{ 114851, 45482, 43 },
+	{ 114852, 45525, 43 },
+	{ 114853, 45568, 42 },
+	{ 114854, 45610, 42 },
+	{ 114855, 45652, 37 },
+	{ 114856, 45689, 37 },
+	{ 114857, 45726, 37 },
+	{ 114858, 45763, 36 },
+	{ 114859, 45799, 36 },
+	{ 114860, 45835, 34 },
+	{ 114861, 45869, 34 },
+	{ 114862, 45903, 34 },
+	{ 114863, 45937, 33 },
+	{ 114864, 45970, 33 },
+	{ 114865, 46003, 43 },
+	{ 114866, 46046, 42 },
+	{ 114867, 46088, 42 },
+	{ 114868, 46130, 37 },
+	{ 114869, 46167, 36 },
+	{ 114870, 46203, 36 },
+	{ 114871, 46239, 34 },
+	{ 114872, 46273, 33 },
+	{ 114873, 46306, 33 },
+	{ 114874, 46339, 33 },
+	{ 114875, 46372, 33 },
+	{ 114876, 46405, 40 },
+	{ 114877, 46445, 42 },
+	{ 114878, 46487, 41 },
+	{ 114879, 46528, 36 },
+	{ 114880, 46564, 36 },
+	{ 114881, 46600, 35 },
+	{ 114882, 46635, 35 },
+	{ 114883, 46670, 32 },
+	{ 114884, 46702, 32 },
+	{ 114885, 46734, 31 },
+	{ 114886, 46765, 31 },
+	{ 114887, 46796, 30 },
+	{ 114888, 46826, 30 },
+	{ 114889, 46856, 29 },
+	{ 114890, 46885, 29 },
+	{ 114891, 46914, 40 },
+	{ 114892, 46954, 40 },
+	{ 114893, 46994, 40 },
+	{ 114894, 47034, 39 },
+	{ 114895, 47073, 39 },
+	{ 114896, 47112, 34 },
+	{ 114897, 47146, 34 },
+	{ 114898, 47180, 34 },
+	{ 114899, 47214, 33 },
+	{ 114900, 47247, 33 },
+	{ 114901, 47280, 31 },
+	{ 114902, 47311, 31 },
+	{ 114903, 47342, 31 },
+	{ 114904, 47373, 30 },
+	{ 114905, 47403, 30 },
+	{ 114906, 47433, 40 },
+	{ 114907, 47473, 39 },
+	{ 114908, 47512, 39 },
+	{ 114909, 47551, 34 },
+	{ 114910, 47585, 33 },
+	{ 114911, 47618, 33 },
+	{ 114912, 47651, 31 },
+	{ 114913, 47682, 30 },
+	{ 114914, 47712, 30 },
+	{ 114915, 47742, 30 },
+	{ 114916, 47772, 30 },
+	{ 114917, 47802, 37 },
+	{ 114918, 47839, 39 },
+	{ 114919, 47878, 38 },
+	{ 114920, 47916, 42 },
+	{ 114921, 47958, 42 },
+	{ 114922, 48000, 41 },
+	{ 114923, 48041, 41 },
+	{ 114924, 48082, 38 },
+	{ 114925, 48120, 38 },
+	{ 114926, 48158, 37 },
+	{ 114927, 48195, 37 },
+	{ 114928, 48232, 36 },
+	{ 114929, 48268, 36 },
+	{ 114930, 48304, 35 },
+	{ 114931, 48339, 35 },
+	{ 114932, 48374, 46 },
+	{ 114933, 48420, 46 },
+	{ 114934, 48466, 46 },
+	{ 114935, 48512, 45 },
+	{ 114936, 48557, 45 },
+	{ 114937, 48602, 40 },
+	{ 114938, 48642, 40 },
+	{ 114939, 48682, 40 },
+	{ 114940, 48722, 39 },
+	{ 114941, 48761, 39 },
+	{ 114942, 48800, 37 },
+	{ 114943, 48837, 37 },
+	{ 114944, 48874, 37 },
+	{ 114945, 48911, 36 },
+	{ 114946, 48947, 36 },
+	{ 114947, 48983, 46 },
+	{ 114948, 49029, 45 },
+	{ 114949, 49074, 45 },
+	{ 114950, 49152, 40 },
+	{ 114951, 49192, 39 },
+	{ 114952, 49231, 39 },
+	{ 114953, 49270, 37 },
+	{ 114954, 49307, 36 },
+	{ 114955, 49343, 36 },
+	{ 114956, 49379, 36 },
+	{ 114957, 49415, 36 },
+	{ 114958, 49451, 43 },
+	{ 114959, 49494, 45 },
+	{ 114960, 49539, 44 },
+	{ 114961, 49583, 33 },
+	{ 114962, 49616, 33 },
+	{ 114963, 49649, 32 },
+	{ 114964, 49681, 32 },
+	{ 114965, 49713, 29 },
+	{ 114966, 49742, 29 },
+	{ 114967, 49771, 28 },
+	{ 114968, 49799, 28 },
+	{ 114969, 49827, 27 },
+	{ 114970, 49854, 27 },
+	{ 114971, 49881, 26 },
+	{ 114972, 49907, 26 },
+	{ 114973, 49933, 37 },
+	{ 114974, 49970, 37 },
+	{ 114975, 50007, 37 },
+	{ 114976, 50044, 36 },
+	{ 114977, 50080, 36 },
+	{ 114978, 50116, 31 },
+	{ 114979, 50147, 31 },
+	{ 114980, 50178, 31 },
+	{ 114981, 50209, 30 },
+	{ 114982, 50239, 30 },
+	{ 114983, 50269, 28 },
+	{ 114984, 50297, 28 },
+	{ 114985, 50325, 28 },
+	{ 114986, 50353, 27 },
+	{ 114987, 50380, 27 },
+	{ 114988, 50407, 37 },
+	{ 114989, 50444, 36 },
+	{ 114990, 50480, 36 },
+	{ 114991, 50516, 31 },
+	{ 114992, 50547, 30 },
+	{ 114993, 50577, 30 },
+	{ 114994, 50607, 28 },
+	{ 114995, 50635, 27 },
+	{ 114996, 50662, 27 },
+	{ 114997, 50689, 27 },
+	{ 114998, 50716, 27 },
+	{ 114999, 50743, 34 },
+	{ 115000, 50777, 36 },
+	{ 115001, 50813, 35 },
+	{ 115002, 50848, 39 },
+	{ 115003, 50887, 39 },
+	{ 115004, 50926, 38 },
+	{ 115005, 50964, 38 },
+	{ 115006, 51002, 35 },
+	{ 115007, 51037, 35 },
+	{ 115008, 51072, 34 },
+	{ 115009, 51106, 34 },
+	{ 115010, 51140, 33 },
+	{ 115011, 51173, 33 },
+	{ 115012, 51206, 32 },
+	{ 115013, 51238, 32 },
+	{ 115014, 51270, 43 },
+	{ 115015, 51313, 43 },
+	{ 115016, 51356, 43 },
+	{ 115017, 51399, 42 },
+	{ 115018, 51441, 42 },
+	{ 115019, 51483, 37 },
+	{ 115020, 51520, 37 },
+	{ 115021, 51557, 37 },
+	{ 115022, 51594, 36 },
+	{ 115023, 51630, 36 },
+	{ 115024, 51666, 34 },
+	{ 115025, 51700, 34 },
+	{ 115026, 51734, 34 },
+	{ 115027, 51768, 33 },
+	{ 115028, 51801, 33 },
+	{ 115029, 51834, 43 },
+	{ 115030, 51877, 42 },
+	{ 115031, 51919, 42 },
+	{ 115032, 51961, 37 },
+	{ 115033, 51998, 36 },
+	{ 115034, 52034, 36 },
+	{ 115035, 52070, 34 },
+	{ 115036, 52104, 33 },
+	{ 115037, 52137, 33 },
+	{ 115038, 52170, 33 },
+	{ 115039, 52203, 33 },
+	{ 115040, 52236, 40 },
+	{ 115041, 52276, 42 },
+	{ 115042, 52318, 41 },
+	{ 115043, 52359, 36 },
+	{ 115044, 52395, 36 },
+	{ 115045, 52431, 35 },
+	{ 115046, 52466, 35 },
+	{ 115047, 52501, 32 },
+	{ 115048, 52533, 32 },
+	{ 115049, 52565, 31 },
+	{ 115050, 52596, 31 },
+	{ 115051, 52627, 30 },
+	{ 115052, 52657, 30 },
+	{ 115053, 52687, 29 },
+	{ 115054, 52716, 29 },
+	{ 115055, 52745, 40 },
+	{ 115056, 52785, 40 },
+	{ 115057, 52825, 40 },
+	{ 115058, 52865, 39 },
+	{ 115059, 52904, 39 },
+	{ 115060, 52943, 34 },
+	{ 115061, 52977, 34 },
+	{ 115062, 53011, 34 },
+	{ 115063, 53045, 33 },
+	{ 115064, 53078, 33 },
+	{ 115065, 53111, 31 },
+	{ 115066, 53142, 31 },
+	{ 115067, 53173, 31 },
+	{ 115068, 53204, 30 },
+	{ 115069, 53248, 30 },
+	{ 115070, 53278, 40 },
+	{ 115071, 53318, 39 },
+	{ 115072, 53357, 39 },
+	{ 115073, 53396, 34 },
+	{ 115074, 53430, 33 },
+	{ 115075, 53463, 33 },
+	{ 115076, 53496, 31 },
+	{ 115077, 53527, 30 },
+	{ 115078, 53557, 30 },
+	{ 115079, 53587, 30 },
+	{ 115080, 53617, 30 },
+	{ 115081, 53647, 37 },
+	{ 115082, 53684, 39 },
+	{ 115083, 53723, 38 },
+	{ 115084, 53761, 42 },
+	{ 115085, 53803, 42 },
+	{ 115086, 53845, 41 },
+	{ 115087, 53886, 41 },
+	{ 115088, 53927, 38 },
+	{ 115089, 53965, 38 },
+	{ 115090, 54003, 37 },
+	{ 115091, 54040, 37 },
+	{ 115092, 54077, 36 },
+	{ 115093, 54113, 36 },
+	{ 115094, 54149, 35 },
+	{ 115095, 54184, 35 },
+	{ 115096, 54219, 46 },
+	{ 115097, 54265, 46 },
+	{ 115098, 54311, 46 },
+	{ 115099, 54357, 45 },
+	{ 115100, 54402, 45 },
+	{ 115101, 54447, 40 },
+	{ 115102, 54487, 40 },
+	{ 115103, 54527, 40 },
+	{ 115104, 54567, 39 },
+	{ 115105, 54606, 39 },
+	{ 115106, 54645, 37 },
+	{ 115107, 54682, 37 },
+	{ 115108, 54719, 37 },
+	{ 115109, 54756, 36 },
+	{ 115110, 54792, 36 },
+	{ 115111, 54828, 46 },
+	{ 115112, 54874, 45 },
+	{ 115113, 54919, 45 },
+	{ 115114, 54964, 40 },
+	{ 115115, 55004, 39 },
+	{ 115116, 55043, 39 },
+	{ 115117, 55082, 37 },
+	{ 115118, 55119, 36 },
+	{ 115119, 55155, 36 },
+	{ 115120, 55191, 36 },
+	{ 115121, 55227, 36 },
+	{ 115122, 55263, 43 },
+	{ 115123, 55306, 45 },
+	{ 115124, 55351, 44 },
+	{ 115125, 55395, 33 },
+	{ 115126, 55428, 33 },
+	{ 115127, 55461, 32 },
+	{ 115128, 55493, 32 },
+	{ 115129, 55525, 29 },
+	{ 115130, 55554, 29 },
+	{ 115131, 55583, 28 },
+	{ 115132, 55611, 28 },
+	{ 115133, 55639, 27 },
+	{ 115134, 55666, 27 },
+	{ 115135, 55693, 26 },
+	{ 115136, 55719, 26 },
+	{ 115137, 55745, 37 },
+	{ 115138, 55782, 37 },
+	{ 115139, 55819, 37 },
+	{ 115140, 55856, 36 },
+	{ 115141, 55892, 36 },
+	{ 115142, 55928, 31 },
+	{ 115143, 55959, 31 },
+	{ 115144, 55990, 31 },
+	{ 115145, 56021, 30 },
+	{ 115146, 56051, 30 },
+	{ 115147, 56081, 28 },
+	{ 115148, 56109, 28 },
+	{ 115149, 56137, 28 },
+	{ 115150, 56165, 27 },
+	{ 115151, 56192, 27 },
+	{ 115152, 56219, 37 },
+	{ 115153, 56256, 36 },
+	{ 115154, 56292, 36 },
+	{ 115155, 56328, 31 },
+	{ 115156, 56359, 30 },
+	{ 115157, 56389, 30 },
+	{ 115158, 56419, 28 },
+	{ 115159, 56447, 27 },
+	{ 115160, 56474, 27 },
+	{ 115161, 56501, 27 },
+	{ 115162, 56528, 27 },
+	{ 115163, 56555, 34 },
+	{ 115164, 56589, 36 },
+	{ 115165, 56625, 35 },
+	{ 115166, 56660, 39 },
+	{ 115167, 56699, 39 },
+	{ 115168, 56738, 38 },
+	{ 115169, 56776, 38 },
+	{ 115170, 56814, 35 },
+	{ 115171, 56849, 35 },
+	{ 115172, 56884, 34 },
+	{ 115173, 56918, 34 },
+	{ 115174, 56952, 33 },
+	{ 115175, 56985, 33 },
+	{ 115176, 57018, 32 },
+	{ 115177, 57050, 32 },
+	{ 115178, 57082, 43 },
+	{ 115179, 57125, 43 },
+	{ 115180, 57168, 43 },
+	{ 115181, 57211, 42 },
+	{ 115182, 57253, 42 },
+	{ 115183, 57295, 37 },
+	{ 115184, 57344, 37 },
+	{ 115185, 57381, 37 },
+	{ 115186, 57418, 36 },
+	{ 115187, 57454, 36 },
+	{ 115188, 57490, 34 },
+	{ 115189, 57524, 34 },
+	{ 115190, 57558, 34 },
+	{ 115191, 57592, 33 },
+	{ 115192, 57625, 33 },
+	{ 115193, 57658, 43 },
+	{ 115194, 57701, 42 },
+	{ 115195, 57743, 42 },
+	{ 115196, 57785, 37 },
+	{ 115197, 57822, 36 },
+	{ 115198, 57858, 36 },
+	{ 115199, 57894, 34 },
+	{ 115200, 57928, 33 },
+	{ 115201, 57961, 33 },
+	{ 115202, 57994, 33 },
+	{ 115203, 58027, 33 },
+	{ 115204, 58060, 40 },
+	{ 115205, 58100, 42 },
+	{ 115206, 58142, 41 },
+	{ 115207, 58183, 36 },
+	{ 115208, 58219, 36 },
+	{ 115209, 58255, 35 },
+	{ 115210, 58290, 35 },
+	{ 115211, 58325, 32 },
+	{ 115212, 58357, 32 },
+	{ 115213, 58389, 31 },
+	{ 115214, 58420, 31 },
+	{ 115215, 58451, 30 },
+	{ 115216, 58481, 30 },
+	{ 115217, 58511, 29 },
+	{ 115218, 58540, 29 },
+	{ 115219, 58569, 40 },
+	{ 115220, 58609, 40 },
+	{ 115221, 58649, 40 },
+	{ 115222, 58689, 39 },
+	{ 115223, 58728, 39 },
+	{ 115224, 58767, 34 },
+	{ 115225, 58801, 34 },
+	{ 115226, 58835, 34 },
+	{ 115227, 58869, 33 },
+	{ 115228, 58902, 33 },
+	{ 115229, 58935, 31 },
+	{ 115230, 58966, 31 },
+	{ 115231, 58997, 31 },
+	{ 115232, 59028, 30 },
+	{ 115233, 59058, 30 },
+	{ 115234, 59088, 40 },
+	{ 115235, 59128, 39 },
+	{ 115236, 59167, 39 },
+	{ 115237, 59206, 34 },
+	{ 115238, 59240, 33 },
+	{ 115239, 59273, 33 },
+	{ 115240, 59306, 31 },
+	{ 115241, 59337, 30 },
+	{ 115242, 59367, 30 },
+	{ 115243, 59397, 30 },
+	{ 115244, 59427, 30 },
+	{ 115245, 59457, 37 },
+	{ 115246, 59494, 39 },
+	{ 115247, 59533, 38 },
+	{ 115248, 59571, 42 },
+	{ 115249, 59613, 42 },
+	{ 115250, 59655, 41 },
+	{ 115251, 59696, 41 },
+	{ 115252, 59737, 38 },
+	{ 115253, 59775, 38 },
+	{ 115254, 59813, 37 },
+	{ 115255, 59850, 37 },
+	{ 115256, 59887, 36 },
+	{ 115257, 59923, 36 },
+	{ 115258, 59959, 35 },
+	{ 115259, 59994, 35 },
+	{ 115260, 60029, 46 },
+	{ 115261, 60075, 46 },
+	{ 115262, 60121, 46 },
+	{ 115263, 60167, 45 },
+	{ 115264, 60212, 45 },
+	{ 115265, 60257, 40 },
+	{ 115266, 60297, 40 },
+	{ 115267, 60337, 40 },
+	{ 115268, 60377, 39 },
+	{ 115269, 60416, 39 },
+	{ 115270, 60455, 37 },
+	{ 115271, 60492, 37 },
+	{ 115272, 60529, 37 },
+	{ 115273, 60566, 36 },
+	{ 115274, 60602, 36 },
+	{ 115275, 60638, 46 },
+	{ 115276, 60684, 45 },
+	{ 115277, 60729, 45 },
+	{ 115278, 60774, 40 },
+	{ 115279, 60814, 39 },
+	{ 115280, 60853, 39 },
+	{ 115281, 60892, 37 },
+	{ 115282, 60929, 36 },
+	{ 115283, 60965, 36 },
+	{ 115284, 61001, 36 },
+	{ 115285, 61037, 36 },
+	{ 115286, 61073, 43 },
+	{ 115287, 61116, 45 },
+	{ 115288, 61161, 44 },
+	{ 115289, 61205, 35 },
+	{ 115290, 61240, 35 },
+	{ 115291, 61275, 34 },
+	{ 115292, 61309, 34 },
+	{ 115293, 61343, 31 },
+	{ 115294, 61374, 31 },
+	{ 115295, 61405, 30 },
+	{ 115296, 61440, 30 },
+	{ 115297, 61470, 29 },
+	{ 115298, 61499, 29 },
+	{ 115299, 61528, 28 },
+	{ 115300, 61556, 28 },
+	{ 115301, 61584, 39 },
+	{ 115302, 61623, 39 },
+	{ 115303, 61662, 39 },
+	{ 115304, 61701, 38 },
+	{ 115305, 61739, 38 },
+	{ 115306, 61777, 33 },
+	{ 115307, 61810, 33 },
+	{ 115308, 61843, 33 },
+	{ 115309, 61876, 32 },
+	{ 115310, 61908, 32 },
+	{ 115311, 61940, 30 },
+	{ 115312, 61970, 30 },
+	{ 115313, 62000, 30 },
+	{ 115314, 62030, 29 },
+	{ 115315, 62059, 29 },
+	{ 115316, 62088, 39 },
+	{ 115317, 62127, 38 },
+	{ 115318, 62165, 38 },
+	{ 115319, 62203, 33 },
+	{ 115320, 62236, 32 },
+	{ 115321, 62268, 32 },
+	{ 115322, 62300, 30 },
+	{ 115323, 62330, 29 },
+	{ 115324, 62359, 29 },
+	{ 115325, 62388, 29 },
+	{ 115326, 62417, 29 },
+	{ 115327, 62446, 36 },
+	{ 115328, 62482, 38 },
+	{ 115329, 62520, 37 },
+	{ 115330, 62557, 41 },
+	{ 115331, 62598, 41 },
+	{ 115332, 62639, 40 },
+	{ 115333, 62679, 40 },
+	{ 115334, 62719, 37 },
+	{ 115335, 62756, 37 },
+	{ 115336, 62793, 36 },
+	{ 115337, 62829, 36 },
+	{ 115338, 62865, 35 },
+	{ 115339, 62900, 35 },
+	{ 115340, 62935, 34 },
+	{ 115341, 62969, 34 },
+	{ 115342, 63003, 45 },
+	{ 115343, 63048, 45 },
+	{ 115344, 63093, 45 },
+	{ 115345, 63138, 44 },
+	{ 115346, 63182, 44 },
+	{ 115347, 63226, 39 },
+	{ 115348, 63265, 39 },
+	{ 115349, 63304, 39 },
+	{ 115350, 63343, 38 },
+	{ 115351, 63381, 38 },
+	{ 115352, 63419, 36 },
+	{ 115353, 63455, 36 },
+	{ 115354, 63491, 36 },
+	{ 115355, 63527, 35 },
+	{ 115356, 63562, 35 },
+	{ 115357, 63597, 45 },
+	{ 115358, 63642, 44 },
+	{ 115359, 63686, 44 },
+	{ 115360, 63730, 39 },
+	{ 115361, 63769, 38 },
+	{ 115362, 63807, 38 },
+	{ 115363, 63845, 36 },
+	{ 115364, 63881, 35 },
+	{ 115365, 63916, 35 },
+	{ 115366, 63951, 35 },
+	{ 115367, 63986, 35 },
+	{ 115368, 64021, 42 },
+	{ 115369, 64063, 44 },
+	{ 115370, 64107, 43 },
+	{ 115371, 64150, 38 },
+	{ 115372, 64188, 38 },
+	{ 115373, 64226, 37 },
+	{ 115374, 64263, 37 },
+	{ 115375, 64300, 34 },
+	{ 115376, 64334, 34 },
+	{ 115377, 64368, 33 },
+	{ 115378, 64401, 33 },
+	{ 115379, 64434, 32 },
+	{ 115380, 64466, 32 },
+	{ 115381, 64498, 31 },
+	{ 115382, 64529, 31 },
+	{ 115383, 64560, 42 },
+	{ 115384, 64602, 42 },
+	{ 115385, 64644, 42 },
+	{ 115386, 64686, 41 },
+	{ 115387, 64727, 41 },
+	{ 115388, 64768, 36 },
+	{ 115389, 64804, 36 },
+	{ 115390, 64840, 36 },
+	{ 115391, 64876, 35 },
+	{ 115392, 64911, 35 },
+	{ 115393, 64946, 33 },
+	{ 115394, 64979, 33 },
+	{ 115395, 65012, 33 },
+	{ 115396, 65045, 32 },
+	{ 115397, 65077, 32 },
+	{ 115398, 65109, 42 },
+	{ 115399, 65151, 41 },
+	{ 115400, 65192, 41 },
+	{ 115401, 65233, 36 },
+	{ 115402, 65269, 35 },
+	{ 115403, 65304, 35 },
+	{ 115404, 65339, 33 },
+	{ 115405, 65372, 32 },
+	{ 115406, 65404, 32 },
+	{ 115407, 65436, 32 },
+	{ 115408, 65468, 32 },
+	{ 115409, 65536, 39 },
+	{ 115410, 65575, 41 },
+	{ 115411, 65616, 40 },
+	{ 115412, 65656, 44 },
+	{ 115413, 65700, 44 },
+	{ 115414, 65744, 43 },
+	{ 115415, 65787, 43 },
+	{ 115416, 65830, 40 },
+	{ 115417, 65870, 40 },
+	{ 115418, 65910, 39 },
+	{ 115419, 65949, 39 },
+	{ 115420, 65988, 38 },
+	{ 115421, 66026, 38 },
+	{ 115422, 66064, 37 },
+	{ 115423, 66101, 37 },
+	{ 115424, 66138, 48 },
+	{ 115425, 66186, 48 },
+	{ 115426, 66234, 48 },
+	{ 115427, 66282, 47 },
+	{ 115428, 66329, 47 },
+	{ 115429, 66376, 42 },
+	{ 115430, 66418, 42 },
+	{ 115431, 66460, 42 },
+	{ 115432, 66502, 41 },
+	{ 115433, 66543, 41 },
+	{ 115434, 66584, 39 },
+	{ 115435, 66623, 39 },
+	{ 115436, 66662, 39 },
+	{ 115437, 66701, 38 },
+	{ 115438, 66739, 38 },
+	{ 115439, 66777, 48 },
+	{ 115440, 66825, 47 },
+	{ 115441, 66872, 47 },
+	{ 115442, 66919, 42 },
+	{ 115443, 66961, 41 },
+	{ 115444, 67002, 41 },
+	{ 115445, 67043, 39 },
+	{ 115446, 67082, 38 },
+	{ 115447, 67120, 38 },
+	{ 115448, 67158, 38 },
+	{ 115449, 67196, 38 },
+	{ 115450, 67234, 45 },
+	{ 115451, 67279, 47 },
+	{ 115452, 67326, 46 },
+	{ 115821, 67372, 20 },
+	{ 115822, 67392, 20 },
+	{ 115823, 67412, 20 },
+	{ 115824, 67432, 20 },
+	{ 115825, 67452, 20 },
+	{ 115826, 67472, 22 },
+	{ 115827, 67494, 22 },
+	{ 115828, 67516, 22 },
+	{ 115829, 67538, 22 },
+	{ 115830, 67560, 22 },
+	{ 115831, 67582, 22 },
+	{ 115832, 67604, 22 },
+	{ 115833, 67626, 22 },
+	{ 115834, 67648, 22 },
+	{ 115835, 67670, 26 },
+	{ 115836, 67696, 26 },
+	{ 115837, 67722, 26 },
+	{ 115838, 67748, 26 },
+	{ 115839, 67774, 26 },
+	{ 115840, 67800, 28 },
+	{ 115841, 67828, 28 },
+	{ 115842, 67856, 28 },
+	{ 115843, 67884, 28 },
+	{ 115844, 67912, 28 },
+	{ 115845, 67940, 28 },
+	{ 115846, 67968, 28 },
+	{ 115847, 67996, 28 },
+	{ 115848, 68024, 28 },
+	{ 115849, 68052, 23 },
+	{ 115850, 68075, 23 },
+	{ 115851, 68098, 23 },
+	{ 115852, 68121, 23 },
+	{ 115853, 68144, 23 },
+	{ 115854, 68167, 25 },
+	{ 115855, 68192, 25 },
+	{ 115856, 68217, 25 },
+	{ 115857, 68242, 25 },
+	{ 115858, 68267, 25 },
+	{ 115859, 68292, 25 },
+	{ 115860, 68317, 25 },
+	{ 115861, 68342, 25 },
+	{ 115862, 68367, 25 },
+	{ 115863, 68392, 29 },
+	{ 115864, 68421, 29 },
+	{ 115865, 68450, 29 },
+	{ 115866, 68479, 29 },
+	{ 115867, 68508, 29 },
+	{ 115868, 68537, 31 },
+	{ 115869, 68568, 31 },
+	{ 115870, 68599, 31 },
+	{ 115871, 68630, 31 },
+	{ 115872, 68661, 31 },
+	{ 115873, 68692, 31 },
+	{ 115874, 68723, 31 },
+	{ 115875, 68754, 31 },
+	{ 115876, 68785, 31 },
+	{ 115877, 68816, 20 },
+	{ 115878, 68836, 20 },
+	{ 115879, 68856, 20 },
+	{ 115880, 68876, 20 },
+	{ 115881, 68896, 20 },
+	{ 115882, 68916, 22 },
+	{ 115883, 68938, 22 },
+	{ 115884, 68960, 22 },
+	{ 115885, 68982, 22 },
+	{ 115886, 69004, 22 },
+	{ 115887, 69026, 22 },
+	{ 115888, 69048, 22 },
+	{ 115889, 69070, 22 },
+	{ 115890, 69092, 22 },
+	{ 115891, 69114, 26 },
+	{ 115892, 69140, 26 },
+	{ 115893, 69166, 26 },
+	{ 115894, 69192, 26 },
+	{ 115895, 69218, 26 },
+	{ 115896, 69244, 28 },
+	{ 115897, 69272, 28 },
+	{ 115898, 69300, 28 },
+	{ 115899, 69328, 28 },
+	{ 115900, 69356, 28 },
+	{ 115901, 69384, 28 },
+	{ 115902, 69412, 28 },
+	{ 115903, 69440, 28 },
+	{ 115904, 69468, 28 },
+	{ 115905, 69496, 23 },
+	{ 115906, 69519, 23 },
+	{ 115907, 69542, 23 },
+	{ 115908, 69565, 23 },
+	{ 115909, 69588, 23 },
+	{ 115910, 69632, 25 },
+	{ 115911, 69657, 25 },
+	{ 115912, 69682, 25 },
+	{ 115913, 69707, 25 },
+	{ 115914, 69732, 25 },
+	{ 115915, 69757, 25 },
+	{ 115916, 69782, 25 },
+	{ 115917, 69807, 25 },
+	{ 115918, 69832, 25 },
+	{ 115919, 69857, 29 },
+	{ 115920, 69886, 29 },
+	{ 115921, 69915, 29 },
+	{ 115922, 69944, 29 },
+	{ 115923, 69973, 29 },
+	{ 115924, 70002, 31 },
+	{ 115925, 70033, 31 },
+	{ 115926, 70064, 31 },
+	{ 115927, 70095, 31 },
+	{ 115928, 70126, 31 },
+	{ 115929, 70157, 31 },
+	{ 115930, 70188, 31 },
+	{ 115931, 70219, 31 },
+	{ 115932, 70250, 31 },
+	{ 115933, 70281, 20 },
+	{ 115934, 70301, 20 },
+	{ 115935, 70321, 20 },
+	{ 115936, 70341, 20 },
+	{ 115937, 70361, 20 },
+	{ 115938, 70381, 22 },
+	{ 115939, 70403, 22 },
+	{ 115940, 70425, 22 },
+	{ 115941, 70447, 22 },
+	{ 115942, 70469, 22 },
+	{ 115943, 70491, 22 },
+	{ 115944, 70513, 22 },
+	{ 115945, 70535, 22 },
+	{ 115946, 70557, 22 },
+	{ 115947, 70579, 26 },
+	{ 115948, 70605, 26 },
+	{ 115949, 70631, 26 },
+	{ 115950, 70657, 26 },
+	{ 115951, 70683, 26 },
+	{ 115952, 70709, 28 },
+	{ 115953, 70737, 28 },
+	{ 115954, 70765, 28 },
+	{ 115955, 70793, 28 },
+	{ 115956, 70821, 28 },
+	{ 115957, 70849, 28 },
+	{ 115958, 70877, 28 },
+	{ 115959, 70905, 28 },
+	{ 115960, 70933, 28 },
+	{ 115961, 70961, 23 },
+	{ 115962, 70984, 23 },
+	{ 115963, 71007, 23 },
+	{ 115964, 71030, 23 },
+	{ 115965, 71053, 23 },
+	{ 115966, 71076, 25 },
+	{ 115967, 71101, 25 },
+	{ 115968, 71126, 25 },
+	{ 115969, 71151, 25 },
+	{ 115970, 71176, 25 },
+	{ 115971, 71201, 25 },
+	{ 115972, 71226, 25 },
+	{ 115973, 71251, 25 },
+	{ 115974, 71276, 25 },
+	{ 115975, 71301, 29 },
+	{ 115976, 71330, 29 },
+	{ 115977, 71359, 29 },
+	{ 115978, 71388, 29 },
+	{ 115979, 71417, 29 },
+	{ 115980, 71446, 31 },
+	{ 115981, 71477, 31 },
+	{ 115982, 71508, 31 },
+	{ 115983, 71539, 31 },
+	{ 115984, 71570, 31 },
+	{ 115985, 71601, 31 },
+	{ 115986, 71632, 31 },
+	{ 115987, 71663, 31 },
+	{ 115988, 71694, 31 },
+	{ 115989, 71725, 22 },
+	{ 115990, 71747, 22 },
+	{ 115991, 71769, 22 },
+	{ 115992, 71791, 22 },
+	{ 115993, 71813, 22 },
+	{ 115994, 71835, 24 },
+	{ 115995, 71859, 24 },
+	{ 115996, 71883, 24 },
+	{ 115997, 71907, 24 },
+	{ 115998, 71931, 24 },
+	{ 115999, 71955, 24 },
+	{ 116000, 71979, 24 },
+	{ 116001, 72003, 24 },
+	{ 116002, 72027, 24 },
+	{ 116003, 72051, 28 },
+	{ 116004, 72079, 28 },
+	{ 116005, 72107, 28 },
+	{ 116006, 72135, 28 },
+	{ 116007, 72163, 28 },
+	{ 116008, 72191, 30 },
+	{ 116009, 72221, 30 },
+	{ 116010, 72251, 30 },
+	{ 116011, 72281, 30 },
+	{ 116012, 72311, 30 },
+	{ 116013, 72341, 30 },
+	{ 116014, 72371, 30 },
+	{ 116015, 72401, 30 },
+	{ 116016, 72431, 30 },
+	{ 116017, 72461, 25 },
+	{ 116018, 72486, 25 },
+	{ 116019, 72511, 25 },
+	{ 116020, 72536, 25 },
+	{ 116021, 72561, 25 },
+	{ 116022, 72586, 27 },
+	{ 116023, 72613, 27 },
+	{ 116024, 72640, 27 },
+	{ 116025, 72667, 27 },
+	{ 116026, 72694, 27 },
+	{ 116027, 72721, 27 },
+	{ 116028, 72748, 27 },
+	{ 116029, 72775, 27 },
+	{ 116030, 72802, 27 },
+	{ 116031, 72829, 31 },
+	{ 116032, 72860, 31 },
+	{ 116033, 72891, 31 },
+	{ 116034, 72922, 31 },
+	{ 116035, 72953, 31 },
+	{ 116036, 72984, 33 },
+	{ 116037, 73017, 33 },
+	{ 116038, 73050, 33 },
+	{ 116039, 73083, 33 },
+	{ 116040, 73116, 33 },
+	{ 116041, 73149, 33 },
+	{ 116042, 73182, 33 },
+	{ 116043, 73215, 33 },
+	{ 116044, 73248, 33 },
+	{ 116845, 73281, 21 },
+	{ 116846, 73302, 21 },
+	{ 116847, 73323, 21 },
+	{ 116848, 73344, 21 },
+	{ 116849, 73365, 21 },
+	{ 116850, 73386, 23 },
+	{ 116851, 73409, 23 },
+	{ 116852, 73432, 23 },
+	{ 116853, 73455, 23 },
+	{ 116854, 73478, 23 },
+	{ 116855, 73501, 23 },
+	{ 116856, 73524, 23 },
+	{ 116857, 73547, 23 },
+	{ 116858, 73570, 23 },
+	{ 116859, 73593, 27 },
+	{ 116860, 73620, 27 },
+	{ 116861, 73647, 27 },
+	{ 116862, 73674, 27 },
+	{ 116863, 73728, 27 },
+	{ 116864, 73755, 29 },
+	{ 116865, 73784, 29 },
+	{ 116866, 73813, 29 },
+	{ 116867, 73842, 29 },
+	{ 116868, 73871, 29 },
+	{ 116869, 73900, 29 },
+	{ 116870, 73929, 29 },
+	{ 116871, 73958, 29 },
+	{ 116872, 73987, 29 },
+	{ 116873, 74016, 24 },
+	{ 116874, 74040, 24 },
+	{ 116875, 74064, 24 },
+	{ 116876, 74088, 24 },
+	{ 116877, 74112, 24 },
+	{ 116878, 74136, 26 },
+	{ 116879, 74162, 26 },
+	{ 116880, 74188, 26 },
+	{ 116881, 74214, 26 },
+	{ 116882, 74240, 26 },
+	{ 116883, 74266, 26 },
+	{ 116884, 74292, 26 },
+	{ 116885, 74318, 26 },
+	{ 116886, 74344, 26 },
+	{ 116887, 74370, 30 },
+	{ 116888, 74400, 30 },
+	{ 116889, 74430, 30 },
+	{ 116890, 74460, 30 },
+	{ 116891, 74490, 30 },
+	{ 116892, 74520, 32 },
+	{ 116893, 74552, 32 },
+	{ 116894, 74584, 32 },
+	{ 116895, 74616, 32 },
+	{ 116896, 74648, 32 },
+	{ 116897, 74680, 32 },
+	{ 116898, 74712, 32 },
+	{ 116899, 74744, 32 },
+	{ 116900, 74776, 32 },
+	{ 116901, 74808, 21 },
+	{ 116902, 74829, 21 },
+	{ 116903, 74850, 21 },
+	{ 116904, 74871, 21 },
+	{ 116905, 74892, 21 },
+	{ 116906, 74913, 23 },
+	{ 116907, 74936, 23 },
+	{ 116908, 74959, 23 },
+	{ 116909, 74982, 23 },
+	{ 116910, 75005, 23 },
+	{ 116911, 75028, 23 },
+	{ 116912, 75051, 23 },
+	{ 116913, 75074, 23 },
+	{ 116914, 75097, 23 },
+	{ 116915, 75120, 27 },
+	{ 116916, 75147, 27 },
+	{ 116917, 75174, 27 },
+	{ 116918, 75201, 27 },
+	{ 116919, 75228, 27 },
+	{ 116920, 75255, 29 },
+	{ 116921, 75284, 29 },
+	{ 116922, 75313, 29 },
+	{ 116923, 75342, 29 },
+	{ 116924, 75371, 29 },
+	{ 116925, 75400, 29 },
+	{ 116926, 75429, 29 },
+	{ 116927, 75458, 29 },
+	{ 116928, 75487, 29 },
+	{ 116929, 75516, 24 },
+	{ 116930, 75540, 24 },
+	{ 116931, 75564, 24 },
+	{ 116932, 75588, 24 },
+	{ 116933, 75612, 24 },
+	{ 116934, 75636, 26 },
+	{ 116935, 75662, 26 },
+	{ 116936, 75688, 26 },
+	{ 116937, 75714, 26 },
+	{ 116938, 75740, 26 },
+	{ 116939, 75766, 26 },
+	{ 116940, 75792, 26 },
+	{ 116941, 75818, 26 },
+	{ 116942, 75844, 26 },
+	{ 116943, 75870, 30 },
+	{ 116944, 75900, 30 },
+	{ 116945, 75930, 30 },
+	{ 116946, 75960, 30 },
+	{ 116947, 75990, 30 },
+	{ 116948, 76020, 32 },
+	{ 116949, 76052, 32 },
+	{ 116950, 76084, 32 },
+	{ 116951, 76116, 32 },
+	{ 116952, 76148, 32 },
+	{ 116953, 76180, 32 },
+	{ 116954, 76212, 32 },
+	{ 116955, 76244, 32 },
+	{ 116956, 76276, 32 },
+	{ 116957, 76308, 21 },
+	{ 116958, 76329, 21 },
+	{ 116959, 76350, 21 },
+	{ 116960, 76371, 21 },
+	{ 116961, 76392, 21 },
+	{ 116962, 76413, 23 },
+	{ 116963, 76436, 23 },
+	{ 116964, 76459, 23 },
+	{ 116965, 76482, 23 },
+	{ 116966, 76505, 23 },
+	{ 116967, 76528, 23 },
+	{ 116968, 76551, 23 },
+	{ 116969, 76574, 23 },
+	{ 116970, 76597, 23 },
+	{ 116971, 76620, 27 },
+	{ 116972, 76647, 27 },
+	{ 116973, 76674, 27 },
+	{ 116974, 76701, 27 },
+	{ 116975, 76728, 27 },
+	{ 116976, 76755, 29 },
+	{ 116977, 76784, 29 },
+	{ 116978, 76813, 29 },
+	{ 116979, 76842, 29 },
+	{ 116980, 76871, 29 },
+	{ 116981, 76900, 29 },
+	{ 116982, 76929, 29 },
+	{ 116983, 76958, 29 },
+	{ 116984, 76987, 29 },
+	{ 116985, 77016, 24 },
+	{ 116986, 77040, 24 },
+	{ 116987, 77064, 24 },
+	{ 116988, 77088, 24 },
+	{ 116989, 77112, 24 },
+	{ 116990, 77136, 26 },
+	{ 116991, 77162, 26 },
+	{ 116992, 77188, 26 },
+	{ 116993, 77214, 26 },
+	{ 116994, 77240, 26 },
+	{ 116995, 77266, 26 },
+	{ 116996, 77292, 26 },
+	{ 116997, 77318, 26 },
+	{ 116998, 77344, 26 },
+	{ 116999, 77370, 30 },
+	{ 117000, 77400, 30 },
+	{ 117001, 77430, 30 },
+	{ 117002, 77460, 30 },
+	{ 117003, 77490, 30 },
+	{ 117004, 77520, 32 },
+	{ 117005, 77552, 32 },
+	{ 117006, 77584, 32 },
+	{ 117007, 77616, 32 },
+	{ 117008, 77648, 32 },
+	{ 117009, 77680, 32 },
+	{ 117010, 77712, 32 },
+	{ 117011, 77744, 32 },
+	{ 117012, 77776, 32 },
+	{ 117013, 77824, 23 },
+	{ 117014, 77847, 23 },
+	{ 117015, 77870, 23 },
+	{ 117016, 77893, 23 },
+	{ 117017, 77916, 23 },
+	{ 117018, 77939, 25 },
+	{ 117019, 77964, 25 },
+	{ 117020, 77989, 25 },
+	{ 117021, 78014, 25 },
+	{ 117022, 78039, 25 },
+	{ 117023, 78064, 25 },
+	{ 117024, 78089, 25 },
+	{ 117025, 78114, 25 },
+	{ 117026, 78139, 25 },
+	{ 117027, 78164, 29 },
+	{ 117028, 78193, 29 },
+	{ 117029, 78222, 29 },
+	{ 117030, 78251, 29 },
+	{ 117031, 78280, 29 },
+	{ 117032, 78309, 31 },
+	{ 117033, 78340, 31 },
+	{ 117034, 78371, 31 },
+	{ 117035, 78402, 31 },
+	{ 117036, 78433, 31 },
+	{ 117037, 78464, 31 },
+	{ 117038, 78495, 31 },
+	{ 117039, 78526, 31 },
+	{ 117040, 78557, 31 },
+	{ 117041, 78588, 26 },
+	{ 117042, 78614, 26 },
+	{ 117043, 78640, 26 },
+	{ 117044, 78666, 26 },
+	{ 117045, 78692, 26 },
+	{ 117046, 78718, 28 },
+	{ 117047, 78746, 28 },
+	{ 117048, 78774, 28 },
+	{ 117049, 78802, 28 },
+	{ 117050, 78830, 28 },
+	{ 117051, 78858, 28 },
+	{ 117052, 78886, 28 },
+	{ 117053, 78914, 28 },
+	{ 117054, 78942, 28 },
+	{ 117055, 78970, 32 },
+	{ 117056, 79002, 32 },
+	{ 117057, 79034, 32 },
+	{ 117058, 79066, 32 },
+	{ 117059, 79098, 32 },
+	{ 117060, 79130, 34 },
+	{ 117061, 79164, 34 },
+	{ 117062, 79198, 34 },
+	{ 117063, 79232, 34 },
+	{ 117064, 79266, 34 },
+	{ 117065, 79300, 34 },
+	{ 117066, 79334, 34 },
+	{ 117067, 79368, 34 },
+	{ 117068, 79402, 34 },
+	{ 117869, 79436, 30 },
+	{ 117870, 79466, 30 },
+	{ 117871, 79496, 30 },
+	{ 117872, 79526, 30 },
+	{ 117873, 79556, 30 },
+	{ 117874, 79586, 32 },
+	{ 117875, 79618, 32 },
+	{ 117876, 79650, 32 },
+	{ 117877, 79682, 32 },
+	{ 117878, 79714, 32 },
+	{ 117879, 79746, 32 },
+	{ 117880, 79778, 32 },
+	{ 117881, 79810, 32 },
+	{ 117882, 79842, 32 },
+	{ 117883, 79874, 36 },
+	{ 117884, 79910, 36 },
+	{ 117885, 79946, 36 },
+	{ 117886, 79982, 36 },
+	{ 117887, 80018, 36 },
+	{ 117888, 80054, 38 },
+	{ 117889, 80092, 38 },
+	{ 117890, 80130, 38 },
+	{ 117891, 80168, 38 },
+	{ 117892, 80206, 38 },
+	{ 117893, 80244, 38 },
+	{ 117894, 80282, 38 },
+	{ 117895, 80320, 38 },
+	{ 117896, 80358, 38 },
+	{ 117897, 80396, 33 },
+	{ 117898, 80429, 33 },
+	{ 117899, 80462, 33 },
+	{ 117900, 80495, 33 },
+	{ 117901, 80528, 33 },
+	{ 117902, 80561, 35 },
+	{ 117903, 80596, 35 },
+	{ 117904, 80631, 35 },
+	{ 117905, 80666, 35 },
+	{ 117906, 80701, 35 },
+	{ 117907, 80736, 35 },
+	{ 117908, 80771, 35 },
+	{ 117909, 80806, 35 },
+	{ 117910, 80841, 35 },
+	{ 117911, 80876, 39 },
+	{ 117912, 80915, 39 },
+	{ 117913, 80954, 39 },
+	{ 117914, 80993, 39 },
+	{ 117915, 81032, 39 },
+	{ 117916, 81071, 41 },
+	{ 117917, 81112, 41 },
+	{ 117918, 81153, 41 },
+	{ 117919, 81194, 41 },
+	{ 117920, 81235, 41 },
+	{ 117921, 81276, 41 },
+	{ 117922, 81317, 41 },
+	{ 117923, 81358, 41 },
+	{ 117924, 81399, 41 },
+	{ 117925, 81440, 30 },
+	{ 117926, 81470, 30 },
+	{ 117927, 81500, 30 },
+	{ 117928, 81530, 30 },
+	{ 117929, 81560, 30 },
+	{ 117930, 81590, 32 },
+	{ 117931, 81622, 32 },
+	{ 117932, 81654, 32 },
+	{ 117933, 81686, 32 },
+	{ 117934, 81718, 32 },
+	{ 117935, 81750, 32 },
+	{ 117936, 81782, 32 },
+	{ 117937, 81814, 32 },
+	{ 117938, 81846, 32 },
+	{ 117939, 81878, 36 },
+	{ 117940, 81920, 36 },
+	{ 117941, 81956, 36 },
+	{ 117942, 81992, 36 },
+	{ 117943, 82028, 36 },
+	{ 117944, 82064, 38 },
+	{ 117945, 82102, 38 },
+	{ 117946, 82140, 38 },
+	{ 117947, 82178, 38 },
+	{ 117948, 82216, 38 },
+	{ 117949, 82254, 38 },
+	{ 117950, 82292, 38 },
+	{ 117951, 82330, 38 },
+	{ 117952, 82368, 38 },
+	{ 117953, 82406, 33 },
+	{ 117954, 82439, 33 },
+	{ 117955, 82472, 33 },
+	{ 117956, 82505, 33 },
+	{ 117957, 82538, 33 },
+	{ 117958, 82571, 35 },
+	{ 117959, 82606, 35 },
+	{ 117960, 82641, 35 },
+	{ 117961, 82676, 35 },
+	{ 117962, 82711, 35 },
+	{ 117963, 82746, 35 },
+	{ 117964, 82781, 35 },
+	{ 117965, 82816, 35 },
+	{ 117966, 82851, 35 },
+	{ 117967, 82886, 39 },
+	{ 117968, 82925, 39 },
+	{ 117969, 82964, 39 },
+	{ 117970, 83003, 39 },
+	{ 117971, 83042, 39 },
+	{ 117972, 83081, 41 },
+	{ 117973, 83122, 41 },
+	{ 117974, 83163, 41 },
+	{ 117975, 83204, 41 },
+	{ 117976, 83245, 41 },
+	{ 117977, 83286, 41 },
+	{ 117978, 83327, 41 },
+	{ 117979, 83368, 41 },
+	{ 117980, 83409, 41 },
+	{ 117981, 83450, 30 },
+	{ 117982, 83480, 30 },
+	{ 117983, 83510, 30 },
+	{ 117984, 83540, 30 },
+	{ 117985, 83570, 30 },
+	{ 117986, 83600, 32 },
+	{ 117987, 83632, 32 },
+	{ 117988, 83664, 32 },
+	{ 117989, 83696, 32 },
+	{ 117990, 83728, 32 },
+	{ 117991, 83760, 32 },
+	{ 117992, 83792, 32 },
+	{ 117993, 83824, 32 },
+	{ 117994, 83856, 32 },
+	{ 117995, 83888, 36 },
+	{ 117996, 83924, 36 },
+	{ 117997, 83960, 36 },
+	{ 117998, 83996, 36 },
+	{ 117999, 84032, 36 },
+	{ 118000, 84068, 38 },
+	{ 118001, 84106, 38 },
+	{ 118002, 84144, 38 },
+	{ 118003, 84182, 38 },
+	{ 118004, 84220, 38 },
+	{ 118005, 84258, 38 },
+	{ 118006, 84296, 38 },
+	{ 118007, 84334, 38 },
+	{ 118008, 84372, 38 },
+	{ 118009, 84410, 33 },
+	{ 118010, 84443, 33 },
+	{ 118011, 84476, 33 },
+	{ 118012, 84509, 33 },
+	{ 118013, 84542, 33 },
+	{ 118014, 84575, 35 },
+	{ 118015, 84610, 35 },
+	{ 118016, 84645, 35 },
+	{ 118017, 84680, 35 },
+	{ 118018, 84715, 35 },
+	{ 118019, 84750, 35 },
+	{ 118020, 84785, 35 },
+	{ 118021, 84820, 35 },
+	{ 118022, 84855, 35 },
+	{ 118023, 84890, 39 },
+	{ 118024, 84929, 39 },
+	{ 118025, 84968, 39 },
+	{ 118026, 85007, 39 },
+	{ 118027, 85046, 39 },
+	{ 118028, 85085, 41 },
+	{ 118029, 85126, 41 },
+	{ 118030, 85167, 41 },
+	{ 118031, 85208, 41 },
+	{ 118032, 85249, 41 },
+	{ 118033, 85290, 41 },
+	{ 118034, 85331, 41 },
+	{ 118035, 85372, 41 },
+	{ 118036, 85413, 41 },
+	{ 118037, 85454, 32 },
+	{ 118038, 85486, 32 },
+	{ 118039, 85518, 32 },
+	{ 118040, 85550, 32 },
+	{ 118041, 85582, 32 },
+	{ 118042, 85614, 34 },
+	{ 118043, 85648, 34 },
+	{ 118044, 85682, 34 },
+	{ 118045, 85716, 34 },
+	{ 118046, 85750, 34 },
+	{ 118047, 85784, 34 },
+	{ 118048, 85818, 34 },
+	{ 118049, 85852, 34 },
+	{ 118050, 85886, 34 },
+	{ 118051, 85920, 38 },
+	{ 118052, 85958, 38 },
+	{ 118053, 86016, 38 },
+	{ 118054, 86054, 38 },
+	{ 118055, 86092, 38 },
+	{ 118056, 86130, 40 },
+	{ 118057, 86170, 40 },
+	{ 118058, 86210, 40 },
+	{ 118059, 86250, 40 },
+	{ 118060, 86290, 40 },
+	{ 118061, 86330, 40 },
+	{ 118062, 86370, 40 },
+	{ 118063, 86410, 40 },
+	{ 118064, 86450, 40 },
+	{ 118065, 86490, 35 },
+	{ 118066, 86525, 35 },
+	{ 118067, 86560, 35 },
+	{ 118068, 86595, 35 },
+	{ 118069, 86630, 35 },
+	{ 118070, 86665, 37 },
+	{ 118071, 86702, 37 },
+	{ 118072, 86739, 37 },
+	{ 118073, 86776, 37 },
+	{ 118074, 86813, 37 },
+	{ 118075, 86850, 37 },
+	{ 118076, 86887, 37 },
+	{ 118077, 86924, 37 },
+	{ 118078, 86961, 37 },
+	{ 118079, 86998, 41 },
+	{ 118080, 87039, 41 },
+	{ 118081, 87080, 41 },
+	{ 118082, 87121, 41 },
+	{ 118083, 87162, 41 },
+	{ 118084, 87203, 43 },
+	{ 118085, 87246, 43 },
+	{ 118086, 87289, 43 },
+	{ 118087, 87332, 43 },
+	{ 118088, 87375, 43 },
+	{ 118089, 87418, 43 },
+	{ 118090, 87461, 43 },
+	{ 118091, 87504, 43 },
+	{ 118092, 87547, 43 },
+	{ 118893, 87590, 34 },
+	{ 118894, 87624, 34 },
+	{ 118895, 87658, 34 },
+	{ 118896, 87692, 34 },
+	{ 118897, 87726, 34 },
+	{ 118898, 87760, 36 },
+	{ 118899, 87796, 36 },
+	{ 118900, 87832, 36 },
+	{ 118901, 87868, 36 },
+	{ 118902, 87904, 36 },
+	{ 118903, 87940, 36 },
+	{ 118904, 87976, 36 },
+	{ 118905, 88012, 36 },
+	{ 118906, 88048, 36 },
+	{ 118907, 88084, 40 },
+	{ 118908, 88124, 40 },
+	{ 118909, 88164, 40 },
+	{ 118910, 88204, 40 },
+	{ 118911, 88244, 40 },
+	{ 118912, 88284, 42 },
+	{ 118913, 88326, 42 },
+	{ 118914, 88368, 42 },
+	{ 118915, 88410, 42 },
+	{ 118916, 88452, 42 },
+	{ 118917, 88494, 42 },
+	{ 118918, 88536, 42 },
+	{ 118919, 88578, 42 },
+	{ 118920, 88620, 42 },
+	{ 118921, 88662, 37 },
+	{ 118922, 88699, 37 },
+	{ 118923, 88736, 37 },
+	{ 118924, 88773, 37 },
+	{ 118925, 88810, 37 },
+	{ 118926, 88847, 39 },
+	{ 118927, 88886, 39 },
+	{ 118928, 88925, 39 },
+	{ 118929, 88964, 39 },
+	{ 118930, 89003, 39 },
+	{ 118931, 89042, 39 },
+	{ 118932, 89081, 39 },
+	{ 118933, 89120, 39 },
+	{ 118934, 89159, 39 },
+	{ 118935, 89198, 43 },
+	{ 118936, 89241, 43 },
+	{ 118937, 89284, 43 },
+	{ 118938, 89327, 43 },
+	{ 118939, 89370, 43 },
+	{ 118940, 89413, 45 },
+	{ 118941, 89458, 45 },
+	{ 118942, 89503, 45 },
+	{ 118943, 89548, 45 },
+	{ 118944, 89593, 45 },
+	{ 118945, 89638, 45 },
+	{ 118946, 89683, 45 },
+	{ 118947, 89728, 45 },
+	{ 118948, 89773, 45 },
+	{ 118949, 89818, 34 },
+	{ 118950, 89852, 34 },
+	{ 118951, 89886, 34 },
+	{ 118952, 89920, 34 },
+	{ 118953, 89954, 34 },
+	{ 118954, 89988, 36 },
+	{ 118955, 90024, 36 },
+	{ 118956, 90060, 36 },
+	{ 118957, 90112, 36 },
+	{ 118958, 90148, 36 },
+	{ 118959, 90184, 36 },
+	{ 118960, 90220, 36 },
+	{ 118961, 90256, 36 },
+	{ 118962, 90292, 36 },
+	{ 118963, 90328, 40 },
+	{ 118964, 90368, 40 },
+	{ 118965, 90408, 40 },
+	{ 118966, 90448, 40 },
+	{ 118967, 90488, 40 },
+	{ 118968, 90528, 42 },
+	{ 118969, 90570, 42 },
+	{ 118970, 90612, 42 },
+	{ 118971, 90654, 42 },
+	{ 118972, 90696, 42 },
+	{ 118973, 90738, 42 },
+	{ 118974, 90780, 42 },
+	{ 118975, 90822, 42 },
+	{ 118976, 90864, 42 },
+	{ 118977, 90906, 37 },
+	{ 118978, 90943, 37 },
+	{ 118979, 90980, 37 },
+	{ 118980, 91017, 37 },
+	{ 118981, 91054, 37 },
+	{ 118982, 91091, 39 },
+	{ 118983, 91130, 39 },
+	{ 118984, 91169, 39 },
+	{ 118985, 91208, 39 },
+	{ 118986, 91247, 39 },
+	{ 118987, 91286, 39 },
+	{ 118988, 91325, 39 },
+	{ 118989, 91364, 39 },
+	{ 118990, 91403, 39 },
+	{ 118991, 91442, 43 },
+	{ 118992, 91485, 43 },
+	{ 118993, 91528, 43 },
+	{ 118994, 91571, 43 },
+	{ 118995, 91614, 43 },
+	{ 118996, 91657, 45 },
+	{ 118997, 91702, 45 },
+	{ 118998, 91747, 45 },
+	{ 118999, 91792, 45 },
+	{ 119000, 91837, 45 },
+	{ 119001, 91882, 45 },
+	{ 119002, 91927, 45 },
+	{ 119003, 91972, 45 },
+	{ 119004, 92017, 45 },
+	{ 119005, 92062, 34 },
+	{ 119006, 92096, 34 },
+	{ 119007, 92130, 34 },
+	{ 119008, 92164, 34 },
+	{ 119009, 92198, 34 },
+	{ 119010, 92232, 36 },
+	{ 119011, 92268, 36 },
+	{ 119012, 92304, 36 },
+	{ 119013, 92340, 36 },
+	{ 119014, 92376, 36 },
+	{ 119015, 92412, 36 },
+	{ 119016, 92448, 36 },
+	{ 119017, 92484, 36 },
+	{ 119018, 92520, 36 },
+	{ 119019, 92556, 40 },
+	{ 119020, 92596, 40 },
+	{ 119021, 92636, 40 },
+	{ 119022, 92676, 40 },
+	{ 119023, 92716, 40 },
+	{ 119024, 92756, 42 },
+	{ 119025, 92798, 42 },
+	{ 119026, 92840, 42 },
+	{ 119027, 92882, 42 },
+	{ 119028, 92924, 42 },
+	{ 119029, 92966, 42 },
+	{ 119030, 93008, 42 },
+	{ 119031, 93050, 42 },
+	{ 119032, 93092, 42 },
+	{ 119033, 93134, 37 },
+	{ 119034, 93171, 37 },
+	{ 119035, 93208, 37 },
+	{ 119036, 93245, 37 },
+	{ 119037, 93282, 37 },
+	{ 119038, 93319, 39 },
+	{ 119039, 93358, 39 },
+	{ 119040, 93397, 39 },
+	{ 119041, 93436, 39 },
+	{ 119042, 93475, 39 },
+	{ 119043, 93514, 39 },
+	{ 119044, 93553, 39 },
+	{ 119045, 93592, 39 },
+	{ 119046, 93631, 39 },
+	{ 119047, 93670, 43 },
+	{ 119048, 93713, 43 },
+	{ 119049, 93756, 43 },
+	{ 119050, 93799, 43 },
+	{ 119051, 93842, 43 },
+	{ 119052, 93885, 45 },
+	{ 119053, 93930, 45 },
+	{ 119054, 93975, 45 },
+	{ 119055, 94020, 45 },
+	{ 119056, 94065, 45 },
+	{ 119057, 94110, 45 },
+	{ 119058, 94155, 45 },
+	{ 119059, 94208, 45 },
+	{ 119060, 94253, 45 },
+	{ 119061, 94298, 36 },
+	{ 119062, 94334, 36 },
+	{ 119063, 94370, 36 },
+	{ 119064, 94406, 36 },
+	{ 119065, 94442, 36 },
+	{ 119066, 94478, 38 },
+	{ 119067, 94516, 38 },
+	{ 119068, 94554, 38 },
+	{ 119069, 94592, 38 },
+	{ 119070, 94630, 38 },
+	{ 119071, 94668, 38 },
+	{ 119072, 94706, 38 },
+	{ 119073, 94744, 38 },
+	{ 119074, 94782, 38 },
+	{ 119075, 94820, 42 },
+	{ 119076, 94862, 42 },
+	{ 119077, 94904, 42 },
+	{ 119078, 94946, 42 },
+	{ 119079, 94988, 42 },
+	{ 119080, 95030, 44 },
+	{ 119081, 95074, 44 },
+	{ 119082, 95118, 44 },
+	{ 119083, 95162, 44 },
+	{ 119084, 95206, 44 },
+	{ 119085, 95250, 44 },
+	{ 119086, 95294, 44 },
+	{ 119087, 95338, 44 },
+	{ 119088, 95382, 44 },
+	{ 119089, 95426, 39 },
+	{ 119090, 95465, 39 },
+	{ 119091, 95504, 39 },
+	{ 119092, 95543, 39 },
+	{ 119093, 95582, 39 },
+	{ 119094, 95621, 41 },
+	{ 119095, 95662, 41 },
+	{ 119096, 95703, 41 },
+	{ 119097, 95744, 41 },
+	{ 119098, 95785, 41 },
+	{ 119099, 95826, 41 },
+	{ 119100, 95867, 41 },
+	{ 119101, 95908, 41 },
+	{ 119102, 95949, 41 },
+	{ 119103, 95990, 45 },
+	{ 119104, 96035, 45 },
+	{ 119105, 96080, 45 },
+	{ 119106, 96125, 45 },
+	{ 119107, 96170, 45 },
+	{ 119108, 96215, 47 },
+	{ 119109, 96262, 47 },
+	{ 119110, 96309, 47 },
+	{ 119111, 96356, 47 },
+	{ 119112, 96403, 47 },
+	{ 119113, 96450, 47 },
+	{ 119114, 96497, 47 },
+	{ 119115, 96544, 47 },
+	{ 119116, 96591, 47 },
+	{ 119917, 96638, 31 },
+	{ 119918, 96669, 31 },
+	{ 119919, 96700, 31 },
+	{ 119920, 96731, 31 },
+	{ 119921, 96762, 31 },
+	{ 119922, 96793, 33 },
+	{ 119923, 96826, 33 },
+	{ 119924, 96859, 33 },
+	{ 119925, 96892, 33 },
+	{ 119926, 96925, 33 },
+	{ 119927, 96958, 33 },
+	{ 119928, 96991, 33 },
+	{ 119929, 97024, 33 },
+	{ 119930, 97057, 33 },
+	{ 119931, 97090, 37 },
+	{ 119932, 97127, 37 },
+	{ 119933, 97164, 37 },
+	{ 119934, 97201, 37 },
+	{ 119935, 97238, 37 },
+	{ 119936, 97275, 39 },
+	{ 119937, 97314, 39 },
+	{ 119938, 97353, 39 },
+	{ 119939, 97392, 39 },
+	{ 119940, 97431, 39 },
+	{ 119941, 97470, 39 },
+	{ 119942, 97509, 39 },
+	{ 119943, 97548, 39 },
+	{ 119944, 97587, 39 },
+	{ 119945, 97626, 34 },
+	{ 119946, 97660, 34 },
+	{ 119947, 97694, 34 },
+	{ 119948, 97728, 34 },
+	{ 119949, 97762, 34 },
+	{ 119950, 97796, 36 },
+	{ 119951, 97832, 36 },
+	{ 119952, 97868, 36 },
+	{ 119953, 97904, 36 },
+	{ 119954, 97940, 36 },
+	{ 119955, 97976, 36 },
+	{ 119956, 98012, 36 },
+	{ 119957, 98048, 36 },
+	{ 119958, 98084, 36 },
+	{ 119959, 98120, 40 },
+	{ 119960, 98160, 40 },
+	{ 119961, 98200, 40 },
+	{ 119962, 98240, 40 },
+	{ 119963, 98304, 40 },
+	{ 119964, 98344, 42 },
+	{ 119965, 98386, 42 },
+	{ 119966, 98428, 42 },
+	{ 119967, 98470, 42 },
+	{ 119968, 98512, 42 },
+	{ 119969, 98554, 42 },
+	{ 119970, 98596, 42 },
+	{ 119971, 98638, 42 },
+	{ 119972, 98680, 42 },
+	{ 119973, 98722, 31 },
+	{ 119974, 98753, 31 },
+	{ 119975, 98784, 31 },
+	{ 119976, 98815, 31 },
+	{ 119977, 98846, 31 },
+	{ 119978, 98877, 33 },
+	{ 119979, 98910, 33 },
+	{ 119980, 98943, 33 },
+	{ 119981, 98976, 33 },
+	{ 119982, 99009, 33 },
+	{ 119983, 99042, 33 },
+	{ 119984, 99075, 33 },
+	{ 119985, 99108, 33 },
+	{ 119986, 99141, 33 },
+	{ 119987, 99174, 37 },
+	{ 119988, 99211, 37 },
+	{ 119989, 99248, 37 },
+	{ 119990, 99285, 37 },
+	{ 119991, 99322, 37 },
+	{ 119992, 99359, 39 },
+	{ 119993, 99398, 39 },
+	{ 119994, 99437, 39 },
+	{ 119995, 99476, 39 },
+	{ 119996, 99515, 39 },
+	{ 119997, 99554, 39 },
+	{ 119998, 99593, 39 },
+	{ 119999, 99632, 39 },
+	{ 120000, 99671, 39 },
+	{ 120001, 99710, 34 },
+	{ 120002, 99744, 34 },
+	{ 120003, 99778, 34 },
+	{ 120004, 99812, 34 },
+	{ 120005, 99846, 34 },
+	{ 120006, 99880, 36 },
+	{ 120007, 99916, 36 },
+	{ 120008, 99952, 36 },
+	{ 120009, 99988, 36 },
+	{ 120010, 100024, 36 },
+	{ 120011, 100060, 36 },
+	{ 120012, 100096, 36 },
+	{ 120013, 100132, 36 },
+	{ 120014, 100168, 36 },
+	{ 120015, 100204, 40 },
+	{ 120016, 100244, 40 },
+	{ 120017, 100284, 40 },
+	{ 120018, 100324, 40 },
+	{ 120019, 100364, 40 },
+	{ 120020, 100404, 42 },
+	{ 120021, 100446, 42 },
+	{ 120022, 100488, 42 },
+	{ 120023, 100530, 42 },
+	{ 120024, 100572, 42 },
+	{ 120025, 100614, 42 },
+	{ 120026, 100656, 42 },
+	{ 120027, 100698, 42 },
+	{ 120028, 100740, 42 },
+	{ 120029, 100782, 31 },
+	{ 120030, 100813, 31 },
+	{ 120031, 100844, 31 },
+	{ 120032, 100875, 31 },
+	{ 120033, 100906, 31 },
+	{ 120034, 100937, 33 },
+	{ 120035, 100970, 33 },
+	{ 120036, 101003, 33 },
+	{ 120037, 101036, 33 },
+	{ 120038, 101069, 33 },
+	{ 120039, 101102, 33 },
+	{ 120040, 101135, 33 },
+	{ 120041, 101168, 33 },
+	{ 120042, 101201, 33 },
+	{ 120043, 101234, 37 },
+	{ 120044, 101271, 37 },
+	{ 120045, 101308, 37 },
+	{ 120046, 101345, 37 },
+	{ 120047, 101382, 37 },
+	{ 120048, 101419, 39 },
+	{ 120049, 101458, 39 },
+	{ 120050, 101497, 39 },
+	{ 120051, 101536, 39 },
+	{ 120052, 101575, 39 },
+	{ 120053, 101614, 39 },
+	{ 120054, 101653, 39 },
+	{ 120055, 101692, 39 },
+	{ 120056, 101731, 39 },
+	{ 120057, 101770, 34 },
+	{ 120058, 101804, 34 },
+	{ 120059, 101838, 34 },
+	{ 120060, 101872, 34 },
+	{ 120061, 101906, 34 },
+	{ 120062, 101940, 36 },
+	{ 120063, 101976, 36 },
+	{ 120064, 102012, 36 },
+	{ 120065, 102048, 36 },
+	{ 120066, 102084, 36 },
+	{ 120067, 102120, 36 },
+	{ 120068, 102156, 36 },
+	{ 120069, 102192, 36 },
+	{ 120070, 102228, 36 },
+	{ 120071, 102264, 40 },
+	{ 120072, 102304, 40 },
+	{ 120073, 102344, 40 },
+	{ 120074, 102400, 40 },
+	{ 120075, 102440, 40 },
+	{ 120076, 102480, 42 },
+	{ 120077, 102522, 42 },
+	{ 120078, 102564, 42 },
+	{ 120079, 102606, 42 },
+	{ 120080, 102648, 42 },
+	{ 120081, 102690, 42 },
+	{ 120082, 102732, 42 },
+	{ 120083, 102774, 42 },
+	{ 120084, 102816, 42 },
+	{ 120085, 102858, 33 },
+	{ 120086, 102891, 33 },
+	{ 120087, 102924, 33 },
+	{ 120088, 102957, 33 },
+	{ 120089, 102990, 33 },
+	{ 120090, 103023, 35 },
+	{ 120091, 103058, 35 },
+	{ 120092, 103093, 35 },
+	{ 120093, 103128, 35 },
+	{ 120094, 103163, 35 },
+	{ 120095, 103198, 35 },
+	{ 120096, 103233, 35 },
+	{ 120097, 103268, 35 },
+	{ 120098, 103303, 35 },
+	{ 120099, 103338, 39 },
+	{ 120100, 103377, 39 },
+	{ 120101, 103416, 39 },
+	{ 120102, 103455, 39 },
+	{ 120103, 103494, 39 },
+	{ 120104, 103533, 41 },
+	{ 120105, 103574, 41 },
+	{ 120106, 103615, 41 },
+	{ 120107, 103656, 41 },
+	{ 120108, 103697, 41 },
+	{ 120109, 103738, 41 },
+	{ 120110, 103779, 41 },
+	{ 120111, 103820, 41 },
+	{ 120112, 103861, 41 },
+	{ 120113, 103902, 36 },
+	{ 120114, 103938, 36 },
+	{ 120115, 103974, 36 },
+	{ 120116, 104010, 36 },
+	{ 120117, 104046, 36 },
+	{ 120118, 104082, 38 },
+	{ 120119, 104120, 38 },
+	{ 120120, 104158, 38 },
+	{ 120121, 104196, 38 },
+	{ 120122, 104234, 38 },
+	{ 120123, 104272, 38 },
+	{ 120124, 104310, 38 },
+	{ 120125, 104348, 38 },
+	{ 120126, 104386, 38 },
+	{ 120127, 104424, 42 },
+	{ 120128, 104466, 42 },
+	{ 120129, 104508, 42 },
+	{ 120130, 104550, 42 },
+	{ 120131, 104592, 42 },
+	{ 120132, 104634, 44 },
+	{ 120133, 104678, 44 },
+	{ 120134, 104722, 44 },
+	{ 120135, 104766, 44 },
+	{ 120136, 104810, 44 },
+	{ 120137, 104854, 44 },
+	{ 120138, 104898, 44 },
+	{ 120139, 104942, 44 },
+	{ 120140, 104986, 44 },
+	{ 120941, 105030, 25 },
+	{ 120942, 105055, 25 },
+	{ 120943, 105080, 25 },
+	{ 120944, 105105, 25 },
+	{ 120945, 105130, 25 },
+	{ 120946, 105155, 27 },
+	{ 120947, 105182, 27 },
+	{ 120948, 105209, 27 },
+	{ 120949, 105236, 27 },
+	{ 120950, 105263, 27 },
+	{ 120951, 105290, 27 },
+	{ 120952, 105317, 27 },
+	{ 120953, 105344, 27 },
+	{ 120954, 105371, 27 },
+	{ 120955, 105398, 31 },
+	{ 120956, 105429, 31 },
+	{ 120957, 105460, 31 },
+	{ 120958, 105491, 31 },
+	{ 120959, 105522, 31 },
+	{ 120960, 105553, 33 },
+	{ 120961, 105586, 33 },
+	{ 120962, 105619, 33 },
+	{ 120963, 105652, 33 },
+	{ 120964, 105685, 33 },
+	{ 120965, 105718, 33 },
+	{ 120966, 105751, 33 },
+	{ 120967, 105784, 33 },
+	{ 120968, 105817, 33 },
+	{ 120969, 105850, 28 },
+	{ 120970, 105878, 28 },
+	{ 120971, 105906, 28 },
+	{ 120972, 105934, 28 },
+	{ 120973, 105962, 28 },
+	{ 120974, 105990, 30 },
+	{ 120975, 106020, 30 },
+	{ 120976, 106050, 30 },
+	{ 120977, 106080, 30 },
+	{ 120978, 106110, 30 },
+	{ 120979, 106140, 30 },
+	{ 120980, 106170, 30 },
+	{ 120981, 106200, 30 },
+	{ 120982, 106230, 30 },
+	{ 120983, 106260, 34 },
+	{ 120984, 106294, 34 },
+	{ 120985, 106328, 34 },
+	{ 120986, 106362, 34 },
+	{ 120987, 106396, 34 },
+	{ 120988, 106430, 36 },
+	{ 120989, 106496, 36 },
+	{ 120990, 106532, 36 },
+	{ 120991, 106568, 36 },
+	{ 120992, 106604, 36 },
+	{ 120993, 106640, 36 },
+	{ 120994, 106676, 36 },
+	{ 120995, 106712, 36 },
+	{ 120996, 106748, 36 },
+	{ 120997, 106784, 25 },
+	{ 120998, 106809, 25 },
+	{ 120999, 106834, 25 },
+	{ 121000, 106859, 25 },
+	{ 121001, 106884, 25 },
+	{ 121002, 106909, 27 },
+	{ 121003, 106936, 27 },
+	{ 121004, 106963, 27 },
+	{ 121005, 106990, 27 },
+	{ 121006, 107017, 27 },
+	{ 121007, 107044, 27 },
+	{ 121008, 107071, 27 },
+	{ 121009, 107098, 27 },
+	{ 121010, 107125, 27 },
+	{ 121011, 107152, 31 },
+	{ 121012, 107183, 31 },
+	{ 121013, 107214, 31 },
+	{ 121014, 107245, 31 },
+	{ 121015, 107276, 31 },
+	{ 121016, 107307, 33 },
+	{ 121017, 107340, 33 },
+	{ 121018, 107373, 33 },
+	{ 121019, 107406, 33 },
+	{ 121020, 107439, 33 },
+	{ 121021, 107472, 33 },
+	{ 121022, 107505, 33 },
+	{ 121023, 107538, 33 },
+	{ 121024, 107571, 33 },
+	{ 121025, 107604, 28 },
+	{ 121026, 107632, 28 },
+	{ 121027, 107660, 28 },
+	{ 121028, 107688, 28 },
+	{ 121029, 107716, 28 },
+	{ 121030, 107744, 30 },
+	{ 121031, 107774, 30 },
+	{ 121032, 107804, 30 },
+	{ 121033, 107834, 30 },
+	{ 121034, 107864, 30 },
+	{ 121035, 107894, 30 },
+	{ 121036, 107924, 30 },
+	{ 121037, 107954, 30 },
+	{ 121038, 107984, 30 },
+	{ 121039, 108014, 34 },
+	{ 121040, 108048, 34 },
+	{ 121041, 108082, 34 },
+	{ 121042, 108116, 34 },
+	{ 121043, 108150, 34 },
+	{ 121044, 108184, 36 },
+	{ 121045, 108220, 36 },
+	{ 121046, 108256, 36 },
+	{ 121047, 108292, 36 },
+	{ 121048, 108328, 36 },
+	{ 121049, 108364, 36 },
+	{ 121050, 108400, 36 },
+	{ 121051, 108436, 36 },
+	{ 121052, 108472, 36 },
+	{ 121053, 108508, 25 },
+	{ 121054, 108533, 25 },
+	{ 121055, 108558, 25 },
+	{ 121056, 108583, 25 },
+	{ 121057, 108608, 25 },
+	{ 121058, 108633, 27 },
+	{ 121059, 108660, 27 },
+	{ 121060, 108687, 27 },
+	{ 121061, 108714, 27 },
+	{ 121062, 108741, 27 },
+	{ 121063, 108768, 27 },
+	{ 121064, 108795, 27 },
+	{ 121065, 108822, 27 },
+	{ 121066, 108849, 27 },
+	{ 121067, 108876, 31 },
+	{ 121068, 108907, 31 },
+	{ 121069, 108938, 31 },
+	{ 121070, 108969, 31 },
+	{ 121071, 109000, 31 },
+	{ 121072, 109031, 33 },
+	{ 121073, 109064, 33 },
+	{ 121074, 109097, 33 },
+	{ 121075, 109130, 33 },
+	{ 121076, 109163, 33 },
+	{ 121077, 109196, 33 },
+	{ 121078, 109229, 33 },
+	{ 121079, 109262, 33 },
+	{ 121080, 109295, 33 },
+	{ 121081, 109328, 28 },
+	{ 121082, 109356, 28 },
+	{ 121083, 109384, 28 },
+	{ 121084, 109412, 28 },
+	{ 121085, 109440, 28 },
+	{ 121086, 109468, 30 },
+	{ 121087, 109498, 30 },
+	{ 121088, 109528, 30 },
+	{ 121089, 109558, 30 },
+	{ 121090, 109588, 30 },
+	{ 121091, 109618, 30 },
+	{ 121092, 109648, 30 },
+	{ 121093, 109678, 30 },
+	{ 121094, 109708, 30 },
+	{ 121095, 109738, 34 },
+	{ 121096, 109772, 34 },
+	{ 121097, 109806, 34 },
+	{ 121098, 109840, 34 },
+	{ 121099, 109874, 34 },
+	{ 121100, 109908, 36 },
+	{ 121101, 109944, 36 },
+	{ 121102, 109980, 36 },
+	{ 121103, 110016, 36 },
+	{ 121104, 110052, 36 },
+	{ 121105, 110088, 36 },
+	{ 121106, 110124, 36 },
+	{ 121107, 110160, 36 },
+	{ 121108, 110196, 36 },
+	{ 121109, 110232, 27 },
+	{ 121110, 110259, 27 },
+	{ 121111, 110286, 27 },
+	{ 121112, 110313, 27 },
+	{ 121113, 110340, 27 },
+	{ 121114, 110367, 29 },
+	{ 121115, 110396, 29 },
+	{ 121116, 110425, 29 },
+	{ 121117, 110454, 29 },
+	{ 121118, 110483, 29 },
+	{ 121119, 110512, 29 },
+	{ 121120, 110541, 29 },
+	{ 121121, 110592, 29 },
+	{ 121122, 110621, 29 },
+	{ 121123, 110650, 33 },
+	{ 121124, 110683, 33 },
+	{ 121125, 110716, 33 },
+	{ 121126, 110749, 33 },
+	{ 121127, 110782, 33 },
+	{ 121128, 110815, 35 },
+	{ 121129, 110850, 35 },
+	{ 121130, 110885, 35 },
+	{ 121131, 110920, 35 },
+	{ 121132, 110955, 35 },
+	{ 121133, 110990, 35 },
+	{ 121134, 111025, 35 },
+	{ 121135, 111060, 35 },
+	{ 121136, 111095, 35 },
+	{ 121137, 111130, 30 },
+	{ 121138, 111160, 30 },
+	{ 121139, 111190, 30 },
+	{ 121140, 111220, 30 },
+	{ 121141, 111250, 30 },
+	{ 121142, 111280, 32 },
+	{ 121143, 111312, 32 },
+	{ 121144, 111344, 32 },
+	{ 121145, 111376, 32 },
+	{ 121146, 111408, 32 },
+	{ 121147, 111440, 32 },
+	{ 121148, 111472, 32 },
+	{ 121149, 111504, 32 },
+	{ 121150, 111536, 32 },
+	{ 121151, 111568, 36 },
+	{ 121152, 111604, 36 },
+	{ 121153, 111640, 36 },
+	{ 121154, 111676, 36 },
+	{ 121155, 111712, 36 },
+	{ 121156, 111748, 38 },
+	{ 121157, 111786, 38 },
+	{ 121158, 111824, 38 },
+	{ 121159, 111862, 38 },
+	{ 121160, 111900, 38 },
+	{ 121161, 111938, 38 },
+	{ 121162, 111976, 38 },
+	{ 121163, 112014, 38 },
+	{ 121164, 112052, 38 },
+	{ 121965, 112090, 27 },
+	{ 121966, 112117, 27 },
+	{ 121967, 112144, 27 },
+	{ 121968, 112171, 27 },
+	{ 121969, 112198, 27 },
+	{ 121970, 112225, 29 },
+	{ 121971, 112254, 29 },
+	{ 121972, 112283, 29 },
+	{ 121973, 112312, 29 },
+	{ 121974, 112341, 29 },
+	{ 121975, 112370, 29 },
+	{ 121976, 112399, 29 },
+	{ 121977, 112428, 29 },
+	{ 121978, 112457, 29 },
+	{ 121979, 112486, 33 },
+	{ 121980, 112519, 33 },
+	{ 121981, 112552, 33 },
+	{ 121982, 112585, 33 },
+	{ 121983, 112618, 33 },
+	{ 121984, 112651, 35 },
+	{ 121985, 112686, 35 },
+	{ 121986, 112721, 35 },
+	{ 121987, 112756, 35 },
+	{ 121988, 112791, 35 },
+	{ 121989, 112826, 35 },
+	{ 121990, 112861, 35 },
+	{ 121991, 112896, 35 },
+	{ 121992, 112931, 35 },
+	{ 121993, 112966, 30 },
+	{ 121994, 112996, 30 },
+	{ 121995, 113026, 30 },
+	{ 121996, 113056, 30 },
+	{ 121997, 113086, 30 },
+	{ 121998, 113116, 32 },
+	{ 121999, 113148, 32 },
+	{ 122000, 113180, 32 },
+	{ 122001, 113212, 32 },
+	{ 122002, 113244, 32 },
+	{ 122003, 113276, 32 },
+	{ 122004, 113308, 32 },
+	{ 122005, 113340, 32 },
+	{ 122006, 113372, 32 },
+	{ 122007, 113404, 36 },
+	{ 122008, 113440, 36 },
+	{ 122009, 113476, 36 },
+	{ 122010, 113512, 36 },
+	{ 122011, 113548, 36 },
+	{ 122012, 113584, 38 },
+	{ 122013, 113622, 38 },
+	{ 122014, 113660, 38 },
+	{ 122015, 113698, 38 },
+	{ 122016, 113736, 38 },
+	{ 122017, 113774, 38 },
+	{ 122018, 113812, 38 },
+	{ 122019, 113850, 38 },
+	{ 122020, 113888, 38 },
+	{ 122021, 113926, 27 },
+	{ 122022, 113953, 27 },
+	{ 122023, 113980, 27 },
+	{ 122024, 114007, 27 },
+	{ 122025, 114034, 27 },
+	{ 122026, 114061, 29 },
+	{ 122027, 114090, 29 },
+	{ 122028, 114119, 29 },
+	{ 122029, 114148, 29 },
+	{ 122030, 114177, 29 },
+	{ 122031, 114206, 29 },
+	{ 122032, 114235, 29 },
+	{ 122033, 114264, 29 },
+	{ 122034, 114293, 29 },
+	{ 122035, 114322, 33 },
+	{ 122036, 114355, 33 },
+	{ 122037, 114388, 33 },
+	{ 122038, 114421, 33 },
+	{ 122039, 114454, 33 },
+	{ 122040, 114487, 35 },
+	{ 122041, 114522, 35 },
+	{ 122042, 114557, 35 },
+	{ 122043, 114592, 35 },
+	{ 122044, 114627, 35 },
+	{ 122045, 114688, 35 },
+	{ 122046, 114723, 35 },
+	{ 122047, 114758, 35 },
+	{ 122048, 114793, 35 },
+	{ 122049, 114828, 30 },
+	{ 122050, 114858, 30 },
+	{ 122051, 114888, 30 },
+	{ 122052, 114918, 30 },
+	{ 122053, 114948, 30 },
+	{ 122054, 114978, 32 },
+	{ 122055, 115010, 32 },
+	{ 122056, 115042, 32 },
+	{ 122057, 115074, 32 },
+	{ 122058, 115106, 32 },
+	{ 122059, 115138, 32 },
+	{ 122060, 115170, 32 },
+	{ 122061, 115202, 32 },
+	{ 122062, 115234, 32 },
+	{ 122063, 115266, 36 },
+	{ 122064, 115302, 36 },
+	{ 122065, 115338, 36 },
+	{ 122066, 115374, 36 },
+	{ 122067, 115410, 36 },
+	{ 122068, 115446, 38 },
+	{ 122069, 115484, 38 },
+	{ 122070, 115522, 38 },
+	{ 122071, 115560, 38 },
+	{ 122072, 115598, 38 },
+	{ 122073, 115636, 38 },
+	{ 122074, 115674, 38 },
+	{ 122075, 115712, 38 },
+	{ 122076, 115750, 38 },
+	{ 122077, 115788, 27 },
+	{ 122078, 115815, 27 },
+	{ 122079, 115842, 27 },
+	{ 122080, 115869, 27 },
+	{ 122081, 115896, 27 },
+	{ 122082, 115923, 29 },
+	{ 122083, 115952, 29 },
+	{ 122084, 115981, 29 },
+	{ 122085, 116010, 29 },
+	{ 122086, 116039, 29 },
+	{ 122087, 116068, 29 },
+	{ 122088, 116097, 29 },
+	{ 122089, 116126, 29 },
+	{ 122090, 116155, 29 },
+	{ 122091, 116184, 33 },
+	{ 122092, 116217, 33 },
+	{ 122093, 116250, 33 },
+	{ 122094, 116283, 33 },
+	{ 122095, 116316, 33 },
+	{ 122096, 116349, 35 },
+	{ 122097, 116384, 35 },
+	{ 122098, 116419, 35 },
+	{ 122099, 116454, 35 },
+	{ 122100, 116489, 35 },
+	{ 122101, 116524, 35 },
+	{ 122102, 116559, 35 },
+	{ 122103, 116594, 35 },
+	{ 122104, 116629, 35 },
+	{ 122105, 116664, 30 },
+	{ 122106, 116694, 30 },
+	{ 122107, 116724, 30 },
+	{ 122108, 116754, 30 },
+	{ 122109, 116784, 30 },
+	{ 122110, 116814, 32 },
+	{ 122111, 116846, 32 },
+	{ 122112, 116878, 32 },
+	{ 122113, 116910, 32 },
+	{ 122114, 116942, 32 },
+	{ 122115, 116974, 32 },
+	{ 122116, 117006, 32 },
+	{ 122117, 117038, 32 },
+	{ 122118, 117070, 32 },
+	{ 122119, 117102, 36 },
+	{ 122120, 117138, 36 },
+	{ 122121, 117174, 36 },
+	{ 122122, 117210, 36 },
+	{ 122123, 117246, 36 },
+	{ 122124, 117282, 38 },
+	{ 122125, 117320, 38 },
+	{ 122126, 117358, 38 },
+	{ 122127, 117396, 38 },
+	{ 122128, 117434, 38 },
+	{ 122129, 117472, 38 },
+	{ 122130, 117510, 38 },
+	{ 122131, 117548, 38 },
+	{ 122132, 117586, 38 },
+	{ 122133, 117624, 29 },
+	{ 122134, 117653, 29 },
+	{ 122135, 117682, 29 },
+	{ 122136, 117711, 29 },
+	{ 122137, 117740, 29 },
+	{ 122138, 117769, 31 },
+	{ 122139, 117800, 31 },
+	{ 122140, 117831, 31 },
+	{ 122141, 117862, 31 },
+	{ 122142, 117893, 31 },
+	{ 122143, 117924, 31 },
+	{ 122144, 117955, 31 },
+	{ 122145, 117986, 31 },
+	{ 122146, 118017, 31 },
+	{ 122147, 118048, 35 },
+	{ 122148, 118083, 35 },
+	{ 122149, 118118, 35 },
+	{ 122150, 118153, 35 },
+	{ 122151, 118188, 35 },
+	{ 122152, 118223, 37 },
+	{ 122153, 118260, 37 },
+	{ 122154, 118297, 37 },
+	{ 122155, 118334, 37 },
+	{ 122156, 118371, 37 },
+	{ 122157, 118408, 37 },
+	{ 122158, 118445, 37 },
+	{ 122159, 118482, 37 },
+	{ 122160, 118519, 37 },
+	{ 122161, 118556, 32 },
+	{ 122162, 118588, 32 },
+	{ 122163, 118620, 32 },
+	{ 122164, 118652, 32 },
+	{ 122165, 118684, 32 },
+	{ 122166, 118716, 34 },
+	{ 122167, 118784, 34 },
+	{ 122168, 118818, 34 },
+	{ 122169, 118852, 34 },
+	{ 122170, 118886, 34 },
+	{ 122171, 118920, 34 },
+	{ 122172, 118954, 34 },
+	{ 122173, 118988, 34 },
+	{ 122174, 119022, 34 },
+	{ 122175, 119056, 38 },
+	{ 122176, 119094, 38 },
+	{ 122177, 119132, 38 },
+	{ 122178, 119170, 38 },
+	{ 122179, 119208, 38 },
+	{ 122180, 119246, 40 },
+	{ 122181, 119286, 40 },
+	{ 122182, 119326, 40 },
+	{ 122183, 119366, 40 },
+	{ 122184, 119406, 40 },
+	{ 122185, 119446, 40 },
+	{ 122186, 119486, 40 },
+	{ 122187, 119526, 40 },
+	{ 122188, 119566, 40 },
+	{ 122989, 119606, 26 },
+	{ 122990, 119632, 26 },
+	{ 122991, 119658, 26 },
+	{ 122992, 119684, 26 },
+	{ 122993, 119710, 26 },
+	{ 122994, 119736, 28 },
+	{ 122995, 119764, 28 },
+	{ 122996, 119792, 28 },
+	{ 122997, 119820, 28 },
+	{ 122998, 119848, 28 },
+	{ 122999, 119876, 28 },
+	{ 123000, 119904, 28 },
+	{ 123001, 119932, 28 },
+	{ 123002, 119960, 28 },
+	{ 123003, 119988, 32 },
+	{ 123004, 120020, 32 },
+	{ 123005, 120052, 32 },
+	{ 123006, 120084, 32 },
+	{ 123007, 120116, 32 },
+	{ 123008, 120148, 34 },
+	{ 123009, 120182, 34 },
+	{ 123010, 120216, 34 },
+	{ 123011, 120250, 34 },
+	{ 123012, 120284, 34 },
+	{ 123013, 120318, 34 },
+	{ 123014, 120352, 34 },
+	{ 123015, 120386, 34 },
+	{ 123016, 120420, 34 },
+	{ 123017, 120454, 29 },
+	{ 123018, 120483, 29 },
+	{ 123019, 120512, 29 },
+	{ 123020, 120541, 29 },
+	{ 123021, 120570, 29 },
+	{ 123022, 120599, 31 },
+	{ 123023, 120630, 31 },
+	{ 123024, 120661, 31 },
+	{ 123025, 120692, 31 },
+	{ 123026, 120723, 31 },
+	{ 123027, 120754, 31 },
+	{ 123028, 120785, 31 },
+	{ 123029, 120816, 31 },
+	{ 123030, 120847, 31 },
+	{ 123031, 120878, 35 },
+	{ 123032, 120913, 35 },
+	{ 123033, 120948, 35 },
+	{ 123034, 120983, 35 },
+	{ 123035, 121018, 35 },
+	{ 123036, 121053, 37 },
+	{ 123037, 121090, 37 },
+	{ 123038, 121127, 37 },
+	{ 123039, 121164, 37 },
+	{ 123040, 121201, 37 },
+	{ 123041, 121238, 37 },
+	{ 123042, 121275, 37 },
+	{ 123043, 121312, 37 },
+	{ 123044, 121349, 37 },
+	{ 123045, 121386, 26 },
+	{ 123046, 121412, 26 },
+	{ 123047, 121438, 26 },
+	{ 123048, 121464, 26 },
+	{ 123049, 121490, 26 },
+	{ 123050, 121516, 28 },
+	{ 123051, 121544, 28 },
+	{ 123052, 121572, 28 },
+	{ 123053, 121600, 28 },
+	{ 123054, 121628, 28 },
+	{ 123055, 121656, 28 },
+	{ 123056, 121684, 28 },
+	{ 123057, 121712, 28 },
+	{ 123058, 121740, 28 },
+	{ 123059, 121768, 32 },
+	{ 123060, 121800, 32 },
+	{ 123061, 121832, 32 },
+	{ 123062, 121864, 32 },
+	{ 123063, 121896, 32 },
+	{ 123064, 121928, 34 },
+	{ 123065, 121962, 34 },
+	{ 123066, 121996, 34 },
+	{ 123067, 122030, 34 },
+	{ 123068, 122064, 34 },
+	{ 123069, 122098, 34 },
+	{ 123070, 122132, 34 },
+	{ 123071, 122166, 34 },
+	{ 123072, 122200, 34 },
+	{ 123073, 122234, 29 },
+	{ 123074, 122263, 29 },
+	{ 123075, 122292, 29 },
+	{ 123076, 122321, 29 },
+	{ 123077, 122350, 29 },
+	{ 123078, 122379, 31 },
+	{ 123079, 122410, 31 },
+	{ 123080, 122441, 31 },
+	{ 123081, 122472, 31 },
+	{ 123082, 122503, 31 },
+	{ 123083, 122534, 31 },
+	{ 123084, 122565, 31 },
+	{ 123085, 122596, 31 },
+	{ 123086, 122627, 31 },
+	{ 123087, 122658, 35 },
+	{ 123088, 122693, 35 },
+	{ 123089, 122728, 35 },
+	{ 123090, 122763, 35 },
+	{ 123091, 122798, 35 },
+	{ 123092, 122833, 37 },
+	{ 123093, 122880, 37 },
+	{ 123094, 122917, 37 },
+	{ 123095, 122954, 37 },
+	{ 123096, 122991, 37 },
+	{ 123097, 123028, 37 },
+	{ 123098, 123065, 37 },
+	{ 123099, 123102, 37 },
+	{ 123100, 123139, 37 },
+	{ 123101, 123176, 26 },
+	{ 123102, 123202, 26 },
+	{ 123103, 123228, 26 },
+	{ 123104, 123254, 26 },
+	{ 123105, 123280, 26 },
+	{ 123106, 123306, 28 },
+	{ 123107, 123334, 28 },
+	{ 123108, 123362, 28 },
+	{ 123109, 123390, 28 },
+	{ 123110, 123418, 28 },
+	{ 123111, 123446, 28 },
+	{ 123112, 123474, 28 },
+	{ 123113, 123502, 28 },
+	{ 123114, 123530, 28 },
+	{ 123115, 123558, 32 },
+	{ 123116, 123590, 32 },
+	{ 123117, 123622, 32 },
+	{ 123118, 123654, 32 },
+	{ 123119, 123686, 32 },
+	{ 123120, 123718, 34 },
+	{ 123121, 123752, 34 },
+	{ 123122, 123786, 34 },
+	{ 123123, 123820, 34 },
+	{ 123124, 123854, 34 },
+	{ 123125, 123888, 34 },
+	{ 123126, 123922, 34 },
+	{ 123127, 123956, 34 },
+	{ 123128, 123990, 34 },
+	{ 123129, 124024, 29 },
+	{ 123130, 124053, 29 },
+	{ 123131, 124082, 29 },
+	{ 123132, 124111, 29 },
+	{ 123133, 124140, 29 },
+	{ 123134, 124169, 31 },
+	{ 123135, 124200, 31 },
+	{ 123136, 124231, 31 },
+	{ 123137, 124262, 31 },
+	{ 123138, 124293, 31 },
+	{ 123139, 124324, 31 },
+	{ 123140, 124355, 31 },
+	{ 123141, 124386, 31 },
+	{ 123142, 124417, 31 },
+	{ 123143, 124448, 35 },
+	{ 123144, 124483, 35 },
+	{ 123145, 124518, 35 },
+	{ 123146, 124553, 35 },
+	{ 123147, 124588, 35 },
+	{ 123148, 124623, 37 },
+	{ 123149, 124660, 37 },
+	{ 123150, 124697, 37 },
+	{ 123151, 124734, 37 },
+	{ 123152, 124771, 37 },
+	{ 123153, 124808, 37 },
+	{ 123154, 124845, 37 },
+	{ 123155, 124882, 37 },
+	{ 123156, 124919, 37 },
+	{ 123157, 124956, 28 },
+	{ 123158, 124984, 28 },
+	{ 123159, 125012, 28 },
+	{ 123160, 125040, 28 },
+	{ 123161, 125068, 28 },
+	{ 123162, 125096, 30 },
+	{ 123163, 125126, 30 },
+	{ 123164, 125156, 30 },
+	{ 123165, 125186, 30 },
+	{ 123166, 125216, 30 },
+	{ 123167, 125246, 30 },
+	{ 123168, 125276, 30 },
+	{ 123169, 125306, 30 },
+	{ 123170, 125336, 30 },
+	{ 123171, 125366, 34 },
+	{ 123172, 125400, 34 },
+	{ 123173, 125434, 34 },
+	{ 123174, 125468, 34 },
+	{ 123175, 125502, 34 },
+	{ 123176, 125536, 36 },
+	{ 123177, 125572, 36 },
+	{ 123178, 125608, 36 },
+	{ 123179, 125644, 36 },
+	{ 123180, 125680, 36 },
+	{ 123181, 125716, 36 },
+	{ 123182, 125752, 36 },
+	{ 123183, 125788, 36 },
+	{ 123184, 125824, 36 },
+	{ 123185, 125860, 31 },
+	{ 123186, 125891, 31 },
+	{ 123187, 125922, 31 },
+	{ 123188, 125953, 31 },
+	{ 123189, 125984, 31 },
+	{ 123190, 126015, 33 },
+	{ 123191, 126048, 33 },
+	{ 123192, 126081, 33 },
+	{ 123193, 126114, 33 },
+	{ 123194, 126147, 33 },
+	{ 123195, 126180, 33 },
+	{ 123196, 126213, 33 },
+	{ 123197, 126246, 33 },
+	{ 123198, 126279, 33 },
+	{ 123199, 126312, 37 },
+	{ 123200, 126349, 37 },
+	{ 123201, 126386, 37 },
+	{ 123202, 126423, 37 },
+	{ 123203, 126460, 37 },
+	{ 123204, 126497, 39 },
+	{ 123205, 126536, 39 },
+	{ 123206, 126575, 39 },
+	{ 123207, 126614, 39 },
+	{ 123208, 126653, 39 },
+	{ 123209, 126692, 39 },
+	{ 123210, 126731, 39 },
+	{ 123211, 126770, 39 },
+	{ 123212, 126809, 39 },
+	{ 124013, 126848, 27 },
+	{ 124014, 126875, 27 },
+	{ 124015, 126902, 27 },
+	{ 124016, 126929, 27 },
+	{ 124017, 126976, 27 },
+	{ 124018, 127003, 29 },
+	{ 124019, 127032, 29 },
+	{ 124020, 127061, 29 },
+	{ 124021, 127090, 29 },
+	{ 124022, 127119, 29 },
+	{ 124023, 127148, 29 },
+	{ 124024, 127177, 29 },
+	{ 124025, 127206, 29 },
+	{ 124026, 127235, 29 },
+	{ 124027, 127264, 33 },
+	{ 124028, 127297, 33 },
+	{ 124029, 127330, 33 },
+	{ 124030, 127363, 33 },
+	{ 124031, 127396, 33 },
+	{ 124032, 127429, 35 },
+	{ 124033, 127464, 35 },
+	{ 124034, 127499, 35 },
+	{ 124035, 127534, 35 },
+	{ 124036, 127569, 35 },
+	{ 124037, 127604, 35 },
+	{ 124038, 127639, 35 },
+	{ 124039, 127674, 35 },
+	{ 124040, 127709, 35 },
+	{ 124041, 127744, 30 },
+	{ 124042, 127774, 30 },
+	{ 124043, 127804, 30 },
+	{ 124044, 127834, 30 },
+	{ 124045, 127864, 30 },
+	{ 124046, 127894, 32 },
+	{ 124047, 127926, 32 },
+	{ 124048, 127958, 32 },
+	{ 124049, 127990, 32 },
+	{ 124050, 128022, 32 },
+	{ 124051, 128054, 32 },
+	{ 124052, 128086, 32 },
+	{ 124053, 128118, 32 },
+	{ 124054, 128150, 32 },
+	{ 124055, 128182, 36 },
+	{ 124056, 128218, 36 },
+	{ 124057, 128254, 36 },
+	{ 124058, 128290, 36 },
+	{ 124059, 128326, 36 },
+	{ 124060, 128362, 38 },
+	{ 124061, 128400, 38 },
+	{ 124062, 128438, 38 },
+	{ 124063, 128476, 38 },
+	{ 124064, 128514, 38 },
+	{ 124065, 128552, 38 },
+	{ 124066, 128590, 38 },
+	{ 124067, 128628, 38 },
+	{ 124068, 128666, 38 },
+	{ 124069, 128704, 27 },
+	{ 124070, 128731, 27 },
+	{ 124071, 128758, 27 },
+	{ 124072, 128785, 27 },
+	{ 124073, 128812, 27 },
+	{ 124074, 128839, 29 },
+	{ 124075, 128868, 29 },
+	{ 124076, 128897, 29 },
+	{ 124077, 128926, 29 },
+	{ 124078, 128955, 29 },
+	{ 124079, 128984, 29 },
+	{ 124080, 129013, 29 },
+	{ 124081, 129042, 29 },
+	{ 124082, 129071, 29 },
+	{ 124083, 129100, 33 },
+	{ 124084, 129133, 33 },
+	{ 124085, 129166, 33 },
+	{ 124086, 129199, 33 },
+	{ 124087, 129232, 33 },
+	{ 124088, 129265, 35 },
+	{ 124089, 129300, 35 },
+	{ 124090, 129335, 35 },
+	{ 124091, 129370, 35 },
+	{ 124092, 129405, 35 },
+	{ 124093, 129440, 35 },
+	{ 124094, 129475, 35 },
+	{ 124095, 129510, 35 },
+	{ 124096, 129545, 35 },
+	{ 124097, 129580, 30 },
+	{ 124098, 129610, 30 },
+	{ 124099, 129640, 30 },
+	{ 124100, 129670, 30 },
+	{ 124101, 129700, 30 },
+	{ 124102, 129730, 32 },
+	{ 124103, 129762, 32 },
+	{ 124104, 129794, 32 },
+	{ 124105, 129826, 32 },
+	{ 124106, 129858, 32 },
+	{ 124107, 129890, 32 },
+	{ 124108, 129922, 32 },
+	{ 124109, 129954, 32 },
+	{ 124110, 129986, 32 },
+	{ 124111, 130018, 36 },
+	{ 124112, 130054, 36 },
+	{ 124113, 130090, 36 },
+	{ 124114, 130126, 36 },
+	{ 124115, 130162, 36 },
+	{ 124116, 130198, 38 },
+	{ 124117, 130236, 38 },
+	{ 124118, 130274, 38 },
+	{ 124119, 130312, 38 },
+	{ 124120, 130350, 38 },
+	{ 124121, 130388, 38 },
+	{ 124122, 130426, 38 },
+	{ 124123, 130464, 38 },
+	{ 124124, 130502, 38 },
+	{ 124125, 130540, 27 },
+	{ 124126, 130567, 27 },
+	{ 124127, 130594, 27 },
+	{ 124128, 130621, 27 },
+	{ 124129, 130648, 27 },
+	{ 124130, 130675, 29 },
+	{ 124131, 130704, 29 },
+	{ 124132, 130733, 29 },
+	{ 124133, 130762, 29 },
+	{ 124134, 130791, 29 },
+	{ 124135, 130820, 29 },
+	{ 124136, 130849, 29 },
+	{ 124137, 130878, 29 },
+	{ 124138, 130907, 29 },
+	{ 124139, 130936, 33 },
+	{ 124140, 130969, 33 },
+	{ 124141, 131002, 33 },
+	{ 124142, 131035, 33 },
+	{ 124143, 131072, 33 },
+	{ 124144, 131105, 35 },
+	{ 124145, 131140, 35 },
+	{ 124146, 131175, 35 },
+	{ 124147, 131210, 35 },
+	{ 124148, 131245, 35 },
+	{ 124149, 131280, 35 },
+	{ 124150, 131315, 35 },
+	{ 124151, 131350, 35 },
+	{ 124152, 131385, 35 },
+	{ 124153, 131420, 30 },
+	{ 124154, 131450, 30 },
+	{ 124155, 131480, 30 },
+	{ 124156, 131510, 30 },
+	{ 124157, 131540, 30 },
+	{ 124158, 131570, 32 },
+	{ 124159, 131602, 32 },
+	{ 124160, 131634, 32 },
+	{ 124161, 131666, 32 },
+	{ 124162, 131698, 32 },
+	{ 124163, 131730, 32 },
+	{ 124164, 131762, 32 },
+	{ 124165, 131794, 32 },
+	{ 124166, 131826, 32 },
+	{ 124167, 131858, 36 },
+	{ 124168, 131894, 36 },
+	{ 124169, 131930, 36 },
+	{ 124170, 131966, 36 },
+	{ 124171, 132002, 36 },
+	{ 124172, 132038, 38 },
+	{ 124173, 132076, 38 },
+	{ 124174, 132114, 38 },
+	{ 124175, 132152, 38 },
+	{ 124176, 132190, 38 },
+	{ 124177, 132228, 38 },
+	{ 124178, 132266, 38 },
+	{ 124179, 132304, 38 },
+	{ 124180, 132342, 38 },
+	{ 124181, 132380, 29 },
+	{ 124182, 132409, 29 },
+	{ 124183, 132438, 29 },
+	{ 124184, 132467, 29 },
+	{ 124185, 132496, 29 },
+	{ 124186, 132525, 31 },
+	{ 124187, 132556, 31 },
+	{ 124188, 132587, 31 },
+	{ 124189, 132618, 31 },
+	{ 124190, 132649, 31 },
+	{ 124191, 132680, 31 },
+	{ 124192, 132711, 31 },
+	{ 124193, 132742, 31 },
+	{ 124194, 132773, 31 },
+	{ 124195, 132804, 35 },
+	{ 124196, 132839, 35 },
+	{ 124197, 132874, 35 },
+	{ 124198, 132909, 35 },
+	{ 124199, 132944, 35 },
+	{ 124200, 132979, 37 },
+	{ 124201, 133016, 37 },
+	{ 124202, 133053, 37 },
+	{ 124203, 133090, 37 },
+	{ 124204, 133127, 37 },
+	{ 124205, 133164, 37 },
+	{ 124206, 133201, 37 },
+	{ 124207, 133238, 37 },
+	{ 124208, 133275, 37 },
+	{ 124209, 133312, 32 },
+	{ 124210, 133344, 32 },
+	{ 124211, 133376, 32 },
+	{ 124212, 133408, 32 },
+	{ 124213, 133440, 32 },
+	{ 124214, 133472, 34 },
+	{ 124215, 133506, 34 },
+	{ 124216, 133540, 34 },
+	{ 124217, 133574, 34 },
+	{ 124218, 133608, 34 },
+	{ 124219, 133642, 34 },
+	{ 124220, 133676, 34 },
+	{ 124221, 133710, 34 },
+	{ 124222, 133744, 34 },
+	{ 124223, 133778, 38 },
+	{ 124224, 133816, 38 },
+	{ 124225, 133854, 38 },
+	{ 124226, 133892, 38 },
+	{ 124227, 133930, 38 },
+	{ 124228, 133968, 40 },
+	{ 124229, 134008, 40 },
+	{ 124230, 134048, 40 },
+	{ 124231, 134088, 40 },
+	{ 124232, 134128, 40 },
+	{ 124233, 134168, 40 },
+	{ 124234, 134208, 40 },
+	{ 124235, 134248, 40 },
+	{ 124236, 134288, 40 },
+	{ 125037, 134328, 34 },
+	{ 125038, 134362, 34 },
+	{ 125039, 134396, 33 },
+	{ 125040, 134429, 33 },
+	{ 125041, 134462, 30 },
+	{ 125042, 134492, 30 },
+	{ 125043, 134522, 29 },
+	{ 125044, 134551, 29 },
+	{ 125045, 134580, 28 },
+	{ 125046, 134608, 28 },
+	{ 125047, 134636, 27 },
+	{ 125048, 134663, 27 },
+	{ 125049, 134690, 38 },
+	{ 125050, 134728, 38 },
+	{ 125051, 134766, 38 },
+	{ 125052, 134804, 37 },
+	{ 125053, 134841, 37 },
+	{ 125054, 134878, 32 },
+	{ 125055, 134910, 32 },
+	{ 125056, 134942, 32 },
+	{ 125057, 134974, 31 },
+	{ 125058, 135005, 31 },
+	{ 125059, 135036, 29 },
+	{ 125060, 135065, 29 },
+	{ 125061, 135094, 29 },
+	{ 125062, 135123, 28 },
+	{ 125063, 135168, 28 },
+	{ 125064, 135196, 38 },
+	{ 125065, 135234, 37 },
+	{ 125066, 135271, 37 },
+	{ 125067, 135308, 32 },
+	{ 125068, 135340, 31 },
+	{ 125069, 135371, 31 },
+	{ 125070, 135402, 29 },
+	{ 125071, 135431, 28 },
+	{ 125072, 135459, 28 },
+	{ 125073, 135487, 28 },
+	{ 125074, 135515, 28 },
+	{ 125075, 135543, 35 },
+	{ 125076, 135578, 37 },
+	{ 125077, 135615, 36 },
+	{ 125078, 135651, 40 },
+	{ 125079, 135691, 40 },
+	{ 125080, 135731, 39 },
+	{ 125081, 135770, 39 },
+	{ 125082, 135809, 36 },
+	{ 125083, 135845, 36 },
+	{ 125084, 135881, 35 },
+	{ 125085, 135916, 35 },
+	{ 125086, 135951, 34 },
+	{ 125087, 135985, 34 },
+	{ 125088, 136019, 33 },
+	{ 125089, 136052, 33 },
+	{ 125090, 136085, 44 },
+	{ 125091, 136129, 44 },
+	{ 125092, 136173, 44 },
+	{ 125093, 136217, 43 },
+	{ 125094, 136260, 43 },
+	{ 125095, 136303, 38 },
+	{ 125096, 136341, 38 },
+	{ 125097, 136379, 38 },
+	{ 125098, 136417, 37 },
+	{ 125099, 136454, 37 },
+	{ 125100, 136491, 35 },
+	{ 125101, 136526, 35 },
+	{ 125102, 136561, 35 },
+	{ 125103, 136596, 34 },
+	{ 125104, 136630, 34 },
+	{ 125105, 136664, 44 },
+	{ 125106, 136708, 43 },
+	{ 125107, 136751, 43 },
+	{ 125108, 136794, 38 },
+	{ 125109, 136832, 37 },
+	{ 125110, 136869, 37 },
+	{ 125111, 136906, 35 },
+	{ 125112, 136941, 34 },
+	{ 125113, 136975, 34 },
+	{ 125114, 137009, 34 },
+	{ 125115, 137043, 34 },
+	{ 125116, 137077, 41 },
+	{ 125117, 137118, 43 },
+	{ 125118, 137161, 42 },
+	{ 125119, 137203, 37 },
+	{ 125120, 137240, 37 },
+	{ 125121, 137277, 36 },
+	{ 125122, 137313, 36 },
+	{ 125123, 137349, 33 },
+	{ 125124, 137382, 33 },
+	{ 125125, 137415, 32 },
+	{ 125126, 137447, 32 },
+	{ 125127, 137479, 31 },
+	{ 125128, 137510, 31 },
+	{ 125129, 137541, 30 },
+	{ 125130, 137571, 30 },
+	{ 125131, 137601, 41 },
+	{ 125132, 137642, 41 },
+	{ 125133, 137683, 41 },
+	{ 125134, 137724, 40 },
+	{ 125135, 137764, 40 },
+	{ 125136, 137804, 35 },
+	{ 125137, 137839, 35 },
+	{ 125138, 137874, 35 },
+	{ 125139, 137909, 34 },
+	{ 125140, 137943, 34 },
+	{ 125141, 137977, 32 },
+	{ 125142, 138009, 32 },
+	{ 125143, 138041, 32 },
+	{ 125144, 138073, 31 },
+	{ 125145, 138104, 31 },
+	{ 125146, 138135, 41 },
+	{ 125147, 138176, 40 },
+	{ 125148, 138216, 40 },
+	{ 125149, 138256, 35 },
+	{ 125150, 138291, 34 },
+	{ 125151, 138325, 34 },
+	{ 125152, 138359, 32 },
+	{ 125153, 138391, 31 },
+	{ 125154, 138422, 31 },
+	{ 125155, 138453, 31 },
+	{ 125156, 138484, 31 },
+	{ 125157, 138515, 38 },
+	{ 125158, 138553, 40 },
+	{ 125159, 138593, 39 },
+	{ 125160, 138632, 43 },
+	{ 125161, 138675, 43 },
+	{ 125162, 138718, 42 },
+	{ 125163, 138760, 42 },
+	{ 125164, 138802, 39 },
+	{ 125165, 138841, 39 },
+	{ 125166, 138880, 38 },
+	{ 125167, 138918, 38 },
+	{ 125168, 138956, 37 },
+	{ 125169, 138993, 37 },
+	{ 125170, 139030, 36 },
+	{ 125171, 139066, 36 },
+	{ 125172, 139102, 47 },
+	{ 125173, 139149, 47 },
+	{ 125174, 139196, 47 },
+	{ 125175, 139264, 46 },
+	{ 125176, 139310, 46 },
+	{ 125177, 139356, 41 },
+	{ 125178, 139397, 41 },
+	{ 125179, 139438, 41 },
+	{ 125180, 139479, 40 },
+	{ 125181, 139519, 40 },
+	{ 125182, 139559, 38 },
+	{ 125183, 139597, 38 },
+	{ 125184, 139635, 38 },
+	{ 125185, 139673, 37 },
+	{ 125186, 139710, 37 },
+	{ 125187, 139747, 47 },
+	{ 125188, 139794, 46 },
+	{ 125189, 139840, 46 },
+	{ 125190, 139886, 41 },
+	{ 125191, 139927, 40 },
+	{ 125192, 139967, 40 },
+	{ 125193, 140007, 38 },
+	{ 125194, 140045, 37 },
+	{ 125195, 140082, 37 },
+	{ 125196, 140119, 37 },
+	{ 125197, 140156, 37 },
+	{ 125198, 140193, 44 },
+	{ 125199, 140237, 46 },
+	{ 125200, 140283, 45 },
+	{ 125201, 140328, 34 },
+	{ 125202, 140362, 34 },
+	{ 125203, 140396, 33 },
+	{ 125204, 140429, 33 },
+	{ 125205, 140462, 30 },
+	{ 125206, 140492, 30 },
+	{ 125207, 140522, 29 },
+	{ 125208, 140551, 29 },
+	{ 125209, 140580, 28 },
+	{ 125210, 140608, 28 },
+	{ 125211, 140636, 27 },
+	{ 125212, 140663, 27 },
+	{ 125213, 140690, 38 },
+	{ 125214, 140728, 38 },
+	{ 125215, 140766, 38 },
+	{ 125216, 140804, 37 },
+	{ 125217, 140841, 37 },
+	{ 125218, 140878, 32 },
+	{ 125219, 140910, 32 },
+	{ 125220, 140942, 32 },
+	{ 125221, 140974, 31 },
+	{ 125222, 141005, 31 },
+	{ 125223, 141036, 29 },
+	{ 125224, 141065, 29 },
+	{ 125225, 141094, 29 },
+	{ 125226, 141123, 28 },
+	{ 125227, 141151, 28 },
+	{ 125228, 141179, 38 },
+	{ 125229, 141217, 37 },
+	{ 125230, 141254, 37 },
+	{ 125231, 141291, 32 },
+	{ 125232, 141323, 31 },
+	{ 125233, 141354, 31 },
+	{ 125234, 141385, 29 },
+	{ 125235, 141414, 28 },
+	{ 125236, 141442, 28 },
+	{ 125237, 141470, 28 },
+	{ 125238, 141498, 28 },
+	{ 125239, 141526, 35 },
+	{ 125240, 141561, 37 },
+	{ 125241, 141598, 36 },
+	{ 125242, 141634, 40 },
+	{ 125243, 141674, 40 },
+	{ 125244, 141714, 39 },
+	{ 125245, 141753, 39 },
+	{ 125246, 141792, 36 },
+	{ 125247, 141828, 36 },
+	{ 125248, 141864, 35 },
+	{ 125249, 141899, 35 },
+	{ 125250, 141934, 34 },
+	{ 125251, 141968, 34 },
+	{ 125252, 142002, 33 },
+	{ 125253, 142035, 33 },
+	{ 125254, 142068, 44 },
+	{ 125255, 142112, 44 },
+	{ 125256, 142156, 44 },
+	{ 125257, 142200, 43 },
+	{ 125258, 142243, 43 },
+	{ 125259, 142286, 38 },
+	{ 125260, 142324, 38 },
+	{ 125261, 142362, 38 },
+	{ 125262, 142400, 37 },
+	{ 125263, 142437, 37 },
+	{ 125264, 142474, 35 },
+	{ 125265, 142509, 35 },
+	{ 125266, 142544, 35 },
+	{ 125267, 142579, 34 },
+	{ 125268, 142613, 34 },
+	{ 125269, 142647, 44 },
+	{ 125270, 142691, 43 },
+	{ 125271, 142734, 43 },
+	{ 125272, 142777, 38 },
+	{ 125273, 142815, 37 },
+	{ 125274, 142852, 37 },
+	{ 125275, 142889, 35 },
+	{ 125276, 142924, 34 },
+	{ 125277, 142958, 34 },
+	{ 125278, 142992, 34 },
+	{ 125279, 143026, 34 },
+	{ 125280, 143060, 41 },
+	{ 125281, 143101, 43 },
+	{ 125282, 143144, 42 },
+	{ 125283, 143186, 37 },
+	{ 125284, 143223, 37 },
+	{ 125285, 143260, 36 },
+	{ 125286, 143296, 36 },
+	{ 125287, 143360, 33 },
+	{ 125288, 143393, 33 },
+	{ 125289, 143426, 32 },
+	{ 125290, 143458, 32 },
+	{ 125291, 143490, 31 },
+	{ 125292, 143521, 31 },
+	{ 125293, 143552, 30 },
+	{ 125294, 143582, 30 },
+	{ 125295, 143612, 41 },
+	{ 125296, 143653, 41 },
+	{ 125297, 143694, 41 },
+	{ 125298, 143735, 40 },
+	{ 125299, 143775, 40 },
+	{ 125300, 143815, 35 },
+	{ 125301, 143850, 35 },
+	{ 125302, 143885, 35 },
+	{ 125303, 143920, 34 },
+	{ 125304, 143954, 34 },
+	{ 125305, 143988, 32 },
+	{ 125306, 144020, 32 },
+	{ 125307, 144052, 32 },
+	{ 125308, 144084, 31 },
+	{ 125309, 144115, 31 },
+	{ 125310, 144146, 41 },
+	{ 125311, 144187, 40 },
+	{ 125312, 144227, 40 },
+	{ 125313, 144267, 35 },
+	{ 125314, 144302, 34 },
+	{ 125315, 144336, 34 },
+	{ 125316, 144370, 32 },
+	{ 125317, 144402, 31 },
+	{ 125318, 144433, 31 },
+	{ 125319, 144464, 31 },
+	{ 125320, 144495, 31 },
+	{ 125321, 144526, 38 },
+	{ 125322, 144564, 40 },
+	{ 125323, 144604, 39 },
+	{ 125324, 144643, 43 },
+	{ 125325, 144686, 43 },
+	{ 125326, 144729, 42 },
+	{ 125327, 144771, 42 },
+	{ 125328, 144813, 39 },
+	{ 125329, 144852, 39 },
+	{ 125330, 144891, 38 },
+	{ 125331, 144929, 38 },
+	{ 125332, 144967, 37 },
+	{ 125333, 145004, 37 },
+	{ 125334, 145041, 36 },
+	{ 125335, 145077, 36 },
+	{ 125336, 145113, 47 },
+	{ 125337, 145160, 47 },
+	{ 125338, 145207, 47 },
+	{ 125339, 145254, 46 },
+	{ 125340, 145300, 46 },
+	{ 125341, 145346, 41 },
+	{ 125342, 145387, 41 },
+	{ 125343, 145428, 41 },
+	{ 125344, 145469, 40 },
+	{ 125345, 145509, 40 },
+	{ 125346, 145549, 38 },
+	{ 125347, 145587, 38 },
+	{ 125348, 145625, 38 },
+	{ 125349, 145663, 37 },
+	{ 125350, 145700, 37 },
+	{ 125351, 145737, 47 },
+	{ 125352, 145784, 46 },
+	{ 125353, 145830, 46 },
+	{ 125354, 145876, 41 },
+	{ 125355, 145917, 40 },
+	{ 125356, 145957, 40 },
+	{ 125357, 145997, 38 },
+	{ 125358, 146035, 37 },
+	{ 125359, 146072, 37 },
+	{ 125360, 146109, 37 },
+	{ 125361, 146146, 37 },
+	{ 125362, 146183, 44 },
+	{ 125363, 146227, 46 },
+	{ 125364, 146273, 45 },
+	{ 125365, 146318, 34 },
+	{ 125366, 146352, 34 },
+	{ 125367, 146386, 33 },
+	{ 125368, 146419, 33 },
+	{ 125369, 146452, 30 },
+	{ 125370, 146482, 30 },
+	{ 125371, 146512, 29 },
+	{ 125372, 146541, 29 },
+	{ 125373, 146570, 28 },
+	{ 125374, 146598, 28 },
+	{ 125375, 146626, 27 },
+	{ 125376, 146653, 27 },
+	{ 125377, 146680, 38 },
+	{ 125378, 146718, 38 },
+	{ 125379, 146756, 38 },
+	{ 125380, 146794, 37 },
+	{ 125381, 146831, 37 },
+	{ 125382, 146868, 32 },
+	{ 125383, 146900, 32 },
+	{ 125384, 146932, 32 },
+	{ 125385, 146964, 31 },
+	{ 125386, 146995, 31 },
+	{ 125387, 147026, 29 },
+	{ 125388, 147055, 29 },
+	{ 125389, 147084, 29 },
+	{ 125390, 147113, 28 },
+	{ 125391, 147141, 28 },
+	{ 125392, 147169, 38 },
+	{ 125393, 147207, 37 },
+	{ 125394, 147244, 37 },
+	{ 125395, 147281, 32 },
+	{ 125396, 147313, 31 },
+	{ 125397, 147344, 31 },
+	{ 125398, 147375, 29 },
+	{ 125399, 147404, 28 },
+	{ 125400, 147456, 28 },
+	{ 125401, 147484, 28 },
+	{ 125402, 147512, 28 },
+	{ 125403, 147540, 35 },
+	{ 125404, 147575, 37 },
+	{ 125405, 147612, 36 },
+	{ 125406, 147648, 40 },
+	{ 125407, 147688, 40 },
+	{ 125408, 147728, 39 },
+	{ 125409, 147767, 39 },
+	{ 125410, 147806, 36 },
+	{ 125411, 147842, 36 },
+	{ 125412, 147878, 35 },
+	{ 125413, 147913, 35 },
+	{ 125414, 147948, 34 },
+	{ 125415, 147982, 34 },
+	{ 125416, 148016, 33 },
+	{ 125417, 148049, 33 },
+	{ 125418, 148082, 44 },
+	{ 125419, 148126, 44 },
+	{ 125420, 148170, 44 },
+	{ 125421, 148214, 43 },
+	{ 125422, 148257, 43 },
+	{ 125423, 148300, 38 },
+	{ 125424, 148338, 38 },
+	{ 125425, 148376, 38 },
+	{ 125426, 148414, 37 },
+	{ 125427, 148451, 37 },
+	{ 125428, 148488, 35 },
+	{ 125429, 148523, 35 },
+	{ 125430, 148558, 35 },
+	{ 125431, 148593, 34 },
+	{ 125432, 148627, 34 },
+	{ 125433, 148661, 44 },
+	{ 125434, 148705, 43 },
+	{ 125435, 148748, 43 },
+	{ 125436, 148791, 38 },
+	{ 125437, 148829, 37 },
+	{ 125438, 148866, 37 },
+	{ 125439, 148903, 35 },
+	{ 125440, 148938, 34 },
+	{ 125441, 148972, 34 },
+	{ 125442, 149006, 34 },
+	{ 125443, 149040, 34 },
+	{ 125444, 149074, 41 },
+	{ 125445, 149115, 43 },
+	{ 125446, 149158, 42 },
+	{ 125447, 149200, 37 },
+	{ 125448, 149237, 37 },
+	{ 125449, 149274, 36 },
+	{ 125450, 149310, 36 },
+	{ 125451, 149346, 33 },
+	{ 125452, 149379, 33 },
+	{ 125453, 149412, 32 },
+	{ 125454, 149444, 32 },
+	{ 125455, 149476, 31 },
+	{ 125456, 149507, 31 },
+	{ 125457, 149538, 30 },
+	{ 125458, 149568, 30 },
+	{ 125459, 149598, 41 },
+	{ 125460, 149639, 41 },
+	{ 125461, 149680, 41 },
+	{ 125462, 149721, 40 },
+	{ 125463, 149761, 40 },
+	{ 125464, 149801, 35 },
+	{ 125465, 149836, 35 },
+	{ 125466, 149871, 35 },
+	{ 125467, 149906, 34 },
+	{ 125468, 149940, 34 },
+	{ 125469, 149974, 32 },
+	{ 125470, 150006, 32 },
+	{ 125471, 150038, 32 },
+	{ 125472, 150070, 31 },
+	{ 125473, 150101, 31 },
+	{ 125474, 150132, 41 },
+	{ 125475, 150173, 40 },
+	{ 125476, 150213, 40 },
+	{ 125477, 150253, 35 },
+	{ 125478, 150288, 34 },
+	{ 125479, 150322, 34 },
+	{ 125480, 150356, 32 },
+	{ 125481, 150388, 31 },
+	{ 125482, 150419, 31 },
+	{ 125483, 150450, 31 },
+	{ 125484, 150481, 31 },
+	{ 125485, 150512, 38 },
+	{ 125486, 150550, 40 },
+	{ 125487, 150590, 39 },
+	{ 125488, 150629, 43 },
+	{ 125489, 150672, 43 },
+	{ 125490, 150715, 42 },
+	{ 125491, 150757, 42 },
+	{ 125492, 150799, 39 },
+	{ 125493, 150838, 39 },
+	{ 125494, 150877, 38 },
+	{ 125495, 150915, 38 },
+	{ 125496, 150953, 37 },
+	{ 125497, 150990, 37 },
+	{ 125498, 151027, 36 },
+	{ 125499, 151063, 36 },
+	{ 125500, 151099, 47 },
+	{ 125501, 151146, 47 },
+	{ 125502, 151193, 47 },
+	{ 125503, 151240, 46 },
+	{ 125504, 151286, 46 },
+	{ 125505, 151332, 41 },
+	{ 125506, 151373, 41 },
+	{ 125507, 151414, 41 },
+	{ 125508, 151455, 40 },
+	{ 125509, 151495, 40 },
+	{ 125510, 151552, 38 },
+	{ 125511, 151590, 38 },
+	{ 125512, 151628, 38 },
+	{ 125513, 151666, 37 },
+	{ 125514, 151703, 37 },
+	{ 125515, 151740, 47 },
+	{ 125516, 151787, 46 },
+	{ 125517, 151833, 46 },
+	{ 125518, 151879, 41 },
+	{ 125519, 151920, 40 },
+	{ 125520, 151960, 40 },
+	{ 125521, 152000, 38 },
+	{ 125522, 152038, 37 },
+	{ 125523, 152075, 37 },
+	{ 125524, 152112, 37 },
+	{ 125525, 152149, 37 },
+	{ 125526, 152186, 44 },
+	{ 125527, 152230, 46 },
+	{ 125528, 152276, 45 },
+	{ 125529, 152321, 36 },
+	{ 125530, 152357, 36 },
+	{ 125531, 152393, 35 },
+	{ 125532, 152428, 35 },
+	{ 125533, 152463, 32 },
+	{ 125534, 152495, 32 },
+	{ 125535, 152527, 31 },
+	{ 125536, 152558, 31 },
+	{ 125537, 152589, 30 },
+	{ 125538, 152619, 30 },
+	{ 125539, 152649, 29 },
+	{ 125540, 152678, 29 },
+	{ 125541, 152707, 40 },
+	{ 125542, 152747, 40 },
+	{ 125543, 152787, 40 },
+	{ 125544, 152827, 39 },
+	{ 125545, 152866, 39 },
+	{ 125546, 152905, 34 },
+	{ 125547, 152939, 34 },
+	{ 125548, 152973, 34 },
+	{ 125549, 153007, 33 },
+	{ 125550, 153040, 33 },
+	{ 125551, 153073, 31 },
+	{ 125552, 153104, 31 },
+	{ 125553, 153135, 31 },
+	{ 125554, 153166, 30 },
+	{ 125555, 153196, 30 },
+	{ 125556, 153226, 40 },
+	{ 125557, 153266, 39 },
+	{ 125558, 153305, 39 },
+	{ 125559, 153344, 34 },
+	{ 125560, 153378, 33 },
+	{ 125561, 153411, 33 },
+	{ 125562, 153444, 31 },
+	{ 125563, 153475, 30 },
+	{ 125564, 153505, 30 },
+	{ 125565, 153535, 30 },
+	{ 125566, 153565, 30 },
+	{ 125567, 153595, 37 },
+	{ 125568, 153632, 39 },
+	{ 125569, 153671, 38 },
+	{ 125570, 153709, 42 },
+	{ 125571, 153751, 42 },
+	{ 125572, 153793, 41 },
+	{ 125573, 153834, 41 },
+	{ 125574, 153875, 38 },
+	{ 125575, 153913, 38 },
+	{ 125576, 153951, 37 },
+	{ 125577, 153988, 37 },
+	{ 125578, 154025, 36 },
+	{ 125579, 154061, 36 },
+	{ 125580, 154097, 35 },
+	{ 125581, 154132, 35 },
+	{ 125582, 154167, 46 },
+	{ 125583, 154213, 46 },
+	{ 125584, 154259, 46 },
+	{ 125585, 154305, 45 },
+	{ 125586, 154350, 45 },
+	{ 125587, 154395, 40 },
+	{ 125588, 154435, 40 },
+	{ 125589, 154475, 40 },
+	{ 125590, 154515, 39 },
+	{ 125591, 154554, 39 },
+	{ 125592, 154593, 37 },
+	{ 125593, 154630, 37 },
+	{ 125594, 154667, 37 },
+	{ 125595, 154704, 36 },
+	{ 125596, 154740, 36 },
+	{ 125597, 154776, 46 },
+	{ 125598, 154822, 45 },
+	{ 125599, 154867, 45 },
+	{ 125600, 154912, 40 },
+	{ 125601, 154952, 39 },
+	{ 125602, 154991, 39 },
+	{ 125603, 155030, 37 },
+	{ 125604, 155067, 36 },
+	{ 125605, 155103, 36 },
+	{ 125606, 155139, 36 },
+	{ 125607, 155175, 36 },
+	{ 125608, 155211, 43 },
+	{ 125609, 155254, 45 },
+	{ 125610, 155299, 44 },
+	{ 125611, 155343, 39 },
+	{ 125612, 155382, 39 },
+	{ 125613, 155421, 38 },
+	{ 125614, 155459, 38 },
+	{ 125615, 155497, 35 },
+	{ 125616, 155532, 35 },
+	{ 125617, 155567, 34 },
+	{ 125618, 155601, 34 },
+	{ 125619, 155648, 33 },
+	{ 125620, 155681, 33 },
+	{ 125621, 155714, 32 },
+	{ 125622, 155746, 32 },
+	{ 125623, 155778, 43 },
+	{ 125624, 155821, 43 },
+	{ 125625, 155864, 43 },
+	{ 125626, 155907, 42 },
+	{ 125627, 155949, 42 },
+	{ 125628, 155991, 37 },
+	{ 125629, 156028, 37 },
+	{ 125630, 156065, 37 },
+	{ 125631, 156102, 36 },
+	{ 125632, 156138, 36 },
+	{ 125633, 156174, 34 },
+	{ 125634, 156208, 34 },
+	{ 125635, 156242, 34 },
+	{ 125636, 156276, 33 },
+	{ 125637, 156309, 33 },
+	{ 125638, 156342, 43 },
+	{ 125639, 156385, 42 },
+	{ 125640, 156427, 42 },
+	{ 125641, 156469, 37 },
+	{ 125642, 156506, 36 },
+	{ 125643, 156542, 36 },
+	{ 125644, 156578, 34 },
+	{ 125645, 156612, 33 },
+	{ 125646, 156645, 33 },
+	{ 125647, 156678, 33 },
+	{ 125648, 156711, 33 },
+	{ 125649, 156744, 40 },
+	{ 125650, 156784, 42 },
+	{ 125651, 156826, 41 },
+	{ 125652, 156867, 45 },
+	{ 125653, 156912, 45 },
+	{ 125654, 156957, 44 },
+	{ 125655, 157001, 44 },
+	{ 125656, 157045, 41 },
+	{ 125657, 157086, 41 },
+	{ 125658, 157127, 40 },
+	{ 125659, 157167, 40 },
+	{ 125660, 157207, 39 },
+	{ 125661, 157246, 39 },
+	{ 125662, 157285, 38 },
+	{ 125663, 157323, 38 },
+	{ 125664, 157361, 49 },
+	{ 125665, 157410, 49 },
+	{ 125666, 157459, 49 },
+	{ 125667, 157508, 48 },
+	{ 125668, 157556, 48 },
+	{ 125669, 157604, 43 },
+	{ 125670, 157647, 43 },
+	{ 125671, 157690, 43 },
+	{ 125672, 157733, 42 },
+	{ 125673, 157775, 42 },
+	{ 125674, 157817, 40 },
+	{ 125675, 157857, 40 },
+	{ 125676, 157897, 40 },
+	{ 125677, 157937, 39 },
+	{ 125678, 157976, 39 },
+	{ 125679, 158015, 49 },
+	{ 125680, 158064, 48 },
+	{ 125681, 158112, 48 },
+	{ 125682, 158160, 43 },
+	{ 125683, 158203, 42 },
+	{ 125684, 158245, 42 },
+	{ 125685, 158287, 40 },
+	{ 125686, 158327, 39 },
+	{ 125687, 158366, 39 },
+	{ 125688, 158405, 39 },
+	{ 125689, 158444, 39 },
+	{ 125690, 158483, 46 },
+	{ 125691, 158529, 48 },
+	{ 125692, 158577, 47 },
+	{ 126061, 158624, 36 },
+	{ 126062, 158660, 36 },
+	{ 126063, 158696, 35 },
+	{ 126064, 158731, 35 },
+	{ 126065, 158766, 32 },
+	{ 126066, 158798, 32 },
+	{ 126067, 158830, 31 },
+	{ 126068, 158861, 31 },
+	{ 126069, 158892, 30 },
+	{ 126070, 158922, 30 },
+	{ 126071, 158952, 29 },
+	{ 126072, 158981, 29 },
+	{ 126073, 159010, 40 },
+	{ 126074, 159050, 40 },
+	{ 126075, 159090, 40 },
+	{ 126076, 159130, 39 },
+	{ 126077, 159169, 39 },
+	{ 126078, 159208, 34 },
+	{ 126079, 159242, 34 },
+	{ 126080, 159276, 34 },
+	{ 126081, 159310, 33 },
+	{ 126082, 159343, 33 },
+	{ 126083, 159376, 31 },
+	{ 126084, 159407, 31 },
+	{ 126085, 159438, 31 },
+	{ 126086, 159469, 30 },
+	{ 126087, 159499, 30 },
+	{ 126088, 159529, 40 },
+	{ 126089, 159569, 39 },
+	{ 126090, 159608, 39 },
+	{ 126091, 159647, 34 },
+	{ 126092, 159681, 33 },
+	{ 126093, 159744, 33 },
+	{ 126094, 159777, 31 },
+	{ 126095, 159808, 30 },
+	{ 126096, 159838, 30 },
+	{ 126097, 159868, 30 },
+	{ 126098, 159898, 30 },
+	{ 126099, 159928, 37 },
+	{ 126100, 159965, 39 },
+	{ 126101, 160004, 38 },
+	{ 126102, 160042, 42 },
+	{ 126103, 160084, 42 },
+	{ 126104, 160126, 41 },
+	{ 126105, 160167, 41 },
+	{ 126106, 160208, 38 },
+	{ 126107, 160246, 38 },
+	{ 126108, 160284, 37 },
+	{ 126109, 160321, 37 },
+	{ 126110, 160358, 36 },
+	{ 126111, 160394, 36 },
+	{ 126112, 160430, 35 },
+	{ 126113, 160465, 35 },
+	{ 126114, 160500, 46 },
+	{ 126115, 160546, 46 },
+	{ 126116, 160592, 46 },
+	{ 126117, 160638, 45 },
+	{ 126118, 160683, 45 },
+	{ 126119, 160728, 40 },
+	{ 126120, 160768, 40 },
+	{ 126121, 160808, 40 },
+	{ 126122, 160848, 39 },
+	{ 126123, 160887, 39 },
+	{ 126124, 160926, 37 },
+	{ 126125, 160963, 37 },
+	{ 126126, 161000, 37 },
+	{ 126127, 161037, 36 },
+	{ 126128, 161073, 36 },
+	{ 126129, 161109, 46 },
+	{ 126130, 161155, 45 },
+	{ 126131, 161200, 45 },
+	{ 126132, 161245, 40 },
+	{ 126133, 161285, 39 },
+	{ 126134, 161324, 39 },
+	{ 126135, 161363, 37 },
+	{ 126136, 161400, 36 },
+	{ 126137, 161436, 36 },
+	{ 126138, 161472, 36 },
+	{ 126139, 161508, 36 },
+	{ 126140, 161544, 43 },
+	{ 126141, 161587, 45 },
+	{ 126142, 161632, 44 },
+	{ 126143, 161676, 39 },
+	{ 126144, 161715, 39 },
+	{ 126145, 161754, 38 },
+	{ 126146, 161792, 38 },
+	{ 126147, 161830, 35 },
+	{ 126148, 161865, 35 },
+	{ 126149, 161900, 34 },
+	{ 126150, 161934, 34 },
+	{ 126151, 161968, 33 },
+	{ 126152, 162001, 33 },
+	{ 126153, 162034, 32 },
+	{ 126154, 162066, 32 },
+	{ 126155, 162098, 43 },
+	{ 126156, 162141, 43 },
+	{ 126157, 162184, 43 },
+	{ 126158, 162227, 42 },
+	{ 126159, 162269, 42 },
+	{ 126160, 162311, 37 },
+	{ 126161, 162348, 37 },
+	{ 126162, 162385, 37 },
+	{ 126163, 162422, 36 },
+	{ 126164, 162458, 36 },
+	{ 126165, 162494, 34 },
+	{ 126166, 162528, 34 },
+	{ 126167, 162562, 34 },
+	{ 126168, 162596, 33 },
+	{ 126169, 162629, 33 },
+	{ 126170, 162662, 43 },
+	{ 126171, 162705, 42 },
+	{ 126172, 162747, 42 },
+	{ 126173, 162789, 37 },
+	{ 126174, 162826, 36 },
+	{ 126175, 162862, 36 },
+	{ 126176, 162898, 34 },
+	{ 126177, 162932, 33 },
+	{ 126178, 162965, 33 },
+	{ 126179, 162998, 33 },
+	{ 126180, 163031, 33 },
+	{ 126181, 163064, 40 },
+	{ 126182, 163104, 42 },
+	{ 126183, 163146, 41 },
+	{ 126184, 163187, 45 },
+	{ 126185, 163232, 45 },
+	{ 126186, 163277, 44 },
+	{ 126187, 163321, 44 },
+	{ 126188, 163365, 41 },
+	{ 126189, 163406, 41 },
+	{ 126190, 163447, 40 },
+	{ 126191, 163487, 40 },
+	{ 126192, 163527, 39 },
+	{ 126193, 163566, 39 },
+	{ 126194, 163605, 38 },
+	{ 126195, 163643, 38 },
+	{ 126196, 163681, 49 },
+	{ 126197, 163730, 49 },
+	{ 126198, 163779, 49 },
+	{ 126199, 163840, 48 },
+	{ 126200, 163888, 48 },
+	{ 126201, 163936, 43 },
+	{ 126202, 163979, 43 },
+	{ 126203, 164022, 43 },
+	{ 126204, 164065, 42 },
+	{ 126205, 164107, 42 },
+	{ 126206, 164149, 40 },
+	{ 126207, 164189, 40 },
+	{ 126208, 164229, 40 },
+	{ 126209, 164269, 39 },
+	{ 126210, 164308, 39 },
+	{ 126211, 164347, 49 },
+	{ 126212, 164396, 48 },
+	{ 126213, 164444, 48 },
+	{ 126214, 164492, 43 },
+	{ 126215, 164535, 42 },
+	{ 126216, 164577, 42 },
+	{ 126217, 164619, 40 },
+	{ 126218, 164659, 39 },
+	{ 126219, 164698, 39 },
+	{ 126220, 164737, 39 },
+	{ 126221, 164776, 39 },
+	{ 126222, 164815, 46 },
+	{ 126223, 164861, 48 },
+	{ 126224, 164909, 47 },
+	{ 126225, 164956, 36 },
+	{ 126226, 164992, 36 },
+	{ 126227, 165028, 35 },
+	{ 126228, 165063, 35 },
+	{ 126229, 165098, 32 },
+	{ 126230, 165130, 32 },
+	{ 126231, 165162, 31 },
+	{ 126232, 165193, 31 },
+	{ 126233, 165224, 30 },
+	{ 126234, 165254, 30 },
+	{ 126235, 165284, 29 },
+	{ 126236, 165313, 29 },
+	{ 126237, 165342, 40 },
+	{ 126238, 165382, 40 },
+	{ 126239, 165422, 40 },
+	{ 126240, 165462, 39 },
+	{ 126241, 165501, 39 },
+	{ 126242, 165540, 34 },
+	{ 126243, 165574, 34 },
+	{ 126244, 165608, 34 },
+	{ 126245, 165642, 33 },
+	{ 126246, 165675, 33 },
+	{ 126247, 165708, 31 },
+	{ 126248, 165739, 31 },
+	{ 126249, 165770, 31 },
+	{ 126250, 165801, 30 },
+	{ 126251, 165831, 30 },
+	{ 126252, 165861, 40 },
+	{ 126253, 165901, 39 },
+	{ 126254, 165940, 39 },
+	{ 126255, 165979, 34 },
+	{ 126256, 166013, 33 },
+	{ 126257, 166046, 33 },
+	{ 126258, 166079, 31 },
+	{ 126259, 166110, 30 },
+	{ 126260, 166140, 30 },
+	{ 126261, 166170, 30 },
+	{ 126262, 166200, 30 },
+	{ 126263, 166230, 37 },
+	{ 126264, 166267, 39 },
+	{ 126265, 166306, 38 },
+	{ 126266, 166344, 42 },
+	{ 126267, 166386, 42 },
+	{ 126268, 166428, 41 },
+	{ 126269, 166469, 41 },
+	{ 126270, 166510, 38 },
+	{ 126271, 166548, 38 },
+	{ 126272, 166586, 37 },
+	{ 126273, 166623, 37 },
+	{ 126274, 166660, 36 },
+	{ 126275, 166696, 36 },
+	{ 126276, 166732, 35 },
+	{ 126277, 166767, 35 },
+	{ 126278, 166802, 46 },
+	{ 126279, 166848, 46 },
+	{ 126280, 166894, 46 },
+	{ 126281, 166940, 45 },
+	{ 126282, 166985, 45 },
+	{ 126283, 167030, 40 },
+	{ 126284, 167070, 40 },
+	{ 126285, 167110, 40 },
+	{ 126286, 167150, 39 },
+	{ 126287, 167189, 39 },
+	{ 126288, 167228, 37 },
+	{ 126289, 167265, 37 },
+	{ 126290, 167302, 37 },
+	{ 126291, 167339, 36 },
+	{ 126292, 167375, 36 },
+	{ 126293, 167411, 46 },
+	{ 126294, 167457, 45 },
+	{ 126295, 167502, 45 },
+	{ 126296, 167547, 40 },
+	{ 126297, 167587, 39 },
+	{ 126298, 167626, 39 },
+	{ 126299, 167665, 37 },
+	{ 126300, 167702, 36 },
+	{ 126301, 167738, 36 },
+	{ 126302, 167774, 36 },
+	{ 126303, 167810, 36 },
+	{ 126304, 167846, 43 },
+	{ 126305, 167889, 45 },
+	{ 126306, 167936, 44 },
+	{ 126307, 167980, 39 },
+	{ 126308, 168019, 39 },
+	{ 126309, 168058, 38 },
+	{ 126310, 168096, 38 },
+	{ 126311, 168134, 35 },
+	{ 126312, 168169, 35 },
+	{ 126313, 168204, 34 },
+	{ 126314, 168238, 34 },
+	{ 126315, 168272, 33 },
+	{ 126316, 168305, 33 },
+	{ 126317, 168338, 32 },
+	{ 126318, 168370, 32 },
+	{ 126319, 168402, 43 },
+	{ 126320, 168445, 43 },
+	{ 126321, 168488, 43 },
+	{ 126322, 168531, 42 },
+	{ 126323, 168573, 42 },
+	{ 126324, 168615, 37 },
+	{ 126325, 168652, 37 },
+	{ 126326, 168689, 37 },
+	{ 126327, 168726, 36 },
+	{ 126328, 168762, 36 },
+	{ 126329, 168798, 34 },
+	{ 126330, 168832, 34 },
+	{ 126331, 168866, 34 },
+	{ 126332, 168900, 33 },
+	{ 126333, 168933, 33 },
+	{ 126334, 168966, 43 },
+	{ 126335, 169009, 42 },
+	{ 126336, 169051, 42 },
+	{ 126337, 169093, 37 },
+	{ 126338, 169130, 36 },
+	{ 126339, 169166, 36 },
+	{ 126340, 169202, 34 },
+	{ 126341, 169236, 33 },
+	{ 126342, 169269, 33 },
+	{ 126343, 169302, 33 },
+	{ 126344, 169335, 33 },
+	{ 126345, 169368, 40 },
+	{ 126346, 169408, 42 },
+	{ 126347, 169450, 41 },
+	{ 126348, 169491, 45 },
+	{ 126349, 169536, 45 },
+	{ 126350, 169581, 44 },
+	{ 126351, 169625, 44 },
+	{ 126352, 169669, 41 },
+	{ 126353, 169710, 41 },
+	{ 126354, 169751, 40 },
+	{ 126355, 169791, 40 },
+	{ 126356, 169831, 39 },
+	{ 126357, 169870, 39 },
+	{ 126358, 169909, 38 },
+	{ 126359, 169947, 38 },
+	{ 126360, 169985, 49 },
+	{ 126361, 170034, 49 },
+	{ 126362, 170083, 49 },
+	{ 126363, 170132, 48 },
+	{ 126364, 170180, 48 },
+	{ 126365, 170228, 43 },
+	{ 126366, 170271, 43 },
+	{ 126367, 170314, 43 },
+	{ 126368, 170357, 42 },
+	{ 126369, 170399, 42 },
+	{ 126370, 170441, 40 },
+	{ 126371, 170481, 40 },
+	{ 126372, 170521, 40 },
+	{ 126373, 170561, 39 },
+	{ 126374, 170600, 39 },
+	{ 126375, 170639, 49 },
+	{ 126376, 170688, 48 },
+	{ 126377, 170736, 48 },
+	{ 126378, 170784, 43 },
+	{ 126379, 170827, 42 },
+	{ 126380, 170869, 42 },
+	{ 126381, 170911, 40 },
+	{ 126382, 170951, 39 },
+	{ 126383, 170990, 39 },
+	{ 126384, 171029, 39 },
+	{ 126385, 171068, 39 },
+	{ 126386, 171107, 46 },
+	{ 126387, 171153, 48 },
+	{ 126388, 171201, 47 },
+	{ 126389, 171248, 36 },
+	{ 126390, 171284, 36 },
+	{ 126391, 171320, 35 },
+	{ 126392, 171355, 35 },
+	{ 126393, 171390, 32 },
+	{ 126394, 171422, 32 },
+	{ 126395, 171454, 31 },
+	{ 126396, 171485, 31 },
+	{ 126397, 171516, 30 },
+	{ 126398, 171546, 30 },
+	{ 126399, 171576, 29 },
+	{ 126400, 171605, 29 },
+	{ 126401, 171634, 40 },
+	{ 126402, 171674, 40 },
+	{ 126403, 171714, 40 },
+	{ 126404, 171754, 39 },
+	{ 126405, 171793, 39 },
+	{ 126406, 171832, 34 },
+	{ 126407, 171866, 34 },
+	{ 126408, 171900, 34 },
+	{ 126409, 171934, 33 },
+	{ 126410, 171967, 33 },
+	{ 126411, 172000, 31 },
+	{ 126412, 172032, 31 },
+	{ 126413, 172063, 31 },
+	{ 126414, 172094, 30 },
+	{ 126415, 172124, 30 },
+	{ 126416, 172154, 40 },
+	{ 126417, 172194, 39 },
+	{ 126418, 172233, 39 },
+	{ 126419, 172272, 34 },
+	{ 126420, 172306, 33 },
+	{ 126421, 172339, 33 },
+	{ 126422, 172372, 31 },
+	{ 126423, 172403, 30 },
+	{ 126424, 172433, 30 },
+	{ 126425, 172463, 30 },
+	{ 126426, 172493, 30 },
+	{ 126427, 172523, 37 },
+	{ 126428, 172560, 39 },
+	{ 126429, 172599, 38 },
+	{ 126430, 172637, 42 },
+	{ 126431, 172679, 42 },
+	{ 126432, 172721, 41 },
+	{ 126433, 172762, 41 },
+	{ 126434, 172803, 38 },
+	{ 126435, 172841, 38 },
+	{ 126436, 172879, 37 },
+	{ 126437, 172916, 37 },
+	{ 126438, 172953, 36 },
+	{ 126439, 172989, 36 },
+	{ 126440, 173025, 35 },
+	{ 126441, 173060, 35 },
+	{ 126442, 173095, 46 },
+	{ 126443, 173141, 46 },
+	{ 126444, 173187, 46 },
+	{ 126445, 173233, 45 },
+	{ 126446, 173278, 45 },
+	{ 126447, 173323, 40 },
+	{ 126448, 173363, 40 },
+	{ 126449, 173403, 40 },
+	{ 126450, 173443, 39 },
+	{ 126451, 173482, 39 },
+	{ 126452, 173521, 37 },
+	{ 126453, 173558, 37 },
+	{ 126454, 173595, 37 },
+	{ 126455, 173632, 36 },
+	{ 126456, 173668, 36 },
+	{ 126457, 173704, 46 },
+	{ 126458, 173750, 45 },
+	{ 126459, 173795, 45 },
+	{ 126460, 173840, 40 },
+	{ 126461, 173880, 39 },
+	{ 126462, 173919, 39 },
+	{ 126463, 173958, 37 },
+	{ 126464, 173995, 36 },
+	{ 126465, 174031, 36 },
+	{ 126466, 174067, 36 },
+	{ 126467, 174103, 36 },
+	{ 126468, 174139, 43 },
+	{ 126469, 174182, 45 },
+	{ 126470, 174227, 44 },
+	{ 126471, 174271, 39 },
+	{ 126472, 174310, 39 },
+	{ 126473, 174349, 38 },
+	{ 126474, 174387, 38 },
+	{ 126475, 174425, 35 },
+	{ 126476, 174460, 35 },
+	{ 126477, 174495, 34 },
+	{ 126478, 174529, 34 },
+	{ 126479, 174563, 33 },
+	{ 126480, 174596, 33 },
+	{ 126481, 174629, 32 },
+	{ 126482, 174661, 32 },
+	{ 126483, 174693, 43 },
+	{ 126484, 174736, 43 },
+	{ 126485, 174779, 43 },
+	{ 126486, 174822, 42 },
+	{ 126487, 174864, 42 },
+	{ 126488, 174906, 37 },
+	{ 126489, 174943, 37 },
+	{ 126490, 174980, 37 },
+	{ 126491, 175017, 36 },
+	{ 126492, 175053, 36 },
+	{ 126493, 175089, 34 },
+	{ 126494, 175123, 34 },
+	{ 126495, 175157, 34 },
+	{ 126496, 175191, 33 },
+	{ 126497, 175224, 33 },
+	{ 126498, 175257, 43 },
+	{ 126499, 175300, 42 },
+	{ 126500, 175342, 42 },
+	{ 126501, 175384, 37 },
+	{ 126502, 175421, 36 },
+	{ 126503, 175457, 36 },
+	{ 126504, 175493, 34 },
+	{ 126505, 175527, 33 },
+	{ 126506, 175560, 33 },
+	{ 126507, 175593, 33 },
+	{ 126508, 175626, 33 },
+	{ 126509, 175659, 40 },
+	{ 126510, 175699, 42 },
+	{ 126511, 175741, 41 },
+	{ 126512, 175782, 45 },
+	{ 126513, 175827, 45 },
+	{ 126514, 175872, 44 },
+	{ 126515, 175916, 44 },
+	{ 126516, 175960, 41 },
+	{ 126517, 176001, 41 },
+	{ 126518, 176042, 40 },
+	{ 126519, 176082, 40 },
+	{ 126520, 176128, 39 },
+	{ 126521, 176167, 39 },
+	{ 126522, 176206, 38 },
+	{ 126523, 176244, 38 },
+	{ 126524, 176282, 49 },
+	{ 126525, 176331, 49 },
+	{ 126526, 176380, 49 },
+	{ 126527, 176429, 48 },
+	{ 126528, 176477, 48 },
+	{ 126529, 176525, 43 },
+	{ 126530, 176568, 43 },
+	{ 126531, 176611, 43 },
+	{ 126532, 176654, 42 },
+	{ 126533, 176696, 42 },
+	{ 126534, 176738, 40 },
+	{ 126535, 176778, 40 },
+	{ 126536, 176818, 40 },
+	{ 126537, 176858, 39 },
+	{ 126538, 176897, 39 },
+	{ 126539, 176936, 49 },
+	{ 126540, 176985, 48 },
+	{ 126541, 177033, 48 },
+	{ 126542, 177081, 43 },
+	{ 126543, 177124, 42 },
+	{ 126544, 177166, 42 },
+	{ 126545, 177208, 40 },
+	{ 126546, 177248, 39 },
+	{ 126547, 177287, 39 },
+	{ 126548, 177326, 39 },
+	{ 126549, 177365, 39 },
+	{ 126550, 177404, 46 },
+	{ 126551, 177450, 48 },
+	{ 126552, 177498, 47 },
+	{ 126553, 177545, 38 },
+	{ 126554, 177583, 38 },
+	{ 126555, 177621, 37 },
+	{ 126556, 177658, 37 },
+	{ 126557, 177695, 34 },
+	{ 126558, 177729, 34 },
+	{ 126559, 177763, 33 },
+	{ 126560, 177796, 33 },
+	{ 126561, 177829, 32 },
+	{ 126562, 177861, 32 },
+	{ 126563, 177893, 31 },
+	{ 126564, 177924, 31 },
+	{ 126565, 177955, 42 },
+	{ 126566, 177997, 42 },
+	{ 126567, 178039, 42 },
+	{ 126568, 178081, 41 },
+	{ 126569, 178122, 41 },
+	{ 126570, 178163, 36 },
+	{ 126571, 178199, 36 },
+	{ 126572, 178235, 36 },
+	{ 126573, 178271, 35 },
+	{ 126574, 178306, 35 },
+	{ 126575, 178341, 33 },
+	{ 126576, 178374, 33 },
+	{ 126577, 178407, 33 },
+	{ 126578, 178440, 32 },
+	{ 126579, 178472, 32 },
+	{ 126580, 178504, 42 },
+	{ 126581, 178546, 41 },
+	{ 126582, 178587, 41 },
+	{ 126583, 178628, 36 },
+	{ 126584, 178664, 35 },
+	{ 126585, 178699, 35 },
+	{ 126586, 178734, 33 },
+	{ 126587, 178767, 32 },
+	{ 126588, 178799, 32 },
+	{ 126589, 178831, 32 },
+	{ 126590, 178863, 32 },
+	{ 126591, 178895, 39 },
+	{ 126592, 178934, 41 },
+	{ 126593, 178975, 40 },
+	{ 126594, 179015, 44 },
+	{ 126595, 179059, 44 },
+	{ 126596, 179103, 43 },
+	{ 126597, 179146, 43 },
+	{ 126598, 179189, 40 },
+	{ 126599, 179229, 40 },
+	{ 126600, 179269, 39 },
+	{ 126601, 179308, 39 },
+	{ 126602, 179347, 38 },
+	{ 126603, 179385, 38 },
+	{ 126604, 179423, 37 },
+	{ 126605, 179460, 37 },
+	{ 126606, 179497, 48 },
+	{ 126607, 179545, 48 },
+	{ 126608, 179593, 48 },
+	{ 126609, 179641, 47 },
+	{ 126610, 179688, 47 },
+	{ 126611, 179735, 42 },
+	{ 126612, 179777, 42 },
+	{ 126613, 179819, 42 },
+	{ 126614, 179861, 41 },
+	{ 126615, 179902, 41 },
+	{ 126616, 179943, 39 },
+	{ 126617, 179982, 39 },
+	{ 126618, 180021, 39 },
+	{ 126619, 180060, 38 },
+	{ 126620, 180098, 38 },
+	{ 126621, 180136, 48 },
+	{ 126622, 180224, 47 },
+	{ 126623, 180271, 47 },
+	{ 126624, 180318, 42 },
+	{ 126625, 180360, 41 },
+	{ 126626, 180401, 41 },
+	{ 126627, 180442, 39 },
+	{ 126628, 180481, 38 },
+	{ 126629, 180519, 38 },
+	{ 126630, 180557, 38 },
+	{ 126631, 180595, 38 },
+	{ 126632, 180633, 45 },
+	{ 126633, 180678, 47 },
+	{ 126634, 180725, 46 },
+	{ 126635, 180771, 41 },
+	{ 126636, 180812, 41 },
+	{ 126637, 180853, 40 },
+	{ 126638, 180893, 40 },
+	{ 126639, 180933, 37 },
+	{ 126640, 180970, 37 },
+	{ 126641, 181007, 36 },
+	{ 126642, 181043, 36 },
+	{ 126643, 181079, 35 },
+	{ 126644, 181114, 35 },
+	{ 126645, 181149, 34 },
+	{ 126646, 181183, 34 },
+	{ 126647, 181217, 45 },
+	{ 126648, 181262, 45 },
+	{ 126649, 181307, 45 },
+	{ 126650, 181352, 44 },
+	{ 126651, 181396, 44 },
+	{ 126652, 181440, 39 },
+	{ 126653, 181479, 39 },
+	{ 126654, 181518, 39 },
+	{ 126655, 181557, 38 },
+	{ 126656, 181595, 38 },
+	{ 126657, 181633, 36 },
+	{ 126658, 181669, 36 },
+	{ 126659, 181705, 36 },
+	{ 126660, 181741, 35 },
+	{ 126661, 181776, 35 },
+	{ 126662, 181811, 45 },
+	{ 126663, 181856, 44 },
+	{ 126664, 181900, 44 },
+	{ 126665, 181944, 39 },
+	{ 126666, 181983, 38 },
+	{ 126667, 182021, 38 },
+	{ 126668, 182059, 36 },
+	{ 126669, 182095, 35 },
+	{ 126670, 182130, 35 },
+	{ 126671, 182165, 35 },
+	{ 126672, 182200, 35 },
+	{ 126673, 182235, 42 },
+	{ 126674, 182277, 44 },
+	{ 126675, 182321, 43 },
+	{ 126676, 182364, 47 },
+	{ 126677, 182411, 47 },
+	{ 126678, 182458, 46 },
+	{ 126679, 182504, 46 },
+	{ 126680, 182550, 43 },
+	{ 126681, 182593, 43 },
+	{ 126682, 182636, 42 },
+	{ 126683, 182678, 42 },
+	{ 126684, 182720, 41 },
+	{ 126685, 182761, 41 },
+	{ 126686, 182802, 40 },
+	{ 126687, 182842, 40 },
+	{ 126688, 182882, 51 },
+	{ 126689, 182933, 51 },
+	{ 126690, 182984, 51 },
+	{ 126691, 183035, 50 },
+	{ 126692, 183085, 50 },
+	{ 126693, 183135, 45 },
+	{ 126694, 183180, 45 },
+	{ 126695, 183225, 45 },
+	{ 126696, 183270, 44 },
+	{ 126697, 183314, 44 },
+	{ 126698, 183358, 42 },
+	{ 126699, 183400, 42 },
+	{ 126700, 183442, 42 },
+	{ 126701, 183484, 41 },
+	{ 126702, 183525, 41 },
+	{ 126703, 183566, 51 },
+	{ 126704, 183617, 50 },
+	{ 126705, 183667, 50 },
+	{ 126706, 183717, 45 },
+	{ 126707, 183762, 44 },
+	{ 126708, 183806, 44 },
+	{ 126709, 183850, 42 },
+	{ 126710, 183892, 41 },
+	{ 126711, 183933, 41 },
+	{ 126712, 183974, 41 },
+	{ 126713, 184015, 41 },
+	{ 126714, 184056, 48 },
+	{ 126715, 184104, 50 },
+	{ 126716, 184154, 49 },
+	{ 127085, 184203, 36 },
+	{ 127086, 184239, 36 },
+	{ 127087, 184275, 35 },
+	{ 127088, 184320, 35 },
+	{ 127089, 184355, 32 },
+	{ 127090, 184387, 32 },
+	{ 127091, 184419, 31 },
+	{ 127092, 184450, 31 },
+	{ 127093, 184481, 30 },
+	{ 127094, 184511, 30 },
+	{ 127095, 184541, 29 },
+	{ 127096, 184570, 29 },
+	{ 127097, 184599, 40 },
+	{ 127098, 184639, 40 },
+	{ 127099, 184679, 40 },
+	{ 127100, 184719, 39 },
+	{ 127101, 184758, 39 },
+	{ 127102, 184797, 34 },
+	{ 127103, 184831, 34 },
+	{ 127104, 184865, 34 },
+	{ 127105, 184899, 33 },
+	{ 127106, 184932, 33 },
+	{ 127107, 184965, 31 },
+	{ 127108, 184996, 31 },
+	{ 127109, 185027, 31 },
+	{ 127110, 185058, 30 },
+	{ 127111, 185088, 30 },
+	{ 127112, 185118, 40 },
+	{ 127113, 185158, 39 },
+	{ 127114, 185197, 39 },
+	{ 127115, 185236, 34 },
+	{ 127116, 185270, 33 },
+	{ 127117, 185303, 33 },
+	{ 127118, 185336, 31 },
+	{ 127119, 185367, 30 },
+	{ 127120, 185397, 30 },
+	{ 127121, 185427, 30 },
+	{ 127122, 185457, 30 },
+	{ 127123, 185487, 37 },
+	{ 127124, 185524, 39 },
+	{ 127125, 185563, 38 },
+	{ 127126, 185601, 42 },
+	{ 127127, 185643, 42 },
+	{ 127128, 185685, 41 },
+	{ 127129, 185726, 41 },
+	{ 127130, 185767, 38 },
+	{ 127131, 185805, 38 },
+	{ 127132, 185843, 37 },
+	{ 127133, 185880, 37 },
+	{ 127134, 185917, 36 },
+	{ 127135, 185953, 36 },
+	{ 127136, 185989, 35 },
+	{ 127137, 186024, 35 },
+	{ 127138, 186059, 46 },
+	{ 127139, 186105, 46 },
+	{ 127140, 186151, 46 },
+	{ 127141, 186197, 45 },
+	{ 127142, 186242, 45 },
+	{ 127143, 186287, 40 },
+	{ 127144, 186327, 40 },
+	{ 127145, 186367, 40 },
+	{ 127146, 186407, 39 },
+	{ 127147, 186446, 39 },
+	{ 127148, 186485, 37 },
+	{ 127149, 186522, 37 },
+	{ 127150, 186559, 37 },
+	{ 127151, 186596, 36 },
+	{ 127152, 186632, 36 },
+	{ 127153, 186668, 46 },
+	{ 127154, 186714, 45 },
+	{ 127155, 186759, 45 },
+	{ 127156, 186804, 40 },
+	{ 127157, 186844, 39 },
+	{ 127158, 186883, 39 },
+	{ 127159, 186922, 37 },
+	{ 127160, 186959, 36 },
+	{ 127161, 186995, 36 },
+	{ 127162, 187031, 36 },
+	{ 127163, 187067, 36 },
+	{ 127164, 187103, 43 },
+	{ 127165, 187146, 45 },
+	{ 127166, 187191, 44 },
+	{ 127167, 187235, 39 },
+	{ 127168, 187274, 39 },
+	{ 127169, 187313, 38 },
+	{ 127170, 187351, 38 },
+	{ 127171, 187389, 35 },
+	{ 127172, 187424, 35 },
+	{ 127173, 187459, 34 },
+	{ 127174, 187493, 34 },
+	{ 127175, 187527, 33 },
+	{ 127176, 187560, 33 },
+	{ 127177, 187593, 32 },
+	{ 127178, 187625, 32 },
+	{ 127179, 187657, 43 },
+	{ 127180, 187700, 43 },
+	{ 127181, 187743, 43 },
+	{ 127182, 187786, 42 },
+	{ 127183, 187828, 42 },
+	{ 127184, 187870, 37 },
+	{ 127185, 187907, 37 },
+	{ 127186, 187944, 37 },
+	{ 127187, 187981, 36 },
+	{ 127188, 188017, 36 },
+	{ 127189, 188053, 34 },
+	{ 127190, 188087, 34 },
+	{ 127191, 188121, 34 },
+	{ 127192, 188155, 33 },
+	{ 127193, 188188, 33 },
+	{ 127194, 188221, 43 },
+	{ 127195, 188264, 42 },
+	{ 127196, 188306, 42 },
+	{ 127197, 188348, 37 },
+	{ 127198, 188416, 36 },
+	{ 127199, 188452, 36 },
+	{ 127200, 188488, 34 },
+	{ 127201, 188522, 33 },
+	{ 127202, 188555, 33 },
+	{ 127203, 188588, 33 },
+	{ 127204, 188621, 33 },
+	{ 127205, 188654, 40 },
+	{ 127206, 188694, 42 },
+	{ 127207, 188736, 41 },
+	{ 127208, 188777, 45 },
+	{ 127209, 188822, 45 },
+	{ 127210, 188867, 44 },
+	{ 127211, 188911, 44 },
+	{ 127212, 188955, 41 },
+	{ 127213, 188996, 41 },
+	{ 127214, 189037, 40 },
+	{ 127215, 189077, 40 },
+	{ 127216, 189117, 39 },
+	{ 127217, 189156, 39 },
+	{ 127218, 189195, 38 },
+	{ 127219, 189233, 38 },
+	{ 127220, 189271, 49 },
+	{ 127221, 189320, 49 },
+	{ 127222, 189369, 49 },
+	{ 127223, 189418, 48 },
+	{ 127224, 189466, 48 },
+	{ 127225, 189514, 43 },
+	{ 127226, 189557, 43 },
+	{ 127227, 189600, 43 },
+	{ 127228, 189643, 42 },
+	{ 127229, 189685, 42 },
+	{ 127230, 189727, 40 },
+	{ 127231, 189767, 40 },
+	{ 127232, 189807, 40 },
+	{ 127233, 189847, 39 },
+	{ 127234, 189886, 39 },
+	{ 127235, 189925, 49 },
+	{ 127236, 189974, 48 },
+	{ 127237, 190022, 48 },
+	{ 127238, 190070, 43 },
+	{ 127239, 190113, 42 },
+	{ 127240, 190155, 42 },
+	{ 127241, 190197, 40 },
+	{ 127242, 190237, 39 },
+	{ 127243, 190276, 39 },
+	{ 127244, 190315, 39 },
+	{ 127245, 190354, 39 },
+	{ 127246, 190393, 46 },
+	{ 127247, 190439, 48 },
+	{ 127248, 190487, 47 },
+	{ 127249, 190534, 36 },
+	{ 127250, 190570, 36 },
+	{ 127251, 190606, 35 },
+	{ 127252, 190641, 35 },
+	{ 127253, 190676, 32 },
+	{ 127254, 190708, 32 },
+	{ 127255, 190740, 31 },
+	{ 127256, 190771, 31 },
+	{ 127257, 190802, 30 },
+	{ 127258, 190832, 30 },
+	{ 127259, 190862, 29 },
+	{ 127260, 190891, 29 },
+	{ 127261, 190920, 40 },
+	{ 127262, 190960, 40 },
+	{ 127263, 191000, 40 },
+	{ 127264, 191040, 39 },
+	{ 127265, 191079, 39 },
+	{ 127266, 191118, 34 },
+	{ 127267, 191152, 34 },
+	{ 127268, 191186, 34 },
+	{ 127269, 191220, 33 },
+	{ 127270, 191253, 33 },
+	{ 127271, 191286, 31 },
+	{ 127272, 191317, 31 },
+	{ 127273, 191348, 31 },
+	{ 127274, 191379, 30 },
+	{ 127275, 191409, 30 },
+	{ 127276, 191439, 40 },
+	{ 127277, 191479, 39 },
+	{ 127278, 191518, 39 },
+	{ 127279, 191557, 34 },
+	{ 127280, 191591, 33 },
+	{ 127281, 191624, 33 },
+	{ 127282, 191657, 31 },
+	{ 127283, 191688, 30 },
+	{ 127284, 191718, 30 },
+	{ 127285, 191748, 30 },
+	{ 127286, 191778, 30 },
+	{ 127287, 191808, 37 },
+	{ 127288, 191845, 39 },
+	{ 127289, 191884, 38 },
+	{ 127290, 191922, 42 },
+	{ 127291, 191964, 42 },
+	{ 127292, 192006, 41 },
+	{ 127293, 192047, 41 },
+	{ 127294, 192088, 38 },
+	{ 127295, 192126, 38 },
+	{ 127296, 192164, 37 },
+	{ 127297, 192201, 37 },
+	{ 127298, 192238, 36 },
+	{ 127299, 192274, 36 },
+	{ 127300, 192310, 35 },
+	{ 127301, 192345, 35 },
+	{ 127302, 192380, 46 },
+	{ 127303, 192426, 46 },
+	{ 127304, 192512, 46 },
+	{ 127305, 192558, 45 },
+	{ 127306, 192603, 45 },
+	{ 127307, 192648, 40 },
+	{ 127308, 192688, 40 },
+	{ 127309, 192728, 40 },
+	{ 127310, 192768, 39 },
+	{ 127311, 192807, 39 },
+	{ 127312, 192846, 37 },
+	{ 127313, 192883, 37 },
+	{ 127314, 192920, 37 },
+	{ 127315, 192957, 36 },
+	{ 127316, 192993, 36 },
+	{ 127317, 193029, 46 },
+	{ 127318, 193075, 45 },
+	{ 127319, 193120, 45 },
+	{ 127320, 193165, 40 },
+	{ 127321, 193205, 39 },
+	{ 127322, 193244, 39 },
+	{ 127323, 193283, 37 },
+	{ 127324, 193320, 36 },
+	{ 127325, 193356, 36 },
+	{ 127326, 193392, 36 },
+	{ 127327, 193428, 36 },
+	{ 127328, 193464, 43 },
+	{ 127329, 193507, 45 },
+	{ 127330, 193552, 44 },
+	{ 127331, 193596, 39 },
+	{ 127332, 193635, 39 },
+	{ 127333, 193674, 38 },
+	{ 127334, 193712, 38 },
+	{ 127335, 193750, 35 },
+	{ 127336, 193785, 35 },
+	{ 127337, 193820, 34 },
+	{ 127338, 193854, 34 },
+	{ 127339, 193888, 33 },
+	{ 127340, 193921, 33 },
+	{ 127341, 193954, 32 },
+	{ 127342, 193986, 32 },
+	{ 127343, 194018, 43 },
+	{ 127344, 194061, 43 },
+	{ 127345, 194104, 43 },
+	{ 127346, 194147, 42 },
+	{ 127347, 194189, 42 },
+	{ 127348, 194231, 37 },
+	{ 127349, 194268, 37 },
+	{ 127350, 194305, 37 },
+	{ 127351, 194342, 36 },
+	{ 127352, 194378, 36 },
+	{ 127353, 194414, 34 },
+	{ 127354, 194448, 34 },
+	{ 127355, 194482, 34 },
+	{ 127356, 194516, 33 },
+	{ 127357, 194549, 33 },
+	{ 127358, 194582, 43 },
+	{ 127359, 194625, 42 },
+	{ 127360, 194667, 42 },
+	{ 127361, 194709, 37 },
+	{ 127362, 194746, 36 },
+	{ 127363, 194782, 36 },
+	{ 127364, 194818, 34 },
+	{ 127365, 194852, 33 },
+	{ 127366, 194885, 33 },
+	{ 127367, 194918, 33 },
+	{ 127368, 194951, 33 },
+	{ 127369, 194984, 40 },
+	{ 127370, 195024, 42 },
+	{ 127371, 195066, 41 },
+	{ 127372, 195107, 45 },
+	{ 127373, 195152, 45 },
+	{ 127374, 195197, 44 },
+	{ 127375, 195241, 44 },
+	{ 127376, 195285, 41 },
+	{ 127377, 195326, 41 },
+	{ 127378, 195367, 40 },
+	{ 127379, 195407, 40 },
+	{ 127380, 195447, 39 },
+	{ 127381, 195486, 39 },
+	{ 127382, 195525, 38 },
+	{ 127383, 195563, 38 },
+	{ 127384, 195601, 49 },
+	{ 127385, 195650, 49 },
+	{ 127386, 195699, 49 },
+	{ 127387, 195748, 48 },
+	{ 127388, 195796, 48 },
+	{ 127389, 195844, 43 },
+	{ 127390, 195887, 43 },
+	{ 127391, 195930, 43 },
+	{ 127392, 195973, 42 },
+	{ 127393, 196015, 42 },
+	{ 127394, 196057, 40 },
+	{ 127395, 196097, 40 },
+	{ 127396, 196137, 40 },
+	{ 127397, 196177, 39 },
+	{ 127398, 196216, 39 },
+	{ 127399, 196255, 49 },
+	{ 127400, 196304, 48 },
+	{ 127401, 196352, 48 },
+	{ 127402, 196400, 43 },
+	{ 127403, 196443, 42 },
+	{ 127404, 196485, 42 },
+	{ 127405, 196527, 40 },
+	{ 127406, 196567, 39 },
+	{ 127407, 196608, 39 },
+	{ 127408, 196647, 39 },
+	{ 127409, 196686, 39 },
+	{ 127410, 196725, 46 },
+	{ 127411, 196771, 48 },
+	{ 127412, 196819, 47 },
+	{ 127413, 196866, 36 },
+	{ 127414, 196902, 36 },
+	{ 127415, 196938, 35 },
+	{ 127416, 196973, 35 },
+	{ 127417, 197008, 32 },
+	{ 127418, 197040, 32 },
+	{ 127419, 197072, 31 },
+	{ 127420, 197103, 31 },
+	{ 127421, 197134, 30 },
+	{ 127422, 197164, 30 },
+	{ 127423, 197194, 29 },
+	{ 127424, 197223, 29 },
+	{ 127425, 197252, 40 },
+	{ 127426, 197292, 40 },
+	{ 127427, 197332, 40 },
+	{ 127428, 197372, 39 },
+	{ 127429, 197411, 39 },
+	{ 127430, 197450, 34 },
+	{ 127431, 197484, 34 },
+	{ 127432, 197518, 34 },
+	{ 127433, 197552, 33 },
+	{ 127434, 197585, 33 },
+	{ 127435, 197618, 31 },
+	{ 127436, 197649, 31 },
+	{ 127437, 197680, 31 },
+	{ 127438, 197711, 30 },
+	{ 127439, 197741, 30 },
+	{ 127440, 197771, 40 },
+	{ 127441, 197811, 39 },
+	{ 127442, 197850, 39 },
+	{ 127443, 197889, 34 },
+	{ 127444, 197923, 33 },
+	{ 127445, 197956, 33 },
+	{ 127446, 197989, 31 },
+	{ 127447, 198020, 30 },
+	{ 127448, 198050, 30 },
+	{ 127449, 198080, 30 },
+	{ 127450, 198110, 30 },
+	{ 127451, 198140, 37 },
+	{ 127452, 198177, 39 },
+	{ 127453, 198216, 38 },
+	{ 127454, 198254, 42 },
+	{ 127455, 198296, 42 },
+	{ 127456, 198338, 41 },
+	{ 127457, 198379, 41 },
+	{ 127458, 198420, 38 },
+	{ 127459, 198458, 38 },
+	{ 127460, 198496, 37 },
+	{ 127461, 198533, 37 },
+	{ 127462, 198570, 36 },
+	{ 127463, 198606, 36 },
+	{ 127464, 198642, 35 },
+	{ 127465, 198677, 35 },
+	{ 127466, 198712, 46 },
+	{ 127467, 198758, 46 },
+	{ 127468, 198804, 46 },
+	{ 127469, 198850, 45 },
+	{ 127470, 198895, 45 },
+	{ 127471, 198940, 40 },
+	{ 127472, 198980, 40 },
+	{ 127473, 199020, 40 },
+	{ 127474, 199060, 39 },
+	{ 127475, 199099, 39 },
+	{ 127476, 199138, 37 },
+	{ 127477, 199175, 37 },
+	{ 127478, 199212, 37 },
+	{ 127479, 199249, 36 },
+	{ 127480, 199285, 36 },
+	{ 127481, 199321, 46 },
+	{ 127482, 199367, 45 },
+	{ 127483, 199412, 45 },
+	{ 127484, 199457, 40 },
+	{ 127485, 199497, 39 },
+	{ 127486, 199536, 39 },
+	{ 127487, 199575, 37 },
+	{ 127488, 199612, 36 },
+	{ 127489, 199648, 36 },
+	{ 127490, 199684, 36 },
+	{ 127491, 199720, 36 },
+	{ 127492, 199756, 43 },
+	{ 127493, 199799, 45 },
+	{ 127494, 199844, 44 },
+	{ 127495, 199888, 39 },
+	{ 127496, 199927, 39 },
+	{ 127497, 199966, 38 },
+	{ 127498, 200004, 38 },
+	{ 127499, 200042, 35 },
+	{ 127500, 200077, 35 },
+	{ 127501, 200112, 34 },
+	{ 127502, 200146, 34 },
+	{ 127503, 200180, 33 },
+	{ 127504, 200213, 33 },
+	{ 127505, 200246, 32 },
+	{ 127506, 200278, 32 },
+	{ 127507, 200310, 43 },
+	{ 127508, 200353, 43 },
+	{ 127509, 200396, 43 },
+	{ 127510, 200439, 42 },
+	{ 127511, 200481, 42 },
+	{ 127512, 200523, 37 },
+	{ 127513, 200560, 37 },
+	{ 127514, 200597, 37 },
+	{ 127515, 200634, 36 },
+	{ 127516, 200704, 36 },
+	{ 127517, 200740, 34 },
+	{ 127518, 200774, 34 },
+	{ 127519, 200808, 34 },
+	{ 127520, 200842, 33 },
+	{ 127521, 200875, 33 },
+	{ 127522, 200908, 43 },
+	{ 127523, 200951, 42 },
+	{ 127524, 200993, 42 },
+	{ 127525, 201035, 37 },
+	{ 127526, 201072, 36 },
+	{ 127527, 201108, 36 },
+	{ 127528, 201144, 34 },
+	{ 127529, 201178, 33 },
+	{ 127530, 201211, 33 },
+	{ 127531, 201244, 33 },
+	{ 127532, 201277, 33 },
+	{ 127533, 201310, 40 },
+	{ 127534, 201350, 42 },
+	{ 127535, 201392, 41 },
+	{ 127536, 201433, 45 },
+	{ 127537, 201478, 45 },
+	{ 127538, 201523, 44 },
+	{ 127539, 201567, 44 },
+	{ 127540, 201611, 41 },
+	{ 127541, 201652, 41 },
+	{ 127542, 201693, 40 },
+	{ 127543, 201733, 40 },
+	{ 127544, 201773, 39 },
+	{ 127545, 201812, 39 },
+	{ 127546, 201851, 38 },
+	{ 127547, 201889, 38 },
+	{ 127548, 201927, 49 },
+	{ 127549, 201976, 49 },
+	{ 127550, 202025, 49 },
+	{ 127551, 202074, 48 },
+	{ 127552, 202122, 48 },
+	{ 127553, 202170, 43 },
+	{ 127554, 202213, 43 },
+	{ 127555, 202256, 43 },
+	{ 127556, 202299, 42 },
+	{ 127557, 202341, 42 },
+	{ 127558, 202383, 40 },
+	{ 127559, 202423, 40 },
+	{ 127560, 202463, 40 },
+	{ 127561, 202503, 39 },
+	{ 127562, 202542, 39 },
+	{ 127563, 202581, 49 },
+	{ 127564, 202630, 48 },
+	{ 127565, 202678, 48 },
+	{ 127566, 202726, 43 },
+	{ 127567, 202769, 42 },
+	{ 127568, 202811, 42 },
+	{ 127569, 202853, 40 },
+	{ 127570, 202893, 39 },
+	{ 127571, 202932, 39 },
+	{ 127572, 202971, 39 },
+	{ 127573, 203010, 39 },
+	{ 127574, 203049, 46 },
+	{ 127575, 203095, 48 },
+	{ 127576, 203143, 47 },
+	{ 127577, 203190, 38 },
+	{ 127578, 203228, 38 },
+	{ 127579, 203266, 37 },
+	{ 127580, 203303, 37 },
+	{ 127581, 203340, 34 },
+	{ 127582, 203374, 34 },
+	{ 127583, 203408, 33 },
+	{ 127584, 203441, 33 },
+	{ 127585, 203474, 32 },
+	{ 127586, 203506, 32 },
+	{ 127587, 203538, 31 },
+	{ 127588, 203569, 31 },
+	{ 127589, 203600, 42 },
+	{ 127590, 203642, 42 },
+	{ 127591, 203684, 42 },
+	{ 127592, 203726, 41 },
+	{ 127593, 203767, 41 },
+	{ 127594, 203808, 36 },
+	{ 127595, 203844, 36 },
+	{ 127596, 203880, 36 },
+	{ 127597, 203916, 35 },
+	{ 127598, 203951, 35 },
+	{ 127599, 203986, 33 },
+	{ 127600, 204019, 33 },
+	{ 127601, 204052, 33 },
+	{ 127602, 204085, 32 },
+	{ 127603, 204117, 32 },
+	{ 127604, 204149, 42 },
+	{ 127605, 204191, 41 },
+	{ 127606, 204232, 41 },
+	{ 127607, 204273, 36 },
+	{ 127608, 204309, 35 },
+	{ 127609, 204344, 35 },
+	{ 127610, 204379, 33 },
+	{ 127611, 204412, 32 },
+	{ 127612, 204444, 32 },
+	{ 127613, 204476, 32 },
+	{ 127614, 204508, 32 },
+	{ 127615, 204540, 39 },
+	{ 127616, 204579, 41 },
+	{ 127617, 204620, 40 },
+	{ 127618, 204660, 44 },
+	{ 127619, 204704, 44 },
+	{ 127620, 204748, 43 },
+	{ 127621, 204800, 43 },
+	{ 127622, 204843, 40 },
+	{ 127623, 204883, 40 },
+	{ 127624, 204923, 39 },
+	{ 127625, 204962, 39 },
+	{ 127626, 205001, 38 },
+	{ 127627, 205039, 38 },
+	{ 127628, 205077, 37 },
+	{ 127629, 205114, 37 },
+	{ 127630, 205151, 48 },
+	{ 127631, 205199, 48 },
+	{ 127632, 205247, 48 },
+	{ 127633, 205295, 47 },
+	{ 127634, 205342, 47 },
+	{ 127635, 205389, 42 },
+	{ 127636, 205431, 42 },
+	{ 127637, 205473, 42 },
+	{ 127638, 205515, 41 },
+	{ 127639, 205556, 41 },
+	{ 127640, 205597, 39 },
+	{ 127641, 205636, 39 },
+	{ 127642, 205675, 39 },
+	{ 127643, 205714, 38 },
+	{ 127644, 205752, 38 },
+	{ 127645, 205790, 48 },
+	{ 127646, 205838, 47 },
+	{ 127647, 205885, 47 },
+	{ 127648, 205932, 42 },
+	{ 127649, 205974, 41 },
+	{ 127650, 206015, 41 },
+	{ 127651, 206056, 39 },
+	{ 127652, 206095, 38 },
+	{ 127653, 206133, 38 },
+	{ 127654, 206171, 38 },
+	{ 127655, 206209, 38 },
+	{ 127656, 206247, 45 },
+	{ 127657, 206292, 47 },
+	{ 127658, 206339, 46 },
+	{ 127659, 206385, 41 },
+	{ 127660, 206426, 41 },
+	{ 127661, 206467, 40 },
+	{ 127662, 206507, 40 },
+	{ 127663, 206547, 37 },
+	{ 127664, 206584, 37 },
+	{ 127665, 206621, 36 },
+	{ 127666, 206657, 36 },
+	{ 127667, 206693, 35 },
+	{ 127668, 206728, 35 },
+	{ 127669, 206763, 34 },
+	{ 127670, 206797, 34 },
+	{ 127671, 206831, 45 },
+	{ 127672, 206876, 45 },
+	{ 127673, 206921, 45 },
+	{ 127674, 206966, 44 },
+	{ 127675, 207010, 44 },
+	{ 127676, 207054, 39 },
+	{ 127677, 207093, 39 },
+	{ 127678, 207132, 39 },
+	{ 127679, 207171, 38 },
+	{ 127680, 207209, 38 },
+	{ 127681, 207247, 36 },
+	{ 127682, 207283, 36 },
+	{ 127683, 207319, 36 },
+	{ 127684, 207355, 35 },
+	{ 127685, 207390, 35 },
+	{ 127686, 207425, 45 },
+	{ 127687, 207470, 44 },
+	{ 127688, 207514, 44 },
+	{ 127689, 207558, 39 },
+	{ 127690, 207597, 38 },
+	{ 127691, 207635, 38 },
+	{ 127692, 207673, 36 },
+	{ 127693, 207709, 35 },
+	{ 127694, 207744, 35 },
+	{ 127695, 207779, 35 },
+	{ 127696, 207814, 35 },
+	{ 127697, 207849, 42 },
+	{ 127698, 207891, 44 },
+	{ 127699, 207935, 43 },
+	{ 127700, 207978, 47 },
+	{ 127701, 208025, 47 },
+	{ 127702, 208072, 46 },
+	{ 127703, 208118, 46 },
+	{ 127704, 208164, 43 },
+	{ 127705, 208207, 43 },
+	{ 127706, 208250, 42 },
+	{ 127707, 208292, 42 },
+	{ 127708, 208334, 41 },
+	{ 127709, 208375, 41 },
+	{ 127710, 208416, 40 },
+	{ 127711, 208456, 40 },
+	{ 127712, 208496, 51 },
+	{ 127713, 208547, 51 },
+	{ 127714, 208598, 51 },
+	{ 127715, 208649, 50 },
+	{ 127716, 208699, 50 },
+	{ 127717, 208749, 45 },
+	{ 127718, 208794, 45 },
+	{ 127719, 208839, 45 },
+	{ 127720, 208896, 44 },
+	{ 127721, 208940, 44 },
+	{ 127722, 208984, 42 },
+	{ 127723, 209026, 42 },
+	{ 127724, 209068, 42 },
+	{ 127725, 209110, 41 },
+	{ 127726, 209151, 41 },
+	{ 127727, 209192, 51 },
+	{ 127728, 209243, 50 },
+	{ 127729, 209293, 50 },
+	{ 127730, 209343, 45 },
+	{ 127731, 209388, 44 },
+	{ 127732, 209432, 44 },
+	{ 127733, 209476, 42 },
+	{ 127734, 209518, 41 },
+	{ 127735, 209559, 41 },
+	{ 127736, 209600, 41 },
+	{ 127737, 209641, 41 },
+	{ 127738, 209682, 48 },
+	{ 127739, 209730, 50 },
+	{ 127740, 209780, 49 },
+	{ 128109, 209829, 20 },
+	{ 128110, 209849, 20 },
+	{ 128111, 209869, 20 },
+	{ 128112, 209889, 22 },
+	{ 128113, 209911, 22 },
+	{ 128114, 209933, 22 },
+	{ 128115, 209955, 22 },
+	{ 128116, 209977, 22 },
+	{ 128117, 209999, 22 },
+	{ 128118, 210021, 22 },
+	{ 128119, 210043, 22 },
+	{ 128120, 210065, 22 },
+	{ 129133, 210087, 21 },
+	{ 129134, 210108, 21 },
+	{ 129135, 210129, 21 },
+	{ 129136, 210150, 23 },
+	{ 129137, 210173, 23 },
+	{ 129138, 210196, 23 },
+	{ 129139, 210219, 23 },
+	{ 129140, 210242, 23 },
+	{ 129141, 210265, 23 },
+	{ 129142, 210288, 23 },
+	{ 129143, 210311, 23 },
+	{ 129144, 210334, 23 },
+};
+
+const char hcc_intrinsic_strings_data[52][HCC_INTRINSIC_STRINGS_DATA_ROW_SIZE] = {
+	"void"
+	"_Bool"
+	"char"
+	"short"
+	"int"
+	"long"
+	"float"
+	"double"
+	"unsigned"
+	"signed"
+	"_Complex"
+	"_Atomic"
+	"return"
+	"if"
+	"else"
+	"do"
+	"while"
+	"for"
+	"switch"
+	"case"
+	"default"
+	"break"
+	"continue"
+	"true"
+	"false"
+	"__hcc_vertex"
+	"__hcc_pixel"
+	"__hcc_compute"
+	"__hcc_meshtask"
+	"__hcc_mesh"
+	"enum"
+	"struct"
+	"union"
+	"typedef"
+	"static"
+	"const"
+	"mutonly"
+	"auto"
+	"register"
+	"volatile"
+	"extern"
+	"_Thread_local"
+	"__hcc_dispatch_group"
+	"inline"
+	"_Noreturn"
+	"sizeof"
+	"_Alignof"
+	"_Alignas"
+	"_Static_assert"
+	"_Generic"
+	"restrict"
+	"__hcc_half_t"
+	"__hcc_vector_t"
+	"__hcc_rasterizer_state"
+	"__hcc_pixel_state"
+	"__hcc_interp"
+	"__hcc_nointerp"
+	"HccRoSampler"
+	"HccRoBuffer"
+	"HccRoTexture1D"
+	"HccRoTexture1DArray"
+	"HccRoTexture2D"
+	"HccRoTexture2DArray"
+	"HccRoTexture2DMS"
+	"HccRoTexture2DMSArray"
+	"HccRoTexture3D"
+	"HccWoBuffer"
+	"HccWoTexture1D"
+	"HccWoTexture1DArray"
+	"HccWoTexture2D"
+	"HccWoTexture2DArray"
+	"HccWoTexture2DMS"
+	"HccWoTexture2DMSArray"
+	"HccWoTexture3D"
+	"HccRwBuffer"
+	"HccRwTexture1D"
+	"HccRwTexture1DArray"
+	"HccRwTexture2D"
+	"HccRwTexture2DArray"
+	"HccRwTexture2DMS"
+	"HccRwTexture2DMSArray"
+	"HccRwTexture3D"
+	"HccSampleTexture1D"
+	"HccSampleTexture1DArray"
+	"HccSampleTexture2D"
+	"HccSampleTexture2DArray"
+	"HccSampleTextureCube"
+	"HccSampleTextureCubeArray"
+	"HccSampleTexture3D"
+	"__FILE__"
+	"__LINE__"
+	"__STDC__"
+	"__STDC_VERSION__"
+	"__COUNTER__"
+	"__HCC__"
+	"__HCC_GPU__"
+	"__HCC_X86_64__"
+	"__HCC_AARCH64__"
+	"__HCC_LINUX__"
+	"__HCC_WINDOWS__"
+	"xx"
+	"xy"
+	"xz"
+	"xw"
+	"yx"
+	"yy"
+	"yz"
+	"yw"
+	"zx"
+	"zy"
+	"zz"
+	"zw"
+	"wx"
+	"wy"
+	"wz"
+	"ww"
+	"xxx"
+	"xxy"
+	"xxz"
+	"xxw"
+	"xyx"
+	"xyy"
+	"xyz"
+	"xyw"
+	"xzx"
+	"xzy"
+	"xzz"
+	"xzw"
+	"xwx"
+	"xwy"
+	"xwz"
+	"xww"
+	"yxx"
+	"yxy"
+	"yxz"
+	"yxw"
+	"yyx"
+	"yyy"
+	"yyz"
+	"yyw"
+	"yzx"
+	"yzy"
+	"yzz"
+	"yzw"
+	"ywx"
+	"ywy"
+	"ywz"
+	"yww"
+	"zxx"
+	"zxy"
+	"zxz"
+	"zxw"
+	"zyx"
+	"zyy"
+	"zyz"
+	"zyw"
+	"zzx"
+	"zzy"
+	"zzz"
+	"zzw"
+	"zwx"
+	"zwy"
+	"zwz"
+	"zww"
+	"wxx"
+	"wxy"
+	"wxz"
+	"wxw"
+	"wyx"
+	"wyy"
+	"wyz"
+	"wyw"
+	"wzx"
+	"wzy"
+	"wzz"
+	"wzw"
+	"wwx"
+	"wwy"
+	"wwz"
+	"www"
+	"xxxx"
+	"xxxy"
+	"xxxz"
+	"xxxw"
+	"xxyx"
+	"xxyy"
+	"xxyz"
+	"xxyw"
+	"xxzx"
+	"xxzy"
+	"xxzz"
+	"xxzw"
+	"xxwx"
+	"xxwy"
+	"xxwz"
+	"xxww"
+	"xyxx"
+	"xyxy"
+	"xyxz"
+	"xyxw"
+	"xyyx"
+	"xyyy"
+	"xyyz"
+	"xyyw"
+	"xyzx"
+	"xyzy"
+	"xyzz"
+	"xyzw"
+	"xywx"
+	"xywy"
+	"xywz"
+	"xyww"
+	"xzxx"
+	"xzxy"
+	"xzxz"
+	"xzxw"
+	"xzyx"
+	"xzyy"
+	"xzyz"
+	"xzyw"
+	"xzzx"
+	"xzzy"
+	"xzzz"
+	"xzzw"
+	"xzwx"
+	"xzwy"
+	"xzwz"
+	"xzww"
+	"xwxx"
+	"xwxy"
+	"xwxz"
+	"xwxw"
+	"xwyx"
+	"xwyy"
+	"xwyz"
+	"xwyw"
+	"xwzx"
+	"xwzy"
+	"xwzz"
+	"xwzw"
+	"xwwx"
+	"xwwy"
+	"xwwz"
+	"xwww"
+	"yxxx"
+	"yxxy"
+	"yxxz"
+	"yxxw"
+	"yxyx"
+	"yxyy"
+	"yxyz"
+	"yxyw"
+	"yxzx"
+	"yxzy"
+	"yxzz"
+	"yxzw"
+	"yxwx"
+	"yxwy"
+	"yxwz"
+	"yxww"
+	"yyxx"
+	"yyxy"
+	"yyxz"
+	"yyxw"
+	"yyyx"
+	"yyyy"
+	"yyyz"
+	"yyyw"
+	"yyzx"
+	"yyzy"
+	"yyzz"
+	"yyzw"
+	"yywx"
+	"yywy"
+	"yywz"
+	"yyww"
+	"yzxx"
+	"yzxy"
+	"yzxz"
+	"yzxw"
+	"yzyx"
+	"yzyy"
+	"yzyz"
+	"yzyw"
+	"yzzx"
+	"yzzy"
+	"yzzz"
+	"yzzw"
+	"yzwx"
+	"yzwy"
+	"yzwz"
+	"yzww"
+	"ywxx"
+	"ywxy"
+	"ywxz"
+	"ywxw"
+	"ywyx"
+	"ywyy"
+	"ywyz"
+	"ywyw"
+	"ywzx"
+	"ywzy"
+	"ywzz"
+	"ywzw"
+	"ywwx"
+	"ywwy"
+	"ywwz"
+	"ywww"
+	"zxxx"
+	"zxxy"
+	"zxxz"
+	"zxxw"
+	"zxyx"
+	"zxyy"
+	"zxyz"
+	"zxyw"
+	"zxzx"
+	"zxzy"
+	"zxzz"
+	"zxzw"
+	"zxwx"
+	"zxwy"
+	"zxwz"
+	"zxww"
+	"zyxx"
+	"zyxy"
+	"zyxz"
+	"zyxw"
+	"zyyx"
+	"zyyy"
+	"zyyz"
+	"zyyw"
+	"zyzx"
+	"zyzy"
+	"zyzz"
+	"zyzw"
+	"zywx"
+	"zywy"
+	"zywz"
+	"zyww"
+	"zzxx"
+	"zzxy"
+	"zzxz"
+	"zzxw"
+	"zzyx"
+	"zzyy"
+	"zzyz"
+	"zzyw"
+	"zzzx"
+	"zzzy"
+	"zzzz"
+	"zzzw"
+	"zzwx"
+	"zzwy"
+	"zzwz"
+	"zzww"
+	"zwxx"
+	"zwxy"
+	"zwxz"
+	"zwxw"
+	"zwyx"
+	"zwyy"
+	"zwyz"
+	"zwyw"
+	"zwzx"
+	"zwzy"
+	"zwzz"
+	"zwzw"
+	"zwwx"
+	"zwwy"
+	"zwwz"
+	"zwww"
+	"wxxx"
+	"wxxy"
+	"wxxz"
+	"wxxw"
+	"wxyx"
+	"wxyy"
+	"wxyz"
+	"wxyw"
+	"wxzx"
+	"wxzy"
+	"wxzz"
+	"wxzw"
+	"wxwx"
+	"wxwy"
+	"wxwz"
+	"wxww"
+	"wyxx"
+	"wyxy"
+	"wyxz"
+	"wyxw"
+	"wyyx"
+	"wyyy"
+	"wyyz"
+	"wyyw"
+	"wyzx"
+	"wyzy"
+	"wyzz"
+	"wyzw"
+	"wywx"
+	"wywy"
+	"wywz"
+	"wyww"
+	"wzxx"
+	"wzxy"
+	"wzxz"
+	"wzxw"
+	"wzyx"
+	"wzyy"
+	"wzyz"
+	"wzyw"
+	"wzzx"
+	"wzzy"
+	"wzzz"
+	"wzzw"
+	"wzwx"
+	"wzwy"
+	"wzwz"
+	"wzww"
+	"wwxx"
+	"wwxy"
+	"wwxz"
+	"wwxw"
+	"wwyx"
+	"wwyy"
+	"wwyz"
+	"wwyw"
+	"wwzx"
+	"wwzy"
+	"wwzz"
+	"wwzw"
+	"wwwx"
+	"wwwy"
+	"wwwz"
+	"wwww"
+	"rr"
+	"rg"
+	"rb"
+	"ra"
+	"gr"
+	"gg"
+	"gb"
+	"ga"
+	"br"
+	"bg"
+	"bb"
+	"ba"
+	"ar"
+	"ag"
+	"ab"
+	"aa"
+	"rrr"
+	"rrg"
+	"rrb"
+	"rra"
+	"rgr"
+	"rgg"
+	"rgb"
+	"rga"
+	"rbr"
+	"rbg"
+	"rbb"
+	"rba"
+	"rar"
+	"rag"
+	"rab"
+	"raa"
+	"grr"
+	"grg"
+	"grb"
+	"gra"
+	"ggr"
+	"ggg"
+	"ggb"
+	"gga"
+	"gbr"
+	"gbg"
+	"gbb"
+	"gba"
+	"gar"
+	"gag"
+	"gab"
+	"gaa"
+	"brr"
+	"brg"
+	"brb"
+	"bra"
+	"bgr"
+	"bgg"
+	"bgb"
+	"bga"
+	"bbr"
+	"bbg"
+	"bbb"
+	"bba"
+	"bar"
+	"bag"
+	"bab"
+	"baa"
+	"arr"
+	"arg"
+	"arb"
+	"ara"
+	"agr"
+	"agg"
+	"agb"
+	"aga"
+	"abr"
+	"abg"
+	"abb"
+	"aba"
+	"aar"
+	"aag"
+	"aab"
+	"aaa"
+	"rrrr"
+	"rrrg"
+	"rrrb"
+	"rrra"
+	"rrgr"
+	"rrgg"
+	"rrgb"
+	"rrga"
+	"rrbr"
+	"rrbg"
+	"rrbb"
+	"rrba"
+	"rrar"
+	"rrag"
+	"rrab"
+	"rraa"
+	"rgrr"
+	"rgrg"
+	"rgrb"
+	"rgra"
+	"rggr"
+	"rggg"
+	"rggb"
+	"rgga"
+	"rgbr"
+	"rgbg"
+	"rgbb"
+	"rgba"
+	"rgar"
+	"rgag"
+	"rgab"
+	"rgaa"
+	"rbrr"
+	"rbrg"
+	"rbrb"
+	"rbra"
+	"rbgr"
+	"rbgg"
+	"rbgb"
+	"rbga"
+	"rbbr"
+	"rbbg"
+	"rbbb"
+	"rbba"
+	"rbar"
+	"rbag"
+	"rbab"
+	"rbaa"
+	"rarr"
+	"rarg"
+	"rarb"
+	"rara"
+	"ragr"
+	"ragg"
+	"ragb"
+	"raga"
+	"rabr"
+	"rabg"
+	"rabb"
+	"raba"
+	"raar"
+	"raag"
+	"raab"
+	"raaa"
+	"grrr"
+	"grrg"
+	"grrb"
+	"grra"
+	"grgr"
+	"grgg"
+	"grgb"
+	"grga"
+	"grbr"
+	"grbg"
+	"grbb"
+	"grba"
+	"grar"
+	"grag"
+	"grab"
+	"graa"
+	"ggrr"
+	"ggrg"
+	"ggrb"
+	"ggra"
+	"gggr"
+	"gggg"
+	"gggb"
+	"ggga"
+	"ggbr"
+	"ggbg"
+	"ggbb"
+	"ggba"
+	"ggar"
+	"ggag"
+	"ggab"
+	"ggaa"
+	"gbrr"
+	"gbrg"
+	"gbrb"
+	"gbra"
+	"gbgr"
+	"gbgg"
+	"gbgb"
+	"gbga"
+	"gbbr"
+	"gbbg"
+	"gbbb"
+	"gbba"
+	"gbar"
+	"gbag"
+	"gbab"
+	"gbaa"
+	"garr"
+	"garg"
+	"garb"
+	"gara"
+	"gagr"
+	"gagg"
+	"gagb"
+	"gaga"
+	"gabr"
+	"gabg"
+	"gabb"
+	"gaba"
+	"gaar"
+	"gaag"
+	"gaab"
+	"gaaa"
+	"brrr"
+	"brrg"
+	"brrb"
+	"brra"
+	"brgr"
+	"brgg"
+	"brgb"
+	"brga"
+	"brbr"
+	"brbg"
+	"brbb"
+	"brba"
+	"brar"
+	"brag"
+	"brab"
+	"braa"
+	"bgrr"
+	"bgrg"
+	"bgrb"
+	"bgra"
+	"bggr"
+	"bggg"
+	"bggb"
+	"bgga"
+	"bgbr"
+	"bgbg"
+	"bgbb"
+	"bgba"
+	"bgar"
+	"bgag"
+	"bgab"
+	"bgaa"
+	"bbrr"
+	"bbrg"
+	"bbrb"
+	"bbra"
+	"bbgr"
+	"bbgg"
+	"bbgb"
+	"bbga"
+	"bbbr"
+	"bbbg"
+	"bbbb"
+	"bbba"
+	"bbar"
+	"bbag"
+	"bbab"
+	"bbaa"
+	"barr"
+	"barg"
+	"barb"
+	"bara"
+	"bagr"
+	"bagg"
+	"bagb"
+	"baga"
+	"babr"
+	"babg"
+	"babb"
+	"baba"
+	"baar"
+	"baag"
+	"baab"
+	"baaa"
+	"arrr"
+	"arrg"
+	"arrb"
+	"arra"
+	"argr"
+	"argg"
+	"argb"
+	"arga"
+	"arbr"
+	"arbg"
+	"arbb"
+	"arba"
+	"arar"
+	"arag"
+	"arab"
+	"araa"
+	"agrr"
+	"agrg"
+	"agrb"
+	"agra"
+	"aggr"
+	"aggg"
+	"aggb"
+	"agga"
+	"agbr"
+	"agbg"
+	"agbb"
+	"agba"
+	"agar"
+	"agag"
+	"agab"
+	"agaa"
+	"abrr"
+	"abrg"
+	"abrb"
+	"abra"
+	"abgr"
+	"abgg"
+	"abgb"
+	"abga"
+	"abbr"
+	"abbg"
+	"abbb"
+	"abba"
+	"abar"
+	"abag"
+	"abab"
+	"abaa"
+	"aarr"
+	"aarg"
+	"aarb"
+	"aara"
+	"aagr"
+	"aagg"
+	"aagb"
+	"aaga"
+	"aabr"
+	"aabg"
+	"aabb"
+	"aaba"
+	"aaar"
+	"aaag"
+	"aaab"
+	"aaaa"
+	"once"
+	"defined"
+	"__VA_ARGS__"
+	"x"
+	"y"
+	"z"
+	"w"
+	"r"
+	"g"
+	"b"
+	"a"
+	"HccVertexSV"
+	"HccVertexSVOut"
+	"HccPixelSV"
+	"HccPixelSVOut"
+	"HccComputeSV"
+	"ps8x2"
+	"ps16x2"
+	"ps32x2"
+	"ps64x2"
+	"pu8x2"
+	"pu16x2"
+	"pu32x2"
+	"pu64x2"
+	"pf16x2"
+	"pf32x2"
+	"pf64x2"
+	"ps8x3"
+	"ps16x3"
+	"ps32x3"
+	"ps64x3"
+	"pu8x3"
+	"pu16x3"
+	"pu32x3"
+	"pu64x3"
+	"pf16x3"
+	"pf32x3"
+	"pf64x3"
+	"ps8x4"
+	"ps16x4"
+	"ps32x4"
+	"ps64x4"
+	"pu8x4"
+	"pu16x4"
+	"pu32x4"
+	"pu64x4"
+	"pf16x4"
+	"pf32x4"
+	"pf64x4"
+	"ps8x2x2"
+	"ps16x2x2"
+	"ps32x2x2"
+	"ps64x2x2"
+	"pu8x2x2"
+	"pu16x2x2"
+	"pu32x2x2"
+	"pu64x2x2"
+	"pf16x2x2"
+	"pf32x2x2"
+	"pf64x2x2"
+	"ps8x3x2"
+	"ps16x3x2"
+	"ps32x3x2"
+	"ps64x3x2"
+	"pu8x3x2"
+	"pu16x3x2"
+	"pu32x3x2"
+	"pu64x3x2"
+	"pf16x3x2"
+	"pf32x3x2"
+	"pf64x3x2"
+	"ps8x4x2"
+	"ps16x4x2"
+	"ps32x4x2"
+	"ps64x4x2",
+	"pu8x4x2"
+	"pu16x4x2"
+	"pu32x4x2"
+	"pu64x4x2"
+	"pf16x4x2"
+	"pf32x4x2"
+	"pf64x4x2"
+	"ps8x2x3"
+	"ps16x2x3"
+	"ps32x2x3"
+	"ps64x2x3"
+	"pu8x2x3"
+	"pu16x2x3"
+	"pu32x2x3"
+	"pu64x2x3"
+	"pf16x2x3"
+	"pf32x2x3"
+	"pf64x2x3"
+	"ps8x3x3"
+	"ps16x3x3"
+	"ps32x3x3"
+	"ps64x3x3"
+	"pu8x3x3"
+	"pu16x3x3"
+	"pu32x3x3"
+	"pu64x3x3"
+	"pf16x3x3"
+	"pf32x3x3"
+	"pf64x3x3"
+	"ps8x4x3"
+	"ps16x4x3"
+	"ps32x4x3"
+	"ps64x4x3"
+	"pu8x4x3"
+	"pu16x4x3"
+	"pu32x4x3"
+	"pu64x4x3"
+	"pf16x4x3"
+	"pf32x4x3"
+	"pf64x4x3"
+	"ps8x2x4"
+	"ps16x2x4"
+	"ps32x2x4"
+	"ps64x2x4"
+	"pu8x2x4"
+	"pu16x2x4"
+	"pu32x2x4"
+	"pu64x2x4"
+	"pf16x2x4"
+	"pf32x2x4"
+	"pf64x2x4"
+	"ps8x3x4"
+	"ps16x3x4"
+	"ps32x3x4"
+	"ps64x3x4"
+	"pu8x3x4"
+	"pu16x3x4"
+	"pu32x3x4"
+	"pu64x3x4"
+	"pf16x3x4"
+	"pf32x3x4"
+	"pf64x3x4"
+	"ps8x4x4"
+	"ps16x4x4"
+	"ps32x4x4"
+	"ps64x4x4"
+	"pu8x4x4"
+	"pu16x4x4"
+	"pu32x4x4"
+	"pu64x4x4"
+	"pf16x4x4"
+	"pf32x4x4"
+	"pf64x4x4"
+	"f16tof32"
+	"f16tof64"
+	"f32tof16"
+	"f64tof16"
+	"pack_f16x2_f32x2"
+	"unpack_f16x2_f32x2"
+	"pack_u16x2_f32x2"
+	"unpack_u16x2_f32x2"
+	"pack_s16x2_f32x2"
+	"unpack_s16x2_f32x2"
+	"pack_u8x4_f32x4"
+	"unpack_u8x4_f32x4"
+	"pack_s8x4_f32x4"
+	"unpack_s8x4_f32x4"
+	"discard_pixel"
+	"memory_barrier_resource"
+	"memory_barrier_dispatch_group"
+	"memory_barrier_all"
+	"control_barrier_resource"
+	"control_barrier_dispatch_group"
+	"control_barrier_all"
+	"wave_thread_is_first"
+	"wave_thread_idx"
+	"hprint_string"
+	"any_boolx2"
+	"any_s8x2"
+	"any_s16x2"
+	"any_s32x2"
+	"any_s64x2"
+	"any_u8x2"
+	"any_u16x2"
+	"any_u32x2"
+	"any_u64x2"
+	"any_f16x2"
+	"any_f32x2"
+	"any_f64x2"
+	"any_boolx3"
+	"any_s8x3"
+	"any_s16x3"
+	"any_s32x3"
+	"any_s64x3"
+	"any_u8x3"
+	"any_u16x3"
+	"any_u32x3"
+	"any_u64x3"
+	"any_f16x3"
+	"any_f32x3"
+	"any_f64x3"
+	"any_boolx4"
+	"any_s8x4"
+	"any_s16x4"
+	"any_s32x4"
+	"any_s64x4"
+	"any_u8x4"
+	"any_u16x4"
+	"any_u32x4"
+	"any_u64x4"
+	"any_f16x4"
+	"any_f32x4"
+	"any_f64x4"
+	"all_boolx2"
+	"all_s8x2"
+	"all_s16x2"
+	"all_s32x2"
+	"all_s64x2"
+	"all_u8x2"
+	"all_u16x2"
+	"all_u32x2"
+	"all_u64x2"
+	"all_f16x2"
+	"all_f32x2"
+	"all_f64x2"
+	"all_boolx3"
+	"all_s8x3"
+	"all_s16x3"
+	"all_s32x3"
+	"all_s64x3"
+	"all_u8x3"
+	"all_u16x3"
+	"all_u32x3"
+	"all_u64x3"
+	"all_f16x3"
+	"all_f32x3"
+	"all_f64x3"
+	"all_boolx4"
+	"all_s8x4"
+	"all_s16x4"
+	"all_s32x4"
+	"all_s64x4"
+	"all_u8x4"
+	"all_u16x4"
+	"all_u32x4"
+	"all_u64x4"
+	"all_f16x4"
+	"all_f32x4"
+	"all_f64x4"
+	"add_s8"
+	"add_s16"
+	"add_s32"
+	"add_s64"
+	"add_u8"
+	"add_u16"
+	"add_u32"
+	"add_u64"
+	"add_f16"
+	"add_f32"
+	"add_f64"
+	"add_s8x2"
+	"add_s16x2"
+	"add_s32x2"
+	"add_s64x2"
+	"add_u8x2"
+	"add_u16x2"
+	"add_u32x2"
+	"add_u64x2"
+	"add_f16x2"
+	"add_f32x2"
+	"add_f64x2"
+	"add_s8x3"
+	"add_s16x3"
+	"add_s32x3"
+	"add_s64x3"
+	"add_u8x3"
+	"add_u16x3"
+	"add_u32x3"
+	"add_u64x3"
+	"add_f16x3"
+	"add_f32x3"
+	"add_f64x3"
+	"add_s8x4"
+	"add_s16x4"
+	"add_s32x4"
+	"add_s64x4"
+	"add_u8x4"
+	"add_u16x4"
+	"add_u32x4"
+	"add_u64x4"
+	"add_f16x4"
+	"add_f32x4"
+	"add_f64x4"
+	"sub_s8"
+	"sub_s16"
+	"sub_s32"
+	"sub_s64"
+	"sub_u8"
+	"sub_u16"
+	"sub_u32"
+	"sub_u64"
+	"sub_f16"
+	"sub_f32"
+	"sub_f64"
+	"sub_s8x2"
+	"sub_s16x2"
+	"sub_s32x2"
+	"sub_s64x2"
+	"sub_u8x2"
+	"sub_u16x2"
+	"sub_u32x2"
+	"sub_u64x2"
+	"sub_f16x2"
+	"sub_f32x2"
+	"sub_f64x2"
+	"sub_s8x3"
+	"sub_s16x3"
+	"sub_s32x3"
+	"sub_s64x3"
+	"sub_u8x3"
+	"sub_u16x3"
+	"sub_u32x3"
+	"sub_u64x3"
+	"sub_f16x3"
+	"sub_f32x3"
+	"sub_f64x3"
+	"sub_s8x4"
+	"sub_s16x4"
+	"sub_s32x4"
+	"sub_s64x4"
+	"sub_u8x4"
+	"sub_u16x4"
+	"sub_u32x4"
+	"sub_u64x4"
+	"sub_f16x4"
+	"sub_f32x4"
+	"sub_f64x4"
+	"mul_s8"
+	"mul_s16"
+	"mul_s32"
+	"mul_s64"
+	"mul_u8"
+	"mul_u16"
+	"mul_u32"
+	"mul_u64"
+	"mul_f16"
+	"mul_f32"
+	"mul_f64"
+	"mul_s8x2"
+	"mul_s16x2"
+	"mul_s32x2"
+	"mul_s64x2"
+	"mul_u8x2"
+	"mul_u16x2"
+	"mul_u32x2"
+	"mul_u64x2"
+	"mul_f16x2"
+	"mul_f32x2"
+	"mul_f64x2"
+	"mul_s8x3"
+	"mul_s16x3"
+	"mul_s32x3"
+	"mul_s64x3"
+	"mul_u8x3"
+	"mul_u16x3"
+	"mul_u32x3"
+	"mul_u64x3"
+	"mul_f16x3"
+	"mul_f32x3"
+	"mul_f64x3"
+	"mul_s8x4"
+	"mul_s16x4"
+	"mul_s32x4"
+	"mul_s64x4"
+	"mul_u8x4"
+	"mul_u16x4"
+	"mul_u32x4"
+	"mul_u64x4"
+	"mul_f16x4"
+	"mul_f32x4"
+	"mul_f64x4"
+	"div_s8"
+	"div_s16"
+	"div_s32"
+	"div_s64"
+	"div_u8"
+	"div_u16"
+	"div_u32"
+	"div_u64"
+	"div_f16"
+	"div_f32"
+	"div_f64"
+	"div_s8x2"
+	"div_s16x2"
+	"div_s32x2"
+	"div_s64x2"
+	"div_u8x2"
+	"div_u16x2"
+	"div_u32x2"
+	"div_u64x2"
+	"div_f16x2"
+	"div_f32x2"
+	"div_f64x2"
+	"div_s8x3"
+	"div_s16x3"
+	"div_s32x3"
+	"div_s64x3"
+	"div_u8x3"
+	"div_u16x3"
+	"div_u32x3"
+	"div_u64x3"
+	"div_f16x3"
+	"div_f32x3"
+	"div_f64x3"
+	"div_s8x4"
+	"div_s16x4"
+	"div_s32x4"
+	"div_s64x4"
+	"div_u8x4"
+	"div_u16x4"
+	"div_u32x4"
+	"div_u64x4"
+	"div_f16x4"
+	"div_f32x4"
+	"div_f64x4"
+	"mod_s8"
+	"mod_s16"
+	"mod_s32"
+	"mod_s64"
+	"mod_u8"
+	"mod_u16"
+	"mod_u32"
+	"mod_u64"
+	"mod_f16"
+	"mod_f32"
+	"mod_f64"
+	"mod_s8x2"
+	"mod_s16x2"
+	"mod_s32x2"
+	"mod_s64x2"
+	"mod_u8x2"
+	"mod_u16x2"
+	"mod_u32x2"
+	"mod_u64x2"
+	"mod_f16x2"
+	"mod_f32x2"
+	"mod_f64x2"
+	"mod_s8x3"
+	"mod_s16x3"
+	"mod_s32x3"
+	"mod_s64x3"
+	"mod_u8x3"
+	"mod_u16x3"
+	"mod_u32x3"
+	"mod_u64x3"
+	"mod_f16x3"
+	"mod_f32x3"
+	"mod_f64x3"
+	"mod_s8x4"
+	"mod_s16x4"
+	"mod_s32x4"
+	"mod_s64x4"
+	"mod_u8x4"
+	"mod_u16x4"
+	"mod_u32x4"
+	"mod_u64x4"
+	"mod_f16x4"
+	"mod_f32x4"
+	"mod_f64x4"
+	"eq_s8"
+	"eq_s16"
+	"eq_s32"
+	"eq_s64"
+	"eq_u8"
+	"eq_u16"
+	"eq_u32"
+	"eq_u64"
+	"eq_f16"
+	"eq_f32"
+	"eq_f64"
+	"eq_s8x2"
+	"eq_s16x2"
+	"eq_s32x2"
+	"eq_s64x2"
+	"eq_u8x2"
+	"eq_u16x2"
+	"eq_u32x2"
+	"eq_u64x2"
+	"eq_f16x2"
+	"eq_f32x2"
+	"eq_f64x2"
+	"eq_s8x3"
+	"eq_s16x3"
+	"eq_s32x3"
+	"eq_s64x3"
+	"eq_u8x3"
+	"eq_u16x3"
+	"eq_u32x3"
+	"eq_u64x3"
+	"eq_f16x3"
+	"eq_f32x3"
+	"eq_f64x3"
+	"eq_s8x4"
+	"eq_s16x4"
+	"eq_s32x4"
+	"eq_s64x4"
+	"eq_u8x4"
+	"eq_u16x4"
+	"eq_u32x4"
+	"eq_u64x4"
+	"eq_f16x4"
+	"eq_f32x4"
+	"eq_f64x4"
+	"neq_s8"
+	"neq_s16"
+	"neq_s32"
+	"neq_s64"
+	"neq_u8"
+	"neq_u16"
+	"neq_u32"
+	"neq_u64"
+	"neq_f16"
+	"neq_f32"
+	"neq_f64"
+	"neq_s8x2"
+	"neq_s16x2"
+	"neq_s32x2"
+	"neq_s64x2"
+	"neq_u8x2"
+	"neq_u16x2"
+	"neq_u32x2"
+	"neq_u64x2"
+	"neq_f16x2"
+	"neq_f32x2"
+	"neq_f64x2"
+	"neq_s8x3"
+	"neq_s16x3"
+	"neq_s32x3"
+	"neq_s64x3"
+	"neq_u8x3"
+	"neq_u16x3"
+	"neq_u32x3"
+	"neq_u64x3"
+	"neq_f16x3"
+	"neq_f32x3"
+	"neq_f64x3"
+	"neq_s8x4"
+	"neq_s16x4"
+	"neq_s32x4"
+	"neq_s64x4"
+	"neq_u8x4"
+	"neq_u16x4",
+	"neq_u32x4"
+	"neq_u64x4"
+	"neq_f16x4"
+	"neq_f32x4"
+	"neq_f64x4"
+	"lt_s8"
+	"lt_s16"
+	"lt_s32"
+	"lt_s64"
+	"lt_u8"
+	"lt_u16"
+	"lt_u32"
+	"lt_u64"
+	"lt_f16"
+	"lt_f32"
+	"lt_f64"
+	"lt_s8x2"
+	"lt_s16x2"
+	"lt_s32x2"
+	"lt_s64x2"
+	"lt_u8x2"
+	"lt_u16x2"
+	"lt_u32x2"
+	"lt_u64x2"
+	"lt_f16x2"
+	"lt_f32x2"
+	"lt_f64x2"
+	"lt_s8x3"
+	"lt_s16x3"
+	"lt_s32x3"
+	"lt_s64x3"
+	"lt_u8x3"
+	"lt_u16x3"
+	"lt_u32x3"
+	"lt_u64x3"
+	"lt_f16x3"
+	"lt_f32x3"
+	"lt_f64x3"
+	"lt_s8x4"
+	"lt_s16x4"
+	"lt_s32x4"
+	"lt_s64x4"
+	"lt_u8x4"
+	"lt_u16x4"
+	"lt_u32x4"
+	"lt_u64x4"
+	"lt_f16x4"
+	"lt_f32x4"
+	"lt_f64x4"
+	"lteq_s8"
+	"lteq_s16"
+	"lteq_s32"
+	"lteq_s64"
+	"lteq_u8"
+	"lteq_u16"
+	"lteq_u32"
+	"lteq_u64"
+	"lteq_f16"
+	"lteq_f32"
+	"lteq_f64"
+	"lteq_s8x2"
+	"lteq_s16x2"
+	"lteq_s32x2"
+	"lteq_s64x2"
+	"lteq_u8x2"
+	"lteq_u16x2"
+	"lteq_u32x2"
+	"lteq_u64x2"
+	"lteq_f16x2"
+	"lteq_f32x2"
+	"lteq_f64x2"
+	"lteq_s8x3"
+	"lteq_s16x3"
+	"lteq_s32x3"
+	"lteq_s64x3"
+	"lteq_u8x3"
+	"lteq_u16x3"
+	"lteq_u32x3"
+	"lteq_u64x3"
+	"lteq_f16x3"
+	"lteq_f32x3"
+	"lteq_f64x3"
+	"lteq_s8x4"
+	"lteq_s16x4"
+	"lteq_s32x4"
+	"lteq_s64x4"
+	"lteq_u8x4"
+	"lteq_u16x4"
+	"lteq_u32x4"
+	"lteq_u64x4"
+	"lteq_f16x4"
+	"lteq_f32x4"
+	"lteq_f64x4"
+	"gt_s8"
+	"gt_s16"
+	"gt_s32"
+	"gt_s64"
+	"gt_u8"
+	"gt_u16"
+	"gt_u32"
+	"gt_u64"
+	"gt_f16"
+	"gt_f32"
+	"gt_f64"
+	"gt_s8x2"
+	"gt_s16x2"
+	"gt_s32x2"
+	"gt_s64x2"
+	"gt_u8x2"
+	"gt_u16x2"
+	"gt_u32x2"
+	"gt_u64x2"
+	"gt_f16x2"
+	"gt_f32x2"
+	"gt_f64x2"
+	"gt_s8x3"
+	"gt_s16x3"
+	"gt_s32x3"
+	"gt_s64x3"
+	"gt_u8x3"
+	"gt_u16x3"
+	"gt_u32x3"
+	"gt_u64x3"
+	"gt_f16x3"
+	"gt_f32x3"
+	"gt_f64x3"
+	"gt_s8x4"
+	"gt_s16x4"
+	"gt_s32x4"
+	"gt_s64x4"
+	"gt_u8x4"
+	"gt_u16x4"
+	"gt_u32x4"
+	"gt_u64x4"
+	"gt_f16x4"
+	"gt_f32x4"
+	"gt_f64x4"
+	"gteq_s8"
+	"gteq_s16"
+	"gteq_s32"
+	"gteq_s64"
+	"gteq_u8"
+	"gteq_u16"
+	"gteq_u32"
+	"gteq_u64"
+	"gteq_f16"
+	"gteq_f32"
+	"gteq_f64"
+	"gteq_s8x2"
+	"gteq_s16x2"
+	"gteq_s32x2"
+	"gteq_s64x2"
+	"gteq_u8x2"
+	"gteq_u16x2"
+	"gteq_u32x2"
+	"gteq_u64x2"
+	"gteq_f16x2"
+	"gteq_f32x2"
+	"gteq_f64x2"
+	"gteq_s8x3"
+	"gteq_s16x3"
+	"gteq_s32x3"
+	"gteq_s64x3"
+	"gteq_u8x3"
+	"gteq_u16x3"
+	"gteq_u32x3"
+	"gteq_u64x3"
+	"gteq_f16x3"
+	"gteq_f32x3"
+	"gteq_f64x3"
+	"gteq_s8x4"
+	"gteq_s16x4"
+	"gteq_s32x4"
+	"gteq_s64x4"
+	"gteq_u8x4"
+	"gteq_u16x4"
+	"gteq_u32x4"
+	"gteq_u64x4"
+	"gteq_f16x4"
+	"gteq_f32x4"
+	"gteq_f64x4"
+	"not_bool"
+	"not_s8"
+	"not_s16"
+	"not_s32"
+	"not_s64"
+	"not_u8"
+	"not_u16"
+	"not_u32"
+	"not_u64"
+	"not_f16"
+	"not_f32"
+	"not_f64"
+	"not_boolx2"
+	"not_s8x2"
+	"not_s16x2"
+	"not_s32x2"
+	"not_s64x2"
+	"not_u8x2"
+	"not_u16x2"
+	"not_u32x2"
+	"not_u64x2"
+	"not_f16x2"
+	"not_f32x2"
+	"not_f64x2"
+	"not_boolx3"
+	"not_s8x3"
+	"not_s16x3"
+	"not_s32x3"
+	"not_s64x3"
+	"not_u8x3"
+	"not_u16x3"
+	"not_u32x3"
+	"not_u64x3"
+	"not_f16x3"
+	"not_f32x3"
+	"not_f64x3"
+	"not_boolx4"
+	"not_s8x4"
+	"not_s16x4"
+	"not_s32x4"
+	"not_s64x4"
+	"not_u8x4"
+	"not_u16x4"
+	"not_u32x4"
+	"not_u64x4"
+	"not_f16x4"
+	"not_f32x4"
+	"not_f64x4"
+	"neg_s8"
+	"neg_s16"
+	"neg_s32"
+	"neg_s64"
+	"neg_u8"
+	"neg_u16"
+	"neg_u32"
+	"neg_u64"
+	"neg_f16"
+	"neg_f32"
+	"neg_f64"
+	"neg_s8x2"
+	"neg_s16x2"
+	"neg_s32x2"
+	"neg_s64x2"
+	"neg_u8x2"
+	"neg_u16x2"
+	"neg_u32x2"
+	"neg_u64x2"
+	"neg_f16x2"
+	"neg_f32x2"
+	"neg_f64x2"
+	"neg_s8x3"
+	"neg_s16x3"
+	"neg_s32x3"
+	"neg_s64x3"
+	"neg_u8x3"
+	"neg_u16x3"
+	"neg_u32x3"
+	"neg_u64x3"
+	"neg_f16x3"
+	"neg_f32x3"
+	"neg_f64x3"
+	"neg_s8x4"
+	"neg_s16x4"
+	"neg_s32x4"
+	"neg_s64x4"
+	"neg_u8x4"
+	"neg_u16x4"
+	"neg_u32x4"
+	"neg_u64x4"
+	"neg_f16x4"
+	"neg_f32x4"
+	"neg_f64x4"
+	"bitnot_s8"
+	"bitnot_s16"
+	"bitnot_s32"
+	"bitnot_s64"
+	"bitnot_u8"
+	"bitnot_u16"
+	"bitnot_u32"
+	"bitnot_u64"
+	"bitnot_s8x2"
+	"bitnot_s16x2"
+	"bitnot_s32x2"
+	"bitnot_s64x2"
+	"bitnot_u8x2"
+	"bitnot_u16x2"
+	"bitnot_u32x2"
+	"bitnot_u64x2"
+	"bitnot_s8x3"
+	"bitnot_s16x3"
+	"bitnot_s32x3"
+	"bitnot_s64x3"
+	"bitnot_u8x3"
+	"bitnot_u16x3"
+	"bitnot_u32x3"
+	"bitnot_u64x3"
+	"bitnot_s8x4"
+	"bitnot_s16x4"
+	"bitnot_s32x4"
+	"bitnot_s64x4"
+	"bitnot_u8x4"
+	"bitnot_u16x4"
+	"bitnot_u32x4"
+	"bitnot_u64x4"
+	"min_s8"
+	"min_s16"
+	"min_s32"
+	"min_s64"
+	"min_u8"
+	"min_u16"
+	"min_u32"
+	"min_u64"
+	"min_f16"
+	"min_f32"
+	"min_f64"
+	"min_s8x2"
+	"min_s16x2"
+	"min_s32x2"
+	"min_s64x2"
+	"min_u8x2"
+	"min_u16x2"
+	"min_u32x2"
+	"min_u64x2"
+	"min_f16x2"
+	"min_f32x2"
+	"min_f64x2"
+	"min_s8x3"
+	"min_s16x3"
+	"min_s32x3"
+	"min_s64x3"
+	"min_u8x3"
+	"min_u16x3"
+	"min_u32x3"
+	"min_u64x3"
+	"min_f16x3"
+	"min_f32x3"
+	"min_f64x3"
+	"min_s8x4"
+	"min_s16x4"
+	"min_s32x4"
+	"min_s64x4"
+	"min_u8x4"
+	"min_u16x4"
+	"min_u32x4"
+	"min_u64x4"
+	"min_f16x4"
+	"min_f32x4"
+	"min_f64x4"
+	"max_s8"
+	"max_s16"
+	"max_s32"
+	"max_s64"
+	"max_u8"
+	"max_u16"
+	"max_u32"
+	"max_u64"
+	"max_f16"
+	"max_f32"
+	"max_f64"
+	"max_s8x2"
+	"max_s16x2"
+	"max_s32x2"
+	"max_s64x2"
+	"max_u8x2"
+	"max_u16x2"
+	"max_u32x2"
+	"max_u64x2"
+	"max_f16x2"
+	"max_f32x2"
+	"max_f64x2"
+	"max_s8x3"
+	"max_s16x3"
+	"max_s32x3"
+	"max_s64x3"
+	"max_u8x3"
+	"max_u16x3"
+	"max_u32x3"
+	"max_u64x3"
+	"max_f16x3"
+	"max_f32x3"
+	"max_f64x3"
+	"max_s8x4"
+	"max_s16x4"
+	"max_s32x4"
+	"max_s64x4"
+	"max_u8x4"
+	"max_u16x4"
+	"max_u32x4"
+	"max_u64x4"
+	"max_f16x4"
+	"max_f32x4"
+	"max_f64x4"
+	"clamp_s8"
+	"clamp_s16"
+	"clamp_s32"
+	"clamp_s64"
+	"clamp_u8"
+	"clamp_u16"
+	"clamp_u32"
+	"clamp_u64"
+	"clamp_f16"
+	"clamp_f32"
+	"clamp_f64"
+	"clamp_s8x2"
+	"clamp_s16x2"
+	"clamp_s32x2"
+	"clamp_s64x2"
+	"clamp_u8x2"
+	"clamp_u16x2"
+	"clamp_u32x2"
+	"clamp_u64x2"
+	"clamp_f16x2"
+	"clamp_f32x2"
+	"clamp_f64x2"
+	"clamp_s8x3"
+	"clamp_s16x3"
+	"clamp_s32x3"
+	"clamp_s64x3"
+	"clamp_u8x3"
+	"clamp_u16x3"
+	"clamp_u32x3"
+	"clamp_u64x3"
+	"clamp_f16x3"
+	"clamp_f32x3"
+	"clamp_f64x3"
+	"clamp_s8x4"
+	"clamp_s16x4"
+	"clamp_s32x4"
+	"clamp_s64x4"
+	"clamp_u8x4"
+	"clamp_u16x4"
+	"clamp_u32x4"
+	"clamp_u64x4"
+	"clamp_f16x4"
+	"clamp_f32x4"
+	"clamp_f64x4"
+	"sign_s8"
+	"sign_s16"
+	"sign_s32"
+	"sign_s64"
+	"sign_f16"
+	"sign_f32"
+	"sign_f64"
+	"sign_s8x2"
+	"sign_s16x2"
+	"sign_s32x2"
+	"sign_s64x2"
+	"sign_f16x2"
+	"sign_f32x2"
+	"sign_f64x2"
+	"sign_s8x3"
+	"sign_s16x3"
+	"sign_s32x3"
+	"sign_s64x3"
+	"sign_f16x3"
+	"sign_f32x3"
+	"sign_f64x3"
+	"sign_s8x4"
+	"sign_s16x4"
+	"sign_s32x4"
+	"sign_s64x4"
+	"sign_f16x4"
+	"sign_f32x4"
+	"sign_f64x4"
+	"abs_s8",
+	"abs_s16"
+	"abs_s32"
+	"abs_s64"
+	"abs_f16"
+	"abs_f32"
+	"abs_f64"
+	"abs_s8x2"
+	"abs_s16x2"
+	"abs_s32x2"
+	"abs_s64x2"
+	"abs_f16x2"
+	"abs_f32x2"
+	"abs_f64x2"
+	"abs_s8x3"
+	"abs_s16x3"
+	"abs_s32x3"
+	"abs_s64x3"
+	"abs_f16x3"
+	"abs_f32x3"
+	"abs_f64x3"
+	"abs_s8x4"
+	"abs_s16x4"
+	"abs_s32x4"
+	"abs_s64x4"
+	"abs_f16x4"
+	"abs_f32x4"
+	"abs_f64x4"
+	"bitand_s8"
+	"bitand_s16"
+	"bitand_s32"
+	"bitand_s64"
+	"bitand_u8"
+	"bitand_u16"
+	"bitand_u32"
+	"bitand_u64"
+	"bitand_s8x2"
+	"bitand_s16x2"
+	"bitand_s32x2"
+	"bitand_s64x2"
+	"bitand_u8x2"
+	"bitand_u16x2"
+	"bitand_u32x2"
+	"bitand_u64x2"
+	"bitand_s8x3"
+	"bitand_s16x3"
+	"bitand_s32x3"
+	"bitand_s64x3"
+	"bitand_u8x3"
+	"bitand_u16x3"
+	"bitand_u32x3"
+	"bitand_u64x3"
+	"bitand_s8x4"
+	"bitand_s16x4"
+	"bitand_s32x4"
+	"bitand_s64x4"
+	"bitand_u8x4"
+	"bitand_u16x4"
+	"bitand_u32x4"
+	"bitand_u64x4"
+	"bitor_s8"
+	"bitor_s16"
+	"bitor_s32"
+	"bitor_s64"
+	"bitor_u8"
+	"bitor_u16"
+	"bitor_u32"
+	"bitor_u64"
+	"bitor_s8x2"
+	"bitor_s16x2"
+	"bitor_s32x2"
+	"bitor_s64x2"
+	"bitor_u8x2"
+	"bitor_u16x2"
+	"bitor_u32x2"
+	"bitor_u64x2"
+	"bitor_s8x3"
+	"bitor_s16x3"
+	"bitor_s32x3"
+	"bitor_s64x3"
+	"bitor_u8x3"
+	"bitor_u16x3"
+	"bitor_u32x3"
+	"bitor_u64x3"
+	"bitor_s8x4"
+	"bitor_s16x4"
+	"bitor_s32x4"
+	"bitor_s64x4"
+	"bitor_u8x4"
+	"bitor_u16x4"
+	"bitor_u32x4"
+	"bitor_u64x4"
+	"bitxor_s8"
+	"bitxor_s16"
+	"bitxor_s32"
+	"bitxor_s64"
+	"bitxor_u8"
+	"bitxor_u16"
+	"bitxor_u32"
+	"bitxor_u64"
+	"bitxor_s8x2"
+	"bitxor_s16x2"
+	"bitxor_s32x2"
+	"bitxor_s64x2"
+	"bitxor_u8x2"
+	"bitxor_u16x2"
+	"bitxor_u32x2"
+	"bitxor_u64x2"
+	"bitxor_s8x3"
+	"bitxor_s16x3"
+	"bitxor_s32x3"
+	"bitxor_s64x3"
+	"bitxor_u8x3"
+	"bitxor_u16x3"
+	"bitxor_u32x3"
+	"bitxor_u64x3"
+	"bitxor_s8x4"
+	"bitxor_s16x4"
+	"bitxor_s32x4"
+	"bitxor_s64x4"
+	"bitxor_u8x4"
+	"bitxor_u16x4"
+	"bitxor_u32x4"
+	"bitxor_u64x4"
+	"bitshl_s8"
+	"bitshl_s16"
+	"bitshl_s32"
+	"bitshl_s64"
+	"bitshl_u8"
+	"bitshl_u16"
+	"bitshl_u32"
+	"bitshl_u64"
+	"bitshl_s8x2"
+	"bitshl_s16x2"
+	"bitshl_s32x2"
+	"bitshl_s64x2"
+	"bitshl_u8x2"
+	"bitshl_u16x2"
+	"bitshl_u32x2"
+	"bitshl_u64x2"
+	"bitshl_s8x3"
+	"bitshl_s16x3"
+	"bitshl_s32x3"
+	"bitshl_s64x3"
+	"bitshl_u8x3"
+	"bitshl_u16x3"
+	"bitshl_u32x3"
+	"bitshl_u64x3"
+	"bitshl_s8x4"
+	"bitshl_s16x4"
+	"bitshl_s32x4"
+	"bitshl_s64x4"
+	"bitshl_u8x4"
+	"bitshl_u16x4"
+	"bitshl_u32x4"
+	"bitshl_u64x4"
+	"bitshr_s8"
+	"bitshr_s16"
+	"bitshr_s32"
+	"bitshr_s64"
+	"bitshr_u8"
+	"bitshr_u16"
+	"bitshr_u32"
+	"bitshr_u64"
+	"bitshr_s8x2"
+	"bitshr_s16x2"
+	"bitshr_s32x2"
+	"bitshr_s64x2"
+	"bitshr_u8x2"
+	"bitshr_u16x2"
+	"bitshr_u32x2"
+	"bitshr_u64x2"
+	"bitshr_s8x3"
+	"bitshr_s16x3"
+	"bitshr_s32x3"
+	"bitshr_s64x3"
+	"bitshr_u8x3"
+	"bitshr_u16x3"
+	"bitshr_u32x3"
+	"bitshr_u64x3"
+	"bitshr_s8x4"
+	"bitshr_s16x4"
+	"bitshr_s32x4"
+	"bitshr_s64x4"
+	"bitshr_u8x4"
+	"bitshr_u16x4"
+	"bitshr_u32x4"
+	"bitshr_u64x4"
+	"bitlsb_u8"
+	"bitlsb_u16"
+	"bitlsb_u32"
+	"bitlsb_u64"
+	"bitlsb_u8x2"
+	"bitlsb_u16x2"
+	"bitlsb_u32x2"
+	"bitlsb_u64x2"
+	"bitlsb_u8x3"
+	"bitlsb_u16x3"
+	"bitlsb_u32x3"
+	"bitlsb_u64x3"
+	"bitlsb_u8x4"
+	"bitlsb_u16x4"
+	"bitlsb_u32x4"
+	"bitlsb_u64x4"
+	"bitmsb_u8"
+	"bitmsb_u16"
+	"bitmsb_u32"
+	"bitmsb_u64"
+	"bitmsb_u8x2"
+	"bitmsb_u16x2"
+	"bitmsb_u32x2"
+	"bitmsb_u64x2"
+	"bitmsb_u8x3"
+	"bitmsb_u16x3"
+	"bitmsb_u32x3"
+	"bitmsb_u64x3"
+	"bitmsb_u8x4"
+	"bitmsb_u16x4"
+	"bitmsb_u32x4"
+	"bitmsb_u64x4"
+	"bitcount_u8"
+	"bitcount_u16"
+	"bitcount_u32"
+	"bitcount_u64"
+	"bitcount_u8x2"
+	"bitcount_u16x2"
+	"bitcount_u32x2"
+	"bitcount_u64x2"
+	"bitcount_u8x3"
+	"bitcount_u16x3"
+	"bitcount_u32x3"
+	"bitcount_u64x3"
+	"bitcount_u8x4"
+	"bitcount_u16x4"
+	"bitcount_u32x4"
+	"bitcount_u64x4"
+	"fma_f16"
+	"fma_f32"
+	"fma_f64"
+	"fma_f16x2"
+	"fma_f32x2"
+	"fma_f64x2"
+	"fma_f16x3"
+	"fma_f32x3"
+	"fma_f64x3"
+	"fma_f16x4"
+	"fma_f32x4"
+	"fma_f64x4"
+	"floor_f16"
+	"floor_f32"
+	"floor_f64"
+	"floor_f16x2"
+	"floor_f32x2"
+	"floor_f64x2"
+	"floor_f16x3"
+	"floor_f32x3"
+	"floor_f64x3"
+	"floor_f16x4"
+	"floor_f32x4"
+	"floor_f64x4"
+	"ceil_f16"
+	"ceil_f32"
+	"ceil_f64"
+	"ceil_f16x2"
+	"ceil_f32x2"
+	"ceil_f64x2"
+	"ceil_f16x3"
+	"ceil_f32x3"
+	"ceil_f64x3"
+	"ceil_f16x4"
+	"ceil_f32x4"
+	"ceil_f64x4"
+	"round_f16"
+	"round_f32"
+	"round_f64"
+	"round_f16x2"
+	"round_f32x2"
+	"round_f64x2"
+	"round_f16x3"
+	"round_f32x3"
+	"round_f64x3"
+	"round_f16x4"
+	"round_f32x4"
+	"round_f64x4"
+	"trunc_f16"
+	"trunc_f32"
+	"trunc_f64"
+	"trunc_f16x2"
+	"trunc_f32x2"
+	"trunc_f64x2"
+	"trunc_f16x3"
+	"trunc_f32x3"
+	"trunc_f64x3"
+	"trunc_f16x4"
+	"trunc_f32x4"
+	"trunc_f64x4"
+	"fract_f16"
+	"fract_f32"
+	"fract_f64"
+	"fract_f16x2"
+	"fract_f32x2"
+	"fract_f64x2"
+	"fract_f16x3"
+	"fract_f32x3"
+	"fract_f64x3"
+	"fract_f16x4"
+	"fract_f32x4"
+	"fract_f64x4"
+	"radians_f16"
+	"radians_f32"
+	"radians_f64"
+	"radians_f16x2"
+	"radians_f32x2"
+	"radians_f64x2"
+	"radians_f16x3"
+	"radians_f32x3"
+	"radians_f64x3"
+	"radians_f16x4"
+	"radians_f32x4"
+	"radians_f64x4"
+	"degrees_f16"
+	"degrees_f32"
+	"degrees_f64"
+	"degrees_f16x2"
+	"degrees_f32x2"
+	"degrees_f64x2"
+	"degrees_f16x3"
+	"degrees_f32x3"
+	"degrees_f64x3"
+	"degrees_f16x4"
+	"degrees_f32x4"
+	"degrees_f64x4"
+	"step_f16"
+	"step_f32"
+	"step_f64"
+	"step_f16x2"
+	"step_f32x2"
+	"step_f64x2"
+	"step_f16x3"
+	"step_f32x3"
+	"step_f64x3"
+	"step_f16x4"
+	"step_f32x4"
+	"step_f64x4"
+	"smoothstep_f16"
+	"smoothstep_f32"
+	"smoothstep_f64"
+	"smoothstep_f16x2"
+	"smoothstep_f32x2"
+	"smoothstep_f64x2"
+	"smoothstep_f16x3"
+	"smoothstep_f32x3"
+	"smoothstep_f64x3"
+	"smoothstep_f16x4"
+	"smoothstep_f32x4"
+	"smoothstep_f64x4"
+	"bitsto_f16"
+	"bitsto_f32"
+	"bitsto_f64"
+	"bitsto_f16x2"
+	"bitsto_f32x2"
+	"bitsto_f64x2"
+	"bitsto_f16x3"
+	"bitsto_f32x3"
+	"bitsto_f64x3"
+	"bitsto_f16x4"
+	"bitsto_f32x4"
+	"bitsto_f64x4"
+	"bitsfrom_f16"
+	"bitsfrom_f32"
+	"bitsfrom_f64"
+	"bitsfrom_f16x2"
+	"bitsfrom_f32x2",
+	"bitsfrom_f64x2"
+	"bitsfrom_f16x3"
+	"bitsfrom_f32x3"
+	"bitsfrom_f64x3"
+	"bitsfrom_f16x4"
+	"bitsfrom_f32x4"
+	"bitsfrom_f64x4"
+	"sin_f16"
+	"sin_f32"
+	"sin_f64"
+	"sin_f16x2"
+	"sin_f32x2"
+	"sin_f64x2"
+	"sin_f16x3"
+	"sin_f32x3"
+	"sin_f64x3"
+	"sin_f16x4"
+	"sin_f32x4"
+	"sin_f64x4"
+	"cos_f16"
+	"cos_f32"
+	"cos_f64"
+	"cos_f16x2"
+	"cos_f32x2"
+	"cos_f64x2"
+	"cos_f16x3"
+	"cos_f32x3"
+	"cos_f64x3"
+	"cos_f16x4"
+	"cos_f32x4"
+	"cos_f64x4"
+	"tan_f16"
+	"tan_f32"
+	"tan_f64"
+	"tan_f16x2"
+	"tan_f32x2"
+	"tan_f64x2"
+	"tan_f16x3"
+	"tan_f32x3"
+	"tan_f64x3"
+	"tan_f16x4"
+	"tan_f32x4"
+	"tan_f64x4"
+	"asin_f16"
+	"asin_f32"
+	"asin_f64"
+	"asin_f16x2"
+	"asin_f32x2"
+	"asin_f64x2"
+	"asin_f16x3"
+	"asin_f32x3"
+	"asin_f64x3"
+	"asin_f16x4"
+	"asin_f32x4"
+	"asin_f64x4"
+	"acos_f16"
+	"acos_f32"
+	"acos_f64"
+	"acos_f16x2"
+	"acos_f32x2"
+	"acos_f64x2"
+	"acos_f16x3"
+	"acos_f32x3"
+	"acos_f64x3"
+	"acos_f16x4"
+	"acos_f32x4"
+	"acos_f64x4"
+	"atan_f16"
+	"atan_f32"
+	"atan_f64"
+	"atan_f16x2"
+	"atan_f32x2"
+	"atan_f64x2"
+	"atan_f16x3"
+	"atan_f32x3"
+	"atan_f64x3"
+	"atan_f16x4"
+	"atan_f32x4"
+	"atan_f64x4"
+	"sinh_f16"
+	"sinh_f32"
+	"sinh_f64"
+	"sinh_f16x2"
+	"sinh_f32x2"
+	"sinh_f64x2"
+	"sinh_f16x3"
+	"sinh_f32x3"
+	"sinh_f64x3"
+	"sinh_f16x4"
+	"sinh_f32x4"
+	"sinh_f64x4"
+	"cosh_f16"
+	"cosh_f32"
+	"cosh_f64"
+	"cosh_f16x2"
+	"cosh_f32x2"
+	"cosh_f64x2"
+	"cosh_f16x3"
+	"cosh_f32x3"
+	"cosh_f64x3"
+	"cosh_f16x4"
+	"cosh_f32x4"
+	"cosh_f64x4"
+	"tanh_f16"
+	"tanh_f32"
+	"tanh_f64"
+	"tanh_f16x2"
+	"tanh_f32x2"
+	"tanh_f64x2"
+	"tanh_f16x3"
+	"tanh_f32x3"
+	"tanh_f64x3"
+	"tanh_f16x4"
+	"tanh_f32x4"
+	"tanh_f64x4"
+	"asinh_f16"
+	"asinh_f32"
+	"asinh_f64"
+	"asinh_f16x2"
+	"asinh_f32x2"
+	"asinh_f64x2"
+	"asinh_f16x3"
+	"asinh_f32x3"
+	"asinh_f64x3"
+	"asinh_f16x4"
+	"asinh_f32x4"
+	"asinh_f64x4"
+	"acosh_f16"
+	"acosh_f32"
+	"acosh_f64"
+	"acosh_f16x2"
+	"acosh_f32x2"
+	"acosh_f64x2"
+	"acosh_f16x3"
+	"acosh_f32x3"
+	"acosh_f64x3"
+	"acosh_f16x4"
+	"acosh_f32x4"
+	"acosh_f64x4"
+	"atanh_f16"
+	"atanh_f32"
+	"atanh_f64"
+	"atanh_f16x2"
+	"atanh_f32x2"
+	"atanh_f64x2"
+	"atanh_f16x3"
+	"atanh_f32x3"
+	"atanh_f64x3"
+	"atanh_f16x4"
+	"atanh_f32x4"
+	"atanh_f64x4"
+	"atan2_f16"
+	"atan2_f32"
+	"atan2_f64"
+	"atan2_f16x2"
+	"atan2_f32x2"
+	"atan2_f64x2"
+	"atan2_f16x3"
+	"atan2_f32x3"
+	"atan2_f64x3"
+	"atan2_f16x4"
+	"atan2_f32x4"
+	"atan2_f64x4"
+	"pow_f16"
+	"pow_f32"
+	"pow_f64"
+	"pow_f16x2"
+	"pow_f32x2"
+	"pow_f64x2"
+	"pow_f16x3"
+	"pow_f32x3"
+	"pow_f64x3"
+	"pow_f16x4"
+	"pow_f32x4"
+	"pow_f64x4"
+	"exp_f16"
+	"exp_f32"
+	"exp_f64"
+	"exp_f16x2"
+	"exp_f32x2"
+	"exp_f64x2"
+	"exp_f16x3"
+	"exp_f32x3"
+	"exp_f64x3"
+	"exp_f16x4"
+	"exp_f32x4"
+	"exp_f64x4"
+	"log_f16"
+	"log_f32"
+	"log_f64"
+	"log_f16x2"
+	"log_f32x2"
+	"log_f64x2"
+	"log_f16x3"
+	"log_f32x3"
+	"log_f64x3"
+	"log_f16x4"
+	"log_f32x4"
+	"log_f64x4"
+	"exp2_f16"
+	"exp2_f32"
+	"exp2_f64"
+	"exp2_f16x2"
+	"exp2_f32x2"
+	"exp2_f64x2"
+	"exp2_f16x3"
+	"exp2_f32x3"
+	"exp2_f64x3"
+	"exp2_f16x4"
+	"exp2_f32x4"
+	"exp2_f64x4"
+	"log2_f16"
+	"log2_f32"
+	"log2_f64"
+	"log2_f16x2"
+	"log2_f32x2"
+	"log2_f64x2"
+	"log2_f16x3"
+	"log2_f32x3"
+	"log2_f64x3"
+	"log2_f16x4"
+	"log2_f32x4"
+	"log2_f64x4"
+	"sqrt_f16"
+	"sqrt_f32"
+	"sqrt_f64"
+	"sqrt_f16x2"
+	"sqrt_f32x2"
+	"sqrt_f64x2"
+	"sqrt_f16x3"
+	"sqrt_f32x3"
+	"sqrt_f64x3"
+	"sqrt_f16x4"
+	"sqrt_f32x4"
+	"sqrt_f64x4"
+	"rsqrt_f16"
+	"rsqrt_f32"
+	"rsqrt_f64"
+	"rsqrt_f16x2"
+	"rsqrt_f32x2"
+	"rsqrt_f64x2"
+	"rsqrt_f16x3"
+	"rsqrt_f32x3"
+	"rsqrt_f64x3"
+	"rsqrt_f16x4"
+	"rsqrt_f32x4"
+	"rsqrt_f64x4"
+	"isinf_f16"
+	"isinf_f32"
+	"isinf_f64"
+	"isinf_f16x2"
+	"isinf_f32x2"
+	"isinf_f64x2"
+	"isinf_f16x3"
+	"isinf_f32x3"
+	"isinf_f64x3"
+	"isinf_f16x4"
+	"isinf_f32x4"
+	"isinf_f64x4"
+	"isnan_f16"
+	"isnan_f32"
+	"isnan_f64"
+	"isnan_f16x2"
+	"isnan_f32x2"
+	"isnan_f64x2"
+	"isnan_f16x3"
+	"isnan_f32x3"
+	"isnan_f64x3"
+	"isnan_f16x4"
+	"isnan_f32x4"
+	"isnan_f64x4"
+	"lerp_f16"
+	"lerp_f32"
+	"lerp_f64"
+	"lerp_f16x2"
+	"lerp_f32x2"
+	"lerp_f64x2"
+	"lerp_f16x3"
+	"lerp_f32x3"
+	"lerp_f64x3"
+	"lerp_f16x4"
+	"lerp_f32x4"
+	"lerp_f64x4"
+	"cross_f16x2"
+	"cross_f32x2"
+	"cross_f64x2"
+	"cross_f16x3"
+	"cross_f32x3"
+	"cross_f64x3"
+	"cross_f16x4"
+	"cross_f32x4"
+	"cross_f64x4"
+	"dot_f16x2"
+	"dot_f32x2"
+	"dot_f64x2"
+	"dot_f16x3"
+	"dot_f32x3"
+	"dot_f64x3"
+	"dot_f16x4"
+	"dot_f32x4"
+	"dot_f64x4"
+	"len_f16x2"
+	"len_f32x2"
+	"len_f64x2"
+	"len_f16x3"
+	"len_f32x3"
+	"len_f64x3"
+	"len_f16x4"
+	"len_f32x4"
+	"len_f64x4"
+	"norm_f16x2"
+	"norm_f32x2"
+	"norm_f64x2"
+	"norm_f16x3"
+	"norm_f32x3"
+	"norm_f64x3"
+	"norm_f16x4"
+	"norm_f32x4"
+	"norm_f64x4"
+	"reflect_f16x2"
+	"reflect_f32x2"
+	"reflect_f64x2"
+	"reflect_f16x3"
+	"reflect_f32x3"
+	"reflect_f64x3"
+	"reflect_f16x4"
+	"reflect_f32x4"
+	"reflect_f64x4"
+	"refract_f16x2"
+	"refract_f32x2"
+	"refract_f64x2"
+	"refract_f16x3"
+	"refract_f32x3"
+	"refract_f64x3"
+	"refract_f16x4"
+	"refract_f32x4"
+	"refract_f64x4"
+	"ddx_f16"
+	"ddx_f32"
+	"ddx_f64"
+	"ddx_f16x2"
+	"ddx_f32x2"
+	"ddx_f64x2"
+	"ddx_f16x3"
+	"ddx_f32x3"
+	"ddx_f64x3"
+	"ddx_f16x4"
+	"ddx_f32x4"
+	"ddx_f64x4"
+	"ddy_f16"
+	"ddy_f32"
+	"ddy_f64"
+	"ddy_f16x2"
+	"ddy_f32x2"
+	"ddy_f64x2"
+	"ddy_f16x3"
+	"ddy_f32x3"
+	"ddy_f64x3"
+	"ddy_f16x4"
+	"ddy_f32x4"
+	"ddy_f64x4"
+	"fwidth_f16"
+	"fwidth_f32"
+	"fwidth_f64"
+	"fwidth_f16x2"
+	"fwidth_f32x2"
+	"fwidth_f64x2"
+	"fwidth_f16x3"
+	"fwidth_f32x3"
+	"fwidth_f64x3"
+	"fwidth_f16x4"
+	"fwidth_f32x4"
+	"fwidth_f64x4"
+	"ddx_fine_f16"
+	"ddx_fine_f32"
+	"ddx_fine_f64"
+	"ddx_fine_f16x2"
+	"ddx_fine_f32x2"
+	"ddx_fine_f64x2"
+	"ddx_fine_f16x3"
+	"ddx_fine_f32x3"
+	"ddx_fine_f64x3"
+	"ddx_fine_f16x4"
+	"ddx_fine_f32x4"
+	"ddx_fine_f64x4"
+	"ddy_fine_f16"
+	"ddy_fine_f32"
+	"ddy_fine_f64"
+	"ddy_fine_f16x2"
+	"ddy_fine_f32x2"
+	"ddy_fine_f64x2"
+	"ddy_fine_f16x3"
+	"ddy_fine_f32x3"
+	"ddy_fine_f64x3"
+	"ddy_fine_f16x4"
+	"ddy_fine_f32x4"
+	"ddy_fine_f64x4"
+	"fwidth_fine_f16"
+	"fwidth_fine_f32"
+	"fwidth_fine_f64"
+	"fwidth_fine_f16x2"
+	"fwidth_fine_f32x2"
+	"fwidth_fine_f64x2",
+	"fwidth_fine_f16x3"
+	"fwidth_fine_f32x3"
+	"fwidth_fine_f64x3"
+	"fwidth_fine_f16x4"
+	"fwidth_fine_f32x4"
+	"fwidth_fine_f64x4"
+	"ddx_coarse_f16"
+	"ddx_coarse_f32"
+	"ddx_coarse_f64"
+	"ddx_coarse_f16x2"
+	"ddx_coarse_f32x2"
+	"ddx_coarse_f64x2"
+	"ddx_coarse_f16x3"
+	"ddx_coarse_f32x3"
+	"ddx_coarse_f64x3"
+	"ddx_coarse_f16x4"
+	"ddx_coarse_f32x4"
+	"ddx_coarse_f64x4"
+	"ddy_coarse_f16"
+	"ddy_coarse_f32"
+	"ddy_coarse_f64"
+	"ddy_coarse_f16x2"
+	"ddy_coarse_f32x2"
+	"ddy_coarse_f64x2"
+	"ddy_coarse_f16x3"
+	"ddy_coarse_f32x3"
+	"ddy_coarse_f64x3"
+	"ddy_coarse_f16x4"
+	"ddy_coarse_f32x4"
+	"ddy_coarse_f64x4"
+	"fwidth_coarse_f16"
+	"fwidth_coarse_f32"
+	"fwidth_coarse_f64"
+	"fwidth_coarse_f16x2"
+	"fwidth_coarse_f32x2"
+	"fwidth_coarse_f64x2"
+	"fwidth_coarse_f16x3"
+	"fwidth_coarse_f32x3"
+	"fwidth_coarse_f64x3"
+	"fwidth_coarse_f16x4"
+	"fwidth_coarse_f32x4"
+	"fwidth_coarse_f64x4"
+	"quad_swap_x_bool"
+	"quad_swap_x_s8"
+	"quad_swap_x_s16"
+	"quad_swap_x_s32"
+	"quad_swap_x_s64"
+	"quad_swap_x_u8"
+	"quad_swap_x_u16"
+	"quad_swap_x_u32"
+	"quad_swap_x_u64"
+	"quad_swap_x_f16"
+	"quad_swap_x_f32"
+	"quad_swap_x_f64"
+	"quad_swap_x_boolx2"
+	"quad_swap_x_s8x2"
+	"quad_swap_x_s16x2"
+	"quad_swap_x_s32x2"
+	"quad_swap_x_s64x2"
+	"quad_swap_x_u8x2"
+	"quad_swap_x_u16x2"
+	"quad_swap_x_u32x2"
+	"quad_swap_x_u64x2"
+	"quad_swap_x_f16x2"
+	"quad_swap_x_f32x2"
+	"quad_swap_x_f64x2"
+	"quad_swap_x_boolx3"
+	"quad_swap_x_s8x3"
+	"quad_swap_x_s16x3"
+	"quad_swap_x_s32x3"
+	"quad_swap_x_s64x3"
+	"quad_swap_x_u8x3"
+	"quad_swap_x_u16x3"
+	"quad_swap_x_u32x3"
+	"quad_swap_x_u64x3"
+	"quad_swap_x_f16x3"
+	"quad_swap_x_f32x3"
+	"quad_swap_x_f64x3"
+	"quad_swap_x_boolx4"
+	"quad_swap_x_s8x4"
+	"quad_swap_x_s16x4"
+	"quad_swap_x_s32x4"
+	"quad_swap_x_s64x4"
+	"quad_swap_x_u8x4"
+	"quad_swap_x_u16x4"
+	"quad_swap_x_u32x4"
+	"quad_swap_x_u64x4"
+	"quad_swap_x_f16x4"
+	"quad_swap_x_f32x4"
+	"quad_swap_x_f64x4"
+	"quad_swap_y_bool"
+	"quad_swap_y_s8"
+	"quad_swap_y_s16"
+	"quad_swap_y_s32"
+	"quad_swap_y_s64"
+	"quad_swap_y_u8"
+	"quad_swap_y_u16"
+	"quad_swap_y_u32"
+	"quad_swap_y_u64"
+	"quad_swap_y_f16"
+	"quad_swap_y_f32"
+	"quad_swap_y_f64"
+	"quad_swap_y_boolx2"
+	"quad_swap_y_s8x2"
+	"quad_swap_y_s16x2"
+	"quad_swap_y_s32x2"
+	"quad_swap_y_s64x2"
+	"quad_swap_y_u8x2"
+	"quad_swap_y_u16x2"
+	"quad_swap_y_u32x2"
+	"quad_swap_y_u64x2"
+	"quad_swap_y_f16x2"
+	"quad_swap_y_f32x2"
+	"quad_swap_y_f64x2"
+	"quad_swap_y_boolx3"
+	"quad_swap_y_s8x3"
+	"quad_swap_y_s16x3"
+	"quad_swap_y_s32x3"
+	"quad_swap_y_s64x3"
+	"quad_swap_y_u8x3"
+	"quad_swap_y_u16x3"
+	"quad_swap_y_u32x3"
+	"quad_swap_y_u64x3"
+	"quad_swap_y_f16x3"
+	"quad_swap_y_f32x3"
+	"quad_swap_y_f64x3"
+	"quad_swap_y_boolx4"
+	"quad_swap_y_s8x4"
+	"quad_swap_y_s16x4"
+	"quad_swap_y_s32x4"
+	"quad_swap_y_s64x4"
+	"quad_swap_y_u8x4"
+	"quad_swap_y_u16x4"
+	"quad_swap_y_u32x4"
+	"quad_swap_y_u64x4"
+	"quad_swap_y_f16x4"
+	"quad_swap_y_f32x4"
+	"quad_swap_y_f64x4"
+	"quad_swap_diagonal_bool"
+	"quad_swap_diagonal_s8"
+	"quad_swap_diagonal_s16"
+	"quad_swap_diagonal_s32"
+	"quad_swap_diagonal_s64"
+	"quad_swap_diagonal_u8"
+	"quad_swap_diagonal_u16"
+	"quad_swap_diagonal_u32"
+	"quad_swap_diagonal_u64"
+	"quad_swap_diagonal_f16"
+	"quad_swap_diagonal_f32"
+	"quad_swap_diagonal_f64"
+	"quad_swap_diagonal_boolx2"
+	"quad_swap_diagonal_s8x2"
+	"quad_swap_diagonal_s16x2"
+	"quad_swap_diagonal_s32x2"
+	"quad_swap_diagonal_s64x2"
+	"quad_swap_diagonal_u8x2"
+	"quad_swap_diagonal_u16x2"
+	"quad_swap_diagonal_u32x2"
+	"quad_swap_diagonal_u64x2"
+	"quad_swap_diagonal_f16x2"
+	"quad_swap_diagonal_f32x2"
+	"quad_swap_diagonal_f64x2"
+	"quad_swap_diagonal_boolx3"
+	"quad_swap_diagonal_s8x3"
+	"quad_swap_diagonal_s16x3"
+	"quad_swap_diagonal_s32x3"
+	"quad_swap_diagonal_s64x3"
+	"quad_swap_diagonal_u8x3"
+	"quad_swap_diagonal_u16x3"
+	"quad_swap_diagonal_u32x3"
+	"quad_swap_diagonal_u64x3"
+	"quad_swap_diagonal_f16x3"
+	"quad_swap_diagonal_f32x3"
+	"quad_swap_diagonal_f64x3"
+	"quad_swap_diagonal_boolx4"
+	"quad_swap_diagonal_s8x4"
+	"quad_swap_diagonal_s16x4"
+	"quad_swap_diagonal_s32x4"
+	"quad_swap_diagonal_s64x4"
+	"quad_swap_diagonal_u8x4"
+	"quad_swap_diagonal_u16x4"
+	"quad_swap_diagonal_u32x4"
+	"quad_swap_diagonal_u64x4"
+	"quad_swap_diagonal_f16x4"
+	"quad_swap_diagonal_f32x4"
+	"quad_swap_diagonal_f64x4"
+	"quad_read_thread_bool"
+	"quad_read_thread_s8"
+	"quad_read_thread_s16"
+	"quad_read_thread_s32"
+	"quad_read_thread_s64"
+	"quad_read_thread_u8"
+	"quad_read_thread_u16"
+	"quad_read_thread_u32"
+	"quad_read_thread_u64"
+	"quad_read_thread_f16"
+	"quad_read_thread_f32"
+	"quad_read_thread_f64"
+	"quad_read_thread_boolx2"
+	"quad_read_thread_s8x2"
+	"quad_read_thread_s16x2"
+	"quad_read_thread_s32x2"
+	"quad_read_thread_s64x2"
+	"quad_read_thread_u8x2"
+	"quad_read_thread_u16x2"
+	"quad_read_thread_u32x2"
+	"quad_read_thread_u64x2"
+	"quad_read_thread_f16x2"
+	"quad_read_thread_f32x2"
+	"quad_read_thread_f64x2"
+	"quad_read_thread_boolx3"
+	"quad_read_thread_s8x3"
+	"quad_read_thread_s16x3"
+	"quad_read_thread_s32x3"
+	"quad_read_thread_s64x3"
+	"quad_read_thread_u8x3"
+	"quad_read_thread_u16x3"
+	"quad_read_thread_u32x3"
+	"quad_read_thread_u64x3",
+	"quad_read_thread_f16x3"
+	"quad_read_thread_f32x3"
+	"quad_read_thread_f64x3"
+	"quad_read_thread_boolx4"
+	"quad_read_thread_s8x4"
+	"quad_read_thread_s16x4"
+	"quad_read_thread_s32x4"
+	"quad_read_thread_s64x4"
+	"quad_read_thread_u8x4"
+	"quad_read_thread_u16x4"
+	"quad_read_thread_u32x4"
+	"quad_read_thread_u64x4"
+	"quad_read_thread_f16x4"
+	"quad_read_thread_f32x4"
+	"quad_read_thread_f64x4"
+	"quad_any_bool"
+	"quad_any_s8"
+	"quad_any_s16"
+	"quad_any_s32"
+	"quad_any_s64"
+	"quad_any_u8"
+	"quad_any_u16"
+	"quad_any_u32"
+	"quad_any_u64"
+	"quad_any_f16"
+	"quad_any_f32"
+	"quad_any_f64"
+	"quad_all_bool"
+	"quad_all_s8"
+	"quad_all_s16"
+	"quad_all_s32"
+	"quad_all_s64"
+	"quad_all_u8"
+	"quad_all_u16"
+	"quad_all_u32"
+	"quad_all_u64"
+	"quad_all_f16"
+	"quad_all_f32"
+	"quad_all_f64"
+	"wave_active_any_bool"
+	"wave_active_any_s8"
+	"wave_active_any_s16"
+	"wave_active_any_s32"
+	"wave_active_any_s64"
+	"wave_active_any_u8"
+	"wave_active_any_u16"
+	"wave_active_any_u32"
+	"wave_active_any_u64"
+	"wave_active_any_f16"
+	"wave_active_any_f32"
+	"wave_active_any_f64"
+	"wave_active_all_bool"
+	"wave_active_all_s8"
+	"wave_active_all_s16"
+	"wave_active_all_s32"
+	"wave_active_all_s64"
+	"wave_active_all_u8"
+	"wave_active_all_u16"
+	"wave_active_all_u32"
+	"wave_active_all_u64"
+	"wave_active_all_f16"
+	"wave_active_all_f32"
+	"wave_active_all_f64"
+	"wave_read_thread_bool"
+	"wave_read_thread_s8"
+	"wave_read_thread_s16"
+	"wave_read_thread_s32"
+	"wave_read_thread_s64"
+	"wave_read_thread_u8"
+	"wave_read_thread_u16"
+	"wave_read_thread_u32"
+	"wave_read_thread_u64"
+	"wave_read_thread_f16"
+	"wave_read_thread_f32"
+	"wave_read_thread_f64"
+	"wave_read_thread_boolx2"
+	"wave_read_thread_s8x2"
+	"wave_read_thread_s16x2"
+	"wave_read_thread_s32x2"
+	"wave_read_thread_s64x2"
+	"wave_read_thread_u8x2"
+	"wave_read_thread_u16x2"
+	"wave_read_thread_u32x2"
+	"wave_read_thread_u64x2"
+	"wave_read_thread_f16x2"
+	"wave_read_thread_f32x2"
+	"wave_read_thread_f64x2"
+	"wave_read_thread_boolx3"
+	"wave_read_thread_s8x3"
+	"wave_read_thread_s16x3"
+	"wave_read_thread_s32x3"
+	"wave_read_thread_s64x3"
+	"wave_read_thread_u8x3"
+	"wave_read_thread_u16x3"
+	"wave_read_thread_u32x3"
+	"wave_read_thread_u64x3"
+	"wave_read_thread_f16x3"
+	"wave_read_thread_f32x3"
+	"wave_read_thread_f64x3"
+	"wave_read_thread_boolx4"
+	"wave_read_thread_s8x4"
+	"wave_read_thread_s16x4"
+	"wave_read_thread_s32x4"
+	"wave_read_thread_s64x4"
+	"wave_read_thread_u8x4"
+	"wave_read_thread_u16x4"
+	"wave_read_thread_u32x4"
+	"wave_read_thread_u64x4"
+	"wave_read_thread_f16x4"
+	"wave_read_thread_f32x4"
+	"wave_read_thread_f64x4"
+	"wave_active_all_equal_bool"
+	"wave_active_all_equal_s8"
+	"wave_active_all_equal_s16"
+	"wave_active_all_equal_s32"
+	"wave_active_all_equal_s64"
+	"wave_active_all_equal_u8"
+	"wave_active_all_equal_u16"
+	"wave_active_all_equal_u32"
+	"wave_active_all_equal_u64"
+	"wave_active_all_equal_f16"
+	"wave_active_all_equal_f32"
+	"wave_active_all_equal_f64"
+	"wave_active_all_equal_boolx2"
+	"wave_active_all_equal_s8x2"
+	"wave_active_all_equal_s16x2"
+	"wave_active_all_equal_s32x2"
+	"wave_active_all_equal_s64x2"
+	"wave_active_all_equal_u8x2"
+	"wave_active_all_equal_u16x2"
+	"wave_active_all_equal_u32x2"
+	"wave_active_all_equal_u64x2"
+	"wave_active_all_equal_f16x2"
+	"wave_active_all_equal_f32x2"
+	"wave_active_all_equal_f64x2"
+	"wave_active_all_equal_boolx3"
+	"wave_active_all_equal_s8x3"
+	"wave_active_all_equal_s16x3"
+	"wave_active_all_equal_s32x3"
+	"wave_active_all_equal_s64x3"
+	"wave_active_all_equal_u8x3"
+	"wave_active_all_equal_u16x3"
+	"wave_active_all_equal_u32x3"
+	"wave_active_all_equal_u64x3"
+	"wave_active_all_equal_f16x3"
+	"wave_active_all_equal_f32x3"
+	"wave_active_all_equal_f64x3"
+	"wave_active_all_equal_boolx4"
+	"wave_active_all_equal_s8x4"
+	"wave_active_all_equal_s16x4"
+	"wave_active_all_equal_s32x4"
+	"wave_active_all_equal_s64x4"
+	"wave_active_all_equal_u8x4"
+	"wave_active_all_equal_u16x4"
+	"wave_active_all_equal_u32x4"
+	"wave_active_all_equal_u64x4"
+	"wave_active_all_equal_f16x4"
+	"wave_active_all_equal_f32x4"
+	"wave_active_all_equal_f64x4"
+	"wave_active_min_s8"
+	"wave_active_min_s16"
+	"wave_active_min_s32"
+	"wave_active_min_s64"
+	"wave_active_min_u8"
+	"wave_active_min_u16"
+	"wave_active_min_u32"
+	"wave_active_min_u64"
+	"wave_active_min_f16"
+	"wave_active_min_f32"
+	"wave_active_min_f64"
+	"wave_active_min_s8x2"
+	"wave_active_min_s16x2"
+	"wave_active_min_s32x2"
+	"wave_active_min_s64x2"
+	"wave_active_min_u8x2"
+	"wave_active_min_u16x2"
+	"wave_active_min_u32x2"
+	"wave_active_min_u64x2"
+	"wave_active_min_f16x2"
+	"wave_active_min_f32x2"
+	"wave_active_min_f64x2"
+	"wave_active_min_s8x3"
+	"wave_active_min_s16x3"
+	"wave_active_min_s32x3"
+	"wave_active_min_s64x3"
+	"wave_active_min_u8x3"
+	"wave_active_min_u16x3"
+	"wave_active_min_u32x3"
+	"wave_active_min_u64x3"
+	"wave_active_min_f16x3"
+	"wave_active_min_f32x3"
+	"wave_active_min_f64x3"
+	"wave_active_min_s8x4"
+	"wave_active_min_s16x4"
+	"wave_active_min_s32x4",
+	"wave_active_min_s64x4"
+	"wave_active_min_u8x4"
+	"wave_active_min_u16x4"
+	"wave_active_min_u32x4"
+	"wave_active_min_u64x4"
+	"wave_active_min_f16x4"
+	"wave_active_min_f32x4"
+	"wave_active_min_f64x4"
+	"wave_active_max_s8"
+	"wave_active_max_s16"
+	"wave_active_max_s32"
+	"wave_active_max_s64"
+	"wave_active_max_u8"
+	"wave_active_max_u16"
+	"wave_active_max_u32"
+	"wave_active_max_u64"
+	"wave_active_max_f16"
+	"wave_active_max_f32"
+	"wave_active_max_f64"
+	"wave_active_max_s8x2"
+	"wave_active_max_s16x2"
+	"wave_active_max_s32x2"
+	"wave_active_max_s64x2"
+	"wave_active_max_u8x2"
+	"wave_active_max_u16x2"
+	"wave_active_max_u32x2"
+	"wave_active_max_u64x2"
+	"wave_active_max_f16x2"
+	"wave_active_max_f32x2"
+	"wave_active_max_f64x2"
+	"wave_active_max_s8x3"
+	"wave_active_max_s16x3"
+	"wave_active_max_s32x3"
+	"wave_active_max_s64x3"
+	"wave_active_max_u8x3"
+	"wave_active_max_u16x3"
+	"wave_active_max_u32x3"
+	"wave_active_max_u64x3"
+	"wave_active_max_f16x3"
+	"wave_active_max_f32x3"
+	"wave_active_max_f64x3"
+	"wave_active_max_s8x4"
+	"wave_active_max_s16x4"
+	"wave_active_max_s32x4"
+	"wave_active_max_s64x4"
+	"wave_active_max_u8x4"
+	"wave_active_max_u16x4"
+	"wave_active_max_u32x4"
+	"wave_active_max_u64x4"
+	"wave_active_max_f16x4"
+	"wave_active_max_f32x4"
+	"wave_active_max_f64x4"
+	"wave_active_sum_s8"
+	"wave_active_sum_s16"
+	"wave_active_sum_s32"
+	"wave_active_sum_s64"
+	"wave_active_sum_u8"
+	"wave_active_sum_u16"
+	"wave_active_sum_u32"
+	"wave_active_sum_u64"
+	"wave_active_sum_f16"
+	"wave_active_sum_f32"
+	"wave_active_sum_f64"
+	"wave_active_sum_s8x2"
+	"wave_active_sum_s16x2"
+	"wave_active_sum_s32x2"
+	"wave_active_sum_s64x2"
+	"wave_active_sum_u8x2"
+	"wave_active_sum_u16x2"
+	"wave_active_sum_u32x2"
+	"wave_active_sum_u64x2"
+	"wave_active_sum_f16x2"
+	"wave_active_sum_f32x2"
+	"wave_active_sum_f64x2"
+	"wave_active_sum_s8x3"
+	"wave_active_sum_s16x3"
+	"wave_active_sum_s32x3"
+	"wave_active_sum_s64x3"
+	"wave_active_sum_u8x3"
+	"wave_active_sum_u16x3"
+	"wave_active_sum_u32x3"
+	"wave_active_sum_u64x3"
+	"wave_active_sum_f16x3"
+	"wave_active_sum_f32x3"
+	"wave_active_sum_f64x3"
+	"wave_active_sum_s8x4"
+	"wave_active_sum_s16x4"
+	"wave_active_sum_s32x4"
+	"wave_active_sum_s64x4"
+	"wave_active_sum_u8x4"
+	"wave_active_sum_u16x4"
+	"wave_active_sum_u32x4"
+	"wave_active_sum_u64x4"
+	"wave_active_sum_f16x4"
+	"wave_active_sum_f32x4"
+	"wave_active_sum_f64x4"
+	"wave_active_prefix_sum_s8"
+	"wave_active_prefix_sum_s16"
+	"wave_active_prefix_sum_s32"
+	"wave_active_prefix_sum_s64"
+	"wave_active_prefix_sum_u8"
+	"wave_active_prefix_sum_u16"
+	"wave_active_prefix_sum_u32"
+	"wave_active_prefix_sum_u64"
+	"wave_active_prefix_sum_f16"
+	"wave_active_prefix_sum_f32"
+	"wave_active_prefix_sum_f64"
+	"wave_active_prefix_sum_s8x2"
+	"wave_active_prefix_sum_s16x2"
+	"wave_active_prefix_sum_s32x2"
+	"wave_active_prefix_sum_s64x2"
+	"wave_active_prefix_sum_u8x2"
+	"wave_active_prefix_sum_u16x2"
+	"wave_active_prefix_sum_u32x2"
+	"wave_active_prefix_sum_u64x2"
+	"wave_active_prefix_sum_f16x2"
+	"wave_active_prefix_sum_f32x2"
+	"wave_active_prefix_sum_f64x2"
+	"wave_active_prefix_sum_s8x3"
+	"wave_active_prefix_sum_s16x3"
+	"wave_active_prefix_sum_s32x3"
+	"wave_active_prefix_sum_s64x3"
+	"wave_active_prefix_sum_u8x3"
+	"wave_active_prefix_sum_u16x3"
+	"wave_active_prefix_sum_u32x3"
+	"wave_active_prefix_sum_u64x3"
+	"wave_active_prefix_sum_f16x3"
+	"wave_active_prefix_sum_f32x3"
+	"wave_active_prefix_sum_f64x3"
+	"wave_active_prefix_sum_s8x4"
+	"wave_active_prefix_sum_s16x4"
+	"wave_active_prefix_sum_s32x4"
+	"wave_active_prefix_sum_s64x4"
+	"wave_active_prefix_sum_u8x4"
+	"wave_active_prefix_sum_u16x4"
+	"wave_active_prefix_sum_u32x4"
+	"wave_active_prefix_sum_u64x4"
+	"wave_active_prefix_sum_f16x4"
+	"wave_active_prefix_sum_f32x4"
+	"wave_active_prefix_sum_f64x4"
+	"wave_active_product_s8"
+	"wave_active_product_s16"
+	"wave_active_product_s32"
+	"wave_active_product_s64"
+	"wave_active_product_u8"
+	"wave_active_product_u16"
+	"wave_active_product_u32"
+	"wave_active_product_u64"
+	"wave_active_product_f16"
+	"wave_active_product_f32"
+	"wave_active_product_f64"
+	"wave_active_product_s8x2"
+	"wave_active_product_s16x2"
+	"wave_active_product_s32x2"
+	"wave_active_product_s64x2"
+	"wave_active_product_u8x2"
+	"wave_active_product_u16x2"
+	"wave_active_product_u32x2"
+	"wave_active_product_u64x2"
+	"wave_active_product_f16x2"
+	"wave_active_product_f32x2"
+	"wave_active_product_f64x2"
+	"wave_active_product_s8x3"
+	"wave_active_product_s16x3"
+	"wave_active_product_s32x3"
+	"wave_active_product_s64x3"
+	"wave_active_product_u8x3"
+	"wave_active_product_u16x3"
+	"wave_active_product_u32x3"
+	"wave_active_product_u64x3"
+	"wave_active_product_f16x3"
+	"wave_active_product_f32x3"
+	"wave_active_product_f64x3"
+	"wave_active_product_s8x4"
+	"wave_active_product_s16x4"
+	"wave_active_product_s32x4"
+	"wave_active_product_s64x4"
+	"wave_active_product_u8x4",
+	"wave_active_product_u16x4"
+	"wave_active_product_u32x4"
+	"wave_active_product_u64x4"
+	"wave_active_product_f16x4"
+	"wave_active_product_f32x4"
+	"wave_active_product_f64x4"
+	"wave_active_prefix_product_s8"
+	"wave_active_prefix_product_s16"
+	"wave_active_prefix_product_s32"
+	"wave_active_prefix_product_s64"
+	"wave_active_prefix_product_u8"
+	"wave_active_prefix_product_u16"
+	"wave_active_prefix_product_u32"
+	"wave_active_prefix_product_u64"
+	"wave_active_prefix_product_f16"
+	"wave_active_prefix_product_f32"
+	"wave_active_prefix_product_f64"
+	"wave_active_prefix_product_s8x2"
+	"wave_active_prefix_product_s16x2"
+	"wave_active_prefix_product_s32x2"
+	"wave_active_prefix_product_s64x2"
+	"wave_active_prefix_product_u8x2"
+	"wave_active_prefix_product_u16x2"
+	"wave_active_prefix_product_u32x2"
+	"wave_active_prefix_product_u64x2"
+	"wave_active_prefix_product_f16x2"
+	"wave_active_prefix_product_f32x2"
+	"wave_active_prefix_product_f64x2"
+	"wave_active_prefix_product_s8x3"
+	"wave_active_prefix_product_s16x3"
+	"wave_active_prefix_product_s32x3"
+	"wave_active_prefix_product_s64x3"
+	"wave_active_prefix_product_u8x3"
+	"wave_active_prefix_product_u16x3"
+	"wave_active_prefix_product_u32x3"
+	"wave_active_prefix_product_u64x3"
+	"wave_active_prefix_product_f16x3"
+	"wave_active_prefix_product_f32x3"
+	"wave_active_prefix_product_f64x3"
+	"wave_active_prefix_product_s8x4"
+	"wave_active_prefix_product_s16x4"
+	"wave_active_prefix_product_s32x4"
+	"wave_active_prefix_product_s64x4"
+	"wave_active_prefix_product_u8x4"
+	"wave_active_prefix_product_u16x4"
+	"wave_active_prefix_product_u32x4"
+	"wave_active_prefix_product_u64x4"
+	"wave_active_prefix_product_f16x4"
+	"wave_active_prefix_product_f32x4"
+	"wave_active_prefix_product_f64x4"
+	"wave_active_count_bits_bool"
+	"wave_active_prefix_count_bits_bool"
+	"wave_active_bit_and_s8"
+	"wave_active_bit_and_s16"
+	"wave_active_bit_and_s32"
+	"wave_active_bit_and_s64"
+	"wave_active_bit_and_u8"
+	"wave_active_bit_and_u16"
+	"wave_active_bit_and_u32"
+	"wave_active_bit_and_u64"
+	"wave_active_bit_and_s8x2"
+	"wave_active_bit_and_s16x2"
+	"wave_active_bit_and_s32x2"
+	"wave_active_bit_and_s64x2"
+	"wave_active_bit_and_u8x2"
+	"wave_active_bit_and_u16x2"
+	"wave_active_bit_and_u32x2"
+	"wave_active_bit_and_u64x2"
+	"wave_active_bit_and_s8x3"
+	"wave_active_bit_and_s16x3"
+	"wave_active_bit_and_s32x3"
+	"wave_active_bit_and_s64x3"
+	"wave_active_bit_and_u8x3"
+	"wave_active_bit_and_u16x3"
+	"wave_active_bit_and_u32x3"
+	"wave_active_bit_and_u64x3"
+	"wave_active_bit_and_s8x4"
+	"wave_active_bit_and_s16x4"
+	"wave_active_bit_and_s32x4"
+	"wave_active_bit_and_s64x4"
+	"wave_active_bit_and_u8x4"
+	"wave_active_bit_and_u16x4"
+	"wave_active_bit_and_u32x4"
+	"wave_active_bit_and_u64x4"
+	"wave_active_bit_or_s8"
+	"wave_active_bit_or_s16"
+	"wave_active_bit_or_s32"
+	"wave_active_bit_or_s64"
+	"wave_active_bit_or_u8"
+	"wave_active_bit_or_u16"
+	"wave_active_bit_or_u32"
+	"wave_active_bit_or_u64"
+	"wave_active_bit_or_s8x2"
+	"wave_active_bit_or_s16x2"
+	"wave_active_bit_or_s32x2"
+	"wave_active_bit_or_s64x2"
+	"wave_active_bit_or_u8x2"
+	"wave_active_bit_or_u16x2"
+	"wave_active_bit_or_u32x2"
+	"wave_active_bit_or_u64x2"
+	"wave_active_bit_or_s8x3"
+	"wave_active_bit_or_s16x3"
+	"wave_active_bit_or_s32x3"
+	"wave_active_bit_or_s64x3"
+	"wave_active_bit_or_u8x3"
+	"wave_active_bit_or_u16x3"
+	"wave_active_bit_or_u32x3"
+	"wave_active_bit_or_u64x3"
+	"wave_active_bit_or_s8x4"
+	"wave_active_bit_or_s16x4"
+	"wave_active_bit_or_s32x4"
+	"wave_active_bit_or_s64x4"
+	"wave_active_bit_or_u8x4"
+	"wave_active_bit_or_u16x4"
+	"wave_active_bit_or_u32x4"
+	"wave_active_bit_or_u64x4"
+	"wave_active_bit_xor_s8"
+	"wave_active_bit_xor_s16"
+	"wave_active_bit_xor_s32"
+	"wave_active_bit_xor_s64"
+	"wave_active_bit_xor_u8"
+	"wave_active_bit_xor_u16"
+	"wave_active_bit_xor_u32"
+	"wave_active_bit_xor_u64"
+	"wave_active_bit_xor_s8x2"
+	"wave_active_bit_xor_s16x2"
+	"wave_active_bit_xor_s32x2"
+	"wave_active_bit_xor_s64x2"
+	"wave_active_bit_xor_u8x2"
+	"wave_active_bit_xor_u16x2"
+	"wave_active_bit_xor_u32x2"
+	"wave_active_bit_xor_u64x2"
+	"wave_active_bit_xor_s8x3"
+	"wave_active_bit_xor_s16x3"
+	"wave_active_bit_xor_s32x3"
+	"wave_active_bit_xor_s64x3"
+	"wave_active_bit_xor_u8x3"
+	"wave_active_bit_xor_u16x3"
+	"wave_active_bit_xor_u32x3"
+	"wave_active_bit_xor_u64x3"
+	"wave_active_bit_xor_s8x4"
+	"wave_active_bit_xor_s16x4"
+	"wave_active_bit_xor_s32x4"
+	"wave_active_bit_xor_s64x4"
+	"wave_active_bit_xor_u8x4"
+	"wave_active_bit_xor_u16x4"
+	"wave_active_bit_xor_u32x4"
+	"wave_active_bit_xor_u64x4"
+	"atomic_load_s8"
+	"atomic_load_s16"
+	"atomic_load_s32"
+	"atomic_load_s64"
+	"atomic_load_u8"
+	"atomic_load_u16"
+	"atomic_load_u32"
+	"atomic_load_u64"
+	"atomic_load_f16"
+	"atomic_load_f32"
+	"atomic_load_f64"
+	"atomic_load_s8x2"
+	"atomic_load_s16x2",
+	"atomic_load_s32x2"
+	"atomic_load_s64x2"
+	"atomic_load_u8x2"
+	"atomic_load_u16x2"
+	"atomic_load_u32x2"
+	"atomic_load_u64x2"
+	"atomic_load_f16x2"
+	"atomic_load_f32x2"
+	"atomic_load_f64x2"
+	"atomic_load_s8x3"
+	"atomic_load_s16x3"
+	"atomic_load_s32x3"
+	"atomic_load_s64x3"
+	"atomic_load_u8x3"
+	"atomic_load_u16x3"
+	"atomic_load_u32x3"
+	"atomic_load_u64x3"
+	"atomic_load_f16x3"
+	"atomic_load_f32x3"
+	"atomic_load_f64x3"
+	"atomic_load_s8x4"
+	"atomic_load_s16x4"
+	"atomic_load_s32x4"
+	"atomic_load_s64x4"
+	"atomic_load_u8x4"
+	"atomic_load_u16x4"
+	"atomic_load_u32x4"
+	"atomic_load_u64x4"
+	"atomic_load_f16x4"
+	"atomic_load_f32x4"
+	"atomic_load_f64x4"
+	"atomic_store_s8"
+	"atomic_store_s16"
+	"atomic_store_s32"
+	"atomic_store_s64"
+	"atomic_store_u8"
+	"atomic_store_u16"
+	"atomic_store_u32"
+	"atomic_store_u64"
+	"atomic_store_f16"
+	"atomic_store_f32"
+	"atomic_store_f64"
+	"atomic_store_s8x2"
+	"atomic_store_s16x2"
+	"atomic_store_s32x2"
+	"atomic_store_s64x2"
+	"atomic_store_u8x2"
+	"atomic_store_u16x2"
+	"atomic_store_u32x2"
+	"atomic_store_u64x2"
+	"atomic_store_f16x2"
+	"atomic_store_f32x2"
+	"atomic_store_f64x2"
+	"atomic_store_s8x3"
+	"atomic_store_s16x3"
+	"atomic_store_s32x3"
+	"atomic_store_s64x3"
+	"atomic_store_u8x3"
+	"atomic_store_u16x3"
+	"atomic_store_u32x3"
+	"atomic_store_u64x3"
+	"atomic_store_f16x3"
+	"atomic_store_f32x3"
+	"atomic_store_f64x3"
+	"atomic_store_s8x4"
+	"atomic_store_s16x4"
+	"atomic_store_s32x4"
+	"atomic_store_s64x4"
+	"atomic_store_u8x4"
+	"atomic_store_u16x4"
+	"atomic_store_u32x4"
+	"atomic_store_u64x4"
+	"atomic_store_f16x4"
+	"atomic_store_f32x4"
+	"atomic_store_f64x4"
+	"atomic_exchange_s8"
+	"atomic_exchange_s16"
+	"atomic_exchange_s32"
+	"atomic_exchange_s64"
+	"atomic_exchange_u8"
+	"atomic_exchange_u16"
+	"atomic_exchange_u32"
+	"atomic_exchange_u64"
+	"atomic_exchange_f16"
+	"atomic_exchange_f32"
+	"atomic_exchange_f64"
+	"atomic_exchange_s8x2"
+	"atomic_exchange_s16x2"
+	"atomic_exchange_s32x2"
+	"atomic_exchange_s64x2"
+	"atomic_exchange_u8x2"
+	"atomic_exchange_u16x2"
+	"atomic_exchange_u32x2"
+	"atomic_exchange_u64x2"
+	"atomic_exchange_f16x2"
+	"atomic_exchange_f32x2"
+	"atomic_exchange_f64x2"
+	"atomic_exchange_s8x3"
+	"atomic_exchange_s16x3"
+	"atomic_exchange_s32x3"
+	"atomic_exchange_s64x3"
+	"atomic_exchange_u8x3"
+	"atomic_exchange_u16x3"
+	"atomic_exchange_u32x3"
+	"atomic_exchange_u64x3"
+	"atomic_exchange_f16x3"
+	"atomic_exchange_f32x3"
+	"atomic_exchange_f64x3"
+	"atomic_exchange_s8x4"
+	"atomic_exchange_s16x4"
+	"atomic_exchange_s32x4"
+	"atomic_exchange_s64x4"
+	"atomic_exchange_u8x4"
+	"atomic_exchange_u16x4"
+	"atomic_exchange_u32x4"
+	"atomic_exchange_u64x4"
+	"atomic_exchange_f16x4"
+	"atomic_exchange_f32x4"
+	"atomic_exchange_f64x4"
+	"atomic_compare_exchange_s8"
+	"atomic_compare_exchange_s16"
+	"atomic_compare_exchange_s32"
+	"atomic_compare_exchange_s64"
+	"atomic_compare_exchange_u8"
+	"atomic_compare_exchange_u16"
+	"atomic_compare_exchange_u32"
+	"atomic_compare_exchange_u64"
+	"atomic_compare_exchange_s8x2"
+	"atomic_compare_exchange_s16x2"
+	"atomic_compare_exchange_s32x2"
+	"atomic_compare_exchange_s64x2"
+	"atomic_compare_exchange_u8x2"
+	"atomic_compare_exchange_u16x2"
+	"atomic_compare_exchange_u32x2"
+	"atomic_compare_exchange_u64x2"
+	"atomic_compare_exchange_s8x3"
+	"atomic_compare_exchange_s16x3"
+	"atomic_compare_exchange_s32x3"
+	"atomic_compare_exchange_s64x3"
+	"atomic_compare_exchange_u8x3"
+	"atomic_compare_exchange_u16x3"
+	"atomic_compare_exchange_u32x3"
+	"atomic_compare_exchange_u64x3"
+	"atomic_compare_exchange_s8x4"
+	"atomic_compare_exchange_s16x4"
+	"atomic_compare_exchange_s32x4"
+	"atomic_compare_exchange_s64x4"
+	"atomic_compare_exchange_u8x4"
+	"atomic_compare_exchange_u16x4"
+	"atomic_compare_exchange_u32x4"
+	"atomic_compare_exchange_u64x4"
+	"atomic_add_s8"
+	"atomic_add_s16"
+	"atomic_add_s32"
+	"atomic_add_s64"
+	"atomic_add_u8"
+	"atomic_add_u16"
+	"atomic_add_u32"
+	"atomic_add_u64"
+	"atomic_add_s8x2"
+	"atomic_add_s16x2"
+	"atomic_add_s32x2"
+	"atomic_add_s64x2"
+	"atomic_add_u8x2"
+	"atomic_add_u16x2"
+	"atomic_add_u32x2"
+	"atomic_add_u64x2"
+	"atomic_add_s8x3"
+	"atomic_add_s16x3"
+	"atomic_add_s32x3"
+	"atomic_add_s64x3"
+	"atomic_add_u8x3"
+	"atomic_add_u16x3"
+	"atomic_add_u32x3"
+	"atomic_add_u64x3"
+	"atomic_add_s8x4"
+	"atomic_add_s16x4"
+	"atomic_add_s32x4"
+	"atomic_add_s64x4"
+	"atomic_add_u8x4"
+	"atomic_add_u16x4"
+	"atomic_add_u32x4"
+	"atomic_add_u64x4"
+	"atomic_sub_s8"
+	"atomic_sub_s16"
+	"atomic_sub_s32"
+	"atomic_sub_s64"
+	"atomic_sub_u8"
+	"atomic_sub_u16"
+	"atomic_sub_u32"
+	"atomic_sub_u64"
+	"atomic_sub_s8x2"
+	"atomic_sub_s16x2"
+	"atomic_sub_s32x2"
+	"atomic_sub_s64x2"
+	"atomic_sub_u8x2"
+	"atomic_sub_u16x2"
+	"atomic_sub_u32x2"
+	"atomic_sub_u64x2"
+	"atomic_sub_s8x3"
+	"atomic_sub_s16x3"
+	"atomic_sub_s32x3"
+	"atomic_sub_s64x3"
+	"atomic_sub_u8x3"
+	"atomic_sub_u16x3"
+	"atomic_sub_u32x3"
+	"atomic_sub_u64x3"
+	"atomic_sub_s8x4"
+	"atomic_sub_s16x4"
+	"atomic_sub_s32x4"
+	"atomic_sub_s64x4"
+	"atomic_sub_u8x4"
+	"atomic_sub_u16x4"
+	"atomic_sub_u32x4"
+	"atomic_sub_u64x4"
+	"atomic_min_s8"
+	"atomic_min_s16",
+	"atomic_min_s32"
+	"atomic_min_s64"
+	"atomic_min_u8"
+	"atomic_min_u16"
+	"atomic_min_u32"
+	"atomic_min_u64"
+	"atomic_min_s8x2"
+	"atomic_min_s16x2"
+	"atomic_min_s32x2"
+	"atomic_min_s64x2"
+	"atomic_min_u8x2"
+	"atomic_min_u16x2"
+	"atomic_min_u32x2"
+	"atomic_min_u64x2"
+	"atomic_min_s8x3"
+	"atomic_min_s16x3"
+	"atomic_min_s32x3"
+	"atomic_min_s64x3"
+	"atomic_min_u8x3"
+	"atomic_min_u16x3"
+	"atomic_min_u32x3"
+	"atomic_min_u64x3"
+	"atomic_min_s8x4"
+	"atomic_min_s16x4"
+	"atomic_min_s32x4"
+	"atomic_min_s64x4"
+	"atomic_min_u8x4"
+	"atomic_min_u16x4"
+	"atomic_min_u32x4"
+	"atomic_min_u64x4"
+	"atomic_max_s8"
+	"atomic_max_s16"
+	"atomic_max_s32"
+	"atomic_max_s64"
+	"atomic_max_u8"
+	"atomic_max_u16"
+	"atomic_max_u32"
+	"atomic_max_u64"
+	"atomic_max_s8x2"
+	"atomic_max_s16x2"
+	"atomic_max_s32x2"
+	"atomic_max_s64x2"
+	"atomic_max_u8x2"
+	"atomic_max_u16x2"
+	"atomic_max_u32x2"
+	"atomic_max_u64x2"
+	"atomic_max_s8x3"
+	"atomic_max_s16x3"
+	"atomic_max_s32x3"
+	"atomic_max_s64x3"
+	"atomic_max_u8x3"
+	"atomic_max_u16x3"
+	"atomic_max_u32x3"
+	"atomic_max_u64x3"
+	"atomic_max_s8x4"
+	"atomic_max_s16x4"
+	"atomic_max_s32x4"
+	"atomic_max_s64x4"
+	"atomic_max_u8x4"
+	"atomic_max_u16x4"
+	"atomic_max_u32x4"
+	"atomic_max_u64x4"
+	"atomic_bit_and_s8"
+	"atomic_bit_and_s16"
+	"atomic_bit_and_s32"
+	"atomic_bit_and_s64"
+	"atomic_bit_and_u8"
+	"atomic_bit_and_u16"
+	"atomic_bit_and_u32"
+	"atomic_bit_and_u64"
+	"atomic_bit_and_s8x2"
+	"atomic_bit_and_s16x2"
+	"atomic_bit_and_s32x2"
+	"atomic_bit_and_s64x2"
+	"atomic_bit_and_u8x2"
+	"atomic_bit_and_u16x2"
+	"atomic_bit_and_u32x2"
+	"atomic_bit_and_u64x2"
+	"atomic_bit_and_s8x3"
+	"atomic_bit_and_s16x3"
+	"atomic_bit_and_s32x3"
+	"atomic_bit_and_s64x3"
+	"atomic_bit_and_u8x3"
+	"atomic_bit_and_u16x3"
+	"atomic_bit_and_u32x3"
+	"atomic_bit_and_u64x3"
+	"atomic_bit_and_s8x4"
+	"atomic_bit_and_s16x4"
+	"atomic_bit_and_s32x4"
+	"atomic_bit_and_s64x4"
+	"atomic_bit_and_u8x4"
+	"atomic_bit_and_u16x4"
+	"atomic_bit_and_u32x4"
+	"atomic_bit_and_u64x4"
+	"atomic_bit_or_s8"
+	"atomic_bit_or_s16"
+	"atomic_bit_or_s32"
+	"atomic_bit_or_s64"
+	"atomic_bit_or_u8"
+	"atomic_bit_or_u16"
+	"atomic_bit_or_u32"
+	"atomic_bit_or_u64"
+	"atomic_bit_or_s8x2"
+	"atomic_bit_or_s16x2"
+	"atomic_bit_or_s32x2"
+	"atomic_bit_or_s64x2"
+	"atomic_bit_or_u8x2"
+	"atomic_bit_or_u16x2"
+	"atomic_bit_or_u32x2"
+	"atomic_bit_or_u64x2"
+	"atomic_bit_or_s8x3"
+	"atomic_bit_or_s16x3"
+	"atomic_bit_or_s32x3"
+	"atomic_bit_or_s64x3"
+	"atomic_bit_or_u8x3"
+	"atomic_bit_or_u16x3"
+	"atomic_bit_or_u32x3"
+	"atomic_bit_or_u64x3"
+	"atomic_bit_or_s8x4"
+	"atomic_bit_or_s16x4"
+	"atomic_bit_or_s32x4"
+	"atomic_bit_or_s64x4"
+	"atomic_bit_or_u8x4"
+	"atomic_bit_or_u16x4"
+	"atomic_bit_or_u32x4"
+	"atomic_bit_or_u64x4"
+	"atomic_bit_xor_s8"
+	"atomic_bit_xor_s16"
+	"atomic_bit_xor_s32"
+	"atomic_bit_xor_s64"
+	"atomic_bit_xor_u8"
+	"atomic_bit_xor_u16"
+	"atomic_bit_xor_u32"
+	"atomic_bit_xor_u64"
+	"atomic_bit_xor_s8x2"
+	"atomic_bit_xor_s16x2"
+	"atomic_bit_xor_s32x2"
+	"atomic_bit_xor_s64x2"
+	"atomic_bit_xor_u8x2"
+	"atomic_bit_xor_u16x2"
+	"atomic_bit_xor_u32x2"
+	"atomic_bit_xor_u64x2"
+	"atomic_bit_xor_s8x3"
+	"atomic_bit_xor_s16x3"
+	"atomic_bit_xor_s32x3"
+	"atomic_bit_xor_s64x3"
+	"atomic_bit_xor_u8x3"
+	"atomic_bit_xor_u16x3"
+	"atomic_bit_xor_u32x3"
+	"atomic_bit_xor_u64x3"
+	"atomic_bit_xor_s8x4"
+	"atomic_bit_xor_s16x4"
+	"atomic_bit_xor_s32x4"
+	"atomic_bit_xor_s64x4"
+	"atomic_bit_xor_u8x4"
+	"atomic_bit_xor_u16x4"
+	"atomic_bit_xor_u32x4"
+	"atomic_bit_xor_u64x4"
+	"load_texture_1d_fmt_8_8_8_8_unorm"
+	"load_texture_1d_fmt_8_8_8_8_snorm"
+	"load_texture_1d_fmt_8_8_8_8_uint"
+	"load_texture_1d_fmt_8_8_8_8_sint"
+	"load_texture_1d_fmt_8_8_unorm"
+	"load_texture_1d_fmt_8_8_snorm"
+	"load_texture_1d_fmt_8_8_uint"
+	"load_texture_1d_fmt_8_8_sint"
+	"load_texture_1d_fmt_8_unorm"
+	"load_texture_1d_fmt_8_snorm"
+	"load_texture_1d_fmt_8_uint"
+	"load_texture_1d_fmt_8_sint"
+	"load_texture_1d_fmt_16_16_16_16_float"
+	"load_texture_1d_fmt_16_16_16_16_unorm"
+	"load_texture_1d_fmt_16_16_16_16_snorm"
+	"load_texture_1d_fmt_16_16_16_16_uint"
+	"load_texture_1d_fmt_16_16_16_16_sint"
+	"load_texture_1d_fmt_16_16_float"
+	"load_texture_1d_fmt_16_16_unorm"
+	"load_texture_1d_fmt_16_16_snorm"
+	"load_texture_1d_fmt_16_16_uint"
+	"load_texture_1d_fmt_16_16_sint"
+	"load_texture_1d_fmt_16_float"
+	"load_texture_1d_fmt_16_unorm"
+	"load_texture_1d_fmt_16_snorm"
+	"load_texture_1d_fmt_16_uint"
+	"load_texture_1d_fmt_16_sint"
+	"load_texture_1d_fmt_32_32_32_32_float"
+	"load_texture_1d_fmt_32_32_32_32_uint"
+	"load_texture_1d_fmt_32_32_32_32_sint"
+	"load_texture_1d_fmt_32_32_float"
+	"load_texture_1d_fmt_32_32_uint"
+	"load_texture_1d_fmt_32_32_sint"
+	"load_texture_1d_fmt_32_float"
+	"load_texture_1d_fmt_32_uint"
+	"load_texture_1d_fmt_32_sint"
+	"load_texture_1d_fmt_64_uint"
+	"load_texture_1d_fmt_64_sint"
+	"load_texture_1d_fmt_11_11_10_float"
+	"load_texture_1d_fmt_10_10_10_2_unorm"
+	"load_texture_1d_fmt_10_10_10_2_uint"
+	"load_texture_1d_array_fmt_8_8_8_8_unorm",
+	"load_texture_1d_array_fmt_8_8_8_8_snorm"
+	"load_texture_1d_array_fmt_8_8_8_8_uint"
+	"load_texture_1d_array_fmt_8_8_8_8_sint"
+	"load_texture_1d_array_fmt_8_8_unorm"
+	"load_texture_1d_array_fmt_8_8_snorm"
+	"load_texture_1d_array_fmt_8_8_uint"
+	"load_texture_1d_array_fmt_8_8_sint"
+	"load_texture_1d_array_fmt_8_unorm"
+	"load_texture_1d_array_fmt_8_snorm"
+	"load_texture_1d_array_fmt_8_uint"
+	"load_texture_1d_array_fmt_8_sint"
+	"load_texture_1d_array_fmt_16_16_16_16_float"
+	"load_texture_1d_array_fmt_16_16_16_16_unorm"
+	"load_texture_1d_array_fmt_16_16_16_16_snorm"
+	"load_texture_1d_array_fmt_16_16_16_16_uint"
+	"load_texture_1d_array_fmt_16_16_16_16_sint"
+	"load_texture_1d_array_fmt_16_16_float"
+	"load_texture_1d_array_fmt_16_16_unorm"
+	"load_texture_1d_array_fmt_16_16_snorm"
+	"load_texture_1d_array_fmt_16_16_uint"
+	"load_texture_1d_array_fmt_16_16_sint"
+	"load_texture_1d_array_fmt_16_float"
+	"load_texture_1d_array_fmt_16_unorm"
+	"load_texture_1d_array_fmt_16_snorm"
+	"load_texture_1d_array_fmt_16_uint"
+	"load_texture_1d_array_fmt_16_sint"
+	"load_texture_1d_array_fmt_32_32_32_32_float"
+	"load_texture_1d_array_fmt_32_32_32_32_uint"
+	"load_texture_1d_array_fmt_32_32_32_32_sint"
+	"load_texture_1d_array_fmt_32_32_float"
+	"load_texture_1d_array_fmt_32_32_uint"
+	"load_texture_1d_array_fmt_32_32_sint"
+	"load_texture_1d_array_fmt_32_float"
+	"load_texture_1d_array_fmt_32_uint"
+	"load_texture_1d_array_fmt_32_sint"
+	"load_texture_1d_array_fmt_64_uint"
+	"load_texture_1d_array_fmt_64_sint"
+	"load_texture_1d_array_fmt_11_11_10_float"
+	"load_texture_1d_array_fmt_10_10_10_2_unorm"
+	"load_texture_1d_array_fmt_10_10_10_2_uint"
+	"load_texture_1d_ms_fmt_8_8_8_8_unorm"
+	"load_texture_1d_ms_fmt_8_8_8_8_snorm"
+	"load_texture_1d_ms_fmt_8_8_8_8_uint"
+	"load_texture_1d_ms_fmt_8_8_8_8_sint"
+	"load_texture_1d_ms_fmt_8_8_unorm"
+	"load_texture_1d_ms_fmt_8_8_snorm"
+	"load_texture_1d_ms_fmt_8_8_uint"
+	"load_texture_1d_ms_fmt_8_8_sint"
+	"load_texture_1d_ms_fmt_8_unorm"
+	"load_texture_1d_ms_fmt_8_snorm"
+	"load_texture_1d_ms_fmt_8_uint"
+	"load_texture_1d_ms_fmt_8_sint"
+	"load_texture_1d_ms_fmt_16_16_16_16_float"
+	"load_texture_1d_ms_fmt_16_16_16_16_unorm"
+	"load_texture_1d_ms_fmt_16_16_16_16_snorm"
+	"load_texture_1d_ms_fmt_16_16_16_16_uint"
+	"load_texture_1d_ms_fmt_16_16_16_16_sint"
+	"load_texture_1d_ms_fmt_16_16_float"
+	"load_texture_1d_ms_fmt_16_16_unorm"
+	"load_texture_1d_ms_fmt_16_16_snorm"
+	"load_texture_1d_ms_fmt_16_16_uint"
+	"load_texture_1d_ms_fmt_16_16_sint"
+	"load_texture_1d_ms_fmt_16_float"
+	"load_texture_1d_ms_fmt_16_unorm"
+	"load_texture_1d_ms_fmt_16_snorm"
+	"load_texture_1d_ms_fmt_16_uint"
+	"load_texture_1d_ms_fmt_16_sint"
+	"load_texture_1d_ms_fmt_32_32_32_32_float"
+	"load_texture_1d_ms_fmt_32_32_32_32_uint"
+	"load_texture_1d_ms_fmt_32_32_32_32_sint"
+	"load_texture_1d_ms_fmt_32_32_float"
+	"load_texture_1d_ms_fmt_32_32_uint"
+	"load_texture_1d_ms_fmt_32_32_sint"
+	"load_texture_1d_ms_fmt_32_float"
+	"load_texture_1d_ms_fmt_32_uint"
+	"load_texture_1d_ms_fmt_32_sint"
+	"load_texture_1d_ms_fmt_64_uint"
+	"load_texture_1d_ms_fmt_64_sint"
+	"load_texture_1d_ms_fmt_11_11_10_float"
+	"load_texture_1d_ms_fmt_10_10_10_2_unorm"
+	"load_texture_1d_ms_fmt_10_10_10_2_uint"
+	"load_texture_1d_ms_array_fmt_8_8_8_8_unorm"
+	"load_texture_1d_ms_array_fmt_8_8_8_8_snorm"
+	"load_texture_1d_ms_array_fmt_8_8_8_8_uint"
+	"load_texture_1d_ms_array_fmt_8_8_8_8_sint"
+	"load_texture_1d_ms_array_fmt_8_8_unorm"
+	"load_texture_1d_ms_array_fmt_8_8_snorm"
+	"load_texture_1d_ms_array_fmt_8_8_uint"
+	"load_texture_1d_ms_array_fmt_8_8_sint"
+	"load_texture_1d_ms_array_fmt_8_unorm"
+	"load_texture_1d_ms_array_fmt_8_snorm"
+	"load_texture_1d_ms_array_fmt_8_uint"
+	"load_texture_1d_ms_array_fmt_8_sint"
+	"load_texture_1d_ms_array_fmt_16_16_16_16_float"
+	"load_texture_1d_ms_array_fmt_16_16_16_16_unorm"
+	"load_texture_1d_ms_array_fmt_16_16_16_16_snorm"
+	"load_texture_1d_ms_array_fmt_16_16_16_16_uint"
+	"load_texture_1d_ms_array_fmt_16_16_16_16_sint"
+	"load_texture_1d_ms_array_fmt_16_16_float"
+	"load_texture_1d_ms_array_fmt_16_16_unorm"
+	"load_texture_1d_ms_array_fmt_16_16_snorm"
+	"load_texture_1d_ms_array_fmt_16_16_uint"
+	"load_texture_1d_ms_array_fmt_16_16_sint"
+	"load_texture_1d_ms_array_fmt_16_float"
+	"load_texture_1d_ms_array_fmt_16_unorm"
+	"load_texture_1d_ms_array_fmt_16_snorm"
+	"load_texture_1d_ms_array_fmt_16_uint"
+	"load_texture_1d_ms_array_fmt_16_sint"
+	"load_texture_1d_ms_array_fmt_32_32_32_32_float"
+	"load_texture_1d_ms_array_fmt_32_32_32_32_uint"
+	"load_texture_1d_ms_array_fmt_32_32_32_32_sint",
+	"load_texture_1d_ms_array_fmt_32_32_float"
+	"load_texture_1d_ms_array_fmt_32_32_uint"
+	"load_texture_1d_ms_array_fmt_32_32_sint"
+	"load_texture_1d_ms_array_fmt_32_float"
+	"load_texture_1d_ms_array_fmt_32_uint"
+	"load_texture_1d_ms_array_fmt_32_sint"
+	"load_texture_1d_ms_array_fmt_64_uint"
+	"load_texture_1d_ms_array_fmt_64_sint"
+	"load_texture_1d_ms_array_fmt_11_11_10_float"
+	"load_texture_1d_ms_array_fmt_10_10_10_2_unorm"
+	"load_texture_1d_ms_array_fmt_10_10_10_2_uint"
+	"load_texture_2d_fmt_8_8_8_8_unorm"
+	"load_texture_2d_fmt_8_8_8_8_snorm"
+	"load_texture_2d_fmt_8_8_8_8_uint"
+	"load_texture_2d_fmt_8_8_8_8_sint"
+	"load_texture_2d_fmt_8_8_unorm"
+	"load_texture_2d_fmt_8_8_snorm"
+	"load_texture_2d_fmt_8_8_uint"
+	"load_texture_2d_fmt_8_8_sint"
+	"load_texture_2d_fmt_8_unorm"
+	"load_texture_2d_fmt_8_snorm"
+	"load_texture_2d_fmt_8_uint"
+	"load_texture_2d_fmt_8_sint"
+	"load_texture_2d_fmt_16_16_16_16_float"
+	"load_texture_2d_fmt_16_16_16_16_unorm"
+	"load_texture_2d_fmt_16_16_16_16_snorm"
+	"load_texture_2d_fmt_16_16_16_16_uint"
+	"load_texture_2d_fmt_16_16_16_16_sint"
+	"load_texture_2d_fmt_16_16_float"
+	"load_texture_2d_fmt_16_16_unorm"
+	"load_texture_2d_fmt_16_16_snorm"
+	"load_texture_2d_fmt_16_16_uint"
+	"load_texture_2d_fmt_16_16_sint"
+	"load_texture_2d_fmt_16_float"
+	"load_texture_2d_fmt_16_unorm"
+	"load_texture_2d_fmt_16_snorm"
+	"load_texture_2d_fmt_16_uint"
+	"load_texture_2d_fmt_16_sint"
+	"load_texture_2d_fmt_32_32_32_32_float"
+	"load_texture_2d_fmt_32_32_32_32_uint"
+	"load_texture_2d_fmt_32_32_32_32_sint"
+	"load_texture_2d_fmt_32_32_float"
+	"load_texture_2d_fmt_32_32_uint"
+	"load_texture_2d_fmt_32_32_sint"
+	"load_texture_2d_fmt_32_float"
+	"load_texture_2d_fmt_32_uint"
+	"load_texture_2d_fmt_32_sint"
+	"load_texture_2d_fmt_64_uint"
+	"load_texture_2d_fmt_64_sint"
+	"load_texture_2d_fmt_11_11_10_float"
+	"load_texture_2d_fmt_10_10_10_2_unorm"
+	"load_texture_2d_fmt_10_10_10_2_uint"
+	"load_texture_2d_array_fmt_8_8_8_8_unorm"
+	"load_texture_2d_array_fmt_8_8_8_8_snorm"
+	"load_texture_2d_array_fmt_8_8_8_8_uint"
+	"load_texture_2d_array_fmt_8_8_8_8_sint"
+	"load_texture_2d_array_fmt_8_8_unorm"
+	"load_texture_2d_array_fmt_8_8_snorm"
+	"load_texture_2d_array_fmt_8_8_uint"
+	"load_texture_2d_array_fmt_8_8_sint"
+	"load_texture_2d_array_fmt_8_unorm"
+	"load_texture_2d_array_fmt_8_snorm"
+	"load_texture_2d_array_fmt_8_uint"
+	"load_texture_2d_array_fmt_8_sint"
+	"load_texture_2d_array_fmt_16_16_16_16_float"
+	"load_texture_2d_array_fmt_16_16_16_16_unorm"
+	"load_texture_2d_array_fmt_16_16_16_16_snorm"
+	"load_texture_2d_array_fmt_16_16_16_16_uint"
+	"load_texture_2d_array_fmt_16_16_16_16_sint"
+	"load_texture_2d_array_fmt_16_16_float"
+	"load_texture_2d_array_fmt_16_16_unorm"
+	"load_texture_2d_array_fmt_16_16_snorm"
+	"load_texture_2d_array_fmt_16_16_uint"
+	"load_texture_2d_array_fmt_16_16_sint"
+	"load_texture_2d_array_fmt_16_float"
+	"load_texture_2d_array_fmt_16_unorm"
+	"load_texture_2d_array_fmt_16_snorm"
+	"load_texture_2d_array_fmt_16_uint"
+	"load_texture_2d_array_fmt_16_sint"
+	"load_texture_2d_array_fmt_32_32_32_32_float"
+	"load_texture_2d_array_fmt_32_32_32_32_uint"
+	"load_texture_2d_array_fmt_32_32_32_32_sint"
+	"load_texture_2d_array_fmt_32_32_float"
+	"load_texture_2d_array_fmt_32_32_uint"
+	"load_texture_2d_array_fmt_32_32_sint"
+	"load_texture_2d_array_fmt_32_float"
+	"load_texture_2d_array_fmt_32_uint"
+	"load_texture_2d_array_fmt_32_sint"
+	"load_texture_2d_array_fmt_64_uint"
+	"load_texture_2d_array_fmt_64_sint"
+	"load_texture_2d_array_fmt_11_11_10_float"
+	"load_texture_2d_array_fmt_10_10_10_2_unorm"
+	"load_texture_2d_array_fmt_10_10_10_2_uint"
+	"load_texture_2d_ms_fmt_8_8_8_8_unorm"
+	"load_texture_2d_ms_fmt_8_8_8_8_snorm"
+	"load_texture_2d_ms_fmt_8_8_8_8_uint"
+	"load_texture_2d_ms_fmt_8_8_8_8_sint"
+	"load_texture_2d_ms_fmt_8_8_unorm"
+	"load_texture_2d_ms_fmt_8_8_snorm"
+	"load_texture_2d_ms_fmt_8_8_uint"
+	"load_texture_2d_ms_fmt_8_8_sint"
+	"load_texture_2d_ms_fmt_8_unorm"
+	"load_texture_2d_ms_fmt_8_snorm"
+	"load_texture_2d_ms_fmt_8_uint"
+	"load_texture_2d_ms_fmt_8_sint"
+	"load_texture_2d_ms_fmt_16_16_16_16_float"
+	"load_texture_2d_ms_fmt_16_16_16_16_unorm"
+	"load_texture_2d_ms_fmt_16_16_16_16_snorm"
+	"load_texture_2d_ms_fmt_16_16_16_16_uint"
+	"load_texture_2d_ms_fmt_16_16_16_16_sint"
+	"load_texture_2d_ms_fmt_16_16_float"
+	"load_texture_2d_ms_fmt_16_16_unorm"
+	"load_texture_2d_ms_fmt_16_16_snorm"
+	"load_texture_2d_ms_fmt_16_16_uint"
+	"load_texture_2d_ms_fmt_16_16_sint"
+	"load_texture_2d_ms_fmt_16_float"
+	"load_texture_2d_ms_fmt_16_unorm"
+	"load_texture_2d_ms_fmt_16_snorm"
+	"load_texture_2d_ms_fmt_16_uint",
+	"load_texture_2d_ms_fmt_16_sint"
+	"load_texture_2d_ms_fmt_32_32_32_32_float"
+	"load_texture_2d_ms_fmt_32_32_32_32_uint"
+	"load_texture_2d_ms_fmt_32_32_32_32_sint"
+	"load_texture_2d_ms_fmt_32_32_float"
+	"load_texture_2d_ms_fmt_32_32_uint"
+	"load_texture_2d_ms_fmt_32_32_sint"
+	"load_texture_2d_ms_fmt_32_float"
+	"load_texture_2d_ms_fmt_32_uint"
+	"load_texture_2d_ms_fmt_32_sint"
+	"load_texture_2d_ms_fmt_64_uint"
+	"load_texture_2d_ms_fmt_64_sint"
+	"load_texture_2d_ms_fmt_11_11_10_float"
+	"load_texture_2d_ms_fmt_10_10_10_2_unorm"
+	"load_texture_2d_ms_fmt_10_10_10_2_uint"
+	"load_texture_2d_ms_array_fmt_8_8_8_8_unorm"
+	"load_texture_2d_ms_array_fmt_8_8_8_8_snorm"
+	"load_texture_2d_ms_array_fmt_8_8_8_8_uint"
+	"load_texture_2d_ms_array_fmt_8_8_8_8_sint"
+	"load_texture_2d_ms_array_fmt_8_8_unorm"
+	"load_texture_2d_ms_array_fmt_8_8_snorm"
+	"load_texture_2d_ms_array_fmt_8_8_uint"
+	"load_texture_2d_ms_array_fmt_8_8_sint"
+	"load_texture_2d_ms_array_fmt_8_unorm"
+	"load_texture_2d_ms_array_fmt_8_snorm"
+	"load_texture_2d_ms_array_fmt_8_uint"
+	"load_texture_2d_ms_array_fmt_8_sint"
+	"load_texture_2d_ms_array_fmt_16_16_16_16_float"
+	"load_texture_2d_ms_array_fmt_16_16_16_16_unorm"
+	"load_texture_2d_ms_array_fmt_16_16_16_16_snorm"
+	"load_texture_2d_ms_array_fmt_16_16_16_16_uint"
+	"load_texture_2d_ms_array_fmt_16_16_16_16_sint"
+	"load_texture_2d_ms_array_fmt_16_16_float"
+	"load_texture_2d_ms_array_fmt_16_16_unorm"
+	"load_texture_2d_ms_array_fmt_16_16_snorm"
+	"load_texture_2d_ms_array_fmt_16_16_uint"
+	"load_texture_2d_ms_array_fmt_16_16_sint"
+	"load_texture_2d_ms_array_fmt_16_float"
+	"load_texture_2d_ms_array_fmt_16_unorm"
+	"load_texture_2d_ms_array_fmt_16_snorm"
+	"load_texture_2d_ms_array_fmt_16_uint"
+	"load_texture_2d_ms_array_fmt_16_sint"
+	"load_texture_2d_ms_array_fmt_32_32_32_32_float"
+	"load_texture_2d_ms_array_fmt_32_32_32_32_uint"
+	"load_texture_2d_ms_array_fmt_32_32_32_32_sint"
+	"load_texture_2d_ms_array_fmt_32_32_float"
+	"load_texture_2d_ms_array_fmt_32_32_uint"
+	"load_texture_2d_ms_array_fmt_32_32_sint"
+	"load_texture_2d_ms_array_fmt_32_float"
+	"load_texture_2d_ms_array_fmt_32_uint"
+	"load_texture_2d_ms_array_fmt_32_sint"
+	"load_texture_2d_ms_array_fmt_64_uint"
+	"load_texture_2d_ms_array_fmt_64_sint"
+	"load_texture_2d_ms_array_fmt_11_11_10_float"
+	"load_texture_2d_ms_array_fmt_10_10_10_2_unorm"
+	"load_texture_2d_ms_array_fmt_10_10_10_2_uint"
+	"load_texture_3d_fmt_8_8_8_8_unorm"
+	"load_texture_3d_fmt_8_8_8_8_snorm"
+	"load_texture_3d_fmt_8_8_8_8_uint"
+	"load_texture_3d_fmt_8_8_8_8_sint"
+	"load_texture_3d_fmt_8_8_unorm"
+	"load_texture_3d_fmt_8_8_snorm"
+	"load_texture_3d_fmt_8_8_uint"
+	"load_texture_3d_fmt_8_8_sint"
+	"load_texture_3d_fmt_8_unorm"
+	"load_texture_3d_fmt_8_snorm"
+	"load_texture_3d_fmt_8_uint"
+	"load_texture_3d_fmt_8_sint"
+	"load_texture_3d_fmt_16_16_16_16_float"
+	"load_texture_3d_fmt_16_16_16_16_unorm"
+	"load_texture_3d_fmt_16_16_16_16_snorm"
+	"load_texture_3d_fmt_16_16_16_16_uint"
+	"load_texture_3d_fmt_16_16_16_16_sint"
+	"load_texture_3d_fmt_16_16_float"
+	"load_texture_3d_fmt_16_16_unorm"
+	"load_texture_3d_fmt_16_16_snorm"
+	"load_texture_3d_fmt_16_16_uint"
+	"load_texture_3d_fmt_16_16_sint"
+	"load_texture_3d_fmt_16_float"
+	"load_texture_3d_fmt_16_unorm"
+	"load_texture_3d_fmt_16_snorm"
+	"load_texture_3d_fmt_16_uint"
+	"load_texture_3d_fmt_16_sint"
+	"load_texture_3d_fmt_32_32_32_32_float"
+	"load_texture_3d_fmt_32_32_32_32_uint"
+	"load_texture_3d_fmt_32_32_32_32_sint"
+	"load_texture_3d_fmt_32_32_float"
+	"load_texture_3d_fmt_32_32_uint"
+	"load_texture_3d_fmt_32_32_sint"
+	"load_texture_3d_fmt_32_float"
+	"load_texture_3d_fmt_32_uint"
+	"load_texture_3d_fmt_32_sint"
+	"load_texture_3d_fmt_64_uint"
+	"load_texture_3d_fmt_64_sint"
+	"load_texture_3d_fmt_11_11_10_float"
+	"load_texture_3d_fmt_10_10_10_2_unorm"
+	"load_texture_3d_fmt_10_10_10_2_uint"
+	"load_texture_3d_array_fmt_8_8_8_8_unorm"
+	"load_texture_3d_array_fmt_8_8_8_8_snorm"
+	"load_texture_3d_array_fmt_8_8_8_8_uint"
+	"load_texture_3d_array_fmt_8_8_8_8_sint"
+	"load_texture_3d_array_fmt_8_8_unorm"
+	"load_texture_3d_array_fmt_8_8_snorm"
+	"load_texture_3d_array_fmt_8_8_uint"
+	"load_texture_3d_array_fmt_8_8_sint"
+	"load_texture_3d_array_fmt_8_unorm"
+	"load_texture_3d_array_fmt_8_snorm"
+	"load_texture_3d_array_fmt_8_uint"
+	"load_texture_3d_array_fmt_8_sint"
+	"load_texture_3d_array_fmt_16_16_16_16_float"
+	"load_texture_3d_array_fmt_16_16_16_16_unorm"
+	"load_texture_3d_array_fmt_16_16_16_16_snorm"
+	"load_texture_3d_array_fmt_16_16_16_16_uint"
+	"load_texture_3d_array_fmt_16_16_16_16_sint"
+	"load_texture_3d_array_fmt_16_16_float",
+	"load_texture_3d_array_fmt_16_16_unorm"
+	"load_texture_3d_array_fmt_16_16_snorm"
+	"load_texture_3d_array_fmt_16_16_uint"
+	"load_texture_3d_array_fmt_16_16_sint"
+	"load_texture_3d_array_fmt_16_float"
+	"load_texture_3d_array_fmt_16_unorm"
+	"load_texture_3d_array_fmt_16_snorm"
+	"load_texture_3d_array_fmt_16_uint"
+	"load_texture_3d_array_fmt_16_sint"
+	"load_texture_3d_array_fmt_32_32_32_32_float"
+	"load_texture_3d_array_fmt_32_32_32_32_uint"
+	"load_texture_3d_array_fmt_32_32_32_32_sint"
+	"load_texture_3d_array_fmt_32_32_float"
+	"load_texture_3d_array_fmt_32_32_uint"
+	"load_texture_3d_array_fmt_32_32_sint"
+	"load_texture_3d_array_fmt_32_float"
+	"load_texture_3d_array_fmt_32_uint"
+	"load_texture_3d_array_fmt_32_sint"
+	"load_texture_3d_array_fmt_64_uint"
+	"load_texture_3d_array_fmt_64_sint"
+	"load_texture_3d_array_fmt_11_11_10_float"
+	"load_texture_3d_array_fmt_10_10_10_2_unorm"
+	"load_texture_3d_array_fmt_10_10_10_2_uint"
+	"load_texture_3d_ms_fmt_8_8_8_8_unorm"
+	"load_texture_3d_ms_fmt_8_8_8_8_snorm"
+	"load_texture_3d_ms_fmt_8_8_8_8_uint"
+	"load_texture_3d_ms_fmt_8_8_8_8_sint"
+	"load_texture_3d_ms_fmt_8_8_unorm"
+	"load_texture_3d_ms_fmt_8_8_snorm"
+	"load_texture_3d_ms_fmt_8_8_uint"
+	"load_texture_3d_ms_fmt_8_8_sint"
+	"load_texture_3d_ms_fmt_8_unorm"
+	"load_texture_3d_ms_fmt_8_snorm"
+	"load_texture_3d_ms_fmt_8_uint"
+	"load_texture_3d_ms_fmt_8_sint"
+	"load_texture_3d_ms_fmt_16_16_16_16_float"
+	"load_texture_3d_ms_fmt_16_16_16_16_unorm"
+	"load_texture_3d_ms_fmt_16_16_16_16_snorm"
+	"load_texture_3d_ms_fmt_16_16_16_16_uint"
+	"load_texture_3d_ms_fmt_16_16_16_16_sint"
+	"load_texture_3d_ms_fmt_16_16_float"
+	"load_texture_3d_ms_fmt_16_16_unorm"
+	"load_texture_3d_ms_fmt_16_16_snorm"
+	"load_texture_3d_ms_fmt_16_16_uint"
+	"load_texture_3d_ms_fmt_16_16_sint"
+	"load_texture_3d_ms_fmt_16_float"
+	"load_texture_3d_ms_fmt_16_unorm"
+	"load_texture_3d_ms_fmt_16_snorm"
+	"load_texture_3d_ms_fmt_16_uint"
+	"load_texture_3d_ms_fmt_16_sint"
+	"load_texture_3d_ms_fmt_32_32_32_32_float"
+	"load_texture_3d_ms_fmt_32_32_32_32_uint"
+	"load_texture_3d_ms_fmt_32_32_32_32_sint"
+	"load_texture_3d_ms_fmt_32_32_float"
+	"load_texture_3d_ms_fmt_32_32_uint"
+	"load_texture_3d_ms_fmt_32_32_sint"
+	"load_texture_3d_ms_fmt_32_float"
+	"load_texture_3d_ms_fmt_32_uint"
+	"load_texture_3d_ms_fmt_32_sint"
+	"load_texture_3d_ms_fmt_64_uint"
+	"load_texture_3d_ms_fmt_64_sint"
+	"load_texture_3d_ms_fmt_11_11_10_float"
+	"load_texture_3d_ms_fmt_10_10_10_2_unorm"
+	"load_texture_3d_ms_fmt_10_10_10_2_uint"
+	"load_texture_3d_ms_array_fmt_8_8_8_8_unorm"
+	"load_texture_3d_ms_array_fmt_8_8_8_8_snorm"
+	"load_texture_3d_ms_array_fmt_8_8_8_8_uint"
+	"load_texture_3d_ms_array_fmt_8_8_8_8_sint"
+	"load_texture_3d_ms_array_fmt_8_8_unorm"
+	"load_texture_3d_ms_array_fmt_8_8_snorm"
+	"load_texture_3d_ms_array_fmt_8_8_uint"
+	"load_texture_3d_ms_array_fmt_8_8_sint"
+	"load_texture_3d_ms_array_fmt_8_unorm"
+	"load_texture_3d_ms_array_fmt_8_snorm"
+	"load_texture_3d_ms_array_fmt_8_uint"
+	"load_texture_3d_ms_array_fmt_8_sint"
+	"load_texture_3d_ms_array_fmt_16_16_16_16_float"
+	"load_texture_3d_ms_array_fmt_16_16_16_16_unorm"
+	"load_texture_3d_ms_array_fmt_16_16_16_16_snorm"
+	"load_texture_3d_ms_array_fmt_16_16_16_16_uint"
+	"load_texture_3d_ms_array_fmt_16_16_16_16_sint"
+	"load_texture_3d_ms_array_fmt_16_16_float"
+	"load_texture_3d_ms_array_fmt_16_16_unorm"
+	"load_texture_3d_ms_array_fmt_16_16_snorm"
+	"load_texture_3d_ms_array_fmt_16_16_uint"
+	"load_texture_3d_ms_array_fmt_16_16_sint"
+	"load_texture_3d_ms_array_fmt_16_float"
+	"load_texture_3d_ms_array_fmt_16_unorm"
+	"load_texture_3d_ms_array_fmt_16_snorm"
+	"load_texture_3d_ms_array_fmt_16_uint"
+	"load_texture_3d_ms_array_fmt_16_sint"
+	"load_texture_3d_ms_array_fmt_32_32_32_32_float"
+	"load_texture_3d_ms_array_fmt_32_32_32_32_uint"
+	"load_texture_3d_ms_array_fmt_32_32_32_32_sint"
+	"load_texture_3d_ms_array_fmt_32_32_float"
+	"load_texture_3d_ms_array_fmt_32_32_uint"
+	"load_texture_3d_ms_array_fmt_32_32_sint"
+	"load_texture_3d_ms_array_fmt_32_float"
+	"load_texture_3d_ms_array_fmt_32_uint"
+	"load_texture_3d_ms_array_fmt_32_sint"
+	"load_texture_3d_ms_array_fmt_64_uint"
+	"load_texture_3d_ms_array_fmt_64_sint"
+	"load_texture_3d_ms_array_fmt_11_11_10_float"
+	"load_texture_3d_ms_array_fmt_10_10_10_2_unorm"
+	"load_texture_3d_ms_array_fmt_10_10_10_2_uint"
+	"load_texture_cube_fmt_8_8_8_8_unorm"
+	"load_texture_cube_fmt_8_8_8_8_snorm"
+	"load_texture_cube_fmt_8_8_8_8_uint"
+	"load_texture_cube_fmt_8_8_8_8_sint"
+	"load_texture_cube_fmt_8_8_unorm"
+	"load_texture_cube_fmt_8_8_snorm"
+	"load_texture_cube_fmt_8_8_uint",
+	"load_texture_cube_fmt_8_8_sint"
+	"load_texture_cube_fmt_8_unorm"
+	"load_texture_cube_fmt_8_snorm"
+	"load_texture_cube_fmt_8_uint"
+	"load_texture_cube_fmt_8_sint"
+	"load_texture_cube_fmt_16_16_16_16_float"
+	"load_texture_cube_fmt_16_16_16_16_unorm"
+	"load_texture_cube_fmt_16_16_16_16_snorm"
+	"load_texture_cube_fmt_16_16_16_16_uint"
+	"load_texture_cube_fmt_16_16_16_16_sint"
+	"load_texture_cube_fmt_16_16_float"
+	"load_texture_cube_fmt_16_16_unorm"
+	"load_texture_cube_fmt_16_16_snorm"
+	"load_texture_cube_fmt_16_16_uint"
+	"load_texture_cube_fmt_16_16_sint"
+	"load_texture_cube_fmt_16_float"
+	"load_texture_cube_fmt_16_unorm"
+	"load_texture_cube_fmt_16_snorm"
+	"load_texture_cube_fmt_16_uint"
+	"load_texture_cube_fmt_16_sint"
+	"load_texture_cube_fmt_32_32_32_32_float"
+	"load_texture_cube_fmt_32_32_32_32_uint"
+	"load_texture_cube_fmt_32_32_32_32_sint"
+	"load_texture_cube_fmt_32_32_float"
+	"load_texture_cube_fmt_32_32_uint"
+	"load_texture_cube_fmt_32_32_sint"
+	"load_texture_cube_fmt_32_float"
+	"load_texture_cube_fmt_32_uint"
+	"load_texture_cube_fmt_32_sint"
+	"load_texture_cube_fmt_64_uint"
+	"load_texture_cube_fmt_64_sint"
+	"load_texture_cube_fmt_11_11_10_float"
+	"load_texture_cube_fmt_10_10_10_2_unorm"
+	"load_texture_cube_fmt_10_10_10_2_uint"
+	"load_texture_cube_array_fmt_8_8_8_8_unorm"
+	"load_texture_cube_array_fmt_8_8_8_8_snorm"
+	"load_texture_cube_array_fmt_8_8_8_8_uint"
+	"load_texture_cube_array_fmt_8_8_8_8_sint"
+	"load_texture_cube_array_fmt_8_8_unorm"
+	"load_texture_cube_array_fmt_8_8_snorm"
+	"load_texture_cube_array_fmt_8_8_uint"
+	"load_texture_cube_array_fmt_8_8_sint"
+	"load_texture_cube_array_fmt_8_unorm"
+	"load_texture_cube_array_fmt_8_snorm"
+	"load_texture_cube_array_fmt_8_uint"
+	"load_texture_cube_array_fmt_8_sint"
+	"load_texture_cube_array_fmt_16_16_16_16_float"
+	"load_texture_cube_array_fmt_16_16_16_16_unorm"
+	"load_texture_cube_array_fmt_16_16_16_16_snorm"
+	"load_texture_cube_array_fmt_16_16_16_16_uint"
+	"load_texture_cube_array_fmt_16_16_16_16_sint"
+	"load_texture_cube_array_fmt_16_16_float"
+	"load_texture_cube_array_fmt_16_16_unorm"
+	"load_texture_cube_array_fmt_16_16_snorm"
+	"load_texture_cube_array_fmt_16_16_uint"
+	"load_texture_cube_array_fmt_16_16_sint"
+	"load_texture_cube_array_fmt_16_float"
+	"load_texture_cube_array_fmt_16_unorm"
+	"load_texture_cube_array_fmt_16_snorm"
+	"load_texture_cube_array_fmt_16_uint"
+	"load_texture_cube_array_fmt_16_sint"
+	"load_texture_cube_array_fmt_32_32_32_32_float"
+	"load_texture_cube_array_fmt_32_32_32_32_uint"
+	"load_texture_cube_array_fmt_32_32_32_32_sint"
+	"load_texture_cube_array_fmt_32_32_float"
+	"load_texture_cube_array_fmt_32_32_uint"
+	"load_texture_cube_array_fmt_32_32_sint"
+	"load_texture_cube_array_fmt_32_float"
+	"load_texture_cube_array_fmt_32_uint"
+	"load_texture_cube_array_fmt_32_sint"
+	"load_texture_cube_array_fmt_64_uint"
+	"load_texture_cube_array_fmt_64_sint"
+	"load_texture_cube_array_fmt_11_11_10_float"
+	"load_texture_cube_array_fmt_10_10_10_2_unorm"
+	"load_texture_cube_array_fmt_10_10_10_2_uint"
+	"load_texture_cube_ms_fmt_8_8_8_8_unorm"
+	"load_texture_cube_ms_fmt_8_8_8_8_snorm"
+	"load_texture_cube_ms_fmt_8_8_8_8_uint"
+	"load_texture_cube_ms_fmt_8_8_8_8_sint"
+	"load_texture_cube_ms_fmt_8_8_unorm"
+	"load_texture_cube_ms_fmt_8_8_snorm"
+	"load_texture_cube_ms_fmt_8_8_uint"
+	"load_texture_cube_ms_fmt_8_8_sint"
+	"load_texture_cube_ms_fmt_8_unorm"
+	"load_texture_cube_ms_fmt_8_snorm"
+	"load_texture_cube_ms_fmt_8_uint"
+	"load_texture_cube_ms_fmt_8_sint"
+	"load_texture_cube_ms_fmt_16_16_16_16_float"
+	"load_texture_cube_ms_fmt_16_16_16_16_unorm"
+	"load_texture_cube_ms_fmt_16_16_16_16_snorm"
+	"load_texture_cube_ms_fmt_16_16_16_16_uint"
+	"load_texture_cube_ms_fmt_16_16_16_16_sint"
+	"load_texture_cube_ms_fmt_16_16_float"
+	"load_texture_cube_ms_fmt_16_16_unorm"
+	"load_texture_cube_ms_fmt_16_16_snorm"
+	"load_texture_cube_ms_fmt_16_16_uint"
+	"load_texture_cube_ms_fmt_16_16_sint"
+	"load_texture_cube_ms_fmt_16_float"
+	"load_texture_cube_ms_fmt_16_unorm"
+	"load_texture_cube_ms_fmt_16_snorm"
+	"load_texture_cube_ms_fmt_16_uint"
+	"load_texture_cube_ms_fmt_16_sint"
+	"load_texture_cube_ms_fmt_32_32_32_32_float"
+	"load_texture_cube_ms_fmt_32_32_32_32_uint"
+	"load_texture_cube_ms_fmt_32_32_32_32_sint"
+	"load_texture_cube_ms_fmt_32_32_float"
+	"load_texture_cube_ms_fmt_32_32_uint"
+	"load_texture_cube_ms_fmt_32_32_sint"
+	"load_texture_cube_ms_fmt_32_float"
+	"load_texture_cube_ms_fmt_32_uint"
+	"load_texture_cube_ms_fmt_32_sint"
+	"load_texture_cube_ms_fmt_64_uint"
+	"load_texture_cube_ms_fmt_64_sint",
+	"load_texture_cube_ms_fmt_11_11_10_float"
+	"load_texture_cube_ms_fmt_10_10_10_2_unorm"
+	"load_texture_cube_ms_fmt_10_10_10_2_uint"
+	"load_texture_cube_ms_array_fmt_8_8_8_8_unorm"
+	"load_texture_cube_ms_array_fmt_8_8_8_8_snorm"
+	"load_texture_cube_ms_array_fmt_8_8_8_8_uint"
+	"load_texture_cube_ms_array_fmt_8_8_8_8_sint"
+	"load_texture_cube_ms_array_fmt_8_8_unorm"
+	"load_texture_cube_ms_array_fmt_8_8_snorm"
+	"load_texture_cube_ms_array_fmt_8_8_uint"
+	"load_texture_cube_ms_array_fmt_8_8_sint"
+	"load_texture_cube_ms_array_fmt_8_unorm"
+	"load_texture_cube_ms_array_fmt_8_snorm"
+	"load_texture_cube_ms_array_fmt_8_uint"
+	"load_texture_cube_ms_array_fmt_8_sint"
+	"load_texture_cube_ms_array_fmt_16_16_16_16_float"
+	"load_texture_cube_ms_array_fmt_16_16_16_16_unorm"
+	"load_texture_cube_ms_array_fmt_16_16_16_16_snorm"
+	"load_texture_cube_ms_array_fmt_16_16_16_16_uint"
+	"load_texture_cube_ms_array_fmt_16_16_16_16_sint"
+	"load_texture_cube_ms_array_fmt_16_16_float"
+	"load_texture_cube_ms_array_fmt_16_16_unorm"
+	"load_texture_cube_ms_array_fmt_16_16_snorm"
+	"load_texture_cube_ms_array_fmt_16_16_uint"
+	"load_texture_cube_ms_array_fmt_16_16_sint"
+	"load_texture_cube_ms_array_fmt_16_float"
+	"load_texture_cube_ms_array_fmt_16_unorm"
+	"load_texture_cube_ms_array_fmt_16_snorm"
+	"load_texture_cube_ms_array_fmt_16_uint"
+	"load_texture_cube_ms_array_fmt_16_sint"
+	"load_texture_cube_ms_array_fmt_32_32_32_32_float"
+	"load_texture_cube_ms_array_fmt_32_32_32_32_uint"
+	"load_texture_cube_ms_array_fmt_32_32_32_32_sint"
+	"load_texture_cube_ms_array_fmt_32_32_float"
+	"load_texture_cube_ms_array_fmt_32_32_uint"
+	"load_texture_cube_ms_array_fmt_32_32_sint"
+	"load_texture_cube_ms_array_fmt_32_float"
+	"load_texture_cube_ms_array_fmt_32_uint"
+	"load_texture_cube_ms_array_fmt_32_sint"
+	"load_texture_cube_ms_array_fmt_64_uint"
+	"load_texture_cube_ms_array_fmt_64_sint"
+	"load_texture_cube_ms_array_fmt_11_11_10_float"
+	"load_texture_cube_ms_array_fmt_10_10_10_2_unorm"
+	"load_texture_cube_ms_array_fmt_10_10_10_2_uint"
+	"fetch_texture_1d_f32"
+	"fetch_texture_1d_s32"
+	"fetch_texture_1d_u32"
+	"fetch_texture_1d_s64"
+	"fetch_texture_1d_u64"
+	"fetch_texture_1d_f32x2"
+	"fetch_texture_1d_s32x2"
+	"fetch_texture_1d_u32x2"
+	"fetch_texture_1d_f32x3"
+	"fetch_texture_1d_s32x3"
+	"fetch_texture_1d_u32x3"
+	"fetch_texture_1d_f32x4"
+	"fetch_texture_1d_s32x4"
+	"fetch_texture_1d_u32x4"
+	"fetch_texture_1d_array_f32"
+	"fetch_texture_1d_array_s32"
+	"fetch_texture_1d_array_u32"
+	"fetch_texture_1d_array_s64"
+	"fetch_texture_1d_array_u64"
+	"fetch_texture_1d_array_f32x2"
+	"fetch_texture_1d_array_s32x2"
+	"fetch_texture_1d_array_u32x2"
+	"fetch_texture_1d_array_f32x3"
+	"fetch_texture_1d_array_s32x3"
+	"fetch_texture_1d_array_u32x3"
+	"fetch_texture_1d_array_f32x4"
+	"fetch_texture_1d_array_s32x4"
+	"fetch_texture_1d_array_u32x4"
+	"fetch_texture_1d_ms_f32"
+	"fetch_texture_1d_ms_s32"
+	"fetch_texture_1d_ms_u32"
+	"fetch_texture_1d_ms_s64"
+	"fetch_texture_1d_ms_u64"
+	"fetch_texture_1d_ms_f32x2"
+	"fetch_texture_1d_ms_s32x2"
+	"fetch_texture_1d_ms_u32x2"
+	"fetch_texture_1d_ms_f32x3"
+	"fetch_texture_1d_ms_s32x3"
+	"fetch_texture_1d_ms_u32x3"
+	"fetch_texture_1d_ms_f32x4"
+	"fetch_texture_1d_ms_s32x4"
+	"fetch_texture_1d_ms_u32x4"
+	"fetch_texture_1d_ms_array_f32"
+	"fetch_texture_1d_ms_array_s32"
+	"fetch_texture_1d_ms_array_u32"
+	"fetch_texture_1d_ms_array_s64"
+	"fetch_texture_1d_ms_array_u64"
+	"fetch_texture_1d_ms_array_f32x2"
+	"fetch_texture_1d_ms_array_s32x2"
+	"fetch_texture_1d_ms_array_u32x2"
+	"fetch_texture_1d_ms_array_f32x3"
+	"fetch_texture_1d_ms_array_s32x3"
+	"fetch_texture_1d_ms_array_u32x3"
+	"fetch_texture_1d_ms_array_f32x4"
+	"fetch_texture_1d_ms_array_s32x4"
+	"fetch_texture_1d_ms_array_u32x4"
+	"fetch_texture_2d_f32"
+	"fetch_texture_2d_s32"
+	"fetch_texture_2d_u32"
+	"fetch_texture_2d_s64"
+	"fetch_texture_2d_u64"
+	"fetch_texture_2d_f32x2"
+	"fetch_texture_2d_s32x2"
+	"fetch_texture_2d_u32x2"
+	"fetch_texture_2d_f32x3"
+	"fetch_texture_2d_s32x3"
+	"fetch_texture_2d_u32x3"
+	"fetch_texture_2d_f32x4"
+	"fetch_texture_2d_s32x4"
+	"fetch_texture_2d_u32x4"
+	"fetch_texture_2d_array_f32"
+	"fetch_texture_2d_array_s32"
+	"fetch_texture_2d_array_u32"
+	"fetch_texture_2d_array_s64"
+	"fetch_texture_2d_array_u64"
+	"fetch_texture_2d_array_f32x2"
+	"fetch_texture_2d_array_s32x2"
+	"fetch_texture_2d_array_u32x2"
+	"fetch_texture_2d_array_f32x3"
+	"fetch_texture_2d_array_s32x3"
+	"fetch_texture_2d_array_u32x3"
+	"fetch_texture_2d_array_f32x4"
+	"fetch_texture_2d_array_s32x4"
+	"fetch_texture_2d_array_u32x4"
+	"fetch_texture_2d_ms_f32"
+	"fetch_texture_2d_ms_s32"
+	"fetch_texture_2d_ms_u32"
+	"fetch_texture_2d_ms_s64"
+	"fetch_texture_2d_ms_u64",
+	"fetch_texture_2d_ms_f32x2"
+	"fetch_texture_2d_ms_s32x2"
+	"fetch_texture_2d_ms_u32x2"
+	"fetch_texture_2d_ms_f32x3"
+	"fetch_texture_2d_ms_s32x3"
+	"fetch_texture_2d_ms_u32x3"
+	"fetch_texture_2d_ms_f32x4"
+	"fetch_texture_2d_ms_s32x4"
+	"fetch_texture_2d_ms_u32x4"
+	"fetch_texture_2d_ms_array_f32"
+	"fetch_texture_2d_ms_array_s32"
+	"fetch_texture_2d_ms_array_u32"
+	"fetch_texture_2d_ms_array_s64"
+	"fetch_texture_2d_ms_array_u64"
+	"fetch_texture_2d_ms_array_f32x2"
+	"fetch_texture_2d_ms_array_s32x2"
+	"fetch_texture_2d_ms_array_u32x2"
+	"fetch_texture_2d_ms_array_f32x3"
+	"fetch_texture_2d_ms_array_s32x3"
+	"fetch_texture_2d_ms_array_u32x3"
+	"fetch_texture_2d_ms_array_f32x4"
+	"fetch_texture_2d_ms_array_s32x4"
+	"fetch_texture_2d_ms_array_u32x4"
+	"fetch_texture_3d_f32"
+	"fetch_texture_3d_s32"
+	"fetch_texture_3d_u32"
+	"fetch_texture_3d_s64"
+	"fetch_texture_3d_u64"
+	"fetch_texture_3d_f32x2"
+	"fetch_texture_3d_s32x2"
+	"fetch_texture_3d_u32x2"
+	"fetch_texture_3d_f32x3"
+	"fetch_texture_3d_s32x3"
+	"fetch_texture_3d_u32x3"
+	"fetch_texture_3d_f32x4"
+	"fetch_texture_3d_s32x4"
+	"fetch_texture_3d_u32x4"
+	"fetch_texture_3d_array_f32"
+	"fetch_texture_3d_array_s32"
+	"fetch_texture_3d_array_u32"
+	"fetch_texture_3d_array_s64"
+	"fetch_texture_3d_array_u64"
+	"fetch_texture_3d_array_f32x2"
+	"fetch_texture_3d_array_s32x2"
+	"fetch_texture_3d_array_u32x2"
+	"fetch_texture_3d_array_f32x3"
+	"fetch_texture_3d_array_s32x3"
+	"fetch_texture_3d_array_u32x3"
+	"fetch_texture_3d_array_f32x4"
+	"fetch_texture_3d_array_s32x4"
+	"fetch_texture_3d_array_u32x4"
+	"fetch_texture_3d_ms_f32"
+	"fetch_texture_3d_ms_s32"
+	"fetch_texture_3d_ms_u32"
+	"fetch_texture_3d_ms_s64"
+	"fetch_texture_3d_ms_u64"
+	"fetch_texture_3d_ms_f32x2"
+	"fetch_texture_3d_ms_s32x2"
+	"fetch_texture_3d_ms_u32x2"
+	"fetch_texture_3d_ms_f32x3"
+	"fetch_texture_3d_ms_s32x3"
+	"fetch_texture_3d_ms_u32x3"
+	"fetch_texture_3d_ms_f32x4"
+	"fetch_texture_3d_ms_s32x4"
+	"fetch_texture_3d_ms_u32x4"
+	"fetch_texture_3d_ms_array_f32"
+	"fetch_texture_3d_ms_array_s32"
+	"fetch_texture_3d_ms_array_u32"
+	"fetch_texture_3d_ms_array_s64"
+	"fetch_texture_3d_ms_array_u64"
+	"fetch_texture_3d_ms_array_f32x2"
+	"fetch_texture_3d_ms_array_s32x2"
+	"fetch_texture_3d_ms_array_u32x2"
+	"fetch_texture_3d_ms_array_f32x3"
+	"fetch_texture_3d_ms_array_s32x3"
+	"fetch_texture_3d_ms_array_u32x3"
+	"fetch_texture_3d_ms_array_f32x4"
+	"fetch_texture_3d_ms_array_s32x4"
+	"fetch_texture_3d_ms_array_u32x4"
+	"fetch_texture_cube_f32"
+	"fetch_texture_cube_s32"
+	"fetch_texture_cube_u32"
+	"fetch_texture_cube_s64"
+	"fetch_texture_cube_u64"
+	"fetch_texture_cube_f32x2"
+	"fetch_texture_cube_s32x2"
+	"fetch_texture_cube_u32x2"
+	"fetch_texture_cube_f32x3"
+	"fetch_texture_cube_s32x3"
+	"fetch_texture_cube_u32x3"
+	"fetch_texture_cube_f32x4"
+	"fetch_texture_cube_s32x4"
+	"fetch_texture_cube_u32x4"
+	"fetch_texture_cube_array_f32"
+	"fetch_texture_cube_array_s32"
+	"fetch_texture_cube_array_u32"
+	"fetch_texture_cube_array_s64"
+	"fetch_texture_cube_array_u64"
+	"fetch_texture_cube_array_f32x2"
+	"fetch_texture_cube_array_s32x2"
+	"fetch_texture_cube_array_u32x2"
+	"fetch_texture_cube_array_f32x3"
+	"fetch_texture_cube_array_s32x3"
+	"fetch_texture_cube_array_u32x3"
+	"fetch_texture_cube_array_f32x4"
+	"fetch_texture_cube_array_s32x4"
+	"fetch_texture_cube_array_u32x4"
+	"fetch_texture_cube_ms_f32"
+	"fetch_texture_cube_ms_s32"
+	"fetch_texture_cube_ms_u32"
+	"fetch_texture_cube_ms_s64"
+	"fetch_texture_cube_ms_u64"
+	"fetch_texture_cube_ms_f32x2"
+	"fetch_texture_cube_ms_s32x2"
+	"fetch_texture_cube_ms_u32x2"
+	"fetch_texture_cube_ms_f32x3"
+	"fetch_texture_cube_ms_s32x3"
+	"fetch_texture_cube_ms_u32x3"
+	"fetch_texture_cube_ms_f32x4"
+	"fetch_texture_cube_ms_s32x4"
+	"fetch_texture_cube_ms_u32x4"
+	"fetch_texture_cube_ms_array_f32"
+	"fetch_texture_cube_ms_array_s32"
+	"fetch_texture_cube_ms_array_u32"
+	"fetch_texture_cube_ms_array_s64"
+	"fetch_texture_cube_ms_array_u64"
+	"fetch_texture_cube_ms_array_f32x2"
+	"fetch_texture_cube_ms_array_s32x2"
+	"fetch_texture_cube_ms_array_u32x2"
+	"fetch_texture_cube_ms_array_f32x3"
+	"fetch_texture_cube_ms_array_s32x3"
+	"fetch_texture_cube_ms_array_u32x3"
+	"fetch_texture_cube_ms_array_f32x4"
+	"fetch_texture_cube_ms_array_s32x4"
+	"fetch_texture_cube_ms_array_u32x4"
+	"sample_texture_1d_f32"
+	"sample_texture_1d_s32"
+	"sample_texture_1d_u32"
+	"sample_texture_1d_s64"
+	"sample_texture_1d_u64"
+	"sample_texture_1d_f32x2"
+	"sample_texture_1d_s32x2"
+	"sample_texture_1d_u32x2"
+	"sample_texture_1d_f32x3"
+	"sample_texture_1d_s32x3"
+	"sample_texture_1d_u32x3"
+	"sample_texture_1d_f32x4"
+	"sample_texture_1d_s32x4"
+	"sample_texture_1d_u32x4"
+	"sample_texture_1d_array_f32"
+	"sample_texture_1d_array_s32"
+	"sample_texture_1d_array_u32"
+	"sample_texture_1d_array_s64",
+	"sample_texture_1d_array_u64"
+	"sample_texture_1d_array_f32x2"
+	"sample_texture_1d_array_s32x2"
+	"sample_texture_1d_array_u32x2"
+	"sample_texture_1d_array_f32x3"
+	"sample_texture_1d_array_s32x3"
+	"sample_texture_1d_array_u32x3"
+	"sample_texture_1d_array_f32x4"
+	"sample_texture_1d_array_s32x4"
+	"sample_texture_1d_array_u32x4"
+	"sample_texture_1d_ms_f32"
+	"sample_texture_1d_ms_s32"
+	"sample_texture_1d_ms_u32"
+	"sample_texture_1d_ms_s64"
+	"sample_texture_1d_ms_u64"
+	"sample_texture_1d_ms_f32x2"
+	"sample_texture_1d_ms_s32x2"
+	"sample_texture_1d_ms_u32x2"
+	"sample_texture_1d_ms_f32x3"
+	"sample_texture_1d_ms_s32x3"
+	"sample_texture_1d_ms_u32x3"
+	"sample_texture_1d_ms_f32x4"
+	"sample_texture_1d_ms_s32x4"
+	"sample_texture_1d_ms_u32x4"
+	"sample_texture_1d_ms_array_f32"
+	"sample_texture_1d_ms_array_s32"
+	"sample_texture_1d_ms_array_u32"
+	"sample_texture_1d_ms_array_s64"
+	"sample_texture_1d_ms_array_u64"
+	"sample_texture_1d_ms_array_f32x2"
+	"sample_texture_1d_ms_array_s32x2"
+	"sample_texture_1d_ms_array_u32x2"
+	"sample_texture_1d_ms_array_f32x3"
+	"sample_texture_1d_ms_array_s32x3"
+	"sample_texture_1d_ms_array_u32x3"
+	"sample_texture_1d_ms_array_f32x4"
+	"sample_texture_1d_ms_array_s32x4"
+	"sample_texture_1d_ms_array_u32x4"
+	"sample_texture_2d_f32"
+	"sample_texture_2d_s32"
+	"sample_texture_2d_u32"
+	"sample_texture_2d_s64"
+	"sample_texture_2d_u64"
+	"sample_texture_2d_f32x2"
+	"sample_texture_2d_s32x2"
+	"sample_texture_2d_u32x2"
+	"sample_texture_2d_f32x3"
+	"sample_texture_2d_s32x3"
+	"sample_texture_2d_u32x3"
+	"sample_texture_2d_f32x4"
+	"sample_texture_2d_s32x4"
+	"sample_texture_2d_u32x4"
+	"sample_texture_2d_array_f32"
+	"sample_texture_2d_array_s32"
+	"sample_texture_2d_array_u32"
+	"sample_texture_2d_array_s64"
+	"sample_texture_2d_array_u64"
+	"sample_texture_2d_array_f32x2"
+	"sample_texture_2d_array_s32x2"
+	"sample_texture_2d_array_u32x2"
+	"sample_texture_2d_array_f32x3"
+	"sample_texture_2d_array_s32x3"
+	"sample_texture_2d_array_u32x3"
+	"sample_texture_2d_array_f32x4"
+	"sample_texture_2d_array_s32x4"
+	"sample_texture_2d_array_u32x4"
+	"sample_texture_2d_ms_f32"
+	"sample_texture_2d_ms_s32"
+	"sample_texture_2d_ms_u32"
+	"sample_texture_2d_ms_s64"
+	"sample_texture_2d_ms_u64"
+	"sample_texture_2d_ms_f32x2"
+	"sample_texture_2d_ms_s32x2"
+	"sample_texture_2d_ms_u32x2"
+	"sample_texture_2d_ms_f32x3"
+	"sample_texture_2d_ms_s32x3"
+	"sample_texture_2d_ms_u32x3"
+	"sample_texture_2d_ms_f32x4"
+	"sample_texture_2d_ms_s32x4"
+	"sample_texture_2d_ms_u32x4"
+	"sample_texture_2d_ms_array_f32"
+	"sample_texture_2d_ms_array_s32"
+	"sample_texture_2d_ms_array_u32"
+	"sample_texture_2d_ms_array_s64"
+	"sample_texture_2d_ms_array_u64"
+	"sample_texture_2d_ms_array_f32x2"
+	"sample_texture_2d_ms_array_s32x2"
+	"sample_texture_2d_ms_array_u32x2"
+	"sample_texture_2d_ms_array_f32x3"
+	"sample_texture_2d_ms_array_s32x3"
+	"sample_texture_2d_ms_array_u32x3"
+	"sample_texture_2d_ms_array_f32x4"
+	"sample_texture_2d_ms_array_s32x4"
+	"sample_texture_2d_ms_array_u32x4"
+	"sample_texture_3d_f32"
+	"sample_texture_3d_s32"
+	"sample_texture_3d_u32"
+	"sample_texture_3d_s64"
+	"sample_texture_3d_u64"
+	"sample_texture_3d_f32x2"
+	"sample_texture_3d_s32x2"
+	"sample_texture_3d_u32x2"
+	"sample_texture_3d_f32x3"
+	"sample_texture_3d_s32x3"
+	"sample_texture_3d_u32x3"
+	"sample_texture_3d_f32x4"
+	"sample_texture_3d_s32x4"
+	"sample_texture_3d_u32x4"
+	"sample_texture_3d_array_f32"
+	"sample_texture_3d_array_s32"
+	"sample_texture_3d_array_u32"
+	"sample_texture_3d_array_s64"
+	"sample_texture_3d_array_u64"
+	"sample_texture_3d_array_f32x2"
+	"sample_texture_3d_array_s32x2"
+	"sample_texture_3d_array_u32x2"
+	"sample_texture_3d_array_f32x3"
+	"sample_texture_3d_array_s32x3"
+	"sample_texture_3d_array_u32x3"
+	"sample_texture_3d_array_f32x4"
+	"sample_texture_3d_array_s32x4"
+	"sample_texture_3d_array_u32x4"
+	"sample_texture_3d_ms_f32"
+	"sample_texture_3d_ms_s32"
+	"sample_texture_3d_ms_u32"
+	"sample_texture_3d_ms_s64"
+	"sample_texture_3d_ms_u64"
+	"sample_texture_3d_ms_f32x2"
+	"sample_texture_3d_ms_s32x2"
+	"sample_texture_3d_ms_u32x2"
+	"sample_texture_3d_ms_f32x3"
+	"sample_texture_3d_ms_s32x3"
+	"sample_texture_3d_ms_u32x3"
+	"sample_texture_3d_ms_f32x4"
+	"sample_texture_3d_ms_s32x4"
+	"sample_texture_3d_ms_u32x4"
+	"sample_texture_3d_ms_array_f32"
+	"sample_texture_3d_ms_array_s32"
+	"sample_texture_3d_ms_array_u32"
+	"sample_texture_3d_ms_array_s64"
+	"sample_texture_3d_ms_array_u64"
+	"sample_texture_3d_ms_array_f32x2"
+	"sample_texture_3d_ms_array_s32x2"
+	"sample_texture_3d_ms_array_u32x2"
+	"sample_texture_3d_ms_array_f32x3"
+	"sample_texture_3d_ms_array_s32x3"
+	"sample_texture_3d_ms_array_u32x3"
+	"sample_texture_3d_ms_array_f32x4"
+	"sample_texture_3d_ms_array_s32x4"
+	"sample_texture_3d_ms_array_u32x4",
+	"sample_texture_cube_f32"
+	"sample_texture_cube_s32"
+	"sample_texture_cube_u32"
+	"sample_texture_cube_s64"
+	"sample_texture_cube_u64"
+	"sample_texture_cube_f32x2"
+	"sample_texture_cube_s32x2"
+	"sample_texture_cube_u32x2"
+	"sample_texture_cube_f32x3"
+	"sample_texture_cube_s32x3"
+	"sample_texture_cube_u32x3"
+	"sample_texture_cube_f32x4"
+	"sample_texture_cube_s32x4"
+	"sample_texture_cube_u32x4"
+	"sample_texture_cube_array_f32"
+	"sample_texture_cube_array_s32"
+	"sample_texture_cube_array_u32"
+	"sample_texture_cube_array_s64"
+	"sample_texture_cube_array_u64"
+	"sample_texture_cube_array_f32x2"
+	"sample_texture_cube_array_s32x2"
+	"sample_texture_cube_array_u32x2"
+	"sample_texture_cube_array_f32x3"
+	"sample_texture_cube_array_s32x3"
+	"sample_texture_cube_array_u32x3"
+	"sample_texture_cube_array_f32x4"
+	"sample_texture_cube_array_s32x4"
+	"sample_texture_cube_array_u32x4"
+	"sample_texture_cube_ms_f32"
+	"sample_texture_cube_ms_s32"
+	"sample_texture_cube_ms_u32"
+	"sample_texture_cube_ms_s64"
+	"sample_texture_cube_ms_u64"
+	"sample_texture_cube_ms_f32x2"
+	"sample_texture_cube_ms_s32x2"
+	"sample_texture_cube_ms_u32x2"
+	"sample_texture_cube_ms_f32x3"
+	"sample_texture_cube_ms_s32x3"
+	"sample_texture_cube_ms_u32x3"
+	"sample_texture_cube_ms_f32x4"
+	"sample_texture_cube_ms_s32x4"
+	"sample_texture_cube_ms_u32x4"
+	"sample_texture_cube_ms_array_f32"
+	"sample_texture_cube_ms_array_s32"
+	"sample_texture_cube_ms_array_u32"
+	"sample_texture_cube_ms_array_s64"
+	"sample_texture_cube_ms_array_u64"
+	"sample_texture_cube_ms_array_f32x2"
+	"sample_texture_cube_ms_array_s32x2"
+	"sample_texture_cube_ms_array_u32x2"
+	"sample_texture_cube_ms_array_f32x3"
+	"sample_texture_cube_ms_array_s32x3"
+	"sample_texture_cube_ms_array_u32x3"
+	"sample_texture_cube_ms_array_f32x4"
+	"sample_texture_cube_ms_array_s32x4"
+	"sample_texture_cube_ms_array_u32x4"
+	"sample_mip_bias_texture_1d_f32"
+	"sample_mip_bias_texture_1d_s32"
+	"sample_mip_bias_texture_1d_u32"
+	"sample_mip_bias_texture_1d_s64"
+	"sample_mip_bias_texture_1d_u64"
+	"sample_mip_bias_texture_1d_f32x2"
+	"sample_mip_bias_texture_1d_s32x2"
+	"sample_mip_bias_texture_1d_u32x2"
+	"sample_mip_bias_texture_1d_f32x3"
+	"sample_mip_bias_texture_1d_s32x3"
+	"sample_mip_bias_texture_1d_u32x3"
+	"sample_mip_bias_texture_1d_f32x4"
+	"sample_mip_bias_texture_1d_s32x4"
+	"sample_mip_bias_texture_1d_u32x4"
+	"sample_mip_bias_texture_1d_array_f32"
+	"sample_mip_bias_texture_1d_array_s32"
+	"sample_mip_bias_texture_1d_array_u32"
+	"sample_mip_bias_texture_1d_array_s64"
+	"sample_mip_bias_texture_1d_array_u64"
+	"sample_mip_bias_texture_1d_array_f32x2"
+	"sample_mip_bias_texture_1d_array_s32x2"
+	"sample_mip_bias_texture_1d_array_u32x2"
+	"sample_mip_bias_texture_1d_array_f32x3"
+	"sample_mip_bias_texture_1d_array_s32x3"
+	"sample_mip_bias_texture_1d_array_u32x3"
+	"sample_mip_bias_texture_1d_array_f32x4"
+	"sample_mip_bias_texture_1d_array_s32x4"
+	"sample_mip_bias_texture_1d_array_u32x4"
+	"sample_mip_bias_texture_1d_ms_f32"
+	"sample_mip_bias_texture_1d_ms_s32"
+	"sample_mip_bias_texture_1d_ms_u32"
+	"sample_mip_bias_texture_1d_ms_s64"
+	"sample_mip_bias_texture_1d_ms_u64"
+	"sample_mip_bias_texture_1d_ms_f32x2"
+	"sample_mip_bias_texture_1d_ms_s32x2"
+	"sample_mip_bias_texture_1d_ms_u32x2"
+	"sample_mip_bias_texture_1d_ms_f32x3"
+	"sample_mip_bias_texture_1d_ms_s32x3"
+	"sample_mip_bias_texture_1d_ms_u32x3"
+	"sample_mip_bias_texture_1d_ms_f32x4"
+	"sample_mip_bias_texture_1d_ms_s32x4"
+	"sample_mip_bias_texture_1d_ms_u32x4"
+	"sample_mip_bias_texture_1d_ms_array_f32"
+	"sample_mip_bias_texture_1d_ms_array_s32"
+	"sample_mip_bias_texture_1d_ms_array_u32"
+	"sample_mip_bias_texture_1d_ms_array_s64"
+	"sample_mip_bias_texture_1d_ms_array_u64"
+	"sample_mip_bias_texture_1d_ms_array_f32x2"
+	"sample_mip_bias_texture_1d_ms_array_s32x2"
+	"sample_mip_bias_texture_1d_ms_array_u32x2"
+	"sample_mip_bias_texture_1d_ms_array_f32x3"
+	"sample_mip_bias_texture_1d_ms_array_s32x3"
+	"sample_mip_bias_texture_1d_ms_array_u32x3"
+	"sample_mip_bias_texture_1d_ms_array_f32x4"
+	"sample_mip_bias_texture_1d_ms_array_s32x4"
+	"sample_mip_bias_texture_1d_ms_array_u32x4"
+	"sample_mip_bias_texture_2d_f32"
+	"sample_mip_bias_texture_2d_s32"
+	"sample_mip_bias_texture_2d_u32"
+	"sample_mip_bias_texture_2d_s64"
+	"sample_mip_bias_texture_2d_u64"
+	"sample_mip_bias_texture_2d_f32x2"
+	"sample_mip_bias_texture_2d_s32x2"
+	"sample_mip_bias_texture_2d_u32x2"
+	"sample_mip_bias_texture_2d_f32x3"
+	"sample_mip_bias_texture_2d_s32x3"
+	"sample_mip_bias_texture_2d_u32x3"
+	"sample_mip_bias_texture_2d_f32x4"
+	"sample_mip_bias_texture_2d_s32x4"
+	"sample_mip_bias_texture_2d_u32x4"
+	"sample_mip_bias_texture_2d_array_f32",
+	"sample_mip_bias_texture_2d_array_s32"
+	"sample_mip_bias_texture_2d_array_u32"
+	"sample_mip_bias_texture_2d_array_s64"
+	"sample_mip_bias_texture_2d_array_u64"
+	"sample_mip_bias_texture_2d_array_f32x2"
+	"sample_mip_bias_texture_2d_array_s32x2"
+	"sample_mip_bias_texture_2d_array_u32x2"
+	"sample_mip_bias_texture_2d_array_f32x3"
+	"sample_mip_bias_texture_2d_array_s32x3"
+	"sample_mip_bias_texture_2d_array_u32x3"
+	"sample_mip_bias_texture_2d_array_f32x4"
+	"sample_mip_bias_texture_2d_array_s32x4"
+	"sample_mip_bias_texture_2d_array_u32x4"
+	"sample_mip_bias_texture_2d_ms_f32"
+	"sample_mip_bias_texture_2d_ms_s32"
+	"sample_mip_bias_texture_2d_ms_u32"
+	"sample_mip_bias_texture_2d_ms_s64"
+	"sample_mip_bias_texture_2d_ms_u64"
+	"sample_mip_bias_texture_2d_ms_f32x2"
+	"sample_mip_bias_texture_2d_ms_s32x2"
+	"sample_mip_bias_texture_2d_ms_u32x2"
+	"sample_mip_bias_texture_2d_ms_f32x3"
+	"sample_mip_bias_texture_2d_ms_s32x3"
+	"sample_mip_bias_texture_2d_ms_u32x3"
+	"sample_mip_bias_texture_2d_ms_f32x4"
+	"sample_mip_bias_texture_2d_ms_s32x4"
+	"sample_mip_bias_texture_2d_ms_u32x4"
+	"sample_mip_bias_texture_2d_ms_array_f32"
+	"sample_mip_bias_texture_2d_ms_array_s32"
+	"sample_mip_bias_texture_2d_ms_array_u32"
+	"sample_mip_bias_texture_2d_ms_array_s64"
+	"sample_mip_bias_texture_2d_ms_array_u64"
+	"sample_mip_bias_texture_2d_ms_array_f32x2"
+	"sample_mip_bias_texture_2d_ms_array_s32x2"
+	"sample_mip_bias_texture_2d_ms_array_u32x2"
+	"sample_mip_bias_texture_2d_ms_array_f32x3"
+	"sample_mip_bias_texture_2d_ms_array_s32x3"
+	"sample_mip_bias_texture_2d_ms_array_u32x3"
+	"sample_mip_bias_texture_2d_ms_array_f32x4"
+	"sample_mip_bias_texture_2d_ms_array_s32x4"
+	"sample_mip_bias_texture_2d_ms_array_u32x4"
+	"sample_mip_bias_texture_3d_f32"
+	"sample_mip_bias_texture_3d_s32"
+	"sample_mip_bias_texture_3d_u32"
+	"sample_mip_bias_texture_3d_s64"
+	"sample_mip_bias_texture_3d_u64"
+	"sample_mip_bias_texture_3d_f32x2"
+	"sample_mip_bias_texture_3d_s32x2"
+	"sample_mip_bias_texture_3d_u32x2"
+	"sample_mip_bias_texture_3d_f32x3"
+	"sample_mip_bias_texture_3d_s32x3"
+	"sample_mip_bias_texture_3d_u32x3"
+	"sample_mip_bias_texture_3d_f32x4"
+	"sample_mip_bias_texture_3d_s32x4"
+	"sample_mip_bias_texture_3d_u32x4"
+	"sample_mip_bias_texture_3d_array_f32"
+	"sample_mip_bias_texture_3d_array_s32"
+	"sample_mip_bias_texture_3d_array_u32"
+	"sample_mip_bias_texture_3d_array_s64"
+	"sample_mip_bias_texture_3d_array_u64"
+	"sample_mip_bias_texture_3d_array_f32x2"
+	"sample_mip_bias_texture_3d_array_s32x2"
+	"sample_mip_bias_texture_3d_array_u32x2"
+	"sample_mip_bias_texture_3d_array_f32x3"
+	"sample_mip_bias_texture_3d_array_s32x3"
+	"sample_mip_bias_texture_3d_array_u32x3"
+	"sample_mip_bias_texture_3d_array_f32x4"
+	"sample_mip_bias_texture_3d_array_s32x4"
+	"sample_mip_bias_texture_3d_array_u32x4"
+	"sample_mip_bias_texture_3d_ms_f32"
+	"sample_mip_bias_texture_3d_ms_s32"
+	"sample_mip_bias_texture_3d_ms_u32"
+	"sample_mip_bias_texture_3d_ms_s64"
+	"sample_mip_bias_texture_3d_ms_u64"
+	"sample_mip_bias_texture_3d_ms_f32x2"
+	"sample_mip_bias_texture_3d_ms_s32x2"
+	"sample_mip_bias_texture_3d_ms_u32x2"
+	"sample_mip_bias_texture_3d_ms_f32x3"
+	"sample_mip_bias_texture_3d_ms_s32x3"
+	"sample_mip_bias_texture_3d_ms_u32x3"
+	"sample_mip_bias_texture_3d_ms_f32x4"
+	"sample_mip_bias_texture_3d_ms_s32x4"
+	"sample_mip_bias_texture_3d_ms_u32x4"
+	"sample_mip_bias_texture_3d_ms_array_f32"
+	"sample_mip_bias_texture_3d_ms_array_s32"
+	"sample_mip_bias_texture_3d_ms_array_u32"
+	"sample_mip_bias_texture_3d_ms_array_s64"
+	"sample_mip_bias_texture_3d_ms_array_u64"
+	"sample_mip_bias_texture_3d_ms_array_f32x2"
+	"sample_mip_bias_texture_3d_ms_array_s32x2"
+	"sample_mip_bias_texture_3d_ms_array_u32x2"
+	"sample_mip_bias_texture_3d_ms_array_f32x3"
+	"sample_mip_bias_texture_3d_ms_array_s32x3"
+	"sample_mip_bias_texture_3d_ms_array_u32x3"
+	"sample_mip_bias_texture_3d_ms_array_f32x4"
+	"sample_mip_bias_texture_3d_ms_array_s32x4"
+	"sample_mip_bias_texture_3d_ms_array_u32x4"
+	"sample_mip_bias_texture_cube_f32"
+	"sample_mip_bias_texture_cube_s32"
+	"sample_mip_bias_texture_cube_u32"
+	"sample_mip_bias_texture_cube_s64"
+	"sample_mip_bias_texture_cube_u64"
+	"sample_mip_bias_texture_cube_f32x2"
+	"sample_mip_bias_texture_cube_s32x2"
+	"sample_mip_bias_texture_cube_u32x2"
+	"sample_mip_bias_texture_cube_f32x3"
+	"sample_mip_bias_texture_cube_s32x3"
+	"sample_mip_bias_texture_cube_u32x3"
+	"sample_mip_bias_texture_cube_f32x4"
+	"sample_mip_bias_texture_cube_s32x4"
+	"sample_mip_bias_texture_cube_u32x4"
+	"sample_mip_bias_texture_cube_array_f32"
+	"sample_mip_bias_texture_cube_array_s32",
+	"sample_mip_bias_texture_cube_array_u32"
+	"sample_mip_bias_texture_cube_array_s64"
+	"sample_mip_bias_texture_cube_array_u64"
+	"sample_mip_bias_texture_cube_array_f32x2"
+	"sample_mip_bias_texture_cube_array_s32x2"
+	"sample_mip_bias_texture_cube_array_u32x2"
+	"sample_mip_bias_texture_cube_array_f32x3"
+	"sample_mip_bias_texture_cube_array_s32x3"
+	"sample_mip_bias_texture_cube_array_u32x3"
+	"sample_mip_bias_texture_cube_array_f32x4"
+	"sample_mip_bias_texture_cube_array_s32x4"
+	"sample_mip_bias_texture_cube_array_u32x4"
+	"sample_mip_bias_texture_cube_ms_f32"
+	"sample_mip_bias_texture_cube_ms_s32"
+	"sample_mip_bias_texture_cube_ms_u32"
+	"sample_mip_bias_texture_cube_ms_s64"
+	"sample_mip_bias_texture_cube_ms_u64"
+	"sample_mip_bias_texture_cube_ms_f32x2"
+	"sample_mip_bias_texture_cube_ms_s32x2"
+	"sample_mip_bias_texture_cube_ms_u32x2"
+	"sample_mip_bias_texture_cube_ms_f32x3"
+	"sample_mip_bias_texture_cube_ms_s32x3"
+	"sample_mip_bias_texture_cube_ms_u32x3"
+	"sample_mip_bias_texture_cube_ms_f32x4"
+	"sample_mip_bias_texture_cube_ms_s32x4"
+	"sample_mip_bias_texture_cube_ms_u32x4"
+	"sample_mip_bias_texture_cube_ms_array_f32"
+	"sample_mip_bias_texture_cube_ms_array_s32"
+	"sample_mip_bias_texture_cube_ms_array_u32"
+	"sample_mip_bias_texture_cube_ms_array_s64"
+	"sample_mip_bias_texture_cube_ms_array_u64"
+	"sample_mip_bias_texture_cube_ms_array_f32x2"
+	"sample_mip_bias_texture_cube_ms_array_s32x2"
+	"sample_mip_bias_texture_cube_ms_array_u32x2"
+	"sample_mip_bias_texture_cube_ms_array_f32x3"
+	"sample_mip_bias_texture_cube_ms_array_s32x3"
+	"sample_mip_bias_texture_cube_ms_array_u32x3"
+	"sample_mip_bias_texture_cube_ms_array_f32x4"
+	"sample_mip_bias_texture_cube_ms_array_s32x4"
+	"sample_mip_bias_texture_cube_ms_array_u32x4"
+	"sample_mip_gradient_texture_1d_f32"
+	"sample_mip_gradient_texture_1d_s32"
+	"sample_mip_gradient_texture_1d_u32"
+	"sample_mip_gradient_texture_1d_s64"
+	"sample_mip_gradient_texture_1d_u64"
+	"sample_mip_gradient_texture_1d_f32x2"
+	"sample_mip_gradient_texture_1d_s32x2"
+	"sample_mip_gradient_texture_1d_u32x2"
+	"sample_mip_gradient_texture_1d_f32x3"
+	"sample_mip_gradient_texture_1d_s32x3"
+	"sample_mip_gradient_texture_1d_u32x3"
+	"sample_mip_gradient_texture_1d_f32x4"
+	"sample_mip_gradient_texture_1d_s32x4"
+	"sample_mip_gradient_texture_1d_u32x4"
+	"sample_mip_gradient_texture_1d_array_f32"
+	"sample_mip_gradient_texture_1d_array_s32"
+	"sample_mip_gradient_texture_1d_array_u32"
+	"sample_mip_gradient_texture_1d_array_s64"
+	"sample_mip_gradient_texture_1d_array_u64"
+	"sample_mip_gradient_texture_1d_array_f32x2"
+	"sample_mip_gradient_texture_1d_array_s32x2"
+	"sample_mip_gradient_texture_1d_array_u32x2"
+	"sample_mip_gradient_texture_1d_array_f32x3"
+	"sample_mip_gradient_texture_1d_array_s32x3"
+	"sample_mip_gradient_texture_1d_array_u32x3"
+	"sample_mip_gradient_texture_1d_array_f32x4"
+	"sample_mip_gradient_texture_1d_array_s32x4"
+	"sample_mip_gradient_texture_1d_array_u32x4"
+	"sample_mip_gradient_texture_1d_ms_f32"
+	"sample_mip_gradient_texture_1d_ms_s32"
+	"sample_mip_gradient_texture_1d_ms_u32"
+	"sample_mip_gradient_texture_1d_ms_s64"
+	"sample_mip_gradient_texture_1d_ms_u64"
+	"sample_mip_gradient_texture_1d_ms_f32x2"
+	"sample_mip_gradient_texture_1d_ms_s32x2"
+	"sample_mip_gradient_texture_1d_ms_u32x2"
+	"sample_mip_gradient_texture_1d_ms_f32x3"
+	"sample_mip_gradient_texture_1d_ms_s32x3"
+	"sample_mip_gradient_texture_1d_ms_u32x3"
+	"sample_mip_gradient_texture_1d_ms_f32x4"
+	"sample_mip_gradient_texture_1d_ms_s32x4"
+	"sample_mip_gradient_texture_1d_ms_u32x4"
+	"sample_mip_gradient_texture_1d_ms_array_f32"
+	"sample_mip_gradient_texture_1d_ms_array_s32"
+	"sample_mip_gradient_texture_1d_ms_array_u32"
+	"sample_mip_gradient_texture_1d_ms_array_s64"
+	"sample_mip_gradient_texture_1d_ms_array_u64"
+	"sample_mip_gradient_texture_1d_ms_array_f32x2"
+	"sample_mip_gradient_texture_1d_ms_array_s32x2"
+	"sample_mip_gradient_texture_1d_ms_array_u32x2"
+	"sample_mip_gradient_texture_1d_ms_array_f32x3"
+	"sample_mip_gradient_texture_1d_ms_array_s32x3"
+	"sample_mip_gradient_texture_1d_ms_array_u32x3"
+	"sample_mip_gradient_texture_1d_ms_array_f32x4"
+	"sample_mip_gradient_texture_1d_ms_array_s32x4"
+	"sample_mip_gradient_texture_1d_ms_array_u32x4"
+	"sample_mip_gradient_texture_2d_f32"
+	"sample_mip_gradient_texture_2d_s32"
+	"sample_mip_gradient_texture_2d_u32"
+	"sample_mip_gradient_texture_2d_s64"
+	"sample_mip_gradient_texture_2d_u64"
+	"sample_mip_gradient_texture_2d_f32x2"
+	"sample_mip_gradient_texture_2d_s32x2"
+	"sample_mip_gradient_texture_2d_u32x2",
+	"sample_mip_gradient_texture_2d_f32x3"
+	"sample_mip_gradient_texture_2d_s32x3"
+	"sample_mip_gradient_texture_2d_u32x3"
+	"sample_mip_gradient_texture_2d_f32x4"
+	"sample_mip_gradient_texture_2d_s32x4"
+	"sample_mip_gradient_texture_2d_u32x4"
+	"sample_mip_gradient_texture_2d_array_f32"
+	"sample_mip_gradient_texture_2d_array_s32"
+	"sample_mip_gradient_texture_2d_array_u32"
+	"sample_mip_gradient_texture_2d_array_s64"
+	"sample_mip_gradient_texture_2d_array_u64"
+	"sample_mip_gradient_texture_2d_array_f32x2"
+	"sample_mip_gradient_texture_2d_array_s32x2"
+	"sample_mip_gradient_texture_2d_array_u32x2"
+	"sample_mip_gradient_texture_2d_array_f32x3"
+	"sample_mip_gradient_texture_2d_array_s32x3"
+	"sample_mip_gradient_texture_2d_array_u32x3"
+	"sample_mip_gradient_texture_2d_array_f32x4"
+	"sample_mip_gradient_texture_2d_array_s32x4"
+	"sample_mip_gradient_texture_2d_array_u32x4"
+	"sample_mip_gradient_texture_2d_ms_f32"
+	"sample_mip_gradient_texture_2d_ms_s32"
+	"sample_mip_gradient_texture_2d_ms_u32"
+	"sample_mip_gradient_texture_2d_ms_s64"
+	"sample_mip_gradient_texture_2d_ms_u64"
+	"sample_mip_gradient_texture_2d_ms_f32x2"
+	"sample_mip_gradient_texture_2d_ms_s32x2"
+	"sample_mip_gradient_texture_2d_ms_u32x2"
+	"sample_mip_gradient_texture_2d_ms_f32x3"
+	"sample_mip_gradient_texture_2d_ms_s32x3"
+	"sample_mip_gradient_texture_2d_ms_u32x3"
+	"sample_mip_gradient_texture_2d_ms_f32x4"
+	"sample_mip_gradient_texture_2d_ms_s32x4"
+	"sample_mip_gradient_texture_2d_ms_u32x4"
+	"sample_mip_gradient_texture_2d_ms_array_f32"
+	"sample_mip_gradient_texture_2d_ms_array_s32"
+	"sample_mip_gradient_texture_2d_ms_array_u32"
+	"sample_mip_gradient_texture_2d_ms_array_s64"
+	"sample_mip_gradient_texture_2d_ms_array_u64"
+	"sample_mip_gradient_texture_2d_ms_array_f32x2"
+	"sample_mip_gradient_texture_2d_ms_array_s32x2"
+	"sample_mip_gradient_texture_2d_ms_array_u32x2"
+	"sample_mip_gradient_texture_2d_ms_array_f32x3"
+	"sample_mip_gradient_texture_2d_ms_array_s32x3"
+	"sample_mip_gradient_texture_2d_ms_array_u32x3"
+	"sample_mip_gradient_texture_2d_ms_array_f32x4"
+	"sample_mip_gradient_texture_2d_ms_array_s32x4"
+	"sample_mip_gradient_texture_2d_ms_array_u32x4"
+	"sample_mip_gradient_texture_3d_f32"
+	"sample_mip_gradient_texture_3d_s32"
+	"sample_mip_gradient_texture_3d_u32"
+	"sample_mip_gradient_texture_3d_s64"
+	"sample_mip_gradient_texture_3d_u64"
+	"sample_mip_gradient_texture_3d_f32x2"
+	"sample_mip_gradient_texture_3d_s32x2"
+	"sample_mip_gradient_texture_3d_u32x2"
+	"sample_mip_gradient_texture_3d_f32x3"
+	"sample_mip_gradient_texture_3d_s32x3"
+	"sample_mip_gradient_texture_3d_u32x3"
+	"sample_mip_gradient_texture_3d_f32x4"
+	"sample_mip_gradient_texture_3d_s32x4"
+	"sample_mip_gradient_texture_3d_u32x4"
+	"sample_mip_gradient_texture_3d_array_f32"
+	"sample_mip_gradient_texture_3d_array_s32"
+	"sample_mip_gradient_texture_3d_array_u32"
+	"sample_mip_gradient_texture_3d_array_s64"
+	"sample_mip_gradient_texture_3d_array_u64"
+	"sample_mip_gradient_texture_3d_array_f32x2"
+	"sample_mip_gradient_texture_3d_array_s32x2"
+	"sample_mip_gradient_texture_3d_array_u32x2"
+	"sample_mip_gradient_texture_3d_array_f32x3"
+	"sample_mip_gradient_texture_3d_array_s32x3"
+	"sample_mip_gradient_texture_3d_array_u32x3"
+	"sample_mip_gradient_texture_3d_array_f32x4"
+	"sample_mip_gradient_texture_3d_array_s32x4"
+	"sample_mip_gradient_texture_3d_array_u32x4"
+	"sample_mip_gradient_texture_3d_ms_f32"
+	"sample_mip_gradient_texture_3d_ms_s32"
+	"sample_mip_gradient_texture_3d_ms_u32"
+	"sample_mip_gradient_texture_3d_ms_s64"
+	"sample_mip_gradient_texture_3d_ms_u64"
+	"sample_mip_gradient_texture_3d_ms_f32x2"
+	"sample_mip_gradient_texture_3d_ms_s32x2"
+	"sample_mip_gradient_texture_3d_ms_u32x2"
+	"sample_mip_gradient_texture_3d_ms_f32x3"
+	"sample_mip_gradient_texture_3d_ms_s32x3"
+	"sample_mip_gradient_texture_3d_ms_u32x3"
+	"sample_mip_gradient_texture_3d_ms_f32x4"
+	"sample_mip_gradient_texture_3d_ms_s32x4"
+	"sample_mip_gradient_texture_3d_ms_u32x4"
+	"sample_mip_gradient_texture_3d_ms_array_f32"
+	"sample_mip_gradient_texture_3d_ms_array_s32"
+	"sample_mip_gradient_texture_3d_ms_array_u32"
+	"sample_mip_gradient_texture_3d_ms_array_s64"
+	"sample_mip_gradient_texture_3d_ms_array_u64"
+	"sample_mip_gradient_texture_3d_ms_array_f32x2"
+	"sample_mip_gradient_texture_3d_ms_array_s32x2"
+	"sample_mip_gradient_texture_3d_ms_array_u32x2"
+	"sample_mip_gradient_texture_3d_ms_array_f32x3"
+	"sample_mip_gradient_texture_3d_ms_array_s32x3"
+	"sample_mip_gradient_texture_3d_ms_array_u32x3"
+	"sample_mip_gradient_texture_3d_ms_array_f32x4",
+	"sample_mip_gradient_texture_3d_ms_array_s32x4"
+	"sample_mip_gradient_texture_3d_ms_array_u32x4"
+	"sample_mip_gradient_texture_cube_f32"
+	"sample_mip_gradient_texture_cube_s32"
+	"sample_mip_gradient_texture_cube_u32"
+	"sample_mip_gradient_texture_cube_s64"
+	"sample_mip_gradient_texture_cube_u64"
+	"sample_mip_gradient_texture_cube_f32x2"
+	"sample_mip_gradient_texture_cube_s32x2"
+	"sample_mip_gradient_texture_cube_u32x2"
+	"sample_mip_gradient_texture_cube_f32x3"
+	"sample_mip_gradient_texture_cube_s32x3"
+	"sample_mip_gradient_texture_cube_u32x3"
+	"sample_mip_gradient_texture_cube_f32x4"
+	"sample_mip_gradient_texture_cube_s32x4"
+	"sample_mip_gradient_texture_cube_u32x4"
+	"sample_mip_gradient_texture_cube_array_f32"
+	"sample_mip_gradient_texture_cube_array_s32"
+	"sample_mip_gradient_texture_cube_array_u32"
+	"sample_mip_gradient_texture_cube_array_s64"
+	"sample_mip_gradient_texture_cube_array_u64"
+	"sample_mip_gradient_texture_cube_array_f32x2"
+	"sample_mip_gradient_texture_cube_array_s32x2"
+	"sample_mip_gradient_texture_cube_array_u32x2"
+	"sample_mip_gradient_texture_cube_array_f32x3"
+	"sample_mip_gradient_texture_cube_array_s32x3"
+	"sample_mip_gradient_texture_cube_array_u32x3"
+	"sample_mip_gradient_texture_cube_array_f32x4"
+	"sample_mip_gradient_texture_cube_array_s32x4"
+	"sample_mip_gradient_texture_cube_array_u32x4"
+	"sample_mip_gradient_texture_cube_ms_f32"
+	"sample_mip_gradient_texture_cube_ms_s32"
+	"sample_mip_gradient_texture_cube_ms_u32"
+	"sample_mip_gradient_texture_cube_ms_s64"
+	"sample_mip_gradient_texture_cube_ms_u64"
+	"sample_mip_gradient_texture_cube_ms_f32x2"
+	"sample_mip_gradient_texture_cube_ms_s32x2"
+	"sample_mip_gradient_texture_cube_ms_u32x2"
+	"sample_mip_gradient_texture_cube_ms_f32x3"
+	"sample_mip_gradient_texture_cube_ms_s32x3"
+	"sample_mip_gradient_texture_cube_ms_u32x3"
+	"sample_mip_gradient_texture_cube_ms_f32x4"
+	"sample_mip_gradient_texture_cube_ms_s32x4"
+	"sample_mip_gradient_texture_cube_ms_u32x4"
+	"sample_mip_gradient_texture_cube_ms_array_f32"
+	"sample_mip_gradient_texture_cube_ms_array_s32"
+	"sample_mip_gradient_texture_cube_ms_array_u32"
+	"sample_mip_gradient_texture_cube_ms_array_s64"
+	"sample_mip_gradient_texture_cube_ms_array_u64"
+	"sample_mip_gradient_texture_cube_ms_array_f32x2"
+	"sample_mip_gradient_texture_cube_ms_array_s32x2"
+	"sample_mip_gradient_texture_cube_ms_array_u32x2"
+	"sample_mip_gradient_texture_cube_ms_array_f32x3"
+	"sample_mip_gradient_texture_cube_ms_array_s32x3"
+	"sample_mip_gradient_texture_cube_ms_array_u32x3"
+	"sample_mip_gradient_texture_cube_ms_array_f32x4"
+	"sample_mip_gradient_texture_cube_ms_array_s32x4"
+	"sample_mip_gradient_texture_cube_ms_array_u32x4"
+	"sample_mip_level_texture_1d_f32"
+	"sample_mip_level_texture_1d_s32"
+	"sample_mip_level_texture_1d_u32"
+	"sample_mip_level_texture_1d_s64"
+	"sample_mip_level_texture_1d_u64"
+	"sample_mip_level_texture_1d_f32x2"
+	"sample_mip_level_texture_1d_s32x2"
+	"sample_mip_level_texture_1d_u32x2"
+	"sample_mip_level_texture_1d_f32x3"
+	"sample_mip_level_texture_1d_s32x3"
+	"sample_mip_level_texture_1d_u32x3"
+	"sample_mip_level_texture_1d_f32x4"
+	"sample_mip_level_texture_1d_s32x4"
+	"sample_mip_level_texture_1d_u32x4"
+	"sample_mip_level_texture_1d_array_f32"
+	"sample_mip_level_texture_1d_array_s32"
+	"sample_mip_level_texture_1d_array_u32"
+	"sample_mip_level_texture_1d_array_s64"
+	"sample_mip_level_texture_1d_array_u64"
+	"sample_mip_level_texture_1d_array_f32x2"
+	"sample_mip_level_texture_1d_array_s32x2"
+	"sample_mip_level_texture_1d_array_u32x2"
+	"sample_mip_level_texture_1d_array_f32x3"
+	"sample_mip_level_texture_1d_array_s32x3"
+	"sample_mip_level_texture_1d_array_u32x3"
+	"sample_mip_level_texture_1d_array_f32x4"
+	"sample_mip_level_texture_1d_array_s32x4"
+	"sample_mip_level_texture_1d_array_u32x4"
+	"sample_mip_level_texture_1d_ms_f32"
+	"sample_mip_level_texture_1d_ms_s32"
+	"sample_mip_level_texture_1d_ms_u32"
+	"sample_mip_level_texture_1d_ms_s64"
+	"sample_mip_level_texture_1d_ms_u64"
+	"sample_mip_level_texture_1d_ms_f32x2"
+	"sample_mip_level_texture_1d_ms_s32x2"
+	"sample_mip_level_texture_1d_ms_u32x2"
+	"sample_mip_level_texture_1d_ms_f32x3"
+	"sample_mip_level_texture_1d_ms_s32x3"
+	"sample_mip_level_texture_1d_ms_u32x3"
+	"sample_mip_level_texture_1d_ms_f32x4"
+	"sample_mip_level_texture_1d_ms_s32x4"
+	"sample_mip_level_texture_1d_ms_u32x4"
+	"sample_mip_level_texture_1d_ms_array_f32"
+	"sample_mip_level_texture_1d_ms_array_s32"
+	"sample_mip_level_texture_1d_ms_array_u32"
+	"sample_mip_level_texture_1d_ms_array_s64",
+	"sample_mip_level_texture_1d_ms_array_u64"
+	"sample_mip_level_texture_1d_ms_array_f32x2"
+	"sample_mip_level_texture_1d_ms_array_s32x2"
+	"sample_mip_level_texture_1d_ms_array_u32x2"
+	"sample_mip_level_texture_1d_ms_array_f32x3"
+	"sample_mip_level_texture_1d_ms_array_s32x3"
+	"sample_mip_level_texture_1d_ms_array_u32x3"
+	"sample_mip_level_texture_1d_ms_array_f32x4"
+	"sample_mip_level_texture_1d_ms_array_s32x4"
+	"sample_mip_level_texture_1d_ms_array_u32x4"
+	"sample_mip_level_texture_2d_f32"
+	"sample_mip_level_texture_2d_s32"
+	"sample_mip_level_texture_2d_u32"
+	"sample_mip_level_texture_2d_s64"
+	"sample_mip_level_texture_2d_u64"
+	"sample_mip_level_texture_2d_f32x2"
+	"sample_mip_level_texture_2d_s32x2"
+	"sample_mip_level_texture_2d_u32x2"
+	"sample_mip_level_texture_2d_f32x3"
+	"sample_mip_level_texture_2d_s32x3"
+	"sample_mip_level_texture_2d_u32x3"
+	"sample_mip_level_texture_2d_f32x4"
+	"sample_mip_level_texture_2d_s32x4"
+	"sample_mip_level_texture_2d_u32x4"
+	"sample_mip_level_texture_2d_array_f32"
+	"sample_mip_level_texture_2d_array_s32"
+	"sample_mip_level_texture_2d_array_u32"
+	"sample_mip_level_texture_2d_array_s64"
+	"sample_mip_level_texture_2d_array_u64"
+	"sample_mip_level_texture_2d_array_f32x2"
+	"sample_mip_level_texture_2d_array_s32x2"
+	"sample_mip_level_texture_2d_array_u32x2"
+	"sample_mip_level_texture_2d_array_f32x3"
+	"sample_mip_level_texture_2d_array_s32x3"
+	"sample_mip_level_texture_2d_array_u32x3"
+	"sample_mip_level_texture_2d_array_f32x4"
+	"sample_mip_level_texture_2d_array_s32x4"
+	"sample_mip_level_texture_2d_array_u32x4"
+	"sample_mip_level_texture_2d_ms_f32"
+	"sample_mip_level_texture_2d_ms_s32"
+	"sample_mip_level_texture_2d_ms_u32"
+	"sample_mip_level_texture_2d_ms_s64"
+	"sample_mip_level_texture_2d_ms_u64"
+	"sample_mip_level_texture_2d_ms_f32x2"
+	"sample_mip_level_texture_2d_ms_s32x2"
+	"sample_mip_level_texture_2d_ms_u32x2"
+	"sample_mip_level_texture_2d_ms_f32x3"
+	"sample_mip_level_texture_2d_ms_s32x3"
+	"sample_mip_level_texture_2d_ms_u32x3"
+	"sample_mip_level_texture_2d_ms_f32x4"
+	"sample_mip_level_texture_2d_ms_s32x4"
+	"sample_mip_level_texture_2d_ms_u32x4"
+	"sample_mip_level_texture_2d_ms_array_f32"
+	"sample_mip_level_texture_2d_ms_array_s32"
+	"sample_mip_level_texture_2d_ms_array_u32"
+	"sample_mip_level_texture_2d_ms_array_s64"
+	"sample_mip_level_texture_2d_ms_array_u64"
+	"sample_mip_level_texture_2d_ms_array_f32x2"
+	"sample_mip_level_texture_2d_ms_array_s32x2"
+	"sample_mip_level_texture_2d_ms_array_u32x2"
+	"sample_mip_level_texture_2d_ms_array_f32x3"
+	"sample_mip_level_texture_2d_ms_array_s32x3"
+	"sample_mip_level_texture_2d_ms_array_u32x3"
+	"sample_mip_level_texture_2d_ms_array_f32x4"
+	"sample_mip_level_texture_2d_ms_array_s32x4"
+	"sample_mip_level_texture_2d_ms_array_u32x4"
+	"sample_mip_level_texture_3d_f32"
+	"sample_mip_level_texture_3d_s32"
+	"sample_mip_level_texture_3d_u32"
+	"sample_mip_level_texture_3d_s64"
+	"sample_mip_level_texture_3d_u64"
+	"sample_mip_level_texture_3d_f32x2"
+	"sample_mip_level_texture_3d_s32x2"
+	"sample_mip_level_texture_3d_u32x2"
+	"sample_mip_level_texture_3d_f32x3"
+	"sample_mip_level_texture_3d_s32x3"
+	"sample_mip_level_texture_3d_u32x3"
+	"sample_mip_level_texture_3d_f32x4"
+	"sample_mip_level_texture_3d_s32x4"
+	"sample_mip_level_texture_3d_u32x4"
+	"sample_mip_level_texture_3d_array_f32"
+	"sample_mip_level_texture_3d_array_s32"
+	"sample_mip_level_texture_3d_array_u32"
+	"sample_mip_level_texture_3d_array_s64"
+	"sample_mip_level_texture_3d_array_u64"
+	"sample_mip_level_texture_3d_array_f32x2"
+	"sample_mip_level_texture_3d_array_s32x2"
+	"sample_mip_level_texture_3d_array_u32x2"
+	"sample_mip_level_texture_3d_array_f32x3"
+	"sample_mip_level_texture_3d_array_s32x3"
+	"sample_mip_level_texture_3d_array_u32x3"
+	"sample_mip_level_texture_3d_array_f32x4"
+	"sample_mip_level_texture_3d_array_s32x4"
+	"sample_mip_level_texture_3d_array_u32x4"
+	"sample_mip_level_texture_3d_ms_f32"
+	"sample_mip_level_texture_3d_ms_s32"
+	"sample_mip_level_texture_3d_ms_u32"
+	"sample_mip_level_texture_3d_ms_s64"
+	"sample_mip_level_texture_3d_ms_u64"
+	"sample_mip_level_texture_3d_ms_f32x2"
+	"sample_mip_level_texture_3d_ms_s32x2"
+	"sample_mip_level_texture_3d_ms_u32x2"
+	"sample_mip_level_texture_3d_ms_f32x3"
+	"sample_mip_level_texture_3d_ms_s32x3"
+	"sample_mip_level_texture_3d_ms_u32x3"
+	"sample_mip_level_texture_3d_ms_f32x4"
+	"sample_mip_level_texture_3d_ms_s32x4"
+	"sample_mip_level_texture_3d_ms_u32x4"
+	"sample_mip_level_texture_3d_ms_array_f32"
+	"sample_mip_level_texture_3d_ms_array_s32"
+	"sample_mip_level_texture_3d_ms_array_u32",
+	"sample_mip_level_texture_3d_ms_array_s64"
+	"sample_mip_level_texture_3d_ms_array_u64"
+	"sample_mip_level_texture_3d_ms_array_f32x2"
+	"sample_mip_level_texture_3d_ms_array_s32x2"
+	"sample_mip_level_texture_3d_ms_array_u32x2"
+	"sample_mip_level_texture_3d_ms_array_f32x3"
+	"sample_mip_level_texture_3d_ms_array_s32x3"
+	"sample_mip_level_texture_3d_ms_array_u32x3"
+	"sample_mip_level_texture_3d_ms_array_f32x4"
+	"sample_mip_level_texture_3d_ms_array_s32x4"
+	"sample_mip_level_texture_3d_ms_array_u32x4"
+	"sample_mip_level_texture_cube_f32"
+	"sample_mip_level_texture_cube_s32"
+	"sample_mip_level_texture_cube_u32"
+	"sample_mip_level_texture_cube_s64"
+	"sample_mip_level_texture_cube_u64"
+	"sample_mip_level_texture_cube_f32x2"
+	"sample_mip_level_texture_cube_s32x2"
+	"sample_mip_level_texture_cube_u32x2"
+	"sample_mip_level_texture_cube_f32x3"
+	"sample_mip_level_texture_cube_s32x3"
+	"sample_mip_level_texture_cube_u32x3"
+	"sample_mip_level_texture_cube_f32x4"
+	"sample_mip_level_texture_cube_s32x4"
+	"sample_mip_level_texture_cube_u32x4"
+	"sample_mip_level_texture_cube_array_f32"
+	"sample_mip_level_texture_cube_array_s32"
+	"sample_mip_level_texture_cube_array_u32"
+	"sample_mip_level_texture_cube_array_s64"
+	"sample_mip_level_texture_cube_array_u64"
+	"sample_mip_level_texture_cube_array_f32x2"
+	"sample_mip_level_texture_cube_array_s32x2"
+	"sample_mip_level_texture_cube_array_u32x2"
+	"sample_mip_level_texture_cube_array_f32x3"
+	"sample_mip_level_texture_cube_array_s32x3"
+	"sample_mip_level_texture_cube_array_u32x3"
+	"sample_mip_level_texture_cube_array_f32x4"
+	"sample_mip_level_texture_cube_array_s32x4"
+	"sample_mip_level_texture_cube_array_u32x4"
+	"sample_mip_level_texture_cube_ms_f32"
+	"sample_mip_level_texture_cube_ms_s32"
+	"sample_mip_level_texture_cube_ms_u32"
+	"sample_mip_level_texture_cube_ms_s64"
+	"sample_mip_level_texture_cube_ms_u64"
+	"sample_mip_level_texture_cube_ms_f32x2"
+	"sample_mip_level_texture_cube_ms_s32x2"
+	"sample_mip_level_texture_cube_ms_u32x2"
+	"sample_mip_level_texture_cube_ms_f32x3"
+	"sample_mip_level_texture_cube_ms_s32x3"
+	"sample_mip_level_texture_cube_ms_u32x3"
+	"sample_mip_level_texture_cube_ms_f32x4"
+	"sample_mip_level_texture_cube_ms_s32x4"
+	"sample_mip_level_texture_cube_ms_u32x4"
+	"sample_mip_level_texture_cube_ms_array_f32"
+	"sample_mip_level_texture_cube_ms_array_s32"
+	"sample_mip_level_texture_cube_ms_array_u32"
+	"sample_mip_level_texture_cube_ms_array_s64"
+	"sample_mip_level_texture_cube_ms_array_u64"
+	"sample_mip_level_texture_cube_ms_array_f32x2"
+	"sample_mip_level_texture_cube_ms_array_s32x2"
+	"sample_mip_level_texture_cube_ms_array_u32x2"
+	"sample_mip_level_texture_cube_ms_array_f32x3"
+	"sample_mip_level_texture_cube_ms_array_s32x3"
+	"sample_mip_level_texture_cube_ms_array_u32x3"
+	"sample_mip_level_texture_cube_ms_array_f32x4"
+	"sample_mip_level_texture_cube_ms_array_s32x4"
+	"sample_mip_level_texture_cube_ms_array_u32x4"
+	"gather_red_texture_1d_f32"
+	"gather_red_texture_1d_s32"
+	"gather_red_texture_1d_u32"
+	"gather_red_texture_1d_s64"
+	"gather_red_texture_1d_u64"
+	"gather_red_texture_1d_f32x2"
+	"gather_red_texture_1d_s32x2"
+	"gather_red_texture_1d_u32x2"
+	"gather_red_texture_1d_f32x3"
+	"gather_red_texture_1d_s32x3"
+	"gather_red_texture_1d_u32x3"
+	"gather_red_texture_1d_f32x4"
+	"gather_red_texture_1d_s32x4"
+	"gather_red_texture_1d_u32x4"
+	"gather_red_texture_1d_array_f32"
+	"gather_red_texture_1d_array_s32"
+	"gather_red_texture_1d_array_u32"
+	"gather_red_texture_1d_array_s64"
+	"gather_red_texture_1d_array_u64"
+	"gather_red_texture_1d_array_f32x2"
+	"gather_red_texture_1d_array_s32x2"
+	"gather_red_texture_1d_array_u32x2"
+	"gather_red_texture_1d_array_f32x3"
+	"gather_red_texture_1d_array_s32x3"
+	"gather_red_texture_1d_array_u32x3"
+	"gather_red_texture_1d_array_f32x4"
+	"gather_red_texture_1d_array_s32x4"
+	"gather_red_texture_1d_array_u32x4"
+	"gather_red_texture_1d_ms_f32"
+	"gather_red_texture_1d_ms_s32"
+	"gather_red_texture_1d_ms_u32"
+	"gather_red_texture_1d_ms_s64"
+	"gather_red_texture_1d_ms_u64"
+	"gather_red_texture_1d_ms_f32x2"
+	"gather_red_texture_1d_ms_s32x2"
+	"gather_red_texture_1d_ms_u32x2"
+	"gather_red_texture_1d_ms_f32x3"
+	"gather_red_texture_1d_ms_s32x3"
+	"gather_red_texture_1d_ms_u32x3"
+	"gather_red_texture_1d_ms_f32x4"
+	"gather_red_texture_1d_ms_s32x4"
+	"gather_red_texture_1d_ms_u32x4"
+	"gather_red_texture_1d_ms_array_f32"
+	"gather_red_texture_1d_ms_array_s32"
+	"gather_red_texture_1d_ms_array_u32"
+	"gather_red_texture_1d_ms_array_s64"
+	"gather_red_texture_1d_ms_array_u64"
+	"gather_red_texture_1d_ms_array_f32x2",
+	"gather_red_texture_1d_ms_array_s32x2"
+	"gather_red_texture_1d_ms_array_u32x2"
+	"gather_red_texture_1d_ms_array_f32x3"
+	"gather_red_texture_1d_ms_array_s32x3"
+	"gather_red_texture_1d_ms_array_u32x3"
+	"gather_red_texture_1d_ms_array_f32x4"
+	"gather_red_texture_1d_ms_array_s32x4"
+	"gather_red_texture_1d_ms_array_u32x4"
+	"gather_red_texture_2d_f32"
+	"gather_red_texture_2d_s32"
+	"gather_red_texture_2d_u32"
+	"gather_red_texture_2d_s64"
+	"gather_red_texture_2d_u64"
+	"gather_red_texture_2d_f32x2"
+	"gather_red_texture_2d_s32x2"
+	"gather_red_texture_2d_u32x2"
+	"gather_red_texture_2d_f32x3"
+	"gather_red_texture_2d_s32x3"
+	"gather_red_texture_2d_u32x3"
+	"gather_red_texture_2d_f32x4"
+	"gather_red_texture_2d_s32x4"
+	"gather_red_texture_2d_u32x4"
+	"gather_red_texture_2d_array_f32"
+	"gather_red_texture_2d_array_s32"
+	"gather_red_texture_2d_array_u32"
+	"gather_red_texture_2d_array_s64"
+	"gather_red_texture_2d_array_u64"
+	"gather_red_texture_2d_array_f32x2"
+	"gather_red_texture_2d_array_s32x2"
+	"gather_red_texture_2d_array_u32x2"
+	"gather_red_texture_2d_array_f32x3"
+	"gather_red_texture_2d_array_s32x3"
+	"gather_red_texture_2d_array_u32x3"
+	"gather_red_texture_2d_array_f32x4"
+	"gather_red_texture_2d_array_s32x4"
+	"gather_red_texture_2d_array_u32x4"
+	"gather_red_texture_2d_ms_f32"
+	"gather_red_texture_2d_ms_s32"
+	"gather_red_texture_2d_ms_u32"
+	"gather_red_texture_2d_ms_s64"
+	"gather_red_texture_2d_ms_u64"
+	"gather_red_texture_2d_ms_f32x2"
+	"gather_red_texture_2d_ms_s32x2"
+	"gather_red_texture_2d_ms_u32x2"
+	"gather_red_texture_2d_ms_f32x3"
+	"gather_red_texture_2d_ms_s32x3"
+	"gather_red_texture_2d_ms_u32x3"
+	"gather_red_texture_2d_ms_f32x4"
+	"gather_red_texture_2d_ms_s32x4"
+	"gather_red_texture_2d_ms_u32x4"
+	"gather_red_texture_2d_ms_array_f32"
+	"gather_red_texture_2d_ms_array_s32"
+	"gather_red_texture_2d_ms_array_u32"
+	"gather_red_texture_2d_ms_array_s64"
+	"gather_red_texture_2d_ms_array_u64"
+	"gather_red_texture_2d_ms_array_f32x2"
+	"gather_red_texture_2d_ms_array_s32x2"
+	"gather_red_texture_2d_ms_array_u32x2"
+	"gather_red_texture_2d_ms_array_f32x3"
+	"gather_red_texture_2d_ms_array_s32x3"
+	"gather_red_texture_2d_ms_array_u32x3"
+	"gather_red_texture_2d_ms_array_f32x4"
+	"gather_red_texture_2d_ms_array_s32x4"
+	"gather_red_texture_2d_ms_array_u32x4"
+	"gather_red_texture_3d_f32"
+	"gather_red_texture_3d_s32"
+	"gather_red_texture_3d_u32"
+	"gather_red_texture_3d_s64"
+	"gather_red_texture_3d_u64"
+	"gather_red_texture_3d_f32x2"
+	"gather_red_texture_3d_s32x2"
+	"gather_red_texture_3d_u32x2"
+	"gather_red_texture_3d_f32x3"
+	"gather_red_texture_3d_s32x3"
+	"gather_red_texture_3d_u32x3"
+	"gather_red_texture_3d_f32x4"
+	"gather_red_texture_3d_s32x4"
+	"gather_red_texture_3d_u32x4"
+	"gather_red_texture_3d_array_f32"
+	"gather_red_texture_3d_array_s32"
+	"gather_red_texture_3d_array_u32"
+	"gather_red_texture_3d_array_s64"
+	"gather_red_texture_3d_array_u64"
+	"gather_red_texture_3d_array_f32x2"
+	"gather_red_texture_3d_array_s32x2"
+	"gather_red_texture_3d_array_u32x2"
+	"gather_red_texture_3d_array_f32x3"
+	"gather_red_texture_3d_array_s32x3"
+	"gather_red_texture_3d_array_u32x3"
+	"gather_red_texture_3d_array_f32x4"
+	"gather_red_texture_3d_array_s32x4"
+	"gather_red_texture_3d_array_u32x4"
+	"gather_red_texture_3d_ms_f32"
+	"gather_red_texture_3d_ms_s32"
+	"gather_red_texture_3d_ms_u32"
+	"gather_red_texture_3d_ms_s64"
+	"gather_red_texture_3d_ms_u64"
+	"gather_red_texture_3d_ms_f32x2"
+	"gather_red_texture_3d_ms_s32x2"
+	"gather_red_texture_3d_ms_u32x2"
+	"gather_red_texture_3d_ms_f32x3"
+	"gather_red_texture_3d_ms_s32x3"
+	"gather_red_texture_3d_ms_u32x3"
+	"gather_red_texture_3d_ms_f32x4"
+	"gather_red_texture_3d_ms_s32x4"
+	"gather_red_texture_3d_ms_u32x4"
+	"gather_red_texture_3d_ms_array_f32"
+	"gather_red_texture_3d_ms_array_s32"
+	"gather_red_texture_3d_ms_array_u32"
+	"gather_red_texture_3d_ms_array_s64"
+	"gather_red_texture_3d_ms_array_u64"
+	"gather_red_texture_3d_ms_array_f32x2"
+	"gather_red_texture_3d_ms_array_s32x2"
+	"gather_red_texture_3d_ms_array_u32x2"
+	"gather_red_texture_3d_ms_array_f32x3"
+	"gather_red_texture_3d_ms_array_s32x3"
+	"gather_red_texture_3d_ms_array_u32x3"
+	"gather_red_texture_3d_ms_array_f32x4"
+	"gather_red_texture_3d_ms_array_s32x4"
+	"gather_red_texture_3d_ms_array_u32x4"
+	"gather_red_texture_cube_f32"
+	"gather_red_texture_cube_s32"
+	"gather_red_texture_cube_u32"
+	"gather_red_texture_cube_s64"
+	"gather_red_texture_cube_u64"
+	"gather_red_texture_cube_f32x2"
+	"gather_red_texture_cube_s32x2"
+	"gather_red_texture_cube_u32x2"
+	"gather_red_texture_cube_f32x3"
+	"gather_red_texture_cube_s32x3"
+	"gather_red_texture_cube_u32x3"
+	"gather_red_texture_cube_f32x4",
+	"gather_red_texture_cube_s32x4"
+	"gather_red_texture_cube_u32x4"
+	"gather_red_texture_cube_array_f32"
+	"gather_red_texture_cube_array_s32"
+	"gather_red_texture_cube_array_u32"
+	"gather_red_texture_cube_array_s64"
+	"gather_red_texture_cube_array_u64"
+	"gather_red_texture_cube_array_f32x2"
+	"gather_red_texture_cube_array_s32x2"
+	"gather_red_texture_cube_array_u32x2"
+	"gather_red_texture_cube_array_f32x3"
+	"gather_red_texture_cube_array_s32x3"
+	"gather_red_texture_cube_array_u32x3"
+	"gather_red_texture_cube_array_f32x4"
+	"gather_red_texture_cube_array_s32x4"
+	"gather_red_texture_cube_array_u32x4"
+	"gather_red_texture_cube_ms_f32"
+	"gather_red_texture_cube_ms_s32"
+	"gather_red_texture_cube_ms_u32"
+	"gather_red_texture_cube_ms_s64"
+	"gather_red_texture_cube_ms_u64"
+	"gather_red_texture_cube_ms_f32x2"
+	"gather_red_texture_cube_ms_s32x2"
+	"gather_red_texture_cube_ms_u32x2"
+	"gather_red_texture_cube_ms_f32x3"
+	"gather_red_texture_cube_ms_s32x3"
+	"gather_red_texture_cube_ms_u32x3"
+	"gather_red_texture_cube_ms_f32x4"
+	"gather_red_texture_cube_ms_s32x4"
+	"gather_red_texture_cube_ms_u32x4"
+	"gather_red_texture_cube_ms_array_f32"
+	"gather_red_texture_cube_ms_array_s32"
+	"gather_red_texture_cube_ms_array_u32"
+	"gather_red_texture_cube_ms_array_s64"
+	"gather_red_texture_cube_ms_array_u64"
+	"gather_red_texture_cube_ms_array_f32x2"
+	"gather_red_texture_cube_ms_array_s32x2"
+	"gather_red_texture_cube_ms_array_u32x2"
+	"gather_red_texture_cube_ms_array_f32x3"
+	"gather_red_texture_cube_ms_array_s32x3"
+	"gather_red_texture_cube_ms_array_u32x3"
+	"gather_red_texture_cube_ms_array_f32x4"
+	"gather_red_texture_cube_ms_array_s32x4"
+	"gather_red_texture_cube_ms_array_u32x4"
+	"gather_green_texture_1d_f32"
+	"gather_green_texture_1d_s32"
+	"gather_green_texture_1d_u32"
+	"gather_green_texture_1d_s64"
+	"gather_green_texture_1d_u64"
+	"gather_green_texture_1d_f32x2"
+	"gather_green_texture_1d_s32x2"
+	"gather_green_texture_1d_u32x2"
+	"gather_green_texture_1d_f32x3"
+	"gather_green_texture_1d_s32x3"
+	"gather_green_texture_1d_u32x3"
+	"gather_green_texture_1d_f32x4"
+	"gather_green_texture_1d_s32x4"
+	"gather_green_texture_1d_u32x4"
+	"gather_green_texture_1d_array_f32"
+	"gather_green_texture_1d_array_s32"
+	"gather_green_texture_1d_array_u32"
+	"gather_green_texture_1d_array_s64"
+	"gather_green_texture_1d_array_u64"
+	"gather_green_texture_1d_array_f32x2"
+	"gather_green_texture_1d_array_s32x2"
+	"gather_green_texture_1d_array_u32x2"
+	"gather_green_texture_1d_array_f32x3"
+	"gather_green_texture_1d_array_s32x3"
+	"gather_green_texture_1d_array_u32x3"
+	"gather_green_texture_1d_array_f32x4"
+	"gather_green_texture_1d_array_s32x4"
+	"gather_green_texture_1d_array_u32x4"
+	"gather_green_texture_1d_ms_f32"
+	"gather_green_texture_1d_ms_s32"
+	"gather_green_texture_1d_ms_u32"
+	"gather_green_texture_1d_ms_s64"
+	"gather_green_texture_1d_ms_u64"
+	"gather_green_texture_1d_ms_f32x2"
+	"gather_green_texture_1d_ms_s32x2"
+	"gather_green_texture_1d_ms_u32x2"
+	"gather_green_texture_1d_ms_f32x3"
+	"gather_green_texture_1d_ms_s32x3"
+	"gather_green_texture_1d_ms_u32x3"
+	"gather_green_texture_1d_ms_f32x4"
+	"gather_green_texture_1d_ms_s32x4"
+	"gather_green_texture_1d_ms_u32x4"
+	"gather_green_texture_1d_ms_array_f32"
+	"gather_green_texture_1d_ms_array_s32"
+	"gather_green_texture_1d_ms_array_u32"
+	"gather_green_texture_1d_ms_array_s64"
+	"gather_green_texture_1d_ms_array_u64"
+	"gather_green_texture_1d_ms_array_f32x2"
+	"gather_green_texture_1d_ms_array_s32x2"
+	"gather_green_texture_1d_ms_array_u32x2"
+	"gather_green_texture_1d_ms_array_f32x3"
+	"gather_green_texture_1d_ms_array_s32x3"
+	"gather_green_texture_1d_ms_array_u32x3"
+	"gather_green_texture_1d_ms_array_f32x4"
+	"gather_green_texture_1d_ms_array_s32x4"
+	"gather_green_texture_1d_ms_array_u32x4"
+	"gather_green_texture_2d_f32"
+	"gather_green_texture_2d_s32"
+	"gather_green_texture_2d_u32"
+	"gather_green_texture_2d_s64"
+	"gather_green_texture_2d_u64"
+	"gather_green_texture_2d_f32x2"
+	"gather_green_texture_2d_s32x2"
+	"gather_green_texture_2d_u32x2"
+	"gather_green_texture_2d_f32x3"
+	"gather_green_texture_2d_s32x3"
+	"gather_green_texture_2d_u32x3"
+	"gather_green_texture_2d_f32x4"
+	"gather_green_texture_2d_s32x4"
+	"gather_green_texture_2d_u32x4"
+	"gather_green_texture_2d_array_f32"
+	"gather_green_texture_2d_array_s32"
+	"gather_green_texture_2d_array_u32"
+	"gather_green_texture_2d_array_s64"
+	"gather_green_texture_2d_array_u64"
+	"gather_green_texture_2d_array_f32x2"
+	"gather_green_texture_2d_array_s32x2"
+	"gather_green_texture_2d_array_u32x2"
+	"gather_green_texture_2d_array_f32x3"
+	"gather_green_texture_2d_array_s32x3",
+	"gather_green_texture_2d_array_u32x3"
+	"gather_green_texture_2d_array_f32x4"
+	"gather_green_texture_2d_array_s32x4"
+	"gather_green_texture_2d_array_u32x4"
+	"gather_green_texture_2d_ms_f32"
+	"gather_green_texture_2d_ms_s32"
+	"gather_green_texture_2d_ms_u32"
+	"gather_green_texture_2d_ms_s64"
+	"gather_green_texture_2d_ms_u64"
+	"gather_green_texture_2d_ms_f32x2"
+	"gather_green_texture_2d_ms_s32x2"
+	"gather_green_texture_2d_ms_u32x2"
+	"gather_green_texture_2d_ms_f32x3"
+	"gather_green_texture_2d_ms_s32x3"
+	"gather_green_texture_2d_ms_u32x3"
+	"gather_green_texture_2d_ms_f32x4"
+	"gather_green_texture_2d_ms_s32x4"
+	"gather_green_texture_2d_ms_u32x4"
+	"gather_green_texture_2d_ms_array_f32"
+	"gather_green_texture_2d_ms_array_s32"
+	"gather_green_texture_2d_ms_array_u32"
+	"gather_green_texture_2d_ms_array_s64"
+	"gather_green_texture_2d_ms_array_u64"
+	"gather_green_texture_2d_ms_array_f32x2"
+	"gather_green_texture_2d_ms_array_s32x2"
+	"gather_green_texture_2d_ms_array_u32x2"
+	"gather_green_texture_2d_ms_array_f32x3"
+	"gather_green_texture_2d_ms_array_s32x3"
+	"gather_green_texture_2d_ms_array_u32x3"
+	"gather_green_texture_2d_ms_array_f32x4"
+	"gather_green_texture_2d_ms_array_s32x4"
+	"gather_green_texture_2d_ms_array_u32x4"
+	"gather_green_texture_3d_f32"
+	"gather_green_texture_3d_s32"
+	"gather_green_texture_3d_u32"
+	"gather_green_texture_3d_s64"
+	"gather_green_texture_3d_u64"
+	"gather_green_texture_3d_f32x2"
+	"gather_green_texture_3d_s32x2"
+	"gather_green_texture_3d_u32x2"
+	"gather_green_texture_3d_f32x3"
+	"gather_green_texture_3d_s32x3"
+	"gather_green_texture_3d_u32x3"
+	"gather_green_texture_3d_f32x4"
+	"gather_green_texture_3d_s32x4"
+	"gather_green_texture_3d_u32x4"
+	"gather_green_texture_3d_array_f32"
+	"gather_green_texture_3d_array_s32"
+	"gather_green_texture_3d_array_u32"
+	"gather_green_texture_3d_array_s64"
+	"gather_green_texture_3d_array_u64"
+	"gather_green_texture_3d_array_f32x2"
+	"gather_green_texture_3d_array_s32x2"
+	"gather_green_texture_3d_array_u32x2"
+	"gather_green_texture_3d_array_f32x3"
+	"gather_green_texture_3d_array_s32x3"
+	"gather_green_texture_3d_array_u32x3"
+	"gather_green_texture_3d_array_f32x4"
+	"gather_green_texture_3d_array_s32x4"
+	"gather_green_texture_3d_array_u32x4"
+	"gather_green_texture_3d_ms_f32"
+	"gather_green_texture_3d_ms_s32"
+	"gather_green_texture_3d_ms_u32"
+	"gather_green_texture_3d_ms_s64"
+	"gather_green_texture_3d_ms_u64"
+	"gather_green_texture_3d_ms_f32x2"
+	"gather_green_texture_3d_ms_s32x2"
+	"gather_green_texture_3d_ms_u32x2"
+	"gather_green_texture_3d_ms_f32x3"
+	"gather_green_texture_3d_ms_s32x3"
+	"gather_green_texture_3d_ms_u32x3"
+	"gather_green_texture_3d_ms_f32x4"
+	"gather_green_texture_3d_ms_s32x4"
+	"gather_green_texture_3d_ms_u32x4"
+	"gather_green_texture_3d_ms_array_f32"
+	"gather_green_texture_3d_ms_array_s32"
+	"gather_green_texture_3d_ms_array_u32"
+	"gather_green_texture_3d_ms_array_s64"
+	"gather_green_texture_3d_ms_array_u64"
+	"gather_green_texture_3d_ms_array_f32x2"
+	"gather_green_texture_3d_ms_array_s32x2"
+	"gather_green_texture_3d_ms_array_u32x2"
+	"gather_green_texture_3d_ms_array_f32x3"
+	"gather_green_texture_3d_ms_array_s32x3"
+	"gather_green_texture_3d_ms_array_u32x3"
+	"gather_green_texture_3d_ms_array_f32x4"
+	"gather_green_texture_3d_ms_array_s32x4"
+	"gather_green_texture_3d_ms_array_u32x4"
+	"gather_green_texture_cube_f32"
+	"gather_green_texture_cube_s32"
+	"gather_green_texture_cube_u32"
+	"gather_green_texture_cube_s64"
+	"gather_green_texture_cube_u64"
+	"gather_green_texture_cube_f32x2"
+	"gather_green_texture_cube_s32x2"
+	"gather_green_texture_cube_u32x2"
+	"gather_green_texture_cube_f32x3"
+	"gather_green_texture_cube_s32x3"
+	"gather_green_texture_cube_u32x3"
+	"gather_green_texture_cube_f32x4"
+	"gather_green_texture_cube_s32x4"
+	"gather_green_texture_cube_u32x4"
+	"gather_green_texture_cube_array_f32"
+	"gather_green_texture_cube_array_s32"
+	"gather_green_texture_cube_array_u32"
+	"gather_green_texture_cube_array_s64"
+	"gather_green_texture_cube_array_u64"
+	"gather_green_texture_cube_array_f32x2"
+	"gather_green_texture_cube_array_s32x2"
+	"gather_green_texture_cube_array_u32x2"
+	"gather_green_texture_cube_array_f32x3"
+	"gather_green_texture_cube_array_s32x3"
+	"gather_green_texture_cube_array_u32x3"
+	"gather_green_texture_cube_array_f32x4"
+	"gather_green_texture_cube_array_s32x4"
+	"gather_green_texture_cube_array_u32x4"
+	"gather_green_texture_cube_ms_f32"
+	"gather_green_texture_cube_ms_s32"
+	"gather_green_texture_cube_ms_u32"
+	"gather_green_texture_cube_ms_s64"
+	"gather_green_texture_cube_ms_u64"
+	"gather_green_texture_cube_ms_f32x2",
+	"gather_green_texture_cube_ms_s32x2"
+	"gather_green_texture_cube_ms_u32x2"
+	"gather_green_texture_cube_ms_f32x3"
+	"gather_green_texture_cube_ms_s32x3"
+	"gather_green_texture_cube_ms_u32x3"
+	"gather_green_texture_cube_ms_f32x4"
+	"gather_green_texture_cube_ms_s32x4"
+	"gather_green_texture_cube_ms_u32x4"
+	"gather_green_texture_cube_ms_array_f32"
+	"gather_green_texture_cube_ms_array_s32"
+	"gather_green_texture_cube_ms_array_u32"
+	"gather_green_texture_cube_ms_array_s64"
+	"gather_green_texture_cube_ms_array_u64"
+	"gather_green_texture_cube_ms_array_f32x2"
+	"gather_green_texture_cube_ms_array_s32x2"
+	"gather_green_texture_cube_ms_array_u32x2"
+	"gather_green_texture_cube_ms_array_f32x3"
+	"gather_green_texture_cube_ms_array_s32x3"
+	"gather_green_texture_cube_ms_array_u32x3"
+	"gather_green_texture_cube_ms_array_f32x4"
+	"gather_green_texture_cube_ms_array_s32x4"
+	"gather_green_texture_cube_ms_array_u32x4"
+	"gather_blue_texture_1d_f32"
+	"gather_blue_texture_1d_s32"
+	"gather_blue_texture_1d_u32"
+	"gather_blue_texture_1d_s64"
+	"gather_blue_texture_1d_u64"
+	"gather_blue_texture_1d_f32x2"
+	"gather_blue_texture_1d_s32x2"
+	"gather_blue_texture_1d_u32x2"
+	"gather_blue_texture_1d_f32x3"
+	"gather_blue_texture_1d_s32x3"
+	"gather_blue_texture_1d_u32x3"
+	"gather_blue_texture_1d_f32x4"
+	"gather_blue_texture_1d_s32x4"
+	"gather_blue_texture_1d_u32x4"
+	"gather_blue_texture_1d_array_f32"
+	"gather_blue_texture_1d_array_s32"
+	"gather_blue_texture_1d_array_u32"
+	"gather_blue_texture_1d_array_s64"
+	"gather_blue_texture_1d_array_u64"
+	"gather_blue_texture_1d_array_f32x2"
+	"gather_blue_texture_1d_array_s32x2"
+	"gather_blue_texture_1d_array_u32x2"
+	"gather_blue_texture_1d_array_f32x3"
+	"gather_blue_texture_1d_array_s32x3"
+	"gather_blue_texture_1d_array_u32x3"
+	"gather_blue_texture_1d_array_f32x4"
+	"gather_blue_texture_1d_array_s32x4"
+	"gather_blue_texture_1d_array_u32x4"
+	"gather_blue_texture_1d_ms_f32"
+	"gather_blue_texture_1d_ms_s32"
+	"gather_blue_texture_1d_ms_u32"
+	"gather_blue_texture_1d_ms_s64"
+	"gather_blue_texture_1d_ms_u64"
+	"gather_blue_texture_1d_ms_f32x2"
+	"gather_blue_texture_1d_ms_s32x2"
+	"gather_blue_texture_1d_ms_u32x2"
+	"gather_blue_texture_1d_ms_f32x3"
+	"gather_blue_texture_1d_ms_s32x3"
+	"gather_blue_texture_1d_ms_u32x3"
+	"gather_blue_texture_1d_ms_f32x4"
+	"gather_blue_texture_1d_ms_s32x4"
+	"gather_blue_texture_1d_ms_u32x4"
+	"gather_blue_texture_1d_ms_array_f32"
+	"gather_blue_texture_1d_ms_array_s32"
+	"gather_blue_texture_1d_ms_array_u32"
+	"gather_blue_texture_1d_ms_array_s64"
+	"gather_blue_texture_1d_ms_array_u64"
+	"gather_blue_texture_1d_ms_array_f32x2"
+	"gather_blue_texture_1d_ms_array_s32x2"
+	"gather_blue_texture_1d_ms_array_u32x2"
+	"gather_blue_texture_1d_ms_array_f32x3"
+	"gather_blue_texture_1d_ms_array_s32x3"
+	"gather_blue_texture_1d_ms_array_u32x3"
+	"gather_blue_texture_1d_ms_array_f32x4"
+	"gather_blue_texture_1d_ms_array_s32x4"
+	"gather_blue_texture_1d_ms_array_u32x4"
+	"gather_blue_texture_2d_f32"
+	"gather_blue_texture_2d_s32"
+	"gather_blue_texture_2d_u32"
+	"gather_blue_texture_2d_s64"
+	"gather_blue_texture_2d_u64"
+	"gather_blue_texture_2d_f32x2"
+	"gather_blue_texture_2d_s32x2"
+	"gather_blue_texture_2d_u32x2"
+	"gather_blue_texture_2d_f32x3"
+	"gather_blue_texture_2d_s32x3"
+	"gather_blue_texture_2d_u32x3"
+	"gather_blue_texture_2d_f32x4"
+	"gather_blue_texture_2d_s32x4"
+	"gather_blue_texture_2d_u32x4"
+	"gather_blue_texture_2d_array_f32"
+	"gather_blue_texture_2d_array_s32"
+	"gather_blue_texture_2d_array_u32"
+	"gather_blue_texture_2d_array_s64"
+	"gather_blue_texture_2d_array_u64"
+	"gather_blue_texture_2d_array_f32x2"
+	"gather_blue_texture_2d_array_s32x2"
+	"gather_blue_texture_2d_array_u32x2"
+	"gather_blue_texture_2d_array_f32x3"
+	"gather_blue_texture_2d_array_s32x3"
+	"gather_blue_texture_2d_array_u32x3"
+	"gather_blue_texture_2d_array_f32x4"
+	"gather_blue_texture_2d_array_s32x4"
+	"gather_blue_texture_2d_array_u32x4"
+	"gather_blue_texture_2d_ms_f32"
+	"gather_blue_texture_2d_ms_s32"
+	"gather_blue_texture_2d_ms_u32"
+	"gather_blue_texture_2d_ms_s64"
+	"gather_blue_texture_2d_ms_u64"
+	"gather_blue_texture_2d_ms_f32x2"
+	"gather_blue_texture_2d_ms_s32x2"
+	"gather_blue_texture_2d_ms_u32x2"
+	"gather_blue_texture_2d_ms_f32x3"
+	"gather_blue_texture_2d_ms_s32x3"
+	"gather_blue_texture_2d_ms_u32x3"
+	"gather_blue_texture_2d_ms_f32x4"
+	"gather_blue_texture_2d_ms_s32x4"
+	"gather_blue_texture_2d_ms_u32x4"
+	"gather_blue_texture_2d_ms_array_f32"
+	"gather_blue_texture_2d_ms_array_s32"
+	"gather_blue_texture_2d_ms_array_u32"
+	"gather_blue_texture_2d_ms_array_s64"
+	"gather_blue_texture_2d_ms_array_u64"
+	"gather_blue_texture_2d_ms_array_f32x2",
+	"gather_blue_texture_2d_ms_array_s32x2"
+	"gather_blue_texture_2d_ms_array_u32x2"
+	"gather_blue_texture_2d_ms_array_f32x3"
+	"gather_blue_texture_2d_ms_array_s32x3"
+	"gather_blue_texture_2d_ms_array_u32x3"
+	"gather_blue_texture_2d_ms_array_f32x4"
+	"gather_blue_texture_2d_ms_array_s32x4"
+	"gather_blue_texture_2d_ms_array_u32x4"
+	"gather_blue_texture_3d_f32"
+	"gather_blue_texture_3d_s32"
+	"gather_blue_texture_3d_u32"
+	"gather_blue_texture_3d_s64"
+	"gather_blue_texture_3d_u64"
+	"gather_blue_texture_3d_f32x2"
+	"gather_blue_texture_3d_s32x2"
+	"gather_blue_texture_3d_u32x2"
+	"gather_blue_texture_3d_f32x3"
+	"gather_blue_texture_3d_s32x3"
+	"gather_blue_texture_3d_u32x3"
+	"gather_blue_texture_3d_f32x4"
+	"gather_blue_texture_3d_s32x4"
+	"gather_blue_texture_3d_u32x4"
+	"gather_blue_texture_3d_array_f32"
+	"gather_blue_texture_3d_array_s32"
+	"gather_blue_texture_3d_array_u32"
+	"gather_blue_texture_3d_array_s64"
+	"gather_blue_texture_3d_array_u64"
+	"gather_blue_texture_3d_array_f32x2"
+	"gather_blue_texture_3d_array_s32x2"
+	"gather_blue_texture_3d_array_u32x2"
+	"gather_blue_texture_3d_array_f32x3"
+	"gather_blue_texture_3d_array_s32x3"
+	"gather_blue_texture_3d_array_u32x3"
+	"gather_blue_texture_3d_array_f32x4"
+	"gather_blue_texture_3d_array_s32x4"
+	"gather_blue_texture_3d_array_u32x4"
+	"gather_blue_texture_3d_ms_f32"
+	"gather_blue_texture_3d_ms_s32"
+	"gather_blue_texture_3d_ms_u32"
+	"gather_blue_texture_3d_ms_s64"
+	"gather_blue_texture_3d_ms_u64"
+	"gather_blue_texture_3d_ms_f32x2"
+	"gather_blue_texture_3d_ms_s32x2"
+	"gather_blue_texture_3d_ms_u32x2"
+	"gather_blue_texture_3d_ms_f32x3"
+	"gather_blue_texture_3d_ms_s32x3"
+	"gather_blue_texture_3d_ms_u32x3"
+	"gather_blue_texture_3d_ms_f32x4"
+	"gather_blue_texture_3d_ms_s32x4"
+	"gather_blue_texture_3d_ms_u32x4"
+	"gather_blue_texture_3d_ms_array_f32"
+	"gather_blue_texture_3d_ms_array_s32"
+	"gather_blue_texture_3d_ms_array_u32"
+	"gather_blue_texture_3d_ms_array_s64"
+	"gather_blue_texture_3d_ms_array_u64"
+	"gather_blue_texture_3d_ms_array_f32x2"
+	"gather_blue_texture_3d_ms_array_s32x2"
+	"gather_blue_texture_3d_ms_array_u32x2"
+	"gather_blue_texture_3d_ms_array_f32x3"
+	"gather_blue_texture_3d_ms_array_s32x3"
+	"gather_blue_texture_3d_ms_array_u32x3"
+	"gather_blue_texture_3d_ms_array_f32x4"
+	"gather_blue_texture_3d_ms_array_s32x4"
+	"gather_blue_texture_3d_ms_array_u32x4"
+	"gather_blue_texture_cube_f32"
+	"gather_blue_texture_cube_s32"
+	"gather_blue_texture_cube_u32"
+	"gather_blue_texture_cube_s64"
+	"gather_blue_texture_cube_u64"
+	"gather_blue_texture_cube_f32x2"
+	"gather_blue_texture_cube_s32x2"
+	"gather_blue_texture_cube_u32x2"
+	"gather_blue_texture_cube_f32x3"
+	"gather_blue_texture_cube_s32x3"
+	"gather_blue_texture_cube_u32x3"
+	"gather_blue_texture_cube_f32x4"
+	"gather_blue_texture_cube_s32x4"
+	"gather_blue_texture_cube_u32x4"
+	"gather_blue_texture_cube_array_f32"
+	"gather_blue_texture_cube_array_s32"
+	"gather_blue_texture_cube_array_u32"
+	"gather_blue_texture_cube_array_s64"
+	"gather_blue_texture_cube_array_u64"
+	"gather_blue_texture_cube_array_f32x2"
+	"gather_blue_texture_cube_array_s32x2"
+	"gather_blue_texture_cube_array_u32x2"
+	"gather_blue_texture_cube_array_f32x3"
+	"gather_blue_texture_cube_array_s32x3"
+	"gather_blue_texture_cube_array_u32x3"
+	"gather_blue_texture_cube_array_f32x4"
+	"gather_blue_texture_cube_array_s32x4"
+	"gather_blue_texture_cube_array_u32x4"
+	"gather_blue_texture_cube_ms_f32"
+	"gather_blue_texture_cube_ms_s32"
+	"gather_blue_texture_cube_ms_u32"
+	"gather_blue_texture_cube_ms_s64"
+	"gather_blue_texture_cube_ms_u64"
+	"gather_blue_texture_cube_ms_f32x2"
+	"gather_blue_texture_cube_ms_s32x2"
+	"gather_blue_texture_cube_ms_u32x2"
+	"gather_blue_texture_cube_ms_f32x3"
+	"gather_blue_texture_cube_ms_s32x3"
+	"gather_blue_texture_cube_ms_u32x3"
+	"gather_blue_texture_cube_ms_f32x4"
+	"gather_blue_texture_cube_ms_s32x4"
+	"gather_blue_texture_cube_ms_u32x4"
+	"gather_blue_texture_cube_ms_array_f32"
+	"gather_blue_texture_cube_ms_array_s32"
+	"gather_blue_texture_cube_ms_array_u32"
+	"gather_blue_texture_cube_ms_array_s64"
+	"gather_blue_texture_cube_ms_array_u64"
+	"gather_blue_texture_cube_ms_array_f32x2"
+	"gather_blue_texture_cube_ms_array_s32x2"
+	"gather_blue_texture_cube_ms_array_u32x2"
+	"gather_blue_texture_cube_ms_array_f32x3"
+	"gather_blue_texture_cube_ms_array_s32x3"
+	"gather_blue_texture_cube_ms_array_u32x3"
+	"gather_blue_texture_cube_ms_array_f32x4"
+	"gather_blue_texture_cube_ms_array_s32x4"
+	"gather_blue_texture_cube_ms_array_u32x4"
+	"gather_alpha_texture_1d_f32"
+	"gather_alpha_texture_1d_s32"
+	"gather_alpha_texture_1d_u32"
+	"gather_alpha_texture_1d_s64",
+	"gather_alpha_texture_1d_u64"
+	"gather_alpha_texture_1d_f32x2"
+	"gather_alpha_texture_1d_s32x2"
+	"gather_alpha_texture_1d_u32x2"
+	"gather_alpha_texture_1d_f32x3"
+	"gather_alpha_texture_1d_s32x3"
+	"gather_alpha_texture_1d_u32x3"
+	"gather_alpha_texture_1d_f32x4"
+	"gather_alpha_texture_1d_s32x4"
+	"gather_alpha_texture_1d_u32x4"
+	"gather_alpha_texture_1d_array_f32"
+	"gather_alpha_texture_1d_array_s32"
+	"gather_alpha_texture_1d_array_u32"
+	"gather_alpha_texture_1d_array_s64"
+	"gather_alpha_texture_1d_array_u64"
+	"gather_alpha_texture_1d_array_f32x2"
+	"gather_alpha_texture_1d_array_s32x2"
+	"gather_alpha_texture_1d_array_u32x2"
+	"gather_alpha_texture_1d_array_f32x3"
+	"gather_alpha_texture_1d_array_s32x3"
+	"gather_alpha_texture_1d_array_u32x3"
+	"gather_alpha_texture_1d_array_f32x4"
+	"gather_alpha_texture_1d_array_s32x4"
+	"gather_alpha_texture_1d_array_u32x4"
+	"gather_alpha_texture_1d_ms_f32"
+	"gather_alpha_texture_1d_ms_s32"
+	"gather_alpha_texture_1d_ms_u32"
+	"gather_alpha_texture_1d_ms_s64"
+	"gather_alpha_texture_1d_ms_u64"
+	"gather_alpha_texture_1d_ms_f32x2"
+	"gather_alpha_texture_1d_ms_s32x2"
+	"gather_alpha_texture_1d_ms_u32x2"
+	"gather_alpha_texture_1d_ms_f32x3"
+	"gather_alpha_texture_1d_ms_s32x3"
+	"gather_alpha_texture_1d_ms_u32x3"
+	"gather_alpha_texture_1d_ms_f32x4"
+	"gather_alpha_texture_1d_ms_s32x4"
+	"gather_alpha_texture_1d_ms_u32x4"
+	"gather_alpha_texture_1d_ms_array_f32"
+	"gather_alpha_texture_1d_ms_array_s32"
+	"gather_alpha_texture_1d_ms_array_u32"
+	"gather_alpha_texture_1d_ms_array_s64"
+	"gather_alpha_texture_1d_ms_array_u64"
+	"gather_alpha_texture_1d_ms_array_f32x2"
+	"gather_alpha_texture_1d_ms_array_s32x2"
+	"gather_alpha_texture_1d_ms_array_u32x2"
+	"gather_alpha_texture_1d_ms_array_f32x3"
+	"gather_alpha_texture_1d_ms_array_s32x3"
+	"gather_alpha_texture_1d_ms_array_u32x3"
+	"gather_alpha_texture_1d_ms_array_f32x4"
+	"gather_alpha_texture_1d_ms_array_s32x4"
+	"gather_alpha_texture_1d_ms_array_u32x4"
+	"gather_alpha_texture_2d_f32"
+	"gather_alpha_texture_2d_s32"
+	"gather_alpha_texture_2d_u32"
+	"gather_alpha_texture_2d_s64"
+	"gather_alpha_texture_2d_u64"
+	"gather_alpha_texture_2d_f32x2"
+	"gather_alpha_texture_2d_s32x2"
+	"gather_alpha_texture_2d_u32x2"
+	"gather_alpha_texture_2d_f32x3"
+	"gather_alpha_texture_2d_s32x3"
+	"gather_alpha_texture_2d_u32x3"
+	"gather_alpha_texture_2d_f32x4"
+	"gather_alpha_texture_2d_s32x4"
+	"gather_alpha_texture_2d_u32x4"
+	"gather_alpha_texture_2d_array_f32"
+	"gather_alpha_texture_2d_array_s32"
+	"gather_alpha_texture_2d_array_u32"
+	"gather_alpha_texture_2d_array_s64"
+	"gather_alpha_texture_2d_array_u64"
+	"gather_alpha_texture_2d_array_f32x2"
+	"gather_alpha_texture_2d_array_s32x2"
+	"gather_alpha_texture_2d_array_u32x2"
+	"gather_alpha_texture_2d_array_f32x3"
+	"gather_alpha_texture_2d_array_s32x3"
+	"gather_alpha_texture_2d_array_u32x3"
+	"gather_alpha_texture_2d_array_f32x4"
+	"gather_alpha_texture_2d_array_s32x4"
+	"gather_alpha_texture_2d_array_u32x4"
+	"gather_alpha_texture_2d_ms_f32"
+	"gather_alpha_texture_2d_ms_s32"
+	"gather_alpha_texture_2d_ms_u32"
+	"gather_alpha_texture_2d_ms_s64"
+	"gather_alpha_texture_2d_ms_u64"
+	"gather_alpha_texture_2d_ms_f32x2"
+	"gather_alpha_texture_2d_ms_s32x2"
+	"gather_alpha_texture_2d_ms_u32x2"
+	"gather_alpha_texture_2d_ms_f32x3"
+	"gather_alpha_texture_2d_ms_s32x3"
+	"gather_alpha_texture_2d_ms_u32x3"
+	"gather_alpha_texture_2d_ms_f32x4"
+	"gather_alpha_texture_2d_ms_s32x4"
+	"gather_alpha_texture_2d_ms_u32x4"
+	"gather_alpha_texture_2d_ms_array_f32"
+	"gather_alpha_texture_2d_ms_array_s32"
+	"gather_alpha_texture_2d_ms_array_u32"
+	"gather_alpha_texture_2d_ms_array_s64"
+	"gather_alpha_texture_2d_ms_array_u64"
+	"gather_alpha_texture_2d_ms_array_f32x2"
+	"gather_alpha_texture_2d_ms_array_s32x2"
+	"gather_alpha_texture_2d_ms_array_u32x2"
+	"gather_alpha_texture_2d_ms_array_f32x3"
+	"gather_alpha_texture_2d_ms_array_s32x3"
+	"gather_alpha_texture_2d_ms_array_u32x3"
+	"gather_alpha_texture_2d_ms_array_f32x4"
+	"gather_alpha_texture_2d_ms_array_s32x4"
+	"gather_alpha_texture_2d_ms_array_u32x4"
+	"gather_alpha_texture_3d_f32"
+	"gather_alpha_texture_3d_s32"
+	"gather_alpha_texture_3d_u32"
+	"gather_alpha_texture_3d_s64"
+	"gather_alpha_texture_3d_u64"
+	"gather_alpha_texture_3d_f32x2"
+	"gather_alpha_texture_3d_s32x2"
+	"gather_alpha_texture_3d_u32x2"
+	"gather_alpha_texture_3d_f32x3"
+	"gather_alpha_texture_3d_s32x3"
+	"gather_alpha_texture_3d_u32x3"
+	"gather_alpha_texture_3d_f32x4"
+	"gather_alpha_texture_3d_s32x4"
+	"gather_alpha_texture_3d_u32x4"
+	"gather_alpha_texture_3d_array_f32"
+	"gather_alpha_texture_3d_array_s32"
+	"gather_alpha_texture_3d_array_u32"
+	"gather_alpha_texture_3d_array_s64",
+	"gather_alpha_texture_3d_array_u64"
+	"gather_alpha_texture_3d_array_f32x2"
+	"gather_alpha_texture_3d_array_s32x2"
+	"gather_alpha_texture_3d_array_u32x2"
+	"gather_alpha_texture_3d_array_f32x3"
+	"gather_alpha_texture_3d_array_s32x3"
+	"gather_alpha_texture_3d_array_u32x3"
+	"gather_alpha_texture_3d_array_f32x4"
+	"gather_alpha_texture_3d_array_s32x4"
+	"gather_alpha_texture_3d_array_u32x4"
+	"gather_alpha_texture_3d_ms_f32"
+	"gather_alpha_texture_3d_ms_s32"
+	"gather_alpha_texture_3d_ms_u32"
+	"gather_alpha_texture_3d_ms_s64"
+	"gather_alpha_texture_3d_ms_u64"
+	"gather_alpha_texture_3d_ms_f32x2"
+	"gather_alpha_texture_3d_ms_s32x2"
+	"gather_alpha_texture_3d_ms_u32x2"
+	"gather_alpha_texture_3d_ms_f32x3"
+	"gather_alpha_texture_3d_ms_s32x3"
+	"gather_alpha_texture_3d_ms_u32x3"
+	"gather_alpha_texture_3d_ms_f32x4"
+	"gather_alpha_texture_3d_ms_s32x4"
+	"gather_alpha_texture_3d_ms_u32x4"
+	"gather_alpha_texture_3d_ms_array_f32"
+	"gather_alpha_texture_3d_ms_array_s32"
+	"gather_alpha_texture_3d_ms_array_u32"
+	"gather_alpha_texture_3d_ms_array_s64"
+	"gather_alpha_texture_3d_ms_array_u64"
+	"gather_alpha_texture_3d_ms_array_f32x2"
+	"gather_alpha_texture_3d_ms_array_s32x2"
+	"gather_alpha_texture_3d_ms_array_u32x2"
+	"gather_alpha_texture_3d_ms_array_f32x3"
+	"gather_alpha_texture_3d_ms_array_s32x3"
+	"gather_alpha_texture_3d_ms_array_u32x3"
+	"gather_alpha_texture_3d_ms_array_f32x4"
+	"gather_alpha_texture_3d_ms_array_s32x4"
+	"gather_alpha_texture_3d_ms_array_u32x4"
+	"gather_alpha_texture_cube_f32"
+	"gather_alpha_texture_cube_s32"
+	"gather_alpha_texture_cube_u32"
+	"gather_alpha_texture_cube_s64"
+	"gather_alpha_texture_cube_u64"
+	"gather_alpha_texture_cube_f32x2"
+	"gather_alpha_texture_cube_s32x2"
+	"gather_alpha_texture_cube_u32x2"
+	"gather_alpha_texture_cube_f32x3"
+	"gather_alpha_texture_cube_s32x3"
+	"gather_alpha_texture_cube_u32x3"
+	"gather_alpha_texture_cube_f32x4"
+	"gather_alpha_texture_cube_s32x4"
+	"gather_alpha_texture_cube_u32x4"
+	"gather_alpha_texture_cube_array_f32"
+	"gather_alpha_texture_cube_array_s32"
+	"gather_alpha_texture_cube_array_u32"
+	"gather_alpha_texture_cube_array_s64"
+	"gather_alpha_texture_cube_array_u64"
+	"gather_alpha_texture_cube_array_f32x2"
+	"gather_alpha_texture_cube_array_s32x2"
+	"gather_alpha_texture_cube_array_u32x2"
+	"gather_alpha_texture_cube_array_f32x3"
+	"gather_alpha_texture_cube_array_s32x3"
+	"gather_alpha_texture_cube_array_u32x3"
+	"gather_alpha_texture_cube_array_f32x4"
+	"gather_alpha_texture_cube_array_s32x4"
+	"gather_alpha_texture_cube_array_u32x4"
+	"gather_alpha_texture_cube_ms_f32"
+	"gather_alpha_texture_cube_ms_s32"
+	"gather_alpha_texture_cube_ms_u32"
+	"gather_alpha_texture_cube_ms_s64"
+	"gather_alpha_texture_cube_ms_u64"
+	"gather_alpha_texture_cube_ms_f32x2"
+	"gather_alpha_texture_cube_ms_s32x2"
+	"gather_alpha_texture_cube_ms_u32x2"
+	"gather_alpha_texture_cube_ms_f32x3"
+	"gather_alpha_texture_cube_ms_s32x3"
+	"gather_alpha_texture_cube_ms_u32x3"
+	"gather_alpha_texture_cube_ms_f32x4"
+	"gather_alpha_texture_cube_ms_s32x4"
+	"gather_alpha_texture_cube_ms_u32x4"
+	"gather_alpha_texture_cube_ms_array_f32"
+	"gather_alpha_texture_cube_ms_array_s32"
+	"gather_alpha_texture_cube_ms_array_u32"
+	"gather_alpha_texture_cube_ms_array_s64"
+	"gather_alpha_texture_cube_ms_array_u64"
+	"gather_alpha_texture_cube_ms_array_f32x2"
+	"gather_alpha_texture_cube_ms_array_s32x2"
+	"gather_alpha_texture_cube_ms_array_u32x2"
+	"gather_alpha_texture_cube_ms_array_f32x3"
+	"gather_alpha_texture_cube_ms_array_s32x3"
+	"gather_alpha_texture_cube_ms_array_u32x3"
+	"gather_alpha_texture_cube_ms_array_f32x4"
+	"gather_alpha_texture_cube_ms_array_s32x4"
+	"gather_alpha_texture_cube_ms_array_u32x4"
+	"store_texture_1d_fmt_8_8_8_8_unorm"
+	"store_texture_1d_fmt_8_8_8_8_snorm"
+	"store_texture_1d_fmt_8_8_8_8_uint"
+	"store_texture_1d_fmt_8_8_8_8_sint"
+	"store_texture_1d_fmt_8_8_unorm"
+	"store_texture_1d_fmt_8_8_snorm"
+	"store_texture_1d_fmt_8_8_uint"
+	"store_texture_1d_fmt_8_8_sint"
+	"store_texture_1d_fmt_8_unorm"
+	"store_texture_1d_fmt_8_snorm"
+	"store_texture_1d_fmt_8_uint"
+	"store_texture_1d_fmt_8_sint"
+	"store_texture_1d_fmt_16_16_16_16_float"
+	"store_texture_1d_fmt_16_16_16_16_unorm"
+	"store_texture_1d_fmt_16_16_16_16_snorm"
+	"store_texture_1d_fmt_16_16_16_16_uint"
+	"store_texture_1d_fmt_16_16_16_16_sint"
+	"store_texture_1d_fmt_16_16_float"
+	"store_texture_1d_fmt_16_16_unorm"
+	"store_texture_1d_fmt_16_16_snorm"
+	"store_texture_1d_fmt_16_16_uint"
+	"store_texture_1d_fmt_16_16_sint"
+	"store_texture_1d_fmt_16_float"
+	"store_texture_1d_fmt_16_unorm"
+	"store_texture_1d_fmt_16_snorm"
+	"store_texture_1d_fmt_16_uint",
+	"store_texture_1d_fmt_16_sint"
+	"store_texture_1d_fmt_32_32_32_32_float"
+	"store_texture_1d_fmt_32_32_32_32_uint"
+	"store_texture_1d_fmt_32_32_32_32_sint"
+	"store_texture_1d_fmt_32_32_float"
+	"store_texture_1d_fmt_32_32_uint"
+	"store_texture_1d_fmt_32_32_sint"
+	"store_texture_1d_fmt_32_float"
+	"store_texture_1d_fmt_32_uint"
+	"store_texture_1d_fmt_32_sint"
+	"store_texture_1d_fmt_64_uint"
+	"store_texture_1d_fmt_64_sint"
+	"store_texture_1d_fmt_11_11_10_float"
+	"store_texture_1d_fmt_10_10_10_2_unorm"
+	"store_texture_1d_fmt_10_10_10_2_uint"
+	"store_texture_1d_array_fmt_8_8_8_8_unorm"
+	"store_texture_1d_array_fmt_8_8_8_8_snorm"
+	"store_texture_1d_array_fmt_8_8_8_8_uint"
+	"store_texture_1d_array_fmt_8_8_8_8_sint"
+	"store_texture_1d_array_fmt_8_8_unorm"
+	"store_texture_1d_array_fmt_8_8_snorm"
+	"store_texture_1d_array_fmt_8_8_uint"
+	"store_texture_1d_array_fmt_8_8_sint"
+	"store_texture_1d_array_fmt_8_unorm"
+	"store_texture_1d_array_fmt_8_snorm"
+	"store_texture_1d_array_fmt_8_uint"
+	"store_texture_1d_array_fmt_8_sint"
+	"store_texture_1d_array_fmt_16_16_16_16_float"
+	"store_texture_1d_array_fmt_16_16_16_16_unorm"
+	"store_texture_1d_array_fmt_16_16_16_16_snorm"
+	"store_texture_1d_array_fmt_16_16_16_16_uint"
+	"store_texture_1d_array_fmt_16_16_16_16_sint"
+	"store_texture_1d_array_fmt_16_16_float"
+	"store_texture_1d_array_fmt_16_16_unorm"
+	"store_texture_1d_array_fmt_16_16_snorm"
+	"store_texture_1d_array_fmt_16_16_uint"
+	"store_texture_1d_array_fmt_16_16_sint"
+	"store_texture_1d_array_fmt_16_float"
+	"store_texture_1d_array_fmt_16_unorm"
+	"store_texture_1d_array_fmt_16_snorm"
+	"store_texture_1d_array_fmt_16_uint"
+	"store_texture_1d_array_fmt_16_sint"
+	"store_texture_1d_array_fmt_32_32_32_32_float"
+	"store_texture_1d_array_fmt_32_32_32_32_uint"
+	"store_texture_1d_array_fmt_32_32_32_32_sint"
+	"store_texture_1d_array_fmt_32_32_float"
+	"store_texture_1d_array_fmt_32_32_uint"
+	"store_texture_1d_array_fmt_32_32_sint"
+	"store_texture_1d_array_fmt_32_float"
+	"store_texture_1d_array_fmt_32_uint"
+	"store_texture_1d_array_fmt_32_sint"
+	"store_texture_1d_array_fmt_64_uint"
+	"store_texture_1d_array_fmt_64_sint"
+	"store_texture_1d_array_fmt_11_11_10_float"
+	"store_texture_1d_array_fmt_10_10_10_2_unorm"
+	"store_texture_1d_array_fmt_10_10_10_2_uint"
+	"store_texture_1d_ms_fmt_8_8_8_8_unorm"
+	"store_texture_1d_ms_fmt_8_8_8_8_snorm"
+	"store_texture_1d_ms_fmt_8_8_8_8_uint"
+	"store_texture_1d_ms_fmt_8_8_8_8_sint"
+	"store_texture_1d_ms_fmt_8_8_unorm"
+	"store_texture_1d_ms_fmt_8_8_snorm"
+	"store_texture_1d_ms_fmt_8_8_uint"
+	"store_texture_1d_ms_fmt_8_8_sint"
+	"store_texture_1d_ms_fmt_8_unorm"
+	"store_texture_1d_ms_fmt_8_snorm"
+	"store_texture_1d_ms_fmt_8_uint"
+	"store_texture_1d_ms_fmt_8_sint"
+	"store_texture_1d_ms_fmt_16_16_16_16_float"
+	"store_texture_1d_ms_fmt_16_16_16_16_unorm"
+	"store_texture_1d_ms_fmt_16_16_16_16_snorm"
+	"store_texture_1d_ms_fmt_16_16_16_16_uint"
+	"store_texture_1d_ms_fmt_16_16_16_16_sint"
+	"store_texture_1d_ms_fmt_16_16_float"
+	"store_texture_1d_ms_fmt_16_16_unorm"
+	"store_texture_1d_ms_fmt_16_16_snorm"
+	"store_texture_1d_ms_fmt_16_16_uint"
+	"store_texture_1d_ms_fmt_16_16_sint"
+	"store_texture_1d_ms_fmt_16_float"
+	"store_texture_1d_ms_fmt_16_unorm"
+	"store_texture_1d_ms_fmt_16_snorm"
+	"store_texture_1d_ms_fmt_16_uint"
+	"store_texture_1d_ms_fmt_16_sint"
+	"store_texture_1d_ms_fmt_32_32_32_32_float"
+	"store_texture_1d_ms_fmt_32_32_32_32_uint"
+	"store_texture_1d_ms_fmt_32_32_32_32_sint"
+	"store_texture_1d_ms_fmt_32_32_float"
+	"store_texture_1d_ms_fmt_32_32_uint"
+	"store_texture_1d_ms_fmt_32_32_sint"
+	"store_texture_1d_ms_fmt_32_float"
+	"store_texture_1d_ms_fmt_32_uint"
+	"store_texture_1d_ms_fmt_32_sint"
+	"store_texture_1d_ms_fmt_64_uint"
+	"store_texture_1d_ms_fmt_64_sint"
+	"store_texture_1d_ms_fmt_11_11_10_float"
+	"store_texture_1d_ms_fmt_10_10_10_2_unorm"
+	"store_texture_1d_ms_fmt_10_10_10_2_uint"
+	"store_texture_1d_ms_array_fmt_8_8_8_8_unorm"
+	"store_texture_1d_ms_array_fmt_8_8_8_8_snorm"
+	"store_texture_1d_ms_array_fmt_8_8_8_8_uint"
+	"store_texture_1d_ms_array_fmt_8_8_8_8_sint"
+	"store_texture_1d_ms_array_fmt_8_8_unorm"
+	"store_texture_1d_ms_array_fmt_8_8_snorm"
+	"store_texture_1d_ms_array_fmt_8_8_uint"
+	"store_texture_1d_ms_array_fmt_8_8_sint"
+	"store_texture_1d_ms_array_fmt_8_unorm"
+	"store_texture_1d_ms_array_fmt_8_snorm"
+	"store_texture_1d_ms_array_fmt_8_uint"
+	"store_texture_1d_ms_array_fmt_8_sint"
+	"store_texture_1d_ms_array_fmt_16_16_16_16_float"
+	"store_texture_1d_ms_array_fmt_16_16_16_16_unorm"
+	"store_texture_1d_ms_array_fmt_16_16_16_16_snorm",
+	"store_texture_1d_ms_array_fmt_16_16_16_16_uint"
+	"store_texture_1d_ms_array_fmt_16_16_16_16_sint"
+	"store_texture_1d_ms_array_fmt_16_16_float"
+	"store_texture_1d_ms_array_fmt_16_16_unorm"
+	"store_texture_1d_ms_array_fmt_16_16_snorm"
+	"store_texture_1d_ms_array_fmt_16_16_uint"
+	"store_texture_1d_ms_array_fmt_16_16_sint"
+	"store_texture_1d_ms_array_fmt_16_float"
+	"store_texture_1d_ms_array_fmt_16_unorm"
+	"store_texture_1d_ms_array_fmt_16_snorm"
+	"store_texture_1d_ms_array_fmt_16_uint"
+	"store_texture_1d_ms_array_fmt_16_sint"
+	"store_texture_1d_ms_array_fmt_32_32_32_32_float"
+	"store_texture_1d_ms_array_fmt_32_32_32_32_uint"
+	"store_texture_1d_ms_array_fmt_32_32_32_32_sint"
+	"store_texture_1d_ms_array_fmt_32_32_float"
+	"store_texture_1d_ms_array_fmt_32_32_uint"
+	"store_texture_1d_ms_array_fmt_32_32_sint"
+	"store_texture_1d_ms_array_fmt_32_float"
+	"store_texture_1d_ms_array_fmt_32_uint"
+	"store_texture_1d_ms_array_fmt_32_sint"
+	"store_texture_1d_ms_array_fmt_64_uint"
+	"store_texture_1d_ms_array_fmt_64_sint"
+	"store_texture_1d_ms_array_fmt_11_11_10_float"
+	"store_texture_1d_ms_array_fmt_10_10_10_2_unorm"
+	"store_texture_1d_ms_array_fmt_10_10_10_2_uint"
+	"store_texture_2d_fmt_8_8_8_8_unorm"
+	"store_texture_2d_fmt_8_8_8_8_snorm"
+	"store_texture_2d_fmt_8_8_8_8_uint"
+	"store_texture_2d_fmt_8_8_8_8_sint"
+	"store_texture_2d_fmt_8_8_unorm"
+	"store_texture_2d_fmt_8_8_snorm"
+	"store_texture_2d_fmt_8_8_uint"
+	"store_texture_2d_fmt_8_8_sint"
+	"store_texture_2d_fmt_8_unorm"
+	"store_texture_2d_fmt_8_snorm"
+	"store_texture_2d_fmt_8_uint"
+	"store_texture_2d_fmt_8_sint"
+	"store_texture_2d_fmt_16_16_16_16_float"
+	"store_texture_2d_fmt_16_16_16_16_unorm"
+	"store_texture_2d_fmt_16_16_16_16_snorm"
+	"store_texture_2d_fmt_16_16_16_16_uint"
+	"store_texture_2d_fmt_16_16_16_16_sint"
+	"store_texture_2d_fmt_16_16_float"
+	"store_texture_2d_fmt_16_16_unorm"
+	"store_texture_2d_fmt_16_16_snorm"
+	"store_texture_2d_fmt_16_16_uint"
+	"store_texture_2d_fmt_16_16_sint"
+	"store_texture_2d_fmt_16_float"
+	"store_texture_2d_fmt_16_unorm"
+	"store_texture_2d_fmt_16_snorm"
+	"store_texture_2d_fmt_16_uint"
+	"store_texture_2d_fmt_16_sint"
+	"store_texture_2d_fmt_32_32_32_32_float"
+	"store_texture_2d_fmt_32_32_32_32_uint"
+	"store_texture_2d_fmt_32_32_32_32_sint"
+	"store_texture_2d_fmt_32_32_float"
+	"store_texture_2d_fmt_32_32_uint"
+	"store_texture_2d_fmt_32_32_sint"
+	"store_texture_2d_fmt_32_float"
+	"store_texture_2d_fmt_32_uint"
+	"store_texture_2d_fmt_32_sint"
+	"store_texture_2d_fmt_64_uint"
+	"store_texture_2d_fmt_64_sint"
+	"store_texture_2d_fmt_11_11_10_float"
+	"store_texture_2d_fmt_10_10_10_2_unorm"
+	"store_texture_2d_fmt_10_10_10_2_uint"
+	"store_texture_2d_array_fmt_8_8_8_8_unorm"
+	"store_texture_2d_array_fmt_8_8_8_8_snorm"
+	"store_texture_2d_array_fmt_8_8_8_8_uint"
+	"store_texture_2d_array_fmt_8_8_8_8_sint"
+	"store_texture_2d_array_fmt_8_8_unorm"
+	"store_texture_2d_array_fmt_8_8_snorm"
+	"store_texture_2d_array_fmt_8_8_uint"
+	"store_texture_2d_array_fmt_8_8_sint"
+	"store_texture_2d_array_fmt_8_unorm"
+	"store_texture_2d_array_fmt_8_snorm"
+	"store_texture_2d_array_fmt_8_uint"
+	"store_texture_2d_array_fmt_8_sint"
+	"store_texture_2d_array_fmt_16_16_16_16_float"
+	"store_texture_2d_array_fmt_16_16_16_16_unorm"
+	"store_texture_2d_array_fmt_16_16_16_16_snorm"
+	"store_texture_2d_array_fmt_16_16_16_16_uint"
+	"store_texture_2d_array_fmt_16_16_16_16_sint"
+	"store_texture_2d_array_fmt_16_16_float"
+	"store_texture_2d_array_fmt_16_16_unorm"
+	"store_texture_2d_array_fmt_16_16_snorm"
+	"store_texture_2d_array_fmt_16_16_uint"
+	"store_texture_2d_array_fmt_16_16_sint"
+	"store_texture_2d_array_fmt_16_float"
+	"store_texture_2d_array_fmt_16_unorm"
+	"store_texture_2d_array_fmt_16_snorm"
+	"store_texture_2d_array_fmt_16_uint"
+	"store_texture_2d_array_fmt_16_sint"
+	"store_texture_2d_array_fmt_32_32_32_32_float"
+	"store_texture_2d_array_fmt_32_32_32_32_uint"
+	"store_texture_2d_array_fmt_32_32_32_32_sint"
+	"store_texture_2d_array_fmt_32_32_float"
+	"store_texture_2d_array_fmt_32_32_uint"
+	"store_texture_2d_array_fmt_32_32_sint"
+	"store_texture_2d_array_fmt_32_float"
+	"store_texture_2d_array_fmt_32_uint"
+	"store_texture_2d_array_fmt_32_sint"
+	"store_texture_2d_array_fmt_64_uint"
+	"store_texture_2d_array_fmt_64_sint"
+	"store_texture_2d_array_fmt_11_11_10_float"
+	"store_texture_2d_array_fmt_10_10_10_2_unorm"
+	"store_texture_2d_array_fmt_10_10_10_2_uint"
+	"store_texture_2d_ms_fmt_8_8_8_8_unorm"
+	"store_texture_2d_ms_fmt_8_8_8_8_snorm"
+	"store_texture_2d_ms_fmt_8_8_8_8_uint"
+	"store_texture_2d_ms_fmt_8_8_8_8_sint",
+	"store_texture_2d_ms_fmt_8_8_unorm"
+	"store_texture_2d_ms_fmt_8_8_snorm"
+	"store_texture_2d_ms_fmt_8_8_uint"
+	"store_texture_2d_ms_fmt_8_8_sint"
+	"store_texture_2d_ms_fmt_8_unorm"
+	"store_texture_2d_ms_fmt_8_snorm"
+	"store_texture_2d_ms_fmt_8_uint"
+	"store_texture_2d_ms_fmt_8_sint"
+	"store_texture_2d_ms_fmt_16_16_16_16_float"
+	"store_texture_2d_ms_fmt_16_16_16_16_unorm"
+	"store_texture_2d_ms_fmt_16_16_16_16_snorm"
+	"store_texture_2d_ms_fmt_16_16_16_16_uint"
+	"store_texture_2d_ms_fmt_16_16_16_16_sint"
+	"store_texture_2d_ms_fmt_16_16_float"
+	"store_texture_2d_ms_fmt_16_16_unorm"
+	"store_texture_2d_ms_fmt_16_16_snorm"
+	"store_texture_2d_ms_fmt_16_16_uint"
+	"store_texture_2d_ms_fmt_16_16_sint"
+	"store_texture_2d_ms_fmt_16_float"
+	"store_texture_2d_ms_fmt_16_unorm"
+	"store_texture_2d_ms_fmt_16_snorm"
+	"store_texture_2d_ms_fmt_16_uint"
+	"store_texture_2d_ms_fmt_16_sint"
+	"store_texture_2d_ms_fmt_32_32_32_32_float"
+	"store_texture_2d_ms_fmt_32_32_32_32_uint"
+	"store_texture_2d_ms_fmt_32_32_32_32_sint"
+	"store_texture_2d_ms_fmt_32_32_float"
+	"store_texture_2d_ms_fmt_32_32_uint"
+	"store_texture_2d_ms_fmt_32_32_sint"
+	"store_texture_2d_ms_fmt_32_float"
+	"store_texture_2d_ms_fmt_32_uint"
+	"store_texture_2d_ms_fmt_32_sint"
+	"store_texture_2d_ms_fmt_64_uint"
+	"store_texture_2d_ms_fmt_64_sint"
+	"store_texture_2d_ms_fmt_11_11_10_float"
+	"store_texture_2d_ms_fmt_10_10_10_2_unorm"
+	"store_texture_2d_ms_fmt_10_10_10_2_uint"
+	"store_texture_2d_ms_array_fmt_8_8_8_8_unorm"
+	"store_texture_2d_ms_array_fmt_8_8_8_8_snorm"
+	"store_texture_2d_ms_array_fmt_8_8_8_8_uint"
+	"store_texture_2d_ms_array_fmt_8_8_8_8_sint"
+	"store_texture_2d_ms_array_fmt_8_8_unorm"
+	"store_texture_2d_ms_array_fmt_8_8_snorm"
+	"store_texture_2d_ms_array_fmt_8_8_uint"
+	"store_texture_2d_ms_array_fmt_8_8_sint"
+	"store_texture_2d_ms_array_fmt_8_unorm"
+	"store_texture_2d_ms_array_fmt_8_snorm"
+	"store_texture_2d_ms_array_fmt_8_uint"
+	"store_texture_2d_ms_array_fmt_8_sint"
+	"store_texture_2d_ms_array_fmt_16_16_16_16_float"
+	"store_texture_2d_ms_array_fmt_16_16_16_16_unorm"
+	"store_texture_2d_ms_array_fmt_16_16_16_16_snorm"
+	"store_texture_2d_ms_array_fmt_16_16_16_16_uint"
+	"store_texture_2d_ms_array_fmt_16_16_16_16_sint"
+	"store_texture_2d_ms_array_fmt_16_16_float"
+	"store_texture_2d_ms_array_fmt_16_16_unorm"
+	"store_texture_2d_ms_array_fmt_16_16_snorm"
+	"store_texture_2d_ms_array_fmt_16_16_uint"
+	"store_texture_2d_ms_array_fmt_16_16_sint"
+	"store_texture_2d_ms_array_fmt_16_float"
+	"store_texture_2d_ms_array_fmt_16_unorm"
+	"store_texture_2d_ms_array_fmt_16_snorm"
+	"store_texture_2d_ms_array_fmt_16_uint"
+	"store_texture_2d_ms_array_fmt_16_sint"
+	"store_texture_2d_ms_array_fmt_32_32_32_32_float"
+	"store_texture_2d_ms_array_fmt_32_32_32_32_uint"
+	"store_texture_2d_ms_array_fmt_32_32_32_32_sint"
+	"store_texture_2d_ms_array_fmt_32_32_float"
+	"store_texture_2d_ms_array_fmt_32_32_uint"
+	"store_texture_2d_ms_array_fmt_32_32_sint"
+	"store_texture_2d_ms_array_fmt_32_float"
+	"store_texture_2d_ms_array_fmt_32_uint"
+	"store_texture_2d_ms_array_fmt_32_sint"
+	"store_texture_2d_ms_array_fmt_64_uint"
+	"store_texture_2d_ms_array_fmt_64_sint"
+	"store_texture_2d_ms_array_fmt_11_11_10_float"
+	"store_texture_2d_ms_array_fmt_10_10_10_2_unorm"
+	"store_texture_2d_ms_array_fmt_10_10_10_2_uint"
+	"store_texture_3d_fmt_8_8_8_8_unorm"
+	"store_texture_3d_fmt_8_8_8_8_snorm"
+	"store_texture_3d_fmt_8_8_8_8_uint"
+	"store_texture_3d_fmt_8_8_8_8_sint"
+	"store_texture_3d_fmt_8_8_unorm"
+	"store_texture_3d_fmt_8_8_snorm"
+	"store_texture_3d_fmt_8_8_uint"
+	"store_texture_3d_fmt_8_8_sint"
+	"store_texture_3d_fmt_8_unorm"
+	"store_texture_3d_fmt_8_snorm"
+	"store_texture_3d_fmt_8_uint"
+	"store_texture_3d_fmt_8_sint"
+	"store_texture_3d_fmt_16_16_16_16_float"
+	"store_texture_3d_fmt_16_16_16_16_unorm"
+	"store_texture_3d_fmt_16_16_16_16_snorm"
+	"store_texture_3d_fmt_16_16_16_16_uint"
+	"store_texture_3d_fmt_16_16_16_16_sint"
+	"store_texture_3d_fmt_16_16_float"
+	"store_texture_3d_fmt_16_16_unorm"
+	"store_texture_3d_fmt_16_16_snorm"
+	"store_texture_3d_fmt_16_16_uint"
+	"store_texture_3d_fmt_16_16_sint"
+	"store_texture_3d_fmt_16_float"
+	"store_texture_3d_fmt_16_unorm"
+	"store_texture_3d_fmt_16_snorm"
+	"store_texture_3d_fmt_16_uint"
+	"store_texture_3d_fmt_16_sint"
+	"store_texture_3d_fmt_32_32_32_32_float"
+	"store_texture_3d_fmt_32_32_32_32_uint"
+	"store_texture_3d_fmt_32_32_32_32_sint"
+	"store_texture_3d_fmt_32_32_float"
+	"store_texture_3d_fmt_32_32_uint"
+	"store_texture_3d_fmt_32_32_sint"
+	"store_texture_3d_fmt_32_float"
+	"store_texture_3d_fmt_32_uint",
+	"store_texture_3d_fmt_32_sint"
+	"store_texture_3d_fmt_64_uint"
+	"store_texture_3d_fmt_64_sint"
+	"store_texture_3d_fmt_11_11_10_float"
+	"store_texture_3d_fmt_10_10_10_2_unorm"
+	"store_texture_3d_fmt_10_10_10_2_uint"
+	"store_texture_3d_array_fmt_8_8_8_8_unorm"
+	"store_texture_3d_array_fmt_8_8_8_8_snorm"
+	"store_texture_3d_array_fmt_8_8_8_8_uint"
+	"store_texture_3d_array_fmt_8_8_8_8_sint"
+	"store_texture_3d_array_fmt_8_8_unorm"
+	"store_texture_3d_array_fmt_8_8_snorm"
+	"store_texture_3d_array_fmt_8_8_uint"
+	"store_texture_3d_array_fmt_8_8_sint"
+	"store_texture_3d_array_fmt_8_unorm"
+	"store_texture_3d_array_fmt_8_snorm"
+	"store_texture_3d_array_fmt_8_uint"
+	"store_texture_3d_array_fmt_8_sint"
+	"store_texture_3d_array_fmt_16_16_16_16_float"
+	"store_texture_3d_array_fmt_16_16_16_16_unorm"
+	"store_texture_3d_array_fmt_16_16_16_16_snorm"
+	"store_texture_3d_array_fmt_16_16_16_16_uint"
+	"store_texture_3d_array_fmt_16_16_16_16_sint"
+	"store_texture_3d_array_fmt_16_16_float"
+	"store_texture_3d_array_fmt_16_16_unorm"
+	"store_texture_3d_array_fmt_16_16_snorm"
+	"store_texture_3d_array_fmt_16_16_uint"
+	"store_texture_3d_array_fmt_16_16_sint"
+	"store_texture_3d_array_fmt_16_float"
+	"store_texture_3d_array_fmt_16_unorm"
+	"store_texture_3d_array_fmt_16_snorm"
+	"store_texture_3d_array_fmt_16_uint"
+	"store_texture_3d_array_fmt_16_sint"
+	"store_texture_3d_array_fmt_32_32_32_32_float"
+	"store_texture_3d_array_fmt_32_32_32_32_uint"
+	"store_texture_3d_array_fmt_32_32_32_32_sint"
+	"store_texture_3d_array_fmt_32_32_float"
+	"store_texture_3d_array_fmt_32_32_uint"
+	"store_texture_3d_array_fmt_32_32_sint"
+	"store_texture_3d_array_fmt_32_float"
+	"store_texture_3d_array_fmt_32_uint"
+	"store_texture_3d_array_fmt_32_sint"
+	"store_texture_3d_array_fmt_64_uint"
+	"store_texture_3d_array_fmt_64_sint"
+	"store_texture_3d_array_fmt_11_11_10_float"
+	"store_texture_3d_array_fmt_10_10_10_2_unorm"
+	"store_texture_3d_array_fmt_10_10_10_2_uint"
+	"store_texture_3d_ms_fmt_8_8_8_8_unorm"
+	"store_texture_3d_ms_fmt_8_8_8_8_snorm"
+	"store_texture_3d_ms_fmt_8_8_8_8_uint"
+	"store_texture_3d_ms_fmt_8_8_8_8_sint"
+	"store_texture_3d_ms_fmt_8_8_unorm"
+	"store_texture_3d_ms_fmt_8_8_snorm"
+	"store_texture_3d_ms_fmt_8_8_uint"
+	"store_texture_3d_ms_fmt_8_8_sint"
+	"store_texture_3d_ms_fmt_8_unorm"
+	"store_texture_3d_ms_fmt_8_snorm"
+	"store_texture_3d_ms_fmt_8_uint"
+	"store_texture_3d_ms_fmt_8_sint"
+	"store_texture_3d_ms_fmt_16_16_16_16_float"
+	"store_texture_3d_ms_fmt_16_16_16_16_unorm"
+	"store_texture_3d_ms_fmt_16_16_16_16_snorm"
+	"store_texture_3d_ms_fmt_16_16_16_16_uint"
+	"store_texture_3d_ms_fmt_16_16_16_16_sint"
+	"store_texture_3d_ms_fmt_16_16_float"
+	"store_texture_3d_ms_fmt_16_16_unorm"
+	"store_texture_3d_ms_fmt_16_16_snorm"
+	"store_texture_3d_ms_fmt_16_16_uint"
+	"store_texture_3d_ms_fmt_16_16_sint"
+	"store_texture_3d_ms_fmt_16_float"
+	"store_texture_3d_ms_fmt_16_unorm"
+	"store_texture_3d_ms_fmt_16_snorm"
+	"store_texture_3d_ms_fmt_16_uint"
+	"store_texture_3d_ms_fmt_16_sint"
+	"store_texture_3d_ms_fmt_32_32_32_32_float"
+	"store_texture_3d_ms_fmt_32_32_32_32_uint"
+	"store_texture_3d_ms_fmt_32_32_32_32_sint"
+	"store_texture_3d_ms_fmt_32_32_float"
+	"store_texture_3d_ms_fmt_32_32_uint"
+	"store_texture_3d_ms_fmt_32_32_sint"
+	"store_texture_3d_ms_fmt_32_float"
+	"store_texture_3d_ms_fmt_32_uint"
+	"store_texture_3d_ms_fmt_32_sint"
+	"store_texture_3d_ms_fmt_64_uint"
+	"store_texture_3d_ms_fmt_64_sint"
+	"store_texture_3d_ms_fmt_11_11_10_float"
+	"store_texture_3d_ms_fmt_10_10_10_2_unorm"
+	"store_texture_3d_ms_fmt_10_10_10_2_uint"
+	"store_texture_3d_ms_array_fmt_8_8_8_8_unorm"
+	"store_texture_3d_ms_array_fmt_8_8_8_8_snorm"
+	"store_texture_3d_ms_array_fmt_8_8_8_8_uint"
+	"store_texture_3d_ms_array_fmt_8_8_8_8_sint"
+	"store_texture_3d_ms_array_fmt_8_8_unorm"
+	"store_texture_3d_ms_array_fmt_8_8_snorm"
+	"store_texture_3d_ms_array_fmt_8_8_uint"
+	"store_texture_3d_ms_array_fmt_8_8_sint"
+	"store_texture_3d_ms_array_fmt_8_unorm"
+	"store_texture_3d_ms_array_fmt_8_snorm"
+	"store_texture_3d_ms_array_fmt_8_uint"
+	"store_texture_3d_ms_array_fmt_8_sint"
+	"store_texture_3d_ms_array_fmt_16_16_16_16_float"
+	"store_texture_3d_ms_array_fmt_16_16_16_16_unorm"
+	"store_texture_3d_ms_array_fmt_16_16_16_16_snorm"
+	"store_texture_3d_ms_array_fmt_16_16_16_16_uint"
+	"store_texture_3d_ms_array_fmt_16_16_16_16_sint"
+	"store_texture_3d_ms_array_fmt_16_16_float"
+	"store_texture_3d_ms_array_fmt_16_16_unorm"
+	"store_texture_3d_ms_array_fmt_16_16_snorm"
+	"store_texture_3d_ms_array_fmt_16_16_uint"
+	"store_texture_3d_ms_array_fmt_16_16_sint",
+	"store_texture_3d_ms_array_fmt_16_float"
+	"store_texture_3d_ms_array_fmt_16_unorm"
+	"store_texture_3d_ms_array_fmt_16_snorm"
+	"store_texture_3d_ms_array_fmt_16_uint"
+	"store_texture_3d_ms_array_fmt_16_sint"
+	"store_texture_3d_ms_array_fmt_32_32_32_32_float"
+	"store_texture_3d_ms_array_fmt_32_32_32_32_uint"
+	"store_texture_3d_ms_array_fmt_32_32_32_32_sint"
+	"store_texture_3d_ms_array_fmt_32_32_float"
+	"store_texture_3d_ms_array_fmt_32_32_uint"
+	"store_texture_3d_ms_array_fmt_32_32_sint"
+	"store_texture_3d_ms_array_fmt_32_float"
+	"store_texture_3d_ms_array_fmt_32_uint"
+	"store_texture_3d_ms_array_fmt_32_sint"
+	"store_texture_3d_ms_array_fmt_64_uint"
+	"store_texture_3d_ms_array_fmt_64_sint"
+	"store_texture_3d_ms_array_fmt_11_11_10_float"
+	"store_texture_3d_ms_array_fmt_10_10_10_2_unorm"
+	"store_texture_3d_ms_array_fmt_10_10_10_2_uint"
+	"store_texture_cube_fmt_8_8_8_8_unorm"
+	"store_texture_cube_fmt_8_8_8_8_snorm"
+	"store_texture_cube_fmt_8_8_8_8_uint"
+	"store_texture_cube_fmt_8_8_8_8_sint"
+	"store_texture_cube_fmt_8_8_unorm"
+	"store_texture_cube_fmt_8_8_snorm"
+	"store_texture_cube_fmt_8_8_uint"
+	"store_texture_cube_fmt_8_8_sint"
+	"store_texture_cube_fmt_8_unorm"
+	"store_texture_cube_fmt_8_snorm"
+	"store_texture_cube_fmt_8_uint"
+	"store_texture_cube_fmt_8_sint"
+	"store_texture_cube_fmt_16_16_16_16_float"
+	"store_texture_cube_fmt_16_16_16_16_unorm"
+	"store_texture_cube_fmt_16_16_16_16_snorm"
+	"store_texture_cube_fmt_16_16_16_16_uint"
+	"store_texture_cube_fmt_16_16_16_16_sint"
+	"store_texture_cube_fmt_16_16_float"
+	"store_texture_cube_fmt_16_16_unorm"
+	"store_texture_cube_fmt_16_16_snorm"
+	"store_texture_cube_fmt_16_16_uint"
+	"store_texture_cube_fmt_16_16_sint"
+	"store_texture_cube_fmt_16_float"
+	"store_texture_cube_fmt_16_unorm"
+	"store_texture_cube_fmt_16_snorm"
+	"store_texture_cube_fmt_16_uint"
+	"store_texture_cube_fmt_16_sint"
+	"store_texture_cube_fmt_32_32_32_32_float"
+	"store_texture_cube_fmt_32_32_32_32_uint"
+	"store_texture_cube_fmt_32_32_32_32_sint"
+	"store_texture_cube_fmt_32_32_float"
+	"store_texture_cube_fmt_32_32_uint"
+	"store_texture_cube_fmt_32_32_sint"
+	"store_texture_cube_fmt_32_float"
+	"store_texture_cube_fmt_32_uint"
+	"store_texture_cube_fmt_32_sint"
+	"store_texture_cube_fmt_64_uint"
+	"store_texture_cube_fmt_64_sint"
+	"store_texture_cube_fmt_11_11_10_float"
+	"store_texture_cube_fmt_10_10_10_2_unorm"
+	"store_texture_cube_fmt_10_10_10_2_uint"
+	"store_texture_cube_array_fmt_8_8_8_8_unorm"
+	"store_texture_cube_array_fmt_8_8_8_8_snorm"
+	"store_texture_cube_array_fmt_8_8_8_8_uint"
+	"store_texture_cube_array_fmt_8_8_8_8_sint"
+	"store_texture_cube_array_fmt_8_8_unorm"
+	"store_texture_cube_array_fmt_8_8_snorm"
+	"store_texture_cube_array_fmt_8_8_uint"
+	"store_texture_cube_array_fmt_8_8_sint"
+	"store_texture_cube_array_fmt_8_unorm"
+	"store_texture_cube_array_fmt_8_snorm"
+	"store_texture_cube_array_fmt_8_uint"
+	"store_texture_cube_array_fmt_8_sint"
+	"store_texture_cube_array_fmt_16_16_16_16_float"
+	"store_texture_cube_array_fmt_16_16_16_16_unorm"
+	"store_texture_cube_array_fmt_16_16_16_16_snorm"
+	"store_texture_cube_array_fmt_16_16_16_16_uint"
+	"store_texture_cube_array_fmt_16_16_16_16_sint"
+	"store_texture_cube_array_fmt_16_16_float"
+	"store_texture_cube_array_fmt_16_16_unorm"
+	"store_texture_cube_array_fmt_16_16_snorm"
+	"store_texture_cube_array_fmt_16_16_uint"
+	"store_texture_cube_array_fmt_16_16_sint"
+	"store_texture_cube_array_fmt_16_float"
+	"store_texture_cube_array_fmt_16_unorm"
+	"store_texture_cube_array_fmt_16_snorm"
+	"store_texture_cube_array_fmt_16_uint"
+	"store_texture_cube_array_fmt_16_sint"
+	"store_texture_cube_array_fmt_32_32_32_32_float"
+	"store_texture_cube_array_fmt_32_32_32_32_uint"
+	"store_texture_cube_array_fmt_32_32_32_32_sint"
+	"store_texture_cube_array_fmt_32_32_float"
+	"store_texture_cube_array_fmt_32_32_uint"
+	"store_texture_cube_array_fmt_32_32_sint"
+	"store_texture_cube_array_fmt_32_float"
+	"store_texture_cube_array_fmt_32_uint"
+	"store_texture_cube_array_fmt_32_sint"
+	"store_texture_cube_array_fmt_64_uint"
+	"store_texture_cube_array_fmt_64_sint"
+	"store_texture_cube_array_fmt_11_11_10_float"
+	"store_texture_cube_array_fmt_10_10_10_2_unorm"
+	"store_texture_cube_array_fmt_10_10_10_2_uint"
+	"store_texture_cube_ms_fmt_8_8_8_8_unorm"
+	"store_texture_cube_ms_fmt_8_8_8_8_snorm"
+	"store_texture_cube_ms_fmt_8_8_8_8_uint"
+	"store_texture_cube_ms_fmt_8_8_8_8_sint"
+	"store_texture_cube_ms_fmt_8_8_unorm"
+	"store_texture_cube_ms_fmt_8_8_snorm"
+	"store_texture_cube_ms_fmt_8_8_uint"
+	"store_texture_cube_ms_fmt_8_8_sint",
+	"store_texture_cube_ms_fmt_8_unorm"
+	"store_texture_cube_ms_fmt_8_snorm"
+	"store_texture_cube_ms_fmt_8_uint"
+	"store_texture_cube_ms_fmt_8_sint"
+	"store_texture_cube_ms_fmt_16_16_16_16_float"
+	"store_texture_cube_ms_fmt_16_16_16_16_unorm"
+	"store_texture_cube_ms_fmt_16_16_16_16_snorm"
+	"store_texture_cube_ms_fmt_16_16_16_16_uint"
+	"store_texture_cube_ms_fmt_16_16_16_16_sint"
+	"store_texture_cube_ms_fmt_16_16_float"
+	"store_texture_cube_ms_fmt_16_16_unorm"
+	"store_texture_cube_ms_fmt_16_16_snorm"
+	"store_texture_cube_ms_fmt_16_16_uint"
+	"store_texture_cube_ms_fmt_16_16_sint"
+	"store_texture_cube_ms_fmt_16_float"
+	"store_texture_cube_ms_fmt_16_unorm"
+	"store_texture_cube_ms_fmt_16_snorm"
+	"store_texture_cube_ms_fmt_16_uint"
+	"store_texture_cube_ms_fmt_16_sint"
+	"store_texture_cube_ms_fmt_32_32_32_32_float"
+	"store_texture_cube_ms_fmt_32_32_32_32_uint"
+	"store_texture_cube_ms_fmt_32_32_32_32_sint"
+	"store_texture_cube_ms_fmt_32_32_float"
+	"store_texture_cube_ms_fmt_32_32_uint"
+	"store_texture_cube_ms_fmt_32_32_sint"
+	"store_texture_cube_ms_fmt_32_float"
+	"store_texture_cube_ms_fmt_32_uint"
+	"store_texture_cube_ms_fmt_32_sint"
+	"store_texture_cube_ms_fmt_64_uint"
+	"store_texture_cube_ms_fmt_64_sint"
+	"store_texture_cube_ms_fmt_11_11_10_float"
+	"store_texture_cube_ms_fmt_10_10_10_2_unorm"
+	"store_texture_cube_ms_fmt_10_10_10_2_uint"
+	"store_texture_cube_ms_array_fmt_8_8_8_8_unorm"
+	"store_texture_cube_ms_array_fmt_8_8_8_8_snorm"
+	"store_texture_cube_ms_array_fmt_8_8_8_8_uint"
+	"store_texture_cube_ms_array_fmt_8_8_8_8_sint"
+	"store_texture_cube_ms_array_fmt_8_8_unorm"
+	"store_texture_cube_ms_array_fmt_8_8_snorm"
+	"store_texture_cube_ms_array_fmt_8_8_uint"
+	"store_texture_cube_ms_array_fmt_8_8_sint"
+	"store_texture_cube_ms_array_fmt_8_unorm"
+	"store_texture_cube_ms_array_fmt_8_snorm"
+	"store_texture_cube_ms_array_fmt_8_uint"
+	"store_texture_cube_ms_array_fmt_8_sint"
+	"store_texture_cube_ms_array_fmt_16_16_16_16_float"
+	"store_texture_cube_ms_array_fmt_16_16_16_16_unorm"
+	"store_texture_cube_ms_array_fmt_16_16_16_16_snorm"
+	"store_texture_cube_ms_array_fmt_16_16_16_16_uint"
+	"store_texture_cube_ms_array_fmt_16_16_16_16_sint"
+	"store_texture_cube_ms_array_fmt_16_16_float"
+	"store_texture_cube_ms_array_fmt_16_16_unorm"
+	"store_texture_cube_ms_array_fmt_16_16_snorm"
+	"store_texture_cube_ms_array_fmt_16_16_uint"
+	"store_texture_cube_ms_array_fmt_16_16_sint"
+	"store_texture_cube_ms_array_fmt_16_float"
+	"store_texture_cube_ms_array_fmt_16_unorm"
+	"store_texture_cube_ms_array_fmt_16_snorm"
+	"store_texture_cube_ms_array_fmt_16_uint"
+	"store_texture_cube_ms_array_fmt_16_sint"
+	"store_texture_cube_ms_array_fmt_32_32_32_32_float"
+	"store_texture_cube_ms_array_fmt_32_32_32_32_uint"
+	"store_texture_cube_ms_array_fmt_32_32_32_32_sint"
+	"store_texture_cube_ms_array_fmt_32_32_float"
+	"store_texture_cube_ms_array_fmt_32_32_uint"
+	"store_texture_cube_ms_array_fmt_32_32_sint"
+	"store_texture_cube_ms_array_fmt_32_float"
+	"store_texture_cube_ms_array_fmt_32_uint"
+	"store_texture_cube_ms_array_fmt_32_sint"
+	"store_texture_cube_ms_array_fmt_64_uint"
+	"store_texture_cube_ms_array_fmt_64_sint"
+	"store_texture_cube_ms_array_fmt_11_11_10_float"
+	"store_texture_cube_ms_array_fmt_10_10_10_2_unorm"
+	"store_texture_cube_ms_array_fmt_10_10_10_2_uint"
+	"addr_ro_texture_1d_fmt_8_8_8_8_unorm"
+	"addr_ro_texture_1d_fmt_8_8_8_8_snorm"
+	"addr_ro_texture_1d_fmt_8_8_8_8_uint"
+	"addr_ro_texture_1d_fmt_8_8_8_8_sint"
+	"addr_ro_texture_1d_fmt_8_8_unorm"
+	"addr_ro_texture_1d_fmt_8_8_snorm"
+	"addr_ro_texture_1d_fmt_8_8_uint"
+	"addr_ro_texture_1d_fmt_8_8_sint"
+	"addr_ro_texture_1d_fmt_8_unorm"
+	"addr_ro_texture_1d_fmt_8_snorm"
+	"addr_ro_texture_1d_fmt_8_uint"
+	"addr_ro_texture_1d_fmt_8_sint"
+	"addr_ro_texture_1d_fmt_16_16_16_16_float"
+	"addr_ro_texture_1d_fmt_16_16_16_16_unorm"
+	"addr_ro_texture_1d_fmt_16_16_16_16_snorm"
+	"addr_ro_texture_1d_fmt_16_16_16_16_uint"
+	"addr_ro_texture_1d_fmt_16_16_16_16_sint"
+	"addr_ro_texture_1d_fmt_16_16_float"
+	"addr_ro_texture_1d_fmt_16_16_unorm"
+	"addr_ro_texture_1d_fmt_16_16_snorm"
+	"addr_ro_texture_1d_fmt_16_16_uint"
+	"addr_ro_texture_1d_fmt_16_16_sint"
+	"addr_ro_texture_1d_fmt_16_float"
+	"addr_ro_texture_1d_fmt_16_unorm"
+	"addr_ro_texture_1d_fmt_16_snorm"
+	"addr_ro_texture_1d_fmt_16_uint"
+	"addr_ro_texture_1d_fmt_16_sint"
+	"addr_ro_texture_1d_fmt_32_32_32_32_float"
+	"addr_ro_texture_1d_fmt_32_32_32_32_uint"
+	"addr_ro_texture_1d_fmt_32_32_32_32_sint"
+	"addr_ro_texture_1d_fmt_32_32_float"
+	"addr_ro_texture_1d_fmt_32_32_uint",
+	"addr_ro_texture_1d_fmt_32_32_sint"
+	"addr_ro_texture_1d_fmt_32_float"
+	"addr_ro_texture_1d_fmt_32_uint"
+	"addr_ro_texture_1d_fmt_32_sint"
+	"addr_ro_texture_1d_fmt_64_uint"
+	"addr_ro_texture_1d_fmt_64_sint"
+	"addr_ro_texture_1d_fmt_11_11_10_float"
+	"addr_ro_texture_1d_fmt_10_10_10_2_unorm"
+	"addr_ro_texture_1d_fmt_10_10_10_2_uint"
+	"addr_ro_texture_1d_array_fmt_8_8_8_8_unorm"
+	"addr_ro_texture_1d_array_fmt_8_8_8_8_snorm"
+	"addr_ro_texture_1d_array_fmt_8_8_8_8_uint"
+	"addr_ro_texture_1d_array_fmt_8_8_8_8_sint"
+	"addr_ro_texture_1d_array_fmt_8_8_unorm"
+	"addr_ro_texture_1d_array_fmt_8_8_snorm"
+	"addr_ro_texture_1d_array_fmt_8_8_uint"
+	"addr_ro_texture_1d_array_fmt_8_8_sint"
+	"addr_ro_texture_1d_array_fmt_8_unorm"
+	"addr_ro_texture_1d_array_fmt_8_snorm"
+	"addr_ro_texture_1d_array_fmt_8_uint"
+	"addr_ro_texture_1d_array_fmt_8_sint"
+	"addr_ro_texture_1d_array_fmt_16_16_16_16_float"
+	"addr_ro_texture_1d_array_fmt_16_16_16_16_unorm"
+	"addr_ro_texture_1d_array_fmt_16_16_16_16_snorm"
+	"addr_ro_texture_1d_array_fmt_16_16_16_16_uint"
+	"addr_ro_texture_1d_array_fmt_16_16_16_16_sint"
+	"addr_ro_texture_1d_array_fmt_16_16_float"
+	"addr_ro_texture_1d_array_fmt_16_16_unorm"
+	"addr_ro_texture_1d_array_fmt_16_16_snorm"
+	"addr_ro_texture_1d_array_fmt_16_16_uint"
+	"addr_ro_texture_1d_array_fmt_16_16_sint"
+	"addr_ro_texture_1d_array_fmt_16_float"
+	"addr_ro_texture_1d_array_fmt_16_unorm"
+	"addr_ro_texture_1d_array_fmt_16_snorm"
+	"addr_ro_texture_1d_array_fmt_16_uint"
+	"addr_ro_texture_1d_array_fmt_16_sint"
+	"addr_ro_texture_1d_array_fmt_32_32_32_32_float"
+	"addr_ro_texture_1d_array_fmt_32_32_32_32_uint"
+	"addr_ro_texture_1d_array_fmt_32_32_32_32_sint"
+	"addr_ro_texture_1d_array_fmt_32_32_float"
+	"addr_ro_texture_1d_array_fmt_32_32_uint"
+	"addr_ro_texture_1d_array_fmt_32_32_sint"
+	"addr_ro_texture_1d_array_fmt_32_float"
+	"addr_ro_texture_1d_array_fmt_32_uint"
+	"addr_ro_texture_1d_array_fmt_32_sint"
+	"addr_ro_texture_1d_array_fmt_64_uint"
+	"addr_ro_texture_1d_array_fmt_64_sint"
+	"addr_ro_texture_1d_array_fmt_11_11_10_float"
+	"addr_ro_texture_1d_array_fmt_10_10_10_2_unorm"
+	"addr_ro_texture_1d_array_fmt_10_10_10_2_uint"
+	"addr_ro_texture_1d_ms_fmt_8_8_8_8_unorm"
+	"addr_ro_texture_1d_ms_fmt_8_8_8_8_snorm"
+	"addr_ro_texture_1d_ms_fmt_8_8_8_8_uint"
+	"addr_ro_texture_1d_ms_fmt_8_8_8_8_sint"
+	"addr_ro_texture_1d_ms_fmt_8_8_unorm"
+	"addr_ro_texture_1d_ms_fmt_8_8_snorm"
+	"addr_ro_texture_1d_ms_fmt_8_8_uint"
+	"addr_ro_texture_1d_ms_fmt_8_8_sint"
+	"addr_ro_texture_1d_ms_fmt_8_unorm"
+	"addr_ro_texture_1d_ms_fmt_8_snorm"
+	"addr_ro_texture_1d_ms_fmt_8_uint"
+	"addr_ro_texture_1d_ms_fmt_8_sint"
+	"addr_ro_texture_1d_ms_fmt_16_16_16_16_float"
+	"addr_ro_texture_1d_ms_fmt_16_16_16_16_unorm"
+	"addr_ro_texture_1d_ms_fmt_16_16_16_16_snorm"
+	"addr_ro_texture_1d_ms_fmt_16_16_16_16_uint"
+	"addr_ro_texture_1d_ms_fmt_16_16_16_16_sint"
+	"addr_ro_texture_1d_ms_fmt_16_16_float"
+	"addr_ro_texture_1d_ms_fmt_16_16_unorm"
+	"addr_ro_texture_1d_ms_fmt_16_16_snorm"
+	"addr_ro_texture_1d_ms_fmt_16_16_uint"
+	"addr_ro_texture_1d_ms_fmt_16_16_sint"
+	"addr_ro_texture_1d_ms_fmt_16_float"
+	"addr_ro_texture_1d_ms_fmt_16_unorm"
+	"addr_ro_texture_1d_ms_fmt_16_snorm"
+	"addr_ro_texture_1d_ms_fmt_16_uint"
+	"addr_ro_texture_1d_ms_fmt_16_sint"
+	"addr_ro_texture_1d_ms_fmt_32_32_32_32_float"
+	"addr_ro_texture_1d_ms_fmt_32_32_32_32_uint"
+	"addr_ro_texture_1d_ms_fmt_32_32_32_32_sint"
+	"addr_ro_texture_1d_ms_fmt_32_32_float"
+	"addr_ro_texture_1d_ms_fmt_32_32_uint"
+	"addr_ro_texture_1d_ms_fmt_32_32_sint"
+	"addr_ro_texture_1d_ms_fmt_32_float"
+	"addr_ro_texture_1d_ms_fmt_32_uint"
+	"addr_ro_texture_1d_ms_fmt_32_sint"
+	"addr_ro_texture_1d_ms_fmt_64_uint"
+	"addr_ro_texture_1d_ms_fmt_64_sint"
+	"addr_ro_texture_1d_ms_fmt_11_11_10_float"
+	"addr_ro_texture_1d_ms_fmt_10_10_10_2_unorm"
+	"addr_ro_texture_1d_ms_fmt_10_10_10_2_uint"
+	"addr_ro_texture_1d_ms_array_fmt_8_8_8_8_unorm"
+	"addr_ro_texture_1d_ms_array_fmt_8_8_8_8_snorm"
+	"addr_ro_texture_1d_ms_array_fmt_8_8_8_8_uint"
+	"addr_ro_texture_1d_ms_array_fmt_8_8_8_8_sint"
+	"addr_ro_texture_1d_ms_array_fmt_8_8_unorm"
+	"addr_ro_texture_1d_ms_array_fmt_8_8_snorm"
+	"addr_ro_texture_1d_ms_array_fmt_8_8_uint"
+	"addr_ro_texture_1d_ms_array_fmt_8_8_sint"
+	"addr_ro_texture_1d_ms_array_fmt_8_unorm"
+	"addr_ro_texture_1d_ms_array_fmt_8_snorm"
+	"addr_ro_texture_1d_ms_array_fmt_8_uint"
+	"addr_ro_texture_1d_ms_array_fmt_8_sint"
+	"addr_ro_texture_1d_ms_array_fmt_16_16_16_16_float"
+	"addr_ro_texture_1d_ms_array_fmt_16_16_16_16_unorm"
+	"addr_ro_texture_1d_ms_array_fmt_16_16_16_16_snorm",
+	"addr_ro_texture_1d_ms_array_fmt_16_16_16_16_uint"
+	"addr_ro_texture_1d_ms_array_fmt_16_16_16_16_sint"
+	"addr_ro_texture_1d_ms_array_fmt_16_16_float"
+	"addr_ro_texture_1d_ms_array_fmt_16_16_unorm"
+	"addr_ro_texture_1d_ms_array_fmt_16_16_snorm"
+	"addr_ro_texture_1d_ms_array_fmt_16_16_uint"
+	"addr_ro_texture_1d_ms_array_fmt_16_16_sint"
+	"addr_ro_texture_1d_ms_array_fmt_16_float"
+	"addr_ro_texture_1d_ms_array_fmt_16_unorm"
+	"addr_ro_texture_1d_ms_array_fmt_16_snorm"
+	"addr_ro_texture_1d_ms_array_fmt_16_uint"
+	"addr_ro_texture_1d_ms_array_fmt_16_sint"
+	"addr_ro_texture_1d_ms_array_fmt_32_32_32_32_float"
+	"addr_ro_texture_1d_ms_array_fmt_32_32_32_32_uint"
+	"addr_ro_texture_1d_ms_array_fmt_32_32_32_32_sint"
+	"addr_ro_texture_1d_ms_array_fmt_32_32_float"
+	"addr_ro_texture_1d_ms_array_fmt_32_32_uint"
+	"addr_ro_texture_1d_ms_array_fmt_32_32_sint"
+	"addr_ro_texture_1d_ms_array_fmt_32_float"
+	"addr_ro_texture_1d_ms_array_fmt_32_uint"
+	"addr_ro_texture_1d_ms_array_fmt_32_sint"
+	"addr_ro_texture_1d_ms_array_fmt_64_uint"
+	"addr_ro_texture_1d_ms_array_fmt_64_sint"
+	"addr_ro_texture_1d_ms_array_fmt_11_11_10_float"
+	"addr_ro_texture_1d_ms_array_fmt_10_10_10_2_unorm"
+	"addr_ro_texture_1d_ms_array_fmt_10_10_10_2_uint"
+	"addr_ro_texture_2d_fmt_8_8_8_8_unorm"
+	"addr_ro_texture_2d_fmt_8_8_8_8_snorm"
+	"addr_ro_texture_2d_fmt_8_8_8_8_uint"
+	"addr_ro_texture_2d_fmt_8_8_8_8_sint"
+	"addr_ro_texture_2d_fmt_8_8_unorm"
+	"addr_ro_texture_2d_fmt_8_8_snorm"
+	"addr_ro_texture_2d_fmt_8_8_uint"
+	"addr_ro_texture_2d_fmt_8_8_sint"
+	"addr_ro_texture_2d_fmt_8_unorm"
+	"addr_ro_texture_2d_fmt_8_snorm"
+	"addr_ro_texture_2d_fmt_8_uint"
+	"addr_ro_texture_2d_fmt_8_sint"
+	"addr_ro_texture_2d_fmt_16_16_16_16_float"
+	"addr_ro_texture_2d_fmt_16_16_16_16_unorm"
+	"addr_ro_texture_2d_fmt_16_16_16_16_snorm"
+	"addr_ro_texture_2d_fmt_16_16_16_16_uint"
+	"addr_ro_texture_2d_fmt_16_16_16_16_sint"
+	"addr_ro_texture_2d_fmt_16_16_float"
+	"addr_ro_texture_2d_fmt_16_16_unorm"
+	"addr_ro_texture_2d_fmt_16_16_snorm"
+	"addr_ro_texture_2d_fmt_16_16_uint"
+	"addr_ro_texture_2d_fmt_16_16_sint"
+	"addr_ro_texture_2d_fmt_16_float"
+	"addr_ro_texture_2d_fmt_16_unorm"
+	"addr_ro_texture_2d_fmt_16_snorm"
+	"addr_ro_texture_2d_fmt_16_uint"
+	"addr_ro_texture_2d_fmt_16_sint"
+	"addr_ro_texture_2d_fmt_32_32_32_32_float"
+	"addr_ro_texture_2d_fmt_32_32_32_32_uint"
+	"addr_ro_texture_2d_fmt_32_32_32_32_sint"
+	"addr_ro_texture_2d_fmt_32_32_float"
+	"addr_ro_texture_2d_fmt_32_32_uint"
+	"addr_ro_texture_2d_fmt_32_32_sint"
+	"addr_ro_texture_2d_fmt_32_float"
+	"addr_ro_texture_2d_fmt_32_uint"
+	"addr_ro_texture_2d_fmt_32_sint"
+	"addr_ro_texture_2d_fmt_64_uint"
+	"addr_ro_texture_2d_fmt_64_sint"
+	"addr_ro_texture_2d_fmt_11_11_10_float"
+	"addr_ro_texture_2d_fmt_10_10_10_2_unorm"
+	"addr_ro_texture_2d_fmt_10_10_10_2_uint"
+	"addr_ro_texture_2d_array_fmt_8_8_8_8_unorm"
+	"addr_ro_texture_2d_array_fmt_8_8_8_8_snorm"
+	"addr_ro_texture_2d_array_fmt_8_8_8_8_uint"
+	"addr_ro_texture_2d_array_fmt_8_8_8_8_sint"
+	"addr_ro_texture_2d_array_fmt_8_8_unorm"
+	"addr_ro_texture_2d_array_fmt_8_8_snorm"
+	"addr_ro_texture_2d_array_fmt_8_8_uint"
+	"addr_ro_texture_2d_array_fmt_8_8_sint"
+	"addr_ro_texture_2d_array_fmt_8_unorm"
+	"addr_ro_texture_2d_array_fmt_8_snorm"
+	"addr_ro_texture_2d_array_fmt_8_uint"
+	"addr_ro_texture_2d_array_fmt_8_sint"
+	"addr_ro_texture_2d_array_fmt_16_16_16_16_float"
+	"addr_ro_texture_2d_array_fmt_16_16_16_16_unorm"
+	"addr_ro_texture_2d_array_fmt_16_16_16_16_snorm"
+	"addr_ro_texture_2d_array_fmt_16_16_16_16_uint"
+	"addr_ro_texture_2d_array_fmt_16_16_16_16_sint"
+	"addr_ro_texture_2d_array_fmt_16_16_float"
+	"addr_ro_texture_2d_array_fmt_16_16_unorm"
+	"addr_ro_texture_2d_array_fmt_16_16_snorm"
+	"addr_ro_texture_2d_array_fmt_16_16_uint"
+	"addr_ro_texture_2d_array_fmt_16_16_sint"
+	"addr_ro_texture_2d_array_fmt_16_float"
+	"addr_ro_texture_2d_array_fmt_16_unorm"
+	"addr_ro_texture_2d_array_fmt_16_snorm"
+	"addr_ro_texture_2d_array_fmt_16_uint"
+	"addr_ro_texture_2d_array_fmt_16_sint"
+	"addr_ro_texture_2d_array_fmt_32_32_32_32_float"
+	"addr_ro_texture_2d_array_fmt_32_32_32_32_uint"
+	"addr_ro_texture_2d_array_fmt_32_32_32_32_sint"
+	"addr_ro_texture_2d_array_fmt_32_32_float"
+	"addr_ro_texture_2d_array_fmt_32_32_uint"
+	"addr_ro_texture_2d_array_fmt_32_32_sint"
+	"addr_ro_texture_2d_array_fmt_32_float"
+	"addr_ro_texture_2d_array_fmt_32_uint"
+	"addr_ro_texture_2d_array_fmt_32_sint"
+	"addr_ro_texture_2d_array_fmt_64_uint"
+	"addr_ro_texture_2d_array_fmt_64_sint"
+	"addr_ro_texture_2d_array_fmt_11_11_10_float"
+	"addr_ro_texture_2d_array_fmt_10_10_10_2_unorm",
+	"addr_ro_texture_2d_array_fmt_10_10_10_2_uint"
+	"addr_ro_texture_2d_ms_fmt_8_8_8_8_unorm"
+	"addr_ro_texture_2d_ms_fmt_8_8_8_8_snorm"
+	"addr_ro_texture_2d_ms_fmt_8_8_8_8_uint"
+	"addr_ro_texture_2d_ms_fmt_8_8_8_8_sint"
+	"addr_ro_texture_2d_ms_fmt_8_8_unorm"
+	"addr_ro_texture_2d_ms_fmt_8_8_snorm"
+	"addr_ro_texture_2d_ms_fmt_8_8_uint"
+	"addr_ro_texture_2d_ms_fmt_8_8_sint"
+	"addr_ro_texture_2d_ms_fmt_8_unorm"
+	"addr_ro_texture_2d_ms_fmt_8_snorm"
+	"addr_ro_texture_2d_ms_fmt_8_uint"
+	"addr_ro_texture_2d_ms_fmt_8_sint"
+	"addr_ro_texture_2d_ms_fmt_16_16_16_16_float"
+	"addr_ro_texture_2d_ms_fmt_16_16_16_16_unorm"
+	"addr_ro_texture_2d_ms_fmt_16_16_16_16_snorm"
+	"addr_ro_texture_2d_ms_fmt_16_16_16_16_uint"
+	"addr_ro_texture_2d_ms_fmt_16_16_16_16_sint"
+	"addr_ro_texture_2d_ms_fmt_16_16_float"
+	"addr_ro_texture_2d_ms_fmt_16_16_unorm"
+	"addr_ro_texture_2d_ms_fmt_16_16_snorm"
+	"addr_ro_texture_2d_ms_fmt_16_16_uint"
+	"addr_ro_texture_2d_ms_fmt_16_16_sint"
+	"addr_ro_texture_2d_ms_fmt_16_float"
+	"addr_ro_texture_2d_ms_fmt_16_unorm"
+	"addr_ro_texture_2d_ms_fmt_16_snorm"
+	"addr_ro_texture_2d_ms_fmt_16_uint"
+	"addr_ro_texture_2d_ms_fmt_16_sint"
+	"addr_ro_texture_2d_ms_fmt_32_32_32_32_float"
+	"addr_ro_texture_2d_ms_fmt_32_32_32_32_uint"
+	"addr_ro_texture_2d_ms_fmt_32_32_32_32_sint"
+	"addr_ro_texture_2d_ms_fmt_32_32_float"
+	"addr_ro_texture_2d_ms_fmt_32_32_uint"
+	"addr_ro_texture_2d_ms_fmt_32_32_sint"
+	"addr_ro_texture_2d_ms_fmt_32_float"
+	"addr_ro_texture_2d_ms_fmt_32_uint"
+	"addr_ro_texture_2d_ms_fmt_32_sint"
+	"addr_ro_texture_2d_ms_fmt_64_uint"
+	"addr_ro_texture_2d_ms_fmt_64_sint"
+	"addr_ro_texture_2d_ms_fmt_11_11_10_float"
+	"addr_ro_texture_2d_ms_fmt_10_10_10_2_unorm"
+	"addr_ro_texture_2d_ms_fmt_10_10_10_2_uint"
+	"addr_ro_texture_2d_ms_array_fmt_8_8_8_8_unorm"
+	"addr_ro_texture_2d_ms_array_fmt_8_8_8_8_snorm"
+	"addr_ro_texture_2d_ms_array_fmt_8_8_8_8_uint"
+	"addr_ro_texture_2d_ms_array_fmt_8_8_8_8_sint"
+	"addr_ro_texture_2d_ms_array_fmt_8_8_unorm"
+	"addr_ro_texture_2d_ms_array_fmt_8_8_snorm"
+	"addr_ro_texture_2d_ms_array_fmt_8_8_uint"
+	"addr_ro_texture_2d_ms_array_fmt_8_8_sint"
+	"addr_ro_texture_2d_ms_array_fmt_8_unorm"
+	"addr_ro_texture_2d_ms_array_fmt_8_snorm"
+	"addr_ro_texture_2d_ms_array_fmt_8_uint"
+	"addr_ro_texture_2d_ms_array_fmt_8_sint"
+	"addr_ro_texture_2d_ms_array_fmt_16_16_16_16_float"
+	"addr_ro_texture_2d_ms_array_fmt_16_16_16_16_unorm"
+	"addr_ro_texture_2d_ms_array_fmt_16_16_16_16_snorm"
+	"addr_ro_texture_2d_ms_array_fmt_16_16_16_16_uint"
+	"addr_ro_texture_2d_ms_array_fmt_16_16_16_16_sint"
+	"addr_ro_texture_2d_ms_array_fmt_16_16_float"
+	"addr_ro_texture_2d_ms_array_fmt_16_16_unorm"
+	"addr_ro_texture_2d_ms_array_fmt_16_16_snorm"
+	"addr_ro_texture_2d_ms_array_fmt_16_16_uint"
+	"addr_ro_texture_2d_ms_array_fmt_16_16_sint"
+	"addr_ro_texture_2d_ms_array_fmt_16_float"
+	"addr_ro_texture_2d_ms_array_fmt_16_unorm"
+	"addr_ro_texture_2d_ms_array_fmt_16_snorm"
+	"addr_ro_texture_2d_ms_array_fmt_16_uint"
+	"addr_ro_texture_2d_ms_array_fmt_16_sint"
+	"addr_ro_texture_2d_ms_array_fmt_32_32_32_32_float"
+	"addr_ro_texture_2d_ms_array_fmt_32_32_32_32_uint"
+	"addr_ro_texture_2d_ms_array_fmt_32_32_32_32_sint"
+	"addr_ro_texture_2d_ms_array_fmt_32_32_float"
+	"addr_ro_texture_2d_ms_array_fmt_32_32_uint"
+	"addr_ro_texture_2d_ms_array_fmt_32_32_sint"
+	"addr_ro_texture_2d_ms_array_fmt_32_float"
+	"addr_ro_texture_2d_ms_array_fmt_32_uint"
+	"addr_ro_texture_2d_ms_array_fmt_32_sint"
+	"addr_ro_texture_2d_ms_array_fmt_64_uint"
+	"addr_ro_texture_2d_ms_array_fmt_64_sint"
+	"addr_ro_texture_2d_ms_array_fmt_11_11_10_float"
+	"addr_ro_texture_2d_ms_array_fmt_10_10_10_2_unorm"
+	"addr_ro_texture_2d_ms_array_fmt_10_10_10_2_uint"
+	"addr_ro_texture_3d_fmt_8_8_8_8_unorm"
+	"addr_ro_texture_3d_fmt_8_8_8_8_snorm"
+	"addr_ro_texture_3d_fmt_8_8_8_8_uint"
+	"addr_ro_texture_3d_fmt_8_8_8_8_sint"
+	"addr_ro_texture_3d_fmt_8_8_unorm"
+	"addr_ro_texture_3d_fmt_8_8_snorm"
+	"addr_ro_texture_3d_fmt_8_8_uint"
+	"addr_ro_texture_3d_fmt_8_8_sint"
+	"addr_ro_texture_3d_fmt_8_unorm"
+	"addr_ro_texture_3d_fmt_8_snorm"
+	"addr_ro_texture_3d_fmt_8_uint"
+	"addr_ro_texture_3d_fmt_8_sint"
+	"addr_ro_texture_3d_fmt_16_16_16_16_float"
+	"addr_ro_texture_3d_fmt_16_16_16_16_unorm"
+	"addr_ro_texture_3d_fmt_16_16_16_16_snorm"
+	"addr_ro_texture_3d_fmt_16_16_16_16_uint"
+	"addr_ro_texture_3d_fmt_16_16_16_16_sint"
+	"addr_ro_texture_3d_fmt_16_16_float"
+	"addr_ro_texture_3d_fmt_16_16_unorm"
+	"addr_ro_texture_3d_fmt_16_16_snorm"
+	"addr_ro_texture_3d_fmt_16_16_uint"
+	"addr_ro_texture_3d_fmt_16_16_sint"
+	"addr_ro_texture_3d_fmt_16_float",
+	"addr_ro_texture_3d_fmt_16_unorm"
+	"addr_ro_texture_3d_fmt_16_snorm"
+	"addr_ro_texture_3d_fmt_16_uint"
+	"addr_ro_texture_3d_fmt_16_sint"
+	"addr_ro_texture_3d_fmt_32_32_32_32_float"
+	"addr_ro_texture_3d_fmt_32_32_32_32_uint"
+	"addr_ro_texture_3d_fmt_32_32_32_32_sint"
+	"addr_ro_texture_3d_fmt_32_32_float"
+	"addr_ro_texture_3d_fmt_32_32_uint"
+	"addr_ro_texture_3d_fmt_32_32_sint"
+	"addr_ro_texture_3d_fmt_32_float"
+	"addr_ro_texture_3d_fmt_32_uint"
+	"addr_ro_texture_3d_fmt_32_sint"
+	"addr_ro_texture_3d_fmt_64_uint"
+	"addr_ro_texture_3d_fmt_64_sint"
+	"addr_ro_texture_3d_fmt_11_11_10_float"
+	"addr_ro_texture_3d_fmt_10_10_10_2_unorm"
+	"addr_ro_texture_3d_fmt_10_10_10_2_uint"
+	"addr_ro_texture_3d_array_fmt_8_8_8_8_unorm"
+	"addr_ro_texture_3d_array_fmt_8_8_8_8_snorm"
+	"addr_ro_texture_3d_array_fmt_8_8_8_8_uint"
+	"addr_ro_texture_3d_array_fmt_8_8_8_8_sint"
+	"addr_ro_texture_3d_array_fmt_8_8_unorm"
+	"addr_ro_texture_3d_array_fmt_8_8_snorm"
+	"addr_ro_texture_3d_array_fmt_8_8_uint"
+	"addr_ro_texture_3d_array_fmt_8_8_sint"
+	"addr_ro_texture_3d_array_fmt_8_unorm"
+	"addr_ro_texture_3d_array_fmt_8_snorm"
+	"addr_ro_texture_3d_array_fmt_8_uint"
+	"addr_ro_texture_3d_array_fmt_8_sint"
+	"addr_ro_texture_3d_array_fmt_16_16_16_16_float"
+	"addr_ro_texture_3d_array_fmt_16_16_16_16_unorm"
+	"addr_ro_texture_3d_array_fmt_16_16_16_16_snorm"
+	"addr_ro_texture_3d_array_fmt_16_16_16_16_uint"
+	"addr_ro_texture_3d_array_fmt_16_16_16_16_sint"
+	"addr_ro_texture_3d_array_fmt_16_16_float"
+	"addr_ro_texture_3d_array_fmt_16_16_unorm"
+	"addr_ro_texture_3d_array_fmt_16_16_snorm"
+	"addr_ro_texture_3d_array_fmt_16_16_uint"
+	"addr_ro_texture_3d_array_fmt_16_16_sint"
+	"addr_ro_texture_3d_array_fmt_16_float"
+	"addr_ro_texture_3d_array_fmt_16_unorm"
+	"addr_ro_texture_3d_array_fmt_16_snorm"
+	"addr_ro_texture_3d_array_fmt_16_uint"
+	"addr_ro_texture_3d_array_fmt_16_sint"
+	"addr_ro_texture_3d_array_fmt_32_32_32_32_float"
+	"addr_ro_texture_3d_array_fmt_32_32_32_32_uint"
+	"addr_ro_texture_3d_array_fmt_32_32_32_32_sint"
+	"addr_ro_texture_3d_array_fmt_32_32_float"
+	"addr_ro_texture_3d_array_fmt_32_32_uint"
+	"addr_ro_texture_3d_array_fmt_32_32_sint"
+	"addr_ro_texture_3d_array_fmt_32_float"
+	"addr_ro_texture_3d_array_fmt_32_uint"
+	"addr_ro_texture_3d_array_fmt_32_sint"
+	"addr_ro_texture_3d_array_fmt_64_uint"
+	"addr_ro_texture_3d_array_fmt_64_sint"
+	"addr_ro_texture_3d_array_fmt_11_11_10_float"
+	"addr_ro_texture_3d_array_fmt_10_10_10_2_unorm"
+	"addr_ro_texture_3d_array_fmt_10_10_10_2_uint"
+	"addr_ro_texture_3d_ms_fmt_8_8_8_8_unorm"
+	"addr_ro_texture_3d_ms_fmt_8_8_8_8_snorm"
+	"addr_ro_texture_3d_ms_fmt_8_8_8_8_uint"
+	"addr_ro_texture_3d_ms_fmt_8_8_8_8_sint"
+	"addr_ro_texture_3d_ms_fmt_8_8_unorm"
+	"addr_ro_texture_3d_ms_fmt_8_8_snorm"
+	"addr_ro_texture_3d_ms_fmt_8_8_uint"
+	"addr_ro_texture_3d_ms_fmt_8_8_sint"
+	"addr_ro_texture_3d_ms_fmt_8_unorm"
+	"addr_ro_texture_3d_ms_fmt_8_snorm"
+	"addr_ro_texture_3d_ms_fmt_8_uint"
+	"addr_ro_texture_3d_ms_fmt_8_sint"
+	"addr_ro_texture_3d_ms_fmt_16_16_16_16_float"
+	"addr_ro_texture_3d_ms_fmt_16_16_16_16_unorm"
+	"addr_ro_texture_3d_ms_fmt_16_16_16_16_snorm"
+	"addr_ro_texture_3d_ms_fmt_16_16_16_16_uint"
+	"addr_ro_texture_3d_ms_fmt_16_16_16_16_sint"
+	"addr_ro_texture_3d_ms_fmt_16_16_float"
+	"addr_ro_texture_3d_ms_fmt_16_16_unorm"
+	"addr_ro_texture_3d_ms_fmt_16_16_snorm"
+	"addr_ro_texture_3d_ms_fmt_16_16_uint"
+	"addr_ro_texture_3d_ms_fmt_16_16_sint"
+	"addr_ro_texture_3d_ms_fmt_16_float"
+	"addr_ro_texture_3d_ms_fmt_16_unorm"
+	"addr_ro_texture_3d_ms_fmt_16_snorm"
+	"addr_ro_texture_3d_ms_fmt_16_uint"
+	"addr_ro_texture_3d_ms_fmt_16_sint"
+	"addr_ro_texture_3d_ms_fmt_32_32_32_32_float"
+	"addr_ro_texture_3d_ms_fmt_32_32_32_32_uint"
+	"addr_ro_texture_3d_ms_fmt_32_32_32_32_sint"
+	"addr_ro_texture_3d_ms_fmt_32_32_float"
+	"addr_ro_texture_3d_ms_fmt_32_32_uint"
+	"addr_ro_texture_3d_ms_fmt_32_32_sint"
+	"addr_ro_texture_3d_ms_fmt_32_float"
+	"addr_ro_texture_3d_ms_fmt_32_uint"
+	"addr_ro_texture_3d_ms_fmt_32_sint"
+	"addr_ro_texture_3d_ms_fmt_64_uint"
+	"addr_ro_texture_3d_ms_fmt_64_sint"
+	"addr_ro_texture_3d_ms_fmt_11_11_10_float"
+	"addr_ro_texture_3d_ms_fmt_10_10_10_2_unorm"
+	"addr_ro_texture_3d_ms_fmt_10_10_10_2_uint"
+	"addr_ro_texture_3d_ms_array_fmt_8_8_8_8_unorm"
+	"addr_ro_texture_3d_ms_array_fmt_8_8_8_8_snorm"
+	"addr_ro_texture_3d_ms_array_fmt_8_8_8_8_uint"
+	"addr_ro_texture_3d_ms_array_fmt_8_8_8_8_sint"
+	"addr_ro_texture_3d_ms_array_fmt_8_8_unorm"
+	"addr_ro_texture_3d_ms_array_fmt_8_8_snorm"
+	"addr_ro_texture_3d_ms_array_fmt_8_8_uint"
+	"addr_ro_texture_3d_ms_array_fmt_8_8_sint",
+	"addr_ro_texture_3d_ms_array_fmt_8_unorm"
+	"addr_ro_texture_3d_ms_array_fmt_8_snorm"
+	"addr_ro_texture_3d_ms_array_fmt_8_uint"
+	"addr_ro_texture_3d_ms_array_fmt_8_sint"
+	"addr_ro_texture_3d_ms_array_fmt_16_16_16_16_float"
+	"addr_ro_texture_3d_ms_array_fmt_16_16_16_16_unorm"
+	"addr_ro_texture_3d_ms_array_fmt_16_16_16_16_snorm"
+	"addr_ro_texture_3d_ms_array_fmt_16_16_16_16_uint"
+	"addr_ro_texture_3d_ms_array_fmt_16_16_16_16_sint"
+	"addr_ro_texture_3d_ms_array_fmt_16_16_float"
+	"addr_ro_texture_3d_ms_array_fmt_16_16_unorm"
+	"addr_ro_texture_3d_ms_array_fmt_16_16_snorm"
+	"addr_ro_texture_3d_ms_array_fmt_16_16_uint"
+	"addr_ro_texture_3d_ms_array_fmt_16_16_sint"
+	"addr_ro_texture_3d_ms_array_fmt_16_float"
+	"addr_ro_texture_3d_ms_array_fmt_16_unorm"
+	"addr_ro_texture_3d_ms_array_fmt_16_snorm"
+	"addr_ro_texture_3d_ms_array_fmt_16_uint"
+	"addr_ro_texture_3d_ms_array_fmt_16_sint"
+	"addr_ro_texture_3d_ms_array_fmt_32_32_32_32_float"
+	"addr_ro_texture_3d_ms_array_fmt_32_32_32_32_uint"
+	"addr_ro_texture_3d_ms_array_fmt_32_32_32_32_sint"
+	"addr_ro_texture_3d_ms_array_fmt_32_32_float"
+	"addr_ro_texture_3d_ms_array_fmt_32_32_uint"
+	"addr_ro_texture_3d_ms_array_fmt_32_32_sint"
+	"addr_ro_texture_3d_ms_array_fmt_32_float"
+	"addr_ro_texture_3d_ms_array_fmt_32_uint"
+	"addr_ro_texture_3d_ms_array_fmt_32_sint"
+	"addr_ro_texture_3d_ms_array_fmt_64_uint"
+	"addr_ro_texture_3d_ms_array_fmt_64_sint"
+	"addr_ro_texture_3d_ms_array_fmt_11_11_10_float"
+	"addr_ro_texture_3d_ms_array_fmt_10_10_10_2_unorm"
+	"addr_ro_texture_3d_ms_array_fmt_10_10_10_2_uint"
+	"addr_ro_texture_cube_fmt_8_8_8_8_unorm"
+	"addr_ro_texture_cube_fmt_8_8_8_8_snorm"
+	"addr_ro_texture_cube_fmt_8_8_8_8_uint"
+	"addr_ro_texture_cube_fmt_8_8_8_8_sint"
+	"addr_ro_texture_cube_fmt_8_8_unorm"
+	"addr_ro_texture_cube_fmt_8_8_snorm"
+	"addr_ro_texture_cube_fmt_8_8_uint"
+	"addr_ro_texture_cube_fmt_8_8_sint"
+	"addr_ro_texture_cube_fmt_8_unorm"
+	"addr_ro_texture_cube_fmt_8_snorm"
+	"addr_ro_texture_cube_fmt_8_uint"
+	"addr_ro_texture_cube_fmt_8_sint"
+	"addr_ro_texture_cube_fmt_16_16_16_16_float"
+	"addr_ro_texture_cube_fmt_16_16_16_16_unorm"
+	"addr_ro_texture_cube_fmt_16_16_16_16_snorm"
+	"addr_ro_texture_cube_fmt_16_16_16_16_uint"
+	"addr_ro_texture_cube_fmt_16_16_16_16_sint"
+	"addr_ro_texture_cube_fmt_16_16_float"
+	"addr_ro_texture_cube_fmt_16_16_unorm"
+	"addr_ro_texture_cube_fmt_16_16_snorm"
+	"addr_ro_texture_cube_fmt_16_16_uint"
+	"addr_ro_texture_cube_fmt_16_16_sint"
+	"addr_ro_texture_cube_fmt_16_float"
+	"addr_ro_texture_cube_fmt_16_unorm"
+	"addr_ro_texture_cube_fmt_16_snorm"
+	"addr_ro_texture_cube_fmt_16_uint"
+	"addr_ro_texture_cube_fmt_16_sint"
+	"addr_ro_texture_cube_fmt_32_32_32_32_float"
+	"addr_ro_texture_cube_fmt_32_32_32_32_uint"
+	"addr_ro_texture_cube_fmt_32_32_32_32_sint"
+	"addr_ro_texture_cube_fmt_32_32_float"
+	"addr_ro_texture_cube_fmt_32_32_uint"
+	"addr_ro_texture_cube_fmt_32_32_sint"
+	"addr_ro_texture_cube_fmt_32_float"
+	"addr_ro_texture_cube_fmt_32_uint"
+	"addr_ro_texture_cube_fmt_32_sint"
+	"addr_ro_texture_cube_fmt_64_uint"
+	"addr_ro_texture_cube_fmt_64_sint"
+	"addr_ro_texture_cube_fmt_11_11_10_float"
+	"addr_ro_texture_cube_fmt_10_10_10_2_unorm"
+	"addr_ro_texture_cube_fmt_10_10_10_2_uint"
+	"addr_ro_texture_cube_array_fmt_8_8_8_8_unorm"
+	"addr_ro_texture_cube_array_fmt_8_8_8_8_snorm"
+	"addr_ro_texture_cube_array_fmt_8_8_8_8_uint"
+	"addr_ro_texture_cube_array_fmt_8_8_8_8_sint"
+	"addr_ro_texture_cube_array_fmt_8_8_unorm"
+	"addr_ro_texture_cube_array_fmt_8_8_snorm"
+	"addr_ro_texture_cube_array_fmt_8_8_uint"
+	"addr_ro_texture_cube_array_fmt_8_8_sint"
+	"addr_ro_texture_cube_array_fmt_8_unorm"
+	"addr_ro_texture_cube_array_fmt_8_snorm"
+	"addr_ro_texture_cube_array_fmt_8_uint"
+	"addr_ro_texture_cube_array_fmt_8_sint"
+	"addr_ro_texture_cube_array_fmt_16_16_16_16_float"
+	"addr_ro_texture_cube_array_fmt_16_16_16_16_unorm"
+	"addr_ro_texture_cube_array_fmt_16_16_16_16_snorm"
+	"addr_ro_texture_cube_array_fmt_16_16_16_16_uint"
+	"addr_ro_texture_cube_array_fmt_16_16_16_16_sint"
+	"addr_ro_texture_cube_array_fmt_16_16_float"
+	"addr_ro_texture_cube_array_fmt_16_16_unorm"
+	"addr_ro_texture_cube_array_fmt_16_16_snorm"
+	"addr_ro_texture_cube_array_fmt_16_16_uint"
+	"addr_ro_texture_cube_array_fmt_16_16_sint"
+	"addr_ro_texture_cube_array_fmt_16_float"
+	"addr_ro_texture_cube_array_fmt_16_unorm"
+	"addr_ro_texture_cube_array_fmt_16_snorm"
+	"addr_ro_texture_cube_array_fmt_16_uint"
+	"addr_ro_texture_cube_array_fmt_16_sint"
+	"addr_ro_texture_cube_array_fmt_32_32_32_32_float",
+	"addr_ro_texture_cube_array_fmt_32_32_32_32_uint"
+	"addr_ro_texture_cube_array_fmt_32_32_32_32_sint"
+	"addr_ro_texture_cube_array_fmt_32_32_float"
+	"addr_ro_texture_cube_array_fmt_32_32_uint"
+	"addr_ro_texture_cube_array_fmt_32_32_sint"
+	"addr_ro_texture_cube_array_fmt_32_float"
+	"addr_ro_texture_cube_array_fmt_32_uint"
+	"addr_ro_texture_cube_array_fmt_32_sint"
+	"addr_ro_texture_cube_array_fmt_64_uint"
+	"addr_ro_texture_cube_array_fmt_64_sint"
+	"addr_ro_texture_cube_array_fmt_11_11_10_float"
+	"addr_ro_texture_cube_array_fmt_10_10_10_2_unorm"
+	"addr_ro_texture_cube_array_fmt_10_10_10_2_uint"
+	"addr_ro_texture_cube_ms_fmt_8_8_8_8_unorm"
+	"addr_ro_texture_cube_ms_fmt_8_8_8_8_snorm"
+	"addr_ro_texture_cube_ms_fmt_8_8_8_8_uint"
+	"addr_ro_texture_cube_ms_fmt_8_8_8_8_sint"
+	"addr_ro_texture_cube_ms_fmt_8_8_unorm"
+	"addr_ro_texture_cube_ms_fmt_8_8_snorm"
+	"addr_ro_texture_cube_ms_fmt_8_8_uint"
+	"addr_ro_texture_cube_ms_fmt_8_8_sint"
+	"addr_ro_texture_cube_ms_fmt_8_unorm"
+	"addr_ro_texture_cube_ms_fmt_8_snorm"
+	"addr_ro_texture_cube_ms_fmt_8_uint"
+	"addr_ro_texture_cube_ms_fmt_8_sint"
+	"addr_ro_texture_cube_ms_fmt_16_16_16_16_float"
+	"addr_ro_texture_cube_ms_fmt_16_16_16_16_unorm"
+	"addr_ro_texture_cube_ms_fmt_16_16_16_16_snorm"
+	"addr_ro_texture_cube_ms_fmt_16_16_16_16_uint"
+	"addr_ro_texture_cube_ms_fmt_16_16_16_16_sint"
+	"addr_ro_texture_cube_ms_fmt_16_16_float"
+	"addr_ro_texture_cube_ms_fmt_16_16_unorm"
+	"addr_ro_texture_cube_ms_fmt_16_16_snorm"
+	"addr_ro_texture_cube_ms_fmt_16_16_uint"
+	"addr_ro_texture_cube_ms_fmt_16_16_sint"
+	"addr_ro_texture_cube_ms_fmt_16_float"
+	"addr_ro_texture_cube_ms_fmt_16_unorm"
+	"addr_ro_texture_cube_ms_fmt_16_snorm"
+	"addr_ro_texture_cube_ms_fmt_16_uint"
+	"addr_ro_texture_cube_ms_fmt_16_sint"
+	"addr_ro_texture_cube_ms_fmt_32_32_32_32_float"
+	"addr_ro_texture_cube_ms_fmt_32_32_32_32_uint"
+	"addr_ro_texture_cube_ms_fmt_32_32_32_32_sint"
+	"addr_ro_texture_cube_ms_fmt_32_32_float"
+	"addr_ro_texture_cube_ms_fmt_32_32_uint"
+	"addr_ro_texture_cube_ms_fmt_32_32_sint"
+	"addr_ro_texture_cube_ms_fmt_32_float"
+	"addr_ro_texture_cube_ms_fmt_32_uint"
+	"addr_ro_texture_cube_ms_fmt_32_sint"
+	"addr_ro_texture_cube_ms_fmt_64_uint"
+	"addr_ro_texture_cube_ms_fmt_64_sint"
+	"addr_ro_texture_cube_ms_fmt_11_11_10_float"
+	"addr_ro_texture_cube_ms_fmt_10_10_10_2_unorm"
+	"addr_ro_texture_cube_ms_fmt_10_10_10_2_uint"
+	"addr_ro_texture_cube_ms_array_fmt_8_8_8_8_unorm"
+	"addr_ro_texture_cube_ms_array_fmt_8_8_8_8_snorm"
+	"addr_ro_texture_cube_ms_array_fmt_8_8_8_8_uint"
+	"addr_ro_texture_cube_ms_array_fmt_8_8_8_8_sint"
+	"addr_ro_texture_cube_ms_array_fmt_8_8_unorm"
+	"addr_ro_texture_cube_ms_array_fmt_8_8_snorm"
+	"addr_ro_texture_cube_ms_array_fmt_8_8_uint"
+	"addr_ro_texture_cube_ms_array_fmt_8_8_sint"
+	"addr_ro_texture_cube_ms_array_fmt_8_unorm"
+	"addr_ro_texture_cube_ms_array_fmt_8_snorm"
+	"addr_ro_texture_cube_ms_array_fmt_8_uint"
+	"addr_ro_texture_cube_ms_array_fmt_8_sint"
+	"addr_ro_texture_cube_ms_array_fmt_16_16_16_16_float"
+	"addr_ro_texture_cube_ms_array_fmt_16_16_16_16_unorm"
+	"addr_ro_texture_cube_ms_array_fmt_16_16_16_16_snorm"
+	"addr_ro_texture_cube_ms_array_fmt_16_16_16_16_uint"
+	"addr_ro_texture_cube_ms_array_fmt_16_16_16_16_sint"
+	"addr_ro_texture_cube_ms_array_fmt_16_16_float"
+	"addr_ro_texture_cube_ms_array_fmt_16_16_unorm"
+	"addr_ro_texture_cube_ms_array_fmt_16_16_snorm"
+	"addr_ro_texture_cube_ms_array_fmt_16_16_uint"
+	"addr_ro_texture_cube_ms_array_fmt_16_16_sint"
+	"addr_ro_texture_cube_ms_array_fmt_16_float"
+	"addr_ro_texture_cube_ms_array_fmt_16_unorm"
+	"addr_ro_texture_cube_ms_array_fmt_16_snorm"
+	"addr_ro_texture_cube_ms_array_fmt_16_uint"
+	"addr_ro_texture_cube_ms_array_fmt_16_sint"
+	"addr_ro_texture_cube_ms_array_fmt_32_32_32_32_float"
+	"addr_ro_texture_cube_ms_array_fmt_32_32_32_32_uint"
+	"addr_ro_texture_cube_ms_array_fmt_32_32_32_32_sint"
+	"addr_ro_texture_cube_ms_array_fmt_32_32_float"
+	"addr_ro_texture_cube_ms_array_fmt_32_32_uint"
+	"addr_ro_texture_cube_ms_array_fmt_32_32_sint"
+	"addr_ro_texture_cube_ms_array_fmt_32_float"
+	"addr_ro_texture_cube_ms_array_fmt_32_uint"
+	"addr_ro_texture_cube_ms_array_fmt_32_sint"
+	"addr_ro_texture_cube_ms_array_fmt_64_uint"
+	"addr_ro_texture_cube_ms_array_fmt_64_sint"
+	"addr_ro_texture_cube_ms_array_fmt_11_11_10_float"
+	"addr_ro_texture_cube_ms_array_fmt_10_10_10_2_unorm"
+	"addr_ro_texture_cube_ms_array_fmt_10_10_10_2_uint"
+	"addr_rw_texture_1d_fmt_8_8_8_8_unorm"
+	"addr_rw_texture_1d_fmt_8_8_8_8_snorm"
+	"addr_rw_texture_1d_fmt_8_8_8_8_uint",
+	"addr_rw_texture_1d_fmt_8_8_8_8_sint"
+	"addr_rw_texture_1d_fmt_8_8_unorm"
+	"addr_rw_texture_1d_fmt_8_8_snorm"
+	"addr_rw_texture_1d_fmt_8_8_uint"
+	"addr_rw_texture_1d_fmt_8_8_sint"
+	"addr_rw_texture_1d_fmt_8_unorm"
+	"addr_rw_texture_1d_fmt_8_snorm"
+	"addr_rw_texture_1d_fmt_8_uint"
+	"addr_rw_texture_1d_fmt_8_sint"
+	"addr_rw_texture_1d_fmt_16_16_16_16_float"
+	"addr_rw_texture_1d_fmt_16_16_16_16_unorm"
+	"addr_rw_texture_1d_fmt_16_16_16_16_snorm"
+	"addr_rw_texture_1d_fmt_16_16_16_16_uint"
+	"addr_rw_texture_1d_fmt_16_16_16_16_sint"
+	"addr_rw_texture_1d_fmt_16_16_float"
+	"addr_rw_texture_1d_fmt_16_16_unorm"
+	"addr_rw_texture_1d_fmt_16_16_snorm"
+	"addr_rw_texture_1d_fmt_16_16_uint"
+	"addr_rw_texture_1d_fmt_16_16_sint"
+	"addr_rw_texture_1d_fmt_16_float"
+	"addr_rw_texture_1d_fmt_16_unorm"
+	"addr_rw_texture_1d_fmt_16_snorm"
+	"addr_rw_texture_1d_fmt_16_uint"
+	"addr_rw_texture_1d_fmt_16_sint"
+	"addr_rw_texture_1d_fmt_32_32_32_32_float"
+	"addr_rw_texture_1d_fmt_32_32_32_32_uint"
+	"addr_rw_texture_1d_fmt_32_32_32_32_sint"
+	"addr_rw_texture_1d_fmt_32_32_float"
+	"addr_rw_texture_1d_fmt_32_32_uint"
+	"addr_rw_texture_1d_fmt_32_32_sint"
+	"addr_rw_texture_1d_fmt_32_float"
+	"addr_rw_texture_1d_fmt_32_uint"
+	"addr_rw_texture_1d_fmt_32_sint"
+	"addr_rw_texture_1d_fmt_64_uint"
+	"addr_rw_texture_1d_fmt_64_sint"
+	"addr_rw_texture_1d_fmt_11_11_10_float"
+	"addr_rw_texture_1d_fmt_10_10_10_2_unorm"
+	"addr_rw_texture_1d_fmt_10_10_10_2_uint"
+	"addr_rw_texture_1d_array_fmt_8_8_8_8_unorm"
+	"addr_rw_texture_1d_array_fmt_8_8_8_8_snorm"
+	"addr_rw_texture_1d_array_fmt_8_8_8_8_uint"
+	"addr_rw_texture_1d_array_fmt_8_8_8_8_sint"
+	"addr_rw_texture_1d_array_fmt_8_8_unorm"
+	"addr_rw_texture_1d_array_fmt_8_8_snorm"
+	"addr_rw_texture_1d_array_fmt_8_8_uint"
+	"addr_rw_texture_1d_array_fmt_8_8_sint"
+	"addr_rw_texture_1d_array_fmt_8_unorm"
+	"addr_rw_texture_1d_array_fmt_8_snorm"
+	"addr_rw_texture_1d_array_fmt_8_uint"
+	"addr_rw_texture_1d_array_fmt_8_sint"
+	"addr_rw_texture_1d_array_fmt_16_16_16_16_float"
+	"addr_rw_texture_1d_array_fmt_16_16_16_16_unorm"
+	"addr_rw_texture_1d_array_fmt_16_16_16_16_snorm"
+	"addr_rw_texture_1d_array_fmt_16_16_16_16_uint"
+	"addr_rw_texture_1d_array_fmt_16_16_16_16_sint"
+	"addr_rw_texture_1d_array_fmt_16_16_float"
+	"addr_rw_texture_1d_array_fmt_16_16_unorm"
+	"addr_rw_texture_1d_array_fmt_16_16_snorm"
+	"addr_rw_texture_1d_array_fmt_16_16_uint"
+	"addr_rw_texture_1d_array_fmt_16_16_sint"
+	"addr_rw_texture_1d_array_fmt_16_float"
+	"addr_rw_texture_1d_array_fmt_16_unorm"
+	"addr_rw_texture_1d_array_fmt_16_snorm"
+	"addr_rw_texture_1d_array_fmt_16_uint"
+	"addr_rw_texture_1d_array_fmt_16_sint"
+	"addr_rw_texture_1d_array_fmt_32_32_32_32_float"
+	"addr_rw_texture_1d_array_fmt_32_32_32_32_uint"
+	"addr_rw_texture_1d_array_fmt_32_32_32_32_sint"
+	"addr_rw_texture_1d_array_fmt_32_32_float"
+	"addr_rw_texture_1d_array_fmt_32_32_uint"
+	"addr_rw_texture_1d_array_fmt_32_32_sint"
+	"addr_rw_texture_1d_array_fmt_32_float"
+	"addr_rw_texture_1d_array_fmt_32_uint"
+	"addr_rw_texture_1d_array_fmt_32_sint"
+	"addr_rw_texture_1d_array_fmt_64_uint"
+	"addr_rw_texture_1d_array_fmt_64_sint"
+	"addr_rw_texture_1d_array_fmt_11_11_10_float"
+	"addr_rw_texture_1d_array_fmt_10_10_10_2_unorm"
+	"addr_rw_texture_1d_array_fmt_10_10_10_2_uint"
+	"addr_rw_texture_1d_ms_fmt_8_8_8_8_unorm"
+	"addr_rw_texture_1d_ms_fmt_8_8_8_8_snorm"
+	"addr_rw_texture_1d_ms_fmt_8_8_8_8_uint"
+	"addr_rw_texture_1d_ms_fmt_8_8_8_8_sint"
+	"addr_rw_texture_1d_ms_fmt_8_8_unorm"
+	"addr_rw_texture_1d_ms_fmt_8_8_snorm"
+	"addr_rw_texture_1d_ms_fmt_8_8_uint"
+	"addr_rw_texture_1d_ms_fmt_8_8_sint"
+	"addr_rw_texture_1d_ms_fmt_8_unorm"
+	"addr_rw_texture_1d_ms_fmt_8_snorm"
+	"addr_rw_texture_1d_ms_fmt_8_uint"
+	"addr_rw_texture_1d_ms_fmt_8_sint"
+	"addr_rw_texture_1d_ms_fmt_16_16_16_16_float"
+	"addr_rw_texture_1d_ms_fmt_16_16_16_16_unorm"
+	"addr_rw_texture_1d_ms_fmt_16_16_16_16_snorm"
+	"addr_rw_texture_1d_ms_fmt_16_16_16_16_uint"
+	"addr_rw_texture_1d_ms_fmt_16_16_16_16_sint"
+	"addr_rw_texture_1d_ms_fmt_16_16_float"
+	"addr_rw_texture_1d_ms_fmt_16_16_unorm"
+	"addr_rw_texture_1d_ms_fmt_16_16_snorm"
+	"addr_rw_texture_1d_ms_fmt_16_16_uint"
+	"addr_rw_texture_1d_ms_fmt_16_16_sint"
+	"addr_rw_texture_1d_ms_fmt_16_float"
+	"addr_rw_texture_1d_ms_fmt_16_unorm"
+	"addr_rw_texture_1d_ms_fmt_16_snorm"
+	"addr_rw_texture_1d_ms_fmt_16_uint"
+	"addr_rw_texture_1d_ms_fmt_16_sint"
+	"addr_rw_texture_1d_ms_fmt_32_32_32_32_float"
+	"addr_rw_texture_1d_ms_fmt_32_32_32_32_uint"
+	"addr_rw_texture_1d_ms_fmt_32_32_32_32_sint"
+	"addr_rw_texture_1d_ms_fmt_32_32_float",
+	"addr_rw_texture_1d_ms_fmt_32_32_uint"
+	"addr_rw_texture_1d_ms_fmt_32_32_sint"
+	"addr_rw_texture_1d_ms_fmt_32_float"
+	"addr_rw_texture_1d_ms_fmt_32_uint"
+	"addr_rw_texture_1d_ms_fmt_32_sint"
+	"addr_rw_texture_1d_ms_fmt_64_uint"
+	"addr_rw_texture_1d_ms_fmt_64_sint"
+	"addr_rw_texture_1d_ms_fmt_11_11_10_float"
+	"addr_rw_texture_1d_ms_fmt_10_10_10_2_unorm"
+	"addr_rw_texture_1d_ms_fmt_10_10_10_2_uint"
+	"addr_rw_texture_1d_ms_array_fmt_8_8_8_8_unorm"
+	"addr_rw_texture_1d_ms_array_fmt_8_8_8_8_snorm"
+	"addr_rw_texture_1d_ms_array_fmt_8_8_8_8_uint"
+	"addr_rw_texture_1d_ms_array_fmt_8_8_8_8_sint"
+	"addr_rw_texture_1d_ms_array_fmt_8_8_unorm"
+	"addr_rw_texture_1d_ms_array_fmt_8_8_snorm"
+	"addr_rw_texture_1d_ms_array_fmt_8_8_uint"
+	"addr_rw_texture_1d_ms_array_fmt_8_8_sint"
+	"addr_rw_texture_1d_ms_array_fmt_8_unorm"
+	"addr_rw_texture_1d_ms_array_fmt_8_snorm"
+	"addr_rw_texture_1d_ms_array_fmt_8_uint"
+	"addr_rw_texture_1d_ms_array_fmt_8_sint"
+	"addr_rw_texture_1d_ms_array_fmt_16_16_16_16_float"
+	"addr_rw_texture_1d_ms_array_fmt_16_16_16_16_unorm"
+	"addr_rw_texture_1d_ms_array_fmt_16_16_16_16_snorm"
+	"addr_rw_texture_1d_ms_array_fmt_16_16_16_16_uint"
+	"addr_rw_texture_1d_ms_array_fmt_16_16_16_16_sint"
+	"addr_rw_texture_1d_ms_array_fmt_16_16_float"
+	"addr_rw_texture_1d_ms_array_fmt_16_16_unorm"
+	"addr_rw_texture_1d_ms_array_fmt_16_16_snorm"
+	"addr_rw_texture_1d_ms_array_fmt_16_16_uint"
+	"addr_rw_texture_1d_ms_array_fmt_16_16_sint"
+	"addr_rw_texture_1d_ms_array_fmt_16_float"
+	"addr_rw_texture_1d_ms_array_fmt_16_unorm"
+	"addr_rw_texture_1d_ms_array_fmt_16_snorm"
+	"addr_rw_texture_1d_ms_array_fmt_16_uint"
+	"addr_rw_texture_1d_ms_array_fmt_16_sint"
+	"addr_rw_texture_1d_ms_array_fmt_32_32_32_32_float"
+	"addr_rw_texture_1d_ms_array_fmt_32_32_32_32_uint"
+	"addr_rw_texture_1d_ms_array_fmt_32_32_32_32_sint"
+	"addr_rw_texture_1d_ms_array_fmt_32_32_float"
+	"addr_rw_texture_1d_ms_array_fmt_32_32_uint"
+	"addr_rw_texture_1d_ms_array_fmt_32_32_sint"
+	"addr_rw_texture_1d_ms_array_fmt_32_float"
+	"addr_rw_texture_1d_ms_array_fmt_32_uint"
+	"addr_rw_texture_1d_ms_array_fmt_32_sint"
+	"addr_rw_texture_1d_ms_array_fmt_64_uint"
+	"addr_rw_texture_1d_ms_array_fmt_64_sint"
+	"addr_rw_texture_1d_ms_array_fmt_11_11_10_float"
+	"addr_rw_texture_1d_ms_array_fmt_10_10_10_2_unorm"
+	"addr_rw_texture_1d_ms_array_fmt_10_10_10_2_uint"
+	"addr_rw_texture_2d_fmt_8_8_8_8_unorm"
+	"addr_rw_texture_2d_fmt_8_8_8_8_snorm"
+	"addr_rw_texture_2d_fmt_8_8_8_8_uint"
+	"addr_rw_texture_2d_fmt_8_8_8_8_sint"
+	"addr_rw_texture_2d_fmt_8_8_unorm"
+	"addr_rw_texture_2d_fmt_8_8_snorm"
+	"addr_rw_texture_2d_fmt_8_8_uint"
+	"addr_rw_texture_2d_fmt_8_8_sint"
+	"addr_rw_texture_2d_fmt_8_unorm"
+	"addr_rw_texture_2d_fmt_8_snorm"
+	"addr_rw_texture_2d_fmt_8_uint"
+	"addr_rw_texture_2d_fmt_8_sint"
+	"addr_rw_texture_2d_fmt_16_16_16_16_float"
+	"addr_rw_texture_2d_fmt_16_16_16_16_unorm"
+	"addr_rw_texture_2d_fmt_16_16_16_16_snorm"
+	"addr_rw_texture_2d_fmt_16_16_16_16_uint"
+	"addr_rw_texture_2d_fmt_16_16_16_16_sint"
+	"addr_rw_texture_2d_fmt_16_16_float"
+	"addr_rw_texture_2d_fmt_16_16_unorm"
+	"addr_rw_texture_2d_fmt_16_16_snorm"
+	"addr_rw_texture_2d_fmt_16_16_uint"
+	"addr_rw_texture_2d_fmt_16_16_sint"
+	"addr_rw_texture_2d_fmt_16_float"
+	"addr_rw_texture_2d_fmt_16_unorm"
+	"addr_rw_texture_2d_fmt_16_snorm"
+	"addr_rw_texture_2d_fmt_16_uint"
+	"addr_rw_texture_2d_fmt_16_sint"
+	"addr_rw_texture_2d_fmt_32_32_32_32_float"
+	"addr_rw_texture_2d_fmt_32_32_32_32_uint"
+	"addr_rw_texture_2d_fmt_32_32_32_32_sint"
+	"addr_rw_texture_2d_fmt_32_32_float"
+	"addr_rw_texture_2d_fmt_32_32_uint"
+	"addr_rw_texture_2d_fmt_32_32_sint"
+	"addr_rw_texture_2d_fmt_32_float"
+	"addr_rw_texture_2d_fmt_32_uint"
+	"addr_rw_texture_2d_fmt_32_sint"
+	"addr_rw_texture_2d_fmt_64_uint"
+	"addr_rw_texture_2d_fmt_64_sint"
+	"addr_rw_texture_2d_fmt_11_11_10_float"
+	"addr_rw_texture_2d_fmt_10_10_10_2_unorm"
+	"addr_rw_texture_2d_fmt_10_10_10_2_uint"
+	"addr_rw_texture_2d_array_fmt_8_8_8_8_unorm"
+	"addr_rw_texture_2d_array_fmt_8_8_8_8_snorm"
+	"addr_rw_texture_2d_array_fmt_8_8_8_8_uint"
+	"addr_rw_texture_2d_array_fmt_8_8_8_8_sint"
+	"addr_rw_texture_2d_array_fmt_8_8_unorm"
+	"addr_rw_texture_2d_array_fmt_8_8_snorm"
+	"addr_rw_texture_2d_array_fmt_8_8_uint"
+	"addr_rw_texture_2d_array_fmt_8_8_sint"
+	"addr_rw_texture_2d_array_fmt_8_unorm"
+	"addr_rw_texture_2d_array_fmt_8_snorm"
+	"addr_rw_texture_2d_array_fmt_8_uint"
+	"addr_rw_texture_2d_array_fmt_8_sint"
+	"addr_rw_texture_2d_array_fmt_16_16_16_16_float"
+	"addr_rw_texture_2d_array_fmt_16_16_16_16_unorm",
+	"addr_rw_texture_2d_array_fmt_16_16_16_16_snorm"
+	"addr_rw_texture_2d_array_fmt_16_16_16_16_uint"
+	"addr_rw_texture_2d_array_fmt_16_16_16_16_sint"
+	"addr_rw_texture_2d_array_fmt_16_16_float"
+	"addr_rw_texture_2d_array_fmt_16_16_unorm"
+	"addr_rw_texture_2d_array_fmt_16_16_snorm"
+	"addr_rw_texture_2d_array_fmt_16_16_uint"
+	"addr_rw_texture_2d_array_fmt_16_16_sint"
+	"addr_rw_texture_2d_array_fmt_16_float"
+	"addr_rw_texture_2d_array_fmt_16_unorm"
+	"addr_rw_texture_2d_array_fmt_16_snorm"
+	"addr_rw_texture_2d_array_fmt_16_uint"
+	"addr_rw_texture_2d_array_fmt_16_sint"
+	"addr_rw_texture_2d_array_fmt_32_32_32_32_float"
+	"addr_rw_texture_2d_array_fmt_32_32_32_32_uint"
+	"addr_rw_texture_2d_array_fmt_32_32_32_32_sint"
+	"addr_rw_texture_2d_array_fmt_32_32_float"
+	"addr_rw_texture_2d_array_fmt_32_32_uint"
+	"addr_rw_texture_2d_array_fmt_32_32_sint"
+	"addr_rw_texture_2d_array_fmt_32_float"
+	"addr_rw_texture_2d_array_fmt_32_uint"
+	"addr_rw_texture_2d_array_fmt_32_sint"
+	"addr_rw_texture_2d_array_fmt_64_uint"
+	"addr_rw_texture_2d_array_fmt_64_sint"
+	"addr_rw_texture_2d_array_fmt_11_11_10_float"
+	"addr_rw_texture_2d_array_fmt_10_10_10_2_unorm"
+	"addr_rw_texture_2d_array_fmt_10_10_10_2_uint"
+	"addr_rw_texture_2d_ms_fmt_8_8_8_8_unorm"
+	"addr_rw_texture_2d_ms_fmt_8_8_8_8_snorm"
+	"addr_rw_texture_2d_ms_fmt_8_8_8_8_uint"
+	"addr_rw_texture_2d_ms_fmt_8_8_8_8_sint"
+	"addr_rw_texture_2d_ms_fmt_8_8_unorm"
+	"addr_rw_texture_2d_ms_fmt_8_8_snorm"
+	"addr_rw_texture_2d_ms_fmt_8_8_uint"
+	"addr_rw_texture_2d_ms_fmt_8_8_sint"
+	"addr_rw_texture_2d_ms_fmt_8_unorm"
+	"addr_rw_texture_2d_ms_fmt_8_snorm"
+	"addr_rw_texture_2d_ms_fmt_8_uint"
+	"addr_rw_texture_2d_ms_fmt_8_sint"
+	"addr_rw_texture_2d_ms_fmt_16_16_16_16_float"
+	"addr_rw_texture_2d_ms_fmt_16_16_16_16_unorm"
+	"addr_rw_texture_2d_ms_fmt_16_16_16_16_snorm"
+	"addr_rw_texture_2d_ms_fmt_16_16_16_16_uint"
+	"addr_rw_texture_2d_ms_fmt_16_16_16_16_sint"
+	"addr_rw_texture_2d_ms_fmt_16_16_float"
+	"addr_rw_texture_2d_ms_fmt_16_16_unorm"
+	"addr_rw_texture_2d_ms_fmt_16_16_snorm"
+	"addr_rw_texture_2d_ms_fmt_16_16_uint"
+	"addr_rw_texture_2d_ms_fmt_16_16_sint"
+	"addr_rw_texture_2d_ms_fmt_16_float"
+	"addr_rw_texture_2d_ms_fmt_16_unorm"
+	"addr_rw_texture_2d_ms_fmt_16_snorm"
+	"addr_rw_texture_2d_ms_fmt_16_uint"
+	"addr_rw_texture_2d_ms_fmt_16_sint"
+	"addr_rw_texture_2d_ms_fmt_32_32_32_32_float"
+	"addr_rw_texture_2d_ms_fmt_32_32_32_32_uint"
+	"addr_rw_texture_2d_ms_fmt_32_32_32_32_sint"
+	"addr_rw_texture_2d_ms_fmt_32_32_float"
+	"addr_rw_texture_2d_ms_fmt_32_32_uint"
+	"addr_rw_texture_2d_ms_fmt_32_32_sint"
+	"addr_rw_texture_2d_ms_fmt_32_float"
+	"addr_rw_texture_2d_ms_fmt_32_uint"
+	"addr_rw_texture_2d_ms_fmt_32_sint"
+	"addr_rw_texture_2d_ms_fmt_64_uint"
+	"addr_rw_texture_2d_ms_fmt_64_sint"
+	"addr_rw_texture_2d_ms_fmt_11_11_10_float"
+	"addr_rw_texture_2d_ms_fmt_10_10_10_2_unorm"
+	"addr_rw_texture_2d_ms_fmt_10_10_10_2_uint"
+	"addr_rw_texture_2d_ms_array_fmt_8_8_8_8_unorm"
+	"addr_rw_texture_2d_ms_array_fmt_8_8_8_8_snorm"
+	"addr_rw_texture_2d_ms_array_fmt_8_8_8_8_uint"
+	"addr_rw_texture_2d_ms_array_fmt_8_8_8_8_sint"
+	"addr_rw_texture_2d_ms_array_fmt_8_8_unorm"
+	"addr_rw_texture_2d_ms_array_fmt_8_8_snorm"
+	"addr_rw_texture_2d_ms_array_fmt_8_8_uint"
+	"addr_rw_texture_2d_ms_array_fmt_8_8_sint"
+	"addr_rw_texture_2d_ms_array_fmt_8_unorm"
+	"addr_rw_texture_2d_ms_array_fmt_8_snorm"
+	"addr_rw_texture_2d_ms_array_fmt_8_uint"
+	"addr_rw_texture_2d_ms_array_fmt_8_sint"
+	"addr_rw_texture_2d_ms_array_fmt_16_16_16_16_float"
+	"addr_rw_texture_2d_ms_array_fmt_16_16_16_16_unorm"
+	"addr_rw_texture_2d_ms_array_fmt_16_16_16_16_snorm"
+	"addr_rw_texture_2d_ms_array_fmt_16_16_16_16_uint"
+	"addr_rw_texture_2d_ms_array_fmt_16_16_16_16_sint"
+	"addr_rw_texture_2d_ms_array_fmt_16_16_float"
+	"addr_rw_texture_2d_ms_array_fmt_16_16_unorm"
+	"addr_rw_texture_2d_ms_array_fmt_16_16_snorm"
+	"addr_rw_texture_2d_ms_array_fmt_16_16_uint"
+	"addr_rw_texture_2d_ms_array_fmt_16_16_sint"
+	"addr_rw_texture_2d_ms_array_fmt_16_float"
+	"addr_rw_texture_2d_ms_array_fmt_16_unorm"
+	"addr_rw_texture_2d_ms_array_fmt_16_snorm"
+	"addr_rw_texture_2d_ms_array_fmt_16_uint"
+	"addr_rw_texture_2d_ms_array_fmt_16_sint"
+	"addr_rw_texture_2d_ms_array_fmt_32_32_32_32_float"
+	"addr_rw_texture_2d_ms_array_fmt_32_32_32_32_uint"
+	"addr_rw_texture_2d_ms_array_fmt_32_32_32_32_sint"
+	"addr_rw_texture_2d_ms_array_fmt_32_32_float"
+	"addr_rw_texture_2d_ms_array_fmt_32_32_uint"
+	"addr_rw_texture_2d_ms_array_fmt_32_32_sint"
+	"addr_rw_texture_2d_ms_array_fmt_32_float"
+	"addr_rw_texture_2d_ms_array_fmt_32_uint",
+	"addr_rw_texture_2d_ms_array_fmt_32_sint"
+	"addr_rw_texture_2d_ms_array_fmt_64_uint"
+	"addr_rw_texture_2d_ms_array_fmt_64_sint"
+	"addr_rw_texture_2d_ms_array_fmt_11_11_10_float"
+	"addr_rw_texture_2d_ms_array_fmt_10_10_10_2_unorm"
+	"addr_rw_texture_2d_ms_array_fmt_10_10_10_2_uint"
+	"addr_rw_texture_3d_fmt_8_8_8_8_unorm"
+	"addr_rw_texture_3d_fmt_8_8_8_8_snorm"
+	"addr_rw_texture_3d_fmt_8_8_8_8_uint"
+	"addr_rw_texture_3d_fmt_8_8_8_8_sint"
+	"addr_rw_texture_3d_fmt_8_8_unorm"
+	"addr_rw_texture_3d_fmt_8_8_snorm"
+	"addr_rw_texture_3d_fmt_8_8_uint"
+	"addr_rw_texture_3d_fmt_8_8_sint"
+	"addr_rw_texture_3d_fmt_8_unorm"
+	"addr_rw_texture_3d_fmt_8_snorm"
+	"addr_rw_texture_3d_fmt_8_uint"
+	"addr_rw_texture_3d_fmt_8_sint"
+	"addr_rw_texture_3d_fmt_16_16_16_16_float"
+	"addr_rw_texture_3d_fmt_16_16_16_16_unorm"
+	"addr_rw_texture_3d_fmt_16_16_16_16_snorm"
+	"addr_rw_texture_3d_fmt_16_16_16_16_uint"
+	"addr_rw_texture_3d_fmt_16_16_16_16_sint"
+	"addr_rw_texture_3d_fmt_16_16_float"
+	"addr_rw_texture_3d_fmt_16_16_unorm"
+	"addr_rw_texture_3d_fmt_16_16_snorm"
+	"addr_rw_texture_3d_fmt_16_16_uint"
+	"addr_rw_texture_3d_fmt_16_16_sint"
+	"addr_rw_texture_3d_fmt_16_float"
+	"addr_rw_texture_3d_fmt_16_unorm"
+	"addr_rw_texture_3d_fmt_16_snorm"
+	"addr_rw_texture_3d_fmt_16_uint"
+	"addr_rw_texture_3d_fmt_16_sint"
+	"addr_rw_texture_3d_fmt_32_32_32_32_float"
+	"addr_rw_texture_3d_fmt_32_32_32_32_uint"
+	"addr_rw_texture_3d_fmt_32_32_32_32_sint"
+	"addr_rw_texture_3d_fmt_32_32_float"
+	"addr_rw_texture_3d_fmt_32_32_uint"
+	"addr_rw_texture_3d_fmt_32_32_sint"
+	"addr_rw_texture_3d_fmt_32_float"
+	"addr_rw_texture_3d_fmt_32_uint"
+	"addr_rw_texture_3d_fmt_32_sint"
+	"addr_rw_texture_3d_fmt_64_uint"
+	"addr_rw_texture_3d_fmt_64_sint"
+	"addr_rw_texture_3d_fmt_11_11_10_float"
+	"addr_rw_texture_3d_fmt_10_10_10_2_unorm"
+	"addr_rw_texture_3d_fmt_10_10_10_2_uint"
+	"addr_rw_texture_3d_array_fmt_8_8_8_8_unorm"
+	"addr_rw_texture_3d_array_fmt_8_8_8_8_snorm"
+	"addr_rw_texture_3d_array_fmt_8_8_8_8_uint"
+	"addr_rw_texture_3d_array_fmt_8_8_8_8_sint"
+	"addr_rw_texture_3d_array_fmt_8_8_unorm"
+	"addr_rw_texture_3d_array_fmt_8_8_snorm"
+	"addr_rw_texture_3d_array_fmt_8_8_uint"
+	"addr_rw_texture_3d_array_fmt_8_8_sint"
+	"addr_rw_texture_3d_array_fmt_8_unorm"
+	"addr_rw_texture_3d_array_fmt_8_snorm"
+	"addr_rw_texture_3d_array_fmt_8_uint"
+	"addr_rw_texture_3d_array_fmt_8_sint"
+	"addr_rw_texture_3d_array_fmt_16_16_16_16_float"
+	"addr_rw_texture_3d_array_fmt_16_16_16_16_unorm"
+	"addr_rw_texture_3d_array_fmt_16_16_16_16_snorm"
+	"addr_rw_texture_3d_array_fmt_16_16_16_16_uint"
+	"addr_rw_texture_3d_array_fmt_16_16_16_16_sint"
+	"addr_rw_texture_3d_array_fmt_16_16_float"
+	"addr_rw_texture_3d_array_fmt_16_16_unorm"
+	"addr_rw_texture_3d_array_fmt_16_16_snorm"
+	"addr_rw_texture_3d_array_fmt_16_16_uint"
+	"addr_rw_texture_3d_array_fmt_16_16_sint"
+	"addr_rw_texture_3d_array_fmt_16_float"
+	"addr_rw_texture_3d_array_fmt_16_unorm"
+	"addr_rw_texture_3d_array_fmt_16_snorm"
+	"addr_rw_texture_3d_array_fmt_16_uint"
+	"addr_rw_texture_3d_array_fmt_16_sint"
+	"addr_rw_texture_3d_array_fmt_32_32_32_32_float"
+	"addr_rw_texture_3d_array_fmt_32_32_32_32_uint"
+	"addr_rw_texture_3d_array_fmt_32_32_32_32_sint"
+	"addr_rw_texture_3d_array_fmt_32_32_float"
+	"addr_rw_texture_3d_array_fmt_32_32_uint"
+	"addr_rw_texture_3d_array_fmt_32_32_sint"
+	"addr_rw_texture_3d_array_fmt_32_float"
+	"addr_rw_texture_3d_array_fmt_32_uint"
+	"addr_rw_texture_3d_array_fmt_32_sint"
+	"addr_rw_texture_3d_array_fmt_64_uint"
+	"addr_rw_texture_3d_array_fmt_64_sint"
+	"addr_rw_texture_3d_array_fmt_11_11_10_float"
+	"addr_rw_texture_3d_array_fmt_10_10_10_2_unorm"
+	"addr_rw_texture_3d_array_fmt_10_10_10_2_uint"
+	"addr_rw_texture_3d_ms_fmt_8_8_8_8_unorm"
+	"addr_rw_texture_3d_ms_fmt_8_8_8_8_snorm"
+	"addr_rw_texture_3d_ms_fmt_8_8_8_8_uint"
+	"addr_rw_texture_3d_ms_fmt_8_8_8_8_sint"
+	"addr_rw_texture_3d_ms_fmt_8_8_unorm"
+	"addr_rw_texture_3d_ms_fmt_8_8_snorm"
+	"addr_rw_texture_3d_ms_fmt_8_8_uint"
+	"addr_rw_texture_3d_ms_fmt_8_8_sint"
+	"addr_rw_texture_3d_ms_fmt_8_unorm"
+	"addr_rw_texture_3d_ms_fmt_8_snorm"
+	"addr_rw_texture_3d_ms_fmt_8_uint"
+	"addr_rw_texture_3d_ms_fmt_8_sint"
+	"addr_rw_texture_3d_ms_fmt_16_16_16_16_float"
+	"addr_rw_texture_3d_ms_fmt_16_16_16_16_unorm"
+	"addr_rw_texture_3d_ms_fmt_16_16_16_16_snorm"
+	"addr_rw_texture_3d_ms_fmt_16_16_16_16_uint"
+	"addr_rw_texture_3d_ms_fmt_16_16_16_16_sint"
+	"addr_rw_texture_3d_ms_fmt_16_16_float"
+	"addr_rw_texture_3d_ms_fmt_16_16_unorm"
+	"addr_rw_texture_3d_ms_fmt_16_16_snorm"
+	"addr_rw_texture_3d_ms_fmt_16_16_uint",
+	"addr_rw_texture_3d_ms_fmt_16_16_sint"
+	"addr_rw_texture_3d_ms_fmt_16_float"
+	"addr_rw_texture_3d_ms_fmt_16_unorm"
+	"addr_rw_texture_3d_ms_fmt_16_snorm"
+	"addr_rw_texture_3d_ms_fmt_16_uint"
+	"addr_rw_texture_3d_ms_fmt_16_sint"
+	"addr_rw_texture_3d_ms_fmt_32_32_32_32_float"
+	"addr_rw_texture_3d_ms_fmt_32_32_32_32_uint"
+	"addr_rw_texture_3d_ms_fmt_32_32_32_32_sint"
+	"addr_rw_texture_3d_ms_fmt_32_32_float"
+	"addr_rw_texture_3d_ms_fmt_32_32_uint"
+	"addr_rw_texture_3d_ms_fmt_32_32_sint"
+	"addr_rw_texture_3d_ms_fmt_32_float"
+	"addr_rw_texture_3d_ms_fmt_32_uint"
+	"addr_rw_texture_3d_ms_fmt_32_sint"
+	"addr_rw_texture_3d_ms_fmt_64_uint"
+	"addr_rw_texture_3d_ms_fmt_64_sint"
+	"addr_rw_texture_3d_ms_fmt_11_11_10_float"
+	"addr_rw_texture_3d_ms_fmt_10_10_10_2_unorm"
+	"addr_rw_texture_3d_ms_fmt_10_10_10_2_uint"
+	"addr_rw_texture_3d_ms_array_fmt_8_8_8_8_unorm"
+	"addr_rw_texture_3d_ms_array_fmt_8_8_8_8_snorm"
+	"addr_rw_texture_3d_ms_array_fmt_8_8_8_8_uint"
+	"addr_rw_texture_3d_ms_array_fmt_8_8_8_8_sint"
+	"addr_rw_texture_3d_ms_array_fmt_8_8_unorm"
+	"addr_rw_texture_3d_ms_array_fmt_8_8_snorm"
+	"addr_rw_texture_3d_ms_array_fmt_8_8_uint"
+	"addr_rw_texture_3d_ms_array_fmt_8_8_sint"
+	"addr_rw_texture_3d_ms_array_fmt_8_unorm"
+	"addr_rw_texture_3d_ms_array_fmt_8_snorm"
+	"addr_rw_texture_3d_ms_array_fmt_8_uint"
+	"addr_rw_texture_3d_ms_array_fmt_8_sint"
+	"addr_rw_texture_3d_ms_array_fmt_16_16_16_16_float"
+	"addr_rw_texture_3d_ms_array_fmt_16_16_16_16_unorm"
+	"addr_rw_texture_3d_ms_array_fmt_16_16_16_16_snorm"
+	"addr_rw_texture_3d_ms_array_fmt_16_16_16_16_uint"
+	"addr_rw_texture_3d_ms_array_fmt_16_16_16_16_sint"
+	"addr_rw_texture_3d_ms_array_fmt_16_16_float"
+	"addr_rw_texture_3d_ms_array_fmt_16_16_unorm"
+	"addr_rw_texture_3d_ms_array_fmt_16_16_snorm"
+	"addr_rw_texture_3d_ms_array_fmt_16_16_uint"
+	"addr_rw_texture_3d_ms_array_fmt_16_16_sint"
+	"addr_rw_texture_3d_ms_array_fmt_16_float"
+	"addr_rw_texture_3d_ms_array_fmt_16_unorm"
+	"addr_rw_texture_3d_ms_array_fmt_16_snorm"
+	"addr_rw_texture_3d_ms_array_fmt_16_uint"
+	"addr_rw_texture_3d_ms_array_fmt_16_sint"
+	"addr_rw_texture_3d_ms_array_fmt_32_32_32_32_float"
+	"addr_rw_texture_3d_ms_array_fmt_32_32_32_32_uint"
+	"addr_rw_texture_3d_ms_array_fmt_32_32_32_32_sint"
+	"addr_rw_texture_3d_ms_array_fmt_32_32_float"
+	"addr_rw_texture_3d_ms_array_fmt_32_32_uint"
+	"addr_rw_texture_3d_ms_array_fmt_32_32_sint"
+	"addr_rw_texture_3d_ms_array_fmt_32_float"
+	"addr_rw_texture_3d_ms_array_fmt_32_uint"
+	"addr_rw_texture_3d_ms_array_fmt_32_sint"
+	"addr_rw_texture_3d_ms_array_fmt_64_uint"
+	"addr_rw_texture_3d_ms_array_fmt_64_sint"
+	"addr_rw_texture_3d_ms_array_fmt_11_11_10_float"
+	"addr_rw_texture_3d_ms_array_fmt_10_10_10_2_unorm"
+	"addr_rw_texture_3d_ms_array_fmt_10_10_10_2_uint"
+	"addr_rw_texture_cube_fmt_8_8_8_8_unorm"
+	"addr_rw_texture_cube_fmt_8_8_8_8_snorm"
+	"addr_rw_texture_cube_fmt_8_8_8_8_uint"
+	"addr_rw_texture_cube_fmt_8_8_8_8_sint"
+	"addr_rw_texture_cube_fmt_8_8_unorm"
+	"addr_rw_texture_cube_fmt_8_8_snorm"
+	"addr_rw_texture_cube_fmt_8_8_uint"
+	"addr_rw_texture_cube_fmt_8_8_sint"
+	"addr_rw_texture_cube_fmt_8_unorm"
+	"addr_rw_texture_cube_fmt_8_snorm"
+	"addr_rw_texture_cube_fmt_8_uint"
+	"addr_rw_texture_cube_fmt_8_sint"
+	"addr_rw_texture_cube_fmt_16_16_16_16_float"
+	"addr_rw_texture_cube_fmt_16_16_16_16_unorm"
+	"addr_rw_texture_cube_fmt_16_16_16_16_snorm"
+	"addr_rw_texture_cube_fmt_16_16_16_16_uint"
+	"addr_rw_texture_cube_fmt_16_16_16_16_sint"
+	"addr_rw_texture_cube_fmt_16_16_float"
+	"addr_rw_texture_cube_fmt_16_16_unorm"
+	"addr_rw_texture_cube_fmt_16_16_snorm"
+	"addr_rw_texture_cube_fmt_16_16_uint"
+	"addr_rw_texture_cube_fmt_16_16_sint"
+	"addr_rw_texture_cube_fmt_16_float"
+	"addr_rw_texture_cube_fmt_16_unorm"
+	"addr_rw_texture_cube_fmt_16_snorm"
+	"addr_rw_texture_cube_fmt_16_uint"
+	"addr_rw_texture_cube_fmt_16_sint"
+	"addr_rw_texture_cube_fmt_32_32_32_32_float"
+	"addr_rw_texture_cube_fmt_32_32_32_32_uint"
+	"addr_rw_texture_cube_fmt_32_32_32_32_sint"
+	"addr_rw_texture_cube_fmt_32_32_float"
+	"addr_rw_texture_cube_fmt_32_32_uint"
+	"addr_rw_texture_cube_fmt_32_32_sint"
+	"addr_rw_texture_cube_fmt_32_float"
+	"addr_rw_texture_cube_fmt_32_uint"
+	"addr_rw_texture_cube_fmt_32_sint"
+	"addr_rw_texture_cube_fmt_64_uint"
+	"addr_rw_texture_cube_fmt_64_sint"
+	"addr_rw_texture_cube_fmt_11_11_10_float"
+	"addr_rw_texture_cube_fmt_10_10_10_2_unorm"
+	"addr_rw_texture_cube_fmt_10_10_10_2_uint"
+	"addr_rw_texture_cube_array_fmt_8_8_8_8_unorm"
+	"addr_rw_texture_cube_array_fmt_8_8_8_8_snorm"
+	"addr_rw_texture_cube_array_fmt_8_8_8_8_uint",
+	"addr_rw_texture_cube_array_fmt_8_8_8_8_sint"
+	"addr_rw_texture_cube_array_fmt_8_8_unorm"
+	"addr_rw_texture_cube_array_fmt_8_8_snorm"
+	"addr_rw_texture_cube_array_fmt_8_8_uint"
+	"addr_rw_texture_cube_array_fmt_8_8_sint"
+	"addr_rw_texture_cube_array_fmt_8_unorm"
+	"addr_rw_texture_cube_array_fmt_8_snorm"
+	"addr_rw_texture_cube_array_fmt_8_uint"
+	"addr_rw_texture_cube_array_fmt_8_sint"
+	"addr_rw_texture_cube_array_fmt_16_16_16_16_float"
+	"addr_rw_texture_cube_array_fmt_16_16_16_16_unorm"
+	"addr_rw_texture_cube_array_fmt_16_16_16_16_snorm"
+	"addr_rw_texture_cube_array_fmt_16_16_16_16_uint"
+	"addr_rw_texture_cube_array_fmt_16_16_16_16_sint"
+	"addr_rw_texture_cube_array_fmt_16_16_float"
+	"addr_rw_texture_cube_array_fmt_16_16_unorm"
+	"addr_rw_texture_cube_array_fmt_16_16_snorm"
+	"addr_rw_texture_cube_array_fmt_16_16_uint"
+	"addr_rw_texture_cube_array_fmt_16_16_sint"
+	"addr_rw_texture_cube_array_fmt_16_float"
+	"addr_rw_texture_cube_array_fmt_16_unorm"
+	"addr_rw_texture_cube_array_fmt_16_snorm"
+	"addr_rw_texture_cube_array_fmt_16_uint"
+	"addr_rw_texture_cube_array_fmt_16_sint"
+	"addr_rw_texture_cube_array_fmt_32_32_32_32_float"
+	"addr_rw_texture_cube_array_fmt_32_32_32_32_uint"
+	"addr_rw_texture_cube_array_fmt_32_32_32_32_sint"
+	"addr_rw_texture_cube_array_fmt_32_32_float"
+	"addr_rw_texture_cube_array_fmt_32_32_uint"
+	"addr_rw_texture_cube_array_fmt_32_32_sint"
+	"addr_rw_texture_cube_array_fmt_32_float"
+	"addr_rw_texture_cube_array_fmt_32_uint"
+	"addr_rw_texture_cube_array_fmt_32_sint"
+	"addr_rw_texture_cube_array_fmt_64_uint"
+	"addr_rw_texture_cube_array_fmt_64_sint"
+	"addr_rw_texture_cube_array_fmt_11_11_10_float"
+	"addr_rw_texture_cube_array_fmt_10_10_10_2_unorm"
+	"addr_rw_texture_cube_array_fmt_10_10_10_2_uint"
+	"addr_rw_texture_cube_ms_fmt_8_8_8_8_unorm"
+	"addr_rw_texture_cube_ms_fmt_8_8_8_8_snorm"
+	"addr_rw_texture_cube_ms_fmt_8_8_8_8_uint"
+	"addr_rw_texture_cube_ms_fmt_8_8_8_8_sint"
+	"addr_rw_texture_cube_ms_fmt_8_8_unorm"
+	"addr_rw_texture_cube_ms_fmt_8_8_snorm"
+	"addr_rw_texture_cube_ms_fmt_8_8_uint"
+	"addr_rw_texture_cube_ms_fmt_8_8_sint"
+	"addr_rw_texture_cube_ms_fmt_8_unorm"
+	"addr_rw_texture_cube_ms_fmt_8_snorm"
+	"addr_rw_texture_cube_ms_fmt_8_uint"
+	"addr_rw_texture_cube_ms_fmt_8_sint"
+	"addr_rw_texture_cube_ms_fmt_16_16_16_16_float"
+	"addr_rw_texture_cube_ms_fmt_16_16_16_16_unorm"
+	"addr_rw_texture_cube_ms_fmt_16_16_16_16_snorm"
+	"addr_rw_texture_cube_ms_fmt_16_16_16_16_uint"
+	"addr_rw_texture_cube_ms_fmt_16_16_16_16_sint"
+	"addr_rw_texture_cube_ms_fmt_16_16_float"
+	"addr_rw_texture_cube_ms_fmt_16_16_unorm"
+	"addr_rw_texture_cube_ms_fmt_16_16_snorm"
+	"addr_rw_texture_cube_ms_fmt_16_16_uint"
+	"addr_rw_texture_cube_ms_fmt_16_16_sint"
+	"addr_rw_texture_cube_ms_fmt_16_float"
+	"addr_rw_texture_cube_ms_fmt_16_unorm"
+	"addr_rw_texture_cube_ms_fmt_16_snorm"
+	"addr_rw_texture_cube_ms_fmt_16_uint"
+	"addr_rw_texture_cube_ms_fmt_16_sint"
+	"addr_rw_texture_cube_ms_fmt_32_32_32_32_float"
+	"addr_rw_texture_cube_ms_fmt_32_32_32_32_uint"
+	"addr_rw_texture_cube_ms_fmt_32_32_32_32_sint"
+	"addr_rw_texture_cube_ms_fmt_32_32_float"
+	"addr_rw_texture_cube_ms_fmt_32_32_uint"
+	"addr_rw_texture_cube_ms_fmt_32_32_sint"
+	"addr_rw_texture_cube_ms_fmt_32_float"
+	"addr_rw_texture_cube_ms_fmt_32_uint"
+	"addr_rw_texture_cube_ms_fmt_32_sint"
+	"addr_rw_texture_cube_ms_fmt_64_uint"
+	"addr_rw_texture_cube_ms_fmt_64_sint"
+	"addr_rw_texture_cube_ms_fmt_11_11_10_float"
+	"addr_rw_texture_cube_ms_fmt_10_10_10_2_unorm"
+	"addr_rw_texture_cube_ms_fmt_10_10_10_2_uint"
+	"addr_rw_texture_cube_ms_array_fmt_8_8_8_8_unorm"
+	"addr_rw_texture_cube_ms_array_fmt_8_8_8_8_snorm"
+	"addr_rw_texture_cube_ms_array_fmt_8_8_8_8_uint"
+	"addr_rw_texture_cube_ms_array_fmt_8_8_8_8_sint"
+	"addr_rw_texture_cube_ms_array_fmt_8_8_unorm"
+	"addr_rw_texture_cube_ms_array_fmt_8_8_snorm"
+	"addr_rw_texture_cube_ms_array_fmt_8_8_uint"
+	"addr_rw_texture_cube_ms_array_fmt_8_8_sint"
+	"addr_rw_texture_cube_ms_array_fmt_8_unorm"
+	"addr_rw_texture_cube_ms_array_fmt_8_snorm"
+	"addr_rw_texture_cube_ms_array_fmt_8_uint"
+	"addr_rw_texture_cube_ms_array_fmt_8_sint"
+	"addr_rw_texture_cube_ms_array_fmt_16_16_16_16_float"
+	"addr_rw_texture_cube_ms_array_fmt_16_16_16_16_unorm"
+	"addr_rw_texture_cube_ms_array_fmt_16_16_16_16_snorm"
+	"addr_rw_texture_cube_ms_array_fmt_16_16_16_16_uint"
+	"addr_rw_texture_cube_ms_array_fmt_16_16_16_16_sint"
+	"addr_rw_texture_cube_ms_array_fmt_16_16_float"
+	"addr_rw_texture_cube_ms_array_fmt_16_16_unorm"
+	"addr_rw_texture_cube_ms_array_fmt_16_16_snorm",
+	"addr_rw_texture_cube_ms_array_fmt_16_16_uint"
+	"addr_rw_texture_cube_ms_array_fmt_16_16_sint"
+	"addr_rw_texture_cube_ms_array_fmt_16_float"
+	"addr_rw_texture_cube_ms_array_fmt_16_unorm"
+	"addr_rw_texture_cube_ms_array_fmt_16_snorm"
+	"addr_rw_texture_cube_ms_array_fmt_16_uint"
+	"addr_rw_texture_cube_ms_array_fmt_16_sint"
+	"addr_rw_texture_cube_ms_array_fmt_32_32_32_32_float"
+	"addr_rw_texture_cube_ms_array_fmt_32_32_32_32_uint"
+	"addr_rw_texture_cube_ms_array_fmt_32_32_32_32_sint"
+	"addr_rw_texture_cube_ms_array_fmt_32_32_float"
+	"addr_rw_texture_cube_ms_array_fmt_32_32_uint"
+	"addr_rw_texture_cube_ms_array_fmt_32_32_sint"
+	"addr_rw_texture_cube_ms_array_fmt_32_float"
+	"addr_rw_texture_cube_ms_array_fmt_32_uint"
+	"addr_rw_texture_cube_ms_array_fmt_32_sint"
+	"addr_rw_texture_cube_ms_array_fmt_64_uint"
+	"addr_rw_texture_cube_ms_array_fmt_64_sint"
+	"addr_rw_texture_cube_ms_array_fmt_11_11_10_float"
+	"addr_rw_texture_cube_ms_array_fmt_10_10_10_2_unorm"
+	"addr_rw_texture_cube_ms_array_fmt_10_10_10_2_uint"
+	"load_byte_buffer_f32"
+	"load_byte_buffer_s32"
+	"load_byte_buffer_u32"
+	"load_byte_buffer_f32x2"
+	"load_byte_buffer_s32x2"
+	"load_byte_buffer_u32x2"
+	"load_byte_buffer_f32x3"
+	"load_byte_buffer_s32x3"
+	"load_byte_buffer_u32x3"
+	"load_byte_buffer_f32x4"
+	"load_byte_buffer_s32x4"
+	"load_byte_buffer_u32x4"
+	"store_byte_buffer_f32"
+	"store_byte_buffer_s32"
+	"store_byte_buffer_u32"
+	"store_byte_buffer_f32x2"
+	"store_byte_buffer_s32x2"
+	"store_byte_buffer_u32x2"
+	"store_byte_buffer_f32x3"
+	"store_byte_buffer_s32x3"
+	"store_byte_buffer_u32x3"
+	"store_byte_buffer_f32x4"
+	"store_byte_buffer_s32x4"
+	"store_byte_buffer_u32x4"
+};
@@ -25,14 +25,14 @@ void hcc_spirv_init(HccCU* cu, HccCUSetup* setup) {
 		setup->dtt.compounds_grow_count +
 		setup->dtt.pointers_grow_count  +
 		setup->dtt.buffers_grow_count   ;
-	cu->spirv.type_table = hcc_hash_table_init(HccSPIRVTypeEntry, HCC_ALLOC_TAG_SPIRV_TYPE_TABLE, hcc_spirv_type_key_cmp, hcc_spirv_type_key_hash, types_reserve_cap);
-	cu->spirv.unique_type_table = hcc_hash_table_init(HccSPIRVUniqueTypeEntry, HCC_ALLOC_TAG_SPIRV_TYPE_TABLE, hcc_spirv_unique_type_key_cmp, hcc_spirv_unique_type_key_hash, types_reserve_cap);
+	cu->spirv.type_table = hcc_hash_table_init(HccSPIRVTypeEntry, HCC_ALLOC_TAG_SPIRV_TYPE_TABLE, hcc_spirv_type_key_cmp, hcc_spirv_type_key_hash, HCC_HASH_TABLE_INITIAL_CAP_FOR(types_reserve_cap));
+	cu->spirv.unique_type_table = hcc_hash_table_init(HccSPIRVUniqueTypeEntry, HCC_ALLOC_TAG_SPIRV_TYPE_TABLE, hcc_spirv_unique_type_key_cmp, hcc_spirv_unique_type_key_hash, HCC_HASH_TABLE_INITIAL_CAP_FOR(types_reserve_cap));
 	uint32_t decl_table_entries_cap            =
 		setup->functions_reserve_cap           +
 		setup->ast.global_variables_reserve_cap;
-	cu->spirv.decl_table = hcc_hash_table_init(HccSPIRVDeclEntry, HCC_ALLOC_TAG_SPIRV_DECL_TABLE, hcc_u32_key_cmp, hcc_u32_key_hash, decl_table_entries_cap);
-	cu->spirv.descriptor_binding_table = hcc_hash_table_init(HccSPIRVDescriptorBindingEntry, HCC_ALLOC_TAG_SPIRV_DESCRIPTOR_BINDING_TABLE, hcc_spirv_descriptor_binding_key_cmp, hcc_spirv_descriptor_binding_key_hash, decl_table_entries_cap);
-	cu->spirv.constant_table = hcc_hash_table_init(HccSPIRVConstantEntry, HCC_ALLOC_TAG_SPIRV_CONSTANT_TABLE, hcc_u32_key_cmp, hcc_u32_key_hash, setup->constant_table.entries_cap);
+	cu->spirv.decl_table = hcc_hash_table_init(HccSPIRVDeclEntry, HCC_ALLOC_TAG_SPIRV_DECL_TABLE, hcc_u32_key_cmp, hcc_u32_key_hash, HCC_HASH_TABLE_INITIAL_CAP_FOR(decl_table_entries_cap));
+	cu->spirv.descriptor_binding_table = hcc_hash_table_init(HccSPIRVDescriptorBindingEntry, HCC_ALLOC_TAG_SPIRV_DESCRIPTOR_BINDING_TABLE, hcc_spirv_descriptor_binding_key_cmp, hcc_spirv_descriptor_binding_key_hash, HCC_HASH_TABLE_INITIAL_CAP_FOR(decl_table_entries_cap));
+	cu->spirv.constant_table = hcc_hash_table_init(HccSPIRVConstantEntry, HCC_ALLOC_TAG_SPIRV_CONSTANT_TABLE, hcc_u32_key_cmp, hcc_u32_key_hash, HCC_HASH_TABLE_INITIAL_CAP_FOR(setup->constant_table.entries_cap));
 	cu->spirv.types_and_constants = hcc_stack_init(HccSPIRVTypeOrConstant, HCC_ALLOC_TAG_SPIRV_TYPES_AND_CONSTANTS, types_grow_count, types_reserve_cap + setup->constant_table.entries_cap);
 	cu->spirv.type_elmt_ids = hcc_stack_init(HccSPIRVId, HCC_ALLOC_TAG_SPIRV_TYPE_ELMT_IDS, setup->dtt.compound_fields_grow_count, setup->dtt.compound_fields_reserve_cap);
 	cu->spirv.entry_points = hcc_stack_init(HccSPIRVEntryPoint, HCC_ALLOC_TAG_SPIRV_ENTRY_POINTS, setup->functions_grow_count, setup->functions_reserve_cap);
@@ -41,7 +41,42 @@ void hcc_spirv_init(HccCU* cu, HccCUSetup* setup) {
 	cu->spirv.name_words = hcc_stack_init(HccSPIRVId, HCC_ALLOC_TAG_SPIRV_NAME_WORDS, types_grow_count, types_reserve_cap);
 	cu->spirv.decorate_words = hcc_stack_init(HccSPIRVWord, HCC_ALLOC_TAG_SPIRV_DECORATE_WORDS, types_grow_count, types_reserve_cap);
 	cu->spirv.decorate_blocks = hcc_stack_init(HccSPIRVId, HCC_ALLOC_TAG_SPIRV_DECORATE_BLOCKS, types_grow_count, types_reserve_cap);
+	cu->spirv.entry_point_binary_words = hcc_stack_init(HccSPIRVWord, HCC_ALLOC_TAG_SPIRV_ENTRY_POINT_BINARY_WORDS, (uint32_t)(setup->aml.function_alctor.instrs_grow_count * HCC_AML_INSTR_AVERAGE_WORDS), (uint32_t)(setup->aml.function_alctor.instrs_reserve_cap * HCC_AML_INSTR_AVERAGE_WORDS));
+	cu->spirv.link_jobs = hcc_stack_init(HccSPIRVLinkJob, HCC_ALLOC_TAG_SPIRV_LINK_JOBS, setup->functions_grow_count, setup->functions_reserve_cap);
+	cu->spirv.final_binary_words = hcc_stack_init(HccSPIRVWord, HCC_ALLOC_TAG_SPIRV_FINAL_BINARY_WORDS, (uint32_t)(setup->aml.function_alctor.instrs_grow_count * HCC_AML_INSTR_AVERAGE_WORDS), (uint32_t)(setup->aml.function_alctor.instrs_reserve_cap * HCC_AML_INSTR_AVERAGE_WORDS));
+	cu->spirv.module_liveness.function_flags = hcc_stack_init(bool, HCC_ALLOC_TAG_SPIRVLINK_LIVE_FUNCTION_FLAGS, setup->functions_grow_count, setup->functions_reserve_cap);
+	cu->spirv.module_liveness.id_flags = hcc_stack_init(bool, HCC_ALLOC_TAG_SPIRVLINK_LIVE_ID_FLAGS, (uint32_t)(setup->aml.function_alctor.instrs_grow_count * HCC_AML_INSTR_AVERAGE_WORDS), (uint32_t)(setup->aml.function_alctor.instrs_reserve_cap * HCC_AML_INSTR_AVERAGE_WORDS));
+}
+
+void hcc_spirv_deinit(HccCU* cu) {
+	hcc_stack_deinit(cu->spirv.functions);
+	hcc_stack_deinit(cu->spirv.function_words);
+	hcc_hash_table_deinit(cu->spirv.type_table);
+	hcc_hash_table_deinit(cu->spirv.unique_type_table);
+	hcc_hash_table_deinit(cu->spirv.decl_table);
+	hcc_hash_table_deinit(cu->spirv.descriptor_binding_table);
+	hcc_hash_table_deinit(cu->spirv.constant_table);
+	hcc_stack_deinit(cu->spirv.types_and_constants);
+	hcc_stack_deinit(cu->spirv.type_elmt_ids);
+	hcc_stack_deinit(cu->spirv.entry_points);
+	hcc_stack_deinit(cu->spirv.entry_point_global_variable_ids);
+	hcc_stack_deinit(cu->spirv.global_variable_words);
+	hcc_stack_deinit(cu->spirv.name_words);
+	hcc_stack_deinit(cu->spirv.decorate_words);
+	hcc_stack_deinit(cu->spirv.decorate_blocks);
+	hcc_stack_deinit(cu->spirv.entry_point_binary_words);
+	hcc_stack_deinit(cu->spirv.link_jobs);
+	hcc_stack_deinit(cu->spirv.final_binary_words);
+	hcc_stack_deinit(cu->spirv.module_liveness.function_flags);
+	hcc_stack_deinit(cu->spirv.module_liveness.id_flags);
+}
 
+void hcc_spirv_prepare(HccCU* cu) {
+	hcc_stack_resize(cu->spirv.functions, hcc_stack_count(cu->aml.functions));
+
+	//
+	// these constants are added here instead of in hcc_spirv_init so the AST binary,
+	// that is written before the backend runs, does not depend on the backend options.
 	HccBasic basic = { .u32 = hcc_options_get_u32(cu->options, HCC_OPTION_KEY_RESOURCE_DESCRIPTORS_MAX) };
 	cu->spirv.resource_descriptors_max_constant_spirv_id = hcc_spirv_constant_deduplicate(cu, hcc_constant_table_deduplicate_basic(cu, HCC_DATA_TYPE_AML_INTRINSIC_U32, &basic));
 	basic.u32 = HCC_SPIRV_SCOPE_DEVICE;
@@ -98,7 +133,7 @@ HccSPIRVId hcc_spirv_type_deduplicate(HccCU* cu, HccSPIRVStorageClass storage_cl
 			case HCC_DATA_TYPE_STRUCT: {
 				HccCompoundDataType* dt = hcc_compound_data_type_get(cu, data_type);
 				op = HCC_SPIRV_OP_TYPE_STRUCT;
-				operands = hcc_stack_push_many(cu->spirv.type_elmt_ids, dt->storage_fields_count + 1);
+				operands = hcc_stack_push_many_thread_safe(cu->spirv.type_elmt_ids, dt->storage_fields_count + 1);
 				operands_count = dt->storage_fields_count + 1;
 				for (uint32_t field_idx = 0; field_idx < dt->storage_fields_count; field_idx += 1) {
 					HccCompoundField* field = &dt->storage_fields[field_idx];
@@ -109,7 +144,7 @@ HccSPIRVId hcc_spirv_type_deduplicate(HccCU* cu, HccSPIRVStorageClass storage_cl
 			case HCC_DATA_TYPE_UNION: {
 				HccCompoundDataType* dt = hcc_compound_data_type_get(cu, data_type);
 				op = HCC_SPIRV_OP_TYPE_STRUCT;
-				operands = hcc_stack_push_many(cu->spirv.type_elmt_ids, 2);
+				operands = hcc_stack_push_many_thread_safe(cu->spirv.type_elmt_ids, 2);
 				operands[1] = hcc_spirv_type_deduplicate(cu, HCC_SPIRV_STORAGE_CLASS_INVALID, dt->storage_fields[dt->largest_sized_field_idx].data_type);
 				operands_count = 2;
 				break;
@@ -117,7 +152,7 @@ HccSPIRVId hcc_spirv_type_deduplicate(HccCU* cu, HccSPIRVStorageClass storage_cl
 			case HCC_DATA_TYPE_ARRAY: {
 				HccArrayDataType* dt = hcc_array_data_type_get(cu, data_type);
 				op = HCC_SPIRV_OP_TYPE_ARRAY;
-				operands = hcc_stack_push_many(cu->spirv.type_elmt_ids, 3);
+				operands = hcc_stack_push_many_thread_safe(cu->spirv.type_elmt_ids, 3);
 				operands[1] = hcc_spirv_type_deduplicate(cu, HCC_SPIRV_STORAGE_CLASS_INVALID, dt->element_data_type);
 				operands[2] = hcc_spirv_constant_deduplicate(cu, dt->element_count_constant_id);
 				operands_count = 3;
@@ -126,7 +161,7 @@ HccSPIRVId hcc_spirv_type_deduplicate(HccCU* cu, HccSPIRVStorageClass storage_cl
 			case HCC_DATA_TYPE_POINTER: {
 				HccPointerDataType* dt = hcc_pointer_data_type_get(cu, data_type);
 				op = HCC_SPIRV_OP_TYPE_POINTER;
-				operands = hcc_stack_push_many(cu->spirv.type_elmt_ids, 3);
+				operands = hcc_stack_push_many_thread_safe(cu->spirv.type_elmt_ids, 3);
 				operands[1] = storage_class;
 				operands[2] = hcc_spirv_type_deduplicate(cu, storage_class, dt->element_data_type);
 				operands_count = 3;
@@ -135,7 +170,7 @@ HccSPIRVId hcc_spirv_type_deduplicate(HccCU* cu, HccSPIRVStorageClass storage_cl
 			case HCC_DATA_TYPE_FUNCTION: {
 				HccFunctionDataType* dt = hcc_function_data_type_get(cu, data_type);
 				op = HCC_SPIRV_OP_TYPE_FUNCTION;
-				operands = hcc_stack_push_many(cu->spirv.type_elmt_ids, 2 + dt->params_count);
+				operands = hcc_stack_push_many_thread_safe(cu->spirv.type_elmt_ids, 2 + dt->params_count);
 				operands[1] = hcc_spirv_type_deduplicate(cu, HCC_SPIRV_STORAGE_CLASS_INVALID, dt->return_data_type);
 				for (uint32_t param_idx = 0; param_idx < dt->params_count; param_idx += 1) {
 					operands[2 + param_idx] = hcc_spirv_type_deduplicate(cu, HCC_SPIRV_STORAGE_CLASS_INVALID, dt->params[param_idx]);
@@ -148,14 +183,14 @@ HccSPIRVId hcc_spirv_type_deduplicate(HccCU* cu, HccSPIRVStorageClass storage_cl
 				HccAMLIntrinsicDataType aml_intrinsic_type = HCC_DATA_TYPE_AUX(data_type);
 				if (HCC_AML_INTRINSIC_DATA_TYPE_COLUMNS(aml_intrinsic_type) > 1 && HCC_AML_INTRINSIC_DATA_TYPE_ROWS(aml_intrinsic_type) > 1) {
 					op = HCC_SPIRV_OP_TYPE_MATRIX;
-					operands = hcc_stack_push_many(cu->spirv.type_elmt_ids, 3);
+					operands = hcc_stack_push_many_thread_safe(cu->spirv.type_elmt_ids, 3);
 					HccAMLIntrinsicDataType vector_intrinsic_type = aml_intrinsic_type & ~HCC_AML_INTRINSIC_DATA_TYPE_ROWS_MASK;
 					operands[1] = hcc_spirv_type_deduplicate(cu, HCC_SPIRV_STORAGE_CLASS_INVALID, HCC_DATA_TYPE(AML_INTRINSIC, vector_intrinsic_type));
 					operands[2] = HCC_AML_INTRINSIC_DATA_TYPE_ROWS(aml_intrinsic_type);
 					operands_count = 3;
 				} else if (HCC_AML_INTRINSIC_DATA_TYPE_COLUMNS(aml_intrinsic_type) > 1) {
 					op = HCC_SPIRV_OP_TYPE_VECTOR;
-					operands = hcc_stack_push_many(cu->spirv.type_elmt_ids, 3);
+					operands = hcc_stack_push_many_thread_safe(cu->spirv.type_elmt_ids, 3);
 					operands[1] = hcc_spirv_type_deduplicate(cu, HCC_SPIRV_STORAGE_CLASS_INVALID, HCC_DATA_TYPE(AML_INTRINSIC, HCC_AML_INTRINSIC_DATA_TYPE_SCALAR(aml_intrinsic_type)));
 					operands[2] = HCC_AML_INTRINSIC_DATA_TYPE_COLUMNS(aml_intrinsic_type);
 					operands_count = 3;
@@ -163,7 +198,7 @@ HccSPIRVId hcc_spirv_type_deduplicate(HccCU* cu, HccSPIRVStorageClass storage_cl
 					switch (aml_intrinsic_type) {
 						case HCC_AML_INTRINSIC_DATA_TYPE_VOID:
 							op = HCC_SPIRV_OP_TYPE_VOID;
-							operands = hcc_stack_push_many(cu->spirv.type_elmt_ids, 1);
+							operands = hcc_stack_push_many_thread_safe(cu->spirv.type_elmt_ids, 1);
 							operands_count = 1;
 							break;
 						case HCC_AML_INTRINSIC_DATA_TYPE_BOOL: {
@@ -180,7 +215,7 @@ HccSPIRVId hcc_spirv_type_deduplicate(HccCU* cu, HccSPIRVStorageClass storage_cl
 						case HCC_AML_INTRINSIC_DATA_TYPE_U32:
 						case HCC_AML_INTRINSIC_DATA_TYPE_U64:
 							op = HCC_SPIRV_OP_TYPE_INT;
-							operands = hcc_stack_push_many(cu->spirv.type_elmt_ids, 3);
+							operands = hcc_stack_push_many_thread_safe(cu->spirv.type_elmt_ids, 3);
 							operands[1] = hcc_aml_intrinsic_data_type_scalar_size_aligns[aml_intrinsic_type] * 8;
 							operands[2] = HCC_AML_INTRINSIC_DATA_TYPE_IS_SINT(aml_intrinsic_type);
 							operands_count = 3;
@@ -189,7 +224,7 @@ HccSPIRVId hcc_spirv_type_deduplicate(HccCU* cu, HccSPIRVStorageClass storage_cl
 						case HCC_AML_INTRINSIC_DATA_TYPE_F32:
 						case HCC_AML_INTRINSIC_DATA_TYPE_F64:
 							op = HCC_SPIRV_OP_TYPE_FLOAT;
-							operands = hcc_stack_push_many(cu->spirv.type_elmt_ids, 2);
+							operands = hcc_stack_push_many_thread_safe(cu->spirv.type_elmt_ids, 2);
 							operands[1] = hcc_aml_intrinsic_data_type_scalar_size_aligns[aml_intrinsic_type] * 8;
 							operands_count = 2;
 							break;
@@ -211,7 +246,7 @@ HccSPIRVId hcc_spirv_type_deduplicate(HccCU* cu, HccSPIRVStorageClass storage_cl
 						HccSPIRVId element_spirv_id = hcc_spirv_type_deduplicate(cu, HCC_SPIRV_STORAGE_CLASS_INVALID, d->element_data_type);
 
 						op = HCC_SPIRV_OP_TYPE_RUNTIME_ARRAY;
-						operands = hcc_stack_push_many(cu->spirv.type_elmt_ids, 2);
+						operands = hcc_stack_push_many_thread_safe(cu->spirv.type_elmt_ids, 2);
 						operands_count = 2;
 						operands[1] = element_spirv_id;
 						break;
@@ -228,7 +263,7 @@ HccSPIRVId hcc_spirv_type_deduplicate(HccCU* cu, HccSPIRVStorageClass storage_cl
 							intrinsic_data_type = hcc_texture_format_intrinsic_data_types[fmt];
 						}
 						HccAMLIntrinsicDataType sample_data_type = HCC_AML_INTRINSIC_DATA_TYPE_SCALAR(intrinsic_data_type);
-						operands = hcc_stack_push_many(cu->spirv.type_elmt_ids, 8);
+						operands = hcc_stack_push_many_thread_safe(cu->spirv.type_elmt_ids, 8);
 						operands_count = 8;
 						operands[1] = hcc_spirv_type_deduplicate(cu, HCC_SPIRV_STORAGE_CLASS_INVALID, HCC_DATA_TYPE(AML_INTRINSIC, sample_data_type));
 						switch (HCC_RESOURCE_DATA_TYPE_TEXTURE_DIM(resource_data_type)) {
@@ -250,7 +285,7 @@ HccSPIRVId hcc_spirv_type_deduplicate(HccCU* cu, HccSPIRVStorageClass storage_cl
 						break;
 					case HCC_RESOURCE_DATA_TYPE_SAMPLER:
 						op = HCC_SPIRV_OP_TYPE_SAMPLER;
-						operands = hcc_stack_push_many(cu->spirv.type_elmt_ids, 1);
+						operands = hcc_stack_push_many_thread_safe(cu->spirv.type_elmt_ids, 1);
 						operands_count = 1;
 						break;
 				}
@@ -275,7 +310,7 @@ HccSPIRVId hcc_spirv_type_deduplicate(HccCU* cu, HccSPIRVStorageClass storage_cl
 			spirv_id = hcc_spirv_next_id_many(cu, num_ids);
 			operands[0] = spirv_id;
 
-			HccSPIRVTypeOrConstant* type = hcc_stack_push(cu->spirv.types_and_constants);
+			HccSPIRVTypeOrConstant* type = hcc_stack_push_thread_safe(cu->spirv.types_and_constants);
 			type->op = op;
 			type->operands = operands;
 			type->operands_count = operands_count;
@@ -339,9 +374,9 @@ HccSPIRVId hcc_spirv_type_deduplicate(HccCU* cu, HccSPIRVStorageClass storage_cl
 					operands[1] = HCC_SPIRV_DECORATION_ARRAY_STRIDE;
 					operands[2] = element_size;
 				} else if (HCC_DATA_TYPE_IS_TEXTURE(data_type) && num_ids == 2) {
-					HccSPIRVTypeOrConstant* sampled_image_type = hcc_stack_push(cu->spirv.types_and_constants);
+					HccSPIRVTypeOrConstant* sampled_image_type = hcc_stack_push_thread_safe(cu->spirv.types_and_constants);
 					sampled_image_type->op = HCC_SPIRV_OP_TYPE_SAMPLED_IMAGE;
-					sampled_image_type->operands = hcc_stack_push_many(cu->spirv.type_elmt_ids, 2);
+					sampled_image_type->operands = hcc_stack_push_many_thread_safe(cu->spirv.type_elmt_ids, 2);
 					sampled_image_type->operands_count = 2;
 					sampled_image_type->operands[0] = spirv_id + 1;
 					sampled_image_type->operands[1] = spirv_id;
@@ -457,9 +492,9 @@ void hcc_spirv_resource_descriptor_binding_deduplicate(HccCU* cu, HccDataType da
 		HccSPIRVId element_type_spirv_id = data_type_spirv_id;
 		if (HCC_RESOURCE_DATA_TYPE_IS_BUFFER(resource_data_type)) {
 			HccSPIRVId struct_spirv_id = hcc_spirv_next_id(cu);
-			HccSPIRVTypeOrConstant* struct_type = hcc_stack_push(cu->spirv.types_and_constants);
+			HccSPIRVTypeOrConstant* struct_type = hcc_stack_push_thread_safe(cu->spirv.types_and_constants);
 			struct_type->op = HCC_SPIRV_OP_TYPE_STRUCT;
-			struct_type->operands = hcc_stack_push_many(cu->spirv.type_elmt_ids, 2);
+			struct_type->operands = hcc_stack_push_many_thread_safe(cu->spirv.type_elmt_ids, 2);
 			struct_type->operands_count = 2;
 			struct_type->operands[0] = struct_spirv_id;
 			struct_type->operands[1] = data_type_spirv_id;
@@ -477,17 +512,17 @@ void hcc_spirv_resource_descriptor_binding_deduplicate(HccCU* cu, HccDataType da
 			element_type_spirv_id = struct_spirv_id;
 		}
 
-		HccSPIRVTypeOrConstant* array_type = hcc_stack_push(cu->spirv.types_and_constants);
+		HccSPIRVTypeOrConstant* array_type = hcc_stack_push_thread_safe(cu->spirv.types_and_constants);
 		array_type->op = HCC_SPIRV_OP_TYPE_ARRAY;
-		array_type->operands = hcc_stack_push_many(cu->spirv.type_elmt_ids, 3);
+		array_type->operands = hcc_stack_push_many_thread_safe(cu->spirv.type_elmt_ids, 3);
 		array_type->operands_count = 3;
 		array_type->operands[0] = hcc_spirv_next_id(cu);
 		array_type->operands[1] = element_type_spirv_id;
 		array_type->operands[2] = cu->spirv.resource_descriptors_max_constant_spirv_id;
 
-		HccSPIRVTypeOrConstant* pointer_array_type = hcc_stack_push(cu->spirv.types_and_constants);
+		HccSPIRVTypeOrConstant* pointer_array_type = hcc_stack_push_thread_safe(cu->spirv.types_and_constants);
 		pointer_array_type->op = HCC_SPIRV_OP_TYPE_POINTER;
-		pointer_array_type->operands = hcc_stack_push_many(cu->spirv.type_elmt_ids, 3);
+		pointer_array_type->operands = hcc_stack_push_many_thread_safe(cu->spirv.type_elmt_ids, 3);
 		pointer_array_type->operands_count = 3;
 		pointer_array_type->operands[0] = hcc_spirv_next_id(cu);
 		pointer_array_type->operands[1] = storage_class;
@@ -556,7 +591,7 @@ HccSPIRVId hcc_spirv_constant_deduplicate(HccCU* cu, HccConstantId constant_id)
 		if (c.size == 0) {
 			operands_count = 2;
 			op = HCC_SPIRV_OP_CONSTANT_NULL;
-			operands = hcc_stack_push_many(cu->spirv.type_elmt_ids, operands_count);
+			operands = hcc_stack_push_many_thread_safe(cu->spirv.type_elmt_ids, operands_count);
 		} else if (HCC_DATA_TYPE_IS_COMPOSITE(c.data_type)) {
 			HccConstantId* src_constant_ids = c.data;
 
@@ -570,7 +605,7 @@ HccSPIRVId hcc_spirv_constant_deduplicate(HccCU* cu, HccConstantId constant_id)
 
 				operands_count = 2 + hcc_spirv_string_words_count(string_size);
 				op = HCC_SPIRV_OP_CONSTANT_COMPOSITE;
-				operands = hcc_stack_push_many(cu->spirv.type_elmt_ids, operands_count);
+				operands = hcc_stack_push_many_thread_safe(cu->spirv.type_elmt_ids, operands_count);
 
 				uint32_t word_idx = 0;
 				uint32_t idx = 0;
@@ -602,7 +637,7 @@ HccSPIRVId hcc_spirv_constant_deduplicate(HccCU* cu, HccConstantId constant_id)
 				uint32_t fields_count = hcc_data_type_composite_storage_fields_count(cu, c.data_type);
 				operands_count = 2 + fields_count;
 				op = HCC_SPIRV_OP_CONSTANT_COMPOSITE;
-				operands = hcc_stack_push_many(cu->spirv.type_elmt_ids, operands_count);
+				operands = hcc_stack_push_many_thread_safe(cu->spirv.type_elmt_ids, operands_count);
 				for (uint32_t field_idx = 0; field_idx < fields_count; field_idx += 1) {
 					operands[2 + field_idx] = hcc_spirv_constant_deduplicate(cu, src_constant_ids[field_idx]);
 				}
@@ -610,7 +645,7 @@ HccSPIRVId hcc_spirv_constant_deduplicate(HccCU* cu, HccConstantId constant_id)
 		} else if (HCC_DATA_TYPE_TYPE(c.data_type) == HCC_DATA_TYPE_RESOURCE) {
 			operands_count = 3;
 			op = HCC_SPIRV_OP_CONSTANT;
-			operands = hcc_stack_push_many(cu->spirv.type_elmt_ids, operands_count);
+			operands = hcc_stack_push_many_thread_safe(cu->spirv.type_elmt_ids, operands_count);
 			operands[2] = *(uint32_t*)c.data;
 		} else if (HCC_DATA_TYPE_TYPE(c.data_type) == HCC_DATA_TYPE_AML_INTRINSIC) {
 			HccAMLIntrinsicDataType intrin = HCC_DATA_TYPE_AUX(c.data_type);
@@ -645,7 +680,7 @@ HccSPIRVId hcc_spirv_constant_deduplicate(HccCU* cu, HccConstantId constant_id)
 
 				operands_count = is_64 ? 4 : 3;
 				op = HCC_SPIRV_OP_CONSTANT;
-				operands = hcc_stack_push_many(cu->spirv.type_elmt_ids, operands_count);
+				operands = hcc_stack_push_many_thread_safe(cu->spirv.type_elmt_ids, operands_count);
 				operands[2] = words[0];
 				if (is_64) {
 					operands[3] = words[1];
@@ -660,7 +695,7 @@ HccSPIRVId hcc_spirv_constant_deduplicate(HccCU* cu, HccConstantId constant_id)
 		operands[0] = hcc_spirv_type_deduplicate(cu, HCC_SPIRV_STORAGE_CLASS_INVALID, final_data_type);
 		operands[1] = spirv_id;
 
-		HccSPIRVTypeOrConstant* constant = hcc_stack_push(cu->spirv.types_and_constants);
+		HccSPIRVTypeOrConstant* constant = hcc_stack_push_thread_safe(cu->spirv.types_and_constants);
 		constant->op = op;
 		constant->operands = operands;
 		constant->operands_count = operands_count;
@@ -746,6 +781,76 @@ HccSPIRVStorageClass hcc_spirv_storage_class_from_aml_operand(HccCU* cu, const H
 	}
 }
 
+//
+// returns true when the operand at operand_idx is a literal and not an id, for the instructions that spirvgen emits.
+// the operand index starts after the word that holds the op and words count.
+// OpSwitch case literals are always a single word, as spirvgen only emits 32 bit selectors.
+bool hcc_spirv_op_operand_is_literal(HccSPIRVOp op, uint32_t operand_idx) {
+	switch (op) {
+		case HCC_SPIRV_OP_NAME:
+		case HCC_SPIRV_OP_MEMBER_NAME:
+		case HCC_SPIRV_OP_DECORATE:
+		case HCC_SPIRV_OP_MEMBER_DECORATE:
+		case HCC_SPIRV_OP_EXECUTION_MODE:
+		case HCC_SPIRV_OP_TYPE_INT:
+		case HCC_SPIRV_OP_TYPE_FLOAT:
+			return operand_idx >= 1;
+		case HCC_SPIRV_OP_TYPE_VECTOR:
+		case HCC_SPIRV_OP_TYPE_MATRIX:
+		case HCC_SPIRV_OP_TYPE_IMAGE:
+			return operand_idx >= 2;
+		case HCC_SPIRV_OP_TYPE_POINTER:
+			return operand_idx == 1;
+		case HCC_SPIRV_OP_CONSTANT:
+			return operand_idx >= 2;
+		case HCC_SPIRV_OP_VARIABLE:
+		case HCC_SPIRV_OP_FUNCTION:
+			return operand_idx == 2;
+		case HCC_SPIRV_OP_EXT_INST:
+			return operand_idx == 3;
+		case HCC_SPIRV_OP_VECTOR_SHUFFLE:
+			return operand_idx >= 4;
+		case HCC_SPIRV_OP_COMPOSITE_EXTRACT:
+		case HCC_SPIRV_OP_LOAD:
+			return operand_idx >= 3;
+		case HCC_SPIRV_OP_STORE:
+		case HCC_SPIRV_OP_LOOP_MERGE:
+			return operand_idx >= 2;
+		case HCC_SPIRV_OP_SELECTION_MERGE:
+			return operand_idx >= 1;
+		case HCC_SPIRV_OP_BRANCH_CONDITIONAL:
+			return operand_idx >= 3;
+		case HCC_SPIRV_OP_SWITCH:
+			return operand_idx >= 2 && operand_idx % 2 == 0;
+		case HCC_SPIRV_OP_IMAGE_SAMPLE_IMPLICIT_LOD:
+		case HCC_SPIRV_OP_IMAGE_SAMPLE_EXPLICIT_LOD:
+		case HCC_SPIRV_OP_IMAGE_FETCH:
+		case HCC_SPIRV_OP_IMAGE_READ:
+			return operand_idx == 4;
+		case HCC_SPIRV_OP_IMAGE_GATHER:
+			return operand_idx == 5;
+		case HCC_SPIRV_OP_IMAGE_WRITE:
+			return operand_idx == 3;
+		case HCC_SPIRV_OP_GROUP_NON_UNIFORM_BALLOT_BIT_COUNT:
+		case HCC_SPIRV_OP_GROUP_NON_UNIFORM_I_ADD:
+		case HCC_SPIRV_OP_GROUP_NON_UNIFORM_F_ADD:
+		case HCC_SPIRV_OP_GROUP_NON_UNIFORM_I_MUL:
+		case HCC_SPIRV_OP_GROUP_NON_UNIFORM_F_MUL:
+		case HCC_SPIRV_OP_GROUP_NON_UNIFORM_S_MIN:
+		case HCC_SPIRV_OP_GROUP_NON_UNIFORM_U_MIN:
+		case HCC_SPIRV_OP_GROUP_NON_UNIFORM_F_MIN:
+		case HCC_SPIRV_OP_GROUP_NON_UNIFORM_S_MAX:
+		case HCC_SPIRV_OP_GROUP_NON_UNIFORM_U_MAX:
+		case HCC_SPIRV_OP_GROUP_NON_UNIFORM_F_MAX:
+		case HCC_SPIRV_OP_GROUP_NON_UNIFORM_BITWISE_AND:
+		case HCC_SPIRV_OP_GROUP_NON_UNIFORM_BITWISE_OR:
+		case HCC_SPIRV_OP_GROUP_NON_UNIFORM_BITWISE_XOR:
+			return operand_idx == 3;
+		default:
+			return false;
+	}
+}
+
 uint32_t hcc_spirv_string_words_count(uint32_t string_size) {
 	return (string_size + 4) / 4;
 }
@@ -776,14 +881,14 @@ void hcc_spirv_encode_string(HccSPIRVWord* dst_words, HccString string) {
 
 HccSPIRVOperand* hcc_spirv_add_global_variable(HccCU* cu, uint32_t operands_count) {
 	uint32_t words_count = operands_count + 1;
-	HccSPIRVWord* words = hcc_stack_push_many(cu->spirv.global_variable_words, words_count);
+	HccSPIRVWord* words = hcc_stack_push_many_thread_safe(cu->spirv.global_variable_words, words_count);
 	words[0] = (words_count << 16) | HCC_SPIRV_OP_VARIABLE;
 	return &words[1];
 }
 
 void hcc_spirv_add_name(HccCU* cu, uint32_t spirv_id, HccString name) {
 	uint32_t words_count = 2 + hcc_spirv_string_words_count(name.size);
-	HccSPIRVWord* words = hcc_stack_push_many(cu->spirv.name_words, words_count);
+	HccSPIRVWord* words = hcc_stack_push_many_thread_safe(cu->spirv.name_words, words_count);
 	words[0] = (words_count << 16) | HCC_SPIRV_OP_NAME;
 	words[1] = spirv_id;
 	hcc_spirv_encode_string(&words[2], name);
@@ -791,7 +896,7 @@ void hcc_spirv_add_name(HccCU* cu, uint32_t spirv_id, HccString name) {
 
 void hcc_spirv_add_member_name(HccCU* cu, uint32_t spirv_id, uint32_t member_idx, HccString name) {
 	uint32_t words_count = 3 + hcc_spirv_string_words_count(name.size);
-	HccSPIRVWord* words = hcc_stack_push_many(cu->spirv.name_words, words_count);
+	HccSPIRVWord* words = hcc_stack_push_many_thread_safe(cu->spirv.name_words, words_count);
 	words[0] = (words_count << 16) | HCC_SPIRV_OP_MEMBER_NAME;
 	words[1] = spirv_id;
 	words[2] = member_idx;
@@ -805,19 +910,19 @@ void hcc_spirv_decorate_block_deduplicate(HccCU* cu, HccSPIRVId spirv_id) {
 		}
 	}
 
-	*hcc_stack_push(cu->spirv.decorate_blocks) = spirv_id;
+	*hcc_stack_push_thread_safe(cu->spirv.decorate_blocks) = spirv_id;
 }
 
 HccSPIRVOperand* hcc_spirv_add_decorate(HccCU* cu, uint32_t operands_count) {
 	uint32_t words_count = operands_count + 1;
-	HccSPIRVWord* words = hcc_stack_push_many(cu->spirv.decorate_words, words_count);
+	HccSPIRVWord* words = hcc_stack_push_many_thread_safe(cu->spirv.decorate_words, words_count);
 	words[0] = (words_count << 16) | HCC_SPIRV_OP_DECORATE;
 	return &words[1];
 }
 
 HccSPIRVOperand* hcc_spirv_add_member_decorate(HccCU* cu, uint32_t operands_count) {
 	uint32_t words_count = operands_count + 1;
-	HccSPIRVWord* words = hcc_stack_push_many(cu->spirv.decorate_words, words_count);
+	HccSPIRVWord* words = hcc_stack_push_many_thread_safe(cu->spirv.decorate_words, words_count);
 	words[0] = (words_count << 16) | HCC_SPIRV_OP_MEMBER_DECORATE;
 	return &words[1];
 }
@@ -841,7 +946,7 @@ bool hcc_spirv_type_key_cmp(void* a, void* b, uintptr_t size) {
 
 HccHash hcc_spirv_type_key_hash(void* key, uintptr_t size) {
 	HCC_UNUSED(size);
-	return hcc_hash_fnv(key, sizeof(HccSPIRVTypeKey), HCC_HASH_FNV_INIT);
+	return hcc_hash_wy(key, sizeof(HccSPIRVTypeKey), HCC_HASH_WY_INIT);
 }
 
 bool hcc_spirv_unique_type_key_cmp(void* a, void* b, uintptr_t size) {
@@ -854,9 +959,9 @@ bool hcc_spirv_unique_type_key_cmp(void* a, void* b, uintptr_t size) {
 HccHash hcc_spirv_unique_type_key_hash(void* key, uintptr_t size) {
 	HCC_UNUSED(size);
 	HccSPIRVUniqueTypeKey* k = key;
-	HccHash hash = hcc_hash_fnv(&k->operands_count, sizeof(k->operands_count), HCC_HASH_FNV_INIT);
-	hash = hcc_hash_fnv(k->operands, sizeof(HccSPIRVOperand) * k->operands_count, hash);
-	hash = hcc_hash_fnv(&k->op, sizeof(k->op), hash);
+	HccHash hash = hcc_hash_wy(&k->operands_count, sizeof(k->operands_count), HCC_HASH_WY_INIT);
+	hash = hcc_hash_wy(k->operands, sizeof(HccSPIRVOperand) * k->operands_count, hash);
+	hash = hcc_hash_wy(&k->op, sizeof(k->op), hash);
 	return hash;
 }
 
@@ -869,7 +974,7 @@ bool hcc_spirv_descriptor_binding_key_cmp(void* a, void* b, uintptr_t size) {
 
 HccHash hcc_spirv_descriptor_binding_key_hash(void* key, uintptr_t size) {
 	HCC_UNUSED(size);
-	return hcc_hash_fnv(key, sizeof(HccSPIRVDescriptorBindingKey), HCC_HASH_FNV_INIT);
+	return hcc_hash_wy(key, sizeof(HccSPIRVDescriptorBindingKey), HCC_HASH_WY_INIT);
 }
 
 uint32_t hcc_spirv_image_format[HCC_TEXTURE_FORMAT_COUNT] = {
@@ -135,7 +135,7 @@ void hcc_spirvgen_generate(HccWorker* w) {
 	w->spirvgen.basic_block_param_base_id = hcc_spirv_next_id_many(cu, aml_function->basic_block_params_count);
 
 	function->words_cap = (uint32_t)floorf((float)aml_function->words_cap * 1.5f);
-	function->words = hcc_stack_push_many(cu->spirv.function_words, function->words_cap);
+	function->words = hcc_stack_push_many_thread_safe(cu->spirv.function_words, function->words_cap);
 
 	HccSPIRVId function_spirv_id = hcc_spirv_decl_deduplicate(cu, function_decl);
 	hcc_spirv_add_name(cu, function_spirv_id, hcc_string_table_get(hcc_decl_identifier_string_id(cu, function_decl)));
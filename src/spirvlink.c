@@ -2,6 +2,10 @@
 #include "hcc_internal.h"
 void hcc_spirvlink_init(HccWorker* w, HccCompilerSetup* setup) {
 	w->spirvlink.words = hcc_stack_init(HccSPIRVWord, HCC_ALLOC_TAG_SPIRVLINK_WORDS, setup->backendlink.binary_grow_size / sizeof(HccSPIRVWord), setup->backendlink.binary_reserve_size / sizeof(HccSPIRVWord));
+	//
+	// every function and spirv id takes up at least a word of the binary, so these never need more than the binary does
+	w->spirvlink.entry_point_liveness.function_flags = hcc_stack_init(bool, HCC_ALLOC_TAG_SPIRVLINK_LIVE_FUNCTION_FLAGS, setup->backendlink.binary_grow_size / sizeof(HccSPIRVWord), setup->backendlink.binary_reserve_size / sizeof(HccSPIRVWord));
+	w->spirvlink.entry_point_liveness.id_flags = hcc_stack_init(bool, HCC_ALLOC_TAG_SPIRVLINK_LIVE_ID_FLAGS, setup->backendlink.binary_grow_size / sizeof(HccSPIRVWord), setup->backendlink.binary_reserve_size / sizeof(HccSPIRVWord));
 }
 
 void hcc_spirvlink_deinit(HccWorker* w) {
@@ -10,15 +14,17 @@ void hcc_spirvlink_deinit(HccWorker* w) {
 
 void hcc_spirvlink_reset(HccWorker* w) {
 	hcc_stack_clear(w->spirvlink.words);
+	hcc_stack_clear(w->spirvlink.entry_point_liveness.function_flags);
+	hcc_stack_clear(w->spirvlink.entry_point_liveness.id_flags);
 	w->spirvlink.instr_op = HCC_SPIRV_OP_NO_OP;
 }
 
 HccSPIRVWord* hcc_spirvlink_add_word(HccWorker* w) {
-	return hcc_stack_push(w->spirvlink.words);
+	return hcc_stack_push(w->spirvlink.dst_words);
 }
 
 HccSPIRVWord* hcc_spirvlink_add_word_many(HccWorker* w, uint32_t amount) {
-	return hcc_stack_push_many(w->spirvlink.words, amount);
+	return hcc_stack_push_many(w->spirvlink.dst_words, amount);
 }
 
 HccSPIRVOperand* hcc_spirvlink_add_instr(HccWorker* w, HccSPIRVOp op, uint32_t operands_count) {
@@ -58,6 +64,279 @@ void hcc_spirvlink_instr_end(HccWorker* w) {
 	w->spirvlink.instr_op = HCC_SPIRV_OP_NO_OP;
 }
 
+bool hcc_spirvlink_is_live(HccWorker* w, HccSPIRVId spirv_id) {
+	HccSPIRVLiveness* liveness = w->spirvlink.liveness;
+	return !liveness->is_stripping_dead_code || spirv_id >= hcc_stack_count(liveness->id_flags) || liveness->id_flags[spirv_id];
+}
+
+bool hcc_spirvlink_is_live_function(HccWorker* w, HccDecl function_decl) {
+	HccSPIRVLiveness* liveness = w->spirvlink.liveness;
+	return !liveness->is_stripping_dead_code || liveness->function_flags[HCC_DECL_AUX(function_decl)];
+}
+
+HccSPIRVId hcc_spirvlink_type_or_constant_id(HccSPIRVTypeOrConstant* type_or_constant) {
+	switch (type_or_constant->op) {
+		case HCC_SPIRV_OP_CONSTANT_TRUE:
+		case HCC_SPIRV_OP_CONSTANT_FALSE:
+		case HCC_SPIRV_OP_CONSTANT:
+		case HCC_SPIRV_OP_CONSTANT_COMPOSITE:
+		case HCC_SPIRV_OP_CONSTANT_NULL:
+			return type_or_constant->operands[1];
+		default:
+			return type_or_constant->operands[0];
+	}
+}
+
+bool hcc_spirvlink_mark_live(HccWorker* w, HccSPIRVWord word) {
+	HccSPIRVLiveness* liveness = w->spirvlink.liveness;
+	if (word >= hcc_stack_count(liveness->id_flags) || liveness->id_flags[word]) {
+		return false;
+	}
+
+	liveness->id_flags[word] = true;
+	return true;
+}
+
+bool hcc_spirvlink_mark_live_operands(HccWorker* w, HccSPIRVOp op, HccSPIRVWord* operands, uint32_t operands_count) {
+	//
+	// literal operands are skipped, otherwise whichever dead id happens to have the same value would be kept
+	// and what gets stripped would depend on the order the ids were handed out in.
+	bool has_changed = false;
+	for (uint32_t operand_idx = 0; operand_idx < operands_count; operand_idx += 1) {
+		if (!hcc_spirv_op_operand_is_literal(op, operand_idx)) {
+			has_changed |= hcc_spirvlink_mark_live(w, operands[operand_idx]);
+		}
+	}
+
+	return has_changed;
+}
+
+void hcc_spirvlink_mark_live_functions(HccWorker* w, HccSPIRVEntryPoint* entry_point) {
+	HccCU* cu = w->cu;
+	HccSPIRVLiveness* liveness = w->spirvlink.liveness;
+	uint32_t functions_count = hcc_stack_count(cu->aml.functions);
+	HCC_ZERO_ELMT_MANY(hcc_stack_push_many(liveness->function_flags, functions_count), functions_count);
+
+	//
+	// the ordered function list has every function after the functions it calls,
+	// so going backwards from the entry points reaches the callers before their callees.
+	// the calls are found in the final AML as inlining will have removed some of them.
+	// when linking a single entry point, it is the only function that starts off live.
+	HccStack(HccDecl) optimize_functions = hcc_aml_optimize_functions(cu);
+	for (uint32_t idx = hcc_stack_count(optimize_functions); idx-- > 0; ) {
+		HccDecl function_decl = optimize_functions[idx];
+		const HccAMLFunction* aml_function = hcc_aml_function_get(cu, function_decl);
+		bool is_root = entry_point ? function_decl == entry_point->function_decl : aml_function->shader_stage != HCC_SHADER_STAGE_NONE;
+		if (!is_root && !liveness->function_flags[HCC_DECL_AUX(function_decl)]) {
+			continue;
+		}
+		liveness->function_flags[HCC_DECL_AUX(function_decl)] = true;
+
+		for (uint32_t aml_word_idx = 0; aml_word_idx < aml_function->words_count; ) {
+			HccAMLInstr* aml_instr = &aml_function->words[aml_word_idx];
+			if (HCC_AML_INSTR_OP(aml_instr) == HCC_AML_OP_CALL) {
+				HccDecl callee_decl = HCC_AML_INSTR_OPERANDS(aml_instr)[1];
+				if (HCC_DECL_IS_FUNCTION(callee_decl)) {
+					liveness->function_flags[HCC_DECL_AUX(callee_decl)] = true;
+				}
+			}
+
+			aml_word_idx += HCC_AML_INSTR_WORDS_COUNT(aml_instr);
+		}
+
+		HccSPIRVFunction* function = hcc_stack_get(cu->spirv.functions, HCC_DECL_AUX(function_decl));
+		for (uint32_t word_idx = 0; word_idx < function->words_count; ) {
+			uint32_t words_count = function->words[word_idx] >> 16;
+			hcc_spirvlink_mark_live_operands(w, function->words[word_idx] & 0xffff, &function->words[word_idx + 1], words_count - 1);
+
+			word_idx += words_count;
+		}
+	}
+}
+
+void hcc_spirvlink_mark_live_globals_types_and_constants(HccWorker* w) {
+	HccCU* cu = w->cu;
+
+	//
+	// the types and constants are in the order they are defined, so going backwards reaches the users first.
+	// they are added from many threads so loop until nothing changes, in case one was added before something it uses.
+	bool has_changed = true;
+	while (has_changed) {
+		has_changed = false;
+
+		for (uint32_t word_idx = 0; word_idx < hcc_stack_count(cu->spirv.global_variable_words); ) {
+			HccSPIRVWord* words = &cu->spirv.global_variable_words[word_idx];
+			uint32_t words_count = words[0] >> 16;
+			if (hcc_spirvlink_is_live(w, words[2])) {
+				has_changed |= hcc_spirvlink_mark_live_operands(w, words[0] & 0xffff, &words[1], words_count - 1);
+			}
+
+			word_idx += words_count;
+		}
+
+		for (uint32_t type_idx = hcc_stack_count(cu->spirv.types_and_constants); type_idx-- > 0; ) {
+			HccSPIRVTypeOrConstant* type_or_constant = &cu->spirv.types_and_constants[type_idx];
+			if (hcc_spirvlink_is_live(w, hcc_spirvlink_type_or_constant_id(type_or_constant))) {
+				has_changed |= hcc_spirvlink_mark_live_operands(w, type_or_constant->op, type_or_constant->operands, type_or_constant->operands_count);
+			}
+		}
+	}
+}
+
+uint32_t hcc_spirvlink_copy_live_instrs(HccWorker* w, HccSPIRVWord* dst, HccSPIRVWord* words, uint32_t words_count, uint32_t target_operand_idx) {
+	if (!w->spirvlink.liveness->is_stripping_dead_code) {
+		if (dst) {
+			HCC_COPY_ELMT_MANY(dst, words, words_count);
+		}
+		return words_count;
+	}
+
+	uint32_t dst_words_count = 0;
+	for (uint32_t word_idx = 0; word_idx < words_count; ) {
+		uint32_t instr_words_count = words[word_idx] >> 16;
+		if (hcc_spirvlink_is_live(w, words[word_idx + 1 + target_operand_idx])) {
+			if (dst) {
+				HCC_COPY_ELMT_MANY(&dst[dst_words_count], &words[word_idx], instr_words_count);
+			}
+			dst_words_count += instr_words_count;
+		}
+
+		word_idx += instr_words_count;
+	}
+
+	return dst_words_count;
+}
+
+uint32_t hcc_spirvlink_write_section(HccWorker* w, HccSPIRVLinkJob* link_job, HccSPIRVWord* dst) {
+	HccCU* cu = w->cu;
+
+	//
+	// when dst is NULL nothing is written and only the number of words is returned,
+	// so the space for the section can be made before it is written.
+	uint32_t words_count = 0;
+	switch (link_job->type) {
+		case HCC_SPIRVLINK_JOB_TYPE_NAMES:
+			words_count = hcc_spirvlink_copy_live_instrs(w, dst, cu->spirv.name_words, hcc_stack_count(cu->spirv.name_words), 0);
+			break;
+		case HCC_SPIRVLINK_JOB_TYPE_DECORATES: {
+			for (uint32_t idx = 0; idx < hcc_stack_count(cu->spirv.decorate_blocks); idx += 1) {
+				if (!hcc_spirvlink_is_live(w, cu->spirv.decorate_blocks[idx])) {
+					continue;
+				}
+
+				if (dst) {
+					dst[words_count + 0] = (3 << 16) | HCC_SPIRV_OP_DECORATE;
+					dst[words_count + 1] = cu->spirv.decorate_blocks[idx];
+					dst[words_count + 2] = HCC_SPIRV_DECORATION_BLOCK;
+				}
+				words_count += 3;
+			}
+
+			words_count += hcc_spirvlink_copy_live_instrs(w, dst ? &dst[words_count] : NULL, cu->spirv.decorate_words, hcc_stack_count(cu->spirv.decorate_words), 0);
+			break;
+		};
+		case HCC_SPIRVLINK_JOB_TYPE_TYPES_AND_CONSTANTS:
+			for (uint32_t type_idx = 0; type_idx < hcc_stack_count(cu->spirv.types_and_constants); type_idx += 1) {
+				HccSPIRVTypeOrConstant* type_or_constant = &cu->spirv.types_and_constants[type_idx];
+				if (!hcc_spirvlink_is_live(w, hcc_spirvlink_type_or_constant_id(type_or_constant))) {
+					continue;
+				}
+
+				if (dst) {
+					dst[words_count] = ((type_or_constant->operands_count + 1) << 16) | type_or_constant->op;
+					HCC_COPY_ELMT_MANY(&dst[words_count + 1], type_or_constant->operands, type_or_constant->operands_count);
+				}
+				words_count += type_or_constant->operands_count + 1;
+			}
+			break;
+		case HCC_SPIRVLINK_JOB_TYPE_GLOBAL_VARIABLES:
+			words_count = hcc_spirvlink_copy_live_instrs(w, dst, cu->spirv.global_variable_words, hcc_stack_count(cu->spirv.global_variable_words), 1);
+			break;
+		case HCC_SPIRVLINK_JOB_TYPE_FUNCTIONS: {
+			HccStack(HccDecl) optimize_functions = hcc_aml_optimize_functions(cu);
+			for (uint32_t idx = link_job->start_idx; idx < link_job->end_idx; idx += 1) {
+				HccDecl function_decl = optimize_functions[idx];
+				if (!hcc_spirvlink_is_live_function(w, function_decl)) {
+					continue;
+				}
+
+				HccSPIRVFunction* function = hcc_stack_get(cu->spirv.functions, HCC_DECL_AUX(function_decl));
+				if (dst) {
+					HCC_COPY_ELMT_MANY(&dst[words_count], function->words, function->words_count);
+				}
+				words_count += function->words_count;
+			}
+			break;
+		};
+		default: HCC_UNREACHABLE("unhandled spirvlink section: %u", link_job->type);
+	}
+
+	return words_count;
+}
+
+void hcc_spirvlink_add_section(HccWorker* w, HccSPIRVLinkJobType type) {
+	HccCU* cu = w->cu;
+	HccSPIRVLinkJob section_job = { .type = type };
+	uint32_t words_count = hcc_spirvlink_write_section(w, &section_job, NULL);
+	HccSPIRVWord* dst = hcc_spirvlink_add_word_many(w, words_count);
+
+	//
+	// an entry point module is linked by a single job, so it writes the section straight away.
+	// otherwise a job is made to write the section in to the space that has been made for it.
+	if (w->spirvlink.dst_words == w->spirvlink.words) {
+		hcc_spirvlink_write_section(w, &section_job, dst);
+		return;
+	}
+
+	HccSPIRVLinkJob* link_job = hcc_stack_push(cu->spirv.link_jobs);
+	*link_job = section_job;
+	link_job->dst_word_idx = dst - w->spirvlink.dst_words;
+	link_job->words_count = words_count;
+}
+
+void hcc_spirvlink_add_functions(HccWorker* w) {
+	HccCU* cu = w->cu;
+	HccStack(HccDecl) optimize_functions = hcc_aml_optimize_functions(cu);
+	uint32_t functions_count = hcc_stack_count(optimize_functions);
+	if (w->spirvlink.dst_words == w->spirvlink.words) {
+		HccSPIRVLinkJob section_job = { .type = HCC_SPIRVLINK_JOB_TYPE_FUNCTIONS, .start_idx = 0, .end_idx = functions_count };
+		uint32_t words_count = hcc_spirvlink_write_section(w, &section_job, NULL);
+		hcc_spirvlink_write_section(w, &section_job, hcc_spirvlink_add_word_many(w, words_count));
+		return;
+	}
+
+	//
+	// a prefix sum over the words of the live functions gives each FUNCTIONS job the offset it writes to.
+	// the functions are split up so the jobs are big enough to be worth giving out.
+	uint32_t start_word_idx = hcc_stack_count(w->spirvlink.dst_words);
+	uint32_t dst_word_idx = start_word_idx;
+	HccSPIRVLinkJob* link_job = NULL;
+	for (uint32_t idx = 0; idx < functions_count; idx += 1) {
+		HccDecl function_decl = optimize_functions[idx];
+		if (!hcc_spirvlink_is_live_function(w, function_decl)) {
+			continue;
+		}
+
+		if (link_job == NULL) {
+			link_job = hcc_stack_push(cu->spirv.link_jobs);
+			link_job->type = HCC_SPIRVLINK_JOB_TYPE_FUNCTIONS;
+			link_job->start_idx = idx;
+			link_job->dst_word_idx = dst_word_idx;
+			link_job->words_count = 0;
+		}
+
+		HccSPIRVFunction* function = hcc_stack_get(cu->spirv.functions, HCC_DECL_AUX(function_decl));
+		link_job->end_idx = idx + 1;
+		link_job->words_count += function->words_count;
+		dst_word_idx += function->words_count;
+		if (link_job->words_count >= HCC_SPIRVLINK_FUNCTIONS_JOB_WORDS_MIN) {
+			link_job = NULL;
+		}
+	}
+
+	hcc_spirvlink_add_word_many(w, dst_word_idx - start_word_idx);
+}
+
 bool hcc_spirvlink_add_used_global_variable_ids(HccWorker* w, HccDecl function_decl) {
 	HccCU* cu = w->cu;
 
@@ -77,6 +356,9 @@ bool hcc_spirvlink_add_used_global_variable_ids(HccWorker* w, HccDecl function_d
 	HccSPIRVFunction* function = hcc_stack_get(cu->spirv.functions, HCC_DECL_AUX(function_decl));
 	for (uint32_t global_variable_idx = 0; global_variable_idx < function->global_variables_count; global_variable_idx += 1) {
 		HccSPIRVId spirv_id = function->global_variable_ids[global_variable_idx];
+		if (!hcc_spirvlink_is_live(w, spirv_id)) {
+			continue;
+		}
 
 		for (uint32_t idx = 0; idx < w->spirvlink.function_unique_globals_count; idx += 1) {
 			if (w->spirvlink.function_unique_globals[idx] == spirv_id) {
@@ -95,10 +377,99 @@ NEXT: {}
 	return true;
 }
 
+void hcc_spirvlink_prepare(HccCU* cu) {
+	//
+	// the link jobs run at the same time and read through the types and constants,
+	// so the builtin variable types are added before any of them start.
+	cu->spirv.variable_input_f32x4_type_id = hcc_spirv_type_deduplicate(cu, HCC_SPIRV_STORAGE_CLASS_INPUT, hcc_pointer_data_type_deduplicate(cu, HCC_DATA_TYPE_CONST(HCC_DATA_TYPE_AML_INTRINSIC_F32X4)));
+	cu->spirv.variable_input_u32x3_type_id = hcc_spirv_type_deduplicate(cu, HCC_SPIRV_STORAGE_CLASS_INPUT, hcc_pointer_data_type_deduplicate(cu, HCC_DATA_TYPE_CONST(HCC_DATA_TYPE_AML_INTRINSIC_U32X3)));
+	cu->spirv.variable_input_u32_type_id = hcc_spirv_type_deduplicate(cu, HCC_SPIRV_STORAGE_CLASS_INPUT, hcc_pointer_data_type_deduplicate(cu, HCC_DATA_TYPE_CONST(HCC_DATA_TYPE_AML_INTRINSIC_U32)));
+	cu->spirv.variable_output_f32x4_type_id = hcc_spirv_type_deduplicate(cu, HCC_SPIRV_STORAGE_CLASS_OUTPUT, hcc_pointer_data_type_deduplicate(cu, HCC_DATA_TYPE_AML_INTRINSIC_F32X4));
+	cu->spirv.variable_output_f32_type_id = hcc_spirv_type_deduplicate(cu, HCC_SPIRV_STORAGE_CLASS_OUTPUT, hcc_pointer_data_type_deduplicate(cu, HCC_DATA_TYPE_AML_INTRINSIC_F32));
+
+	hcc_stack_clear(cu->spirv.link_jobs);
+}
+
+HccSPIRVLinkJob* hcc_spirvlink_add_job(HccCU* cu, HccSPIRVLinkJobType type, uint32_t start_idx) {
+	HccSPIRVLinkJob* link_job = hcc_stack_push(cu->spirv.link_jobs);
+	link_job->type = type;
+	link_job->start_idx = start_idx;
+	link_job->end_idx = start_idx;
+	link_job->dst_word_idx = 0;
+	link_job->words_count = 0;
+	return link_job;
+}
+
 void hcc_spirvlink_link(HccWorker* w) {
 	HccCU* cu = w->cu;
+	HccSPIRVLinkJob* link_job = w->job.arg;
+	switch (link_job->type) {
+		case HCC_SPIRVLINK_JOB_TYPE_MODULE:
+			hcc_spirvlink_link_module(w, NULL);
+			break;
+		case HCC_SPIRVLINK_JOB_TYPE_ENTRY_POINT:
+			hcc_spirvlink_link_module(w, hcc_stack_get(cu->spirv.entry_points, link_job->start_idx));
+			break;
+		default: {
+			w->spirvlink.liveness = &cu->spirv.module_liveness;
+			uint32_t words_count = hcc_spirvlink_write_section(w, link_job, &cu->spirv.final_binary_words[link_job->dst_word_idx]);
+			HCC_DEBUG_ASSERT(words_count == link_job->words_count, "internal error: spirvlink section wrote %u words but had space for %u", words_count, link_job->words_count);
+			break;
+		};
+	}
+}
+
+void hcc_spirvlink_link_module(HccWorker* w, HccSPIRVEntryPoint* single_entry_point) {
+	HccCU* cu = w->cu;
+	HccSPIRVLinkJob* link_job = w->job.arg;
 	HccSPIRVOperand* operands = NULL;
 
+	HccSPIRVId variable_input_f32x4_type_id = cu->spirv.variable_input_f32x4_type_id;
+	HccSPIRVId variable_input_u32x3_type_id = cu->spirv.variable_input_u32x3_type_id;
+	HccSPIRVId variable_input_u32_type_id = cu->spirv.variable_input_u32_type_id;
+	HccSPIRVId variable_output_f32x4_type_id = cu->spirv.variable_output_f32x4_type_id;
+	HccSPIRVId variable_output_f32_type_id = cu->spirv.variable_output_f32_type_id;
+
+	//
+	// an entry point module is linked by this job alone in to the worker's own words.
+	// the module with every entry point is written straight in to the final binary,
+	// this job leaves space for the big sections and gives them out to be written in parallel.
+	uint32_t entry_points_start_idx = 0;
+	uint32_t entry_points_end_idx = hcc_stack_count(cu->spirv.entry_points);
+	if (single_entry_point) {
+		entry_points_start_idx = link_job->start_idx;
+		entry_points_end_idx = entry_points_start_idx + 1;
+		w->spirvlink.dst_words = w->spirvlink.words;
+		w->spirvlink.liveness = &w->spirvlink.entry_point_liveness;
+	} else {
+		w->spirvlink.dst_words = cu->spirv.final_binary_words;
+		w->spirvlink.liveness = &cu->spirv.module_liveness;
+		hcc_stack_clear(cu->spirv.final_binary_words);
+		hcc_stack_clear(cu->spirv.module_liveness.function_flags);
+		hcc_stack_clear(cu->spirv.module_liveness.id_flags);
+		link_job->start_idx = hcc_stack_count(cu->spirv.link_jobs);
+	}
+
+	//
+	// with optimizations on, leave out the functions that are no longer called after inlining
+	// along with the global variables, types and constants that only they were using.
+	// a single entry point module always leaves out everything that the entry point does not use.
+	HccSPIRVLiveness* liveness = w->spirvlink.liveness;
+	HccOptLevel opt_level = hcc_options_get_u32(cu->options, HCC_OPTION_KEY_OPT_LEVEL);
+	liveness->is_stripping_dead_code = single_entry_point || (opt_level != HCC_OPT_LEVEL_0 && opt_level != HCC_OPT_LEVEL_G);
+	if (liveness->is_stripping_dead_code) {
+		uint32_t ids_count = atomic_load(&cu->spirv.next_spirv_id);
+		HCC_ZERO_ELMT_MANY(hcc_stack_push_many(liveness->id_flags, ids_count), ids_count);
+
+		hcc_spirvlink_mark_live_functions(w, single_entry_point);
+		hcc_spirvlink_mark_live(w, variable_input_f32x4_type_id);
+		hcc_spirvlink_mark_live(w, variable_input_u32x3_type_id);
+		hcc_spirvlink_mark_live(w, variable_input_u32_type_id);
+		hcc_spirvlink_mark_live(w, variable_output_f32x4_type_id);
+		hcc_spirvlink_mark_live(w, variable_output_f32_type_id);
+		hcc_spirvlink_mark_live_globals_types_and_constants(w);
+	}
+
 	HccSPIRVWord magic_number = 0x07230203;
 	*hcc_spirvlink_add_word(w) = magic_number;
 
@@ -211,7 +582,7 @@ void hcc_spirvlink_link(HccWorker* w) {
 	hcc_spirvlink_instr_add_operand(w, HCC_SPIRV_MEMORY_MODEL_VULKAN);
 	hcc_spirvlink_instr_end(w);
 
-	for (uint32_t entry_point_idx = 0; entry_point_idx < hcc_stack_count(cu->spirv.entry_points); entry_point_idx += 1) {
+	for (uint32_t entry_point_idx = entry_points_start_idx; entry_point_idx < entry_points_end_idx; entry_point_idx += 1) {
 		HccSPIRVEntryPoint* entry_point = &cu->spirv.entry_points[entry_point_idx];
 
 		hcc_spirvlink_instr_start(w, HCC_SPIRV_OP_ENTRY_POINT);
@@ -238,7 +609,7 @@ void hcc_spirvlink_link(HccWorker* w) {
 		hcc_spirvlink_instr_end(w);
 	}
 
-	for (uint32_t entry_point_idx = 0; entry_point_idx < hcc_stack_count(cu->spirv.entry_points); entry_point_idx += 1) {
+	for (uint32_t entry_point_idx = entry_points_start_idx; entry_point_idx < entry_points_end_idx; entry_point_idx += 1) {
 		HccSPIRVEntryPoint* entry_point = &cu->spirv.entry_points[entry_point_idx];
 		switch (entry_point->shader_stage) {
 			case HCC_SHADER_STAGE_VERTEX:
@@ -267,16 +638,9 @@ void hcc_spirvlink_link(HccWorker* w) {
 	}
 
 	{ // debug info
-		HccSPIRVWord* words = hcc_spirvlink_add_word_many(w, hcc_stack_count(cu->spirv.name_words));
-		HCC_COPY_ELMT_MANY(words, cu->spirv.name_words, hcc_stack_count(cu->spirv.name_words));
+		hcc_spirvlink_add_section(w, HCC_SPIRVLINK_JOB_TYPE_NAMES);
 	}
 
-	HccSPIRVId variable_input_f32x4_type_id = hcc_spirv_type_deduplicate(w->cu, HCC_SPIRV_STORAGE_CLASS_INPUT, hcc_pointer_data_type_deduplicate(cu, HCC_DATA_TYPE_CONST(HCC_DATA_TYPE_AML_INTRINSIC_F32X4)));
-	HccSPIRVId variable_input_u32x3_type_id = hcc_spirv_type_deduplicate(w->cu, HCC_SPIRV_STORAGE_CLASS_INPUT, hcc_pointer_data_type_deduplicate(cu, HCC_DATA_TYPE_CONST(HCC_DATA_TYPE_AML_INTRINSIC_U32X3)));
-	HccSPIRVId variable_input_u32_type_id = hcc_spirv_type_deduplicate(w->cu, HCC_SPIRV_STORAGE_CLASS_INPUT, hcc_pointer_data_type_deduplicate(cu, HCC_DATA_TYPE_CONST(HCC_DATA_TYPE_AML_INTRINSIC_U32)));
-	HccSPIRVId variable_output_f32x4_type_id = hcc_spirv_type_deduplicate(w->cu, HCC_SPIRV_STORAGE_CLASS_OUTPUT, hcc_pointer_data_type_deduplicate(cu, HCC_DATA_TYPE_AML_INTRINSIC_F32X4));
-	HccSPIRVId variable_output_f32_type_id = hcc_spirv_type_deduplicate(w->cu, HCC_SPIRV_STORAGE_CLASS_OUTPUT, hcc_pointer_data_type_deduplicate(cu, HCC_DATA_TYPE_AML_INTRINSIC_F32));
-
 	{
 		operands = hcc_spirvlink_add_instr(w, HCC_SPIRV_OP_DECORATE, 3);
 		operands[0] = HCC_SPIRV_ID_VARIABLE_INPUT_VERTEX_IDX;
@@ -327,16 +691,9 @@ void hcc_spirvlink_link(HccWorker* w) {
 		operands[0] = HCC_SPIRV_ID_VARIABLE_INPUT_SUBGROUP_LOCAL_INVOCATION_ID;
 		operands[1] = HCC_SPIRV_DECORATION_BUILTIN;
 		operands[2] = HCC_SPIRV_BUILTIN_SUBGROUP_LOCAL_INVOCATION_ID;
-
-		for (uint32_t idx = 0; idx < hcc_stack_count(cu->spirv.decorate_blocks); idx += 1) {
-			operands = hcc_spirvlink_add_instr(w, HCC_SPIRV_OP_DECORATE, 2);
-			operands[0] = cu->spirv.decorate_blocks[idx];
-			operands[1] = HCC_SPIRV_DECORATION_BLOCK;
-		}
 	}
 
-	HccSPIRVWord* words = hcc_spirvlink_add_word_many(w, hcc_stack_count(cu->spirv.decorate_words));
-	HCC_COPY_ELMT_MANY(words, cu->spirv.decorate_words, hcc_stack_count(cu->spirv.decorate_words));
+	hcc_spirvlink_add_section(w, HCC_SPIRVLINK_JOB_TYPE_DECORATES);
 
 	{
 		operands = hcc_spirvlink_add_instr(w, HCC_SPIRV_OP_TYPE_BOOL, 1);
@@ -358,13 +715,7 @@ void hcc_spirvlink_link(HccWorker* w) {
 		operands[2] = 4;
 	}
 
-	for (uint32_t type_idx = 0; type_idx < hcc_stack_count(cu->spirv.types_and_constants); type_idx += 1) {
-		HccSPIRVTypeOrConstant* type_or_constant = &cu->spirv.types_and_constants[type_idx];
-		operands = hcc_spirvlink_add_instr(w, type_or_constant->op, type_or_constant->operands_count);
-		for (uint32_t operand_idx = 0; operand_idx < type_or_constant->operands_count; operand_idx += 1) {
-			operands[operand_idx] = type_or_constant->operands[operand_idx];
-		}
-	}
+	hcc_spirvlink_add_section(w, HCC_SPIRVLINK_JOB_TYPE_TYPES_AND_CONSTANTS);
 
 	{
 		operands = hcc_spirvlink_add_instr(w, HCC_SPIRV_OP_VARIABLE, 3);
@@ -417,22 +768,23 @@ void hcc_spirvlink_link(HccWorker* w) {
 		operands[1] = HCC_SPIRV_ID_VARIABLE_INPUT_SUBGROUP_LOCAL_INVOCATION_ID;
 		operands[2] = HCC_SPIRV_STORAGE_CLASS_INPUT;
 
-		HccSPIRVWord* words = hcc_spirvlink_add_word_many(w, hcc_stack_count(cu->spirv.global_variable_words));
-		HCC_COPY_ELMT_MANY(words, cu->spirv.global_variable_words, hcc_stack_count(cu->spirv.global_variable_words));
+		hcc_spirvlink_add_section(w, HCC_SPIRVLINK_JOB_TYPE_GLOBAL_VARIABLES);
 	}
 
-	HccStack(HccDecl) optimize_functions = hcc_aml_optimize_functions(cu);
-	for (uint32_t idx = 0; idx < hcc_stack_count(optimize_functions); idx += 1) {
-		HccDecl function_decl = optimize_functions[idx];
-
-		HccSPIRVFunction* function = hcc_stack_get(cu->spirv.functions, HCC_DECL_AUX(function_decl));
-		HccSPIRVWord* words = hcc_spirvlink_add_word_many(w, function->words_count);
-		HCC_COPY_ELMT_MANY(words, function->words, function->words_count);
-	}
+	hcc_spirvlink_add_functions(w);
 
 	*dst_highest_id = atomic_load(&cu->spirv.next_spirv_id);
 
-	cu->spirv.final_binary_words = w->spirvlink.words;
-	cu->spirv.final_binary_words_count = hcc_stack_count(w->spirvlink.words);
+	if (single_entry_point) {
+		//
+		// this worker may go on to link another entry point, so the module is copied out of its words
+		uint32_t words_count = hcc_stack_count(w->spirvlink.words);
+		HccSPIRVWord* words = hcc_stack_push_many_thread_safe(cu->spirv.entry_point_binary_words, words_count);
+		HCC_COPY_ELMT_MANY(words, w->spirvlink.words, words_count);
+		single_entry_point->binary_words_start_idx = words - cu->spirv.entry_point_binary_words;
+		single_entry_point->binary_words_count = words_count;
+	} else {
+		link_job->end_idx = hcc_stack_count(cu->spirv.link_jobs);
+	}
 }
 
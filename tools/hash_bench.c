@@ -0,0 +1,184 @@
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+//
+// measures hcc_hash_wy against the byte at a time FNV-1a that it replaced.
+// the compiler is built into this tool so the same hcc_hash_wy and key hash functions are used.
+// it hashes the intrinsic identifiers, a large input and aligned pointers as integer keys,
+// which are what the string table, the AML and data type keys and the integer key hash tables see.
+#include "../src/core.c"
+#include "../src/ata.c"
+#include "../src/ast.c"
+#include "../src/aml.c"
+#include "../src/atagen.c"
+#include "../src/astgen.c"
+#include "../src/astlink.c"
+#include "../src/amlgen.c"
+#include "../src/amlopt.c"
+#include "../src/spirv.c"
+#include "../src/spirvgen.c"
+#include "../src/spirvlink.c"
+#include "../src/metadatagen.c"
+#include "../interop/hcc_interop.c"
+#include "../src/intrinsic_strings.c"
+#include "../src/hcc.c"
+#include <hmaths.c>
+
+#define BENCH_FNV_64_INIT 0xcbf29ce484222325
+#define BENCH_SLOTS_COUNT 32768
+#define BENCH_LARGE_INPUT_SIZE 65536
+#define BENCH_POINTERS_COUNT 16384
+#define BENCH_POINTERS_STRIDE 64
+#define BENCH_BUCKETS_COUNT 4096
+
+typedef struct BenchString BenchString;
+struct BenchString {
+	const char* data;
+	uint32_t    size;
+};
+
+typedef uint64_t (*BenchHashFn)(const void* data, uintptr_t size);
+
+//
+// the FNV-1a that hcc used before, kept here to compare against
+uint64_t bench_hash_fnv_64(const void* data, uintptr_t size) {
+	const char* bytes = data;
+	const char* bytes_end = bytes + size;
+	uint64_t hash = BENCH_FNV_64_INIT;
+	while (bytes < bytes_end) {
+		hash = hash ^ *bytes;
+		hash = hash * 0x00000100000001B3;
+		bytes += 1;
+	}
+
+	return hash;
+}
+
+uint64_t bench_hash_wy(const void* data, uintptr_t size) {
+	return hcc_hash_wy(data, size, HCC_HASH_WY_INIT);
+}
+
+volatile uint64_t bench_sink;
+
+double bench_strings(BenchHashFn hash_fn, BenchString* strings, uint32_t strings_count, uint32_t rounds_count) {
+	HccTime start_time = hcc_time_now(HCC_TIME_MODE_MONOTONIC);
+	uint64_t sink = 0;
+	for (uint32_t round_idx = 0; round_idx < rounds_count; round_idx += 1) {
+		for (uint32_t idx = 0; idx < strings_count; idx += 1) {
+			sink ^= hash_fn(strings[idx].data, strings[idx].size);
+		}
+	}
+	bench_sink = sink;
+	return hcc_duration_to_f64_secs(hcc_time_diff(hcc_time_now(HCC_TIME_MODE_MONOTONIC), start_time));
+}
+
+double bench_large_input(BenchHashFn hash_fn, uint8_t* data, uint32_t rounds_count) {
+	HccTime start_time = hcc_time_now(HCC_TIME_MODE_MONOTONIC);
+	uint64_t sink = 0;
+	for (uint32_t round_idx = 0; round_idx < rounds_count; round_idx += 1) {
+		data[0] = (uint8_t)round_idx;
+		sink ^= hash_fn(data, BENCH_LARGE_INPUT_SIZE);
+	}
+	bench_sink = sink;
+	return hcc_duration_to_f64_secs(hcc_time_diff(hcc_time_now(HCC_TIME_MODE_MONOTONIC), start_time));
+}
+
+uint32_t bench_collisions(BenchHashFn hash_fn, BenchString* strings, uint32_t strings_count) {
+	static bool is_slot_used[BENCH_SLOTS_COUNT];
+	memset(is_slot_used, 0, sizeof(is_slot_used));
+	uint32_t collisions_count = 0;
+	for (uint32_t idx = 0; idx < strings_count; idx += 1) {
+		uint32_t slot_idx = hash_fn(strings[idx].data, strings[idx].size) & (BENCH_SLOTS_COUNT - 1);
+		collisions_count += is_slot_used[slot_idx];
+		is_slot_used[slot_idx] = true;
+	}
+
+	return collisions_count;
+}
+
+uint32_t bench_fullest_bucket(bool is_identity) {
+	static uint32_t bucket_counts[BENCH_BUCKETS_COUNT];
+	memset(bucket_counts, 0, sizeof(bucket_counts));
+	uint32_t fullest_count = 0;
+	uint8_t* base = malloc(BENCH_POINTERS_COUNT * BENCH_POINTERS_STRIDE);
+	for (uint32_t idx = 0; idx < BENCH_POINTERS_COUNT; idx += 1) {
+		uint64_t key = (uintptr_t)(base + idx * BENCH_POINTERS_STRIDE);
+		HccHash hash = is_identity ? key : hcc_u64_key_hash(&key, sizeof(key));
+		uint32_t bucket_idx = hash & (BENCH_BUCKETS_COUNT - 1);
+		bucket_counts[bucket_idx] += 1;
+		fullest_count = HCC_MAX(fullest_count, bucket_counts[bucket_idx]);
+	}
+	free(base);
+
+	return fullest_count;
+}
+
+int main(int argc, char** argv) {
+	uint32_t rounds_count = argc > 1 ? strtoul(argv[1], NULL, 10) : 200;
+	uint32_t runs_count = argc > 2 ? strtoul(argv[2], NULL, 10) : 3;
+	if (rounds_count == 0 || runs_count == 0) {
+		fprintf(stderr, "usage: %s [rounds_count] [runs_count]\n", argv[0]);
+		return 1;
+	}
+
+	HccSetup setup = hcc_setup_default;
+	if (!HCC_IS_SUCCESS(hcc_init(&setup))) {
+		fprintf(stderr, "failed to initialize hcc\n");
+		return 1;
+	}
+
+	BenchString* strings = malloc(HCC_INTRINSIC_STRINGS_COUNT * sizeof(BenchString));
+	uint64_t strings_size = 0;
+	for (uint32_t idx = 0; idx < HCC_INTRINSIC_STRINGS_COUNT; idx += 1) {
+		const HccIntrinsicString* intrinsic = &hcc_intrinsic_strings[idx];
+		strings[idx].data = &hcc_intrinsic_strings_data[intrinsic->data_idx / HCC_INTRINSIC_STRINGS_DATA_ROW_SIZE][intrinsic->data_idx % HCC_INTRINSIC_STRINGS_DATA_ROW_SIZE];
+		strings[idx].size = intrinsic->size;
+		strings_size += intrinsic->size;
+	}
+
+	uint8_t* large_input = malloc(BENCH_LARGE_INPUT_SIZE);
+	for (uint32_t idx = 0; idx < BENCH_LARGE_INPUT_SIZE; idx += 1) {
+		large_input[idx] = (uint8_t)(idx * 31 + 7);
+	}
+
+	static const char* names[] = { "fnv", "wy" };
+	static const BenchHashFn hash_fns[] = { bench_hash_fnv_64, bench_hash_wy };
+	printf(
+		"%u intrinsic identifiers (%.1f bytes on average), %u rounds, best of %u runs\n",
+		HCC_INTRINSIC_STRINGS_COUNT, (double)strings_size / HCC_INTRINSIC_STRINGS_COUNT, rounds_count, runs_count
+	);
+	printf("hash  ns/identifier  identifiers GB/s  collisions in %u slots  %uKB input GB/s\n", BENCH_SLOTS_COUNT, BENCH_LARGE_INPUT_SIZE / 1024);
+	for (uint32_t fn_idx = 0; fn_idx < HCC_ARRAY_COUNT(hash_fns); fn_idx += 1) {
+		double strings_secs = 0.0;
+		double large_input_secs = 0.0;
+		for (uint32_t run_idx = 0; run_idx < runs_count; run_idx += 1) {
+			double run_strings_secs = bench_strings(hash_fns[fn_idx], strings, HCC_INTRINSIC_STRINGS_COUNT, rounds_count);
+			double run_large_input_secs = bench_large_input(hash_fns[fn_idx], large_input, rounds_count);
+			if (run_idx == 0 || run_strings_secs < strings_secs) {
+				strings_secs = run_strings_secs;
+			}
+			if (run_idx == 0 || run_large_input_secs < large_input_secs) {
+				large_input_secs = run_large_input_secs;
+			}
+		}
+
+		double hashes_count = (double)HCC_INTRINSIC_STRINGS_COUNT * rounds_count;
+		printf(
+			"%-4s  %13.1f  %16.2f  %22u  %14.2f\n",
+			names[fn_idx],
+			strings_secs * 1e9 / hashes_count,
+			(double)strings_size * rounds_count / strings_secs / 1e9,
+			bench_collisions(hash_fns[fn_idx], strings, HCC_INTRINSIC_STRINGS_COUNT),
+			(double)BENCH_LARGE_INPUT_SIZE * rounds_count / large_input_secs / 1e9
+		);
+	}
+
+	printf(
+		"\n%u pointers %u bytes apart in %u buckets, fullest bucket: identity key hash %u, hcc_u64_key_hash %u\n",
+		BENCH_POINTERS_COUNT, BENCH_POINTERS_STRIDE, BENCH_BUCKETS_COUNT, bench_fullest_bucket(true), bench_fullest_bucket(false)
+	);
+
+	return 0;
+}
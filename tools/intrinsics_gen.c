@@ -3,6 +3,35 @@
 #include <string.h>
 #include <stdlib.h>
 
+//
+// the compiler is built into this tool so the intrinsic strings are generated from the same tables the compiler uses.
+// src/intrinsic_strings.c is the file that gets generated so it is left out and an empty table is used in its place.
+#define HCC_INTRINSIC_STRINGS_COUNT 0
+#define HCC_INTRINSIC_STRINGS_BUCKETS_COUNT 1
+#define HCC_INTRINSIC_STRINGS_SLOTS_COUNT 1
+
+#include "../src/core.c"
+#include "../src/ata.c"
+#include "../src/ast.c"
+#include "../src/aml.c"
+#include "../src/atagen.c"
+#include "../src/astgen.c"
+#include "../src/astlink.c"
+#include "../src/amlgen.c"
+#include "../src/amlopt.c"
+#include "../src/spirv.c"
+#include "../src/spirvgen.c"
+#include "../src/spirvlink.c"
+#include "../src/metadatagen.c"
+#include "../interop/hcc_interop.c"
+#include "../src/hcc.c"
+#include <hmaths.c>
+
+const uint16_t           hcc_intrinsic_strings_bucket_displacements[1];
+const uint16_t           hcc_intrinsic_strings_slots[1];
+const HccIntrinsicString hcc_intrinsic_strings[1];
+const char               hcc_intrinsic_strings_data[1][HCC_INTRINSIC_STRINGS_DATA_ROW_SIZE];
+
 typedef int DataType;
 enum DataType {
 	DATA_TYPE_BOOL,
@@ -874,7 +903,527 @@ void generate_texture_intrinsics_file(void) {
 	print_header_file_footer("_HCC_TEXTURE_INTRINSICS_H_");
 }
 
+// ===========================================
+//
+//
+// Intrinsic Strings
+//
+//
+// ===========================================
+
+typedef struct IntrinsicStrings IntrinsicStrings;
+struct IntrinsicStrings {
+	char**     strings; // indexed by the string identifier
+	HccHash64* hashes;  // indexed by the string identifier
+	uint32_t   count;
+};
+
+IntrinsicStrings intrinsic_strings;
+
+void add_intrinsic_string(uint32_t string_id, const char* string) {
+	if (intrinsic_strings.strings[string_id]) {
+		if (strcmp(intrinsic_strings.strings[string_id], string) != 0) {
+			fprintf(stderr, "intrinsic string identifier '%u' is used by '%s' and '%s'\n", string_id, intrinsic_strings.strings[string_id], string);
+			exit(1);
+		}
+		return;
+	}
+
+	intrinsic_strings.strings[string_id] = strdup(string);
+	intrinsic_strings.count += 1;
+}
+
+void add_intrinsic_many_function_strings(char* buf, uint32_t buf_size, uint32_t insert_idx, const char* fmt, uint32_t expected_string_id, HccManyTypeClass support, int c, int r) {
+	// skip HCC_AML_INTRINSIC_DATA_TYPE_VOID
+	expected_string_id += 1;
+
+	if (support & HCC_MANY_TYPE_CLASS_BOOL) {
+		snprintf(buf + insert_idx, buf_size - insert_idx, fmt, hcc_aml_intrinsic_data_type_scalar_strings[HCC_AML_INTRINSIC_DATA_TYPE_BOOL], c, r);
+		add_intrinsic_string(expected_string_id, buf);
+	}
+	expected_string_id += 1;
+
+	if (support & HCC_MANY_TYPE_CLASS_SINT) {
+		for (HccAMLIntrinsicDataType intrinsic = HCC_AML_INTRINSIC_DATA_TYPE_S8; intrinsic <= HCC_AML_INTRINSIC_DATA_TYPE_S64; intrinsic += 1) {
+			snprintf(buf + insert_idx, buf_size - insert_idx, fmt, hcc_aml_intrinsic_data_type_scalar_strings[intrinsic], c, r);
+			add_intrinsic_string(expected_string_id, buf);
+			expected_string_id += 1;
+		}
+	} else {
+		expected_string_id += 4;
+	}
+
+	if (support & HCC_MANY_TYPE_CLASS_UINT) {
+		for (HccAMLIntrinsicDataType intrinsic = HCC_AML_INTRINSIC_DATA_TYPE_U8; intrinsic <= HCC_AML_INTRINSIC_DATA_TYPE_U64; intrinsic += 1) {
+			snprintf(buf + insert_idx, buf_size - insert_idx, fmt, hcc_aml_intrinsic_data_type_scalar_strings[intrinsic], c, r);
+			add_intrinsic_string(expected_string_id, buf);
+			expected_string_id += 1;
+		}
+	} else {
+		expected_string_id += 4;
+	}
+
+	if (support & HCC_MANY_TYPE_CLASS_FLOAT) {
+		for (HccAMLIntrinsicDataType intrinsic = HCC_AML_INTRINSIC_DATA_TYPE_F16; intrinsic <= HCC_AML_INTRINSIC_DATA_TYPE_F64; intrinsic += 1) {
+			snprintf(buf + insert_idx, buf_size - insert_idx, fmt, hcc_aml_intrinsic_data_type_scalar_strings[intrinsic], c, r);
+			add_intrinsic_string(expected_string_id, buf);
+			expected_string_id += 1;
+		}
+	}
+}
+
+void add_intrinsic_strings(void) {
+	for (HccATAToken t = HCC_ATA_TOKEN_KEYWORDS_START; t < HCC_ATA_TOKEN_KEYWORDS_END; t += 1) {
+		const char* string = hcc_ata_token_strings[t];
+		uint32_t expected_string_id = HCC_STRING_ID_KEYWORDS_START + (t - HCC_ATA_TOKEN_KEYWORDS_START);
+		add_intrinsic_string(expected_string_id, string);
+	}
+
+	for (HccPPPredefinedMacro m = 0; m < HCC_PP_PREDEFINED_MACRO_COUNT; m += 1) {
+		const char* string = hcc_pp_predefined_macro_identifier_strings[m];
+		uint32_t expected_string_id = HCC_STRING_ID_PREDEFINED_MACROS_START + m;
+		add_intrinsic_string(expected_string_id, string);
+	}
+
+	{
+		const char* comps = "xyzw";
+		char buf[8];
+		uint32_t expected_string_id = HCC_STRING_ID_SWIZZLE_XYZW_START;
+		for (int c = 0; c < 4; c += 1) {
+			for (int cc = 0; cc < 4; cc += 1) {
+				snprintf(buf, sizeof(buf), "%c%c", comps[c], comps[cc]);
+				add_intrinsic_string(expected_string_id, buf);
+				expected_string_id += 1;
+			}
+		}
+		for (int c = 0; c < 4; c += 1) {
+			for (int cc = 0; cc < 4; cc += 1) {
+				for (int ccc = 0; ccc < 4; ccc += 1) {
+					snprintf(buf, sizeof(buf), "%c%c%c", comps[c], comps[cc], comps[ccc]);
+					add_intrinsic_string(expected_string_id, buf);
+					expected_string_id += 1;
+				}
+			}
+		}
+		for (int c = 0; c < 4; c += 1) {
+			for (int cc = 0; cc < 4; cc += 1) {
+				for (int ccc = 0; ccc < 4; ccc += 1) {
+					for (int cccc = 0; cccc < 4; cccc += 1) {
+						snprintf(buf, sizeof(buf), "%c%c%c%c", comps[c], comps[cc], comps[ccc], comps[cccc]);
+						add_intrinsic_string(expected_string_id, buf);
+						expected_string_id += 1;
+					}
+				}
+			}
+		}
+		HCC_DEBUG_ASSERT(expected_string_id == HCC_STRING_ID_SWIZZLE_XYZW_END, "did not fill in all the swizzle string ids");
+	}
+
+	{
+		const char* comps = "rgba";
+		char buf[8];
+		uint32_t expected_string_id = HCC_STRING_ID_SWIZZLE_RGBA_START;
+		for (int c = 0; c < 4; c += 1) {
+			for (int cc = 0; cc < 4; cc += 1) {
+				snprintf(buf, sizeof(buf), "%c%c", comps[c], comps[cc]);
+				add_intrinsic_string(expected_string_id, buf);
+				expected_string_id += 1;
+			}
+		}
+		for (int c = 0; c < 4; c += 1) {
+			for (int cc = 0; cc < 4; cc += 1) {
+				for (int ccc = 0; ccc < 4; ccc += 1) {
+					snprintf(buf, sizeof(buf), "%c%c%c", comps[c], comps[cc], comps[ccc]);
+					add_intrinsic_string(expected_string_id, buf);
+					expected_string_id += 1;
+				}
+			}
+		}
+		for (int c = 0; c < 4; c += 1) {
+			for (int cc = 0; cc < 4; cc += 1) {
+				for (int ccc = 0; ccc < 4; ccc += 1) {
+					for (int cccc = 0; cccc < 4; cccc += 1) {
+						snprintf(buf, sizeof(buf), "%c%c%c%c", comps[c], comps[cc], comps[ccc], comps[cccc]);
+						add_intrinsic_string(expected_string_id, buf);
+						expected_string_id += 1;
+					}
+				}
+			}
+		}
+		HCC_DEBUG_ASSERT(expected_string_id == HCC_STRING_ID_SWIZZLE_RGBA_END, "did not fill in all the swizzle string ids");
+	}
+
+	add_intrinsic_string(HCC_STRING_ID_ONCE, "once");
+	add_intrinsic_string(HCC_STRING_ID_DEFINED, "defined");
+	add_intrinsic_string(HCC_STRING_ID___VA_ARGS__, "__VA_ARGS__");
+	add_intrinsic_string(HCC_STRING_ID_X, "x");
+	add_intrinsic_string(HCC_STRING_ID_Y, "y");
+	add_intrinsic_string(HCC_STRING_ID_Z, "z");
+	add_intrinsic_string(HCC_STRING_ID_W, "w");
+	add_intrinsic_string(HCC_STRING_ID_R, "r");
+	add_intrinsic_string(HCC_STRING_ID_G, "g");
+	add_intrinsic_string(HCC_STRING_ID_B, "b");
+	add_intrinsic_string(HCC_STRING_ID_A, "a");
+
+	{
+		char buf[128];
+
+		for (uint32_t f = 0; f < HCC_COMPOUND_DATA_TYPE_IDX_STRINGS_COUNT; f += 1) {
+			const char* string = hcc_intrinisic_compound_data_type_strings[f];
+
+			uint32_t expected_string_id = HCC_STRING_ID_INTRINSIC_COMPOUND_DATA_TYPES_START + f;
+			add_intrinsic_string(expected_string_id, string);
+		}
+
+		//
+		// generate the packed vector names
+		for (uint32_t c = 2; c <= 4; c += 1) {
+			for (HccAMLIntrinsicDataType intrinsic = HCC_AML_INTRINSIC_DATA_TYPE_S8; intrinsic <= HCC_AML_INTRINSIC_DATA_TYPE_F64; intrinsic += 1) {
+				snprintf(buf, sizeof(buf), "p%sx%u", hcc_aml_intrinsic_data_type_scalar_strings[intrinsic], c);
+				uint32_t expected_string_id = HCC_STRING_ID_INTRINSIC_COMPOUND_DATA_TYPES_START + HCC_COMPOUND_DATA_TYPE_IDX_PACKED_AML_START + HCC_AML_INTRINSIC_DATA_TYPE(intrinsic, c, 1);
+				add_intrinsic_string(expected_string_id, buf);
+			}
+		}
+
+		//
+		// generate the packed matrix names
+		for (uint32_t r = 2; r <= 4; r += 1) {
+			for (uint32_t c = 2; c <= 4; c += 1) {
+				for (HccAMLIntrinsicDataType intrinsic = HCC_AML_INTRINSIC_DATA_TYPE_S8; intrinsic <= HCC_AML_INTRINSIC_DATA_TYPE_F64; intrinsic += 1) {
+					snprintf(buf, sizeof(buf), "p%sx%ux%u", hcc_aml_intrinsic_data_type_scalar_strings[intrinsic], c, r);
+					uint32_t expected_string_id = HCC_STRING_ID_INTRINSIC_COMPOUND_DATA_TYPES_START + HCC_COMPOUND_DATA_TYPE_IDX_PACKED_AML_START + HCC_AML_INTRINSIC_DATA_TYPE(intrinsic, c, r);
+					add_intrinsic_string(expected_string_id, buf);
+				}
+			}
+		}
+
+		for (uint32_t f = 0; f < HCC_FUNCTION_IDX_STRINGS_COUNT; f += 1) {
+			const char* string = hcc_intrinisic_function_strings[f];
+			uint32_t expected_string_id = HCC_STRING_ID_INTRINSIC_FUNCTIONS_START + f;
+			add_intrinsic_string(expected_string_id, string);
+		}
+
+		for (uint32_t f = 0; f < HCC_FUNCTION_MANY_COUNT; f += 1) {
+			const char* function_prefix = hcc_intrinisic_function_many_strings[f];
+			uint32_t expected_string_id = HCC_STRING_ID_INTRINSIC_FUNCTIONS_START + HCC_FUNCTION_IDX_MANY_START + (f * HCC_FUNCTION_MANY_STRIDE);
+			uint32_t insert_idx = snprintf(buf, sizeof(buf), "%s_", function_prefix);
+
+			HccManyTypeClass support = hcc_intrinisic_function_many_support[f];
+
+			//
+			// generate the scalar versions of this function if they are supported
+			if (support & HCC_MANY_TYPE_CLASS_OPS_SCALAR) {
+				add_intrinsic_many_function_strings(buf, sizeof(buf), insert_idx, "%s", expected_string_id, support, 0, 0);
+			}
+			expected_string_id += 16;
+
+			//
+			// generate the vector versions of this function if they are supported
+			if (support & HCC_MANY_TYPE_CLASS_OPS_VECTOR) {
+				for (uint32_t c = 2; c <= 4; c += 1) {
+					add_intrinsic_many_function_strings(buf, sizeof(buf), insert_idx, "%sx%u", expected_string_id, support, c, 0);
+					expected_string_id += 16;
+				}
+			} else {
+				expected_string_id += 48;
+			}
+
+			if (support & HCC_MANY_TYPE_CLASS_STORAGE_TEXTURE) {
+				const char* fmt = "%s%s%s_%s";
+
+				for (uint32_t dim = 0; dim < HCC_TEXTURE_DIM_COUNT; dim += 1) {
+					for (uint32_t is_ms = 0; is_ms <= 1; is_ms += 1) {
+						const char* ms = is_ms ? "_ms" : "";
+						for (uint32_t is_array = 0; is_array <= 1; is_array += 1) {
+							const char* array = is_array ? "_array" : "";
+							for (uint32_t format = 0; format < HCC_TEXTURE_FORMAT_COUNT; format += 1) {
+								const char* fmt_string = hcc_texture_format_idents_lower[format];
+								snprintf(buf + insert_idx, sizeof(buf) - insert_idx, fmt, hcc_texture_dim_strings_lower[dim], ms, array, fmt_string);
+								add_intrinsic_string(expected_string_id, buf);
+								expected_string_id += 1;
+							}
+						}
+					}
+				}
+			}
+
+			if (support & HCC_MANY_TYPE_CLASS_SAMPLE_TEXTURE) {
+				const char* fmt = "%s%s%s_%s%s";
+
+				for (uint32_t dim = 0; dim < HCC_TEXTURE_DIM_COUNT; dim += 1) {
+					for (uint32_t is_ms = 0; is_ms <= 1; is_ms += 1) {
+						const char* ms = is_ms ? "_ms" : "";
+						for (uint32_t is_array = 0; is_array <= 1; is_array += 1) {
+							const char* array = is_array ? "_array" : "";
+							for (uint32_t vector = 1; vector <= 4; vector += 1) {
+								const char* vector_suffix;
+								switch (vector) {
+									case 1: vector_suffix = ""; break;
+									case 2: vector_suffix = "x2"; break;
+									case 3: vector_suffix = "x3"; break;
+									case 4: vector_suffix = "x4"; break;
+								}
+								snprintf(buf + insert_idx, sizeof(buf) - insert_idx, fmt, hcc_texture_dim_strings_lower[dim], ms, array, hcc_aml_intrinsic_data_type_scalar_strings[HCC_AML_INTRINSIC_DATA_TYPE_F32], vector_suffix);
+								add_intrinsic_string(expected_string_id, buf);
+								expected_string_id += 1;
+
+								snprintf(buf + insert_idx, sizeof(buf) - insert_idx, fmt, hcc_texture_dim_strings_lower[dim], ms, array, hcc_aml_intrinsic_data_type_scalar_strings[HCC_AML_INTRINSIC_DATA_TYPE_S32], vector_suffix);
+								add_intrinsic_string(expected_string_id, buf);
+								expected_string_id += 1;
+
+								snprintf(buf + insert_idx, sizeof(buf) - insert_idx, fmt, hcc_texture_dim_strings_lower[dim], ms, array, hcc_aml_intrinsic_data_type_scalar_strings[HCC_AML_INTRINSIC_DATA_TYPE_U32], vector_suffix);
+								add_intrinsic_string(expected_string_id, buf);
+								expected_string_id += 1;
+
+								if (vector == 1) {
+									snprintf(buf + insert_idx, sizeof(buf) - insert_idx, fmt, hcc_texture_dim_strings_lower[dim], ms, array, hcc_aml_intrinsic_data_type_scalar_strings[HCC_AML_INTRINSIC_DATA_TYPE_S64], vector_suffix);
+									add_intrinsic_string(expected_string_id, buf);
+									expected_string_id += 1;
+
+									snprintf(buf + insert_idx, sizeof(buf) - insert_idx, fmt, hcc_texture_dim_strings_lower[dim], ms, array, hcc_aml_intrinsic_data_type_scalar_strings[HCC_AML_INTRINSIC_DATA_TYPE_U64], vector_suffix);
+									add_intrinsic_string(expected_string_id, buf);
+									expected_string_id += 1;
+								}
+							}
+						}
+					}
+				}
+			}
+
+			if (support & HCC_MANY_TYPE_CLASS_BYTE_BUFFER) {
+				const char* fmt = "%s%s";
+
+				for (uint32_t vector = 1; vector <= 4; vector += 1) {
+					const char* vector_suffix;
+					switch (vector) {
+						case 1: vector_suffix = ""; break;
+						case 2: vector_suffix = "x2"; break;
+						case 3: vector_suffix = "x3"; break;
+						case 4: vector_suffix = "x4"; break;
+					}
+					snprintf(buf + insert_idx, sizeof(buf) - insert_idx, fmt, hcc_aml_intrinsic_data_type_scalar_strings[HCC_AML_INTRINSIC_DATA_TYPE_F32], vector_suffix);
+					add_intrinsic_string(expected_string_id, buf);
+					expected_string_id += 1;
+
+					snprintf(buf + insert_idx, sizeof(buf) - insert_idx, fmt, hcc_aml_intrinsic_data_type_scalar_strings[HCC_AML_INTRINSIC_DATA_TYPE_S32], vector_suffix);
+					add_intrinsic_string(expected_string_id, buf);
+					expected_string_id += 1;
+
+					snprintf(buf + insert_idx, sizeof(buf) - insert_idx, fmt, hcc_aml_intrinsic_data_type_scalar_strings[HCC_AML_INTRINSIC_DATA_TYPE_U32], vector_suffix);
+					add_intrinsic_string(expected_string_id, buf);
+					expected_string_id += 1;
+				}
+			}
+		}
+	}
+}
+
+//
+// builds the perfect hash over the intrinsic strings.
+// the strings are put into buckets by their hash, then starting with the biggest bucket,
+// a displacement is searched for that puts all of the bucket's strings into empty slots.
+bool build_intrinsic_strings_perfect_hash(uint32_t buckets_count, uint32_t slots_count, uint16_t* displacements, uint16_t* slots, uint32_t* string_id_to_idx) {
+	uint32_t* bucket_counts = calloc(buckets_count, sizeof(uint32_t));
+	uint32_t* bucket_starts = calloc(buckets_count + 1, sizeof(uint32_t));
+	uint32_t* bucket_string_ids = calloc(intrinsic_strings.count, sizeof(uint32_t));
+	uint32_t* bucket_order = calloc(buckets_count, sizeof(uint32_t));
+	uint32_t* bucket_slots = calloc(intrinsic_strings.count, sizeof(uint32_t));
+	memset(slots, 0, slots_count * sizeof(uint16_t));
+	memset(displacements, 0, buckets_count * sizeof(uint16_t));
+
+	for (uint32_t string_id = 1; string_id < HCC_STRING_ID_INTRINSIC_END; string_id += 1) {
+		if (intrinsic_strings.strings[string_id]) {
+			bucket_counts[intrinsic_strings.hashes[string_id] & (buckets_count - 1)] += 1;
+		}
+	}
+	for (uint32_t bucket_idx = 0; bucket_idx < buckets_count; bucket_idx += 1) {
+		bucket_starts[bucket_idx + 1] = bucket_starts[bucket_idx] + bucket_counts[bucket_idx];
+		bucket_counts[bucket_idx] = 0;
+		bucket_order[bucket_idx] = bucket_idx;
+	}
+	for (uint32_t string_id = 1; string_id < HCC_STRING_ID_INTRINSIC_END; string_id += 1) {
+		if (intrinsic_strings.strings[string_id]) {
+			uint32_t bucket_idx = intrinsic_strings.hashes[string_id] & (buckets_count - 1);
+			bucket_string_ids[bucket_starts[bucket_idx] + bucket_counts[bucket_idx]] = string_id;
+			bucket_counts[bucket_idx] += 1;
+		}
+	}
+
+	//
+	// insertion sort the buckets from biggest to smallest, there are only a few thousand of them
+	for (uint32_t idx = 1; idx < buckets_count; idx += 1) {
+		uint32_t bucket_idx = bucket_order[idx];
+		uint32_t j = idx;
+		while (j > 0 && bucket_counts[bucket_order[j - 1]] < bucket_counts[bucket_idx]) {
+			bucket_order[j] = bucket_order[j - 1];
+			j -= 1;
+		}
+		bucket_order[j] = bucket_idx;
+	}
+
+	bool is_success = true;
+	for (uint32_t idx = 0; idx < buckets_count && is_success; idx += 1) {
+		uint32_t bucket_idx = bucket_order[idx];
+		uint32_t count = bucket_counts[bucket_idx];
+		if (count == 0) {
+			break;
+		}
+
+		uint32_t* string_ids = &bucket_string_ids[bucket_starts[bucket_idx]];
+		is_success = false;
+		for (uint32_t displacement = 0; displacement <= UINT16_MAX; displacement += 1) {
+			bool is_found = true;
+			for (uint32_t i = 0; i < count && is_found; i += 1) {
+				uint32_t slot = hcc_intrinsic_string_slot(intrinsic_strings.hashes[string_ids[i]], displacement, slots_count);
+				if (slots[slot]) {
+					is_found = false;
+				}
+				for (uint32_t j = 0; j < i && is_found; j += 1) {
+					if (bucket_slots[j] == slot) {
+						is_found = false;
+					}
+				}
+				bucket_slots[i] = slot;
+			}
+
+			if (is_found) {
+				for (uint32_t i = 0; i < count; i += 1) {
+					slots[bucket_slots[i]] = string_id_to_idx[string_ids[i]] + 1;
+				}
+				displacements[bucket_idx] = displacement;
+				is_success = true;
+				break;
+			}
+		}
+	}
+
+	free(bucket_counts);
+	free(bucket_starts);
+	free(bucket_string_ids);
+	free(bucket_order);
+	free(bucket_slots);
+	return is_success;
+}
+
+void print_u16_array(const char* ident, uint16_t* values, uint32_t count) {
+	fprintf(ctx.f, "const uint16_t %s[%u] = {", ident, count);
+	for (uint32_t idx = 0; idx < count; idx += 1) {
+		fprintf(ctx.f, idx % 16 ? " %u," : "\n\t%u,", values[idx]);
+	}
+	fprintf(ctx.f, "\n};\n\n");
+}
+
+void generate_intrinsic_strings_file(void) {
+	intrinsic_strings.strings = calloc(HCC_STRING_ID_INTRINSIC_END, sizeof(char*));
+	intrinsic_strings.hashes = calloc(HCC_STRING_ID_INTRINSIC_END, sizeof(HccHash64));
+	add_intrinsic_strings();
+
+	uint32_t* string_id_to_idx = calloc(HCC_STRING_ID_INTRINSIC_END, sizeof(uint32_t));
+	uint32_t* idx_to_string_id = calloc(intrinsic_strings.count, sizeof(uint32_t));
+	uint32_t idx = 0;
+	for (uint32_t string_id = 1; string_id < HCC_STRING_ID_INTRINSIC_END; string_id += 1) {
+		const char* string = intrinsic_strings.strings[string_id];
+		if (string) {
+			HccHash64 hash = hcc_intrinsic_string_hash(string, strlen(string));
+			intrinsic_strings.hashes[string_id] = hash;
+
+			//
+			// the same string with two identifiers would never fit in the perfect hash
+			for (uint32_t other_idx = 0; other_idx < idx; other_idx += 1) {
+				uint32_t other_string_id = idx_to_string_id[other_idx];
+				if (intrinsic_strings.hashes[other_string_id] == hash) {
+					fprintf(stderr, "intrinsic strings '%s' and '%s' have the same hash\n", intrinsic_strings.strings[other_string_id], string);
+					exit(1);
+				}
+			}
+
+			string_id_to_idx[string_id] = idx;
+			idx_to_string_id[idx] = string_id;
+			idx += 1;
+		}
+	}
+
+	//
+	// the slots are a power of two with a load factor of at most a half so a displacement is quickly found.
+	// if a bucket cannot be placed then try again with more buckets.
+	uint32_t slots_count = 1;
+	while (slots_count < intrinsic_strings.count * 2) {
+		slots_count <<= 1;
+	}
+	uint32_t buckets_count = slots_count / 8;
+	uint16_t* slots = calloc(slots_count, sizeof(uint16_t));
+	uint16_t* displacements = calloc(slots_count, sizeof(uint16_t));
+	while (!build_intrinsic_strings_perfect_hash(buckets_count, slots_count, displacements, slots, string_id_to_idx)) {
+		buckets_count <<= 1;
+		if (buckets_count > slots_count) {
+			fprintf(stderr, "failed to build the perfect hash for the intrinsic strings\n");
+			exit(1);
+		}
+	}
+
+	ctx.f = open_file_write("src/intrinsic_strings.c");
+	print_file_header();
+	fprintf(ctx.f,
+		"#define HCC_INTRINSIC_STRINGS_COUNT %u\n"
+		"#define HCC_INTRINSIC_STRINGS_BUCKETS_COUNT %u\n"
+		"#define HCC_INTRINSIC_STRINGS_SLOTS_COUNT %u\n"
+		"\n"
+		"static_assert(HCC_STRING_ID_INTRINSIC_END == %u, \"src/intrinsic_strings.c is out of date, regenerate it with scripts/intrinsics_gen.sh\");\n"
+		"\n",
+		intrinsic_strings.count, buckets_count, slots_count, HCC_STRING_ID_INTRINSIC_END
+	);
+
+	print_u16_array("hcc_intrinsic_strings_bucket_displacements", displacements, buckets_count);
+	print_u16_array("hcc_intrinsic_strings_slots", slots, slots_count);
+
+	//
+	// pack the strings into rows that do not go over the size of a row.
+	// a row is a single string literal with one string per line.
+	uint32_t data_idx = 0;
+	fprintf(ctx.f, "const HccIntrinsicString hcc_intrinsic_strings[%u] = {\n", intrinsic_strings.count);
+	for (uint32_t string_id = 1; string_id < HCC_STRING_ID_INTRINSIC_END; string_id += 1) {
+		const char* string = intrinsic_strings.strings[string_id];
+		if (string) {
+			uint32_t size = strlen(string);
+			uint32_t row_remaining_size = HCC_INTRINSIC_STRINGS_DATA_ROW_SIZE - 1 - (data_idx % HCC_INTRINSIC_STRINGS_DATA_ROW_SIZE);
+			if (size > row_remaining_size) {
+				data_idx += row_remaining_size + 1;
+			}
+			fprintf(ctx.f, "\t{ %u, %u, %u },\n", string_id, data_idx, size);
+			data_idx += size;
+		}
+	}
+	fprintf(ctx.f, "};\n\n");
+
+	uint32_t rows_count = data_idx / HCC_INTRINSIC_STRINGS_DATA_ROW_SIZE + 1;
+	fprintf(ctx.f, "const char hcc_intrinsic_strings_data[%u][HCC_INTRINSIC_STRINGS_DATA_ROW_SIZE] = {\n\t\"", rows_count);
+	data_idx = 0;
+	for (uint32_t string_id = 1; string_id < HCC_STRING_ID_INTRINSIC_END; string_id += 1) {
+		const char* string = intrinsic_strings.strings[string_id];
+		if (string) {
+			uint32_t size = strlen(string);
+			uint32_t row_remaining_size = HCC_INTRINSIC_STRINGS_DATA_ROW_SIZE - 1 - (data_idx % HCC_INTRINSIC_STRINGS_DATA_ROW_SIZE);
+			if (size > row_remaining_size) {
+				data_idx += row_remaining_size + 1;
+				fprintf(ctx.f, "\",\n\t\"");
+			} else if (data_idx % HCC_INTRINSIC_STRINGS_DATA_ROW_SIZE) {
+				fprintf(ctx.f, "\"\n\t\"");
+			}
+			fprintf(ctx.f, "%s", string);
+			data_idx += size;
+		}
+	}
+	fprintf(ctx.f, "\"\n};\n");
+
+	fclose(ctx.f);
+	free(slots);
+	free(displacements);
+	free(string_id_to_idx);
+	free(idx_to_string_id);
+}
+
 int main(int argc, char** argv) {
 	generate_texture_intrinsics_file();
+	generate_intrinsic_strings_file();
 }
 
@@ -0,0 +1,175 @@
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+//
+// measures the jobs per second of the worker job deques and the injection queue for 1 to N workers.
+// the compiler is built into this tool so the same hcc_compiler_push_worker_job and hcc_compiler_find_worker_job are used.
+// no tasks are dispatched, each job just spins for a while and then gives out two child jobs
+// until the requested number of jobs have run, so the jobs spread out to the workers by stealing.
+#include "../src/core.c"
+#include "../src/ata.c"
+#include "../src/ast.c"
+#include "../src/aml.c"
+#include "../src/atagen.c"
+#include "../src/astgen.c"
+#include "../src/astlink.c"
+#include "../src/amlgen.c"
+#include "../src/amlopt.c"
+#include "../src/spirv.c"
+#include "../src/spirvgen.c"
+#include "../src/spirvlink.c"
+#include "../src/metadatagen.c"
+#include "../interop/hcc_interop.c"
+#include "../src/intrinsic_strings.c"
+#include "../src/hcc.c"
+#include <hmaths.c>
+
+typedef struct BenchWorker BenchWorker;
+struct BenchWorker {
+	HccCompiler*         c;
+	HccWorker*           w;
+	HccAtomic(uint32_t)* done_jobs_count;
+	uint32_t             jobs_count;
+	uint32_t             job_spin_count;
+};
+
+void bench_run_job(BenchWorker* bw, HccWorkerJob* job) {
+	//
+	// the job argument is the number of jobs in this job's tree, including itself
+	uint32_t tree_jobs_count = (uintptr_t)job->arg;
+	for (uint32_t idx = 0; idx < bw->job_spin_count; idx += 1) {
+		HCC_CPU_RELAX();
+	}
+
+	uint32_t children_jobs_count = tree_jobs_count - 1;
+	uint32_t left_jobs_count = children_jobs_count / 2;
+	uint32_t right_jobs_count = children_jobs_count - left_jobs_count;
+	if (left_jobs_count) {
+		HccWorkerJob child = { .arg = (void*)(uintptr_t)left_jobs_count };
+		hcc_compiler_push_worker_job(bw->c, &child);
+	}
+	if (right_jobs_count) {
+		HccWorkerJob child = { .arg = (void*)(uintptr_t)right_jobs_count };
+		hcc_compiler_push_worker_job(bw->c, &child);
+	}
+
+	atomic_fetch_add(bw->done_jobs_count, 1);
+}
+
+void bench_worker_main(void* arg) {
+	BenchWorker* bw = arg;
+	_hcc_tls.w = bw->w;
+
+	HccWorkerJob job;
+	while (atomic_load(bw->done_jobs_count) < bw->jobs_count) {
+		if (hcc_compiler_find_worker_job(bw->c, bw->w, &job)) {
+			bench_run_job(bw, &job);
+		} else {
+			HCC_CPU_RELAX();
+		}
+	}
+}
+
+double bench_run(uint32_t workers_count, uint32_t jobs_count, uint32_t job_spin_count) {
+	HccCompiler c = {0};
+	HccWorker* workers = calloc(workers_count, sizeof(HccWorker));
+	BenchWorker* bench_workers = calloc(workers_count, sizeof(BenchWorker));
+	HccThread* threads = calloc(workers_count, sizeof(HccThread));
+	HccAtomic(uint32_t) done_jobs_count = 0;
+
+	//
+	// the deques and the injection queue are sized the same way as hcc_compiler_init does
+	uint32_t jobs_queue_cap = hcc_compiler_setup_default.worker_jobs_queue_cap;
+	uintptr_t injection_queue_size = HCC_INT_ROUND_UP_ALIGN((uintptr_t)jobs_queue_cap * sizeof(HccWorkerJob), _hcc_gs.virt_mem_reserve_align);
+	hcc_virt_mem_reserve_commit(HCC_ALLOC_TAG_WORKER_JOB_QUEUE, NULL, injection_queue_size, HCC_VIRT_MEM_PROTECTION_READ_WRITE, (void**)&c.injection_queue.data);
+	c.injection_queue.cap = jobs_queue_cap;
+	hcc_spin_mutex_init(&c.injection_queue.mutex);
+	c.workers = workers;
+	c.workers_count = workers_count;
+
+	uint32_t deque_cap = hcc_compiler_worker_share_cap(jobs_queue_cap, workers_count, HCC_WORKER_JOB_DEQUE_MIN_CAP);
+	uintptr_t call_stack_size = hcc_compiler_setup_default.worker_call_stack_size;
+	void* call_stacks;
+	hcc_virt_mem_reserve_commit(HCC_ALLOC_TAG_WORKER_CALL_STACKS, NULL, HCC_INT_ROUND_UP_ALIGN(call_stack_size * workers_count, _hcc_gs.virt_mem_reserve_align), HCC_VIRT_MEM_PROTECTION_READ_WRITE, &call_stacks);
+	for (uint32_t idx = 0; idx < workers_count; idx += 1) {
+		workers[idx].c = &c;
+		hcc_worker_job_deque_init(&workers[idx].job_deque, deque_cap);
+		bench_workers[idx] = (BenchWorker) {
+			.c = &c,
+			.w = &workers[idx],
+			.done_jobs_count = &done_jobs_count,
+			.jobs_count = jobs_count,
+			.job_spin_count = job_spin_count,
+		};
+	}
+
+	//
+	// the root job goes through the injection queue like the first jobs of hcc_compiler_dispatch_task
+	HccTime start_time = hcc_time_now(HCC_TIME_MODE_MONOTONIC);
+	HccWorkerJob root = { .arg = (void*)(uintptr_t)jobs_count };
+	hcc_compiler_push_worker_job(&c, &root);
+	for (uint32_t idx = 0; idx < workers_count; idx += 1) {
+		HccThreadSetup thread_setup = {
+			.thread_main_fn = bench_worker_main,
+			.arg = &bench_workers[idx],
+			.call_stack = HCC_PTR_ADD(call_stacks, call_stack_size * idx),
+			.call_stack_size = call_stack_size,
+		};
+		hcc_thread_start(&threads[idx], &thread_setup);
+	}
+	for (uint32_t idx = 0; idx < workers_count; idx += 1) {
+		hcc_thread_wait_for_termination(&threads[idx]);
+	}
+	HccDuration duration = hcc_time_diff(hcc_time_now(HCC_TIME_MODE_MONOTONIC), start_time);
+
+	for (uint32_t idx = 0; idx < workers_count; idx += 1) {
+		hcc_worker_job_deque_deinit(&workers[idx].job_deque);
+	}
+	hcc_virt_mem_release(HCC_ALLOC_TAG_WORKER_CALL_STACKS, call_stacks, HCC_INT_ROUND_UP_ALIGN(call_stack_size * workers_count, _hcc_gs.virt_mem_reserve_align));
+	hcc_virt_mem_release(HCC_ALLOC_TAG_WORKER_JOB_QUEUE, c.injection_queue.data, injection_queue_size);
+	free(threads);
+	free(bench_workers);
+	free(workers);
+
+	return hcc_duration_to_f64_secs(duration);
+}
+
+int main(int argc, char** argv) {
+	uint32_t jobs_count = argc > 1 ? strtoul(argv[1], NULL, 10) : 1000000;
+	uint32_t max_workers_count = argc > 2 ? strtoul(argv[2], NULL, 10) : hcc_logical_cores_count();
+	uint32_t job_spin_count = argc > 3 ? strtoul(argv[3], NULL, 10) : 0;
+	uint32_t runs_count = argc > 4 ? strtoul(argv[4], NULL, 10) : 3;
+	if (jobs_count == 0 || max_workers_count == 0 || runs_count == 0) {
+		fprintf(stderr, "usage: %s [jobs_count] [max_workers_count] [job_spin_count] [runs_count]\n", argv[0]);
+		return 1;
+	}
+
+	HccSetup setup = hcc_setup_default;
+	if (!HCC_IS_SUCCESS(hcc_init(&setup))) {
+		fprintf(stderr, "failed to initialize hcc\n");
+		return 1;
+	}
+
+	printf("%u jobs, %u spins per job, best of %u runs\n", jobs_count, job_spin_count, runs_count);
+	printf("workers    secs     jobs/sec  scaling\n");
+	double single_worker_jobs_per_sec = 0.0;
+	for (uint32_t workers_count = 1; workers_count <= max_workers_count; workers_count += 1) {
+		double secs = 0.0;
+		for (uint32_t run_idx = 0; run_idx < runs_count; run_idx += 1) {
+			double run_secs = bench_run(workers_count, jobs_count, job_spin_count);
+			if (run_idx == 0 || run_secs < secs) {
+				secs = run_secs;
+			}
+		}
+
+		double jobs_per_sec = (double)jobs_count / secs;
+		if (workers_count == 1) {
+			single_worker_jobs_per_sec = jobs_per_sec;
+		}
+		printf("%7u  %6.3f  %11.0f  %6.2fx\n", workers_count, secs, jobs_per_sec, jobs_per_sec / single_worker_jobs_per_sec);
+	}
+
+	return 0;
+}